@@ -36,6 +36,12 @@
 namespace Fsl
 {
   struct ParticleDrawContext;
+  class WorkerThreadPool;
+
+  namespace Graphics3D
+  {
+    class ParticleEngine;
+  }
 
 
   class IParticleDraw
@@ -44,6 +50,10 @@ namespace Fsl
     virtual ~IParticleDraw() = default;
 
     virtual void Draw(const ParticleDrawContext& context, const uint8_t* pParticles, const uint32_t particleCount, const uint32_t particleStride) = 0;
+
+    //! @brief Draw the particles stored in a structure of arrays particle engine
+    //! @param rWorkerPool the pool used to split the vertex generation across threads
+    virtual void Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine, WorkerThreadPool& rWorkerPool) = 0;
   };
 }
 
@@ -32,10 +32,12 @@
 #include "ParticleDrawGeometryShaderGLES3.hpp"
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslGraphics/Vertices/VertexDeclarationArray.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
 #include <FslUtil/OpenGLES3/GLCheck.hpp>
 #include <GLES2/gl2ext.h>
 #include <GLES3/gl31.h>
@@ -103,6 +105,38 @@ namespace Fsl
       return;
     }
 
+    DrawBuffer(context, *m_pCurrentBuffer, pParticles, particleCount);
+
+    // Swap the buffers if double buffering is enabled
+    if (m_pOtherBuffer != nullptr)
+    {
+      std::swap(m_pCurrentBuffer, m_pOtherBuffer);
+    }
+  }
+
+
+  void ParticleDrawGeometryShaderGLES3::Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine,
+                                             WorkerThreadPool& rWorkerPool)
+  {
+    if (engine.GetCount() <= 0)
+    {
+      return;
+    }
+
+    if (m_engineVertices.size() < engine.GetCapacity())
+    {
+      m_engineVertices.resize(engine.GetCapacity());
+      m_engineVertexBuffer.Reset(nullptr, m_engineVertices.size(), Graphics3D::ParticlePointVertex::AsVertexDeclarationSpan(), GL_DYNAMIC_DRAW);
+    }
+    engine.WritePointVertices(SpanUtil::AsSpan(m_engineVertices), rWorkerPool);
+    // The attrib links stay valid as ParticlePointVertex uses the same element order as the particle record declaration
+    DrawBuffer(context, m_engineVertexBuffer, m_engineVertices.data(), engine.GetCount());
+  }
+
+
+  void ParticleDrawGeometryShaderGLES3::DrawBuffer(const ParticleDrawContext& context, GLES3::GLVertexBuffer& rBuffer, const void* const pVertices,
+                                                   const uint32_t vertexCount)
+  {
     // glDisable(GL_CULL_FACE);
     glEnable(GL_CULL_FACE);
 
@@ -124,19 +158,13 @@ namespace Fsl
       glProgramUniformMatrix4fv(m_shaderGeom.Get(), m_locWorldViewProjectionMatrix, 1, GL_FALSE, context.MatrixWorldViewProjection.DirectAccess());
     }
 
-    glBindBuffer(m_pCurrentBuffer->GetTarget(), m_pCurrentBuffer->Get());
-    m_pCurrentBuffer->SetDataFast(0, pParticles, particleCount);
-    m_pCurrentBuffer->EnableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
+    glBindBuffer(rBuffer.GetTarget(), rBuffer.Get());
+    rBuffer.SetDataFast(0, pVertices, vertexCount);
+    rBuffer.EnableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
 
-    glDrawArrays(GL_POINTS, 0, UncheckedNumericCast<GLsizei>(particleCount));
-
-    // Swap the buffers if double buffering is enabled
-    if (m_pOtherBuffer != nullptr)
-    {
-      std::swap(m_pCurrentBuffer, m_pOtherBuffer);
-    }
+    glDrawArrays(GL_POINTS, 0, UncheckedNumericCast<GLsizei>(vertexCount));
 
-    m_pCurrentBuffer->DisableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
+    rBuffer.DisableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
     m_pipeline.BindClear();
   }
 
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslGraphics3D/Particles/ParticlePointVertex.hpp>
 #include <FslUtil/OpenGLES3/GLProgram.hpp>
 #include <FslUtil/OpenGLES3/GLVertexBuffer.hpp>
 #include <FslUtil/OpenGLES3_1/GLProgramPipeline.hpp>
@@ -58,6 +59,9 @@ namespace Fsl
     GLES3::GLVertexBuffer m_vertexBuffer2;
     GLES3::GLVertexBuffer* m_pCurrentBuffer;
     GLES3::GLVertexBuffer* m_pOtherBuffer;
+    //! Scratch vertices and buffer used when drawing a ParticleEngine (created on first use)
+    std::vector<Graphics3D::ParticlePointVertex> m_engineVertices;
+    GLES3::GLVertexBuffer m_engineVertexBuffer;
 
     GLint m_locViewProjectionMatrix;
     GLint m_locWorldViewProjectionMatrix;
@@ -69,8 +73,10 @@ namespace Fsl
                                     const uint32_t cbParticleRecord, const bool useDoubleBuffering);
 
     void Draw(const ParticleDrawContext& context, const uint8_t* pParticles, const uint32_t particleCount, const uint32_t particleStride) override;
+    void Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine, WorkerThreadPool& rWorkerPool) override;
 
   private:
+    void DrawBuffer(const ParticleDrawContext& context, GLES3::GLVertexBuffer& rBuffer, const void* const pVertices, const uint32_t vertexCount);
     void Construct(const std::shared_ptr<IContentManager>& contentManager);
   };
 }
@@ -32,10 +32,12 @@
 #include "ParticleDrawPointsGLES3.hpp"
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslGraphics/Vertices/VertexDeclarationArray.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
 #include <algorithm>
 #include <array>
 #include <cassert>
@@ -94,6 +96,32 @@ namespace Fsl
 
   void ParticleDrawPointsGLES3::Draw(const ParticleDrawContext& context, const uint8_t* pParticles, const uint32_t particleCount,
                                      const uint32_t /*particleStride*/)
+  {
+    DrawBuffer(context, *m_pCurrentBuffer, pParticles, particleCount);
+
+    // Swap the buffers if double buffering is enabled
+    if (m_pOtherBuffer != nullptr)
+    {
+      std::swap(m_pCurrentBuffer, m_pOtherBuffer);
+    }
+  }
+
+
+  void ParticleDrawPointsGLES3::Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine, WorkerThreadPool& rWorkerPool)
+  {
+    if (m_engineVertices.size() < engine.GetCapacity())
+    {
+      m_engineVertices.resize(engine.GetCapacity());
+      m_engineVertexBuffer.Reset(nullptr, m_engineVertices.size(), Graphics3D::ParticlePointVertex::AsVertexDeclarationSpan(), GL_DYNAMIC_DRAW);
+    }
+    engine.WritePointVertices(SpanUtil::AsSpan(m_engineVertices), rWorkerPool);
+    // The attrib links stay valid as ParticlePointVertex uses the same element order as the particle record declaration
+    DrawBuffer(context, m_engineVertexBuffer, m_engineVertices.data(), engine.GetCount());
+  }
+
+
+  void ParticleDrawPointsGLES3::DrawBuffer(const ParticleDrawContext& context, GLES3::GLVertexBuffer& rBuffer, const void* const pVertices,
+                                           const uint32_t vertexCount)
   {
     const GLuint hProgram = m_program.Get();
     // Set the shader program
@@ -102,19 +130,13 @@ namespace Fsl
     glUniformMatrix4fv(m_locWorldViewProjectionMatrix, 1, 0, context.MatrixWorldViewProjection.DirectAccess());
     glUniform1f(m_locResolutionMod, context.ScreenAspectRatio);
 
-    glBindBuffer(m_pCurrentBuffer->GetTarget(), m_pCurrentBuffer->Get());
-    m_pCurrentBuffer->SetDataFast(0, pParticles, particleCount);
-    m_pCurrentBuffer->EnableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
-
-    glDrawArrays(GL_POINTS, 0, UncheckedNumericCast<GLsizei>(particleCount));
+    glBindBuffer(rBuffer.GetTarget(), rBuffer.Get());
+    rBuffer.SetDataFast(0, pVertices, vertexCount);
+    rBuffer.EnableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
 
-    m_pCurrentBuffer->DisableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
+    glDrawArrays(GL_POINTS, 0, UncheckedNumericCast<GLsizei>(vertexCount));
 
-    // Swap the buffers if double buffering is enabled
-    if (m_pOtherBuffer != nullptr)
-    {
-      std::swap(m_pCurrentBuffer, m_pOtherBuffer);
-    }
+    rBuffer.DisableAttribArrays(m_particleAttribLink.data(), m_particleAttribLink.size());
   }
 
 
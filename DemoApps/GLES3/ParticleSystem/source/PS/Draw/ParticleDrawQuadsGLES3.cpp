@@ -31,10 +31,12 @@
 
 #include "ParticleDrawQuadsGLES3.hpp"
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoApp/Base/Service/Content/IContentManager.hpp>
 #include <FslGraphics/Colors.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
 #include <algorithm>
 #include <cassert>
 #include <cstddef>
@@ -75,14 +77,6 @@ namespace Fsl
   void ParticleDrawQuadsGLES3::Draw(const ParticleDrawContext& context, const uint8_t* pParticles, const uint32_t particleCount,
                                     const uint32_t particleStride)
   {
-    const GLuint hProgram = m_program.Get();
-    // Set the shader program
-    glUseProgram(hProgram);
-    // Load the matrices
-    glUniformMatrix4fv(m_locWorldViewProjectionMatrix, 1, 0, context.MatrixWorldViewProjection.DirectAccess());
-    glUniformMatrix4fv(m_locWorldViewMatrix, 1, 0, context.MatrixWorldView.DirectAccess());
-    glUniformMatrix4fv(m_locProjMatrix, 1, 0, context.MatrixProjection.DirectAccess());
-
     Vector4 col = Colors::White().ToVector4();
 
     // HighResolutionTimer timer;
@@ -140,6 +134,28 @@ namespace Fsl
     // auto end = timer.GetTime();
     // FSLLOG3_INFO("Particles-ToVertices Time: " << end - start);
 
+    DrawBuffer(context, particleCount);
+  }
+
+
+  void ParticleDrawQuadsGLES3::Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine, WorkerThreadPool& rWorkerPool)
+  {
+    // The engine writes the complete vertex (including the corner offsets stored in the normal) directly into the upload buffer
+    engine.WriteQuadVertices(SpanUtil::AsSpan(m_buffer), Colors::White().ToVector4(), rWorkerPool);
+    DrawBuffer(context, engine.GetCount());
+  }
+
+
+  void ParticleDrawQuadsGLES3::DrawBuffer(const ParticleDrawContext& context, const uint32_t particleCount)
+  {
+    const GLuint hProgram = m_program.Get();
+    // Set the shader program
+    glUseProgram(hProgram);
+    // Load the matrices
+    glUniformMatrix4fv(m_locWorldViewProjectionMatrix, 1, 0, context.MatrixWorldViewProjection.DirectAccess());
+    glUniformMatrix4fv(m_locWorldViewMatrix, 1, 0, context.MatrixWorldView.DirectAccess());
+    glUniformMatrix4fv(m_locProjMatrix, 1, 0, context.MatrixProjection.DirectAccess());
+
     glBindBuffer(m_pCurrentBuffer->GetTarget(), m_pCurrentBuffer->Get());
     m_pCurrentBuffer->SetDataFast(0, m_buffer.data(), particleCount * 6);
     m_pCurrentBuffer->EnableAttribArrays(m_particleAttribLink);
@@ -67,8 +67,10 @@ namespace Fsl
     ParticleDrawQuadsGLES3(const std::shared_ptr<IContentManager>& contentManager, const std::size_t capacity, const bool useDoubleBuffering);
 
     void Draw(const ParticleDrawContext& context, const uint8_t* pParticles, const uint32_t particleCount, const uint32_t particleStride) override;
+    void Draw(const ParticleDrawContext& context, const Graphics3D::ParticleEngine& engine, WorkerThreadPool& rWorkerPool) override;
 
   private:
+    void DrawBuffer(const ParticleDrawContext& context, const uint32_t particleCount);
     void Construct(const std::shared_ptr<IContentManager>& contentManager);
   };
 }
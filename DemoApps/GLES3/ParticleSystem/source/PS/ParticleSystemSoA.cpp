@@ -0,0 +1,106 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "ParticleSystemSoA.hpp"
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslDemoApp/Base/DemoTime.hpp>
+#include <algorithm>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The emitters typically add a small burst of particles per call, so the scratchpad is converted in batches of this size
+      constexpr std::size_t MaxScratchpadParticles = 1024;
+    }
+  }
+
+  ParticleSystemSoA::ParticleSystemSoA(std::shared_ptr<IParticleDraw> particleDraw, const std::size_t capacity)
+    : m_engine(NumericCast<uint32_t>(capacity))
+    , m_scratchpad(std::min(capacity, LocalConfig::MaxScratchpadParticles))
+    , m_particleDraw(std::move(particleDraw))
+  {
+  }
+
+
+  uint32_t ParticleSystemSoA::GetParticleCount() const
+  {
+    return m_engine.GetCount();
+  }
+
+
+  void ParticleSystemSoA::AddEmitter(const std::shared_ptr<IParticleEmitter>& emitter)
+  {
+    m_emitters.push_back(emitter);
+  }
+
+
+  void ParticleSystemSoA::Update(const DemoTime& demoTime)
+  {
+    // Allow the emitters to create new particles
+    // BEWARE that this allows the emitters to call the 'AddParticles' functions
+    for (auto itr = m_emitters.begin(); itr != m_emitters.end(); ++itr)
+    {
+      (*itr)->Update(*this, demoTime);
+    }
+
+    m_engine.Update(demoTime.DeltaTime, m_gravity, m_workerPool);
+  }
+
+
+  void ParticleSystemSoA::Draw(const ParticleDrawContext& context)
+  {
+    m_particleDraw->Draw(context, m_engine, m_workerPool);
+  }
+
+
+  void ParticleSystemSoA::AddParticles(const Particle* pParticles, const std::size_t& count)
+  {
+    // Silently ignore a attempt to add too many particles (like ParticleSystemOneArray)
+    std::size_t offset = 0;
+    while (offset < count && m_engine.GetCount() < m_engine.GetCapacity())
+    {
+      const std::size_t batchCount = std::min(count - offset, m_scratchpad.size());
+      for (std::size_t i = 0; i < batchCount; ++i)
+      {
+        const Particle& particle = pParticles[offset + i];
+        m_scratchpad[i] = Graphics3D::ParticleDesc(particle.Position, particle.Velocity, particle.StartEnergy, particle.StartSize, particle.EndSize,
+                                                   particle.TextureId);
+      }
+      m_engine.Add(SpanUtil::UncheckedAsReadOnlySpan(m_scratchpad, 0u, batchCount));
+      offset += batchCount;
+    }
+  }
+}
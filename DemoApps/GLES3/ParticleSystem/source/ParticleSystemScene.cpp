@@ -54,6 +54,7 @@
 #include "PS/Draw/ParticleDrawQuadsGLES3.hpp"
 #include "PS/Emit/BoxEmitter.hpp"
 #include "PS/ParticleSystemOneArray.hpp"
+#include "PS/ParticleSystemSoA.hpp"
 #include "PS/ParticleSystemTwoArrays.hpp"
 #include "PSGpu/ParticleSystemGLES3.hpp"
 #include "PSGpu/ParticleSystemSnow.hpp"
@@ -630,7 +631,8 @@ namespace Fsl
       typeEx = ParticleSystemType::Instancing;
     }
 
-    using particle_system_type = ParticleSystemOneArray;
+    using particle_system_type = ParticleSystemSoA;
+    // using particle_system_type = ParticleSystemOneArray;
     // using particle_system_type = ParticleSystemTwoArrays;
 
     switch (typeEx)
@@ -41,6 +41,7 @@
 #include <FslUtil/OpenGLES3/Exceptions.hpp>
 #include <FslUtil/OpenGLES3/GLCheck.hpp>
 #include <GLES3/gl3.h>
+#include <random>
 
 namespace Fsl
 {
@@ -49,9 +50,12 @@ namespace Fsl
 
   namespace
   {
-    float Distance(const Vector2& value0, const Vector2& value1)
+    namespace LocalConfig
     {
-      return (value1 - value0).Length();
+      constexpr float BallScale = 0.2f;
+      //! The number of free balls dropped into the scene, the solver handles far more than the batch can draw at a interactive rate
+      constexpr uint32_t BallCount = 512;
+      constexpr uint32_t RandomSeed = 0x1337;
     }
   }
 
@@ -67,6 +71,7 @@ namespace Fsl
     , m_graphicsService(config.DemoServiceProvider.Get<IGraphicsService>())
     , m_batch(std::dynamic_pointer_cast<NativeBatch2D>(m_graphicsService->GetNativeBatch2D()))
     , m_renderSystem(m_graphicsService->GetBasicRenderSystem())
+    , m_solver(Rect(), VerletSolver2DConfig())
     , m_rotation(0)
   {
     RegisterExtension(m_uiExtension);
@@ -92,22 +97,34 @@ namespace Fsl
     constexpr auto Size2Px = PxSize1D::Create(2);
     m_boundaryRect = PxRectangle(safeX, safeY, screenResolution.Width() - (Size2Px * safeX), screenResolution.Height() - (Size2Px * safeY));
 
+    const float ballRadius = static_cast<float>(m_texBall.GetSize().RawWidth()) * LocalConfig::BallScale * 0.5f;
+    m_solver.SetConfig(VerletSolver2DConfig(Vector2(0.0f, 0.5f), 0.999f, 0.90f, ballRadius, 3, true));
+    m_solver.SetBounds(Rect::FromLeftTopRightBottom(static_cast<float>(m_boundaryRect.RawLeft()), static_cast<float>(m_boundaryRect.RawTop()),
+                                                    static_cast<float>(m_boundaryRect.RawRight()), static_cast<float>(m_boundaryRect.RawBottom())));
+    m_solver.Reserve(4 + LocalConfig::BallCount, 5);
+
     auto offsetX = static_cast<float>(safeX.RawValue());
     auto offsetY = static_cast<float>(safeY.RawValue());
-    auto p0 = Particle(offsetX + 100.0f, offsetY + 100.0f, offsetX + 85.0f, offsetY + 95.0f);
-    auto p1 = Particle(offsetX + 200.0f, offsetY + 100.0f, offsetX + 200.0f, offsetY + 100.0f);
-    auto p2 = Particle(offsetX + 200.0f, offsetY + 200.0f, offsetX + 200.0f, offsetY + 200.0f);
-    auto p3 = Particle(offsetX + 100.0f, offsetY + 200.0f, offsetX + 100.0f, offsetY + 200.0f);
-
-    m_particles.push_back(p0);
-    m_particles.push_back(p1);
-    m_particles.push_back(p2);
-    m_particles.push_back(p3);
-    m_sticks.emplace_back(0, 1, Distance(p0.Position, p1.Position));
-    m_sticks.emplace_back(1, 2, Distance(p1.Position, p2.Position));
-    m_sticks.emplace_back(2, 3, Distance(p2.Position, p3.Position));
-    m_sticks.emplace_back(3, 0, Distance(p3.Position, p0.Position));
-    m_sticks.emplace_back(0, 2, Distance(p0.Position, p2.Position));
+    const uint32_t p0 = m_solver.AddParticle(Vector2(offsetX + 100.0f, offsetY + 100.0f), Vector2(offsetX + 85.0f, offsetY + 95.0f));
+    const uint32_t p1 = m_solver.AddParticle(Vector2(offsetX + 200.0f, offsetY + 100.0f), Vector2(offsetX + 200.0f, offsetY + 100.0f));
+    const uint32_t p2 = m_solver.AddParticle(Vector2(offsetX + 200.0f, offsetY + 200.0f), Vector2(offsetX + 200.0f, offsetY + 200.0f));
+    const uint32_t p3 = m_solver.AddParticle(Vector2(offsetX + 100.0f, offsetY + 200.0f), Vector2(offsetX + 100.0f, offsetY + 200.0f));
+    m_solver.AddStick(p0, p1);
+    m_solver.AddStick(p1, p2);
+    m_solver.AddStick(p2, p3);
+    m_solver.AddStick(p3, p0);
+    m_solver.AddStick(p0, p2);
+
+    // Drop some free balls into the scene so the particle-particle collisions are visible
+    std::mt19937 random(LocalConfig::RandomSeed);
+    std::uniform_real_distribution<float> positionX(m_solver.GetBounds().Left(), m_solver.GetBounds().Right());
+    std::uniform_real_distribution<float> positionY(m_solver.GetBounds().Top(), m_solver.GetBounds().Bottom());
+    std::uniform_real_distribution<float> velocity(-2.0f, 2.0f);
+    for (uint32_t i = 0; i < LocalConfig::BallCount; ++i)
+    {
+      const Vector2 position(positionX(random), positionY(random));
+      m_solver.AddParticle(position, position - Vector2(velocity(random), velocity(random)));
+    }
   }
 
 
@@ -116,13 +133,7 @@ namespace Fsl
 
   void VerletIntegration101::FixedUpdate(const DemoTime& /*demoTime*/)
   {
-    const float friction = 0.999f;
-    UpdateParticles(m_particles, friction);
-    for (std::size_t i = 0; i < 3; ++i)
-    {
-      UpdateSticks(m_particles, m_sticks);
-      ConstrainPoints(m_particles, m_boundaryRect, friction);
-    }
+    m_solver.Update(m_workerPool);
   }
 
 
@@ -145,8 +156,8 @@ namespace Fsl
 
     // m_batch->DebugDrawLine(m_texFill, dstFrom, dstRotated, Colors::White());
 
-    DrawSticks(m_particles, m_sticks);
-    DrawParticles(m_particles);
+    DrawSticks(m_solver);
+    DrawParticles(m_solver);
 
     m_batch->End();
 
@@ -155,92 +166,33 @@ namespace Fsl
   }
 
 
-  void VerletIntegration101::UpdateParticles(std::deque<Particle>& particles, const float friction)
-  {
-    const float gravity = 0.5f;
-
-    for (auto itr = particles.begin(); itr != particles.end(); ++itr)
-    {
-      auto velocity = (itr->Position - itr->OldPosition) * friction;
-      itr->OldPosition = itr->Position;
-      itr->Position += velocity;
-      itr->Position.Y += gravity;
-    }
-  }
-
-
-  void VerletIntegration101::UpdateSticks(std::deque<Particle>& particles, std::deque<Stick>& sticks)
-  {
-    for (auto itr = sticks.begin(); itr != sticks.end(); ++itr)
-    {
-      auto delta = particles[itr->PointIndex1].Position - particles[itr->PointIndex0].Position;
-      auto distance = delta.Length();
-      auto difference = itr->Length - distance;
-      auto percent = (difference / distance) * 0.5f;
-      auto offset = delta * percent;
-      particles[itr->PointIndex0].Position -= offset;
-      particles[itr->PointIndex1].Position += offset;
-    }
-  }
-
-
-  void VerletIntegration101::ConstrainPoints(std::deque<Particle>& particles, const PxRectangle& boundaryRect, const float friction)
-  {
-    const auto boundaryLeft = static_cast<float>(boundaryRect.RawLeft());
-    const auto boundaryTop = static_cast<float>(boundaryRect.RawTop());
-    const auto boundaryRight = static_cast<float>(boundaryRect.RawRight() - 1);
-    const auto boundaryBottom = static_cast<float>(boundaryRect.RawBottom() - 1);
-
-    const float bounce = 0.90f;
-
-    for (auto itr = particles.begin(); itr != particles.end(); ++itr)
-    {
-      auto velocity = (itr->Position - itr->OldPosition) * friction;
-      if (itr->Position.X > boundaryRight)
-      {
-        itr->Position.X = boundaryRight;
-        itr->OldPosition.X = itr->Position.X + (velocity.X * bounce);
-      }
-      else if (itr->Position.X < boundaryLeft)
-      {
-        itr->Position.X = boundaryLeft;
-        itr->OldPosition.X = itr->Position.X + (velocity.X * bounce);
-      }
-      if (itr->Position.Y > boundaryBottom)
-      {
-        itr->Position.Y = boundaryBottom;
-        itr->OldPosition.Y = itr->Position.Y + (velocity.Y * bounce);
-      }
-      else if (itr->Position.Y < boundaryTop)
-      {
-        itr->Position.Y = boundaryTop;
-        itr->OldPosition.Y = itr->Position.Y + (velocity.Y * bounce);
-      }
-    }
-  }
-
-
-  void VerletIntegration101::DrawSticks(const std::deque<Particle>& particles, const std::deque<Stick>& sticks)
+  void VerletIntegration101::DrawSticks(const VerletSolver2D& solver)
   {
     const auto color = Colors::White();
-    for (auto itr = sticks.begin(); itr != sticks.end(); ++itr)
+    const auto positionX = solver.GetPositionX();
+    const auto positionY = solver.GetPositionY();
+    const auto stickIndex0 = solver.GetStickIndex0();
+    const auto stickIndex1 = solver.GetStickIndex1();
+    for (std::size_t i = 0; i < stickIndex0.size(); ++i)
     {
-      auto from = particles[itr->PointIndex0].Position;
-      auto to = particles[itr->PointIndex1].Position;
+      const Vector2 from(positionX[stickIndex0[i]], positionY[stickIndex0[i]]);
+      const Vector2 to(positionX[stickIndex1[i]], positionY[stickIndex1[i]]);
       m_batch->DebugDrawLine(m_texFill, TypeConverter::To<PxVector2>(from), TypeConverter::To<PxVector2>(to), color);
     }
   }
 
 
-  void VerletIntegration101::DrawParticles(const std::deque<Particle>& particles)
+  void VerletIntegration101::DrawParticles(const VerletSolver2D& solver)
   {
-    const Vector2 scale(0.2f, 0.2f);
+    const Vector2 scale(LocalConfig::BallScale, LocalConfig::BallScale);
     const Vector2 origin(static_cast<float>(m_texBall.GetSize().RawWidth()) * 0.5f, static_cast<float>(m_texBall.GetSize().RawHeight()) * 0.5f);
     const auto color = Colors::White();
 
-    for (auto itr = particles.begin(); itr != particles.end(); ++itr)
+    const auto positionX = solver.GetPositionX();
+    const auto positionY = solver.GetPositionY();
+    for (std::size_t i = 0; i < positionX.size(); ++i)
     {
-      m_batch->Draw(m_texBall, itr->Position, color, origin, scale);
+      m_batch->Draw(m_texBall, Vector2(positionX[i], positionY[i]), color, origin, scale);
     }
   }
 }
@@ -31,14 +31,15 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
 #include <FslDemoApp/OpenGLES3/DemoAppGLES3.hpp>
 #include <FslDemoService/NativeGraphics/OpenGLES3/NativeBatch2D.hpp>
 #include <FslGraphics/Render/AtlasTexture2D.hpp>
 #include <FslGraphics/Sprite/ImageSprite.hpp>
+#include <FslGraphics2D/Physics/VerletSolver2D.hpp>
 #include <FslSimpleUI/App/UIDemoAppExtension.hpp>
 #include <FslUtil/OpenGLES3/GLProgram.hpp>
 #include <FslUtil/OpenGLES3/GLTexture.hpp>
-#include <deque>
 
 namespace Fsl
 {
@@ -59,39 +60,9 @@ namespace Fsl
     AtlasTexture2D m_texBall;
     AtlasTexture2D m_texTest;
 
-    struct Particle
-    {
-      Vector2 Position;
-      Vector2 OldPosition;
-
-      Particle() = default;
-
-      Particle(const float x, const float y, const float oldX, const float oldY)
-        : Position(x, y)
-        , OldPosition(oldX, oldY)
-      {
-      }
-    };
-
-    struct Stick
-    {
-      int32_t PointIndex0{0};
-      int32_t PointIndex1{0};
-      float Length{0};
-
-      Stick() = default;
-
-      Stick(const int32_t pointIndex0, const int32_t pointIndex1, const float length)
-        : PointIndex0(pointIndex0)
-        , PointIndex1(pointIndex1)
-        , Length(length)
-      {
-      }
-    };
-
     PxRectangle m_boundaryRect;
-    std::deque<Particle> m_particles;
-    std::deque<Stick> m_sticks;
+    WorkerThreadPool m_workerPool;
+    VerletSolver2D m_solver;
     float m_rotation;
 
 
@@ -105,11 +76,8 @@ namespace Fsl
     void Draw(const FrameInfo& frameInfo) final;
 
   private:
-    void UpdateParticles(std::deque<Particle>& particles, const float friction);
-    void UpdateSticks(std::deque<Particle>& particles, std::deque<Stick>& sticks);
-    void ConstrainPoints(std::deque<Particle>& particles, const PxRectangle& boundaryRect, const float friction);
-    void DrawSticks(const std::deque<Particle>& particles, const std::deque<Stick>& sticks);
-    void DrawParticles(const std::deque<Particle>& particles);
+    void DrawSticks(const VerletSolver2D& solver);
+    void DrawParticles(const VerletSolver2D& solver);
   };
 }
 
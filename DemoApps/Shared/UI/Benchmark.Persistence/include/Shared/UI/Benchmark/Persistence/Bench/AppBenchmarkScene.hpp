@@ -36,6 +36,7 @@ namespace Fsl
   enum class AppBenchmarkScene
   {
     Scene0 = 0,
+    VirtualList = 1,
     Dev = 0xFF,
   };
 }
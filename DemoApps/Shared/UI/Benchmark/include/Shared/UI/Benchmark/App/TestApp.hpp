@@ -116,6 +116,7 @@ namespace Fsl
 
     MainUI CreateUI(UI::Theme::IThemeControlFactory& uiFactory, const AppBenchmarkScene benchmarkScene);
     MainUI CreateUIScene0(UI::Theme::IThemeControlFactory& uiFactory);
+    MainUI CreateUIVirtualList(UI::Theme::IThemeControlFactory& uiFactory);
     MainUI CreateUIDev(UI::Theme::IThemeControlFactory& uiFactory);
 
     BasicUI CreateUIScene0Top(UI::Theme::IThemeControlFactory& uiFactory);
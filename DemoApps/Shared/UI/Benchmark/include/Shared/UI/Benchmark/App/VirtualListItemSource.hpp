@@ -0,0 +1,64 @@
+#ifndef SHARED_UI_BENCHMARK_APP_VIRTUALLISTITEMSOURCE_HPP
+#define SHARED_UI_BENCHMARK_APP_VIRTUALLISTITEMSOURCE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Base/Control/IVirtualizingItemSource.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Fsl::UI
+{
+  class Label;
+
+  namespace Theme
+  {
+    class IThemeControlFactory;
+  }
+
+  //! @brief Supplies label rows to a VirtualizingList, every tenth row starts a new section with a larger top margin
+  //!        so the list has rows of varying height.
+  class VirtualListItemSource final : public IVirtualizingItemSource
+  {
+    std::shared_ptr<Theme::IThemeControlFactory> m_themeControlFactory;
+    std::vector<std::shared_ptr<Label>> m_containers;
+    std::string m_scratchpad;
+
+  public:
+    explicit VirtualListItemSource(std::shared_ptr<Theme::IThemeControlFactory> themeControlFactory);
+
+    std::shared_ptr<BaseWindow> CreateItemContainer(const uint32_t containerIndex) final;
+    void PrepareItemContainer(const uint32_t containerIndex, const uint32_t itemIndex) final;
+  };
+}
+
+#endif
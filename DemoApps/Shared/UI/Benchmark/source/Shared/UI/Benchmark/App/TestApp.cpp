@@ -42,6 +42,7 @@
 #include <FslSimpleUI/Base/Control/RadioButton.hpp>
 #include <FslSimpleUI/Base/Control/ScrollViewer.hpp>
 #include <FslSimpleUI/Base/Control/Switch.hpp>
+#include <FslSimpleUI/Base/Control/VirtualizingList.hpp>
 #include <FslSimpleUI/Base/Event/WindowSelectEvent.hpp>
 #include <FslSimpleUI/Base/IWindowManager.hpp>
 #include <FslSimpleUI/Base/Layout/ComplexStackLayout.hpp>
@@ -57,10 +58,19 @@
 #include <Shared/UI/Benchmark/Activity/ActivityStack.hpp>
 #include <Shared/UI/Benchmark/App/SimpleDialogActivityFactory.hpp>
 #include <Shared/UI/Benchmark/App/TestApp.hpp>
+#include <Shared/UI/Benchmark/App/VirtualListItemSource.hpp>
 
 
 namespace Fsl
 {
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t VirtualListItemCount = 50000;
+    }
+  }
+
   TestApp::TestApp(const UIDemoAppExtensionCreateInfo& createInfo, const AppBenchmarkScene benchmarkScene)
     : m_uiEventListener(this)
     , m_uiExtension(std::make_shared<CustomUIDemoAppExtension>(createInfo, m_uiEventListener.GetListener(), "UIAtlasBig/UIAtlas_160dpi"))
@@ -262,6 +272,8 @@ namespace Fsl
     {
     case AppBenchmarkScene::Scene0:
       return CreateUIScene0(uiFactory);
+    case AppBenchmarkScene::VirtualList:
+      return CreateUIVirtualList(uiFactory);
     case AppBenchmarkScene::Dev:
       return CreateUIDev(uiFactory);
     }
@@ -386,6 +398,39 @@ namespace Fsl
   }
 
 
+  TestApp::MainUI TestApp::CreateUIVirtualList(UI::Theme::IThemeControlFactory& uiFactory)
+  {
+    auto context = m_uiExtension->GetContext();
+
+    auto top = CreateUIScene0Top(uiFactory);
+    auto bottom = CreateUIScene0Bottom(uiFactory);
+
+    // A long list where only the visible rows exist as windows
+    auto list = std::make_shared<UI::VirtualizingList>(context);
+    list->SetItemSource(std::make_shared<UI::VirtualListItemSource>(m_controlFactory));
+    list->SetItemCount(LocalConfig::VirtualListItemCount);
+    auto listWindow = uiFactory.CreateBackgroundWindow(UI::Theme::WindowType::Normal, list, UI::ItemAlignment::Stretch);
+
+    auto mainLayout = std::make_shared<UI::GridLayout>(context);
+    mainLayout->AddColumnDefinition(UI::GridColumnDefinition(UI::GridUnitType::Star, 1.0f));
+    mainLayout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
+    mainLayout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Star, 1.0f));
+    mainLayout->AddRowDefinition(UI::GridRowDefinition(UI::GridUnitType::Auto));
+    mainLayout->AddChild(top.Content, 0, 0);
+    mainLayout->AddChild(listWindow, 0, 1);
+    mainLayout->AddChild(bottom.Content, 0, 2);
+    mainLayout->SetLimitToAvailableSpace(true);
+
+    auto fillLayout = std::make_shared<UI::FillLayout>(context);
+    fillLayout->AddChild(mainLayout);
+
+    auto activityStack = std::make_shared<UI::ActivityStack>(context);
+    fillLayout->AddChild(activityStack);
+
+    return {fillLayout, mainLayout, activityStack, bottom};
+  }
+
+
   TestApp::MainUI TestApp::CreateUIDev(UI::Theme::IThemeControlFactory& uiFactory)
   {
     auto context = m_uiExtension->GetContext();
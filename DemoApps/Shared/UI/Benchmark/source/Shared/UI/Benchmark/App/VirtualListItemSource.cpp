@@ -0,0 +1,93 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Attributes.hpp>
+#include <FslBase/Math/Dp/DpThicknessF.hpp>
+#include <FslSimpleUI/Base/Control/Label.hpp>
+#include <FslSimpleUI/Theme/Base/IThemeControlFactory.hpp>
+#include <Shared/UI/Benchmark/App/VirtualListItemSource.hpp>
+#include <fmt/format.h>
+#include <cassert>
+#include <iterator>
+#include <utility>
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t SectionSize = 10;
+      constexpr DpThicknessF SectionMarginDp = DpThicknessF::Create(8.0f, 16.0f, 8.0f, 2.0f);
+      constexpr DpThicknessF RowMarginDp = DpThicknessF::Create(8.0f, 2.0f, 8.0f, 2.0f);
+    }
+  }
+
+
+  VirtualListItemSource::VirtualListItemSource(std::shared_ptr<Theme::IThemeControlFactory> themeControlFactory)
+    : m_themeControlFactory(std::move(themeControlFactory))
+  {
+    if (!m_themeControlFactory)
+    {
+      throw std::invalid_argument("themeControlFactory can not be null");
+    }
+  }
+
+
+  std::shared_ptr<BaseWindow> VirtualListItemSource::CreateItemContainer(const uint32_t containerIndex)
+  {
+    assert(containerIndex == m_containers.size());
+    FSL_PARAM_NOT_USED(containerIndex);
+    auto label = m_themeControlFactory->CreateLabel("");
+    m_containers.push_back(label);
+    return label;
+  }
+
+
+  void VirtualListItemSource::PrepareItemContainer(const uint32_t containerIndex, const uint32_t itemIndex)
+  {
+    Label& rLabel = *m_containers[containerIndex];
+
+    // Reuse the scratchpad so recycling a row does not allocate
+    m_scratchpad.clear();
+    if ((itemIndex % LocalConfig::SectionSize) == 0)
+    {
+      fmt::format_to(std::back_inserter(m_scratchpad), "Section {}", itemIndex / LocalConfig::SectionSize);
+      rLabel.SetMargin(LocalConfig::SectionMarginDp);
+    }
+    else
+    {
+      fmt::format_to(std::back_inserter(m_scratchpad), "Row {}", itemIndex);
+      rLabel.SetMargin(LocalConfig::RowMarginDp);
+    }
+    rLabel.SetContent(m_scratchpad);
+  }
+}
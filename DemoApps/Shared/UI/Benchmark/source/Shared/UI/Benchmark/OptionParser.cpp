@@ -63,7 +63,7 @@ namespace Fsl
     rOptions.emplace_back("ShowSystemIdle", OptionArgument::OptionNone, CommandId::ShowSystemIdle, "Indicate if the system UI is idle or not");
     rOptions.emplace_back("Scene", OptionArgument::OptionRequired, CommandId::Scene, "Select the scene to start: bench, play, record, result");
     rOptions.emplace_back("BenchmarkScene", OptionArgument::OptionRequired, CommandId::BenchmarkScene,
-                          "Select the benchmark scene to use: 0 (default), dev");
+                          "Select the benchmark scene to use: 0 (default), list, dev");
     rOptions.emplace_back("RunDefaultBench", OptionArgument::OptionNone, CommandId::RunDefaultBench,
                           "Run the default bench, this forces the use of the default input recording and forces the scene to bench");
     rOptions.emplace_back("Compare", OptionArgument::OptionRequired, CommandId::Compare, "Always compare a benchmark to the supplied result file");
@@ -110,6 +110,11 @@ namespace Fsl
         m_benchmarkScene = AppBenchmarkScene::Scene0;
         return OptionParseResult::Parsed;
       }
+      else if (strOptArg == "list")
+      {
+        m_benchmarkScene = AppBenchmarkScene::VirtualList;
+        return OptionParseResult::Parsed;
+      }
       else if (strOptArg == "dev")
       {
         m_benchmarkScene = AppBenchmarkScene::Dev;
@@ -0,0 +1,159 @@
+#ifndef FSLASSIMP_CACHEDSCENEIMPORTER_HPP
+#define FSLASSIMP_CACHEDSCENEIMPORTER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslAssimp/SceneImporter.hpp>
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <FslGraphics3D/BasicScene/SceneAllocator.hpp>
+#include <FslGraphics3D/BasicScene/SceneAllocatorFunc.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshOptimizeFlags.hpp>
+#include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  struct CachedSceneImporterStats
+  {
+    //! The number of loads that were served from the cache
+    uint32_t CacheHits{0};
+    //! The number of loads that had to be imported using assimp
+    uint32_t CacheMisses{0};
+    //! The number of loads where a existing cache entry was found but was outdated
+    uint32_t CacheInvalidations{0};
+  };
+
+  //! @brief A SceneImporter that stores the converted scene in a on-disk cache using the BasicSceneFormat.
+  //!        A cache entry is keyed by the source file content hash, the import flags, the load parameters and the vertex declaration of the
+  //!        requested scene type. If any of those change the entry is considered outdated and the scene is re-imported and re-cached.
+  //!        If mesh optimization is enabled the meshes are optimized once on import and the optimized result is what gets cached.
+  //! @note  The cache can only store meshes with 8 or 16 bit indices (BasicSceneFormat restriction), scenes that use other index types are
+  //!        imported as normal but never cached.
+  class CachedSceneImporter
+  {
+    SceneImporter m_importer;
+    SceneFormat::BasicSceneFormat m_sceneFormat;
+    IO::Path m_cacheDirectory;
+    Graphics3D::MeshOptimizeFlags m_meshOptimizeFlags;
+    CachedSceneImporterStats m_stats;
+
+  public:
+    CachedSceneImporter(const CachedSceneImporter&) = delete;
+    CachedSceneImporter& operator=(const CachedSceneImporter&) = delete;
+
+    //! @brief Create a importer that stores its cache files in the given directory (the directory will be created on demand)
+    //! @param meshOptimizeFlags the mesh optimization passes that should be applied to all imported triangle list meshes
+    explicit CachedSceneImporter(IO::Path cacheDirectory,
+                                 const Graphics3D::MeshOptimizeFlags meshOptimizeFlags = Graphics3D::MeshOptimizeFlags::NoFlags);
+    ~CachedSceneImporter();
+
+    const IO::Path& GetCacheDirectory() const
+    {
+      return m_cacheDirectory;
+    }
+
+    Graphics3D::MeshOptimizeFlags GetMeshOptimizeFlags() const
+    {
+      return m_meshOptimizeFlags;
+    }
+
+    const CachedSceneImporterStats& GetStats() const
+    {
+      return m_stats;
+    }
+
+    //! @brief Get the path of the cache file used for the given source file and settings
+    IO::Path GetCacheFilename(const IO::Path& filename, const unsigned int pFlags, const VertexDeclarationSpan& vertexDeclaration) const;
+
+    //! @brief Get the path of the cache file used for the given source file and settings when loading with a desired size
+    IO::Path GetCacheFilename(const IO::Path& filename, const float desiredSize, const bool centerModel, const unsigned int pFlags,
+                              const VertexDeclarationSpan& vertexDeclaration) const;
+
+    //! @brief Load the given file using the supplied pFlags
+    //! @param sceneAllocator the scene allocator to use.
+    //! @param vertexDeclaration the vertex declaration of the mesh type produced by the scene allocator.
+    //! @param pDstDefaultValues default vertex used to fill in elements that are missing from the cached data
+    //! @param cbDstDefaultValues the size of the default vertex in bytes
+    //! @param filename the file to load.
+    //! @param pFlags will be passed directly to Assimp::Importer ReadFile
+    std::shared_ptr<Graphics3D::Scene> GenericLoad(const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                   const VertexDeclarationSpan& vertexDeclaration, const void* const pDstDefaultValues,
+                                                   const int32_t cbDstDefaultValues, const IO::Path& filename, const unsigned int pFlags);
+
+    //! @brief Load the given file using the supplied pFlags
+    //! @param sceneAllocator the scene allocator to use.
+    //! @param vertexDeclaration the vertex declaration of the mesh type produced by the scene allocator.
+    //! @param pDstDefaultValues default vertex used to fill in elements that are missing from the cached data
+    //! @param cbDstDefaultValues the size of the default vertex in bytes
+    //! @param filename the file to load.
+    //! @param desiredSize The scene bounding box will be calculated and then scaled to the desired size.
+    //! @param pFlags will be passed directly to Assimp::Importer ReadFile
+    std::shared_ptr<Graphics3D::Scene> GenericLoad(const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                   const VertexDeclarationSpan& vertexDeclaration, const void* const pDstDefaultValues,
+                                                   const int32_t cbDstDefaultValues, const IO::Path& filename, const float desiredSize,
+                                                   const bool centerModel, const unsigned int pFlags);
+
+    template <typename TScene>
+    std::shared_ptr<TScene> Load(const IO::Path& filename, unsigned int pFlags = aiProcessPreset_TargetRealtime_Quality)
+    {
+      using vertex_type = typename TScene::mesh_type::vertex_type;
+      Graphics3D::SceneAllocatorFunc sceneAllocator(Graphics3D::SceneAllocator::Allocate<TScene>);
+      vertex_type defaultVertex{};
+      auto res = std::dynamic_pointer_cast<TScene>(
+        GenericLoad(sceneAllocator, vertex_type::AsVertexDeclarationSpan(), &defaultVertex, sizeof(vertex_type), filename, pFlags));
+      if (!res)
+      {
+        throw std::runtime_error("Failed to allocate scene of the desired type");
+      }
+      return res;
+    }
+
+    template <typename TScene>
+    std::shared_ptr<TScene> Load(const IO::Path& filename, const float desiredSize, const bool centerModel,
+                                 unsigned int pFlags = aiProcessPreset_TargetRealtime_Fast)
+    {
+      using vertex_type = typename TScene::mesh_type::vertex_type;
+      Graphics3D::SceneAllocatorFunc sceneAllocator(Graphics3D::SceneAllocator::Allocate<TScene>);
+      vertex_type defaultVertex{};
+      auto res = std::dynamic_pointer_cast<TScene>(GenericLoad(sceneAllocator, vertex_type::AsVertexDeclarationSpan(), &defaultVertex,
+                                                               sizeof(vertex_type), filename, desiredSize, centerModel, pFlags));
+      if (!res)
+      {
+        throw std::runtime_error("Failed to allocate scene of the desired type");
+      }
+      return res;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,394 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslAssimp/CachedSceneImporter.hpp>
+#include <FslBase/Bits/ByteSpanUtil_ReadLE.hpp>
+#include <FslBase/Bits/ByteSpanUtil_WriteLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Directory.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/System/Platform/PlatformPathTransform.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshOptimizer.hpp>
+#include <fmt/format.h>
+#include <array>
+#include <bit>
+#include <fstream>
+#include <utility>
+
+namespace Fsl
+{
+  using namespace Graphics3D;
+
+  namespace
+  {
+    namespace LocalConfig
+    {
+      // FSCC (Fsl scene cooked cache)
+      constexpr uint32_t Magic = 0x43435346;
+      constexpr uint32_t Version = 1;
+      constexpr std::size_t HashBufferSize = 64 * 1024;
+      constexpr const char* const FileExtension = ".fsfc";
+    }
+
+    namespace HeaderOffset
+    {
+      constexpr std::size_t Magic = 0;
+      constexpr std::size_t Version = Magic + sizeof(uint32_t);
+      constexpr std::size_t SourceHash = Version + sizeof(uint32_t);
+      constexpr std::size_t SourceByteSize = SourceHash + sizeof(uint64_t);
+      constexpr std::size_t VertexDeclarationHash = SourceByteSize + sizeof(uint64_t);
+      constexpr std::size_t ImportFlags = VertexDeclarationHash + sizeof(uint64_t);
+      constexpr std::size_t LoadFlags = ImportFlags + sizeof(uint32_t);
+      constexpr std::size_t DesiredSize = LoadFlags + sizeof(uint32_t);
+      constexpr std::size_t ScaleFactor = DesiredSize + sizeof(float);
+      constexpr std::size_t SizeOfHeader = ScaleFactor + sizeof(float);
+    }
+
+    namespace LoadFlags
+    {
+      constexpr uint32_t None = 0;
+      constexpr uint32_t Rescale = 0x01;
+      constexpr uint32_t CenterModel = 0x02;
+      //! The MeshOptimizeFlags are stored in the bits above this
+      constexpr uint32_t MeshOptimizeShift = 8;
+    }
+
+    using HeaderBuffer = std::array<uint8_t, HeaderOffset::SizeOfHeader>;
+
+    // The part of the header that must match for a cache entry to be valid
+    struct CacheKey
+    {
+      uint64_t SourceHash{0};
+      uint64_t SourceByteSize{0};
+      uint64_t VertexDeclarationHash{0};
+      uint32_t ImportFlags{0};
+      uint32_t LoadFlags{0};
+      float DesiredSize{0.0f};
+
+      bool operator==(const CacheKey& rhs) const noexcept
+      {
+        return SourceHash == rhs.SourceHash && SourceByteSize == rhs.SourceByteSize && VertexDeclarationHash == rhs.VertexDeclarationHash &&
+               ImportFlags == rhs.ImportFlags && LoadFlags == rhs.LoadFlags && DesiredSize == rhs.DesiredSize;
+      }
+    };
+
+    struct CacheHeader
+    {
+      CacheKey Key;
+      float ScaleFactor{1.0f};
+    };
+
+    // FNV-1a 64 bit
+    constexpr uint64_t HashOffsetBasis = 0xcbf29ce484222325;
+    constexpr uint64_t HashPrime = 0x100000001b3;
+
+    constexpr uint64_t HashBytes(uint64_t hash, const uint8_t* const pSrc, const std::size_t count) noexcept
+    {
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        hash ^= pSrc[i];
+        hash *= HashPrime;
+      }
+      return hash;
+    }
+
+    constexpr uint64_t HashValue(uint64_t hash, const uint32_t value) noexcept
+    {
+      for (uint32_t i = 0; i < 4; ++i)
+      {
+        hash ^= ((value >> (i * 8)) & 0xFF);
+        hash *= HashPrime;
+      }
+      return hash;
+    }
+
+    uint64_t HashVertexDeclaration(const VertexDeclarationSpan& vertexDeclaration) noexcept
+    {
+      uint64_t hash = HashValue(HashOffsetBasis, vertexDeclaration.VertexStride());
+      hash = HashValue(hash, vertexDeclaration.Count());
+      for (const VertexElement& element : vertexDeclaration.AsReadOnlySpan())
+      {
+        hash = HashValue(hash, element.Offset);
+        hash = HashValue(hash, static_cast<uint32_t>(element.Format));
+        hash = HashValue(hash, static_cast<uint32_t>(element.Usage));
+        hash = HashValue(hash, element.UsageIndex);
+      }
+      return hash;
+    }
+
+    //! Hash the file content in chunks so we never need to hold the entire source file in memory
+    std::pair<uint64_t, uint64_t> HashFileContent(const IO::Path& filename)
+    {
+      std::ifstream stream(PlatformPathTransform::ToSystemPath(filename), std::ios::in | std::ios::binary);
+      if (!stream.good())
+      {
+        throw IOException(fmt::format("Failed to open file: {}", filename));
+      }
+
+      std::vector<uint8_t> buffer(LocalConfig::HashBufferSize);
+      uint64_t hash = HashOffsetBasis;
+      uint64_t byteSize = 0;
+      while (stream.good())
+      {
+        stream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+        const auto bytesRead = static_cast<std::size_t>(stream.gcount());
+        hash = HashBytes(hash, buffer.data(), bytesRead);
+        byteSize += bytesRead;
+      }
+      if (!stream.eof())
+      {
+        throw IOException(fmt::format("Failed to read file: {}", filename));
+      }
+      return {hash, byteSize};
+    }
+
+    uint32_t CalcLoadFlags(const float desiredSize, const bool centerModel, const MeshOptimizeFlags meshOptimizeFlags) noexcept
+    {
+      // The public overload without a desired size is forwarded with a zero size, which we treat as 'no rescale'
+      return (desiredSize != 0.0f ? LoadFlags::Rescale : LoadFlags::None) | (centerModel ? LoadFlags::CenterModel : LoadFlags::None) |
+             (static_cast<uint32_t>(meshOptimizeFlags) << LoadFlags::MeshOptimizeShift);
+    }
+
+    //! Ensure that 'no rescale' always produces the same key (-0.0f and 0.0f have different bit patterns)
+    constexpr float ToKeyDesiredSize(const float desiredSize) noexcept
+    {
+      return desiredSize != 0.0f ? desiredSize : 0.0f;
+    }
+
+    //! Every setting that affects the cached content is part of the name, so loads with different settings never overwrite each others entry
+    IO::Path CreateCacheFilename(const IO::Path& cacheDirectory, const IO::Path& filename, const unsigned int pFlags, const uint32_t loadFlags,
+                                 const float desiredSize, const VertexDeclarationSpan& vertexDeclaration)
+    {
+      const IO::Path fullPath = IO::Path::GetFullPath(filename);
+      const std::string& strFullPath = fullPath.ToUTF8String();
+      uint64_t nameHash = HashBytes(HashOffsetBasis, reinterpret_cast<const uint8_t*>(strFullPath.data()), strFullPath.size());
+      nameHash = HashValue(nameHash, pFlags);
+      nameHash = HashValue(nameHash, loadFlags);
+      nameHash = HashValue(nameHash, std::bit_cast<uint32_t>(desiredSize));
+      nameHash ^= HashVertexDeclaration(vertexDeclaration);
+
+      const IO::Path name(fmt::format("{}_{:016x}{}", IO::Path::GetFileNameWithoutExtension(filename), nameHash, LocalConfig::FileExtension));
+      return IO::Path::Combine(cacheDirectory, name);
+    }
+
+    CacheKey CreateKey(const IO::Path& filename, const VertexDeclarationSpan& vertexDeclaration, const unsigned int pFlags,
+                       const uint32_t loadFlags, const float desiredSize)
+    {
+      const auto content = HashFileContent(filename);
+      CacheKey key;
+      key.SourceHash = content.first;
+      key.SourceByteSize = content.second;
+      key.VertexDeclarationHash = HashVertexDeclaration(vertexDeclaration);
+      key.ImportFlags = pFlags;
+      key.LoadFlags = loadFlags;
+      key.DesiredSize = desiredSize;
+      return key;
+    }
+
+    HeaderBuffer EncodeHeader(const uint32_t magic, const CacheHeader& header)
+    {
+      HeaderBuffer buffer{};
+      Span<uint8_t> span = SpanUtil::AsSpan(buffer);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::Magic), magic);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::Version), LocalConfig::Version);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::SourceHash), header.Key.SourceHash);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::SourceByteSize), header.Key.SourceByteSize);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::VertexDeclarationHash), header.Key.VertexDeclarationHash);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::ImportFlags), header.Key.ImportFlags);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::LoadFlags), header.Key.LoadFlags);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::DesiredSize), header.Key.DesiredSize);
+      ByteSpanUtil::WriteLE(span.subspan(HeaderOffset::ScaleFactor), header.ScaleFactor);
+      return buffer;
+    }
+
+    bool TryReadHeader(std::ifstream& rStream, CacheHeader& rHeader)
+    {
+      HeaderBuffer buffer{};
+      rStream.read(reinterpret_cast<char*>(buffer.data()), static_cast<std::streamsize>(buffer.size()));
+      if (!rStream.good())
+      {
+        return false;
+      }
+      const ReadOnlySpan<uint8_t> span = SpanUtil::AsReadOnlySpan(buffer);
+      if (ByteSpanUtil::ReadUInt32LE(span, HeaderOffset::Magic) != LocalConfig::Magic ||
+          ByteSpanUtil::ReadUInt32LE(span, HeaderOffset::Version) != LocalConfig::Version)
+      {
+        return false;
+      }
+      rHeader.Key.SourceHash = ByteSpanUtil::ReadUInt64LE(span, HeaderOffset::SourceHash);
+      rHeader.Key.SourceByteSize = ByteSpanUtil::ReadUInt64LE(span, HeaderOffset::SourceByteSize);
+      rHeader.Key.VertexDeclarationHash = ByteSpanUtil::ReadUInt64LE(span, HeaderOffset::VertexDeclarationHash);
+      rHeader.Key.ImportFlags = ByteSpanUtil::ReadUInt32LE(span, HeaderOffset::ImportFlags);
+      rHeader.Key.LoadFlags = ByteSpanUtil::ReadUInt32LE(span, HeaderOffset::LoadFlags);
+      rHeader.Key.DesiredSize = ByteSpanUtil::ReadFloatLE(span, HeaderOffset::DesiredSize);
+      rHeader.ScaleFactor = ByteSpanUtil::ReadFloatLE(span, HeaderOffset::ScaleFactor);
+      return true;
+    }
+
+    bool IsCacheable(const Scene& scene)
+    {
+      const int32_t meshCount = scene.GetMeshCount();
+      for (int32_t i = 0; i < meshCount; ++i)
+      {
+        const auto mesh = scene.GetMeshAt(i);
+        const uint32_t indexStride = mesh->GenericDirectAccess().IndexStride;
+        if (indexStride != 1 && indexStride != 2)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+
+  CachedSceneImporter::CachedSceneImporter(IO::Path cacheDirectory, const MeshOptimizeFlags meshOptimizeFlags)
+    : m_cacheDirectory(std::move(cacheDirectory))
+    , m_meshOptimizeFlags(meshOptimizeFlags)
+  {
+  }
+
+
+  CachedSceneImporter::~CachedSceneImporter() = default;
+
+
+  IO::Path CachedSceneImporter::GetCacheFilename(const IO::Path& filename, const unsigned int pFlags,
+                                                 const VertexDeclarationSpan& vertexDeclaration) const
+  {
+    return GetCacheFilename(filename, 0.0f, false, pFlags, vertexDeclaration);
+  }
+
+
+  IO::Path CachedSceneImporter::GetCacheFilename(const IO::Path& filename, const float desiredSize, const bool centerModel,
+                                                 const unsigned int pFlags, const VertexDeclarationSpan& vertexDeclaration) const
+  {
+    return CreateCacheFilename(m_cacheDirectory, filename, pFlags, CalcLoadFlags(desiredSize, centerModel, m_meshOptimizeFlags),
+                               ToKeyDesiredSize(desiredSize), vertexDeclaration);
+  }
+
+
+  std::shared_ptr<Graphics3D::Scene> CachedSceneImporter::GenericLoad(const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                                      const VertexDeclarationSpan& vertexDeclaration,
+                                                                      const void* const pDstDefaultValues, const int32_t cbDstDefaultValues,
+                                                                      const IO::Path& filename, const unsigned int pFlags)
+  {
+    return GenericLoad(sceneAllocator, vertexDeclaration, pDstDefaultValues, cbDstDefaultValues, filename, 0.0f, false, pFlags);
+  }
+
+
+  std::shared_ptr<Graphics3D::Scene> CachedSceneImporter::GenericLoad(const Graphics3D::SceneAllocatorFunc& sceneAllocator,
+                                                                      const VertexDeclarationSpan& vertexDeclaration,
+                                                                      const void* const pDstDefaultValues, const int32_t cbDstDefaultValues,
+                                                                      const IO::Path& filename, const float desiredSize, const bool centerModel,
+                                                                      const unsigned int pFlags)
+  {
+    if (!IO::File::Exists(filename))
+    {
+      throw std::invalid_argument(std::string("Could not locate file: ") + filename.ToAsciiString());
+    }
+
+    const bool rescale = desiredSize != 0.0f;
+    const uint32_t loadFlags = CalcLoadFlags(desiredSize, centerModel, m_meshOptimizeFlags);
+    const float keyDesiredSize = ToKeyDesiredSize(desiredSize);
+
+    const CacheKey key = CreateKey(filename, vertexDeclaration, pFlags, loadFlags, keyDesiredSize);
+    const IO::Path cacheFilename = CreateCacheFilename(m_cacheDirectory, filename, pFlags, loadFlags, keyDesiredSize, vertexDeclaration);
+
+    if (IO::File::Exists(cacheFilename))
+    {
+      try
+      {
+        std::ifstream stream(PlatformPathTransform::ToSystemPath(cacheFilename), std::ios::in | std::ios::binary);
+        CacheHeader header;
+        if (TryReadHeader(stream, header) && header.Key == key)
+        {
+          auto scene = m_sceneFormat.GenericLoad(stream, sceneAllocator, pDstDefaultValues, cbDstDefaultValues);
+          scene->SetScaleFactor(header.ScaleFactor);
+          ++m_stats.CacheHits;
+          return scene;
+        }
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_WARNING("CachedSceneImporter: Failed to load cache file '{}' ({}), reimporting", cacheFilename, ex.what());
+      }
+      ++m_stats.CacheInvalidations;
+    }
+    ++m_stats.CacheMisses;
+
+    std::shared_ptr<Scene> scene = rescale ? m_importer.Load(sceneAllocator, filename, desiredSize, centerModel, pFlags)
+                                           : m_importer.Load(sceneAllocator, filename, pFlags);
+    if (m_meshOptimizeFlags != MeshOptimizeFlags::NoFlags)
+    {
+      MeshOptimizer::Optimize(*scene, m_meshOptimizeFlags);
+    }
+    if (!IsCacheable(*scene))
+    {
+      FSLLOG3_VERBOSE("CachedSceneImporter: The scene '{}' uses a index type that can not be cached", filename);
+      return scene;
+    }
+
+    try
+    {
+      if (!IO::Directory::Exists(m_cacheDirectory))
+      {
+        IO::Directory::CreateDir(m_cacheDirectory);
+      }
+
+      CacheHeader header;
+      header.Key = key;
+      header.ScaleFactor = scene->GetScaleFactor();
+
+      // The header is first written with a invalid magic and then patched once the scene has been fully written,
+      // this ensures that a partially written cache file is never considered valid.
+      std::ofstream stream(PlatformPathTransform::ToSystemPath(cacheFilename), std::ios::out | std::ios::binary | std::ios::trunc);
+      const HeaderBuffer incompleteHeader = EncodeHeader(0, header);
+      stream.write(reinterpret_cast<const char*>(incompleteHeader.data()), static_cast<std::streamsize>(incompleteHeader.size()));
+      m_sceneFormat.Save(stream, *scene);
+
+      const HeaderBuffer completeHeader = EncodeHeader(LocalConfig::Magic, header);
+      stream.seekp(0);
+      stream.write(reinterpret_cast<const char*>(completeHeader.data()), static_cast<std::streamsize>(completeHeader.size()));
+      if (!stream.good())
+      {
+        throw IOException("Failed to write cache file");
+      }
+    }
+    catch (const std::exception& ex)
+    {
+      FSLLOG3_WARNING("CachedSceneImporter: Failed to write cache file '{}' ({})", cacheFilename, ex.what());
+    }
+    return scene;
+  }
+}
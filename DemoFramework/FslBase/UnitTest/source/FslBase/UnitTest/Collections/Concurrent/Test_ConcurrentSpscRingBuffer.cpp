@@ -0,0 +1,169 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentSpscRingBuffer.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_Concurrent_ConcurrentSpscRingBuffer = TestFixtureFslBase;
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, Construct)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(4);
+
+  EXPECT_EQ(4u, ring.Capacity());
+  EXPECT_TRUE(ring.IsEmpty());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, Construct_CapacityIsRoundedUp)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(5);
+
+  EXPECT_EQ(8u, ring.Capacity());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, Construct_InvalidCapacity)
+{
+  EXPECT_THROW(ConcurrentSpscRingBuffer<uint32_t>(0), std::invalid_argument);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, TryDequeue_Empty)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(4);
+
+  uint32_t value = 1u;
+  EXPECT_FALSE(ring.TryDequeue(value));
+  EXPECT_EQ(0u, value);
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, TryEnqueue_Full)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(2);
+
+  EXPECT_TRUE(ring.TryEnqueue(1));
+  EXPECT_TRUE(ring.TryEnqueue(2));
+  EXPECT_FALSE(ring.TryEnqueue(3));
+
+  uint32_t value = 0u;
+  EXPECT_TRUE(ring.TryDequeue(value));
+  EXPECT_EQ(1u, value);
+  EXPECT_TRUE(ring.TryEnqueue(3));
+  EXPECT_TRUE(ring.TryDequeue(value));
+  EXPECT_EQ(2u, value);
+  EXPECT_TRUE(ring.TryDequeue(value));
+  EXPECT_EQ(3u, value);
+  EXPECT_FALSE(ring.TryDequeue(value));
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, TryDequeueAll_Wrapped)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(4);
+  uint32_t value = 0u;
+  // Move the read position so the content wraps around the end of the buffer
+  EXPECT_TRUE(ring.TryEnqueue(1));
+  EXPECT_TRUE(ring.TryEnqueue(2));
+  EXPECT_TRUE(ring.TryEnqueue(3));
+  EXPECT_TRUE(ring.TryDequeue(value));
+  EXPECT_TRUE(ring.TryDequeue(value));
+  EXPECT_TRUE(ring.TryEnqueue(4));
+  EXPECT_TRUE(ring.TryEnqueue(5));
+  EXPECT_TRUE(ring.TryEnqueue(6));
+
+  std::vector<uint32_t> result = {42};
+  EXPECT_EQ(4u, ring.TryDequeueAll(result));
+  EXPECT_EQ((std::vector<uint32_t>{42, 3, 4, 5, 6}), result);
+  EXPECT_TRUE(ring.IsEmpty());
+  EXPECT_EQ(0u, ring.TryDequeueAll(result));
+  EXPECT_EQ(5u, result.size());
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, Clear)
+{
+  ConcurrentSpscRingBuffer<uint32_t> ring(4);
+  EXPECT_TRUE(ring.TryEnqueue(1));
+  EXPECT_TRUE(ring.TryEnqueue(2));
+
+  ring.Clear();
+
+  EXPECT_TRUE(ring.IsEmpty());
+  uint32_t value = 1u;
+  EXPECT_FALSE(ring.TryDequeue(value));
+}
+
+
+TEST(TestCollections_Concurrent_ConcurrentSpscRingBuffer, ProducerConsumerThreads)
+{
+  constexpr uint32_t Count = 100000;
+  ConcurrentSpscRingBuffer<uint32_t> ring(64);
+
+  std::thread producer(
+    [&ring]()
+    {
+      for (uint32_t i = 0; i < Count; ++i)
+      {
+        while (!ring.TryEnqueue(i))
+        {
+          std::this_thread::yield();
+        }
+      }
+    });
+
+  std::vector<uint32_t> result;
+  result.reserve(Count);
+  while (result.size() < Count)
+  {
+    if (ring.TryDequeueAll(result) == 0u)
+    {
+      std::this_thread::yield();
+    }
+  }
+  producer.join();
+
+  ASSERT_EQ(Count, result.size());
+  for (uint32_t i = 0; i < Count; ++i)
+  {
+    ASSERT_EQ(i, result[i]);
+  }
+}
@@ -0,0 +1,313 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/SpatialHashGrid2D.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestCollections_SpatialHashGrid2D = TestFixtureFslBase;
+
+  std::vector<uint32_t> QueryAABBSorted(const SpatialHashGrid2D& grid, const Rect& area)
+  {
+    std::vector<uint32_t> result;
+    grid.QueryAABB(area, [&result](const uint32_t handle) { result.push_back(handle); });
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
+  std::ptrdiff_t CountInCell(const SpatialHashGrid2D& grid, const uint32_t cellX, const uint32_t cellY, const uint32_t handle)
+  {
+    const auto entries = grid.GetCellEntries(cellX, cellY);
+    return std::count(entries.begin(), entries.end(), handle);
+  }
+
+  std::vector<uint32_t> BruteForceAABB(const std::vector<Rect>& bounds, const std::vector<bool>& alive, const Rect& area)
+  {
+    std::vector<uint32_t> result;
+    for (std::size_t i = 0; i < bounds.size(); ++i)
+    {
+      const Rect& rect = bounds[i];
+      if (alive[i] && rect.Left() <= area.Right() && area.Left() <= rect.Right() && rect.Top() <= area.Bottom() && area.Top() <= rect.Bottom())
+      {
+        result.push_back(static_cast<uint32_t>(i));
+      }
+    }
+    return result;
+  }
+
+  std::vector<Rect> CreateRandomRects(const std::size_t count, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    // The position range deliberately exceeds the grid area so the clamping is exercised
+    std::uniform_real_distribution<float> position(-50.0f, 1050.0f);
+    std::uniform_real_distribution<float> size(0.0f, 80.0f);
+    std::vector<Rect> result(count);
+    for (auto& rEntry : result)
+    {
+      rEntry = Rect(position(random), position(random), size(random), size(random));
+    }
+    return result;
+  }
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Construct)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 1000, 500), 64.0f);
+  EXPECT_EQ(0u, grid.Count());
+  EXPECT_EQ(16u, grid.GetCellCountX());
+  EXPECT_EQ(8u, grid.GetCellCountY());
+  EXPECT_EQ(64.0f, grid.GetCellSize());
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Construct_Invalid)
+{
+  EXPECT_THROW(SpatialHashGrid2D(Rect(0, 0, 1000, 500), 0.0f), std::invalid_argument);
+  EXPECT_THROW(SpatialHashGrid2D(Rect(0, 0, 1000, 500), -1.0f), std::invalid_argument);
+  EXPECT_THROW(SpatialHashGrid2D(Rect(0, 0, 1000000, 500), 1.0f), std::invalid_argument);
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Add_Query)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  const uint32_t h0 = grid.Add(Rect(5, 5, 2, 2));
+  const uint32_t h1 = grid.Add(Rect(15, 5, 30, 30));
+  const uint32_t h2 = grid.Add(Rect(90, 90, 5, 5));
+  EXPECT_EQ(3u, grid.Count());
+  EXPECT_TRUE(grid.IsValidHandle(h0));
+  EXPECT_EQ(Rect(15, 5, 30, 30), grid.GetBounds(h1));
+
+  // The large entry spans many cells but must only be reported once
+  EXPECT_EQ(std::vector<uint32_t>({h0, h1}), QueryAABBSorted(grid, Rect(0, 0, 50, 50)));
+  EXPECT_EQ(std::vector<uint32_t>({h1}), QueryAABBSorted(grid, Rect(20, 20, 5, 5)));
+  EXPECT_EQ(std::vector<uint32_t>({h2}), QueryAABBSorted(grid, Rect(80, 80, 20, 20)));
+  EXPECT_TRUE(QueryAABBSorted(grid, Rect(60, 60, 5, 5)).empty());
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Query_Span)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  grid.Add(Rect(5, 5, 2, 2));
+  grid.Add(Rect(6, 6, 2, 2));
+  grid.Add(Rect(7, 7, 2, 2));
+
+  std::array<uint32_t, 8> dst{};
+  EXPECT_EQ(3u, grid.QueryAABB(Rect(0, 0, 10, 10), SpanUtil::AsSpan(dst)));
+  // Entries that do not fit are skipped
+  EXPECT_EQ(2u, grid.QueryAABB(Rect(0, 0, 10, 10), SpanUtil::AsSpan(dst, 0, 2)));
+  EXPECT_EQ(3u, grid.QueryRadius(Vector2(6, 6), 2.0f, SpanUtil::AsSpan(dst)));
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, QueryRadius)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  const uint32_t hPoint = grid.Add(Rect(50, 50, 0, 0));
+  // The corner of the box is sqrt(2*8*8) ~ 11.3 away from the center, so it is inside the square but outside the circle
+  const uint32_t hCorner = grid.Add(Rect(58, 58, 5, 5));
+  const uint32_t hSide = grid.Add(Rect(59, 45, 5, 10));
+
+  std::vector<uint32_t> result;
+  grid.QueryRadius(Vector2(50, 50), 10.0f, [&result](const uint32_t handle) { result.push_back(handle); });
+  std::sort(result.begin(), result.end());
+  EXPECT_EQ(std::vector<uint32_t>({hPoint, hSide}), result);
+
+  result.clear();
+  grid.QueryRadius(Vector2(50, 50), 12.0f, [&result](const uint32_t handle) { result.push_back(handle); });
+  std::sort(result.begin(), result.end());
+  EXPECT_EQ(std::vector<uint32_t>({hPoint, hCorner, hSide}), result);
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Remove)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  const uint32_t h0 = grid.Add(Rect(5, 5, 40, 40));
+  const uint32_t h1 = grid.Add(Rect(10, 10, 5, 5));
+  grid.Remove(h0);
+  EXPECT_EQ(1u, grid.Count());
+  EXPECT_FALSE(grid.IsValidHandle(h0));
+  EXPECT_EQ(std::vector<uint32_t>({h1}), QueryAABBSorted(grid, Rect(0, 0, 100, 100)));
+  for (uint32_t y = 0; y < grid.GetCellCountY(); ++y)
+  {
+    for (uint32_t x = 0; x < grid.GetCellCountX(); ++x)
+    {
+      for (const uint32_t handle : grid.GetCellEntries(x, y))
+      {
+        EXPECT_EQ(h1, handle);
+      }
+    }
+  }
+
+  // The handle gets reused
+  EXPECT_EQ(h0, grid.Add(Rect(1, 1, 1, 1)));
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Remove_Invalid)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  EXPECT_THROW(grid.Remove(0), std::invalid_argument);
+  const uint32_t handle = grid.Add(Rect(5, 5, 1, 1));
+  grid.Remove(handle);
+  EXPECT_THROW(grid.Remove(handle), std::invalid_argument);
+  EXPECT_THROW(grid.Move(handle, Rect()), std::invalid_argument);
+  EXPECT_THROW(grid.GetBounds(handle), std::invalid_argument);
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Move)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  const uint32_t handle = grid.Add(Rect(5, 5, 20, 20));
+  grid.Move(handle, Rect(15, 15, 20, 20));
+  EXPECT_EQ(Rect(15, 15, 20, 20), grid.GetBounds(handle));
+  EXPECT_TRUE(QueryAABBSorted(grid, Rect(0, 0, 9, 9)).empty());
+  EXPECT_EQ(std::vector<uint32_t>({handle}), QueryAABBSorted(grid, Rect(30, 30, 1, 1)));
+
+  // Every overlapped cell must contain the handle exactly once
+  for (uint32_t y = 0; y < grid.GetCellCountY(); ++y)
+  {
+    for (uint32_t x = 0; x < grid.GetCellCountX(); ++x)
+    {
+      const auto entries = grid.GetCellEntries(x, y);
+      const bool expected = x >= 1 && x <= 3 && y >= 1 && y <= 3;
+      EXPECT_EQ(expected ? 1 : 0, std::count(entries.begin(), entries.end(), handle));
+    }
+  }
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, Clear)
+{
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+  grid.Add(Rect(5, 5, 20, 20));
+  grid.Clear();
+  EXPECT_EQ(0u, grid.Count());
+  EXPECT_TRUE(QueryAABBSorted(grid, Rect(0, 0, 100, 100)).empty());
+  EXPECT_EQ(0u, grid.Add(Rect(5, 5, 20, 20)));
+}
+
+
+TEST(TestCollections_SpatialHashGrid2D, NonFinite)
+{
+  constexpr float Inf = std::numeric_limits<float>::infinity();
+  constexpr float NaN = std::numeric_limits<float>::quiet_NaN();
+  SpatialHashGrid2D grid(Rect(0, 0, 100, 100), 10.0f);
+
+  // A NaN coordinate ends up in the first cell, infinite coordinates are clamped to the border cells
+  const uint32_t hNaN = grid.Add(Rect(NaN, 5, 2, 2));
+  const uint32_t hInf = grid.Add(Rect(5, 5, Inf, 2));
+  const uint32_t hNegInf = grid.Add(Rect(-Inf, 50, 2, 2));
+  EXPECT_EQ(1, CountInCell(grid, 0, 0, hNaN));
+  for (uint32_t x = 0; x < grid.GetCellCountX(); ++x)
+  {
+    EXPECT_EQ(1, CountInCell(grid, x, 0, hInf));
+  }
+  EXPECT_EQ(1, CountInCell(grid, 0, 5, hNegInf));
+
+  // A NaN box never overlaps anything
+  EXPECT_EQ(std::vector<uint32_t>({hInf}), QueryAABBSorted(grid, Rect(0, 0, 10, 10)));
+  EXPECT_EQ(std::vector<uint32_t>({hInf}), QueryAABBSorted(grid, Rect(90, 0, 10, 10)));
+  EXPECT_TRUE(QueryAABBSorted(grid, Rect(NaN, 0, 10, 10)).empty());
+
+  grid.Move(hNaN, Rect(50, 50, 2, 2));
+  EXPECT_EQ(std::vector<uint32_t>({hNaN}), QueryAABBSorted(grid, Rect(49, 49, 1, 1)));
+  grid.Move(hNaN, Rect(NaN, NaN, 2, 2));
+  EXPECT_TRUE(QueryAABBSorted(grid, Rect(49, 49, 1, 1)).empty());
+
+  const std::array<Rect, 2> bounds = {Rect(NaN, NaN, 1, 1), Rect(Inf, Inf, 1, 1)};
+  std::array<uint32_t, 2> handles{};
+  grid.AddRange(SpanUtil::AsReadOnlySpan(bounds), SpanUtil::AsSpan(handles));
+  EXPECT_EQ(1, CountInCell(grid, 9, 9, handles[1]));
+
+  grid.Remove(hNaN);
+  grid.Remove(hInf);
+  grid.Remove(hNegInf);
+  grid.Remove(handles[0]);
+  grid.Remove(handles[1]);
+  EXPECT_EQ(0u, grid.Count());
+  for (uint32_t y = 0; y < grid.GetCellCountY(); ++y)
+  {
+    for (uint32_t x = 0; x < grid.GetCellCountX(); ++x)
+    {
+      EXPECT_TRUE(grid.GetCellEntries(x, y).empty());
+    }
+  }
+}
+
+TEST(TestCollections_SpatialHashGrid2D, AddRange_MatchesBruteForce)
+{
+  auto bounds = CreateRandomRects(500, 1337);
+  std::vector<bool> alive(bounds.size(), true);
+
+  SpatialHashGrid2D grid(Rect(0, 0, 1000, 1000), 32.0f);
+  std::vector<uint32_t> handles(bounds.size());
+  grid.AddRange(SpanUtil::AsReadOnlySpan(bounds), SpanUtil::AsSpan(handles));
+  for (std::size_t i = 0; i < handles.size(); ++i)
+  {
+    EXPECT_EQ(i, handles[i]);
+  }
+  EXPECT_THROW(grid.AddRange(SpanUtil::AsReadOnlySpan(bounds), SpanUtil::AsSpan(handles, 0, 1)), std::invalid_argument);
+
+  // Move and remove a subset of the entries
+  const auto moved = CreateRandomRects(bounds.size(), 42);
+  for (std::size_t i = 0; i < bounds.size(); i += 3)
+  {
+    grid.Move(handles[i], moved[i]);
+    bounds[i] = moved[i];
+  }
+  for (std::size_t i = 1; i < bounds.size(); i += 7)
+  {
+    grid.Remove(handles[i]);
+    alive[i] = false;
+  }
+
+  const auto queries = CreateRandomRects(64, 7);
+  for (const Rect& query : queries)
+  {
+    EXPECT_EQ(BruteForceAABB(bounds, alive, query), QueryAABBSorted(grid, query));
+  }
+}
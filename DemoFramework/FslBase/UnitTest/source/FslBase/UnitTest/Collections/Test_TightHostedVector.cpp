@@ -179,6 +179,12 @@ TEST(TestCollections_TightHostedVector, Clear_0_H2H3)
 
   ASSERT_EQ(0u, buffer.Size(HostedVectorIndex::First));
   ASSERT_EQ(3u, buffer.Size(HostedVectorIndex::Second));
+
+  // The content of the following hosted vector must be unaffected
+  for (std::size_t i = 0; i < test1.size(); ++i)
+  {
+    EXPECT_EQ(test1[i], buffer.UncheckedAt(HostedVectorIndex::Second, i));
+  }
 }
 
 TEST(TestCollections_TightHostedVector, Clear_1_H2H3)
@@ -0,0 +1,188 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <atomic>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSystem_Threading_WorkerThreadPool = TestFixtureFslBase;
+
+  void CheckCoverage(WorkerThreadPool& rPool, const std::size_t count, const std::size_t minChunkSize)
+  {
+    std::vector<uint32_t> visited(count);
+    std::atomic<uint32_t> calls{0};
+    rPool.ParallelFor(count, minChunkSize,
+                      [&visited, &calls](const std::size_t begin, const std::size_t end)
+                      {
+                        ++calls;
+                        for (std::size_t i = begin; i < end; ++i)
+                        {
+                          ++visited[i];
+                        }
+                      });
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      ASSERT_EQ(1u, visited[i]);
+    }
+    EXPECT_LE(calls.load(), rPool.GetConcurrency());
+  }
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, Construct_NoWorkers)
+{
+  WorkerThreadPool pool(0);
+
+  EXPECT_EQ(0u, pool.GetWorkerThreadCount());
+  EXPECT_EQ(1u, pool.GetConcurrency());
+  CheckCoverage(pool, 1000, 1);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, Construct_Default)
+{
+  WorkerThreadPool pool;
+
+  EXPECT_EQ(pool.GetWorkerThreadCount() + 1u, pool.GetConcurrency());
+  CheckCoverage(pool, 1000, 1);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_Empty)
+{
+  WorkerThreadPool pool(3);
+
+  bool called = false;
+  pool.ParallelFor(0, 1, [&called](const std::size_t /*begin*/, const std::size_t /*end*/) { called = true; });
+  EXPECT_FALSE(called);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_BelowMinChunkSize)
+{
+  WorkerThreadPool pool(3);
+
+  uint32_t calls = 0;
+  pool.ParallelFor(100, 1000,
+                   [&calls](const std::size_t begin, const std::size_t end)
+                   {
+                     ++calls;
+                     EXPECT_EQ(0u, begin);
+                     EXPECT_EQ(100u, end);
+                   });
+  EXPECT_EQ(1u, calls);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_Coverage)
+{
+  WorkerThreadPool pool(3);
+
+  CheckCoverage(pool, 1, 1);
+  CheckCoverage(pool, 3, 1);
+  CheckCoverage(pool, 4, 1);
+  CheckCoverage(pool, 5, 1);
+  CheckCoverage(pool, 1001, 10);
+  CheckCoverage(pool, 100000, 1024);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_Repeated)
+{
+  WorkerThreadPool pool(3);
+
+  std::vector<uint64_t> values(4096);
+  for (uint32_t i = 0; i < 500; ++i)
+  {
+    pool.ParallelFor(values.size(), 16,
+                     [&values](const std::size_t begin, const std::size_t end)
+                     {
+                       for (std::size_t j = begin; j < end; ++j)
+                       {
+                         ++values[j];
+                       }
+                     });
+  }
+  for (const uint64_t value : values)
+  {
+    ASSERT_EQ(500u, value);
+  }
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_Exception)
+{
+  WorkerThreadPool pool(3);
+
+  EXPECT_THROW(pool.ParallelFor(1000, 1,
+                                [](const std::size_t begin, const std::size_t /*end*/)
+                                {
+                                  if (begin > 0u)
+                                  {
+                                    throw std::runtime_error("failed");
+                                  }
+                                }),
+               std::runtime_error);
+
+  // The pool is still usable after a exception
+  CheckCoverage(pool, 1000, 1);
+}
+
+
+TEST(TestSystem_Threading_WorkerThreadPool, ParallelFor_RepeatedWithYield)
+{
+  // More workers than chunks and a yield between the calls gives parked workers the chance to wake up after the caller returned
+  WorkerThreadPool pool(7);
+
+  std::atomic<uint64_t> total{0};
+  for (uint32_t i = 0; i < 20000; ++i)
+  {
+    pool.ParallelFor(8, 1,
+                     [&total](const std::size_t begin, const std::size_t end)
+                     {
+                       for (std::size_t j = begin; j < end; ++j)
+                       {
+                         total.fetch_add(j + 1u, std::memory_order_relaxed);
+                       }
+                     });
+    std::this_thread::yield();
+  }
+  EXPECT_EQ(20000u * 36u, total.load());
+}
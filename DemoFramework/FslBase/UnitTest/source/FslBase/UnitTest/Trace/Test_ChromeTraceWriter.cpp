@@ -0,0 +1,100 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/Trace/ChromeTraceWriter.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestTrace_ChromeTraceWriter = TestFixtureFslBase;
+}
+
+
+TEST(TestTrace_ChromeTraceWriter, ToJson_Empty)
+{
+  const std::vector<TraceEvent> events;
+  const std::vector<TraceThreadInfo> threads;
+  const std::string res = ChromeTraceWriter::ToJson(SpanUtil::AsReadOnlySpan(events), SpanUtil::AsReadOnlySpan(threads), 1000000);
+
+  EXPECT_EQ(std::string("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n]}\n"), res);
+}
+
+
+TEST(TestTrace_ChromeTraceWriter, ToJson_ZeroFrequency)
+{
+  const std::vector<TraceEvent> events;
+  const std::vector<TraceThreadInfo> threads;
+  EXPECT_THROW(ChromeTraceWriter::ToJson(SpanUtil::AsReadOnlySpan(events), SpanUtil::AsReadOnlySpan(threads), 0), std::invalid_argument);
+}
+
+
+TEST(TestTrace_ChromeTraceWriter, ToJson)
+{
+  std::vector<TraceEvent> events;
+  events.emplace_back(TraceEventType::Complete, "Cat", "Zone", 2000, 1500, 0, 1);
+  events.emplace_back(TraceEventType::Instant, "Cat", "Instant", 1000, 0, 0, 1);
+  events.emplace_back(TraceEventType::AsyncBegin, "Cat", "Async", 3000, 0, 42, 1);
+  events.emplace_back(TraceEventType::AsyncEnd, "Cat", "Async", 4000, 0, 42, 2);
+  std::vector<TraceThreadInfo> threads;
+  threads.emplace_back(1, "Main");
+  threads.emplace_back(2, "");
+
+  // 1000 ticks per second -> 1 tick = 1000us
+  const std::string res = ChromeTraceWriter::ToJson(SpanUtil::AsReadOnlySpan(events), SpanUtil::AsReadOnlySpan(threads), 1000);
+
+  const std::string expected =
+    "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+    "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,\"args\":{\"name\":\"Main\"}},\n"
+    "{\"name\":\"Zone\",\"cat\":\"Cat\",\"ph\":\"X\",\"pid\":1,\"tid\":1,\"ts\":1000000.000,\"dur\":1500000.000},\n"
+    "{\"name\":\"Instant\",\"cat\":\"Cat\",\"ph\":\"i\",\"pid\":1,\"tid\":1,\"ts\":0.000,\"s\":\"t\"},\n"
+    "{\"name\":\"Async\",\"cat\":\"Cat\",\"ph\":\"b\",\"pid\":1,\"tid\":1,\"ts\":2000000.000,\"id\":\"0x2a\"},\n"
+    "{\"name\":\"Async\",\"cat\":\"Cat\",\"ph\":\"e\",\"pid\":1,\"tid\":2,\"ts\":3000000.000,\"id\":\"0x2a\"}\n"
+    "]}\n";
+  EXPECT_EQ(expected, res);
+}
+
+
+TEST(TestTrace_ChromeTraceWriter, ToJson_Escape)
+{
+  std::vector<TraceEvent> events;
+  events.emplace_back(TraceEventType::Instant, "C\\t", "\"Quote\"\n", 0, 0, 0, 1);
+  std::vector<TraceThreadInfo> threads;
+
+  const std::string res = ChromeTraceWriter::ToJson(SpanUtil::AsReadOnlySpan(events), SpanUtil::AsReadOnlySpan(threads), 1000);
+
+  EXPECT_NE(std::string::npos, res.find("\"name\":\"\\\"Quote\\\"\\n\",\"cat\":\"C\\\\t\""));
+}
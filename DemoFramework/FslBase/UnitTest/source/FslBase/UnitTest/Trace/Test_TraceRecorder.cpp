@@ -0,0 +1,214 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Trace/Trace.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <algorithm>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestTrace_TraceRecorder : public TestFixtureFslBase
+  {
+  protected:
+    void SetUp() override
+    {
+      TestFixtureFslBase::SetUp();
+      Reset();
+    }
+
+    void TearDown() override
+    {
+      Reset();
+      TestFixtureFslBase::TearDown();
+    }
+
+  private:
+    static void Reset()
+    {
+      TraceRecorder::SetEnabled(false);
+      std::vector<TraceEvent> events;
+      TraceRecorder::Collect(events);
+    }
+  };
+}
+
+
+TEST_F(TestTrace_TraceRecorder, Disabled)
+{
+  TraceRecorder::RecordInstant("Test", "Instant");
+  {
+    FSL_TRACE_ZONE("Test", "Zone");
+  }
+
+  std::vector<TraceEvent> events;
+  EXPECT_EQ(0u, TraceRecorder::Collect(events));
+  EXPECT_TRUE(events.empty());
+}
+
+
+TEST_F(TestTrace_TraceRecorder, Zone)
+{
+  TraceRecorder::SetEnabled(true);
+  {
+    FSL_TRACE_ZONE("Test", "Zone");
+  }
+
+  std::vector<TraceEvent> events;
+  EXPECT_EQ(0u, TraceRecorder::Collect(events));
+  ASSERT_EQ(1u, events.size());
+  EXPECT_EQ(TraceEventType::Complete, events[0].Type);
+  EXPECT_EQ(std::string("Test"), events[0].pszCategory);
+  EXPECT_EQ(std::string("Zone"), events[0].pszName);
+  EXPECT_NE(0u, events[0].ThreadId);
+
+  // A second collect returns nothing
+  events.clear();
+  TraceRecorder::Collect(events);
+  EXPECT_TRUE(events.empty());
+}
+
+
+TEST_F(TestTrace_TraceRecorder, Zone_EnabledAfterBegin)
+{
+  {
+    FSL_TRACE_ZONE("Test", "Zone");
+    TraceRecorder::SetEnabled(true);
+  }
+
+  std::vector<TraceEvent> events;
+  TraceRecorder::Collect(events);
+  EXPECT_TRUE(events.empty());
+}
+
+
+TEST_F(TestTrace_TraceRecorder, Async)
+{
+  TraceRecorder::SetEnabled(true);
+  const uint32_t id = TraceRecorder::NextAsyncId();
+  EXPECT_NE(0u, id);
+  EXPECT_NE(id, TraceRecorder::NextAsyncId());
+
+  TraceRecorder::RecordAsyncBegin("Test", "Async", id);
+  std::thread thread([id]() { TraceRecorder::RecordAsyncEnd("Test", "Async", id); });
+  thread.join();
+
+  std::vector<TraceEvent> events;
+  TraceRecorder::Collect(events);
+  ASSERT_EQ(2u, events.size());
+  const auto itrBegin = std::find_if(events.begin(), events.end(), [](const TraceEvent& e) { return e.Type == TraceEventType::AsyncBegin; });
+  const auto itrEnd = std::find_if(events.begin(), events.end(), [](const TraceEvent& e) { return e.Type == TraceEventType::AsyncEnd; });
+  ASSERT_NE(events.end(), itrBegin);
+  ASSERT_NE(events.end(), itrEnd);
+  EXPECT_EQ(id, itrBegin->Id);
+  EXPECT_EQ(id, itrEnd->Id);
+  EXPECT_NE(itrBegin->ThreadId, itrEnd->ThreadId);
+  EXPECT_LE(itrBegin->Timestamp, itrEnd->Timestamp);
+}
+
+
+TEST_F(TestTrace_TraceRecorder, MultipleThreads)
+{
+  constexpr uint32_t ThreadCount = 4;
+  constexpr uint32_t EventsPerThread = 1000;
+
+  TraceRecorder::SetEnabled(true);
+  std::vector<std::thread> threads;
+  for (uint32_t i = 0; i < ThreadCount; ++i)
+  {
+    threads.emplace_back(
+      []()
+      {
+        for (uint32_t j = 0; j < EventsPerThread; ++j)
+        {
+          FSL_TRACE_ZONE("Test", "Worker");
+        }
+      });
+  }
+
+  // Collect while the threads are running
+  std::vector<TraceEvent> events;
+  TraceRecorder::Collect(events);
+  for (auto& rThread : threads)
+  {
+    rThread.join();
+  }
+  TraceRecorder::Collect(events);
+
+  EXPECT_EQ(ThreadCount * EventsPerThread, events.size());
+}
+
+
+TEST_F(TestTrace_TraceRecorder, Overflow)
+{
+  constexpr uint32_t EventCount = 100000;
+
+  TraceRecorder::SetEnabled(true);
+  for (uint32_t i = 0; i < EventCount; ++i)
+  {
+    TraceRecorder::RecordInstant("Test", "Instant");
+  }
+
+  std::vector<TraceEvent> events;
+  const uint64_t dropped = TraceRecorder::Collect(events);
+  EXPECT_LT(events.size(), EventCount);
+  EXPECT_EQ(EventCount, events.size() + dropped);
+}
+
+
+TEST_F(TestTrace_TraceRecorder, SetCurrentThreadName)
+{
+  std::thread thread(
+    []()
+    {
+      TraceRecorder::SetCurrentThreadName("TestThread");
+      TraceRecorder::SetEnabled(true);
+      TraceRecorder::RecordInstant("Test", "Instant");
+    });
+  thread.join();
+
+  std::vector<TraceEvent> events;
+  TraceRecorder::Collect(events);
+  ASSERT_EQ(1u, events.size());
+  const uint32_t threadId = events[0].ThreadId;
+
+  // The thread info is still available after the thread exited
+  std::vector<TraceThreadInfo> threads;
+  TraceRecorder::GetThreads(threads);
+  const auto itrFind = std::find_if(threads.begin(), threads.end(), [threadId](const TraceThreadInfo& entry) { return entry.ThreadId == threadId; });
+  ASSERT_NE(threads.end(), itrFind);
+  EXPECT_EQ(std::string("TestThread"), itrFind->Name);
+}
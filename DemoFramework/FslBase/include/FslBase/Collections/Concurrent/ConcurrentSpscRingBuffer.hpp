@@ -0,0 +1,175 @@
+#ifndef FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTSPSCRINGBUFFER_HPP
+#define FSLBASE_COLLECTIONS_CONCURRENT_CONCURRENTSPSCRINGBUFFER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A bounded lock free single producer single consumer ring buffer.
+  //! @note  Exactly one thread may call the producer methods (TryEnqueue) and exactly one thread may call the consumer methods
+  //!        (TryDequeue, TryDequeueAll, Clear) at any given time. The producer and consumer may be the same thread.
+  template <typename T>
+  class ConcurrentSpscRingBuffer
+  {
+    // Keep the producer and consumer state on separate cache lines to prevent false sharing
+    static constexpr std::size_t CacheLineSize = 64;
+
+    std::vector<T> m_data;
+    std::size_t m_mask;
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_writeIndex{0};
+    //! Producer side cache of the read index
+    std::size_t m_cachedReadIndex{0};
+
+    alignas(CacheLineSize) std::atomic<std::size_t> m_readIndex{0};
+    //! Consumer side cache of the write index
+    std::size_t m_cachedWriteIndex{0};
+
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    ConcurrentSpscRingBuffer(const ConcurrentSpscRingBuffer&) = delete;
+    ConcurrentSpscRingBuffer& operator=(const ConcurrentSpscRingBuffer&) = delete;
+
+    //! @brief Create a ring that can hold at least 'capacity' elements (the capacity is rounded up to the next power of two)
+    explicit ConcurrentSpscRingBuffer(const size_type capacity)
+      : m_data(RoundUpToPowerOfTwo(capacity))
+      , m_mask(m_data.size() - 1u)
+    {
+    }
+
+    size_type Capacity() const noexcept
+    {
+      return m_data.size();
+    }
+
+    //! @brief Check if the ring is empty
+    //! @note  This is only a snapshot, when called from the consumer the ring is guaranteed to contain at least as many elements as reported.
+    bool IsEmpty() const noexcept
+    {
+      return m_readIndex.load(std::memory_order_acquire) == m_writeIndex.load(std::memory_order_acquire);
+    }
+
+    //! @brief Try to add a element to the end of the ring (producer only)
+    //! @return true if the element was added, false if the ring was full.
+    bool TryEnqueue(const T& value)
+    {
+      const std::size_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+      if ((writeIndex - m_cachedReadIndex) >= m_data.size())
+      {
+        m_cachedReadIndex = m_readIndex.load(std::memory_order_acquire);
+        if ((writeIndex - m_cachedReadIndex) >= m_data.size())
+        {
+          return false;
+        }
+      }
+      m_data[writeIndex & m_mask] = value;
+      m_writeIndex.store(writeIndex + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Try to remove the element at the front of the ring (consumer only)
+    //! @return true on success, false if the ring was empty. When false rValue will be set to T().
+    bool TryDequeue(T& rValue)
+    {
+      const std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+      if (readIndex == m_cachedWriteIndex)
+      {
+        m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+        if (readIndex == m_cachedWriteIndex)
+        {
+          rValue = T();
+          return false;
+        }
+      }
+      rValue = m_data[readIndex & m_mask];
+      m_readIndex.store(readIndex + 1u, std::memory_order_release);
+      return true;
+    }
+
+    //! @brief Remove all elements currently in the ring and append them to rDst (consumer only)
+    //! @return the number of elements that was appended.
+    size_type TryDequeueAll(std::vector<T>& rDst)
+    {
+      const std::size_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+      m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+      const std::size_t count = m_cachedWriteIndex - readIndex;
+      if (count > 0u)
+      {
+        // Copy the (at most) two contiguous segments
+        const std::size_t startIndex = readIndex & m_mask;
+        const std::size_t firstCount = std::min(count, m_data.size() - startIndex);
+        rDst.insert(rDst.end(), m_data.begin() + static_cast<std::ptrdiff_t>(startIndex),
+                    m_data.begin() + static_cast<std::ptrdiff_t>(startIndex + firstCount));
+        rDst.insert(rDst.end(), m_data.begin(), m_data.begin() + static_cast<std::ptrdiff_t>(count - firstCount));
+        m_readIndex.store(m_cachedWriteIndex, std::memory_order_release);
+      }
+      return count;
+    }
+
+    //! @brief Remove all elements currently in the ring (consumer only)
+    void Clear() noexcept
+    {
+      m_cachedWriteIndex = m_writeIndex.load(std::memory_order_acquire);
+      m_readIndex.store(m_cachedWriteIndex, std::memory_order_release);
+    }
+
+  private:
+    static std::size_t RoundUpToPowerOfTwo(const size_type capacity)
+    {
+      if (capacity <= 0u)
+      {
+        throw std::invalid_argument("capacity must be greater than zero");
+      }
+      if (capacity > ((std::numeric_limits<std::size_t>::max() / 2u) + 1u))
+      {
+        throw std::invalid_argument("capacity is too large");
+      }
+      std::size_t result = 1u;
+      while (result < capacity)
+      {
+        result <<= 1u;
+      }
+      return result;
+    }
+  };
+}
+
+#endif
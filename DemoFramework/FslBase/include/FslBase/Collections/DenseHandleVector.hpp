@@ -0,0 +1,842 @@
+#ifndef FSLBASE_COLLECTIONS_DENSEHANDLEVECTOR_HPP
+#define FSLBASE_COLLECTIONS_DENSEHANDLEVECTOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/DenseHandleVectorConfig.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/Span/TypedFlexSpan.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  namespace DenseHandleVectorInternal
+  {
+    //! The last index is reserved so that a handle can never be equal to DenseHandleVectorConfig::InvalidHandle (-1)
+    constexpr uint32_t MaxCapacity = 0x00FFFFFF;
+    constexpr uint32_t HandleIndexMask = 0x00FFFFFF;
+    constexpr uint32_t HandleVersionMask = 0xFF000000;
+    constexpr uint32_t HandleVersionShift = 24;
+  }
+
+  //! A vector that provides a unique versioned handle for the added entry.
+  //! Unlike the HandleVector and VersionedHandleVector the elements, the dense index to handle array and the sparse handle to index array are
+  //! stored in three separate arrays (structure of arrays). This means that iterating the elements only touches the element memory and that
+  //! the elements can be accessed as a contiguous span. The sparse array also stores the current handle of each slot so validating a handle
+  //! only touches the sparse array.
+  //! The lookup of the element via the handle is a o(1) operation. Its just direct lookup via the handle to get the actual index.
+  //! Removing elements by handle is also a o(1) operation.
+  template <typename T>
+  class DenseHandleVector
+  {
+    static_assert(!std::is_same_v<T, bool>, "std::vector<bool> is not contiguous, use a uint8_t instead");
+
+  public:
+    using value_type = T;
+    using size_type = uint32_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = const T&;
+    using const_pointer = const T*;
+    using pointer = T*;
+
+    using index_type = size_type;
+    using handle_type = int32_t;
+
+  private:
+    struct SparseRecord
+    {
+      //! The dense index of the element
+      index_type Index{};
+      //! The current handle of the slot, this allows us to validate a handle without touching the dense arrays
+      handle_type Handle{};
+
+      constexpr SparseRecord() = default;
+
+      constexpr SparseRecord(const index_type index, const handle_type handle)
+        : Index(index)
+        , Handle(handle)
+      {
+      }
+    };
+
+    //! Sparse array used to convert a handle index to a actual index
+    std::vector<SparseRecord> m_handleToIndex;
+    //! Dense array containing the handle associated with the element at the same index.
+    //! Entries at m_count and above contain the next free handles.
+    std::vector<handle_type> m_indexToHandle;
+    //! Dense array containing the actual elements
+    std::vector<T> m_elements;
+    size_type m_count{};
+
+  public:
+    static constexpr const auto ElementByteSize = sizeof(T);
+
+    DenseHandleVector(const DenseHandleVector&) = default;
+    DenseHandleVector& operator=(const DenseHandleVector&) = default;
+    DenseHandleVector(DenseHandleVector&&) noexcept = default;
+    DenseHandleVector& operator=(DenseHandleVector&&) noexcept = default;
+
+    DenseHandleVector() = default;
+
+    explicit DenseHandleVector(const size_type capacity)
+    {
+      if (capacity <= 0u)
+      {
+        throw std::invalid_argument("count must be greater than zero");
+      }
+      if (capacity > DenseHandleVectorInternal::MaxCapacity)
+      {
+        throw UsageErrorException("max capacity exceeded");
+      }
+      Resize(capacity);
+    }
+
+    //! @brief Get the elements as a TypedFlexSpan (compatible with the HandleVector)
+    TypedFlexSpan<T> AsSpan()
+    {
+      return TypedFlexSpan<T>(m_elements.data(), m_count, sizeof(T));
+    }
+
+    //! @brief Get the elements as a ReadOnlyTypedFlexSpan (compatible with the HandleVector)
+    ReadOnlyTypedFlexSpan<T> AsSpan() const
+    {
+      return ReadOnlyTypedFlexSpan<T>(m_elements.data(), m_count, sizeof(T));
+    }
+
+    //! @brief Get the elements as a contiguous span
+    Span<T> AsDenseSpan() noexcept
+    {
+      return Span<T>(m_elements.data(), m_count);
+    }
+
+    //! @brief Get the elements as a contiguous span
+    ReadOnlySpan<T> AsReadOnlySpan() const noexcept
+    {
+      return ReadOnlySpan<T>(m_elements.data(), m_count);
+    }
+
+    //! @brief Get the handles of the elements, the handle at index 'i' belongs to the element at index 'i'.
+    ReadOnlySpan<handle_type> AsHandleSpan() const noexcept
+    {
+      return ReadOnlySpan<handle_type>(m_indexToHandle.data(), m_count);
+    }
+
+    constexpr bool Empty() const noexcept
+    {
+      return m_count <= 0;
+    }
+
+    //! @brief Free all entries
+    //! @param zeroFreed if this is cleared vector elements are not cleared (only do this for simple types)
+    //!                  only the size is set to zero.
+    void Clear(const bool zeroFreed = true)
+    {
+      if (zeroFreed)
+      {
+        std::fill(m_elements.begin(), m_elements.begin() + m_count, T{});
+      }
+      for (index_type i = 0; i < m_count; ++i)
+      {
+        const handle_type freedHandle = IncreaseHandleVersion(m_indexToHandle[i]);
+        m_indexToHandle[i] = freedHandle;
+        m_handleToIndex[HandleIndex(freedHandle)].Handle = freedHandle;
+      }
+      m_count = 0;
+    }
+
+    //! Reserve room for the given number of elements by growing the capacity to the requested number.
+    //! If the current capacity exceeds the requested capacity this will do nothing.
+    void Reserve(const size_type capacity)
+    {
+      if (capacity < m_elements.size())
+      {
+        return;
+      }
+      constexpr size_type GrowBy = 200;
+      const auto finalCapacity = ((capacity / GrowBy) + ((capacity % GrowBy) > 0 ? 1 : 0)) * GrowBy;
+
+      if (finalCapacity > DenseHandleVectorInternal::MaxCapacity)
+      {
+        throw UsageErrorException("max capacity exceeded");
+      }
+      Resize(finalCapacity);
+    }
+
+
+    //! Convert a handle to a index
+    constexpr index_type UncheckedHandleToIndex(const handle_type handle) const noexcept
+    {
+      assert(IsValidHandle(handle));
+      return m_handleToIndex[HandleIndex(handle)].Index;
+    }
+
+    //! @brief Convert a index to the corresponding handle
+    constexpr handle_type UncheckedIndexToHandle(const index_type index) const noexcept
+    {
+      assert(IsValidIndex(index));
+      return m_indexToHandle[index];
+    }
+
+    //! @brief Same as UncheckedHandleToIndex (HandleVector naming)
+    constexpr index_type FastHandleToIndex(const handle_type handle) const noexcept
+    {
+      return UncheckedHandleToIndex(handle);
+    }
+
+    //! @brief Same as UncheckedIndexToHandle (HandleVector naming)
+    constexpr handle_type FastIndexToHandle(const index_type index) const noexcept
+    {
+      return UncheckedIndexToHandle(index);
+    }
+
+
+    handle_type Add(const_reference element)
+    {
+      return DoAdd(element);
+    }
+
+    handle_type Add(T&& element)
+    {
+      return DoAdd(std::move(element));
+    }
+
+    //! @brief Insert the item at the given index
+    //! @param handle The item handle to insert after
+    //! @param element The object to insert. The value can be null for reference types
+    handle_type Insert(const handle_type handle, const_reference element)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("Invalid handle");
+      }
+      return DoInsertAt(m_handleToIndex[HandleIndex(handle)].Index, element);
+    }
+
+    //! @brief Insert the item at the given index
+    //! @param handle The item handle to insert after
+    //! @param element The object to insert. The value can be null for reference types
+    handle_type Insert(const handle_type handle, T&& element)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("Invalid handle");
+      }
+      return DoInsertAt(m_handleToIndex[HandleIndex(handle)].Index, std::move(element));
+    }
+
+    //! @brief Insert the item at the given index
+    //! @param index The zero-based index at which item should be inserted.
+    //! @param element The object to insert. The value can be null for reference types
+    handle_type InsertAt(const index_type index, const_reference element)
+    {
+      if (index > Count())
+      {
+        throw IndexOutOfRangeException();
+      }
+      return DoInsertAt(index, element);
+    }
+
+    //! @brief Insert the item at the given index
+    //! @param index The zero-based index at which item should be inserted.
+    //! @param element The object to insert. The value can be null for reference types
+    handle_type InsertAt(const index_type index, T&& element)
+    {
+      if (index > Count())
+      {
+        throw IndexOutOfRangeException();
+      }
+      return DoInsertAt(index, std::move(element));
+    }
+
+
+    //! @brief Remove the item with the given handle from the list.
+    bool Remove(const handle_type handle) noexcept
+    {
+      if (IsValidHandle(handle))
+      {
+        assert(Count() > 0);
+        UncheckedRemoveAt(m_handleToIndex[HandleIndex(handle)].Index);
+        return true;
+      }
+      return false;
+    }
+
+    /// Remove the item at the given index
+    void RemoveAt(const index_type index)
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      UncheckedRemoveAt(index);
+    }
+
+    //! @brief Remove a range of elements from the vector
+    //! @param startIndex the startIndex
+    //! @param length the number of elements to remove.
+    /// @throws std::invalid_argument if startIndex and length doesnt specify a valid range
+    void RemoveRange(const index_type startIndex, const size_type length)
+    {
+      if (length > m_count)
+      {
+        throw std::invalid_argument("length larger than current count");
+      }
+      if (startIndex > (m_count - length))
+      {
+        throw std::invalid_argument("startIndex and length do not denote a valid range");
+      }
+      if (length > 0u)
+      {
+        DoRemoveRange(startIndex, length);
+      }
+    }
+
+    //! @brief Remove the item with the given handle from the list.
+    //!        This remove will swap the removed element with the last element.
+    void RemoveBySwap(const handle_type handle)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("Invalid handle");
+      }
+
+      assert(Count() > 0);
+      // We already know the handle so avoid reading it from the dense handle array
+      DoRemoveBySwapAt(m_handleToIndex[HandleIndex(handle)].Index, handle);
+    }
+
+    //! Remove the item at the given index from the list.
+    //! This  remove will swap the removed element with the last element.
+    void RemoveBySwapAt(const index_type index)
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      DoRemoveBySwapAt(index, m_indexToHandle[index]);
+    }
+
+    //! Get the entry
+    const_pointer TryGet(const handle_type handle) const noexcept
+    {
+      return IsValidHandle(handle) ? &m_elements[m_handleToIndex[HandleIndex(handle)].Index] : nullptr;
+    }
+
+    //! Get the entry
+    pointer TryGet(const handle_type handle) noexcept
+    {
+      return IsValidHandle(handle) ? &m_elements[m_handleToIndex[HandleIndex(handle)].Index] : nullptr;
+    }
+
+    //! Get the entry
+    const_reference Get(const handle_type handle) const
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      return m_elements[m_handleToIndex[HandleIndex(handle)].Index];
+    }
+
+    //! Get the entry
+    reference Get(const handle_type handle)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      return m_elements[m_handleToIndex[HandleIndex(handle)].Index];
+    }
+
+    //! Get the entry
+    const_reference UncheckedGet(const handle_type handle) const noexcept
+    {
+      assert(IsValidHandle(handle));
+      return m_elements[m_handleToIndex[HandleIndex(handle)].Index];
+    }
+
+    //! Get the entry
+    reference UncheckedGet(const handle_type handle) noexcept
+    {
+      assert(IsValidHandle(handle));
+      return m_elements[m_handleToIndex[HandleIndex(handle)].Index];
+    }
+
+    //! @brief Same as UncheckedGet (HandleVector naming)
+    const_reference FastGet(const handle_type handle) const noexcept
+    {
+      return UncheckedGet(handle);
+    }
+
+    //! @brief Same as UncheckedGet (HandleVector naming)
+    reference FastGet(const handle_type handle) noexcept
+    {
+      return UncheckedGet(handle);
+    }
+
+    //! Get the entry and the index of the entry
+    const_reference Get(const handle_type handle, index_type& rIndex) const
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+
+      const index_type index = m_handleToIndex[HandleIndex(handle)].Index;
+      rIndex = index;
+      return m_elements[index];
+    }
+
+    //! Get the entry and the index of the entry
+    reference Get(const handle_type handle, index_type& rIndex)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+
+      const index_type index = m_handleToIndex[HandleIndex(handle)].Index;
+      rIndex = index;
+      return m_elements[index];
+    }
+
+    //! Set the entry
+    void Set(const handle_type handle, const_reference element)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      m_elements[m_handleToIndex[HandleIndex(handle)].Index] = element;
+    }
+
+    //! Set the entry
+    void Set(const handle_type handle, T&& element)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      m_elements[m_handleToIndex[HandleIndex(handle)].Index] = std::move(element);
+    }
+
+    const_reference At(const index_type index) const
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      return m_elements[index];
+    }
+
+    reference At(const index_type index)
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      return m_elements[index];
+    }
+
+    //! @brief Set the element at the given index
+    void SetAt(const index_type index, const_reference value)
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      m_elements[index] = value;
+    }
+
+    //! @brief Set the element at the given index
+    void SetAt(const index_type index, T&& value)
+    {
+      if (!IsValidIndex(index))
+      {
+        throw IndexOutOfRangeException();
+      }
+      m_elements[index] = std::move(value);
+    }
+
+    void Swap(const handle_type handle0, const handle_type handle1)
+    {
+      if (!IsValidHandle(handle0) || !IsValidHandle(handle1))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+
+      SwapAt(UncheckedHandleToIndex(handle0), UncheckedHandleToIndex(handle1));
+    }
+
+    //! @brief Swap the records at the given indices
+    void SwapAt(const index_type index0, const index_type index1)
+    {
+      if (!IsValidIndex(index0))
+      {
+        throw IndexOutOfRangeException("index0");
+      }
+      if (!IsValidIndex(index1))
+      {
+        throw IndexOutOfRangeException("index1");
+      }
+
+      if (index0 == index1)
+      {
+        return;
+      }
+
+      const handle_type handle0 = m_indexToHandle[index0];
+      const handle_type handle1 = m_indexToHandle[index1];
+
+      // Patch the handle lookup by setting the new location
+      assert(m_handleToIndex[HandleIndex(handle0)].Index == index0);
+      assert(m_handleToIndex[HandleIndex(handle1)].Index == index1);
+      m_handleToIndex[HandleIndex(handle0)].Index = index1;
+      m_handleToIndex[HandleIndex(handle1)].Index = index0;
+
+      // Swap the stored element and the handle
+      m_indexToHandle[index0] = handle1;
+      m_indexToHandle[index1] = handle0;
+      std::swap(m_elements[index0], m_elements[index1]);
+    }
+
+
+    /// @brief Move the element at fromIndex to toIndex.
+    ///        This has the same effect as "Remove(fromIndex), Insert(ToIndex)" it will just be faster.
+    void MoveFromTo(const handle_type hFrom, const handle_type hTo)
+    {
+      if (!IsValidHandle(hFrom))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      if (!IsValidHandle(hTo))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+
+      MoveAtFromTo(UncheckedHandleToIndex(hFrom), UncheckedHandleToIndex(hTo));
+    }
+
+    //! @brief Move the element at fromIndex to toIndex.
+    //!        This has the same effect as "RemoveAt(fromIndex), InsertAt(ToIndex)" it will just be faster.
+    void MoveAtFromTo(const index_type fromIndex, const index_type toIndex)
+    {
+      if (!IsValidIndex(fromIndex))
+      {
+        throw IndexOutOfRangeException("fromIndex");
+      }
+      if (!IsValidIndex(toIndex))
+      {
+        throw IndexOutOfRangeException("toIndex");
+      }
+
+      if (fromIndex == toIndex)
+      {
+        return;
+      }
+
+      if (fromIndex < toIndex)
+      {
+        // Rotate the range one step to the left
+        std::rotate(m_elements.begin() + fromIndex, m_elements.begin() + fromIndex + 1, m_elements.begin() + toIndex + 1);
+        std::rotate(m_indexToHandle.begin() + fromIndex, m_indexToHandle.begin() + fromIndex + 1, m_indexToHandle.begin() + toIndex + 1);
+        PatchHandleToIndex(fromIndex, toIndex + 1);
+      }
+      else
+      {
+        // Rotate the range one step to the right
+        std::rotate(m_elements.begin() + toIndex, m_elements.begin() + fromIndex, m_elements.begin() + fromIndex + 1);
+        std::rotate(m_indexToHandle.begin() + toIndex, m_indexToHandle.begin() + fromIndex, m_indexToHandle.begin() + fromIndex + 1);
+        PatchHandleToIndex(toIndex, fromIndex + 1);
+      }
+    }
+
+    //! @brief Direct access to the elements
+    const_reference operator[](const index_type index) const noexcept
+    {
+      assert(IsValidIndex(index));
+      return m_elements[index];
+    }
+
+    /// Direct access to the elements
+    reference operator[](const index_type index) noexcept
+    {
+      assert(IsValidIndex(index));
+      return m_elements[index];
+    }
+
+    //! @brief the current element count
+    size_type Count() const noexcept
+    {
+      return m_count;
+    }
+
+    //! @brief The current capacity of the vector
+    size_type Capacity() const noexcept
+    {
+      return UncheckedNumericCast<size_type>(m_elements.size());
+    }
+
+    //! @brief Check if the given handle is valid.
+    //! @return True if the supplied handle is valid
+    constexpr bool IsValidHandle(const handle_type handle) const noexcept
+    {
+      const uint32_t handleIndex = HandleIndex(handle);
+      return (handleIndex < static_cast<uint32_t>(m_handleToIndex.size()) && m_handleToIndex[handleIndex].Handle == handle &&
+              m_handleToIndex[handleIndex].Index < m_count);
+    }
+
+    //! @brief Check if the given index is valid.
+    //! @return True if the supplied handle is valid
+    constexpr bool IsValidIndex(const index_type index) const noexcept
+    {
+      return index < m_count;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool DEBUG_IsValid() const
+    {
+      if (m_elements.size() > DenseHandleVectorInternal::MaxCapacity)
+      {
+        throw InternalErrorException("max capacity exceeded");
+      }
+      if (m_handleToIndex.size() != m_elements.size() || m_indexToHandle.size() != m_elements.size() || m_count > m_elements.size())
+      {
+        return false;
+      }
+
+      for (index_type i = 0; i < m_indexToHandle.size(); ++i)
+      {
+        const handle_type handle = m_indexToHandle[i];
+        const uint32_t handleIndex = HandleIndex(handle);
+        if (handleIndex >= m_handleToIndex.size() || m_handleToIndex[handleIndex].Index != i || m_handleToIndex[handleIndex].Handle != handle)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    void DEBUG_SanityCheck() const
+    {
+      if (!DEBUG_IsValid())
+      {
+        throw InternalErrorException("Handle and index lookups are inconsistent");
+      }
+      // DEBUG_IsValid ensures that index -> handle -> index is the identity, so the handle to index lookup must be a permutation
+      std::vector<bool> taken(m_handleToIndex.size());
+      for (const SparseRecord& record : m_handleToIndex)
+      {
+        if (record.Index >= taken.size() || taken[record.Index])
+        {
+          throw InternalErrorException("Handle and index was already claimed by another index");
+        }
+        taken[record.Index] = true;
+      }
+    }
+
+    //! @brief  Only call this if you are 100% sure the index is valid
+    void UncheckedRemoveAt(const index_type index) noexcept
+    {
+      assert(IsValidIndex(index));
+      DoRemoveRange(index, 1u);
+    }
+
+    //! @brief Same as UncheckedRemoveAt (HandleVector naming)
+    void FastRemoveAt(const index_type index) noexcept
+    {
+      UncheckedRemoveAt(index);
+    }
+
+    //! @brief Check that the current internal handle version is equal to the given handle if its version was increased.
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    bool DEBUG_CheckVersionBumped(const handle_type handle)
+    {
+      const uint32_t handleIndex = HandleIndex(handle);
+      return handleIndex < m_handleToIndex.size() && m_handleToIndex[handleIndex].Handle == IncreaseHandleVersion(handle);
+    }
+
+  private:
+    void Resize(const size_type capacity)
+    {
+      const auto oldCapacity = UncheckedNumericCast<size_type>(m_elements.size());
+      assert(capacity >= oldCapacity);
+      m_elements.resize(capacity);
+      m_handleToIndex.resize(capacity);
+      m_indexToHandle.resize(capacity);
+
+      // Update the lookup values
+      for (index_type i = oldCapacity; i < capacity; ++i)
+      {
+        m_indexToHandle[i] = CreateInitialKey(i);
+        m_handleToIndex[i] = SparseRecord(i, m_indexToHandle[i]);
+      }
+    }
+
+    template <typename TElement>
+    handle_type DoAdd(TElement&& element)
+    {
+      assert(Count() <= Capacity());
+
+      if (m_count >= m_elements.size())
+      {
+        // Ensure we have enough capacity
+        Reserve(UncheckedNumericCast<size_type>(m_elements.size() + DenseHandleVectorConfig::GrowBy));
+      }
+
+      // get a free handle, then add the item to the array
+      const handle_type newHandle = m_indexToHandle[m_count];
+      assert(m_handleToIndex[HandleIndex(newHandle)].Index == m_count);
+
+      m_elements[m_count] = std::forward<TElement>(element);
+      ++m_count;
+
+      assert(IsValidHandle(newHandle));
+      assert(newHandle != DenseHandleVectorConfig::InvalidHandle);
+      return newHandle;
+    }
+
+    template <typename TElement>
+    handle_type DoInsertAt(const index_type index, TElement&& element)
+    {
+      assert(Count() <= Capacity());
+      assert(index <= Count());
+
+      if (m_count >= m_elements.size())
+      {
+        // Ensure we have enough capacity
+        Reserve(UncheckedNumericCast<size_type>(m_elements.size() + DenseHandleVectorConfig::GrowBy));
+      }
+
+      // get a free handle (its the one stored at m_count) and rotate it into place while making room for the element
+      const handle_type newHandle = m_indexToHandle[m_count];
+      std::move_backward(m_elements.begin() + index, m_elements.begin() + m_count, m_elements.begin() + m_count + 1);
+      std::rotate(m_indexToHandle.begin() + index, m_indexToHandle.begin() + m_count, m_indexToHandle.begin() + m_count + 1);
+      ++m_count;
+
+      m_elements[index] = std::forward<TElement>(element);
+      // Patch the handle to index lookup table so we know the new index of element with a given handle
+      PatchHandleToIndex(index, m_count);
+
+      assert(m_indexToHandle[index] == newHandle);
+      assert(newHandle != DenseHandleVectorConfig::InvalidHandle);
+      return newHandle;
+    }
+
+    void DoRemoveBySwapAt(const index_type index, const handle_type removedHandle) noexcept
+    {
+      assert(IsValidIndex(index));
+      assert(m_indexToHandle[index] == removedHandle);
+      assert(m_count > 0u);
+      --m_count;
+
+      // Swap the removed element with the last element in the vector
+      const handle_type endHandle = m_indexToHandle[m_count];
+      const handle_type freedHandle = IncreaseHandleVersion(removedHandle);
+      m_indexToHandle[index] = endHandle;
+      m_indexToHandle[m_count] = freedHandle;
+      // Move the last element, and "zero" the removed element
+      if (index != m_count)
+      {
+        m_elements[index] = std::move(m_elements[m_count]);
+      }
+      m_elements[m_count] = {};
+      // Patch the handle to index lookup table so we know the new index of element with a given handle
+      m_handleToIndex[HandleIndex(endHandle)].Index = index;
+      m_handleToIndex[HandleIndex(removedHandle)] = SparseRecord(m_count, freedHandle);
+    }
+
+    void DoRemoveRange(const index_type startIndex, const size_type length) noexcept
+    {
+      assert(length > 0u);
+      assert(startIndex <= m_count && length <= (m_count - startIndex));
+      const index_type oldCount = m_count;
+      m_count -= length;
+
+      // Move the elements after the range to the left and "zero" the freed elements
+      std::move(m_elements.begin() + startIndex + length, m_elements.begin() + oldCount, m_elements.begin() + startIndex);
+      std::fill(m_elements.begin() + m_count, m_elements.begin() + oldCount, T{});
+
+      // Rotate the removed handles to the free section and invalidate them by bumping their version
+      std::rotate(m_indexToHandle.begin() + startIndex, m_indexToHandle.begin() + startIndex + length, m_indexToHandle.begin() + oldCount);
+      for (index_type i = m_count; i < oldCount; ++i)
+      {
+        m_indexToHandle[i] = IncreaseHandleVersion(m_indexToHandle[i]);
+      }
+      // Patch the handle to index lookup table so we know the new index of element with a given handle
+      PatchHandleToIndex(startIndex, oldCount);
+    }
+
+    //! @brief Update the handle to index lookup for the dense entries in the range [startIndex, endIndex[
+    //!        This also stores the current handle in the sparse record so freed handles must be bumped before calling this.
+    void PatchHandleToIndex(const index_type startIndex, const index_type endIndex) noexcept
+    {
+      for (index_type i = startIndex; i < endIndex; ++i)
+      {
+        const handle_type handle = m_indexToHandle[i];
+        m_handleToIndex[HandleIndex(handle)] = SparseRecord(i, handle);
+      }
+    }
+
+    static constexpr uint32_t HandleIndex(const handle_type handle) noexcept
+    {
+      return static_cast<uint32_t>(handle) & DenseHandleVectorInternal::HandleIndexMask;
+    }
+
+    static constexpr handle_type CreateInitialKey(const index_type i) noexcept
+    {
+      assert(i < DenseHandleVectorInternal::MaxCapacity);
+      return static_cast<handle_type>((1u << DenseHandleVectorInternal::HandleVersionShift) | i);
+    }
+
+    static constexpr handle_type IncreaseHandleVersion(const handle_type handle) noexcept
+    {
+      auto unsignedHandle = static_cast<uint32_t>(handle);
+      const uint32_t versionOne = (1u << DenseHandleVectorInternal::HandleVersionShift);
+      uint32_t handleVersion = (unsignedHandle & DenseHandleVectorInternal::HandleVersionMask) + versionOne;
+      // The version wrapped so skip version zero
+      handleVersion = handleVersion >= versionOne ? handleVersion : versionOne;
+      return static_cast<handle_type>(handleVersion | (unsignedHandle & DenseHandleVectorInternal::HandleIndexMask));
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,476 @@
+#ifndef FSLBASE_COLLECTIONS_SPATIALHASHGRID2D_HPP
+#define FSLBASE_COLLECTIONS_SPATIALHASHGRID2D_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Rect.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A uniform grid that buckets axis aligned bounding boxes by the cells they overlap.
+  //!        - Entries are identified by the handle returned when they are added, the handles of removed entries are reused.
+  //!        - AddRange calculates the cell ranges of all boxes in one branch free pass and grows the per entry storage once.
+  //!        - Move only touches the buckets that the entry enters or leaves.
+  //!        - Queries report each entry once, even if it spans multiple cells, and never modify the grid so they can run concurrently.
+  //!        - Boxes outside the grid area are clamped to the border cells, non-finite coordinates never produce a cell outside the grid.
+  //!        - Boxes that touch the query area count as intersecting (this allows points to be stored as zero sized boxes).
+  class SpatialHashGrid2D
+  {
+  public:
+    static constexpr uint32_t InvalidHandle = std::numeric_limits<uint32_t>::max();
+    static constexpr uint32_t MaxCellCount = std::numeric_limits<uint16_t>::max();
+
+  private:
+    //! Marks a unused handle (MaxCellCount ensures it is never a valid cell index)
+    static constexpr uint16_t InvalidCell = std::numeric_limits<uint16_t>::max();
+
+    //! The inclusive cell range covered by a entry
+    struct CellRange
+    {
+      uint16_t StartX{0};
+      uint16_t StartY{0};
+      uint16_t EndX{0};
+      uint16_t EndY{0};
+
+      constexpr bool Contains(const uint32_t cellX, const uint32_t cellY) const noexcept
+      {
+        return cellX >= StartX && cellX <= EndX && cellY >= StartY && cellY <= EndY;
+      }
+
+      constexpr bool operator==(const CellRange& rhs) const noexcept
+      {
+        return StartX == rhs.StartX && StartY == rhs.StartY && EndX == rhs.EndX && EndY == rhs.EndY;
+      }
+    };
+
+    Rect m_area;
+    float m_cellSize;
+    float m_invCellSize;
+    uint16_t m_cellCountX;
+    uint16_t m_cellCountY;
+    std::vector<std::vector<uint32_t>> m_cells;
+
+    //! The bounding box of each handle
+    std::vector<Rect> m_bounds;
+    //! The cell range of each handle, StartX is InvalidCell for unused handles
+    std::vector<CellRange> m_ranges;
+    std::vector<uint32_t> m_freeHandles;
+    uint32_t m_count{0};
+
+  public:
+    //! @brief Create a grid that covers the given area using square cells of the given size
+    SpatialHashGrid2D(const Rect& area, const float cellSize)
+      : m_area(area)
+      , m_cellSize(cellSize)
+      , m_invCellSize(cellSize > 0.0f ? 1.0f / cellSize : 0.0f)
+      , m_cellCountX(CalcCellCount(area.Width(), cellSize))
+      , m_cellCountY(CalcCellCount(area.Height(), cellSize))
+      , m_cells(static_cast<std::size_t>(m_cellCountX) * m_cellCountY)
+    {
+    }
+
+    const Rect& GetArea() const noexcept
+    {
+      return m_area;
+    }
+
+    float GetCellSize() const noexcept
+    {
+      return m_cellSize;
+    }
+
+    uint32_t GetCellCountX() const noexcept
+    {
+      return m_cellCountX;
+    }
+
+    uint32_t GetCellCountY() const noexcept
+    {
+      return m_cellCountY;
+    }
+
+    //! @brief Get the number of entries in the grid
+    uint32_t Count() const noexcept
+    {
+      return m_count;
+    }
+
+    bool IsValidHandle(const uint32_t handle) const noexcept
+    {
+      return handle < m_ranges.size() && m_ranges[handle].StartX != InvalidCell;
+    }
+
+    //! @brief Get the bounding box of the given entry
+    const Rect& GetBounds(const uint32_t handle) const
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      return m_bounds[handle];
+    }
+
+    //! @brief Get the handles stored in the given cell (entries spanning multiple cells are stored in each of them)
+    ReadOnlySpan<uint32_t> GetCellEntries(const uint32_t cellX, const uint32_t cellY) const
+    {
+      if (cellX >= m_cellCountX || cellY >= m_cellCountY)
+      {
+        throw std::invalid_argument("cell out of bounds");
+      }
+      const std::vector<uint32_t>& cell = m_cells[ToCellIndex(cellX, cellY)];
+      return ReadOnlySpan<uint32_t>(cell.data(), cell.size());
+    }
+
+    //! @brief Remove all entries
+    void Clear() noexcept
+    {
+      for (auto& rCell : m_cells)
+      {
+        rCell.clear();
+      }
+      m_bounds.clear();
+      m_ranges.clear();
+      m_freeHandles.clear();
+      m_count = 0;
+    }
+
+    //! @brief Add a entry
+    //! @return the handle of the entry
+    uint32_t Add(const Rect& bounds)
+    {
+      const uint32_t handle = AllocateHandle();
+      const CellRange range = ToCellRange(bounds);
+      m_bounds[handle] = bounds;
+      m_ranges[handle] = range;
+      for (uint32_t y = range.StartY; y <= range.EndY; ++y)
+      {
+        for (uint32_t x = range.StartX; x <= range.EndX; ++x)
+        {
+          m_cells[ToCellIndex(x, y)].push_back(handle);
+        }
+      }
+      return handle;
+    }
+
+    //! @brief Add multiple entries, the handle of entry n is written to dstHandles[n].
+    void AddRange(const ReadOnlySpan<Rect> bounds, Span<uint32_t> dstHandles)
+    {
+      if (dstHandles.size() < bounds.size())
+      {
+        throw std::invalid_argument("dstHandles is too small");
+      }
+      // Reused handles are filled in one by one, the rest is appended in bulk
+      std::size_t srcIndex = 0;
+      while (srcIndex < bounds.size() && !m_freeHandles.empty())
+      {
+        dstHandles[srcIndex] = Add(bounds[srcIndex]);
+        ++srcIndex;
+      }
+      const std::size_t remaining = bounds.size() - srcIndex;
+      if (remaining == 0u)
+      {
+        return;
+      }
+      const std::size_t firstHandle = m_bounds.size();
+      if ((firstHandle + remaining) > InvalidHandle)
+      {
+        throw std::length_error("out of handles");
+      }
+      m_bounds.insert(m_bounds.end(), bounds.begin() + srcIndex, bounds.end());
+      m_ranges.resize(firstHandle + remaining);
+      CellRange* const pRanges = m_ranges.data() + firstHandle;
+      ToCellRanges(ReadOnlySpan<Rect>(bounds.data() + srcIndex, remaining), pRanges);
+      m_count += static_cast<uint32_t>(remaining);
+
+      for (std::size_t i = 0; i < remaining; ++i)
+      {
+        const auto handle = static_cast<uint32_t>(firstHandle + i);
+        const CellRange& range = pRanges[i];
+        for (uint32_t y = range.StartY; y <= range.EndY; ++y)
+        {
+          for (uint32_t x = range.StartX; x <= range.EndX; ++x)
+          {
+            m_cells[ToCellIndex(x, y)].push_back(handle);
+          }
+        }
+        dstHandles[srcIndex + i] = handle;
+      }
+    }
+
+    //! @brief Remove the given entry
+    void Remove(const uint32_t handle)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      const CellRange range = m_ranges[handle];
+      for (uint32_t y = range.StartY; y <= range.EndY; ++y)
+      {
+        for (uint32_t x = range.StartX; x <= range.EndX; ++x)
+        {
+          RemoveFromCell(m_cells[ToCellIndex(x, y)], handle);
+        }
+      }
+      m_ranges[handle].StartX = InvalidCell;
+      m_freeHandles.push_back(handle);
+      --m_count;
+    }
+
+    //! @brief Change the bounding box of the given entry
+    void Move(const uint32_t handle, const Rect& bounds)
+    {
+      if (!IsValidHandle(handle))
+      {
+        throw std::invalid_argument("invalid handle");
+      }
+      m_bounds[handle] = bounds;
+      const CellRange oldRange = m_ranges[handle];
+      const CellRange newRange = ToCellRange(bounds);
+      if (newRange == oldRange)
+      {
+        return;
+      }
+      m_ranges[handle] = newRange;
+
+      for (uint32_t y = oldRange.StartY; y <= oldRange.EndY; ++y)
+      {
+        for (uint32_t x = oldRange.StartX; x <= oldRange.EndX; ++x)
+        {
+          if (!newRange.Contains(x, y))
+          {
+            RemoveFromCell(m_cells[ToCellIndex(x, y)], handle);
+          }
+        }
+      }
+      for (uint32_t y = newRange.StartY; y <= newRange.EndY; ++y)
+      {
+        for (uint32_t x = newRange.StartX; x <= newRange.EndX; ++x)
+        {
+          if (!oldRange.Contains(x, y))
+          {
+            m_cells[ToCellIndex(x, y)].push_back(handle);
+          }
+        }
+      }
+    }
+
+    //! @brief Call func(handle) for each entry that intersects the area.
+    template <typename TFunc>
+    void QueryAABB(const Rect& area, TFunc&& func) const
+    {
+      ForEachCandidate(ToCellRange(area),
+                       [this, &area, &func](const uint32_t handle)
+                       {
+                         if (Overlaps(m_bounds[handle], area))
+                         {
+                           func(handle);
+                         }
+                       });
+    }
+
+    //! @brief Write the handles of the entries that intersect the area to dstHandles.
+    //! @return the number of handles written (entries that do not fit are skipped)
+    uint32_t QueryAABB(const Rect& area, Span<uint32_t> dstHandles) const
+    {
+      std::size_t count = 0;
+      QueryAABB(area,
+                [&dstHandles, &count](const uint32_t handle)
+                {
+                  if (count < dstHandles.size())
+                  {
+                    dstHandles[count] = handle;
+                    ++count;
+                  }
+                });
+      return static_cast<uint32_t>(count);
+    }
+
+    //! @brief Call func(handle) for each entry whose bounding box is within radius of center.
+    template <typename TFunc>
+    void QueryRadius(const Vector2& center, const float radius, TFunc&& func) const
+    {
+      const float radiusSquared = radius * radius;
+      ForEachCandidate(ToCellRange(Rect::FromLeftTopRightBottom(center.X - radius, center.Y - radius, center.X + radius, center.Y + radius)),
+                       [this, &center, radiusSquared, &func](const uint32_t handle)
+                       {
+                         const Rect& bounds = m_bounds[handle];
+                         const float dx = center.X - std::clamp(center.X, bounds.Left(), bounds.Right());
+                         const float dy = center.Y - std::clamp(center.Y, bounds.Top(), bounds.Bottom());
+                         if (((dx * dx) + (dy * dy)) <= radiusSquared)
+                         {
+                           func(handle);
+                         }
+                       });
+    }
+
+    //! @brief Write the handles of the entries whose bounding box is within radius of center to dstHandles.
+    //! @return the number of handles written (entries that do not fit are skipped)
+    uint32_t QueryRadius(const Vector2& center, const float radius, Span<uint32_t> dstHandles) const
+    {
+      std::size_t count = 0;
+      QueryRadius(center, radius,
+                  [&dstHandles, &count](const uint32_t handle)
+                  {
+                    if (count < dstHandles.size())
+                    {
+                      dstHandles[count] = handle;
+                      ++count;
+                    }
+                  });
+      return static_cast<uint32_t>(count);
+    }
+
+  private:
+    static uint16_t CalcCellCount(const float size, const float cellSize)
+    {
+      if (!(cellSize > 0.0f))
+      {
+        throw std::invalid_argument("cellSize must be greater than zero");
+      }
+      if (!(size >= 0.0f))
+      {
+        throw std::invalid_argument("area can not be negative");
+      }
+      const float count = std::max(std::ceil(size / cellSize), 1.0f);
+      if (count > static_cast<float>(MaxCellCount))
+      {
+        throw std::invalid_argument("too many cells, increase the cellSize");
+      }
+      return static_cast<uint16_t>(count);
+    }
+
+    static constexpr bool Overlaps(const Rect& lhs, const Rect& rhs) noexcept
+    {
+      return lhs.Left() <= rhs.Right() && rhs.Left() <= lhs.Right() && lhs.Top() <= rhs.Bottom() && rhs.Top() <= lhs.Bottom();
+    }
+
+    static void RemoveFromCell(std::vector<uint32_t>& rCell, const uint32_t handle) noexcept
+    {
+      auto itrFind = std::find(rCell.begin(), rCell.end(), handle);
+      assert(itrFind != rCell.end());
+      *itrFind = rCell.back();
+      rCell.pop_back();
+    }
+
+    std::size_t ToCellIndex(const uint32_t cellX, const uint32_t cellY) const noexcept
+    {
+      assert(cellX < m_cellCountX);
+      assert(cellY < m_cellCountY);
+      return (static_cast<std::size_t>(cellY) * m_cellCountX) + cellX;
+    }
+
+    CellRange ToCellRange(const Rect& bounds) const noexcept
+    {
+      CellRange range;
+      ToCellRanges(ReadOnlySpan<Rect>(&bounds, 1u), &range);
+      return range;
+    }
+
+    //! Branch free so the compiler can vectorize it.
+    //! The cell coordinate is the second argument of std::max and std::min so a NaN is replaced by the first cell,
+    //! infinite coordinates are clamped to the border cells like any other coordinate outside the grid.
+    void ToCellRanges(const ReadOnlySpan<Rect> bounds, CellRange* const pDst) const noexcept
+    {
+      const float originX = m_area.Left();
+      const float originY = m_area.Top();
+      const float invCellSize = m_invCellSize;
+      const auto maxX = static_cast<float>(m_cellCountX - 1u);
+      const auto maxY = static_cast<float>(m_cellCountY - 1u);
+      const Rect* const pSrc = bounds.data();
+      const std::size_t count = bounds.size();
+      for (std::size_t i = 0; i < count; ++i)
+      {
+        pDst[i].StartX = static_cast<uint16_t>(std::min(maxX, std::max(0.0f, (pSrc[i].Left() - originX) * invCellSize)));
+        pDst[i].StartY = static_cast<uint16_t>(std::min(maxY, std::max(0.0f, (pSrc[i].Top() - originY) * invCellSize)));
+        pDst[i].EndX = static_cast<uint16_t>(std::min(maxX, std::max(0.0f, (pSrc[i].Right() - originX) * invCellSize)));
+        pDst[i].EndY = static_cast<uint16_t>(std::min(maxY, std::max(0.0f, (pSrc[i].Bottom() - originY) * invCellSize)));
+      }
+    }
+
+    uint32_t AllocateHandle()
+    {
+      uint32_t handle = 0;
+      if (!m_freeHandles.empty())
+      {
+        handle = m_freeHandles.back();
+        m_freeHandles.pop_back();
+      }
+      else
+      {
+        if (m_bounds.size() >= InvalidHandle)
+        {
+          throw std::length_error("out of handles");
+        }
+        handle = static_cast<uint32_t>(m_bounds.size());
+        m_bounds.emplace_back();
+        m_ranges.emplace_back();
+      }
+      ++m_count;
+      return handle;
+    }
+
+    //! Call func for each entry stored in the cell range, a entry that spans multiple cells is only reported in the first cell
+    //! that it shares with the range.
+    template <typename TFunc>
+    void ForEachCandidate(const CellRange& queryRange, TFunc&& func) const
+    {
+      for (uint32_t y = queryRange.StartY; y <= queryRange.EndY; ++y)
+      {
+        for (uint32_t x = queryRange.StartX; x <= queryRange.EndX; ++x)
+        {
+          for (const uint32_t handle : m_cells[ToCellIndex(x, y)])
+          {
+            const CellRange& range = m_ranges[handle];
+            if (x == std::max(static_cast<uint32_t>(range.StartX), static_cast<uint32_t>(queryRange.StartX)) &&
+                y == std::max(static_cast<uint32_t>(range.StartY), static_cast<uint32_t>(queryRange.StartY)))
+            {
+              func(handle);
+            }
+          }
+        }
+      }
+    }
+  };
+}
+
+#endif
@@ -121,6 +121,9 @@ namespace Fsl
       auto count = Size(hostedArrayIndex);
       if (count > 0u)
       {
+        // erase the elements
+        const auto startIndex = StartIndex(hostedArrayIndex);
+        m_content.erase(m_content.begin() + startIndex, m_content.begin() + (startIndex + count));
         // now move any our end indices of the rest of the 'hosted vectors'
         for (std::size_t i = hostedArrayIndex; i < m_hosted.size(); ++i)
         {
@@ -0,0 +1,89 @@
+#ifndef FSLBASE_SYSTEM_THREADING_WORKERTHREADPOOL_HPP
+#define FSLBASE_SYSTEM_THREADING_WORKERTHREADPOOL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+namespace Fsl
+{
+  //! @brief A fixed set of worker threads that split a index range into contiguous chunks and process them in parallel.
+  //! @note  The calling thread takes part in the work, so a pool without worker threads runs everything on the caller.
+  //!        ParallelFor is not reentrant and must only be called by one thread at a time.
+  class WorkerThreadPool
+  {
+    struct Impl;
+    using ChunkFunction = void (*)(void* pContext, const std::size_t begin, const std::size_t end);
+
+    std::unique_ptr<Impl> m_impl;
+
+  public:
+    WorkerThreadPool(const WorkerThreadPool&) = delete;
+    WorkerThreadPool& operator=(const WorkerThreadPool&) = delete;
+
+    //! @brief Create a pool with one worker thread for each hardware thread except the calling one
+    WorkerThreadPool();
+    explicit WorkerThreadPool(const uint32_t workerThreadCount);
+    ~WorkerThreadPool();
+
+    uint32_t GetWorkerThreadCount() const noexcept;
+
+    //! @brief The maximum number of chunks that are processed at the same time (the worker threads + the caller)
+    uint32_t GetConcurrency() const noexcept
+    {
+      return GetWorkerThreadCount() + 1u;
+    }
+
+    //! @brief Call func(begin, end) for contiguous ranges that cover [0, count) and wait for all of them to complete.
+    //! @param minChunkSize the smallest range that is worth handing to another thread (ranges below this run on the caller).
+    //! @note  If func throws, the first exception is rethrown on the calling thread once all the ranges have been processed.
+    template <typename TFunc>
+    void ParallelFor(const std::size_t count, const std::size_t minChunkSize, TFunc&& func)
+    {
+      using func_type = std::remove_reference_t<TFunc>;
+      DoParallelFor(count, minChunkSize, &InvokeChunk<func_type>, const_cast<void*>(static_cast<const void*>(std::addressof(func))));
+    }
+
+  private:
+    template <typename TFunc>
+    static void InvokeChunk(void* pContext, const std::size_t begin, const std::size_t end)
+    {
+      (*static_cast<TFunc*>(pContext))(begin, end);
+    }
+
+    void DoParallelFor(const std::size_t count, const std::size_t minChunkSize, ChunkFunction pFunction, void* pContext);
+  };
+}
+
+#endif
@@ -0,0 +1,56 @@
+#ifndef FSLBASE_TRACE_CHROMETRACEWRITER_HPP
+#define FSLBASE_TRACE_CHROMETRACEWRITER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Trace/TraceEvent.hpp>
+#include <FslBase/Trace/TraceThreadInfo.hpp>
+#include <string>
+
+//! Writes trace events in the Chrome trace event JSON format which can be loaded by chrome://tracing and https://ui.perfetto.dev
+namespace Fsl::ChromeTraceWriter
+{
+  //! @brief Convert the events to a Chrome trace JSON document.
+  //! @param events the events (any order).
+  //! @param threads the name of the threads, threads without a name are not described.
+  //! @param ticksPerSecond the frequency of the event timestamps.
+  //! @note  Timestamps are written in microseconds relative to the oldest event.
+  extern std::string ToJson(const ReadOnlySpan<TraceEvent> events, const ReadOnlySpan<TraceThreadInfo> threads, const uint64_t ticksPerSecond);
+
+  //! @brief Write the events to the given file as a Chrome trace JSON document.
+  extern void Write(const IO::Path& path, const ReadOnlySpan<TraceEvent> events, const ReadOnlySpan<TraceThreadInfo> threads,
+                    const uint64_t ticksPerSecond);
+}
+
+#endif
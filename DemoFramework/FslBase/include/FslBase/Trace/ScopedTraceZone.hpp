@@ -0,0 +1,73 @@
+#ifndef FSLBASE_TRACE_SCOPEDTRACEZONE_HPP
+#define FSLBASE_TRACE_SCOPEDTRACEZONE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+
+namespace Fsl
+{
+  //! @brief Records a complete trace zone covering the lifetime of the object (if tracing was enabled when it was created).
+  //! @note  The category and name strings must have static storage duration.
+  class ScopedTraceZone
+  {
+    const char* m_pszCategory;
+    const char* m_pszName;
+    uint64_t m_beginTimestamp{0};
+    bool m_isEnabled;
+
+  public:
+    ScopedTraceZone(const ScopedTraceZone&) = delete;
+    ScopedTraceZone& operator=(const ScopedTraceZone&) = delete;
+
+    ScopedTraceZone(const char* const pszCategory, const char* const pszName) noexcept
+      : m_pszCategory(pszCategory)
+      , m_pszName(pszName)
+      , m_isEnabled(TraceRecorder::IsEnabled())
+    {
+      if (m_isEnabled)
+      {
+        m_beginTimestamp = TraceRecorder::GetTimestamp();
+      }
+    }
+
+    ~ScopedTraceZone() noexcept
+    {
+      if (m_isEnabled)
+      {
+        TraceRecorder::RecordComplete(m_pszCategory, m_pszName, m_beginTimestamp, TraceRecorder::GetTimestamp());
+      }
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef FSLBASE_TRACE_TRACE_HPP
+#define FSLBASE_TRACE_TRACE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Trace/ScopedTraceZone.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+
+// The trace macros can be compiled out by defining FSL_TRACE_DISABLED
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_DETAIL_CONCAT2(lHS, rHS) lHS##rHS
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_DETAIL_CONCAT(lHS, rHS) FSL_TRACE_DETAIL_CONCAT2(lHS, rHS)
+
+#ifdef FSL_TRACE_DISABLED
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_ZONE(cATEGORY, nAME) \
+  {                                    \
+  }
+
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_INSTANT(cATEGORY, nAME) \
+  {                                       \
+  }
+
+#else
+
+//! Record a zone from this point until the end of the current scope (the strings must be literals)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_ZONE(cATEGORY, nAME) const Fsl::ScopedTraceZone FSL_TRACE_DETAIL_CONCAT(fslTraceZone, __LINE__)((cATEGORY), (nAME))
+
+//! Record a instant event (the strings must be literals)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define FSL_TRACE_INSTANT(cATEGORY, nAME) Fsl::TraceRecorder::RecordInstant((cATEGORY), (nAME))
+
+#endif
+
+#endif
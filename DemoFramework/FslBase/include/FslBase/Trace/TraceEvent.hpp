@@ -0,0 +1,70 @@
+#ifndef FSLBASE_TRACE_TRACEEVENT_HPP
+#define FSLBASE_TRACE_TRACEEVENT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Trace/TraceEventType.hpp>
+
+namespace Fsl
+{
+  //! @brief A recorded trace event.
+  //! @note  The name and category strings are not copied so they must have static storage duration (string literals).
+  //!        All times are in PerformanceCounter ticks.
+  struct TraceEvent
+  {
+    const char* pszCategory{nullptr};
+    const char* pszName{nullptr};
+    uint64_t Timestamp{0};
+    //! Only valid for TraceEventType::Complete
+    uint64_t Duration{0};
+    //! Only valid for TraceEventType::AsyncBegin and TraceEventType::AsyncEnd
+    uint32_t Id{0};
+    uint32_t ThreadId{0};
+    TraceEventType Type{TraceEventType::Complete};
+
+    constexpr TraceEvent() noexcept = default;
+
+    constexpr TraceEvent(const TraceEventType type, const char* const pszCategoryName, const char* const pszEventName,
+                         const uint64_t timestamp, const uint64_t duration, const uint32_t id, const uint32_t threadId) noexcept
+      : pszCategory(pszCategoryName)
+      , pszName(pszEventName)
+      , Timestamp(timestamp)
+      , Duration(duration)
+      , Id(id)
+      , ThreadId(threadId)
+      , Type(type)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,89 @@
+#ifndef FSLBASE_TRACE_TRACERECORDER_HPP
+#define FSLBASE_TRACE_TRACERECORDER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Trace/TraceEvent.hpp>
+#include <FslBase/Trace/TraceThreadInfo.hpp>
+#include <string>
+#include <vector>
+
+//! Process wide low overhead trace event recorder.
+//!
+//! - Each thread records into its own lock-free single-producer/single-consumer ring buffer, so recording never takes a lock
+//!   (the buffer is allocated and registered the first time a thread records a event while tracing is enabled).
+//! - Collect drains all thread buffers and is expected to be called regularly from one thread (the profiler does it once per frame).
+//! - If a thread buffer is full the new event is dropped and counted.
+//! - While tracing is disabled the record calls only cost a relaxed atomic load.
+namespace Fsl::TraceRecorder
+{
+  //! @brief Check if trace recording is enabled
+  extern bool IsEnabled() noexcept;
+
+  //! @brief Enable or disable trace recording.
+  extern void SetEnabled(const bool enabled) noexcept;
+
+  //! @brief Get the current trace timestamp (PerformanceCounter ticks)
+  extern uint64_t GetTimestamp() noexcept;
+
+  //! @brief Record a complete zone.
+  //! @note  The category and name strings must have static storage duration.
+  extern void RecordComplete(const char* const pszCategory, const char* const pszName, const uint64_t beginTimestamp,
+                             const uint64_t endTimestamp) noexcept;
+
+  //! @brief Record a instant event.
+  //! @note  The category and name strings must have static storage duration.
+  extern void RecordInstant(const char* const pszCategory, const char* const pszName) noexcept;
+
+  //! @brief Allocate a new id for a async span (never zero).
+  extern uint32_t NextAsyncId() noexcept;
+
+  //! @brief Record the start of a span that can end on another thread.
+  //! @note  The category and name strings must have static storage duration.
+  extern void RecordAsyncBegin(const char* const pszCategory, const char* const pszName, const uint32_t id) noexcept;
+
+  //! @brief Record the end of a span started by RecordAsyncBegin with the same category, name and id.
+  //! @note  The category and name strings must have static storage duration.
+  extern void RecordAsyncEnd(const char* const pszCategory, const char* const pszName, const uint32_t id) noexcept;
+
+  //! @brief Give the calling thread a name that is used when the trace is exported.
+  extern void SetCurrentThreadName(const std::string& name);
+
+  //! @brief Move all recorded events from the thread buffers to the end of rEvents (ordered per thread, not globally).
+  //! @return the number of events that were dropped because a thread buffer was full since the last call.
+  extern uint64_t Collect(std::vector<TraceEvent>& rEvents);
+
+  //! @brief Get information about all threads that have recorded events.
+  extern void GetThreads(std::vector<TraceThreadInfo>& rThreads);
+}
+
+#endif
@@ -0,0 +1,238 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Fsl
+{
+  struct WorkerThreadPool::Impl
+  {
+    //! A snapshot of the job fields, taken while holding the mutex so a worker never reads fields that a later job is rewriting
+    struct JobRecord
+    {
+      ChunkFunction pFunction{nullptr};
+      void* pContext{nullptr};
+      std::size_t Count{0};
+      std::size_t ChunkSize{0};
+      std::size_t ChunkCount{0};
+    };
+
+    std::mutex Mutex;
+    std::condition_variable WorkAvailable;
+    std::condition_variable WorkDone;
+    std::vector<std::thread> Threads;
+
+    // The current job, only modified while holding the mutex and no worker is active
+    ChunkFunction pFunction{nullptr};
+    void* pContext{nullptr};
+    std::size_t Count{0};
+    std::size_t ChunkSize{0};
+    std::size_t ChunkCount{0};
+    std::atomic<std::size_t> NextChunk{0};
+    std::atomic<std::size_t> CompletedChunks{0};
+    std::exception_ptr Exception;
+
+    uint64_t Generation{0};
+    uint32_t ActiveWorkers{0};
+    bool Quit{false};
+
+    explicit Impl(const uint32_t workerThreadCount)
+    {
+      Threads.reserve(workerThreadCount);
+      for (uint32_t i = 0; i < workerThreadCount; ++i)
+      {
+        Threads.emplace_back([this, i]() { WorkerMain(i); });
+      }
+    }
+
+    ~Impl()
+    {
+      {
+        std::lock_guard<std::mutex> lock(Mutex);
+        Quit = true;
+      }
+      WorkAvailable.notify_all();
+      for (std::thread& rThread : Threads)
+      {
+        rThread.join();
+      }
+    }
+
+    Impl(const Impl&) = delete;
+    Impl& operator=(const Impl&) = delete;
+
+    JobRecord GetJob() const noexcept
+    {
+      return {pFunction, pContext, Count, ChunkSize, ChunkCount};
+    }
+
+    void RunChunks(const JobRecord& job) noexcept
+    {
+      std::size_t chunkIndex = NextChunk.fetch_add(1u, std::memory_order_relaxed);
+      while (chunkIndex < job.ChunkCount)
+      {
+        const std::size_t begin = chunkIndex * job.ChunkSize;
+        const std::size_t end = std::min(begin + job.ChunkSize, job.Count);
+        try
+        {
+          job.pFunction(job.pContext, begin, end);
+        }
+        catch (...)
+        {
+          std::lock_guard<std::mutex> lock(Mutex);
+          if (!Exception)
+          {
+            Exception = std::current_exception();
+          }
+        }
+        CompletedChunks.fetch_add(1u, std::memory_order_acq_rel);
+        chunkIndex = NextChunk.fetch_add(1u, std::memory_order_relaxed);
+      }
+    }
+
+    void WorkerMain(const uint32_t workerIndex)
+    {
+      TraceRecorder::SetCurrentThreadName(fmt::format("Worker {}", workerIndex));
+
+      uint64_t processedGeneration = 0;
+      std::unique_lock<std::mutex> lock(Mutex);
+      while (true)
+      {
+        WorkAvailable.wait(lock, [this, processedGeneration]() { return Quit || Generation != processedGeneration; });
+        if (Quit)
+        {
+          return;
+        }
+        processedGeneration = Generation;
+        // A worker that wakes up late can observe a generation whose chunks have all been claimed and whose caller might already have
+        // returned, so it must skip it instead of joining it (the next job can only be written once ActiveWorkers is zero).
+        if (NextChunk.load(std::memory_order_relaxed) >= ChunkCount)
+        {
+          continue;
+        }
+        const JobRecord job = GetJob();
+        ++ActiveWorkers;
+        lock.unlock();
+
+        RunChunks(job);
+
+        lock.lock();
+        assert(ActiveWorkers > 0u);
+        --ActiveWorkers;
+        if (ActiveWorkers == 0u)
+        {
+          WorkDone.notify_one();
+        }
+      }
+    }
+  };
+
+
+  WorkerThreadPool::WorkerThreadPool()
+    : WorkerThreadPool(std::max(std::thread::hardware_concurrency(), 1u) - 1u)
+  {
+  }
+
+
+  WorkerThreadPool::WorkerThreadPool(const uint32_t workerThreadCount)
+    : m_impl(std::make_unique<Impl>(workerThreadCount))
+  {
+  }
+
+
+  WorkerThreadPool::~WorkerThreadPool() = default;
+
+
+  uint32_t WorkerThreadPool::GetWorkerThreadCount() const noexcept
+  {
+    return static_cast<uint32_t>(m_impl->Threads.size());
+  }
+
+
+  void WorkerThreadPool::DoParallelFor(const std::size_t count, const std::size_t minChunkSize, ChunkFunction pFunction, void* pContext)
+  {
+    assert(pFunction != nullptr);
+    if (count <= 0u)
+    {
+      return;
+    }
+
+    const std::size_t chunkCount = std::min(std::max(count / std::max(minChunkSize, static_cast<std::size_t>(1u)), static_cast<std::size_t>(1u)),
+                                            static_cast<std::size_t>(GetConcurrency()));
+    if (chunkCount <= 1u)
+    {
+      pFunction(pContext, 0u, count);
+      return;
+    }
+
+    Impl& rImpl = *m_impl;
+    Impl::JobRecord job;
+    {
+      std::lock_guard<std::mutex> lock(rImpl.Mutex);
+      assert(rImpl.ActiveWorkers == 0u);
+      rImpl.pFunction = pFunction;
+      rImpl.pContext = pContext;
+      rImpl.Count = count;
+      rImpl.ChunkCount = chunkCount;
+      rImpl.ChunkSize = (count + chunkCount - 1u) / chunkCount;
+      rImpl.NextChunk.store(0u, std::memory_order_relaxed);
+      rImpl.CompletedChunks.store(0u, std::memory_order_relaxed);
+      rImpl.Exception = {};
+      ++rImpl.Generation;
+      job = rImpl.GetJob();
+    }
+    rImpl.WorkAvailable.notify_all();
+
+    rImpl.RunChunks(job);
+
+    std::exception_ptr exception;
+    {
+      std::unique_lock<std::mutex> lock(rImpl.Mutex);
+      rImpl.WorkDone.wait(lock, [&rImpl, chunkCount]()
+                          { return rImpl.ActiveWorkers == 0u && rImpl.CompletedChunks.load(std::memory_order_acquire) >= chunkCount; });
+      std::swap(exception, rImpl.Exception);
+    }
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+}
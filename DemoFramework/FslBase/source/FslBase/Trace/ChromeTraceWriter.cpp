@@ -0,0 +1,189 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Trace/ChromeTraceWriter.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <string_view>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t ProcessId = 1;
+    }
+
+    inline void Append(fmt::memory_buffer& rBuf, const std::string_view str)
+    {
+      rBuf.append(str.data(), str.data() + str.size());
+    }
+
+    void AppendEscapedString(fmt::memory_buffer& rBuf, const char* const psz)
+    {
+      rBuf.push_back('"');
+      if (psz != nullptr)
+      {
+        for (const char* pSrc = psz; *pSrc != 0; ++pSrc)
+        {
+          const char ch = *pSrc;
+          switch (ch)
+          {
+          case '"':
+            Append(rBuf, "\\\"");
+            break;
+          case '\\':
+            Append(rBuf, "\\\\");
+            break;
+          case '\n':
+            Append(rBuf, "\\n");
+            break;
+          case '\r':
+            Append(rBuf, "\\r");
+            break;
+          case '\t':
+            Append(rBuf, "\\t");
+            break;
+          default:
+            if (static_cast<uint8_t>(ch) < 0x20u)
+            {
+              fmt::format_to(std::back_inserter(rBuf), "\\u{:04x}", static_cast<uint32_t>(static_cast<uint8_t>(ch)));
+            }
+            else
+            {
+              rBuf.push_back(ch);
+            }
+            break;
+          }
+        }
+      }
+      rBuf.push_back('"');
+    }
+
+    const char* GetPhase(const TraceEventType type)
+    {
+      switch (type)
+      {
+      case TraceEventType::Complete:
+        return "X";
+      case TraceEventType::Instant:
+        return "i";
+      case TraceEventType::AsyncBegin:
+        return "b";
+      case TraceEventType::AsyncEnd:
+        return "e";
+      default:
+        throw NotSupportedException("Unsupported TraceEventType");
+      }
+    }
+  }
+
+
+  std::string ChromeTraceWriter::ToJson(const ReadOnlySpan<TraceEvent> events, const ReadOnlySpan<TraceThreadInfo> threads,
+                                        const uint64_t ticksPerSecond)
+  {
+    if (ticksPerSecond == 0u)
+    {
+      throw std::invalid_argument("ticksPerSecond can not be zero");
+    }
+
+    uint64_t baseTimestamp = std::numeric_limits<uint64_t>::max();
+    for (const TraceEvent& event : events)
+    {
+      baseTimestamp = std::min(baseTimestamp, event.Timestamp);
+    }
+    const double ticksToMicroseconds = 1000000.0 / static_cast<double>(ticksPerSecond);
+
+    fmt::memory_buffer buf;
+    fmt::format_to(std::back_inserter(buf), "{{\"displayTimeUnit\":\"ms\",\"traceEvents\":[");
+
+    bool isFirst = true;
+    for (const TraceThreadInfo& thread : threads)
+    {
+      if (!thread.Name.empty())
+      {
+        if (!isFirst)
+        {
+          buf.push_back(',');
+        }
+        isFirst = false;
+        fmt::format_to(std::back_inserter(buf), "\n{{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":{},\"tid\":{},\"args\":{{\"name\":",
+                       LocalConfig::ProcessId, thread.ThreadId);
+        AppendEscapedString(buf, thread.Name.c_str());
+        Append(buf, "}}");
+      }
+    }
+
+    for (const TraceEvent& event : events)
+    {
+      if (!isFirst)
+      {
+        buf.push_back(',');
+      }
+      isFirst = false;
+
+      Append(buf, "\n{\"name\":");
+      AppendEscapedString(buf, event.pszName);
+      Append(buf, ",\"cat\":");
+      AppendEscapedString(buf, event.pszCategory);
+      fmt::format_to(std::back_inserter(buf), ",\"ph\":\"{}\",\"pid\":{},\"tid\":{},\"ts\":{:.3f}", GetPhase(event.Type), LocalConfig::ProcessId,
+                     event.ThreadId, static_cast<double>(event.Timestamp - baseTimestamp) * ticksToMicroseconds);
+      switch (event.Type)
+      {
+      case TraceEventType::Complete:
+        fmt::format_to(std::back_inserter(buf), ",\"dur\":{:.3f}", static_cast<double>(event.Duration) * ticksToMicroseconds);
+        break;
+      case TraceEventType::Instant:
+        Append(buf, ",\"s\":\"t\"");
+        break;
+      case TraceEventType::AsyncBegin:
+      case TraceEventType::AsyncEnd:
+        fmt::format_to(std::back_inserter(buf), ",\"id\":\"0x{:x}\"", event.Id);
+        break;
+      }
+      buf.push_back('}');
+    }
+    Append(buf, "\n]}\n");
+    return fmt::to_string(buf);
+  }
+
+
+  void ChromeTraceWriter::Write(const IO::Path& path, const ReadOnlySpan<TraceEvent> events, const ReadOnlySpan<TraceThreadInfo> threads,
+                                const uint64_t ticksPerSecond)
+  {
+    IO::File::WriteAllText(path, ToJson(events, threads, ticksPerSecond));
+  }
+}
@@ -0,0 +1,116 @@
+#ifndef FSLBASE_TRACE_TRACEEVENTRINGBUFFER_HPP
+#define FSLBASE_TRACE_TRACEEVENTRINGBUFFER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Trace/TraceEvent.hpp>
+#include <atomic>
+#include <cassert>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Fixed capacity single-producer/single-consumer ring buffer of trace events.
+  //!        The owning thread is the only producer, the collector is the only consumer.
+  class TraceEventRingBuffer
+  {
+    std::vector<TraceEvent> m_events;
+    uint32_t m_mask;
+    uint32_t m_threadId;
+    std::atomic<uint32_t> m_writeIndex{0};
+    std::atomic<uint32_t> m_readIndex{0};
+    std::atomic<uint64_t> m_dropped{0};
+    std::atomic<bool> m_isRetired{false};
+
+  public:
+    TraceEventRingBuffer(const TraceEventRingBuffer&) = delete;
+    TraceEventRingBuffer& operator=(const TraceEventRingBuffer&) = delete;
+
+    //! @param capacity must be a power of two
+    TraceEventRingBuffer(const uint32_t capacity, const uint32_t threadId)
+      : m_events(capacity)
+      , m_mask(capacity - 1u)
+      , m_threadId(threadId)
+    {
+      assert(capacity > 0u && (capacity & (capacity - 1u)) == 0u);
+    }
+
+    uint32_t GetThreadId() const noexcept
+    {
+      return m_threadId;
+    }
+
+    //! @brief Producer side
+    void Push(const TraceEventType type, const char* const pszCategory, const char* const pszName, const uint64_t timestamp,
+              const uint64_t duration, const uint32_t id) noexcept
+    {
+      const uint32_t writeIndex = m_writeIndex.load(std::memory_order_relaxed);
+      const uint32_t readIndex = m_readIndex.load(std::memory_order_acquire);
+      if ((writeIndex - readIndex) > m_mask)
+      {
+        m_dropped.fetch_add(1u, std::memory_order_relaxed);
+        return;
+      }
+      m_events[writeIndex & m_mask] = TraceEvent(type, pszCategory, pszName, timestamp, duration, id, m_threadId);
+      m_writeIndex.store(writeIndex + 1u, std::memory_order_release);
+    }
+
+    //! @brief Consumer side, moves all available events to the end of rEvents
+    //! @return the number of dropped events since the last drain
+    uint64_t Drain(std::vector<TraceEvent>& rEvents)
+    {
+      uint32_t readIndex = m_readIndex.load(std::memory_order_relaxed);
+      const uint32_t writeIndex = m_writeIndex.load(std::memory_order_acquire);
+      rEvents.reserve(rEvents.size() + (writeIndex - readIndex));
+      while (readIndex != writeIndex)
+      {
+        rEvents.push_back(m_events[readIndex & m_mask]);
+        ++readIndex;
+      }
+      m_readIndex.store(readIndex, std::memory_order_release);
+      return m_dropped.exchange(0u, std::memory_order_relaxed);
+    }
+
+    //! @brief Called by the owning thread when it exits
+    void Retire() noexcept
+    {
+      m_isRetired.store(true, std::memory_order_release);
+    }
+
+    bool IsRetired() const noexcept
+    {
+      return m_isRetired.load(std::memory_order_acquire);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,243 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/PerformanceCounter.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include "TraceEventRingBuffer.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! Events per thread (must be a power of two), the buffers are expected to be drained once per frame
+      constexpr uint32_t ThreadBufferCapacity = 16384;
+    }
+
+    struct Registry
+    {
+      std::mutex Lock;
+      std::vector<std::shared_ptr<TraceEventRingBuffer>> Buffers;
+      //! Kept after the thread exits so events that have already been collected can still be attributed
+      std::vector<TraceThreadInfo> Threads;
+      uint32_t NextThreadId{1};
+    };
+
+    //! Retires the buffer when the owning thread exits so the collector can release it once it has been drained
+    struct ThreadRecord
+    {
+      std::shared_ptr<TraceEventRingBuffer> Buffer;
+
+      ThreadRecord() = default;
+      ThreadRecord(const ThreadRecord&) = delete;
+      ThreadRecord& operator=(const ThreadRecord&) = delete;
+
+      ~ThreadRecord()
+      {
+        if (Buffer)
+        {
+          Buffer->Retire();
+        }
+      }
+    };
+
+    std::atomic<bool> g_enabled{false};
+    std::atomic<uint32_t> g_lastAsyncId{0};
+    thread_local ThreadRecord t_threadRecord;
+
+
+    Registry& GetRegistry()
+    {
+      static Registry registry;
+      return registry;
+    }
+
+
+    TraceEventRingBuffer* TryGetThreadBuffer() noexcept
+    {
+      TraceEventRingBuffer* pBuffer = t_threadRecord.Buffer.get();
+      if (pBuffer != nullptr)
+      {
+        return pBuffer;
+      }
+
+      try
+      {
+        Registry& rRegistry = GetRegistry();
+        std::lock_guard<std::mutex> lock(rRegistry.Lock);
+        auto buffer = std::make_shared<TraceEventRingBuffer>(LocalConfig::ThreadBufferCapacity, rRegistry.NextThreadId);
+        rRegistry.Threads.emplace_back(rRegistry.NextThreadId, std::string());
+        rRegistry.Buffers.push_back(buffer);
+        ++rRegistry.NextThreadId;
+        t_threadRecord.Buffer = std::move(buffer);
+        return t_threadRecord.Buffer.get();
+      }
+      catch (const std::exception&)
+      {
+        // Tracing is best effort, so if we cant allocate the buffer we just skip the event
+        return nullptr;
+      }
+    }
+
+
+    inline void Record(const TraceEventType type, const char* const pszCategory, const char* const pszName, const uint64_t timestamp,
+                       const uint64_t duration, const uint32_t id) noexcept
+    {
+      TraceEventRingBuffer* pBuffer = TryGetThreadBuffer();
+      if (pBuffer != nullptr)
+      {
+        pBuffer->Push(type, pszCategory, pszName, timestamp, duration, id);
+      }
+    }
+  }
+
+
+  bool TraceRecorder::IsEnabled() noexcept
+  {
+    return g_enabled.load(std::memory_order_relaxed);
+  }
+
+
+  void TraceRecorder::SetEnabled(const bool enabled) noexcept
+  {
+    g_enabled.store(enabled, std::memory_order_relaxed);
+  }
+
+
+  uint64_t TraceRecorder::GetTimestamp() noexcept
+  {
+    return PerformanceCounter::GetPerformanceCounter();
+  }
+
+
+  void TraceRecorder::RecordComplete(const char* const pszCategory, const char* const pszName, const uint64_t beginTimestamp,
+                                     const uint64_t endTimestamp) noexcept
+  {
+    if (IsEnabled())
+    {
+      const uint64_t duration = endTimestamp >= beginTimestamp ? endTimestamp - beginTimestamp : 0u;
+      Record(TraceEventType::Complete, pszCategory, pszName, beginTimestamp, duration, 0u);
+    }
+  }
+
+
+  void TraceRecorder::RecordInstant(const char* const pszCategory, const char* const pszName) noexcept
+  {
+    if (IsEnabled())
+    {
+      Record(TraceEventType::Instant, pszCategory, pszName, GetTimestamp(), 0u, 0u);
+    }
+  }
+
+
+  uint32_t TraceRecorder::NextAsyncId() noexcept
+  {
+    uint32_t id = g_lastAsyncId.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    if (id == 0u)
+    {
+      id = g_lastAsyncId.fetch_add(1u, std::memory_order_relaxed) + 1u;
+    }
+    return id;
+  }
+
+
+  void TraceRecorder::RecordAsyncBegin(const char* const pszCategory, const char* const pszName, const uint32_t id) noexcept
+  {
+    if (IsEnabled())
+    {
+      Record(TraceEventType::AsyncBegin, pszCategory, pszName, GetTimestamp(), 0u, id);
+    }
+  }
+
+
+  void TraceRecorder::RecordAsyncEnd(const char* const pszCategory, const char* const pszName, const uint32_t id) noexcept
+  {
+    if (IsEnabled())
+    {
+      Record(TraceEventType::AsyncEnd, pszCategory, pszName, GetTimestamp(), 0u, id);
+    }
+  }
+
+
+  void TraceRecorder::SetCurrentThreadName(const std::string& name)
+  {
+    TraceEventRingBuffer* pBuffer = TryGetThreadBuffer();
+    if (pBuffer != nullptr)
+    {
+      Registry& rRegistry = GetRegistry();
+      std::lock_guard<std::mutex> lock(rRegistry.Lock);
+      const uint32_t threadId = pBuffer->GetThreadId();
+      auto itrFind = std::find_if(rRegistry.Threads.begin(), rRegistry.Threads.end(),
+                                  [threadId](const TraceThreadInfo& entry) { return entry.ThreadId == threadId; });
+      if (itrFind != rRegistry.Threads.end())
+      {
+        itrFind->Name = name;
+      }
+    }
+  }
+
+
+  uint64_t TraceRecorder::Collect(std::vector<TraceEvent>& rEvents)
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Lock);
+
+    uint64_t droppedCount = 0;
+    for (auto& rBuffer : rRegistry.Buffers)
+    {
+      // The retired flag must be read before draining, a buffer that is retired has received its last event
+      const bool isRetired = rBuffer->IsRetired();
+      droppedCount += rBuffer->Drain(rEvents);
+      if (isRetired)
+      {
+        rBuffer.reset();
+      }
+    }
+    rRegistry.Buffers.erase(std::remove(rRegistry.Buffers.begin(), rRegistry.Buffers.end(), nullptr), rRegistry.Buffers.end());
+    return droppedCount;
+  }
+
+
+  void TraceRecorder::GetThreads(std::vector<TraceThreadInfo>& rThreads)
+  {
+    Registry& rRegistry = GetRegistry();
+    std::lock_guard<std::mutex> lock(rRegistry.Lock);
+
+    rThreads = rRegistry.Threads;
+  }
+}
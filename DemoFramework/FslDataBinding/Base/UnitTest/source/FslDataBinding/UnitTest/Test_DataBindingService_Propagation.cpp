@@ -0,0 +1,189 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDataBinding/Base/Bind/MultiConverterBinding.hpp>
+#include <FslDataBinding/Base/Binding.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <memory>
+#include <vector>
+#include "UTDependencyObject.hpp"
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_DataBindingService_Propagation = TestFixtureFslBase;
+
+  std::shared_ptr<DataBinding::MultiConverterBinding<float, float, float>> CreateSumBinding()
+  {
+    return std::make_shared<DataBinding::MultiConverterBinding<float, float, float>>([](const float value0, const float value1)
+                                                                                       { return value0 + value1; });
+  }
+
+  void BindSum(UTDependencyObject& rDst, UTDependencyObject& rSrc0, UTDependencyObject& rSrc1)
+  {
+    rDst.SetBinding(UTDependencyObject::Property1, DataBinding::Binding(CreateSumBinding(), rSrc0.GetPropertyHandle(UTDependencyObject::Property1),
+                                                                        rSrc1.GetPropertyHandle(UTDependencyObject::Property1)));
+  }
+}
+
+
+TEST(Test_DataBindingService_Propagation, Diamond_EvaluatedOnce)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject a(dataBindingService);
+  UTDependencyObject b(dataBindingService);
+  UTDependencyObject c(dataBindingService);
+  UTDependencyObject d(dataBindingService);
+
+  b.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  c.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  BindSum(d, b, c);
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(1u, dataBindingService->GetLastExecuteStats().TopologicalOrderRebuilds);
+
+  EXPECT_TRUE(a.SetProperty1Value(1.5f));
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_EQ(1.5f, b.GetProperty1Value());
+  EXPECT_EQ(1.5f, c.GetProperty1Value());
+  EXPECT_EQ(3.0f, d.GetProperty1Value());
+
+  const DataBinding::DataBindingServiceStats& stats = dataBindingService->GetLastExecuteStats();
+  // a (root), b, c and d
+  EXPECT_EQ(4u, stats.NodesVisited);
+  // b, c and d (the diamond bottom 'd' is only evaluated once after both of its sources were updated)
+  EXPECT_EQ(3u, stats.PropertyGetSetCalls);
+  EXPECT_EQ(0u, stats.TopologicalOrderRebuilds);
+}
+
+
+TEST(Test_DataBindingService_Propagation, Ladder_EvaluatedOncePerNode)
+{
+  constexpr std::size_t LayerCount = 12;
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject root(dataBindingService);
+  std::vector<std::unique_ptr<UTDependencyObject>> left;
+  std::vector<std::unique_ptr<UTDependencyObject>> right;
+  for (std::size_t i = 0; i < LayerCount; ++i)
+  {
+    left.push_back(std::make_unique<UTDependencyObject>(dataBindingService));
+    right.push_back(std::make_unique<UTDependencyObject>(dataBindingService));
+  }
+  // Bind the layers in reverse order so the order of creation is not a valid topological order
+  for (std::size_t i = LayerCount - 1; i > 0; --i)
+  {
+    BindSum(*left[i], *left[i - 1], *right[i - 1]);
+    BindSum(*right[i], *left[i - 1], *right[i - 1]);
+  }
+  left[0]->SetBinding(UTDependencyObject::Property1, root.GetPropertyHandle(UTDependencyObject::Property1));
+  right[0]->SetBinding(UTDependencyObject::Property1, root.GetPropertyHandle(UTDependencyObject::Property1));
+  dataBindingService->ExecuteChanges();
+
+  EXPECT_TRUE(root.SetProperty1Value(1.0f));
+  dataBindingService->ExecuteChanges();
+
+  float expectedValue = 1.0f;
+  for (std::size_t i = 0; i < LayerCount; ++i)
+  {
+    EXPECT_EQ(expectedValue, left[i]->GetProperty1Value());
+    EXPECT_EQ(expectedValue, right[i]->GetProperty1Value());
+    expectedValue *= 2.0f;
+  }
+
+  const DataBinding::DataBindingServiceStats& stats = dataBindingService->GetLastExecuteStats();
+  EXPECT_EQ(1u + (LayerCount * 2u), stats.NodesVisited);
+  EXPECT_EQ(LayerCount * 2u, stats.PropertyGetSetCalls);
+}
+
+
+TEST(Test_DataBindingService_Propagation, UnchangedValue_StopsPropagation)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject a(dataBindingService);
+  UTDependencyObject b(dataBindingService);
+  UTDependencyObject c(dataBindingService);
+
+  b.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  c.SetBinding(UTDependencyObject::Property1, b.GetPropertyHandle(UTDependencyObject::Property1));
+  EXPECT_TRUE(a.SetProperty1Value(2.0f));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(2.0f, c.GetProperty1Value());
+
+  // Force a refresh of the root, since b does not change its value c should not be evaluated
+  dataBindingService->Changed(a.GetPropertyHandle(UTDependencyObject::Property1), DataBinding::PropertyChangeReason::Refresh);
+  dataBindingService->ExecuteChanges();
+
+  const DataBinding::DataBindingServiceStats& stats = dataBindingService->GetLastExecuteStats();
+  EXPECT_EQ(2u, stats.NodesVisited);
+  EXPECT_EQ(1u, stats.PropertyGetSetCalls);
+  EXPECT_EQ(2.0f, c.GetProperty1Value());
+}
+
+
+TEST(Test_DataBindingService_Propagation, NewBinding_InvalidatesTopologicalOrder)
+{
+  auto dataBindingService = std::make_shared<DataBinding::DataBindingService>();
+
+  UTDependencyObject a(dataBindingService);
+  UTDependencyObject b(dataBindingService);
+  UTDependencyObject c(dataBindingService);
+
+  b.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  c.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(1u, dataBindingService->GetLastExecuteStats().TopologicalOrderRebuilds);
+
+  // b and c has the same rank so the order needs to be rebuild
+  c.SetBinding(UTDependencyObject::Property1, b.GetPropertyHandle(UTDependencyObject::Property1));
+  EXPECT_TRUE(a.SetProperty1Value(4.0f));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(1u, dataBindingService->GetLastExecuteStats().TopologicalOrderRebuilds);
+  EXPECT_EQ(4.0f, c.GetProperty1Value());
+
+  // Clearing a binding keeps the order valid
+  c.ClearBinding(UTDependencyObject::Property1);
+  EXPECT_TRUE(a.SetProperty1Value(5.0f));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(0u, dataBindingService->GetLastExecuteStats().TopologicalOrderRebuilds);
+  EXPECT_EQ(5.0f, b.GetProperty1Value());
+  EXPECT_EQ(4.0f, c.GetProperty1Value());
+
+  // a is ranked before c, so the cached order is still valid
+  c.SetBinding(UTDependencyObject::Property1, a.GetPropertyHandle(UTDependencyObject::Property1));
+  dataBindingService->ExecuteChanges();
+  EXPECT_EQ(0u, dataBindingService->GetLastExecuteStats().TopologicalOrderRebuilds);
+  EXPECT_EQ(5.0f, c.GetProperty1Value());
+}
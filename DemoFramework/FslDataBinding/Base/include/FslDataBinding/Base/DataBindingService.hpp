@@ -34,6 +34,7 @@
 #include <FslBase/Collections/HandleVector.hpp>
 #include <FslDataBinding/Base/BindingMode.hpp>
 #include <FslDataBinding/Base/DataBindingInstanceHandle.hpp>
+#include <FslDataBinding/Base/DataBindingServiceStats.hpp>
 #include <FslDataBinding/Base/DataSourceFlags.hpp>
 #include <FslDataBinding/Base/Internal/IPropertyMethods.hpp>
 #include <FslDataBinding/Base/Internal/ServiceBindingRecord.hpp>
@@ -42,9 +43,9 @@
 #include <array>
 #include <deque>
 #include <memory>
-#include <queue>
 #include <typeindex>
 #include <utility>
+#include <vector>
 
 namespace Fsl::DataBinding
 {
@@ -157,17 +158,45 @@ namespace Fsl::DataBinding
       }
     };
 
+    struct ScheduledRecord
+    {
+      uint32_t Rank{0};
+      DataBindingInstanceHandle Handle;
+
+      constexpr ScheduledRecord() noexcept = default;
+      constexpr explicit ScheduledRecord(const uint32_t rank, const DataBindingInstanceHandle handle) noexcept
+        : Rank(rank)
+        , Handle(handle)
+      {
+      }
+
+      //! Used to turn the one-way schedule into a min heap on the rank
+      friend constexpr bool operator>(const ScheduledRecord& lhs, const ScheduledRecord& rhs) noexcept
+      {
+        return lhs.Rank > rhs.Rank;
+      }
+    };
+
     TwoWayDataBindingGroupManager m_groupManager;
 
     HandleVector<Internal::ServiceBindingRecord> m_instances;
     // We ensure that this vector can always hold m_instances.Count entries (so the schedule of a destroy will never fail)
     std::vector<DataBindingInstanceHandle> m_scheduledForDestroy;
     std::vector<DataBindingInstanceHandle> m_pendingChanges;
-    std::queue<DataBindingInstanceHandle> m_changesOneWay;
-    std::queue<DataBindingInstanceHandle> m_changesTwoWay;
-    std::queue<ObserverRecord> m_pendingObserverCallbacks;
-    std::queue<DeferredBindingRecord> m_pendingBindings;
+    //! The 'root' instances of the one-way changes
+    std::vector<DataBindingInstanceHandle> m_changesOneWay;
+    std::vector<DataBindingInstanceHandle> m_changesTwoWay;
+    std::vector<ObserverRecord> m_pendingObserverCallbacks;
+    std::vector<DeferredBindingRecord> m_pendingBindings;
+    //! Min heap (on rank) of the instances that need to be evaluated during the one-way propagation
+    std::vector<ScheduledRecord> m_oneWaySchedule;
+    //! Scratch pad used while building the topological order (in-degree per instance index)
+    std::vector<uint32_t> m_topologicalScratchInDegree;
+    //! Scratch pad used while building the topological order (instance indices in topological order)
+    std::vector<uint32_t> m_topologicalScratchOrder;
+    bool m_topologicalOrderDirty{false};
     CallContext m_callContext;
+    DataBindingServiceStats m_stats;
 
   public:
     DataBindingService(const DataBindingService&) = delete;
@@ -231,6 +260,12 @@ namespace Fsl::DataBinding
     //! Execute all pending changes
     void ExecuteChanges();
 
+    //! Get the counters collected during the last ExecuteChanges call
+    const DataBindingServiceStats& GetLastExecuteStats() const noexcept
+    {
+      return m_stats;
+    }
+
     //! Scan the internal state to see if its consistent
     bool SanityCheck() const;
 
@@ -254,7 +289,11 @@ namespace Fsl::DataBinding
     void ExecuteObserverCallbacksNow();
     void ExecuteTwoWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source,
                                 const DataBindingInstanceHandle hSkip);
-    void ExecuteOneWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source);
+    void ScheduleOneWayTargets(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source);
+    bool ExecuteOneWayChange(const DataBindingInstanceHandle hTarget, const Internal::ServiceBindingRecord& target);
+    void ClearOneWaySchedule() noexcept;
+    void EnsureTopologicalOrder();
+    void RebuildTopologicalOrder();
     void ExecuteInstanceObserverCallback(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource);
     bool ExecuteDependencyPropertyGetSet(const DataBindingInstanceHandle hTarget, const Internal::ServiceBindingRecord& target,
                                          const Internal::ServiceBindingRecord& source);
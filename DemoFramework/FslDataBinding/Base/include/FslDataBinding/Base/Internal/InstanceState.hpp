@@ -56,6 +56,8 @@ namespace Fsl::DataBinding::Internal
       NoFlags = 0,
 
 
+      // Is set while the instance is scheduled for evaluation by the one-way change propagation
+      ScheduledForEvaluation = 0x10000000,
       // Set if this
       Observable = 0x20000000,
       // Is set if there are pending changes
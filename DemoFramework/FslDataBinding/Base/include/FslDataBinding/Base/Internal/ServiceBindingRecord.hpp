@@ -77,6 +77,8 @@ namespace Fsl::DataBinding::Internal
     // It's still public for erase atm
     TightHostedVector<DataBindingInstanceHandle, 3> SysHandles;
     std::unique_ptr<Internal::IPropertyMethods> Methods;
+    //! The depth of this instance in the cached topological order of the binding graph (every source has a lower rank than its targets)
+    uint32_t TopologicalRank{0};
 
     ServiceBindingRecord() = default;
     explicit ServiceBindingRecord(const DataBindingInstanceType type, const Internal::InstanceState::Flags flags)
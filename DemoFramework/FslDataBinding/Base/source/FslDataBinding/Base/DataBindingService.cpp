@@ -45,6 +45,7 @@
 #include <algorithm>
 #include <cassert>
 #include <cstdlib>
+#include <functional>
 #include <utility>
 
 #ifdef NDEBUG
@@ -769,7 +770,7 @@ namespace Fsl::DataBinding
         assert(!binding.ComplexBinding());
         const auto sourceHandlesSpan = binding.SourceHandlesAsSpan();
         assert(sourceHandlesSpan.size() == 1u);
-        m_pendingBindings.emplace(hTarget, sourceHandlesSpan.front(), binding.Mode());
+        m_pendingBindings.emplace_back(hTarget, sourceHandlesSpan.front(), binding.Mode());
         return true;
       }
       throw UsageErrorException("SetBinding: Can not be called from this context");
@@ -812,6 +813,7 @@ namespace Fsl::DataBinding
     {
       throw UsageErrorException("ExecuteChanges: Can not be called from this context");
     }
+    m_stats = {};
     uint32_t changeLoopCounter = 0;
     do
     {
@@ -901,6 +903,14 @@ namespace Fsl::DataBinding
         }
 
         rTargetInstance.SetSource(binding);
+        // The cached topological order stays valid as long as all the new sources are ranked before the target
+        for (const auto hSource : binding.SourceHandlesAsSpan())
+        {
+          if (m_instances.FastGet(hSource.Value).TopologicalRank >= rTargetInstance.TopologicalRank)
+          {
+            m_topologicalOrderDirty = true;
+          }
+        }
         // If the target is marked as changed, mark all parent sources as changed as well
         if (rTargetInstance.Instance.HasPendingChanges())
         {
@@ -1009,7 +1019,12 @@ namespace Fsl::DataBinding
         if (rSourceInstance.Instance.GetState() == DataBindingInstanceState::Alive)
         {
           hasSource = true;
-          RecursiveMarkAsChanged(hSource, rSourceInstance);
+          // A source that is already marked has already marked all of its sources, so we only need to visit each source once
+          // (without this diamond shaped binding graphs would be visited a exponential number of times)
+          if (!rSourceInstance.Instance.HasPendingChanges())
+          {
+            RecursiveMarkAsChanged(hSource, rSourceInstance);
+          }
         }
       }
     }
@@ -1017,7 +1032,7 @@ namespace Fsl::DataBinding
     {
       if (!wasMarked)
       {
-        m_changesOneWay.push(hInstance);
+        m_changesOneWay.push_back(hInstance);
       }
     }
   }
@@ -1075,6 +1090,11 @@ namespace Fsl::DataBinding
             // A source that is bound as 'two way' can not itself have a source that is one way
             return false;
           }
+          // Verify that the cached topological order is valid
+          if (!m_topologicalOrderDirty && pSourceRecord->TopologicalRank >= record.TopologicalRank)
+          {
+            return false;
+          }
         }
 
         // We do only need to run this check if the record is marked as changed and if it has sources attached
@@ -1171,17 +1191,17 @@ namespace Fsl::DataBinding
     try
     {
       m_callContext.State = CallContextState::ExecutePendingBindings;
-      while (!m_pendingBindings.empty())
+      for (const DeferredBindingRecord& pendingBinding : m_pendingBindings)
       {
-        const auto pendingBinding = m_pendingBindings.front();
-        m_pendingBindings.pop();
         DoSetBinding(pendingBinding.TargetHandle, Binding(pendingBinding.SourceHandle, pendingBinding.Mode));
-        m_pendingObserverCallbacks.emplace(pendingBinding.TargetHandle, pendingBinding.SourceHandle);
+        m_pendingObserverCallbacks.emplace_back(pendingBinding.TargetHandle, pendingBinding.SourceHandle);
       }
+      m_pendingBindings.clear();
       m_callContext = {};
     }
     catch (const std::exception&)
     {
+      m_pendingBindings.clear();
       m_callContext = {};
       FSLLOG3_ERROR("Exeception during DataBinding ExecuteObserverCallbacksNow");
       throw;
@@ -1202,16 +1222,19 @@ namespace Fsl::DataBinding
       try
       {
         m_callContext.State = CallContextState::ExecutingObserverCallbacks;
-        while (!m_pendingObserverCallbacks.empty())
+        // The callbacks are not allowed to schedule new observer callbacks, but we use a index and copy the record to stay safe
+        for (std::size_t i = 0; i < m_pendingObserverCallbacks.size(); ++i)
         {
-          const auto observerRecord = m_pendingObserverCallbacks.front();
-          m_pendingObserverCallbacks.pop();
+          const ObserverRecord observerRecord = m_pendingObserverCallbacks[i];
+          ++m_stats.ObserverCallbacks;
           ExecuteInstanceObserverCallback(observerRecord.TargetHandle, observerRecord.SourceHandle);
         }
+        m_pendingObserverCallbacks.clear();
         m_callContext = {};
       }
       catch (const std::exception&)
       {
+        m_pendingObserverCallbacks.clear();
         m_callContext = {};
         FSLLOG3_ERROR("Exeception during DataBinding ExecuteObserverCallbacksNow");
         throw;
@@ -1272,7 +1295,7 @@ namespace Fsl::DataBinding
           if (!rChangedInstance.SysHandles.Empty(Internal::ServicePropertyVectorIndex::Targets) && !rChangedInstance.Instance.HasPendingChanges())
           {
             rChangedInstance.Instance.MarkPendingChanges();
-            m_changesOneWay.push(hChangedInstance);
+            m_changesOneWay.push_back(hChangedInstance);
           }
         }
         else
@@ -1291,7 +1314,7 @@ namespace Fsl::DataBinding
     for (uint32_t i = 0; i < groupCount; ++i)
     {
       const DataBindingInstanceHandle hChangedInstanceHandle = m_groupManager[i];
-      m_changesTwoWay.push(hChangedInstanceHandle);
+      m_changesTwoWay.push_back(hChangedInstanceHandle);
     }
     // Clear the group manager content as its no longer needed
     m_groupManager.ClearGroups();
@@ -1317,10 +1340,8 @@ namespace Fsl::DataBinding
       try
       {
         m_callContext.State = CallContextState::ExecutingChanges;
-        while (!m_changesTwoWay.empty())
+        for (const DataBindingInstanceHandle hChangedInstance : m_changesTwoWay)
         {
-          const auto hChangedInstance = m_changesTwoWay.front();
-          m_changesTwoWay.pop();
           auto* pChangedInstance = m_instances.TryGet(hChangedInstance.Value);
           if (pChangedInstance != nullptr)
           {
@@ -1330,10 +1351,12 @@ namespace Fsl::DataBinding
             ExecuteTwoWayChangesTo(hChangedInstance, *pChangedInstance, {});
           }
         }
+        m_changesTwoWay.clear();
         m_callContext = {};
       }
       catch (const std::exception&)
       {
+        m_changesTwoWay.clear();
         m_callContext = {};
         FSLLOG3_ERROR("Exeception during DataBinding ExecutPendingChangesNow");
         throw;
@@ -1346,6 +1369,7 @@ namespace Fsl::DataBinding
   {
     assert(m_callContext.State == CallContextState::Idle);
     assert(m_callContext.HandlesEmpty());
+    assert(m_oneWaySchedule.empty());
 
     if (!m_changesOneWay.empty())
     {
@@ -1353,25 +1377,47 @@ namespace Fsl::DataBinding
 
       try
       {
+        EnsureTopologicalOrder();
+
+        // The roots are applied to their targets right away, then every scheduled target is evaluated exactly once in topological order.
+        // Since all sources of a instance are ranked before it, all of its sources will have been updated before it gets evaluated.
         m_callContext.State = CallContextState::ExecutingChanges;
-        while (!m_changesOneWay.empty())
+        for (const DataBindingInstanceHandle hChangedInstance : m_changesOneWay)
         {
-          const auto hChangedInstance = m_changesOneWay.front();
-          m_changesOneWay.pop();
           auto* pChangedInstance = m_instances.TryGet(hChangedInstance.Value);
           if (pChangedInstance != nullptr)
           {
             assert(pChangedInstance->Instance.HasPendingChanges());
             pChangedInstance->Instance.ClearPendingChanges();
+            ++m_stats.NodesVisited;
+            ScheduleOneWayTargets(hChangedInstance, *pChangedInstance);
+          }
+        }
+        m_changesOneWay.clear();
 
-            // this method does not modify m_instances so the reference "pChangedInstance" into it is safe
-            ExecuteOneWayChangesTo(hChangedInstance, *pChangedInstance);
+        while (!m_oneWaySchedule.empty())
+        {
+          std::pop_heap(m_oneWaySchedule.begin(), m_oneWaySchedule.end(), std::greater<>());
+          const DataBindingInstanceHandle hTarget = m_oneWaySchedule.back().Handle;
+          m_oneWaySchedule.pop_back();
+
+          // this method does not modify m_instances so the reference into it is safe
+          Internal::ServiceBindingRecord& rTarget = m_instances.FastGet(hTarget.Value);
+          rTarget.Instance.Disable(Internal::InstanceState::Flags::ScheduledForEvaluation);
+          ++m_stats.NodesVisited;
+          const bool changed = ExecuteOneWayChange(hTarget, rTarget);
+          if (changed || rTarget.Instance.HasPendingChanges())
+          {
+            rTarget.Instance.ClearPendingChanges();
+            ScheduleOneWayTargets(hTarget, rTarget);
           }
         }
         m_callContext = {};
       }
       catch (const std::exception&)
       {
+        m_changesOneWay.clear();
+        ClearOneWaySchedule();
         m_callContext = {};
         FSLLOG3_ERROR("Exception during DataBinding ExecutePendingOneWayChangesNow");
         throw;
@@ -1455,41 +1501,33 @@ namespace Fsl::DataBinding
   }
 
   // Beware this modifies the m_pendingObserverCallbacks with observer instances that need to be executed
-  void DataBindingService::ExecuteOneWayChangesTo(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source)
+  void DataBindingService::ScheduleOneWayTargets(const DataBindingInstanceHandle hSource, const Internal::ServiceBindingRecord& source)
   {
     assert(m_callContext.State == CallContextState::ExecutingChanges);
     if (source.Instance.GetState() == DataBindingInstanceState::Alive)
     {
-      // Execute the change
       for (const auto hTarget : source.TargetHandles())
       {
         auto& rTarget = m_instances.FastGet(hTarget.Value);
         if (rTarget.Instance.GetState() == DataBindingInstanceState::Alive)
         {
-          bool changed = false;
           switch (rTarget.Instance.GetType())
           {
           case DataBindingInstanceType::DependencyObserverProperty:
-            m_pendingObserverCallbacks.emplace(hTarget, hSource);
+            m_pendingObserverCallbacks.emplace_back(hTarget, hSource);
             break;
-          // case DataBindingInstanceType::DependencyObject:
-          // case DataBindingInstanceType::Target:
-          //  assert(target.pDataTarget != nullptr);
-          //  target.pDataTarget->OnChanged(hChangedInstance);
-          //  break;
           case DataBindingInstanceType::DependencyProperty:
-            changed = ExecuteDependencyPropertyGetSet(hTarget, rTarget, source);
+            if (!rTarget.Instance.IsEnabled(Internal::InstanceState::Flags::ScheduledForEvaluation))
+            {
+              assert(rTarget.TopologicalRank > source.TopologicalRank);
+              rTarget.Instance.Enable(Internal::InstanceState::Flags::ScheduledForEvaluation);
+              m_oneWaySchedule.emplace_back(rTarget.TopologicalRank, hTarget);
+              std::push_heap(m_oneWaySchedule.begin(), m_oneWaySchedule.end(), std::greater<>());
+            }
             break;
           default:
             throw InternalErrorException("Change to a object of a unsupported type");
           }
-          if (changed || rTarget.Instance.HasPendingChanges())
-          {
-            rTarget.Instance.ClearPendingChanges();
-
-            // Execute any pending changes to dependent resources
-            ExecuteOneWayChangesTo(hTarget, rTarget);
-          }
         }
         else
         {
@@ -1504,6 +1542,99 @@ namespace Fsl::DataBinding
   }
 
 
+  bool DataBindingService::ExecuteOneWayChange(const DataBindingInstanceHandle hTarget, const Internal::ServiceBindingRecord& target)
+  {
+    assert(m_callContext.State == CallContextState::ExecutingChanges);
+    assert(target.Instance.GetType() == DataBindingInstanceType::DependencyProperty);
+    // Multi bindings read all their sources, so any alive source can be used to trigger the get/set
+    for (const auto hSource : target.SourceHandles())
+    {
+      const Internal::ServiceBindingRecord& source = m_instances.FastGet(hSource.Value);
+      if (source.Instance.GetState() == DataBindingInstanceState::Alive)
+      {
+        return ExecuteDependencyPropertyGetSet(hTarget, target, source);
+      }
+    }
+    FSLLOG3_ERROR("Scheduled instance had no alive source, that ought to have been filtered before");
+    return false;
+  }
+
+
+  void DataBindingService::ClearOneWaySchedule() noexcept
+  {
+    for (const ScheduledRecord& record : m_oneWaySchedule)
+    {
+      auto* pRecord = m_instances.TryGet(record.Handle.Value);
+      if (pRecord != nullptr)
+      {
+        pRecord->Instance.Disable(Internal::InstanceState::Flags::ScheduledForEvaluation);
+      }
+    }
+    m_oneWaySchedule.clear();
+  }
+
+
+  void DataBindingService::EnsureTopologicalOrder()
+  {
+    if (m_topologicalOrderDirty)
+    {
+      RebuildTopologicalOrder();
+      m_topologicalOrderDirty = false;
+      ++m_stats.TopologicalOrderRebuilds;
+    }
+  }
+
+
+  //! Assign every instance its depth in the binding graph (Kahn's algorithm).
+  //! Removing bindings or instances never invalidates the order, so this is only needed when a binding is added to a lower ranked target.
+  void DataBindingService::RebuildTopologicalOrder()
+  {
+    const uint32_t count = m_instances.Count();
+    m_topologicalScratchInDegree.assign(count, 0u);
+    m_topologicalScratchOrder.clear();
+    m_topologicalScratchOrder.reserve(count);
+
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      Internal::ServiceBindingRecord& rRecord = m_instances[i];
+      rRecord.TopologicalRank = 0;
+      for (const auto hTarget : rRecord.TargetHandles())
+      {
+        ++m_topologicalScratchInDegree[m_instances.FastHandleToIndex(hTarget.Value)];
+      }
+    }
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      if (m_topologicalScratchInDegree[i] == 0u)
+      {
+        m_topologicalScratchOrder.push_back(i);
+      }
+    }
+    // m_topologicalScratchOrder grows while we process it
+    for (std::size_t orderIndex = 0; orderIndex < m_topologicalScratchOrder.size(); ++orderIndex)
+    {
+      const Internal::ServiceBindingRecord& record = m_instances[m_topologicalScratchOrder[orderIndex]];
+      const uint32_t targetRank = record.TopologicalRank + 1u;
+      for (const auto hTarget : record.TargetHandles())
+      {
+        const auto targetIndex = m_instances.FastHandleToIndex(hTarget.Value);
+        Internal::ServiceBindingRecord& rTarget = m_instances[targetIndex];
+        rTarget.TopologicalRank = std::max(rTarget.TopologicalRank, targetRank);
+        assert(m_topologicalScratchInDegree[targetIndex] > 0u);
+        if (--m_topologicalScratchInDegree[targetIndex] == 0u)
+        {
+          m_topologicalScratchOrder.push_back(targetIndex);
+        }
+      }
+    }
+    if (m_topologicalScratchOrder.size() != count)
+    {
+      // The binding rules prevent cycles, so this should never happen
+      throw InternalErrorException("Binding graph contains a cycle");
+    }
+  }
+
+
   void DataBindingService::ExecuteInstanceObserverCallback(const DataBindingInstanceHandle hTarget, const DataBindingInstanceHandle hSource)
   {
     assert(m_callContext.State == CallContextState::ExecutingObserverCallbacks);
@@ -1554,6 +1685,7 @@ namespace Fsl::DataBinding
     try
     {
       {
+        ++m_stats.PropertyGetSetCalls;
         m_callContext.SetHandle(hTarget);
         if (!target.SourceUserBinding())
         {
@@ -1599,6 +1731,7 @@ namespace Fsl::DataBinding
     try
     {
       {
+        ++m_stats.PropertyGetSetCalls;
         // Since its a reverse get/set we need to check the source user binding to see if there is a converter inplace
         if (!from.SourceUserBinding())
         {
@@ -1674,8 +1807,10 @@ namespace Fsl::DataBinding
       }
 
       // Remove all bindings that use this instance as a source
-      for (const auto hTarget : pRecord->SysHandles.AsReadOnlySpan(Internal::ServicePropertyVectorIndex::Targets))
+      // - Clearing a multi bind erases the target from all of its sources (this instance included), so we can not iterate the target span
+      while (!pRecord->SysHandles.Empty(Internal::ServicePropertyVectorIndex::Targets))
       {
+        const DataBindingInstanceHandle hTarget = pRecord->TargetHandles().back();
         Internal::ServiceBindingRecord& rToRecord = m_instances.FastGet(hTarget.Value);
         assert(rToRecord.ContainsSource(hInstance));
         // This warning could safely occur during 'shutdown' so we need a way to eliminate false warnings.
@@ -1692,19 +1827,23 @@ namespace Fsl::DataBinding
         else
         {
           FSLLOG3_VERBOSE4("- Remove source {} from {}", hInstance.Value, hTarget.Value);
+          EraseFirst<Internal::ServicePropertyVectorIndex::Targets>(pRecord->SysHandles, hTarget);
         }
         rToRecord.ClearSourceHandles();
       }
-      pRecord->ClearTargetHandles();
 
       // Destroy all properties of this instance
-      for (const auto hProperty : pRecord->PropertyHandles())
+      // - Removing a instance can move the other records, so we re-acquire the record after each property has been destroyed
+      while (!m_instances.FastGet(hInstance.Value).SysHandles.Empty(Internal::ServicePropertyVectorIndex::Properties))
       {
+        Internal::ServiceBindingRecord& rRecord = m_instances.FastGet(hInstance.Value);
+        const DataBindingInstanceHandle hProperty = rRecord.PropertyHandles().back();
+        rRecord.SysHandles.UncheckedPopBack(Internal::ServicePropertyVectorIndex::Properties);
         DoDestroyInstanceNow(hProperty);
       }
-      pRecord->ClearPropertyHandles();
 
-      m_instances.FastRemoveAt(m_instances.FastHandleToIndex(hInstance.Value));
+      // Swap remove the record so destroying a large amount of instances does not shift the entire instance array for every instance
+      m_instances.RemoveBySwapAt(m_instances.FastHandleToIndex(hInstance.Value));
     }
   }
 
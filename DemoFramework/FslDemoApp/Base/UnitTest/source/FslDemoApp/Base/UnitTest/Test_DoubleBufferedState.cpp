@@ -0,0 +1,86 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoApp/Base/DoubleBufferedState.hpp>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_DoubleBufferedState = TestFixtureFslBase;
+}
+
+
+TEST(Test_DoubleBufferedState, Construct)
+{
+  DoubleBufferedState<int> state(42);
+  EXPECT_EQ(42, state.DrawState());
+  EXPECT_EQ(42, state.UpdateState());
+  EXPECT_NE(&state.DrawState(), &state.UpdateState());
+}
+
+
+TEST(Test_DoubleBufferedState, Update_NotVisibleBeforePublish)
+{
+  DoubleBufferedState<int> state(1);
+  state.UpdateState() = 2;
+  EXPECT_EQ(1, state.DrawState());
+  EXPECT_EQ(2, state.UpdateState());
+}
+
+
+TEST(Test_DoubleBufferedState, Publish)
+{
+  DoubleBufferedState<int> state(1);
+  state.UpdateState() = 2;
+  state.Publish();
+  EXPECT_EQ(2, state.DrawState());
+  // The update state continues from the published state
+  EXPECT_EQ(2, state.UpdateState());
+
+  state.UpdateState() += 1;
+  EXPECT_EQ(2, state.DrawState());
+  state.Publish();
+  EXPECT_EQ(3, state.DrawState());
+  EXPECT_EQ(3, state.UpdateState());
+}
+
+
+TEST(Test_DoubleBufferedState, Swap)
+{
+  DoubleBufferedState<int> state(1);
+  state.UpdateState() = 2;
+  state.Swap();
+  EXPECT_EQ(2, state.DrawState());
+  // Swap does not copy, so the update state contains the previously published state
+  EXPECT_EQ(1, state.UpdateState());
+}
@@ -70,6 +70,7 @@ namespace Fsl
     void _Update(const DemoTime& demoTime) override;
     void _PostUpdate(const DemoTime& demoTime) override;
     void _Resolve(const DemoTime& demoTime) override;
+    void _PipelineHandoff() override;
     AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) override;
     void _BeginDraw(const FrameInfo& frameInfo) override;
     void _Draw(const FrameInfo& frameInfo) override;
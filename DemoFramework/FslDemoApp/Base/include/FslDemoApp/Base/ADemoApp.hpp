@@ -83,6 +83,7 @@ namespace Fsl
     void _Update(const DemoTime& demoTime) override;
     void _PostUpdate(const DemoTime& demoTime) override;
     void _Resolve(const DemoTime& demoTime) override;
+    void _PipelineHandoff() override;
     AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) override;
     void _BeginDraw(const FrameInfo& frameInfo) override;
     void _Draw(const FrameInfo& frameInfo) override;
@@ -179,6 +180,13 @@ namespace Fsl
       FSL_PARAM_NOT_USED(demoTime);
     }
 
+    //! @brief Publish the state produced by the update stage to the draw stage.
+    //! @note  Only needed by apps that enable CustomDemoAppConfig::PipelinedUpdate, as their update runs on a worker thread while the previous
+    //!        frame is drawn. Its always called on the main thread after Resolve and before the next Draw (even when the app isn't pipelined).
+    virtual void OnPipelineHandoff()
+    {
+    }
+
     virtual void BeginDraw(const FrameInfo& frameInfo)
     {
       FSL_PARAM_NOT_USED(frameInfo);
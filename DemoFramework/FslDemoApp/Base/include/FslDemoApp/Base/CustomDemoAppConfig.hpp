@@ -77,6 +77,13 @@ namespace Fsl
     //! Set this to true if this app is
     ColorSpaceType AppColorSpaceType{ColorSpaceType::Gamma};
     bool HDREnabled{false};
+    //! Opt-in pipelined frame loop. When enabled the host runs the Update, PostUpdate and Resolve calls of frame N+1 on a worker thread while
+    //! frame N is being drawn and swapped on the main thread. PreUpdate and FixedUpdate still run on the main thread, so all update calls
+    //! happen in the same order as in the sequential frame loop.
+    //! The app must keep the state used for drawing separate from the state modified during update and publish the updated state when
+    //! ADemoApp::OnPipelineHandoff is called (see DoubleBufferedState). Registered app extensions are not pipeline aware, so apps that use
+    //! extensions which share state between update and draw (like the UI extensions) should not enable this.
+    bool PipelinedUpdate{false};
 
     CustomDemoAppConfig() = default;
 
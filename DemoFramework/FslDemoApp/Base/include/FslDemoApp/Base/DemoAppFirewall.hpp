@@ -69,6 +69,7 @@ namespace Fsl
     void _Update(const DemoTime& demoTime) final;
     void _PostUpdate(const DemoTime& demoTime) final;
     void _Resolve(const DemoTime& demoTime) final;
+    void _PipelineHandoff() final;
     AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) final;
     void _BeginDraw(const FrameInfo& frameInfo) final;
     void _Draw(const FrameInfo& frameInfo) final;
@@ -0,0 +1,90 @@
+#ifndef FSLDEMOAPP_BASE_DOUBLEBUFFEREDSTATE_HPP
+#define FSLDEMOAPP_BASE_DOUBLEBUFFEREDSTATE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <array>
+#include <cstdint>
+
+namespace Fsl
+{
+  //! @brief Simple double buffered app state for apps that use the pipelined frame loop (CustomDemoAppConfig::PipelinedUpdate).
+  //!        The update stage modifies UpdateState(), the draw stage reads DrawState() and ADemoApp::OnPipelineHandoff calls Publish().
+  template <typename T>
+  class DoubleBufferedState
+  {
+    std::array<T, 2> m_states{};
+    uint32_t m_drawIndex{0};
+
+  public:
+    DoubleBufferedState() = default;
+
+    explicit DoubleBufferedState(const T& initialState)
+      : m_states{initialState, initialState}
+    {
+    }
+
+    //! @brief The state owned by the update stage
+    T& UpdateState() noexcept
+    {
+      return m_states[m_drawIndex ^ 1u];
+    }
+
+    //! @brief The state owned by the update stage
+    const T& UpdateState() const noexcept
+    {
+      return m_states[m_drawIndex ^ 1u];
+    }
+
+    //! @brief The last published state (owned by the draw stage)
+    const T& DrawState() const noexcept
+    {
+      return m_states[m_drawIndex];
+    }
+
+    //! @brief Make the update state the new draw state.
+    //!        The new update state starts out as a copy of the published state so the update can continue from where it left off.
+    void Publish()
+    {
+      m_drawIndex ^= 1u;
+      m_states[m_drawIndex ^ 1u] = m_states[m_drawIndex];
+    }
+
+    //! @brief Make the update state the new draw state without copying it.
+    //!        Beware the new update state will contain the state that was published before the last one.
+    void Swap() noexcept
+    {
+      m_drawIndex ^= 1u;
+    }
+  };
+}
+
+#endif
@@ -72,6 +72,10 @@ namespace Fsl
     virtual void _PostUpdate(const DemoTime& demoTime) = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual void _Resolve(const DemoTime& demoTime) = 0;
+    //! @brief Called once the update stage has completed and no draw is in progress. This is where the app publishes its updated state to
+    //!        the draw stage. When the pipelined frame loop is enabled this is the only point where update and draw are synchronized.
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    virtual void _PipelineHandoff() = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
     virtual AppDrawResult _TryPrepareDraw(const FrameInfo& frameInfo) = 0;
     // NOLINTNEXTLINE(readability-identifier-naming)
@@ -117,6 +117,11 @@ namespace Fsl
   }
 
 
+  void AConsoleDemoApp::_PipelineHandoff()
+  {
+  }
+
+
   AppDrawResult AConsoleDemoApp::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
     FSL_PARAM_NOT_USED(frameInfo);
@@ -40,6 +40,7 @@
 #include <FslDemoApp/Base/Service/Events/IEvent.hpp>
 #include <FslDemoApp/Base/Service/Exceptions.hpp>
 #include <FslDemoApp/Shared/Log/Host/FmtDemoWindowMetrics.hpp>
+#include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <algorithm>
 #include <cassert>
 #include <utility>
@@ -396,6 +397,12 @@ namespace Fsl
     CallExtensionsPost(m_extensions, fn);
   }
 
+  void ADemoApp::_PipelineHandoff()
+  {
+    VERBOSE_LOG("ADemoApp::_PipelineHandoff()");
+    OnPipelineHandoff();
+  }
+
   AppDrawResult ADemoApp::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
     VERBOSE_LOG("ADemoApp::_TryPrepareDraw()");
@@ -527,6 +534,15 @@ namespace Fsl
     case VirtualKey::F5:
       demoAppControl->RequestAppRestart();
       break;
+    case VirtualKey::F6:
+      {
+        const auto profilerService = m_demoAppConfig.DemoServiceProvider.TryGet<IProfilerService>();
+        if (profilerService)
+        {
+          profilerService->RequestTraceExport();
+        }
+        break;
+      }
     case VirtualKey::Pause:
       ToggleTimestep(demoAppControl, TimeStepMode::Paused);
       break;
@@ -319,6 +319,29 @@ namespace Fsl
   }
 
 
+  void DemoAppFirewall::_PipelineHandoff()
+  {
+    if (!m_app)
+    {
+      ADemoApp::_PipelineHandoff();
+      return;
+    }
+
+    try
+    {
+      m_app->_PipelineHandoff();
+    }
+    catch (const std::exception& ex)
+    {
+      std::string message;
+      message = GetExceptionFormatter().TryFormatException(ex, message) ? message : SafeStr(ex.what());
+      FSLLOG3_ERROR("App._PipelineHandoff threw exception: {}", message);
+      SafeDispose();
+      BuildErrorString("App._PipelineHandoff threw exception:", message);
+    }
+  }
+
+
   AppDrawResult DemoAppFirewall::_TryPrepareDraw(const FrameInfo& frameInfo)
   {
     if (!m_app)
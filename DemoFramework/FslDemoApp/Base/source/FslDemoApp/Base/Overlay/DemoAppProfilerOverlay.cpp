@@ -155,14 +155,27 @@ namespace Fsl
         }
 
         const PxSize2D fontSize = basic2D->FontSize();
+        const std::size_t lineLength = m_scracthpad.size();
         Vector2 dstPos(0.0f, static_cast<float>(windowMetrics.ExtentPx.Height.Value - fontSize.RawHeight()));
         if (m_scracthpad.size() > 0)
         {
           basic2D->DrawString(StringViewLite(m_scracthpad.data(), m_scracthpad.size()), dstPos);
         }
 
+        if (m_logStatsFlags.IsFlagged(DemoAppStatsFlags::Frame))
+        {    // Render the frame time percentiles of the last stats window above the FPS line
+          const ProfilerFrameTimeStats stats = m_profilerService->GetWindowFrameTimeStats();
+          m_scracthpad.clear();
+          fmt::format_to(std::back_inserter(m_scracthpad), "p50 {:4.1f}ms p99 {:4.1f}ms p99.9 {:4.1f}ms max {:4.1f}ms hitches {}",
+                         static_cast<double>(stats.TotalTime.P50) / 1000.0, static_cast<double>(stats.TotalTime.P99) / 1000.0,
+                         static_cast<double>(stats.TotalTime.P999) / 1000.0, static_cast<double>(stats.TotalTime.Max) / 1000.0,
+                         m_profilerService->GetHitchCount());
+          basic2D->DrawString(StringViewLite(m_scracthpad.data(), m_scracthpad.size()),
+                              Vector2(dstPos.X, dstPos.Y - static_cast<float>(fontSize.RawHeight())));
+        }
+
         {    // Render text for the custom counters
-          dstPos.X += static_cast<float>((m_scracthpad.size() + 1) * fontSize.RawWidth());
+          dstPos.X += static_cast<float>((lineLength + 1) * fontSize.RawWidth());
           auto itr = m_customCounters.begin();
           while (itr != m_customCounters.end())
           {
@@ -38,6 +38,10 @@
 #include <FslDemoApp/Util/Graphics/Service/ImageLibrary/ImageLibrarySTBService.hpp>
 #include <FslDemoService/BitmapConverter/IBitmapConverter.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/IO/StreamingImageReader.hpp>
 #include <FslGraphics/ImageFormatUtil.hpp>
 #include <FslGraphics/PixelFormatUtil.hpp>
 #include <stb_image_write.h>
@@ -218,13 +222,38 @@ namespace Fsl
     }
 
 
+    // stb decodes to RGB(A) with a upper left origin, so those are the defaults used when no hint was supplied
+    constexpr PixelChannelOrder ResolveChannelOrder(const PixelChannelOrder preferredChannelOrderHint) noexcept
+    {
+      return preferredChannelOrderHint != PixelChannelOrder::Undefined ? preferredChannelOrderHint : PixelChannelOrder::RGBA;
+    }
+
+    constexpr BitmapOrigin ResolveOrigin(const BitmapOrigin originHint) noexcept
+    {
+      return originHint != BitmapOrigin::Undefined ? originHint : BitmapOrigin::UpperLeft;
+    }
+
+
+    //! BMP and TGA are decoded band by band directly into the requested pixel format and origin.
+    //! Variants the streaming reader does not support are left for stb.
+    bool TryStreamImage(Bitmap& rBitmap, const IO::Path& absolutePath, const ImageFormat imageFormat, const PixelFormat pixelFormatHint,
+                        const BitmapOrigin originHint, const PixelChannelOrder preferredChannelOrderHint)
+    {
+      try
+      {
+        return StreamingImageReader::TryRead(rBitmap, absolutePath, imageFormat, pixelFormatHint, ResolveOrigin(originHint),
+                                             ResolveChannelOrder(preferredChannelOrderHint));
+      }
+      catch (const std::exception&)
+      {
+        return false;
+      }
+    }
+
+
     bool TryReadImage(Bitmap& rBitmap, const IO::Path& absolutePath, const PixelFormat pixelFormatHint, const BitmapOrigin originHint,
                       const PixelChannelOrder preferredChannelOrderHint)
     {
-      FSL_PARAM_NOT_USED(pixelFormatHint);
-      FSL_PARAM_NOT_USED(originHint);
-      FSL_PARAM_NOT_USED(preferredChannelOrderHint);
-
       int width = 0;
       int height = 0;
       int channels = 0;
@@ -240,8 +269,31 @@ namespace Fsl
         const PixelFormat pixelFormat = (channels == 3 ? PixelFormat::R8G8B8_UINT : PixelFormat::R8G8B8A8_UINT);
         auto sizePx = PxSize2D::Create(width, height);
         const std::size_t cbContent = channels * sizePx.RawUnsignedWidth() * sizePx.RawUnsignedHeight();
+        const auto contentSpan = SpanUtil::CreateReadOnly(imageData.pContent, cbContent);
 
-        rBitmap.Reset(SpanUtil::CreateReadOnly(imageData.pContent, cbContent), sizePx, pixelFormat);
+        const PixelFormat dstPixelFormat = pixelFormatHint != PixelFormat::Undefined
+                                             ? pixelFormatHint
+                                             : PixelFormatUtil::Transform(pixelFormat, ResolveChannelOrder(preferredChannelOrderHint));
+        if (!RawBitmapBandConverter::IsSupported(pixelFormat, dstPixelFormat))
+        {
+          // Leave the conversion to the bitmap converter
+          rBitmap.Reset(contentSpan, sizePx, pixelFormat);
+          return true;
+        }
+
+        // stb can not decode in bands (zlib and huffman decoding needs the full image), but we can still convert the decoded image into the
+        // requested pixel format and origin in one pass instead of copying it and then letting the bitmap converter flip and convert it.
+        const auto srcBitmap = ReadOnlyRawBitmap::Create(contentSpan, sizePx, pixelFormat, BitmapOrigin::UpperLeft);
+        Bitmap bitmap;
+        bitmap.Reset(sizePx, dstPixelFormat, ResolveOrigin(originHint), BitmapClearMethod::DontModify);
+        {
+          Bitmap::ScopedDirectReadWriteAccess scopedAccess(bitmap);
+          if (!RawBitmapBandConverter::TryWriteBand(scopedAccess.AsRawBitmap(), srcBitmap, 0))
+          {
+            return false;
+          }
+        }
+        rBitmap = std::move(bitmap);
         return true;
       }
       catch (const std::exception&)
@@ -287,9 +339,11 @@ namespace Fsl
     case ImageFormat::Hdr:
       return TryReadHDR(rBitmap, absolutePath, pixelFormatHint, originHint, preferredChannelOrderHint);
     case ImageFormat::Bmp:
+    case ImageFormat::Tga:
+      return TryStreamImage(rBitmap, absolutePath, imageFormat, pixelFormatHint, originHint, preferredChannelOrderHint) ||
+             TryReadImage(rBitmap, absolutePath, pixelFormatHint, originHint, preferredChannelOrderHint);
     case ImageFormat::Jpeg:
     case ImageFormat::Png:
-    case ImageFormat::Tga:
       return TryReadImage(rBitmap, absolutePath, pixelFormatHint, originHint, preferredChannelOrderHint);
     default:
       return false;
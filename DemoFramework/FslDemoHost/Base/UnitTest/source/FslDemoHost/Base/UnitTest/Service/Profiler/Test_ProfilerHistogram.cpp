@@ -0,0 +1,155 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHistogram.hpp>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_ProfilerHistogram = TestFixtureFslBase;
+
+  namespace LocalConfig
+  {
+    constexpr uint64_t MaxTrackableValue = 60 * 1000 * 1000;
+  }
+}
+
+
+TEST(Test_ProfilerHistogram, Construct)
+{
+  const ProfilerHistogram histogram(LocalConfig::MaxTrackableValue);
+
+  EXPECT_EQ(LocalConfig::MaxTrackableValue, histogram.GetMaxTrackableValue());
+  EXPECT_EQ(0u, histogram.GetCount());
+  EXPECT_EQ(0u, histogram.GetMin());
+  EXPECT_EQ(0u, histogram.GetMax());
+  EXPECT_EQ(0u, histogram.GetValueAtPercentile(50.0));
+}
+
+
+TEST(Test_ProfilerHistogram, BucketIndex_RoundTrip)
+{
+  // Every value must be inside the range of the bucket it maps to and the buckets must be continuous
+  uint32_t lastBucketIndex = 0;
+  for (uint64_t value = 0; value < (1024u * 1024u); ++value)
+  {
+    const uint32_t bucketIndex = ProfilerHistogram::ToBucketIndex(value);
+    ASSERT_LE(ProfilerHistogram::ToLowestEquivalentValue(bucketIndex), value);
+    ASSERT_GE(ProfilerHistogram::ToHighestEquivalentValue(bucketIndex), value);
+    ASSERT_TRUE(bucketIndex == lastBucketIndex || bucketIndex == (lastBucketIndex + 1u));
+    lastBucketIndex = bucketIndex;
+  }
+}
+
+
+TEST(Test_ProfilerHistogram, BucketIndex_RelativeError)
+{
+  for (uint64_t value = ProfilerHistogram::SubBucketCount; value < LocalConfig::MaxTrackableValue; value = (value * 3u) / 2u)
+  {
+    const uint32_t bucketIndex = ProfilerHistogram::ToBucketIndex(value);
+    const uint64_t bucketSize =
+      ProfilerHistogram::ToHighestEquivalentValue(bucketIndex) - ProfilerHistogram::ToLowestEquivalentValue(bucketIndex) + 1u;
+    EXPECT_LE(bucketSize * ProfilerHistogram::SubBucketHalfCount, value);
+  }
+}
+
+
+TEST(Test_ProfilerHistogram, Record_Exact)
+{
+  ProfilerHistogram histogram(LocalConfig::MaxTrackableValue);
+  for (uint64_t i = 1; i <= 100; ++i)
+  {
+    histogram.Record(i);
+  }
+
+  EXPECT_EQ(100u, histogram.GetCount());
+  EXPECT_EQ(1u, histogram.GetMin());
+  EXPECT_EQ(100u, histogram.GetMax());
+  // Values below SubBucketCount are exact
+  EXPECT_EQ(1u, histogram.GetValueAtPercentile(0.0));
+  EXPECT_EQ(50u, histogram.GetValueAtPercentile(50.0));
+  EXPECT_EQ(90u, histogram.GetValueAtPercentile(90.0));
+  EXPECT_EQ(99u, histogram.GetValueAtPercentile(99.0));
+  EXPECT_EQ(100u, histogram.GetValueAtPercentile(99.9));
+  EXPECT_EQ(100u, histogram.GetValueAtPercentile(100.0));
+}
+
+
+TEST(Test_ProfilerHistogram, Record_Outlier)
+{
+  ProfilerHistogram histogram(LocalConfig::MaxTrackableValue);
+  for (uint32_t i = 0; i < 999; ++i)
+  {
+    histogram.Record(16667);
+  }
+  histogram.Record(250000);
+
+  const uint64_t p50 = histogram.GetValueAtPercentile(50.0);
+  EXPECT_GE(p50, 16667u);
+  EXPECT_LE(p50, 16667u + (16667u / ProfilerHistogram::SubBucketHalfCount));
+  EXPECT_EQ(p50, histogram.GetValueAtPercentile(99.0));
+  EXPECT_EQ(250000u, histogram.GetValueAtPercentile(100.0));
+  EXPECT_EQ(250000u, histogram.GetMax());
+  EXPECT_EQ(16667u, histogram.GetMin());
+}
+
+
+TEST(Test_ProfilerHistogram, Record_AboveMaxTrackable)
+{
+  ProfilerHistogram histogram(1000);
+  histogram.Record(10);
+  histogram.Record(5000);
+
+  EXPECT_EQ(2u, histogram.GetCount());
+  EXPECT_EQ(5000u, histogram.GetMax());
+  EXPECT_GE(histogram.GetValueAtPercentile(100.0), 1000u);
+  EXPECT_LE(histogram.GetValueAtPercentile(100.0), 5000u);
+}
+
+
+TEST(Test_ProfilerHistogram, Clear)
+{
+  ProfilerHistogram histogram(LocalConfig::MaxTrackableValue);
+  histogram.Record(10);
+  histogram.Record(20);
+  histogram.Clear();
+
+  EXPECT_EQ(0u, histogram.GetCount());
+  EXPECT_EQ(0u, histogram.GetMin());
+  EXPECT_EQ(0u, histogram.GetMax());
+  EXPECT_EQ(0u, histogram.GetValueAtPercentile(100.0));
+
+  histogram.Record(30);
+  EXPECT_EQ(30u, histogram.GetMin());
+  EXPECT_EQ(30u, histogram.GetValueAtPercentile(50.0));
+}
@@ -0,0 +1,207 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHitchDetector.hpp>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_ProfilerHitchDetector = TestFixtureFslBase;
+
+  namespace LocalConfig
+  {
+    constexpr int64_t Median = 1000;
+  }
+
+  ProfilerFrameTime CreateFrame(const int64_t totalTime)
+  {
+    return {totalTime / 4, totalTime / 2, totalTime};
+  }
+}
+
+
+TEST(Test_ProfilerHitchDetector, Construct)
+{
+  const ProfilerHitchDetector detector(2.0f, 16);
+
+  EXPECT_EQ(2.0f, detector.GetHitchFactor());
+  EXPECT_EQ(0u, detector.GetHitchCount());
+
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  EXPECT_TRUE(hitches.empty());
+}
+
+
+TEST(Test_ProfilerHitchDetector, Construct_InvalidFactor)
+{
+  EXPECT_THROW(ProfilerHitchDetector(1.0f, 16), std::invalid_argument);
+}
+
+
+TEST(Test_ProfilerHitchDetector, Add_NoMedian)
+{
+  ProfilerHitchDetector detector(2.0f, 16);
+
+  EXPECT_FALSE(detector.Add(CreateFrame(100000), 0));
+  EXPECT_EQ(0u, detector.GetHitchCount());
+}
+
+
+TEST(Test_ProfilerHitchDetector, Add_Hitch)
+{
+  ProfilerHitchDetector detector(2.0f, 16);
+
+  for (int64_t i = 0; i < 10; ++i)
+  {
+    EXPECT_FALSE(detector.Add(CreateFrame(LocalConfig::Median + i), LocalConfig::Median));
+  }
+  // Exactly the factor is not a hitch
+  EXPECT_FALSE(detector.Add(CreateFrame(LocalConfig::Median * 2), LocalConfig::Median));
+  EXPECT_TRUE(detector.Add(CreateFrame(5000), LocalConfig::Median));
+  EXPECT_EQ(1u, detector.GetHitchCount());
+
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(1u, hitches.size());
+  EXPECT_EQ(11u, hitches[0].FrameIndex);
+  EXPECT_EQ(LocalConfig::Median, hitches[0].MedianTotalTime);
+  EXPECT_EQ(ProfilerHitch::SurroundingFrames, hitches[0].HitchOffset);
+  EXPECT_EQ(ProfilerHitch::SurroundingFrames + 1u, hitches[0].FrameCount);
+  EXPECT_EQ(5000, hitches[0].GetHitchFrame().TotalTime);
+  EXPECT_EQ(1250, hitches[0].GetHitchFrame().UpdateTime);
+  EXPECT_EQ(2500, hitches[0].GetHitchFrame().DrawTime);
+  // The frames before the hitch (oldest first)
+  EXPECT_EQ(LocalConfig::Median + 7, hitches[0].Frames[0].TotalTime);
+  EXPECT_EQ(LocalConfig::Median + 8, hitches[0].Frames[1].TotalTime);
+  EXPECT_EQ(LocalConfig::Median + 9, hitches[0].Frames[2].TotalTime);
+  EXPECT_EQ(LocalConfig::Median * 2, hitches[0].Frames[3].TotalTime);
+
+  // The frames after the hitch are filled in as they arrive
+  for (int64_t i = 0; i < 10; ++i)
+  {
+    EXPECT_FALSE(detector.Add(CreateFrame(1500 + i), LocalConfig::Median));
+  }
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(1u, hitches.size());
+  ASSERT_EQ(hitches[0].Frames.size(), hitches[0].FrameCount);
+  EXPECT_EQ(1500, hitches[0].Frames[5].TotalTime);
+  EXPECT_EQ(1503, hitches[0].Frames[8].TotalTime);
+}
+
+
+TEST(Test_ProfilerHitchDetector, Add_HitchAtStart)
+{
+  ProfilerHitchDetector detector(2.0f, 16);
+
+  EXPECT_TRUE(detector.Add(CreateFrame(5000), LocalConfig::Median));
+  for (uint32_t i = 0; i < ProfilerHitch::SurroundingFrames + 2u; ++i)
+  {
+    EXPECT_FALSE(detector.Add(CreateFrame(LocalConfig::Median), LocalConfig::Median));
+  }
+
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(1u, hitches.size());
+  EXPECT_EQ(0u, hitches[0].HitchOffset);
+  // Only the frames after the hitch are captured
+  EXPECT_EQ(ProfilerHitch::SurroundingFrames + 1u, hitches[0].FrameCount);
+}
+
+
+TEST(Test_ProfilerHitchDetector, Add_ConsecutiveHitches)
+{
+  ProfilerHitchDetector detector(2.0f, 16);
+
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    detector.Add(CreateFrame(LocalConfig::Median), LocalConfig::Median);
+  }
+  EXPECT_TRUE(detector.Add(CreateFrame(3000), LocalConfig::Median));
+  EXPECT_TRUE(detector.Add(CreateFrame(4000), LocalConfig::Median));
+  for (uint32_t i = 0; i < 10; ++i)
+  {
+    detector.Add(CreateFrame(LocalConfig::Median), LocalConfig::Median);
+  }
+
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(2u, hitches.size());
+  EXPECT_EQ(3000, hitches[0].GetHitchFrame().TotalTime);
+  EXPECT_EQ(4000, hitches[1].GetHitchFrame().TotalTime);
+  // Each hitch shows up in the surrounding frames of the other
+  EXPECT_EQ(4000, hitches[0].Frames[hitches[0].HitchOffset + 1u].TotalTime);
+  EXPECT_EQ(3000, hitches[1].Frames[hitches[1].HitchOffset - 1u].TotalTime);
+  EXPECT_EQ(hitches[0].Frames.size(), hitches[0].FrameCount);
+  EXPECT_EQ(hitches[1].Frames.size(), hitches[1].FrameCount);
+}
+
+
+TEST(Test_ProfilerHitchDetector, Add_Capacity)
+{
+  ProfilerHitchDetector detector(2.0f, 8);
+
+  for (uint32_t i = 0; i < 100; ++i)
+  {
+    detector.Add(CreateFrame((i % 4u) == 0u ? 10000 + i : LocalConfig::Median), LocalConfig::Median);
+  }
+
+  EXPECT_EQ(25u, detector.GetHitchCount());
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(8u, hitches.size());
+  // The newest are kept
+  EXPECT_EQ(96u, hitches.back().FrameIndex);
+  EXPECT_EQ(68u, hitches.front().FrameIndex);
+}
+
+
+TEST(Test_ProfilerHitchDetector, Clear)
+{
+  ProfilerHitchDetector detector(2.0f, 16);
+  detector.Add(CreateFrame(LocalConfig::Median), LocalConfig::Median);
+  detector.Add(CreateFrame(5000), LocalConfig::Median);
+  detector.Clear();
+
+  EXPECT_EQ(0u, detector.GetHitchCount());
+  std::vector<ProfilerHitch> hitches;
+  detector.GetRecentHitches(hitches);
+  EXPECT_TRUE(hitches.empty());
+
+  EXPECT_TRUE(detector.Add(CreateFrame(5000), LocalConfig::Median));
+  detector.GetRecentHitches(hitches);
+  ASSERT_EQ(1u, hitches.size());
+  EXPECT_EQ(0u, hitches[0].FrameIndex);
+  EXPECT_EQ(0u, hitches[0].HitchOffset);
+}
@@ -0,0 +1,472 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslDemoApp/Base/DemoAppConfig.hpp>
+#include <FslDemoApp/Base/Host/DemoAppSetup.hpp>
+#include <FslDemoApp/Base/Host/IDemoAppFactory.hpp>
+#include <FslDemoApp/Base/IDemoApp.hpp>
+#include <FslDemoHost/Base/DemoAppManager.hpp>
+#include <FslDemoHost/Base/Service/AppInfo/AppInfoService.hpp>
+#include <FslDemoHost/Base/Service/DemoAppControl/DemoAppControlService.hpp>
+#include <FslDemoHost/Base/Service/DemoAppControl/IDemoAppControlEx.hpp>
+#include <FslDemoHost/Base/Service/DemoPlatformControl/IDemoPlatformControl.hpp>
+#include <FslDemoHost/Base/Service/Events/EventsService.hpp>
+#include <FslDemoHost/Base/Service/Profiler/IProfilerServiceControl.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerService.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
+#include <FslDemoService/Graphics/Control/IGraphicsServiceControl.hpp>
+#include <FslService/Consumer/IServiceProvider.hpp>
+#include <FslService/Consumer/ProviderId.hpp>
+#include <FslService/Consumer/ServiceId.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <algorithm>
+#include <cmath>
+#include <initializer_list>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_DemoAppManager = TestFixtureFslBase;
+
+  namespace LocalConfig
+  {
+    constexpr uint32_t FrameCount = 3;
+    constexpr uint16_t FixedUpdatesPerSecond = 60;
+    constexpr DemoWindowMetrics WindowMetrics(PxExtent2D::Create(640, 480), Vector2(160, 160), 160);
+  }
+
+  namespace Call
+  {
+    constexpr std::string_view PreUpdate("PreUpdate");
+    constexpr std::string_view FixedUpdate("FixedUpdate");
+    constexpr std::string_view GraphicsPreUpdate("Graphics.PreUpdate");
+    constexpr std::string_view Update("Update");
+    constexpr std::string_view PostUpdate("PostUpdate");
+    constexpr std::string_view Resolve("Resolve");
+    constexpr std::string_view PipelineHandoff("PipelineHandoff");
+    constexpr std::string_view Draw("Draw");
+  }
+
+  struct CallRecord
+  {
+    std::string_view Name;
+    std::thread::id ThreadId;
+  };
+
+  //! Records the calls made to the app and the graphics service, the pipelined update calls the app from the worker thread
+  class CallLog
+  {
+    mutable std::mutex m_lock;
+    std::vector<CallRecord> m_records;
+
+  public:
+    void Add(const std::string_view name)
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      m_records.push_back({name, std::this_thread::get_id()});
+    }
+
+    std::vector<CallRecord> GetRecords() const
+    {
+      std::lock_guard<std::mutex> lock(m_lock);
+      return m_records;
+    }
+
+    std::vector<std::string_view> GetCalls(const std::initializer_list<std::string_view> filter) const
+    {
+      std::vector<std::string_view> calls;
+      for (const CallRecord& record : GetRecords())
+      {
+        if (std::find(filter.begin(), filter.end(), record.Name) != filter.end())
+        {
+          calls.push_back(record.Name);
+        }
+      }
+      return calls;
+    }
+  };
+
+  class TestServiceProvider final : public IServiceProvider
+  {
+    std::vector<std::pair<ServiceId, std::shared_ptr<IBasicService>>> m_services;
+
+  public:
+    template <typename T>
+    void Add(const std::shared_ptr<IBasicService>& service)
+    {
+      m_services.emplace_back(ServiceId(typeid(T)), service);
+    }
+
+    std::shared_ptr<IBasicService> TryGet(const ServiceId& serviceId) const final
+    {
+      auto itrFind = std::find_if(m_services.begin(), m_services.end(), [&serviceId](const auto& entry) { return entry.first == serviceId; });
+      return itrFind != m_services.end() ? itrFind->second : std::shared_ptr<IBasicService>();
+    }
+
+    std::shared_ptr<IBasicService> Get(const ServiceId& serviceId) const final
+    {
+      auto service = TryGet(serviceId);
+      if (!service)
+      {
+        throw NotFoundException("Service not found");
+      }
+      return service;
+    }
+
+    std::shared_ptr<IBasicService> TryGet(const ServiceId& serviceId, const ProviderId& /*providerId*/) const final
+    {
+      return TryGet(serviceId);
+    }
+
+    std::shared_ptr<IBasicService> Get(const ServiceId& serviceId, const ProviderId& /*providerId*/) const final
+    {
+      return Get(serviceId);
+    }
+
+    void Get(BasicServiceDeque& rServices, const ServiceId& serviceId) const final
+    {
+      for (const auto& entry : m_services)
+      {
+        if (entry.first == serviceId)
+        {
+          rServices.push_back(entry.second);
+        }
+      }
+    }
+  };
+
+  class TestDemoPlatformControl final
+    : public ThreadLocalService
+    , public IDemoPlatformControl
+  {
+    bool m_hasExitRequest{false};
+
+  public:
+    explicit TestDemoPlatformControl(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+    {
+    }
+
+    void RequestExit() final
+    {
+      m_hasExitRequest = true;
+    }
+
+    bool HasExitRequest() const final
+    {
+      return m_hasExitRequest;
+    }
+  };
+
+  class TestGraphicsServiceControl final
+    : public ThreadLocalService
+    , public IGraphicsServiceControl
+  {
+    std::shared_ptr<CallLog> m_log;
+
+  public:
+    TestGraphicsServiceControl(const ServiceProvider& serviceProvider, std::shared_ptr<CallLog> log)
+      : ThreadLocalService(serviceProvider)
+      , m_log(std::move(log))
+    {
+    }
+
+    void ClearActiveApi() final
+    {
+    }
+
+    void SetActiveApi(const DemoHostFeature& /*activeAPI*/) final
+    {
+    }
+
+    void SetWindowMetrics(const DemoWindowMetrics& /*windowMetrics*/) final
+    {
+    }
+
+    void PreUpdate() final
+    {
+      m_log->Add(Call::GraphicsPreUpdate);
+    }
+  };
+
+  class TestDemoApp final : public IDemoApp
+  {
+    std::shared_ptr<CallLog> m_log;
+
+  public:
+    explicit TestDemoApp(std::shared_ptr<CallLog> log)
+      : m_log(std::move(log))
+    {
+    }
+
+    void _PostConstruct() final
+    {
+      m_log->Add("PostConstruct");
+    }
+
+    void _PreDestruct() final
+    {
+      m_log->Add("PreDestruct");
+    }
+
+    void _Begin() final
+    {
+      m_log->Add("Begin");
+    }
+
+    void _OnEvent(IEvent* const /*pEvent*/) final
+    {
+    }
+
+    void _ConfigurationChanged(const DemoWindowMetrics& /*windowMetrics*/) final
+    {
+    }
+
+    void _PreUpdate(const DemoTime& /*demoTime*/) final
+    {
+      m_log->Add(Call::PreUpdate);
+    }
+
+    void _FixedUpdate(const DemoTime& /*demoTime*/) final
+    {
+      m_log->Add(Call::FixedUpdate);
+    }
+
+    void _Update(const DemoTime& /*demoTime*/) final
+    {
+      m_log->Add(Call::Update);
+    }
+
+    void _PostUpdate(const DemoTime& /*demoTime*/) final
+    {
+      m_log->Add(Call::PostUpdate);
+    }
+
+    void _Resolve(const DemoTime& /*demoTime*/) final
+    {
+      m_log->Add(Call::Resolve);
+    }
+
+    void _PipelineHandoff() final
+    {
+      m_log->Add(Call::PipelineHandoff);
+    }
+
+    AppDrawResult _TryPrepareDraw(const FrameInfo& /*frameInfo*/) final
+    {
+      return AppDrawResult::Completed;
+    }
+
+    void _BeginDraw(const FrameInfo& /*frameInfo*/) final
+    {
+    }
+
+    void _Draw(const FrameInfo& /*frameInfo*/) final
+    {
+      m_log->Add(Call::Draw);
+    }
+
+    void _EndDraw(const FrameInfo& /*frameInfo*/) final
+    {
+    }
+
+    void _OnDrawSkipped(const FrameInfo& /*frameInfo*/) final
+    {
+    }
+
+    AppDrawResult _TrySwapBuffers(const FrameInfo& /*frameInfo*/) final
+    {
+      return AppDrawResult::Completed;
+    }
+
+    void _End() final
+    {
+      m_log->Add("End");
+    }
+  };
+
+  class TestDemoAppFactory final : public IDemoAppFactory
+  {
+    std::shared_ptr<CallLog> m_log;
+
+  public:
+    explicit TestDemoAppFactory(std::shared_ptr<CallLog> log)
+      : m_log(std::move(log))
+    {
+    }
+
+    std::shared_ptr<IDemoApp> Allocate(const DemoAppConfig& /*config*/) final
+    {
+      return std::make_shared<TestDemoApp>(m_log);
+    }
+  };
+
+  //! The services needed by the DemoAppManager, the graphics service records its pre-update calls in the log
+  struct TestHost
+  {
+    std::shared_ptr<TestServiceProvider> Provider;
+
+    explicit TestHost(const std::shared_ptr<CallLog>& log)
+      : Provider(std::make_shared<TestServiceProvider>())
+    {
+      const ServiceProvider serviceProvider(Provider);
+      auto events = std::make_shared<EventsService>(serviceProvider);
+      Provider->Add<IEventService>(events);
+      Provider->Add<IEventPoster>(events);
+      Provider->Add<IDemoPlatformControl>(std::make_shared<TestDemoPlatformControl>(serviceProvider));
+      auto demoAppControl = std::make_shared<DemoAppControlService>(serviceProvider, 0);
+      Provider->Add<IDemoAppControl>(demoAppControl);
+      Provider->Add<IDemoAppControlEx>(demoAppControl);
+      auto profiler = std::make_shared<ProfilerService>(serviceProvider, std::make_shared<ProfilerServiceOptionParser>());
+      Provider->Add<IProfilerService>(profiler);
+      Provider->Add<IProfilerServiceControl>(profiler);
+      auto appInfo = std::make_shared<AppInfoService>(serviceProvider);
+      Provider->Add<IAppInfoControlService>(appInfo);
+      Provider->Add<IGraphicsServiceControl>(std::make_shared<TestGraphicsServiceControl>(serviceProvider, log));
+    }
+  };
+
+  TimeSpan CalcFixedUpdateTime()
+  {
+    return TimeSpan(static_cast<int64_t>(
+      std::round(static_cast<double>(TimeSpan::TicksPerSecond) / static_cast<double>(LocalConfig::FixedUpdatesPerSecond))));
+  }
+
+  //! Run the frames the same way the DemoHostManager does
+  std::shared_ptr<CallLog> RunFrames(const bool pipelinedUpdate, const uint32_t frameCount)
+  {
+    auto log = std::make_shared<CallLog>();
+    TestHost host(log);
+
+    CustomDemoAppConfig customConfig;
+    customConfig.PipelinedUpdate = pipelinedUpdate;
+    DemoAppSetup setup("Test", customConfig, std::make_shared<TestDemoAppFactory>(log));
+    const DemoAppConfig appConfig(nullptr, ExceptionMessageFormatter(), LocalConfig::WindowMetrics, ServiceProvider(host.Provider), customConfig);
+
+    // Force the update time to one fixed update per frame so the call sequence is deterministic
+    DemoAppManager manager(std::move(setup), appConfig, false, LogStatsMode::Disabled, DemoAppStatsFlags(), false, false, CalcFixedUpdateTime(),
+                           false);
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+      const DemoAppManagerProcessResult result = manager.Process(LocalConfig::WindowMetrics, false);
+      EXPECT_EQ(DemoAppManagerProcessResult::Command::Draw, result.Cmd);
+      if (result.Cmd == DemoAppManagerProcessResult::Command::Draw)
+      {
+        EXPECT_EQ(AppDrawResult::Completed, manager.TryDraw());
+        manager.OnFrameSwapCompleted();
+      }
+      manager.ProcessDone();
+    }
+    return log;
+  }
+
+  std::vector<std::string_view> GetUpdateCalls(const CallLog& log)
+  {
+    return log.GetCalls(
+      {Call::PreUpdate, Call::FixedUpdate, Call::GraphicsPreUpdate, Call::Update, Call::PostUpdate, Call::Resolve, Call::PipelineHandoff});
+  }
+
+  std::vector<std::string_view> CreateExpectedUpdateCalls(const uint32_t frameCount)
+  {
+    std::vector<std::string_view> calls;
+    for (uint32_t i = 0; i < frameCount; ++i)
+    {
+      calls.insert(calls.end(), {Call::PreUpdate, Call::FixedUpdate, Call::GraphicsPreUpdate, Call::Update, Call::PostUpdate, Call::Resolve,
+                                 Call::PipelineHandoff});
+    }
+    return calls;
+  }
+}
+
+
+TEST_F(Test_DemoAppManager, Sequential_CallOrder)
+{
+  const auto log = RunFrames(false, LocalConfig::FrameCount);
+
+  EXPECT_EQ(CreateExpectedUpdateCalls(LocalConfig::FrameCount), GetUpdateCalls(*log));
+
+  // Every frame draws the state that was handed off by its own update
+  const std::vector<std::string_view> expectedDrawCalls = {Call::PipelineHandoff, Call::Draw, Call::PipelineHandoff,
+                                                           Call::Draw,            Call::PipelineHandoff, Call::Draw};
+  EXPECT_EQ(expectedDrawCalls, log->GetCalls({Call::PipelineHandoff, Call::Draw}));
+
+  const std::thread::id mainThreadId = std::this_thread::get_id();
+  for (const CallRecord& record : log->GetRecords())
+  {
+    EXPECT_EQ(mainThreadId, record.ThreadId);
+  }
+}
+
+
+TEST_F(Test_DemoAppManager, Pipelined_CallOrder)
+{
+  const auto log = RunFrames(true, LocalConfig::FrameCount);
+
+  // The pre, fixed and graphics service pre-updates are called in the same order as the sequential frame loop
+  EXPECT_EQ(CreateExpectedUpdateCalls(LocalConfig::FrameCount), GetUpdateCalls(*log));
+
+  // The first update is handed off before the first draw, after that the draw renders the previous update while the next one is running
+  const std::vector<std::string_view> expectedDrawCalls = {Call::PipelineHandoff, Call::Draw, Call::Draw,
+                                                           Call::PipelineHandoff, Call::Draw, Call::PipelineHandoff};
+  EXPECT_EQ(expectedDrawCalls, log->GetCalls({Call::PipelineHandoff, Call::Draw}));
+
+  // Only Update, PostUpdate and Resolve are moved to the worker (except for the very first update that runs inline)
+  const std::thread::id mainThreadId = std::this_thread::get_id();
+  uint32_t updateCount = 0;
+  uint32_t workerCallCount = 0;
+  for (const CallRecord& record : log->GetRecords())
+  {
+    const bool isWorkerCall = record.Name == Call::Update || record.Name == Call::PostUpdate || record.Name == Call::Resolve;
+    if (record.Name == Call::Update)
+    {
+      ++updateCount;
+    }
+    if (isWorkerCall && updateCount > 1u)
+    {
+      EXPECT_NE(mainThreadId, record.ThreadId);
+      ++workerCallCount;
+    }
+    else
+    {
+      EXPECT_EQ(mainThreadId, record.ThreadId);
+    }
+  }
+  EXPECT_EQ((LocalConfig::FrameCount - 1u) * 3u, workerCallCount);
+}
@@ -33,6 +33,7 @@
 
 #include <FslBase/Math/Point2.hpp>
 #include <FslBase/System/HighResolutionTimer.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
 #include <FslDemoApp/Base/AppDrawResult.hpp>
 #include <FslDemoApp/Base/DemoAppConfig.hpp>
 #include <FslDemoApp/Base/DemoAppStatsFlags.hpp>
@@ -43,6 +44,7 @@
 #include <FslDemoHost/Base/DemoAppTiming.hpp>
 #include <FslDemoHost/Base/DemoState.hpp>
 #include <FslDemoHost/Base/LogStatsMode.hpp>
+#include <FslDemoService/Profiler/ScopedProfilerCustomCounterHandle.hpp>
 #include <memory>
 #include <utility>
 
@@ -50,12 +52,12 @@ namespace Fsl
 {
   class DemoAppManagerEventListener;
   class DemoAppProfilerOverlay;
+  class DemoAppUpdateWorker;
   class IDemoAppControlEx;
   class ICpuStatsService;
   class IGraphicsServiceControl;
   class IProfilerService;
   class IProfilerServiceControl;
-  struct TimeSpan;
 
   class DemoAppManager
   {
@@ -63,10 +65,13 @@ namespace Fsl
     {
       std::shared_ptr<IDemoApp> DemoApp;
       uint32_t FrameIndex{0};
+      //! The update stage runs on the pipeline worker while the previous frame is drawn
+      bool Pipelined{false};
 
       AppRecord() = default;
-      explicit AppRecord(std::shared_ptr<IDemoApp> demoApp)
+      explicit AppRecord(std::shared_ptr<IDemoApp> demoApp, const bool pipelined)
         : DemoApp(std::move(demoApp))
+        , Pipelined(pipelined)
       {
       }
     };
@@ -88,8 +93,24 @@ namespace Fsl
     {
       TickCount TimeBeforeUpdate{0u};
       TickCount TimeAfterUpdate{0u};
+      TickCount TimeBeforeDraw{0u};
       TickCount TimeAfterDraw{0u};
       TickCount LastFrameSwapCompletedTime{0};
+      //! Time the main thread was blocked waiting for the pipelined update to complete
+      TimeSpan PipelineWait;
+      //! Time spent in the app handoff
+      TimeSpan PipelineHandoff;
+    };
+
+    struct Pipeline
+    {
+      std::unique_ptr<DemoAppUpdateWorker> Worker;
+      //! The input for the update stage that runs on the worker (only modified while the worker is idle)
+      DemoTime UpdateTime;
+      //! True once the first update has been published to the draw stage
+      bool HasPublishedState{false};
+      ScopedProfilerCustomCounterHandle hCounterWait;
+      ScopedProfilerCustomCounterHandle hCounterHandoff;
     };
 
     std::unique_ptr<DemoAppProfilerOverlay> m_demoAppProfilerOverlay;
@@ -115,6 +136,7 @@ namespace Fsl
     bool m_useFirewall;
 
     AppRecord m_record;
+    Pipeline m_pipeline;
 
   public:
     DemoAppManager(DemoAppSetup demoAppSetup, const DemoAppConfig& demoAppConfig, const bool enableStats, const LogStatsMode logStatsMode,
@@ -162,6 +184,14 @@ namespace Fsl
     void ManageAppState(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedApp);
     void ResetTimer();
 
+    //! @brief Run the pre and fixed updates and then start the rest of the update stage of the pipelined frame loop
+    //!        (the very first update of a app runs inline)
+    void BeginPipelinedUpdate(const DemoTime& updateTime);
+    //! @brief Wait for any in flight pipelined update and hand the result off to the app
+    void EndPipelinedUpdate();
+    //! @brief Executes the Update, PostUpdate and Resolve part of the pipelined frame loop, this normally runs on the worker thread
+    void RunPipelinedUpdate();
+
     void DoShutdownAppNow();
   };
 }
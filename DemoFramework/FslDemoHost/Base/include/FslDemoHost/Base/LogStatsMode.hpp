@@ -41,7 +41,9 @@ namespace Fsl
     //! Log the latest stats
     Latest,
     //! Log the average stats over the last 60 swaps.
-    Average
+    Average,
+    //! Only log the frame time percentiles and hitches on exit (the other modes do this as well)
+    Summary
   };
 }
 
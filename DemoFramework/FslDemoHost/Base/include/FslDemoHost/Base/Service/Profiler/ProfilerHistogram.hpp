@@ -0,0 +1,129 @@
+#ifndef FSLDEMOHOST_BASE_SERVICE_PROFILER_PROFILERHISTOGRAM_HPP
+#define FSLDEMOHOST_BASE_SERVICE_PROFILER_PROFILERHISTOGRAM_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <bit>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Log-linear (HDR) histogram of non negative integer values.
+  //!        Values below SubBucketCount are recorded exactly, larger values are recorded with a relative error of at most 1/SubBucketHalfCount.
+  //!        This keeps the memory use and the cost of a percentile query fixed no matter how many values are recorded.
+  class ProfilerHistogram
+  {
+  public:
+    static constexpr uint32_t SubBucketBits = 7;
+    static constexpr uint32_t SubBucketCount = 1u << SubBucketBits;
+    static constexpr uint32_t SubBucketHalfCount = SubBucketCount / 2u;
+
+  private:
+    std::vector<uint64_t> m_counts;
+    uint64_t m_maxTrackableValue;
+    uint64_t m_totalCount{0};
+    uint64_t m_minValue{0};
+    uint64_t m_maxValue{0};
+
+  public:
+    //! @param maxTrackableValue values above this are recorded as this value (but the exact maximum is still tracked).
+    explicit ProfilerHistogram(const uint64_t maxTrackableValue);
+
+    void Clear() noexcept;
+
+    void Record(const uint64_t value) noexcept;
+
+    uint64_t GetMaxTrackableValue() const noexcept
+    {
+      return m_maxTrackableValue;
+    }
+
+    uint64_t GetCount() const noexcept
+    {
+      return m_totalCount;
+    }
+
+    //! @brief Get the exact minimum value recorded (zero if empty)
+    uint64_t GetMin() const noexcept
+    {
+      return m_minValue;
+    }
+
+    //! @brief Get the exact maximum value recorded (zero if empty)
+    uint64_t GetMax() const noexcept
+    {
+      return m_maxValue;
+    }
+
+    //! @brief Get the value that the given percentage of the recorded values are less than or equal to.
+    //! @param percentile 0 to 100
+    //! @return the highest value equivalent to the bucket the percentile falls in (capped to GetMax), zero if empty.
+    uint64_t GetValueAtPercentile(const double percentile) const noexcept;
+
+    static constexpr uint32_t ToBucketIndex(const uint64_t value) noexcept
+    {
+      if (value < SubBucketCount)
+      {
+        return static_cast<uint32_t>(value);
+      }
+      // Each power of two range above SubBucketCount is split into SubBucketHalfCount buckets
+      const auto shift = static_cast<uint32_t>(std::bit_width(value)) - SubBucketBits;
+      return SubBucketCount + ((shift - 1u) * SubBucketHalfCount) + static_cast<uint32_t>((value >> shift) - SubBucketHalfCount);
+    }
+
+    static constexpr uint64_t ToLowestEquivalentValue(const uint32_t bucketIndex) noexcept
+    {
+      if (bucketIndex < SubBucketCount)
+      {
+        return bucketIndex;
+      }
+      const uint32_t relativeIndex = bucketIndex - SubBucketCount;
+      const uint32_t shift = (relativeIndex / SubBucketHalfCount) + 1u;
+      const uint64_t subBucket = (relativeIndex % SubBucketHalfCount) + SubBucketHalfCount;
+      return subBucket << shift;
+    }
+
+    static constexpr uint64_t ToHighestEquivalentValue(const uint32_t bucketIndex) noexcept
+    {
+      if (bucketIndex < SubBucketCount)
+      {
+        return bucketIndex;
+      }
+      const uint32_t relativeIndex = bucketIndex - SubBucketCount;
+      const uint32_t shift = (relativeIndex / SubBucketHalfCount) + 1u;
+      const uint64_t subBucket = (relativeIndex % SubBucketHalfCount) + SubBucketHalfCount;
+      return ((subBucket + 1u) << shift) - 1u;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,82 @@
+#ifndef FSLDEMOHOST_BASE_SERVICE_PROFILER_PROFILERHITCHDETECTOR_HPP
+#define FSLDEMOHOST_BASE_SERVICE_PROFILER_PROFILERHITCHDETECTOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/CircularFixedSizeBuffer.hpp>
+#include <FslDemoService/Profiler/ProfilerFrameTime.hpp>
+#include <FslDemoService/Profiler/ProfilerHitch.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief Detects frames that take a lot longer than the median frame and captures the frames around them.
+  //! @note  A hitch is recorded as soon as it is detected, the frames after it are filled in as they are added.
+  class ProfilerHitchDetector
+  {
+    //! The frames before the current one
+    CircularFixedSizeBuffer<ProfilerFrameTime> m_history;
+    //! The most recent hitches, the last m_pendingCount entries are still waiting for the frames after the hitch
+    CircularFixedSizeBuffer<ProfilerHitch> m_hitches;
+    uint32_t m_pendingCount{0};
+    float m_hitchFactor;
+    uint64_t m_frameIndex{0};
+    uint64_t m_hitchCount{0};
+
+  public:
+    //! @param hitchFactor a frame that takes more than hitchFactor * median is considered a hitch.
+    //! @param hitchCapacity the number of recent hitches that are kept.
+    ProfilerHitchDetector(const float hitchFactor, const uint32_t hitchCapacity);
+
+    void Clear() noexcept;
+
+    //! @brief Add a frame
+    //! @param medianTotalTime the median total frame time to compare against, no hitch detection is done if it's <= 0.
+    //! @return true if the frame was detected as a hitch
+    bool Add(const ProfilerFrameTime& frameTime, const int64_t medianTotalTime);
+
+    float GetHitchFactor() const noexcept
+    {
+      return m_hitchFactor;
+    }
+
+    //! @brief Get the total number of hitches detected
+    uint64_t GetHitchCount() const noexcept
+    {
+      return m_hitchCount;
+    }
+
+    //! @brief Get the most recent hitches (oldest first)
+    void GetRecentHitches(std::vector<ProfilerHitch>& rHitches) const;
+  };
+}
+
+#endif
@@ -32,7 +32,11 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Collections/CircularFixedSizeBuffer.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Trace/TraceEvent.hpp>
 #include <FslDemoHost/Base/Service/Profiler/IProfilerServiceControl.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHistogram.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHitchDetector.hpp>
 #include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
@@ -74,12 +78,39 @@ namespace Fsl
       }
     };
 
+    struct FrameTimeHistograms
+    {
+      ProfilerHistogram UpdateTime;
+      ProfilerHistogram DrawTime;
+      ProfilerHistogram TotalTime;
+
+      explicit FrameTimeHistograms(const uint64_t maxTrackableValue)
+        : UpdateTime(maxTrackableValue)
+        , DrawTime(maxTrackableValue)
+        , TotalTime(maxTrackableValue)
+      {
+      }
+    };
+
     std::size_t m_maxCapacity;
     CircularFixedSizeBuffer<ProfilerRecord> m_entries;
     ProfilerRecord m_combinedTime;
     std::vector<CustomCounter> m_customCounters;
     int32_t m_customCounterCount;
     uint32_t m_customConfigurationRevision;
+    uint32_t m_statsWindow;
+    FrameTimeHistograms m_windowHistograms;
+    FrameTimeHistograms m_totalHistograms;
+    ProfilerFrameTimeStats m_windowStats;
+    //! The median total frame time the hitch detection compares against (zero until enough frames have been seen)
+    int64_t m_medianTotalTime{0};
+    ProfilerHitchDetector m_hitchDetector;
+    IO::Path m_traceFile;
+    //! The most recent trace events, this is what gets exported
+    CircularFixedSizeBuffer<TraceEvent> m_traceHistory;
+    std::vector<TraceEvent> m_traceScratchpad;
+    uint64_t m_traceDroppedEvents{0};
+    bool m_traceExportRequested{false};
 
   public:
     ProfilerService(const ServiceProvider& serviceProvider, const std::shared_ptr<ProfilerServiceOptionParser>& optionParser);
@@ -88,6 +119,10 @@ namespace Fsl
     // From IProfilerService
     ProfilerFrameTime GetLastFrameTime() const final;
     ProfilerFrameTime GetAverageFrameTime() const final;
+    ProfilerFrameTimeStats GetWindowFrameTimeStats() const final;
+    ProfilerFrameTimeStats GetTotalFrameTimeStats() const final;
+    uint64_t GetHitchCount() const final;
+    void GetRecentHitches(std::vector<ProfilerHitch>& rHitches) const final;
     int32_t GetCustomCounterCapacity() const final;
     int32_t GetCustomCounterCount() const final;
     ProfilerCustomCounterHandle GetCustomCounterHandle(const int32_t index) const final;
@@ -99,12 +134,16 @@ namespace Fsl
     ProfilerCustomCounterDesc GetDescription(const ProfilerCustomCounterHandle& handle) const final;
     uint32_t GetCustomConfigurationRevision() const final;
     bool IsValidHandle(const ProfilerCustomCounterHandle& handle) const final;
+    void RequestTraceExport() final;
 
     // From IProfilerServiceControl
     void AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime) final;
 
   private:
     inline int32_t ConvertHandleToIndex(const ProfilerCustomCounterHandle& handle) const;
+    void AddFrameTimeStats(const ProfilerFrameTime& frameTime);
+    void CollectTrace();
+    void ExportTrace();
   };
 }
 
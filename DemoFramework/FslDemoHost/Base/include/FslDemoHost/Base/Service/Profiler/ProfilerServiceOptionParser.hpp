@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/IO/Path.hpp>
 #include <FslService/Impl/AServiceOptionParser.hpp>
 
 namespace Fsl
@@ -38,6 +39,10 @@ namespace Fsl
   class ProfilerServiceOptionParser final : public AServiceOptionParser
   {
     uint32_t m_averageEntries;
+    IO::Path m_traceFile;
+    uint32_t m_traceCapacity;
+    uint32_t m_statsWindow;
+    float m_hitchFactor;
 
   public:
     ProfilerServiceOptionParser();
@@ -56,6 +61,30 @@ namespace Fsl
     {
       return m_averageEntries;
     }
+
+    //! @brief Get the file the recorded trace should be written to (empty if tracing is disabled).
+    const IO::Path& GetTraceFile() const
+    {
+      return m_traceFile;
+    }
+
+    //! @brief Get the maximum number of trace events that are kept for the export.
+    uint32_t GetTraceCapacity() const
+    {
+      return m_traceCapacity;
+    }
+
+    //! @brief Get the number of frames in each frame time percentile window.
+    uint32_t GetStatsWindow() const
+    {
+      return m_statsWindow;
+    }
+
+    //! @brief Get how many times longer than the median frame time a frame has to be to be considered a hitch.
+    float GetHitchFactor() const
+    {
+      return m_hitchFactor;
+    }
   };
 }
 
@@ -33,6 +33,7 @@
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/Time/TimeSpanUtil.hpp>
+#include <FslBase/Trace/Trace.hpp>
 #include <FslDemoApp/Base/DemoAppFirewall.hpp>
 #include <FslDemoApp/Base/FrameInfo.hpp>
 #include <FslDemoApp/Base/Host/IDemoAppFactory.hpp>
@@ -46,16 +47,24 @@
 #include <FslDemoHost/Base/Service/Profiler/IProfilerServiceControl.hpp>
 #include <FslDemoService/CpuStats/ICpuStatsService.hpp>
 #include <FslDemoService/Graphics/Control/IGraphicsServiceControl.hpp>
+#include <FslDemoService/Profiler/DefaultProfilerColors.hpp>
 #include <FslDemoService/Profiler/IProfilerService.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <cassert>
 #include <memory>
 #include <utility>
+#include <vector>
+#include "DemoAppUpdateWorker.hpp"
 
 namespace Fsl
 {
   namespace
   {
+    namespace LocalConfig
+    {
+      constexpr int32_t PipelineCounterMaxMicroseconds = 16667;
+    }
+
     constexpr inline bool CheckRestartFlags(const CustomDemoAppConfigRestartFlags restartFlags, const DemoWindowMetrics& newWindowMetrics,
                                             const DemoWindowMetrics& oldWindowMetrics)
     {
@@ -64,6 +73,41 @@ namespace Fsl
              (CustomDemoAppConfigRestartFlagsUtil::IsFlagged(restartFlags, CustomDemoAppConfigRestartFlags::DpiChange) &&
               !newWindowMetrics.IsEqualDpi(oldWindowMetrics));
     }
+
+    void LogPercentiles(const char* const pszName, const ProfilerPercentiles& percentiles)
+    {
+      FSLLOG3_INFO("{}: p50: {} p90: {} p99: {} p99.9: {} max: {}", pszName, percentiles.P50, percentiles.P90, percentiles.P99, percentiles.P999,
+                   percentiles.Max);
+    }
+
+    void LogFrameTimeSummary(const IProfilerService& profilerService)
+    {
+      const ProfilerFrameTimeStats stats = profilerService.GetTotalFrameTimeStats();
+      if (stats.TotalTime.SampleCount <= 0u)
+      {
+        return;
+      }
+      FSLLOG3_INFO("Frame time percentiles over {} frames (microseconds)", stats.TotalTime.SampleCount);
+      LogPercentiles("All", stats.TotalTime);
+      LogPercentiles("Update", stats.UpdateTime);
+      LogPercentiles("Draw", stats.DrawTime);
+
+      std::vector<ProfilerHitch> hitches;
+      profilerService.GetRecentHitches(hitches);
+      FSLLOG3_INFO("Hitches: {}", profilerService.GetHitchCount());
+      for (const ProfilerHitch& hitch : hitches)
+      {
+        const ProfilerFrameTime& hitchFrame = hitch.GetHitchFrame();
+        FSLLOG3_INFO("- Frame {}: All: {} Update: {} Draw: {} (median: {})", hitch.FrameIndex, hitchFrame.TotalTime, hitchFrame.UpdateTime,
+                     hitchFrame.DrawTime, hitch.MedianTotalTime);
+        for (uint32_t i = 0; i < hitch.FrameCount; ++i)
+        {
+          const int32_t relativeIndex = static_cast<int32_t>(i) - static_cast<int32_t>(hitch.HitchOffset);
+          FSLLOG3_INFO("  {:+}: All: {} Update: {} Draw: {}", relativeIndex, hitch.Frames[i].TotalTime, hitch.Frames[i].UpdateTime,
+                       hitch.Frames[i].DrawTime);
+        }
+      }
+    }
   }
 
   DemoAppManager::DemoAppManager(DemoAppSetup demoAppSetup, const DemoAppConfig& demoAppConfig, const bool enableStats,
@@ -114,6 +158,10 @@ namespace Fsl
     try
     {
       DoShutdownAppNow();
+      if (m_logStatsMode != LogStatsMode::Disabled && m_profilerService)
+      {
+        LogFrameTimeSummary(*m_profilerService);
+      }
     }
     catch (const std::exception& ex)
     {
@@ -146,6 +194,10 @@ namespace Fsl
 
   DemoAppManagerProcessResult DemoAppManager::Process(const DemoWindowMetrics& windowMetrics, const bool isConsoleBasedApp)
   {
+    FSL_TRACE_ZONE("DemoApp", "Process");
+    // Normally the pipelined update has already been completed by OnFrameSwapCompleted, but a failed draw or swap skips that.
+    EndPipelinedUpdate();
+
     if (ManageExitRequests(true))
     {
       return DemoAppManagerProcessResult(DemoAppManagerProcessResult::Command::SkipDraw);
@@ -190,13 +242,15 @@ namespace Fsl
       {
         m_demoAppControl->SetTimeStepMode(TimeStepMode::Paused);
       }
-      const DemoTime currentUpdateTime = m_appTiming.GetUpdateTime();
-
-      m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
+      // The pipelined update is started at the end of Process once the host is done accessing the app control state
+      if (!m_record.Pipelined)
       {
+        const DemoTime currentUpdateTime = m_appTiming.GetUpdateTime();
+        m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
         m_record.DemoApp->_PreUpdate(currentUpdateTime);
 
         {    // Run all missing fixed updates
+          FSL_TRACE_ZONE("DemoApp", "FixedUpdate");
           std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
           while (fixedTime.has_value())
           {
@@ -210,23 +264,34 @@ namespace Fsl
           m_graphicsService->PreUpdate();
         }
 
-        m_record.DemoApp->_Update(currentUpdateTime);
-        m_record.DemoApp->_PostUpdate(currentUpdateTime);
-        m_record.DemoApp->_Resolve(currentUpdateTime);
+        {
+          FSL_TRACE_ZONE("DemoApp", "Update");
+          m_record.DemoApp->_Update(currentUpdateTime);
+          m_record.DemoApp->_PostUpdate(currentUpdateTime);
+          m_record.DemoApp->_Resolve(currentUpdateTime);
+        }
+        m_record.DemoApp->_PipelineHandoff();
+        m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
       }
-      m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
     }
 
     ManageExitRequests(false);
     CacheState();
 
     // Let the caller know update has been called
-    return ProcessOnDemandRendering();
+    const DemoAppManagerProcessResult result = ProcessOnDemandRendering();
+    if (m_record.Pipelined)
+    {
+      BeginPipelinedUpdate(m_appTiming.GetUpdateTime());
+    }
+    return result;
   }
 
   AppDrawResult DemoAppManager::TryDraw()
   {
+    FSL_TRACE_ZONE("DemoApp", "Draw");
     FrameInfo frameInfo(m_record.FrameIndex, m_currentDemoTimeDraw);
+    m_stats.TimeBeforeDraw = m_timer.GetTimestamp();
 
     auto result = m_record.DemoApp->_TryPrepareDraw(frameInfo);
     if (result != AppDrawResult::Completed)
@@ -254,7 +319,11 @@ namespace Fsl
       m_demoAppProfilerOverlay->Draw(m_demoAppConfig.WindowMetrics);
     }
 
-    ManageExitRequests(false);
+    // While a pipelined update is in flight the app control state belongs to the update, the next Process will pick up any exit request
+    if (!m_pipeline.Worker || !m_pipeline.Worker->IsBusy())
+    {
+      ManageExitRequests(false);
+    }
 
     return result;
   }
@@ -276,6 +345,7 @@ namespace Fsl
     {
       return AppDrawResult::Completed;
     }
+    FSL_TRACE_ZONE("DemoApp", "SwapBuffers");
     FrameInfo frameInfo(m_record.FrameIndex, m_currentDemoTimeDraw);
 
     AppDrawResult result = m_record.DemoApp->_TrySwapBuffers(frameInfo);
@@ -304,12 +374,17 @@ namespace Fsl
 
   void DemoAppManager::OnFrameSwapCompleted()
   {
+    EndPipelinedUpdate();
+    FSL_TRACE_INSTANT("DemoApp", "FrameSwapCompleted");
+
     if (m_state == DemoState::Running)
     {
       UpdateAppTimers();
 
       const auto deltaTimeUpdate = m_stats.TimeAfterUpdate - m_stats.TimeBeforeUpdate;
-      const auto deltaTimeDraw = m_stats.TimeAfterDraw - m_stats.TimeAfterUpdate;
+      // When pipelined the update runs concurrently with the draw so the draw has to be measured on its own
+      const auto deltaTimeDraw =
+        m_record.Pipelined ? m_stats.TimeAfterDraw - m_stats.TimeBeforeDraw : m_stats.TimeAfterDraw - m_stats.TimeAfterUpdate;
 
       const auto timeNow = m_timer.GetTimestamp();
       const auto deltaFrameSwapCompletedTime = timeNow - m_stats.LastFrameSwapCompletedTime;
@@ -318,6 +393,11 @@ namespace Fsl
       m_profilerServiceControl->AddFrameTimes(TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaTimeUpdate),
                                               TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaTimeDraw),
                                               TimeSpanUtil::ToClampedMicrosecondsUInt64(deltaFrameSwapCompletedTime));
+      if (m_record.Pipelined && m_pipeline.hCounterWait.IsValid())
+      {
+        m_profilerService->Set(m_pipeline.hCounterWait, TimeSpanUtil::ToClampedMicrosecondsInt32(m_stats.PipelineWait));
+        m_profilerService->Set(m_pipeline.hCounterHandoff, TimeSpanUtil::ToClampedMicrosecondsInt32(m_stats.PipelineHandoff));
+      }
 
       const auto averageTime = m_profilerService->GetAverageFrameTime();
       const auto averageTotalTime = TimeSpanUtil::FromMicroseconds(averageTime.TotalTime);
@@ -365,6 +445,8 @@ namespace Fsl
 
   void DemoAppManager::OnDemandDrawSkipped()
   {
+    EndPipelinedUpdate();
+
     if (m_state == DemoState::Running)
     {
       UpdateAppTimers();
@@ -374,6 +456,8 @@ namespace Fsl
 
   void DemoAppManager::ProcessDone()
   {
+    EndPipelinedUpdate();
+
     if (m_state == DemoState::Running)
     {
       if (m_record.DemoApp)
@@ -533,11 +617,23 @@ namespace Fsl
       }
       if (!applyFirewall && ((windowMetrics.ExtentPx != PxExtent2D::Create(0, 0)) || isConsoleBasedApp))
       {
-        m_record = AppRecord(m_demoAppSetup.Factory->Allocate(m_demoAppConfig));
+        m_record = AppRecord(m_demoAppSetup.Factory->Allocate(m_demoAppConfig), m_demoAppSetup.CustomAppConfig.PipelinedUpdate);
       }
       else
       {
-        m_record = AppRecord(std::make_shared<DemoAppFirewall>(m_demoAppConfig, m_demoAppSetup.Factory, isConsoleBasedApp));
+        // The firewall can dispose the app from inside the update stage, so it always runs the app sequentially
+        m_record = AppRecord(std::make_shared<DemoAppFirewall>(m_demoAppConfig, m_demoAppSetup.Factory, isConsoleBasedApp), false);
+      }
+      m_pipeline.HasPublishedState = false;
+      if (m_record.Pipelined && !m_pipeline.Worker)
+      {
+        m_pipeline.Worker = std::make_unique<DemoAppUpdateWorker>();
+        m_pipeline.hCounterWait.Reset(m_profilerService,
+                                      m_profilerService->CreateCustomCounter("pipe wait", 0, LocalConfig::PipelineCounterMaxMicroseconds,
+                                                                             DefaultProfilerColors::PipelineWait));
+        m_pipeline.hCounterHandoff.Reset(m_profilerService,
+                                         m_profilerService->CreateCustomCounter("handoff", 0, LocalConfig::PipelineCounterMaxMicroseconds,
+                                                                                DefaultProfilerColors::PipelineHandoff));
       }
 
       m_record.DemoApp->_PostConstruct();
@@ -562,8 +658,102 @@ namespace Fsl
   }
 
 
+  void DemoAppManager::BeginPipelinedUpdate(const DemoTime& updateTime)
+  {
+    assert(m_record.Pipelined);
+    assert(m_pipeline.Worker);
+    assert(!m_pipeline.Worker->IsBusy());
+
+    // The pre and fixed updates run on the main thread so the app, fixed and graphics service pre-updates are called in the same order as the
+    // sequential update. Only the Update, PostUpdate and Resolve calls are moved to the worker.
+    m_pipeline.UpdateTime = updateTime;
+    m_stats.TimeBeforeUpdate = m_timer.GetTimestamp();
+    m_record.DemoApp->_PreUpdate(updateTime);
+
+    {    // Run all missing fixed updates
+      FSL_TRACE_ZONE("DemoApp", "FixedUpdate");
+      std::optional<DemoTime> fixedTime = m_appTiming.TryFixedUpdate();
+      while (fixedTime.has_value())
+      {
+        m_record.DemoApp->_FixedUpdate(fixedTime.value());
+        fixedTime = m_appTiming.TryFixedUpdate();
+      }
+    }
+
+    if (m_graphicsService)
+    {
+      m_graphicsService->PreUpdate();
+    }
+
+    if (m_pipeline.HasPublishedState)
+    {
+      // Update the next frame while the current one is drawn
+      m_pipeline.Worker->Begin([this]() { RunPipelinedUpdate(); });
+    }
+    else
+    {
+      // There is nothing to draw yet, so the first update runs inline and is handed off right away
+      RunPipelinedUpdate();
+      m_record.DemoApp->_PipelineHandoff();
+      m_pipeline.HasPublishedState = true;
+      m_stats.PipelineWait = {};
+      m_stats.PipelineHandoff = {};
+    }
+  }
+
+
+  void DemoAppManager::EndPipelinedUpdate()
+  {
+    if (!m_pipeline.Worker || !m_pipeline.Worker->IsBusy())
+    {
+      return;
+    }
+
+    const TickCount timeBeforeWait = m_timer.GetTimestamp();
+    {
+      FSL_TRACE_ZONE("DemoApp", "PipelineWait");
+      m_pipeline.Worker->End();
+    }
+    const TickCount timeAfterWait = m_timer.GetTimestamp();
+
+    // The worker is idle so its safe to let the app publish its updated state to the draw stage
+    assert(m_record.DemoApp);
+    {
+      FSL_TRACE_ZONE("DemoApp", "PipelineHandoff");
+      m_record.DemoApp->_PipelineHandoff();
+    }
+
+    m_stats.PipelineWait = timeAfterWait - timeBeforeWait;
+    m_stats.PipelineHandoff = m_timer.GetTimestamp() - timeAfterWait;
+  }
+
+
+  void DemoAppManager::RunPipelinedUpdate()
+  {
+    // Beware: this is normally called on the worker thread so it must only access the app and the m_pipeline job state
+    const DemoTime updateTime = m_pipeline.UpdateTime;
+    {
+      FSL_TRACE_ZONE("DemoApp", "Update");
+      m_record.DemoApp->_Update(updateTime);
+      m_record.DemoApp->_PostUpdate(updateTime);
+      m_record.DemoApp->_Resolve(updateTime);
+    }
+    m_stats.TimeAfterUpdate = m_timer.GetTimestamp();
+  }
+
+
   void DemoAppManager::DoShutdownAppNow()
   {
+    try
+    {
+      EndPipelinedUpdate();
+    }
+    catch (const std::exception& ex)
+    {
+      // We are shutting down the app anyway so just log it
+      FSLLOG3_ERROR("Exception throw in pipelined update: {}", ex.what());
+    }
+
     if (m_record.DemoApp)
     {
       try
@@ -0,0 +1,146 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/IThreadContext.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
+#include <cassert>
+#include <utility>
+#include "DemoAppUpdateWorker.hpp"
+
+namespace Fsl
+{
+  namespace
+  {
+    struct LocalThreadContext : public IThreadContext
+    {
+      std::shared_ptr<ConcurrentQueue<std::function<void()>>> ToWorkerQueue;
+      std::shared_ptr<ConcurrentQueue<std::exception_ptr>> FromWorkerQueue;
+
+      LocalThreadContext(std::shared_ptr<ConcurrentQueue<std::function<void()>>> toWorkerQueue,
+                         std::shared_ptr<ConcurrentQueue<std::exception_ptr>> fromWorkerQueue)
+        : ToWorkerQueue(std::move(toWorkerQueue))
+        , FromWorkerQueue(std::move(fromWorkerQueue))
+      {
+      }
+    };
+
+    void OnThreadStartMethod(const std::shared_ptr<IThreadContext>& threadContext)
+    {
+      auto localContext = std::dynamic_pointer_cast<LocalThreadContext>(threadContext);
+      if (!localContext)
+      {
+        FSLLOG3_ERROR("DemoAppUpdateWorker started with a invalid context");
+        return;
+      }
+      TraceRecorder::SetCurrentThreadName("DemoAppUpdateWorker");
+
+      // A empty job is used as the shutdown request
+      std::function<void()> job = localContext->ToWorkerQueue->Dequeue();
+      while (job)
+      {
+        std::exception_ptr exception;
+        try
+        {
+          job();
+        }
+        catch (...)
+        {
+          // The exception is rethrown on the main thread
+          exception = std::current_exception();
+        }
+        localContext->FromWorkerQueue->Enqueue(exception);
+        job = localContext->ToWorkerQueue->Dequeue();
+      }
+    }
+  }
+
+
+  DemoAppUpdateWorker::DemoAppUpdateWorker()
+    : m_toWorkerQueue(std::make_shared<ConcurrentQueue<std::function<void()>>>())
+    , m_fromWorkerQueue(std::make_shared<ConcurrentQueue<std::exception_ptr>>())
+    , m_threadContext(std::make_shared<LocalThreadContext>(m_toWorkerQueue, m_fromWorkerQueue))
+    , m_thread(OnThreadStartMethod, m_threadContext)
+  {
+  }
+
+
+  DemoAppUpdateWorker::~DemoAppUpdateWorker() noexcept
+  {
+    try
+    {
+      if (m_isBusy)
+      {
+        // Wait for the current job, any exception it threw is ignored as nobody is left to handle it
+        m_fromWorkerQueue->Dequeue();
+        m_isBusy = false;
+      }
+      m_toWorkerQueue->Enqueue(std::function<void()>());
+      m_thread.Join();
+    }
+    catch (const std::exception& ex)
+    {
+      FSLLOG3_ERROR("Error during DemoAppUpdateWorker shutdown {}", ex.what());
+    }
+  }
+
+
+  void DemoAppUpdateWorker::Begin(std::function<void()> job)
+  {
+    if (m_isBusy)
+    {
+      throw UsageErrorException("A job is already in flight");
+    }
+    if (!job)
+    {
+      throw std::invalid_argument("job can not be empty");
+    }
+    m_toWorkerQueue->Enqueue(job);
+    m_isBusy = true;
+  }
+
+
+  void DemoAppUpdateWorker::End()
+  {
+    if (!m_isBusy)
+    {
+      return;
+    }
+    std::exception_ptr exception = m_fromWorkerQueue->Dequeue();
+    m_isBusy = false;
+    if (exception)
+    {
+      std::rethrow_exception(exception);
+    }
+  }
+}
@@ -0,0 +1,72 @@
+#ifndef FSLDEMOHOST_BASE_DEMOAPPUPDATEWORKER_HPP
+#define FSLDEMOHOST_BASE_DEMOAPPUPDATEWORKER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/Concurrent/ConcurrentQueue_fwd.hpp>
+#include <FslBase/System/Platform/PlatformThread.hpp>
+#include <exception>
+#include <functional>
+#include <memory>
+
+namespace Fsl
+{
+  //! @brief A single persistent worker thread used by the pipelined frame loop to run the app update stage while the main thread draws.
+  class DemoAppUpdateWorker
+  {
+    std::shared_ptr<ConcurrentQueue<std::function<void()>>> m_toWorkerQueue;
+    std::shared_ptr<ConcurrentQueue<std::exception_ptr>> m_fromWorkerQueue;
+    std::shared_ptr<IThreadContext> m_threadContext;
+    PlatformThread m_thread;
+    bool m_isBusy{false};
+
+  public:
+    DemoAppUpdateWorker(const DemoAppUpdateWorker&) = delete;
+    DemoAppUpdateWorker& operator=(const DemoAppUpdateWorker&) = delete;
+
+    DemoAppUpdateWorker();
+    ~DemoAppUpdateWorker() noexcept;
+
+    bool IsBusy() const noexcept
+    {
+      return m_isBusy;
+    }
+
+    //! @brief Schedule the job on the worker thread (only one job can be in flight at a time)
+    void Begin(std::function<void()> job);
+
+    //! @brief Block until the scheduled job has completed.
+    //! @throws rethrows any exception thrown by the job.
+    void End();
+  };
+}
+
+#endif
@@ -34,6 +34,9 @@
 #include <FslDemoService/BitmapConverter/BitmapConverterConfig.hpp>
 #include <FslGraphics/Bitmap/Bitmap.hpp>
 #include <FslGraphics/Bitmap/BitmapUtil.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
 #include <FslGraphics/Exceptions.hpp>
 #include <FslGraphics/Log/Bitmap/FmtBitmapOrigin.hpp>
 #include <FslGraphics/Log/FmtColorSpace.hpp>
@@ -141,6 +144,34 @@ namespace Fsl
     }
 
 
+    //! When both the origin and the pixel size changes the pixel format conversion can not be done in-place anyway,
+    //! so instead of flipping in-place and then converting we do both in a single pass into the new bitmap.
+    bool TryConvertFlippedSinglePass(Bitmap& rBitmap, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin)
+    {
+      const PixelFormat srcPixelFormat = rBitmap.GetPixelFormat();
+      if (desiredOrigin == BitmapOrigin::Undefined || rBitmap.GetOrigin() == desiredOrigin || desiredPixelFormat == PixelFormat::Undefined ||
+          PixelFormatUtil::GetBytesPerPixel(srcPixelFormat) == PixelFormatUtil::GetBytesPerPixel(desiredPixelFormat) ||
+          !RawBitmapBandConverter::IsSupported(srcPixelFormat, desiredPixelFormat))
+      {
+        return false;
+      }
+
+      Bitmap tmpBitmap;
+      tmpBitmap.Reset(rBitmap.GetSize(), desiredPixelFormat, rBitmap.GetPreferredStride(desiredPixelFormat), desiredOrigin,
+                      BitmapClearMethod::DontModify);
+      {
+        const Bitmap::ScopedDirectReadAccess srcAccess(rBitmap);
+        Bitmap::ScopedDirectReadWriteAccess dstAccess(tmpBitmap);
+        if (!RawBitmapBandConverter::TryWriteBand(dstAccess.AsRawBitmap(), srcAccess.AsRawBitmap(), 0))
+        {
+          return false;
+        }
+      }
+      rBitmap = std::move(tmpBitmap);
+      return true;
+    }
+
+
     std::map<BasicToneMapper, std::vector<ToneMappingRecord>> Create(const std::deque<std::shared_ptr<IImageToneMappingService>>& services,
                                                                      const ConversionType conversionType)
     {
@@ -243,6 +274,11 @@ namespace Fsl
 
   bool BitmapConverterService::TryConvert(Bitmap& rBitmap, const PixelFormat desiredPixelFormat, const BitmapOrigin desiredOrigin)
   {
+    if (TryConvertFlippedSinglePass(rBitmap, desiredPixelFormat, desiredOrigin))
+    {
+      return true;
+    }
+
     if (!TryConvertOrigin(rBitmap, desiredOrigin))
     {
       // Failed to convert origin to the desired one
@@ -0,0 +1,95 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHistogram.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+namespace Fsl
+{
+  ProfilerHistogram::ProfilerHistogram(const uint64_t maxTrackableValue)
+    : m_counts(ToBucketIndex(maxTrackableValue) + 1u)
+    , m_maxTrackableValue(maxTrackableValue)
+  {
+    if (maxTrackableValue >= (std::numeric_limits<uint64_t>::max() >> 1u))
+    {
+      throw std::invalid_argument("maxTrackableValue is too large");
+    }
+  }
+
+
+  void ProfilerHistogram::Clear() noexcept
+  {
+    std::fill(m_counts.begin(), m_counts.end(), 0u);
+    m_totalCount = 0;
+    m_minValue = 0;
+    m_maxValue = 0;
+  }
+
+
+  void ProfilerHistogram::Record(const uint64_t value) noexcept
+  {
+    const uint32_t bucketIndex = ToBucketIndex(std::min(value, m_maxTrackableValue));
+    assert(bucketIndex < m_counts.size());
+    ++m_counts[bucketIndex];
+
+    m_minValue = m_totalCount > 0u ? std::min(m_minValue, value) : value;
+    m_maxValue = std::max(m_maxValue, value);
+    ++m_totalCount;
+  }
+
+
+  uint64_t ProfilerHistogram::GetValueAtPercentile(const double percentile) const noexcept
+  {
+    if (m_totalCount <= 0u)
+    {
+      return 0u;
+    }
+
+    const double clampedPercentile = std::clamp(percentile, 0.0, 100.0);
+    const auto targetCount = std::clamp(static_cast<uint64_t>(std::ceil((clampedPercentile / 100.0) * static_cast<double>(m_totalCount))),
+                                        static_cast<uint64_t>(1u), m_totalCount);
+
+    uint64_t runningCount = 0;
+    for (std::size_t i = 0; i < m_counts.size(); ++i)
+    {
+      runningCount += m_counts[i];
+      if (runningCount >= targetCount)
+      {
+        return std::clamp(ToHighestEquivalentValue(static_cast<uint32_t>(i)), m_minValue, m_maxValue);
+      }
+    }
+    return m_maxValue;
+  }
+}
@@ -0,0 +1,135 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslDemoHost/Base/Service/Profiler/ProfilerHitchDetector.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      // Worst case every one of the frames while a hitch is pending is also a hitch
+      constexpr uint32_t MinHitchCapacity = ProfilerHitch::SurroundingFrames + 1u;
+    }
+
+    constexpr bool IsComplete(const ProfilerHitch& hitch) noexcept
+    {
+      return hitch.FrameCount >= (hitch.HitchOffset + 1u + ProfilerHitch::SurroundingFrames);
+    }
+  }
+
+
+  ProfilerHitchDetector::ProfilerHitchDetector(const float hitchFactor, const uint32_t hitchCapacity)
+    : m_history(ProfilerHitch::SurroundingFrames)
+    , m_hitches(std::max(hitchCapacity, LocalConfig::MinHitchCapacity))
+    , m_hitchFactor(hitchFactor)
+  {
+    if (hitchFactor <= 1.0f)
+    {
+      throw std::invalid_argument("hitchFactor must be larger than one");
+    }
+  }
+
+
+  void ProfilerHitchDetector::Clear() noexcept
+  {
+    m_history.clear();
+    m_hitches.clear();
+    m_pendingCount = 0;
+    m_frameIndex = 0;
+    m_hitchCount = 0;
+  }
+
+
+  bool ProfilerHitchDetector::Add(const ProfilerFrameTime& frameTime, const int64_t medianTotalTime)
+  {
+    const uint64_t frameIndex = m_frameIndex;
+    ++m_frameIndex;
+
+    // Fill in the frames after the pending hitches
+    if (m_pendingCount > 0u)
+    {
+      assert(m_pendingCount <= m_hitches.size());
+      for (std::size_t i = m_hitches.size() - m_pendingCount; i < m_hitches.size(); ++i)
+      {
+        ProfilerHitch& rHitch = m_hitches[i];
+        assert(!IsComplete(rHitch));
+        assert(rHitch.FrameCount < rHitch.Frames.size());
+        rHitch.Frames[rHitch.FrameCount] = frameTime;
+        ++rHitch.FrameCount;
+      }
+      // The pending hitches complete in the order they were detected
+      while (m_pendingCount > 0u && IsComplete(m_hitches[m_hitches.size() - m_pendingCount]))
+      {
+        --m_pendingCount;
+      }
+    }
+
+    const bool isHitch =
+      medianTotalTime > 0 && static_cast<double>(frameTime.TotalTime) > (static_cast<double>(medianTotalTime) * static_cast<double>(m_hitchFactor));
+    if (isHitch)
+    {
+      ProfilerHitch hitch;
+      hitch.FrameIndex = frameIndex;
+      hitch.MedianTotalTime = medianTotalTime;
+      for (std::size_t i = 0; i < m_history.size(); ++i)
+      {
+        hitch.Frames[i] = m_history[i];
+      }
+      hitch.HitchOffset = static_cast<uint32_t>(m_history.size());
+      hitch.Frames[hitch.HitchOffset] = frameTime;
+      hitch.FrameCount = hitch.HitchOffset + 1u;
+
+      assert(m_pendingCount < m_hitches.capacity());
+      m_hitches.push_back(hitch);
+      ++m_pendingCount;
+      ++m_hitchCount;
+    }
+    m_history.push_back(frameTime);
+    return isHitch;
+  }
+
+
+  void ProfilerHitchDetector::GetRecentHitches(std::vector<ProfilerHitch>& rHitches) const
+  {
+    rHitches.clear();
+    rHitches.reserve(m_hitches.size());
+    for (uint32_t i = 0; i < m_hitches.segment_count(); ++i)
+    {
+      const ReadOnlySpan<ProfilerHitch> segment = m_hitches.AsReadOnlySpan(i);
+      rHitches.insert(rHitches.end(), segment.begin(), segment.end());
+    }
+  }
+}
@@ -30,8 +30,13 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/PerformanceCounter.hpp>
+#include <FslBase/Trace/ChromeTraceWriter.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerService.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
@@ -46,12 +51,27 @@ namespace Fsl
     namespace LocalConfig
     {
       constexpr uint16_t MaxCustomCounters = 20;
+      //! Frame times above one minute are recorded as one minute (they still show up as the max)
+      constexpr uint64_t MaxTrackableFrameTime = 60 * 1000 * 1000;
+      //! The number of frames that have to be seen before the first window completes, before hitch detection starts
+      constexpr uint64_t MinHitchDetectionFrames = 30;
+      constexpr uint32_t HitchCapacity = 16;
     }
 
     inline int32_t CapTime(const uint64_t value)
     {
       return static_cast<int32_t>(std::max(std::min(value, static_cast<uint64_t>(std::numeric_limits<int32_t>::max())), static_cast<uint64_t>(0)));
     }
+
+    ProfilerPercentiles ToPercentiles(const ProfilerHistogram& histogram)
+    {
+      return {UncheckedNumericCast<int64_t>(histogram.GetValueAtPercentile(50.0)),
+              UncheckedNumericCast<int64_t>(histogram.GetValueAtPercentile(90.0)),
+              UncheckedNumericCast<int64_t>(histogram.GetValueAtPercentile(99.0)),
+              UncheckedNumericCast<int64_t>(histogram.GetValueAtPercentile(99.9)),
+              UncheckedNumericCast<int64_t>(histogram.GetMax()),
+              histogram.GetCount()};
+    }
   }
 
   ProfilerService::ProfilerService(const ServiceProvider& serviceProvider, const std::shared_ptr<ProfilerServiceOptionParser>& optionParser)
@@ -61,15 +81,42 @@ namespace Fsl
     , m_customCounters(LocalConfig::MaxCustomCounters)
     , m_customCounterCount(0)
     , m_customConfigurationRevision(1)
+    , m_statsWindow(optionParser->GetStatsWindow())
+    , m_windowHistograms(LocalConfig::MaxTrackableFrameTime)
+    , m_totalHistograms(LocalConfig::MaxTrackableFrameTime)
+    , m_hitchDetector(optionParser->GetHitchFactor(), LocalConfig::HitchCapacity)
+    , m_traceFile(optionParser->GetTraceFile())
+    , m_traceHistory(m_traceFile.IsEmpty() ? 1u : optionParser->GetTraceCapacity())
   {
     for (uint16_t i = 0; i < static_cast<uint16_t>(m_customCounters.size()); ++i)
     {
       m_customCounters[i].RealIndex = i;
     }
+
+    if (!m_traceFile.IsEmpty())
+    {
+      FSLLOG3_INFO("Trace recording enabled, it will be written to '{}' on exit", m_traceFile);
+      TraceRecorder::SetCurrentThreadName("Main");
+      TraceRecorder::SetEnabled(true);
+    }
   }
 
 
-  ProfilerService::~ProfilerService() = default;
+  ProfilerService::~ProfilerService()
+  {
+    if (!m_traceFile.IsEmpty())
+    {
+      TraceRecorder::SetEnabled(false);
+      try
+      {
+        ExportTrace();
+      }
+      catch (const std::exception& ex)
+      {
+        FSLLOG3_ERROR("Failed to write the trace to '{}': {}", m_traceFile, ex.what());
+      }
+    }
+  }
 
 
   ProfilerFrameTime ProfilerService::GetLastFrameTime() const
@@ -96,6 +143,30 @@ namespace Fsl
   }
 
 
+  ProfilerFrameTimeStats ProfilerService::GetWindowFrameTimeStats() const
+  {
+    return m_windowStats;
+  }
+
+
+  ProfilerFrameTimeStats ProfilerService::GetTotalFrameTimeStats() const
+  {
+    return {ToPercentiles(m_totalHistograms.UpdateTime), ToPercentiles(m_totalHistograms.DrawTime), ToPercentiles(m_totalHistograms.TotalTime)};
+  }
+
+
+  uint64_t ProfilerService::GetHitchCount() const
+  {
+    return m_hitchDetector.GetHitchCount();
+  }
+
+
+  void ProfilerService::GetRecentHitches(std::vector<ProfilerHitch>& rHitches) const
+  {
+    m_hitchDetector.GetRecentHitches(rHitches);
+  }
+
+
   int32_t ProfilerService::GetCustomCounterCapacity() const
   {
     return static_cast<int32_t>(m_customCounters.size());
@@ -209,6 +280,13 @@ namespace Fsl
   }
 
 
+  void ProfilerService::RequestTraceExport()
+  {
+    FSLLOG3_WARNING_IF(m_traceFile.IsEmpty(), "Trace recording is not enabled, use --Profiler.Trace <filename> to enable it");
+    m_traceExportRequested = !m_traceFile.IsEmpty();
+  }
+
+
   void ProfilerService::AddFrameTimes(const uint64_t updateTime, const uint64_t drawTime, const uint64_t totalTime)
   {
     const int32_t cappedUpdateTime = CapTime(updateTime);
@@ -233,6 +311,26 @@ namespace Fsl
     m_combinedTime.UpdateTime += cappedUpdateTime;
     m_combinedTime.DrawTime += cappedDrawTime;
     m_combinedTime.TotalTime += cappedTotalTime;
+
+    AddFrameTimeStats(ProfilerFrameTime(cappedUpdateTime, cappedDrawTime, cappedTotalTime));
+
+    if (!m_traceFile.IsEmpty())
+    {
+      // The thread buffers are drained once per frame so they only need to be able to hold a frames worth of events
+      CollectTrace();
+      if (m_traceExportRequested)
+      {
+        m_traceExportRequested = false;
+        try
+        {
+          ExportTrace();
+        }
+        catch (const std::exception& ex)
+        {
+          FSLLOG3_ERROR("Failed to write the trace to '{}': {}", m_traceFile, ex.what());
+        }
+      }
+    }
   }
 
 
@@ -248,4 +346,78 @@ namespace Fsl
 
     return UncheckedNumericCast<int32_t>(handleIndex);
   }
+
+
+  void ProfilerService::AddFrameTimeStats(const ProfilerFrameTime& frameTime)
+  {
+    // The hitch detection is done against the median of the previous window so the hitch itself does not affect it
+    if (m_hitchDetector.Add(frameTime, m_medianTotalTime))
+    {
+      FSLLOG3_VERBOSE2("Hitch detected: frame time {}us, median {}us (update {}us, draw {}us)", frameTime.TotalTime, m_medianTotalTime,
+                       frameTime.UpdateTime, frameTime.DrawTime);
+    }
+
+    const auto updateTime = UncheckedNumericCast<uint64_t>(frameTime.UpdateTime);
+    const auto drawTime = UncheckedNumericCast<uint64_t>(frameTime.DrawTime);
+    const auto totalTime = UncheckedNumericCast<uint64_t>(frameTime.TotalTime);
+    m_windowHistograms.UpdateTime.Record(updateTime);
+    m_windowHistograms.DrawTime.Record(drawTime);
+    m_windowHistograms.TotalTime.Record(totalTime);
+    m_totalHistograms.UpdateTime.Record(updateTime);
+    m_totalHistograms.DrawTime.Record(drawTime);
+    m_totalHistograms.TotalTime.Record(totalTime);
+
+    const uint64_t windowCount = m_windowHistograms.TotalTime.GetCount();
+    if (windowCount >= m_statsWindow)
+    {
+      m_windowStats = ProfilerFrameTimeStats(ToPercentiles(m_windowHistograms.UpdateTime), ToPercentiles(m_windowHistograms.DrawTime),
+                                             ToPercentiles(m_windowHistograms.TotalTime));
+      m_medianTotalTime = m_windowStats.TotalTime.P50;
+
+      m_windowHistograms.UpdateTime.Clear();
+      m_windowHistograms.DrawTime.Clear();
+      m_windowHistograms.TotalTime.Clear();
+    }
+    else if (windowCount == LocalConfig::MinHitchDetectionFrames && m_medianTotalTime <= 0)
+    {
+      // Start the hitch detection before the first window completes
+      m_medianTotalTime = UncheckedNumericCast<int64_t>(m_windowHistograms.TotalTime.GetValueAtPercentile(50.0));
+    }
+  }
+
+
+  void ProfilerService::CollectTrace()
+  {
+    m_traceScratchpad.clear();
+    m_traceDroppedEvents += TraceRecorder::Collect(m_traceScratchpad);
+    for (const TraceEvent& event : m_traceScratchpad)
+    {
+      m_traceHistory.push_back(event);
+    }
+  }
+
+
+  void ProfilerService::ExportTrace()
+  {
+    CollectTrace();
+
+    // Store the history in one contiguous block
+    m_traceScratchpad.clear();
+    m_traceScratchpad.reserve(m_traceHistory.size());
+    for (uint32_t i = 0; i < m_traceHistory.segment_count(); ++i)
+    {
+      const ReadOnlySpan<TraceEvent> segment = m_traceHistory.AsReadOnlySpan(i);
+      m_traceScratchpad.insert(m_traceScratchpad.end(), segment.begin(), segment.end());
+    }
+
+    std::vector<TraceThreadInfo> threads;
+    TraceRecorder::GetThreads(threads);
+
+    ChromeTraceWriter::Write(m_traceFile, SpanUtil::AsReadOnlySpan(m_traceScratchpad), SpanUtil::AsReadOnlySpan(threads),
+                             PerformanceCounter::GetPerformanceFrequency());
+    m_traceScratchpad.clear();
+
+    FSLLOG3_INFO("Trace with {} events written to '{}'", m_traceHistory.size(), m_traceFile);
+    FSLLOG3_WARNING_IF(m_traceDroppedEvents > 0u, "{} trace events were dropped because a thread buffer was full", m_traceDroppedEvents);
+  }
 }
@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/String/StringParseUtil.hpp>
 #include <FslDemoHost/Base/Service/Profiler/ProfilerServiceOptionParser.hpp>
 #include <fmt/format.h>
@@ -44,6 +45,12 @@ namespace Fsl
     namespace LocalConfig
     {
       constexpr uint16_t DefaultEntries = 60;
+      constexpr uint32_t DefaultTraceCapacity = 256 * 1024;
+      constexpr uint32_t MinTraceCapacity = 1024;
+      constexpr uint32_t DefaultStatsWindow = 300;
+      constexpr uint32_t MinStatsWindow = 10;
+      constexpr float DefaultHitchFactor = 2.0f;
+      constexpr float MinHitchFactor = 1.1f;
     }
 
     struct CommandId
@@ -51,6 +58,10 @@ namespace Fsl
       enum Enum
       {
         AverageEntries,
+        Trace,
+        TraceCapacity,
+        StatsWindow,
+        HitchFactor,
       };
     };
   }
@@ -58,6 +69,9 @@ namespace Fsl
 
   ProfilerServiceOptionParser::ProfilerServiceOptionParser()
     : m_averageEntries(LocalConfig::DefaultEntries)
+    , m_traceCapacity(LocalConfig::DefaultTraceCapacity)
+    , m_statsWindow(LocalConfig::DefaultStatsWindow)
+    , m_hitchFactor(LocalConfig::DefaultHitchFactor)
   {
   }
 
@@ -66,6 +80,19 @@ namespace Fsl
   {
     rOptions.emplace_back("Profiler.AverageEntries", OptionArgument::OptionRequired, CommandId::AverageEntries,
                           fmt::format("The number of frames used to calculate the average frame-time. Defaults to: {}", LocalConfig::DefaultEntries));
+    rOptions.emplace_back("Profiler.Trace", OptionArgument::OptionRequired, CommandId::Trace,
+                          "Record a trace of the framework instrumentation and write it to the given file in the Chrome trace JSON format "
+                          "(chrome://tracing or ui.perfetto.dev) on exit. F6 writes it on demand.");
+    rOptions.emplace_back("Profiler.TraceCapacity", OptionArgument::OptionRequired, CommandId::TraceCapacity,
+                          fmt::format("The maximum number of trace events that are kept for the export, when full the oldest are discarded. "
+                                      "Defaults to: {}",
+                                      LocalConfig::DefaultTraceCapacity));
+    rOptions.emplace_back("Profiler.StatsWindow", OptionArgument::OptionRequired, CommandId::StatsWindow,
+                          fmt::format("The number of frames used to calculate the windowed frame-time percentiles. Defaults to: {}",
+                                      LocalConfig::DefaultStatsWindow));
+    rOptions.emplace_back("Profiler.HitchFactor", OptionArgument::OptionRequired, CommandId::HitchFactor,
+                          fmt::format("A frame that takes more than this many times the median frame-time is reported as a hitch. Defaults to: {}",
+                                      LocalConfig::DefaultHitchFactor));
   }
 
 
@@ -79,6 +106,34 @@ namespace Fsl
         m_averageEntries = std::max(m_averageEntries, 1u);
         return OptionParseResult::Parsed;
       }
+    case CommandId::Trace:
+      {
+        m_traceFile = IO::Path(strOptArg);
+        if (m_traceFile.IsEmpty())
+        {
+          FSLLOG3_ERROR("The trace file can not be empty");
+          return OptionParseResult::Failed;
+        }
+        return OptionParseResult::Parsed;
+      }
+    case CommandId::TraceCapacity:
+      {
+        StringParseUtil::Parse(m_traceCapacity, strOptArg);
+        m_traceCapacity = std::max(m_traceCapacity, LocalConfig::MinTraceCapacity);
+        return OptionParseResult::Parsed;
+      }
+    case CommandId::StatsWindow:
+      {
+        StringParseUtil::Parse(m_statsWindow, strOptArg);
+        m_statsWindow = std::max(m_statsWindow, LocalConfig::MinStatsWindow);
+        return OptionParseResult::Parsed;
+      }
+    case CommandId::HitchFactor:
+      {
+        StringParseUtil::Parse(m_hitchFactor, strOptArg);
+        m_hitchFactor = std::max(m_hitchFactor, LocalConfig::MinHitchFactor);
+        return OptionParseResult::Parsed;
+      }
     default:
       return OptionParseResult::NotHandled;
     }
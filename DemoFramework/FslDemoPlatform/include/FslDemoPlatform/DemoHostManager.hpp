@@ -37,7 +37,9 @@
 #include <FslDemoPlatform/DurationExitConfig.hpp>
 #include <FslDemoPlatform/MainLoopCallbackFunc.hpp>
 #include <FslDemoPlatform/Setup/DemoSetup.hpp>
+#include <FslNativeWindow/Base/NativeWindowEvent.hpp>
 #include <memory>
+#include <vector>
 
 namespace Fsl
 {
@@ -82,6 +84,8 @@ namespace Fsl
     HighResolutionTimer m_timer;
     //! Only used if m_exitAfterDuration.Enabled is true
     std::chrono::microseconds m_exitTime;
+    //! Scratch buffer used to drain the event queue
+    std::vector<NativeWindowEvent> m_pendingEvents;
 
   public:
     DemoHostManager(const DemoSetup& demoSetup, const std::shared_ptr<DemoHostManagerOptionParser>& demoHostManagerOptionParser);
@@ -41,6 +41,7 @@
 #include <FslDemoService/Graphics/ColorSpaceType.hpp>
 #include <FslGraphics/ImageFormat.hpp>
 #include <FslNativeWindow/Base/NativeWindowConfig.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLaunchMode.hpp>
 #include <chrono>
 #include <memory>
 
@@ -60,6 +61,7 @@ namespace Fsl
     bool m_appFirewall{false};
     bool m_enableBasic2DPrealloc{false};
     bool m_contentMonitor{false};
+    ServiceLaunchMode m_serviceLaunchMode{ServiceLaunchMode::Serial};
 
   public:
     DemoHostManagerOptionParser(const DemoHostManagerOptionParser&) = delete;
@@ -127,6 +129,12 @@ namespace Fsl
     //! Check if content monitoring is enabled
     bool IsContentMonitorEnabled() const;
 
+    //! Get the launch mode of the global services
+    ServiceLaunchMode GetServiceLaunchMode() const noexcept
+    {
+      return m_serviceLaunchMode;
+    }
+
     void RequestEnableAppFirewall();
 
   private:
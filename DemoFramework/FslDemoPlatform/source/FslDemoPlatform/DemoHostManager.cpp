@@ -250,37 +250,42 @@ namespace Fsl
 
   void DemoHostManager::ProcessMessages()
   {
-    NativeWindowEvent event;
-    while (m_eventQueue->TryDequeue(event))
+    // Keep draining until empty so events posted while processing are handled in the same frame
+    m_pendingEvents.clear();
+    while (m_eventQueue->TryDequeueAll(m_pendingEvents) > 0u)
     {
-      FSLLOG3_VERBOSE6("Event: {} arg1: {} arg2: {} arg3: {}", static_cast<int32_t>(event.Type), event.Arg1, event.Arg2, event.Arg3);
-      switch (event.Type)
+      for (const NativeWindowEvent& event : m_pendingEvents)
       {
-      case NativeWindowEventType::WindowActivation:
-        FSLLOG3_VERBOSE("DemoHostManager: WindowActivation: {}", event.Arg1);
-        CmdActivation(event.Arg1 != 0);
-        break;
-      case NativeWindowEventType::WindowSuspend:
-        FSLLOG3_VERBOSE("DemoHostManager: WindowSuspend: {}", event.Arg1);
-        CmdSuspend(event.Arg1 != 0);
-        break;
-      case NativeWindowEventType::LowMemory:
-        FSLLOG3_VERBOSE("DemoHostManager: LowMemory");
-        // For now we ignore this
-        break;
-      case NativeWindowEventType::WindowResized:
-        FSLLOG3_VERBOSE("DemoHostManager: WindowResized");
-        m_windowMetricsDirty = true;
-        break;
-      case NativeWindowEventType::WindowConfigChanged:
-        FSLLOG3_VERBOSE("DemoHostManager: WindowConfigChanged");
-        m_windowMetricsDirty = true;
-        break;
-      default:
-        break;
-      }
+        FSLLOG3_VERBOSE6("Event: {} arg1: {} arg2: {} arg3: {}", static_cast<int32_t>(event.Type), event.Arg1, event.Arg2, event.Arg3);
+        switch (event.Type)
+        {
+        case NativeWindowEventType::WindowActivation:
+          FSLLOG3_VERBOSE("DemoHostManager: WindowActivation: {}", event.Arg1);
+          CmdActivation(event.Arg1 != 0);
+          break;
+        case NativeWindowEventType::WindowSuspend:
+          FSLLOG3_VERBOSE("DemoHostManager: WindowSuspend: {}", event.Arg1);
+          CmdSuspend(event.Arg1 != 0);
+          break;
+        case NativeWindowEventType::LowMemory:
+          FSLLOG3_VERBOSE("DemoHostManager: LowMemory");
+          // For now we ignore this
+          break;
+        case NativeWindowEventType::WindowResized:
+          FSLLOG3_VERBOSE("DemoHostManager: WindowResized");
+          m_windowMetricsDirty = true;
+          break;
+        case NativeWindowEventType::WindowConfigChanged:
+          FSLLOG3_VERBOSE("DemoHostManager: WindowConfigChanged");
+          m_windowMetricsDirty = true;
+          break;
+        default:
+          break;
+        }
 
-      m_nativeWindowEventSender->SendEvent(event);
+        m_nativeWindowEventSender->SendEvent(event);
+      }
+      m_pendingEvents.clear();
     }
   }
 
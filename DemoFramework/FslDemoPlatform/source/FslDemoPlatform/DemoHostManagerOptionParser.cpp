@@ -68,6 +68,7 @@ namespace Fsl
       constexpr auto ScreenshotToneMapper = "ScreenshotToneMapper";
       constexpr auto ContentMonitor = "ContentMonitor";
       constexpr auto ForceUpdateTime = "ForceUpdateTime";
+      constexpr auto ConcurrentServiceLaunch = "ConcurrentServiceLaunch";
       constexpr auto Version = "Version";
     }
 
@@ -91,6 +92,7 @@ namespace Fsl
         EnableBasic2DPrealloc,
         ScreenshotNameScheme,
         ForceUpdateTime,
+        ConcurrentServiceLaunch,
         Version
       };
     };
@@ -173,7 +175,8 @@ namespace Fsl
     rOptions.emplace_back(ArgName::LogStats, OptionArgument::OptionNone, CommandId::LogStats,
                           "Log basic rendering stats (this is equal to setting LogStatsMode to latest)");
     rOptions.emplace_back(ArgName::LogStatsMode, OptionArgument::OptionRequired, CommandId::LogStatsMode,
-                          "Set the log stats mode, more advanced version of LogStats. Can be disabled, latest, average");
+                          "Set the log stats mode, more advanced version of LogStats. Can be disabled, latest, average, summary. "
+                          "All modes except disabled log the frame time percentiles and hitches on exit");
     rOptions.emplace_back(ArgName::Stats, OptionArgument::OptionNone, CommandId::Stats, "Display basic frame profiling stats");
     rOptions.emplace_back(ArgName::StatsFlags, OptionArgument::OptionRequired, CommandId::StatsFlags,
                           "Select the stats to be displayed/logged. Defaults to frame|cpu. Can be 'frame', 'cpu' or any combination");
@@ -203,6 +206,8 @@ namespace Fsl
     rOptions.emplace_back(
       ArgName::ForceUpdateTime, OptionArgument::OptionRequired, CommandId::ForceUpdateTime,
       "Force the update time to be the given value in microseconds (can be useful when taking a lot of screen-shots). If 0 this option is disabled");
+    rOptions.emplace_back(ArgName::ConcurrentServiceLaunch, OptionArgument::OptionNone, CommandId::ConcurrentServiceLaunch,
+                          "Construct the global services that share a startup priority concurrently (experimental)");
     rOptions.emplace_back(ArgName::Version, OptionArgument::OptionNone, CommandId::Version, "Print version information");
   }
 
@@ -255,6 +260,10 @@ namespace Fsl
         {
           m_logStatsMode = LogStatsMode::Average;
         }
+        else if (strOptArg == "summary")
+        {
+          m_logStatsMode = LogStatsMode::Summary;
+        }
         else
         {
           throw std::invalid_argument(fmt::format("Unknown logStatsMode parameter {}", strOptArg));
@@ -277,6 +286,9 @@ namespace Fsl
       StringParseUtil::Parse(boolValue, strOptArg);
       m_enableBasic2DPrealloc = boolValue;
       return OptionParseResult::Parsed;
+    case CommandId::ConcurrentServiceLaunch:
+      m_serviceLaunchMode = ServiceLaunchMode::Concurrent;
+      return OptionParseResult::Parsed;
     case CommandId::Version:
       FSLLOG3_INFO("Release {}, GitCommit '{}'", ReleaseVersion::CurrentVersion(), ReleaseVersion::GetGitCommit());
       return OptionParseResult::Parsed;
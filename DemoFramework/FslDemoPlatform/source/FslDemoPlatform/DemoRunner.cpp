@@ -238,7 +238,7 @@ namespace Fsl
       }
 
       // Start the services, after the command line parameters have been processed
-      serviceFramework->LaunchGlobalServices();
+      serviceFramework->LaunchGlobalServices(demoHostManagerOptionParser->GetServiceLaunchMode());
       serviceFramework->LaunchThreads();
 
       auto serviceProvider = serviceFramework->GetServiceProvider();
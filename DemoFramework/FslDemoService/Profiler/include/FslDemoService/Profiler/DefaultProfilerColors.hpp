@@ -39,6 +39,8 @@ namespace Fsl::DefaultProfilerColors
   constexpr Color Update = Colors::Cyan();
   constexpr Color Draw = Colors::Yellow();
   constexpr Color CpuLoad = Colors::Orange();
+  constexpr Color PipelineWait = Colors::Red();
+  constexpr Color PipelineHandoff = Colors::Pink();
 
   constexpr Color BatchDrawCalls = Colors::Blue();
   constexpr Color BatchVertices = Colors::Olive();
@@ -35,7 +35,10 @@
 #include <FslDemoService/Profiler/ProfilerCustomCounterDesc.hpp>
 #include <FslDemoService/Profiler/ProfilerCustomCounterHandle.hpp>
 #include <FslDemoService/Profiler/ProfilerFrameTime.hpp>
+#include <FslDemoService/Profiler/ProfilerFrameTimeStats.hpp>
+#include <FslDemoService/Profiler/ProfilerHitch.hpp>
 #include <string>
+#include <vector>
 
 namespace Fsl
 {
@@ -46,6 +49,20 @@ namespace Fsl
     virtual ProfilerFrameTime GetLastFrameTime() const = 0;
     virtual ProfilerFrameTime GetAverageFrameTime() const = 0;
 
+    //! @brief Get the frame time percentiles of the last completed stats window (--Profiler.StatsWindow frames).
+    //! @note  Before the first window has completed all values are zero.
+    virtual ProfilerFrameTimeStats GetWindowFrameTimeStats() const = 0;
+
+    //! @brief Get the frame time percentiles of all frames since the profiler was started.
+    virtual ProfilerFrameTimeStats GetTotalFrameTimeStats() const = 0;
+
+    //! @brief Get the total number of hitches detected (frames that took more than --Profiler.HitchFactor times the median frame time).
+    virtual uint64_t GetHitchCount() const = 0;
+
+    //! @brief Get the most recently detected hitches (oldest first).
+    //! @note  The newest hitches might still be waiting for the frames after them (see ProfilerHitch::FrameCount).
+    virtual void GetRecentHitches(std::vector<ProfilerHitch>& rHitches) const = 0;
+
     //! @brief Get the maximum number of custom counters that we support
     virtual int32_t GetCustomCounterCapacity() const = 0;
 
@@ -86,6 +103,10 @@ namespace Fsl
 
     //! @brief Check if the handle is still considered valid
     virtual bool IsValidHandle(const ProfilerCustomCounterHandle& handle) const = 0;
+
+    //! @brief Request that the recorded trace is written to the trace file at the end of the current frame.
+    //! @note  This only has a effect if tracing was enabled on the command line (--Profiler.Trace).
+    virtual void RequestTraceExport() = 0;
   };
 }
 
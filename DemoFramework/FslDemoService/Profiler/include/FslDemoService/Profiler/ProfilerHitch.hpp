@@ -0,0 +1,64 @@
+#ifndef FSLDEMOSERVICE_PROFILER_PROFILERHITCH_HPP
+#define FSLDEMOSERVICE_PROFILER_PROFILERHITCH_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslDemoService/Profiler/ProfilerFrameTime.hpp>
+#include <array>
+
+namespace Fsl
+{
+  //! @brief A frame that took a lot longer than the median frame together with the stage timings of the frames around it.
+  struct ProfilerHitch
+  {
+    //! The number of frames captured before and after the hitch
+    static constexpr uint32_t SurroundingFrames = 4;
+
+    //! The index of the hitch frame (counted from the start of the profiler)
+    uint64_t FrameIndex{0};
+    //! The median total frame time that the hitch was detected against (microseconds)
+    int64_t MedianTotalTime{0};
+    //! The frames around the hitch (oldest first)
+    std::array<ProfilerFrameTime, (SurroundingFrames * 2) + 1> Frames{};
+    //! The number of valid entries in Frames (the frames after the hitch are filled in as they complete)
+    uint32_t FrameCount{0};
+    //! The index of the hitch frame in Frames
+    uint32_t HitchOffset{0};
+
+    const ProfilerFrameTime& GetHitchFrame() const
+    {
+      return Frames[HitchOffset];
+    }
+  };
+}
+
+#endif
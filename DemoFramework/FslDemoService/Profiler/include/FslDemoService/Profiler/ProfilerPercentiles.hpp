@@ -0,0 +1,64 @@
+#ifndef FSLDEMOSERVICE_PROFILER_PROFILERPERCENTILES_HPP
+#define FSLDEMOSERVICE_PROFILER_PROFILERPERCENTILES_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  //! @brief Percentiles of a timing in microseconds
+  struct ProfilerPercentiles
+  {
+    int64_t P50{0};
+    int64_t P90{0};
+    int64_t P99{0};
+    int64_t P999{0};
+    int64_t Max{0};
+    //! The number of samples the percentiles were calculated from
+    uint64_t SampleCount{0};
+
+    constexpr ProfilerPercentiles() noexcept = default;
+
+    constexpr ProfilerPercentiles(const int64_t p50, const int64_t p90, const int64_t p99, const int64_t p999, const int64_t max,
+                                  const uint64_t sampleCount) noexcept
+      : P50(p50)
+      , P90(p90)
+      , P99(p99)
+      , P999(p999)
+      , Max(max)
+      , SampleCount(sampleCount)
+    {
+    }
+  };
+}
+
+#endif
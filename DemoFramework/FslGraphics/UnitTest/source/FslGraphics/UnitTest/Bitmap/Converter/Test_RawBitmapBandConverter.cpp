@@ -0,0 +1,164 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestBitmapConverter_RawBitmapBandConverter = TestFixtureFslGraphics;
+
+  constexpr uint32_t ImageWidth = 2;
+  constexpr uint32_t ImageHeight = 4;
+
+  //! A B8G8R8 image stored bottom-up, pixel (x, y) where y=0 is the top row has the value B=0x10*y+x, G=0x80+y, R=0x40+x
+  constexpr std::array<uint8_t, 3 * ImageWidth * ImageHeight> BottomUpB8G8R8{
+    0x30, 0x83, 0x40, 0x31, 0x83, 0x41,    // y=3
+    0x20, 0x82, 0x40, 0x21, 0x82, 0x41,    // y=2
+    0x10, 0x81, 0x40, 0x11, 0x81, 0x41,    // y=1
+    0x00, 0x80, 0x40, 0x01, 0x80, 0x41,    // y=0
+  };
+
+  ReadOnlyRawBitmap CreateBottomUpBand(const uint32_t firstRow, const uint32_t rowCount)
+  {
+    constexpr uint32_t Stride = 3 * ImageWidth;
+    const auto span = SpanUtil::AsReadOnlySpan(BottomUpB8G8R8).subspan(firstRow * Stride, rowCount * Stride);
+    return ReadOnlyRawBitmap::Create(span, PxSize2D::Create(ImageWidth, rowCount), PixelFormat::B8G8R8_UINT, BitmapOrigin::LowerLeft);
+  }
+
+  bool TryWriteBand(Bitmap& rDstBitmap, const ReadOnlyRawBitmap& srcBand, const uint32_t srcFirstRow)
+  {
+    Bitmap::ScopedDirectReadWriteAccess scopedAccess(rDstBitmap);
+    return RawBitmapBandConverter::TryWriteBand(scopedAccess.AsRawBitmap(), srcBand, srcFirstRow);
+  }
+
+  void ExpectImageRGBA(const Bitmap& bitmap, const uint32_t rowCountTop)
+  {
+    for (uint32_t y = 0; y < rowCountTop; ++y)
+    {
+      for (uint32_t x = 0; x < ImageWidth; ++x)
+      {
+        EXPECT_EQ(bitmap.GetUInt8((x * 4) + 0, y), 0x40 + x);
+        EXPECT_EQ(bitmap.GetUInt8((x * 4) + 1, y), 0x80 + y);
+        EXPECT_EQ(bitmap.GetUInt8((x * 4) + 2, y), (0x10 * y) + x);
+        EXPECT_EQ(bitmap.GetUInt8((x * 4) + 3, y), 0xFF);
+      }
+    }
+  }
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, IsSupported)
+{
+  EXPECT_TRUE(RawBitmapBandConverter::IsSupported(PixelFormat::B8G8R8_UINT, PixelFormat::B8G8R8_UINT));
+  EXPECT_TRUE(RawBitmapBandConverter::IsSupported(PixelFormat::R8G8B8_UINT, PixelFormat::R8G8B8_UNORM));
+  EXPECT_TRUE(RawBitmapBandConverter::IsSupported(PixelFormat::B8G8R8_UINT, PixelFormat::R8G8B8A8_UNORM));
+  EXPECT_TRUE(RawBitmapBandConverter::IsSupported(PixelFormat::R8G8B8A8_UINT, PixelFormat::EX_LUMINANCE8_UNORM));
+  EXPECT_FALSE(RawBitmapBandConverter::IsSupported(PixelFormat::Undefined, PixelFormat::R8G8B8A8_UNORM));
+  EXPECT_FALSE(RawBitmapBandConverter::IsSupported(PixelFormat::R8G8B8A8_UNORM, PixelFormat::Undefined));
+  EXPECT_FALSE(RawBitmapBandConverter::IsSupported(PixelFormat::R8G8B8A8_UNORM, PixelFormat::R32G32B32A32_SFLOAT));
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, TryWriteBand_SameOrigin_Copy)
+{
+  Bitmap dstBitmap(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::B8G8R8_UINT, BitmapOrigin::LowerLeft);
+
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(0, 3), 0));
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(3, 1), 3));
+
+  Bitmap::ScopedDirectReadAccess scopedAccess(dstBitmap);
+  const auto* const pContent = static_cast<const uint8_t*>(scopedAccess.AsRawBitmap().Content());
+  for (std::size_t i = 0; i < BottomUpB8G8R8.size(); ++i)
+  {
+    EXPECT_EQ(pContent[i], BottomUpB8G8R8[i]);
+  }
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, TryWriteBand_SameOrigin_Convert)
+{
+  Bitmap dstBitmap(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::R8G8B8A8_UINT, BitmapOrigin::LowerLeft);
+
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(0, 2), 0));
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(2, 2), 2));
+
+  ExpectImageRGBA(dstBitmap, ImageHeight);
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, TryWriteBand_Flipped_Convert)
+{
+  Bitmap dstBitmap(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::R8G8B8A8_UINT, BitmapOrigin::UpperLeft);
+
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(0, 3), 0));
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(3, 1), 3));
+
+  ExpectImageRGBA(dstBitmap, ImageHeight);
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, TryWriteBand_Flipped_PartialImage)
+{
+  Bitmap dstBitmap(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::R8G8B8A8_UINT, BitmapOrigin::UpperLeft);
+
+  // The last stored bottom-up rows are the top rows of the image
+  EXPECT_TRUE(TryWriteBand(dstBitmap, CreateBottomUpBand(2, 2), 2));
+
+  ExpectImageRGBA(dstBitmap, 2);
+  EXPECT_EQ(dstBitmap.GetUInt8(0, 2), 0u);
+  EXPECT_EQ(dstBitmap.GetUInt8(0, 3), 0u);
+}
+
+
+TEST(TestBitmapConverter_RawBitmapBandConverter, TryWriteBand_Invalid)
+{
+  Bitmap dstBitmap(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::R8G8B8A8_UINT, BitmapOrigin::UpperLeft);
+  Bitmap dstBitmapWide(PxSize2D::Create(ImageWidth + 1, ImageHeight), PixelFormat::R8G8B8A8_UINT, BitmapOrigin::UpperLeft);
+  Bitmap dstBitmapFloat(PxSize2D::Create(ImageWidth, ImageHeight), PixelFormat::R32G32B32A32_SFLOAT, BitmapOrigin::UpperLeft);
+
+  // The band does not fit
+  EXPECT_FALSE(TryWriteBand(dstBitmap, CreateBottomUpBand(0, 2), 3));
+  EXPECT_FALSE(TryWriteBand(dstBitmap, CreateBottomUpBand(0, 1), ImageHeight + 1));
+  // Width mismatch
+  EXPECT_FALSE(TryWriteBand(dstBitmapWide, CreateBottomUpBand(0, 1), 0));
+  // Unsupported conversion
+  EXPECT_FALSE(TryWriteBand(dstBitmapFloat, CreateBottomUpBand(0, 1), 0));
+  // Invalid band
+  EXPECT_FALSE(TryWriteBand(dstBitmap, ReadOnlyRawBitmap(), 0));
+}
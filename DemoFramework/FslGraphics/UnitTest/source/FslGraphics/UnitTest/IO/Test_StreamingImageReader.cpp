@@ -0,0 +1,387 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/IO/StreamingImageReader.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestIO_StreamingImageReader = TestFixtureFslGraphics;
+
+  struct TestPixel
+  {
+    uint8_t B{0};
+    uint8_t G{0};
+    uint8_t R{0};
+    uint8_t A{0};
+  };
+
+  //! y=0 is the top row
+  TestPixel GetPixel(const uint32_t x, const uint32_t y)
+  {
+    return {static_cast<uint8_t>((0x10 * y) + x), static_cast<uint8_t>(0x80 + y), static_cast<uint8_t>(0x40 + x), static_cast<uint8_t>(0xF0 - x)};
+  }
+
+  //! A pattern with runs of identical pixels that cross row boundaries
+  TestPixel GetRunPixel(const uint32_t x, const uint32_t y, const uint32_t width)
+  {
+    const auto value = static_cast<uint8_t>(((y * width) + x) / 3);
+    return {value, static_cast<uint8_t>(value ^ 0x55), static_cast<uint8_t>(value + 1), 0xFF};
+  }
+
+  void WriteUInt16(std::string& rDst, const uint32_t value)
+  {
+    rDst.push_back(static_cast<char>(value & 0xFF));
+    rDst.push_back(static_cast<char>((value >> 8) & 0xFF));
+  }
+
+  void WriteUInt32(std::string& rDst, const uint32_t value)
+  {
+    WriteUInt16(rDst, value & 0xFFFF);
+    WriteUInt16(rDst, (value >> 16) & 0xFFFF);
+  }
+
+  void WritePixel(std::string& rDst, const TestPixel pixel, const uint32_t bytesPerPixel)
+  {
+    rDst.push_back(static_cast<char>(pixel.B));
+    rDst.push_back(static_cast<char>(pixel.G));
+    rDst.push_back(static_cast<char>(pixel.R));
+    if (bytesPerPixel == 4)
+    {
+      rDst.push_back(static_cast<char>(pixel.A));
+    }
+  }
+
+  std::string CreateBmp(const uint32_t width, const uint32_t height, const uint16_t bitsPerPixel, const bool topDown)
+  {
+    const uint32_t bytesPerPixel = bitsPerPixel / 8u;
+    const uint32_t stride = ((width * bytesPerPixel) + 3u) & ~3u;
+    std::string content;
+    // File header
+    content.append("BM");
+    WriteUInt32(content, 14 + 40 + (stride * height));
+    WriteUInt32(content, 0);
+    WriteUInt32(content, 14 + 40);
+    // BITMAPINFOHEADER
+    WriteUInt32(content, 40);
+    WriteUInt32(content, width);
+    WriteUInt32(content, topDown ? static_cast<uint32_t>(-static_cast<int32_t>(height)) : height);
+    WriteUInt16(content, 1);
+    WriteUInt16(content, bitsPerPixel);
+    WriteUInt32(content, 0);
+    WriteUInt32(content, stride * height);
+    WriteUInt32(content, 0);
+    WriteUInt32(content, 0);
+    WriteUInt32(content, 0);
+    WriteUInt32(content, 0);
+    for (uint32_t i = 0; i < height; ++i)
+    {
+      const uint32_t y = topDown ? i : height - 1 - i;
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        WritePixel(content, GetPixel(x, y), bytesPerPixel);
+      }
+      content.append(stride - (width * bytesPerPixel), '\0');
+    }
+    return content;
+  }
+
+  std::string CreateTgaHeader(const uint8_t imageType, const uint32_t width, const uint32_t height, const uint8_t pixelDepth, const bool topDown)
+  {
+    std::string content;
+    content.push_back(3);    // id length
+    content.push_back(0);    // color map type
+    content.push_back(static_cast<char>(imageType));
+    content.append(5, '\0');    // color map spec
+    WriteUInt16(content, 0);
+    WriteUInt16(content, 0);
+    WriteUInt16(content, width);
+    WriteUInt16(content, height);
+    content.push_back(static_cast<char>(pixelDepth));
+    content.push_back(static_cast<char>(topDown ? 0x20 : 0x00));
+    content.append("id!");
+    return content;
+  }
+
+  std::string CreateTga(const uint32_t width, const uint32_t height, const uint8_t pixelDepth, const bool topDown)
+  {
+    const uint32_t bytesPerPixel = pixelDepth / 8u;
+    std::string content = CreateTgaHeader(2, width, height, pixelDepth, topDown);
+    for (uint32_t i = 0; i < height; ++i)
+    {
+      const uint32_t y = topDown ? i : height - 1 - i;
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        WritePixel(content, GetPixel(x, y), bytesPerPixel);
+      }
+    }
+    return content;
+  }
+
+  //! Creates a top-down RLE TGA using GetRunPixel, the packets are allowed to cross row boundaries
+  std::string CreateRunTga(const uint32_t width, const uint32_t height, const uint8_t pixelDepth, const bool useRLE)
+  {
+    const uint32_t bytesPerPixel = pixelDepth / 8u;
+    std::string content = CreateTgaHeader(useRLE ? 10 : 2, width, height, pixelDepth, true);
+
+    std::vector<TestPixel> pixels;
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        pixels.push_back(GetRunPixel(x, y, width));
+      }
+    }
+    if (!useRLE)
+    {
+      for (const auto& pixel : pixels)
+      {
+        WritePixel(content, pixel, bytesPerPixel);
+      }
+      return content;
+    }
+
+    const auto isEqual = [](const TestPixel lhs, const TestPixel rhs)
+    { return lhs.B == rhs.B && lhs.G == rhs.G && lhs.R == rhs.R && lhs.A == rhs.A; };
+    std::size_t index = 0;
+    while (index < pixels.size())
+    {
+      std::size_t runLength = 1;
+      while ((index + runLength) < pixels.size() && runLength < 128 && isEqual(pixels[index], pixels[index + runLength]))
+      {
+        ++runLength;
+      }
+      if (runLength > 1)
+      {
+        content.push_back(static_cast<char>(0x80 | (runLength - 1)));
+        WritePixel(content, pixels[index], bytesPerPixel);
+      }
+      else
+      {
+        // Emit a single raw pixel packet
+        content.push_back(0);
+        WritePixel(content, pixels[index], bytesPerPixel);
+      }
+      index += runLength;
+    }
+    return content;
+  }
+
+  bool TryRead(Bitmap& rBitmap, const std::string& content, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat,
+               const BitmapOrigin desiredOrigin, const uint32_t bandHeight = StreamingImageReader::DefaultBandHeight)
+  {
+    std::istringstream stream(content);
+    return StreamingImageReader::TryRead(rBitmap, stream, imageFormat, desiredPixelFormat, desiredOrigin, PixelChannelOrder::Undefined, bandHeight);
+  }
+
+  //! Validate the content of a bitmap using a BGR(A) or RGB(A) byte order
+  //! @param srcHasAlpha if false the alpha channel is expected to be 0xFF
+  void ExpectImage(const Bitmap& bitmap, const uint32_t width, const uint32_t height, const bool isBGR, const uint32_t bytesPerPixel,
+                   const bool srcHasAlpha)
+  {
+    ASSERT_EQ(bitmap.GetSize(), PxSize2D::Create(width, height));
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const TestPixel expected = GetPixel(x, y);
+        EXPECT_EQ(bitmap.GetUInt8((x * bytesPerPixel) + 0, y), isBGR ? expected.B : expected.R);
+        EXPECT_EQ(bitmap.GetUInt8((x * bytesPerPixel) + 1, y), expected.G);
+        EXPECT_EQ(bitmap.GetUInt8((x * bytesPerPixel) + 2, y), isBGR ? expected.R : expected.B);
+        if (bytesPerPixel == 4)
+        {
+          EXPECT_EQ(bitmap.GetUInt8((x * bytesPerPixel) + 3, y), srcHasAlpha ? expected.A : 0xFF);
+        }
+      }
+    }
+  }
+}
+
+
+TEST(TestIO_StreamingImageReader, IsSupported)
+{
+  EXPECT_TRUE(StreamingImageReader::IsSupported(ImageFormat::Bmp));
+  EXPECT_TRUE(StreamingImageReader::IsSupported(ImageFormat::Tga));
+  EXPECT_FALSE(StreamingImageReader::IsSupported(ImageFormat::Png));
+  EXPECT_FALSE(StreamingImageReader::IsSupported(ImageFormat::Jpeg));
+  EXPECT_FALSE(StreamingImageReader::IsSupported(ImageFormat::Undefined));
+}
+
+
+TEST(TestIO_StreamingImageReader, Bmp24_BottomUp_KeepStored)
+{
+  Bitmap bitmap;
+  ASSERT_TRUE(TryRead(bitmap, CreateBmp(3, 5, 24, false), ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::Undefined));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::B8G8R8_UINT);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::LowerLeft);
+  ExpectImage(bitmap, 3, 5, true, 3, false);
+}
+
+
+TEST(TestIO_StreamingImageReader, Bmp24_BottomUp_ToR8G8B8A8_UpperLeft)
+{
+  Bitmap bitmap;
+  ASSERT_TRUE(TryRead(bitmap, CreateBmp(3, 5, 24, false), ImageFormat::Bmp, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft, 2));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::R8G8B8A8_UNORM);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::UpperLeft);
+  ExpectImage(bitmap, 3, 5, false, 4, false);
+}
+
+
+TEST(TestIO_StreamingImageReader, Bmp32_TopDown_ToLowerLeft)
+{
+  Bitmap bitmap;
+  ASSERT_TRUE(TryRead(bitmap, CreateBmp(4, 3, 32, true), ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::LowerLeft, 1));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::B8G8R8A8_UINT);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::LowerLeft);
+  ExpectImage(bitmap, 4, 3, true, 4, true);
+}
+
+
+TEST(TestIO_StreamingImageReader, Bmp24_PreferredChannelOrder)
+{
+  Bitmap bitmap;
+  std::istringstream stream(CreateBmp(3, 2, 24, false));
+  ASSERT_TRUE(
+    StreamingImageReader::TryRead(bitmap, stream, ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::UpperLeft, PixelChannelOrder::RGBA));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::R8G8B8_UINT);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::UpperLeft);
+  ExpectImage(bitmap, 3, 2, false, 3, false);
+}
+
+
+TEST(TestIO_StreamingImageReader, Tga24_BottomUp_ToR8G8B8)
+{
+  Bitmap bitmap;
+  ASSERT_TRUE(TryRead(bitmap, CreateTga(5, 4, 24, false), ImageFormat::Tga, PixelFormat::R8G8B8_UNORM, BitmapOrigin::UpperLeft, 3));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::R8G8B8_UNORM);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::UpperLeft);
+  ExpectImage(bitmap, 5, 4, false, 3, false);
+}
+
+
+TEST(TestIO_StreamingImageReader, Tga32_TopDown_KeepStored)
+{
+  Bitmap bitmap;
+  ASSERT_TRUE(TryRead(bitmap, CreateTga(1, 3, 32, true), ImageFormat::Tga, PixelFormat::Undefined, BitmapOrigin::Undefined));
+
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::B8G8R8A8_UINT);
+  EXPECT_EQ(bitmap.GetOrigin(), BitmapOrigin::UpperLeft);
+  ExpectImage(bitmap, 1, 3, true, 4, true);
+}
+
+
+TEST(TestIO_StreamingImageReader, TgaRLE_MatchesUncompressed)
+{
+  constexpr uint32_t Width = 5;
+  constexpr uint32_t Height = 7;
+  for (const uint8_t pixelDepth : {uint8_t(24), uint8_t(32)})
+  {
+    for (const uint32_t bandHeight : {1u, 2u, 64u})
+    {
+      Bitmap expectedBitmap;
+      Bitmap bitmap;
+      ASSERT_TRUE(TryRead(expectedBitmap, CreateRunTga(Width, Height, pixelDepth, false), ImageFormat::Tga, PixelFormat::R8G8B8A8_UNORM,
+                          BitmapOrigin::LowerLeft, bandHeight));
+      ASSERT_TRUE(TryRead(bitmap, CreateRunTga(Width, Height, pixelDepth, true), ImageFormat::Tga, PixelFormat::R8G8B8A8_UNORM,
+                          BitmapOrigin::LowerLeft, bandHeight));
+
+      for (uint32_t y = 0; y < Height; ++y)
+      {
+        for (uint32_t x = 0; x < Width; ++x)
+        {
+          const TestPixel expected = GetRunPixel(x, y, Width);
+          EXPECT_EQ(bitmap.GetNativePixel(x, y), expectedBitmap.GetNativePixel(x, y));
+          EXPECT_EQ(bitmap.GetUInt8(x * 4, y), expected.R);
+          EXPECT_EQ(bitmap.GetUInt8((x * 4) + 2, y), expected.B);
+        }
+      }
+    }
+  }
+}
+
+
+TEST(TestIO_StreamingImageReader, Unsupported)
+{
+  const std::string bmp8 = [] {
+    std::string content = CreateBmp(4, 2, 24, false);
+    content[14 + 14] = 8;
+    return content;
+  }();
+  const std::string tgaColorMapped = [] {
+    std::string content = CreateTga(2, 2, 24, false);
+    content[1] = 1;
+    return content;
+  }();
+
+  Bitmap bitmap(PxSize2D::Create(1, 1), PixelFormat::R8G8B8A8_UNORM);
+  EXPECT_FALSE(TryRead(bitmap, bmp8, ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::Undefined));
+  EXPECT_FALSE(TryRead(bitmap, tgaColorMapped, ImageFormat::Tga, PixelFormat::Undefined, BitmapOrigin::Undefined));
+  EXPECT_FALSE(TryRead(bitmap, CreateBmp(4, 2, 24, false), ImageFormat::Png, PixelFormat::Undefined, BitmapOrigin::Undefined));
+  EXPECT_FALSE(TryRead(bitmap, CreateBmp(4, 2, 24, false), ImageFormat::Bmp, PixelFormat::R32G32B32A32_SFLOAT, BitmapOrigin::Undefined));
+
+  // The bitmap is left untouched
+  EXPECT_EQ(bitmap.GetSize(), PxSize2D::Create(1, 1));
+  EXPECT_EQ(bitmap.GetPixelFormat(), PixelFormat::R8G8B8A8_UNORM);
+}
+
+
+TEST(TestIO_StreamingImageReader, Truncated)
+{
+  const std::string bmp = CreateBmp(4, 4, 24, false);
+  const std::string tga = CreateRunTga(4, 4, 32, true);
+
+  Bitmap bitmap;
+  EXPECT_THROW(TryRead(bitmap, bmp.substr(0, bmp.size() - 1), ImageFormat::Bmp, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft),
+               FormatException);
+  EXPECT_THROW(TryRead(bitmap, bmp.substr(0, 20), ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::Undefined), FormatException);
+  EXPECT_THROW(TryRead(bitmap, tga.substr(0, tga.size() - 1), ImageFormat::Tga, PixelFormat::Undefined, BitmapOrigin::Undefined), FormatException);
+}
+
+
+TEST(TestIO_StreamingImageReader, InvalidBandHeight)
+{
+  Bitmap bitmap;
+  EXPECT_THROW(TryRead(bitmap, CreateBmp(1, 1, 24, false), ImageFormat::Bmp, PixelFormat::Undefined, BitmapOrigin::Undefined, 0),
+               std::invalid_argument);
+}
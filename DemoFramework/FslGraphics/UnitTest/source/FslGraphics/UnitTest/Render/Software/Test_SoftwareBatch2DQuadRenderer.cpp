@@ -0,0 +1,173 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Colors.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2D.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2DQuadRenderer.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <cstring>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestRenderSoftware_SoftwareBatch2DQuadRenderer = TestFixtureFslGraphics;
+
+  std::vector<uint32_t> CreateTexels(const uint32_t width, const uint32_t height)
+  {
+    std::vector<uint32_t> texels(std::size_t(width) * height);
+    for (std::size_t i = 0; i < texels.size(); ++i)
+    {
+      texels[i] = static_cast<uint32_t>((i * 2654435761u) ^ 0x80000000u);
+    }
+    return texels;
+  }
+
+  std::vector<uint8_t> Render(const std::shared_ptr<WorkerThreadPool>& workerPool, const SoftwareTextureInfo& textureInfo)
+  {
+    const auto extentPx = PxExtent2D::Create(300, 200);
+    auto quadRenderer = std::make_shared<SoftwareBatch2DQuadRenderer>(extentPx, workerPool);
+    SoftwareBatch2D batch(quadRenderer, extentPx);
+    quadRenderer->Clear(Colors::DarkBlue());
+
+    std::mt19937 random(1234);
+    std::uniform_real_distribution<float> position(-20.0f, 320.0f);
+    std::uniform_real_distribution<float> size(1.0f, 90.0f);
+    std::uniform_real_distribution<float> rotation(0.0f, 6.28f);
+    const std::array<BlendState, 4> blendStates = {BlendState::AlphaBlend, BlendState::Additive, BlendState::NonPremultiplied, BlendState::Sdf};
+    for (const BlendState blendState : blendStates)
+    {
+      batch.Begin(blendState);
+      for (uint32_t i = 0; i < 100; ++i)
+      {
+        const Color color(static_cast<uint32_t>(random()) | 0x40000000u);
+        if ((i % 4) == 0)
+        {
+          batch.Draw(textureInfo, Vector2(position(random), position(random)), color, rotation(random), Vector2(8, 8), Vector2(2.5f, 1.5f));
+        }
+        else
+        {
+          batch.Draw(textureInfo, PxAreaRectangleF::Create(position(random), position(random), size(random), size(random)), color);
+        }
+      }
+      batch.End();
+    }
+
+    const ReadOnlyRawBitmap target = quadRenderer->GetTarget();
+    const auto* const pContent = static_cast<const uint8_t*>(target.Content());
+    return {pContent, pContent + target.GetByteSize()};
+  }
+}
+
+
+TEST(TestRenderSoftware_SoftwareBatch2DQuadRenderer, Construct)
+{
+  SoftwareBatch2DQuadRenderer quadRenderer(PxExtent2D::Create(100, 70));
+
+  EXPECT_EQ(PxExtent2D::Create(100, 70), quadRenderer.GetExtent());
+  const ReadOnlyRawBitmap target = quadRenderer.GetTarget();
+  EXPECT_EQ(PxExtent2D::Create(100, 70), target.GetExtent());
+  EXPECT_EQ(PixelFormat::R8G8B8A8_UNORM, target.GetPixelFormat());
+  EXPECT_EQ(BitmapOrigin::UpperLeft, target.GetOrigin());
+}
+
+
+TEST(TestRenderSoftware_SoftwareBatch2DQuadRenderer, SetExtent)
+{
+  SoftwareBatch2DQuadRenderer quadRenderer(PxExtent2D::Create(100, 70));
+  quadRenderer.SetExtent(PxExtent2D::Create(10, 20));
+
+  EXPECT_EQ(PxExtent2D::Create(10, 20), quadRenderer.GetExtent());
+  EXPECT_EQ(PxExtent2D::Create(10, 20), quadRenderer.GetTarget().GetExtent());
+}
+
+
+TEST(TestRenderSoftware_SoftwareBatch2DQuadRenderer, BeginEnd_InvalidUsage)
+{
+  SoftwareBatch2DQuadRenderer quadRenderer(PxExtent2D::Create(10, 10));
+  const PxSize2D sizePx = PxSize2D::Create(10, 10);
+
+  EXPECT_THROW(quadRenderer.End(), UsageErrorException);
+  quadRenderer.Begin(sizePx, BlendState::Opaque, BatchSdfRenderConfig(), false);
+  EXPECT_THROW(quadRenderer.Begin(sizePx, BlendState::Opaque, BatchSdfRenderConfig(), false), UsageErrorException);
+  EXPECT_THROW(quadRenderer.SetExtent(PxExtent2D::Create(20, 20)), UsageErrorException);
+  quadRenderer.End();
+}
+
+
+TEST(TestRenderSoftware_SoftwareBatch2DQuadRenderer, DrawQuads_RasterizedOnFlush)
+{
+  const std::vector<uint32_t> texels(1, 0xFFFFFFFF);
+  const SoftwareTextureInfo textureInfo(texels.data(), PxExtent2D::Create(1, 1), Texture2DFilterHint::Nearest);
+  SoftwareBatch2DQuadRenderer quadRenderer(PxExtent2D::Create(4, 4));
+
+  const std::array<VertexPositionColorTexture, 4> quad = {
+    VertexPositionColorTexture(Vector3(0, 0, 0), Colors::White(), Vector2(0, 0)),
+    VertexPositionColorTexture(Vector3(4, 0, 0), Colors::White(), Vector2(1, 0)),
+    VertexPositionColorTexture(Vector3(0, 4, 0), Colors::White(), Vector2(0, 1)),
+    VertexPositionColorTexture(Vector3(4, 4, 0), Colors::White(), Vector2(1, 1)),
+  };
+  quadRenderer.Begin(PxSize2D::Create(4, 4), BlendState::Opaque, BatchSdfRenderConfig(), false);
+  quadRenderer.DrawQuads(quad.data(), 1u, textureInfo);
+  quadRenderer.End();
+
+  EXPECT_EQ(1u, quadRenderer.GetStats().DrawCalls);
+  EXPECT_EQ(4u, quadRenderer.GetStats().Vertices);
+
+  const ReadOnlyRawBitmap target = quadRenderer.GetTarget();
+  const auto* const pPixels = static_cast<const uint32_t*>(target.Content());
+  for (uint32_t i = 0; i < 16u; ++i)
+  {
+    EXPECT_EQ(0xFFFFFFFFu, pPixels[i]);
+  }
+}
+
+
+TEST(TestRenderSoftware_SoftwareBatch2DQuadRenderer, WorkerPool_SameResultAsSerial)
+{
+  const std::vector<uint32_t> texels = CreateTexels(16, 16);
+  const SoftwareTextureInfo textureInfo(texels.data(), PxExtent2D::Create(16, 16), Texture2DFilterHint::Smooth);
+
+  const std::vector<uint8_t> serial = Render({}, textureInfo);
+  const std::vector<uint8_t> parallel = Render(std::make_shared<WorkerThreadPool>(3u), textureInfo);
+
+  ASSERT_EQ(serial.size(), parallel.size());
+  EXPECT_EQ(0, std::memcmp(serial.data(), parallel.data(), serial.size()));
+}
@@ -0,0 +1,404 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Colors.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2DQuadRenderer.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeBatch2D.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeGraphics.hpp>
+#include <FslGraphics/Render/Texture2D.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/Render/NativeGraphicsTestImpl.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <cstdlib>
+#include <memory>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestRenderSoftware_SoftwareNativeBatch2D = TestFixtureFslGraphics;
+
+  constexpr uint32_t Red = 0xFF0000FF;
+  constexpr uint32_t Green = 0xFF00FF00;
+  constexpr uint32_t Blue = 0xFFFF0000;
+  constexpr uint32_t White = 0xFFFFFFFF;
+  constexpr uint32_t Black = 0xFF000000;
+
+  struct Scene
+  {
+    std::shared_ptr<SoftwareNativeGraphics> NativeGraphics;
+    std::shared_ptr<SoftwareBatch2DQuadRenderer> QuadRenderer;
+    SoftwareNativeBatch2D Batch;
+
+    explicit Scene(const PxExtent2D extentPx)
+      : NativeGraphics(std::make_shared<SoftwareNativeGraphics>())
+      , QuadRenderer(std::make_shared<SoftwareBatch2DQuadRenderer>(extentPx))
+      , Batch(QuadRenderer, extentPx)
+    {
+    }
+
+    Texture2D CreateTexture(const Bitmap& bitmap, const Texture2DFilterHint filterHint = Texture2DFilterHint::Nearest) const
+    {
+      return {NativeGraphics, bitmap, filterHint};
+    }
+
+    Bitmap GetResult() const
+    {
+      const ReadOnlyRawBitmap target = QuadRenderer->GetTarget();
+      const ReadOnlySpan<uint8_t> contentSpan(static_cast<const uint8_t*>(target.Content()), target.GetByteSize());
+      return {contentSpan, target.GetExtent(), target.GetPixelFormat()};
+    }
+  };
+
+  Bitmap CreateBitmap(const int32_t width, const int32_t height, const uint32_t color,
+                      const BitmapOrigin bitmapOrigin = BitmapOrigin::UpperLeft)
+  {
+    Bitmap bitmap(PxSize2D::Create(width, height), PixelFormat::R8G8B8A8_UNORM, bitmapOrigin);
+    for (int32_t y = 0; y < height; ++y)
+    {
+      for (int32_t x = 0; x < width; ++x)
+      {
+        bitmap.SetNativePixel(x, y, color);
+      }
+    }
+    return bitmap;
+  }
+
+  bool IsNear(const uint32_t expected, const uint32_t actual, const int32_t tolerance = 1)
+  {
+    for (uint32_t shift = 0; shift < 32; shift += 8)
+    {
+      if (std::abs(static_cast<int32_t>((expected >> shift) & 0xFF) - static_cast<int32_t>((actual >> shift) & 0xFF)) > tolerance)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  uint32_t CountPixels(const Bitmap& bitmap, const uint32_t color)
+  {
+    uint32_t count = 0;
+    for (int32_t y = 0; y < bitmap.RawHeight(); ++y)
+    {
+      for (int32_t x = 0; x < bitmap.RawWidth(); ++x)
+      {
+        count += bitmap.GetNativePixel(x, y) == color ? 1u : 0u;
+      }
+    }
+    return count;
+  }
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Construct)
+{
+  Scene scene(PxExtent2D::Create(16, 8));
+
+  EXPECT_FALSE(scene.Batch.SYS_IsTextureCoordinateYFlipped());
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(PxExtent2D::Create(16, 8), result.GetExtent());
+  EXPECT_EQ(PixelFormat::R8G8B8A8_UNORM, result.GetPixelFormat());
+  EXPECT_EQ(16u * 8u, CountPixels(result, 0u));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Clear)
+{
+  Scene scene(PxExtent2D::Create(16, 8));
+  scene.QuadRenderer->Clear(Colors::Red());
+
+  EXPECT_EQ(16u * 8u, CountPixels(scene.GetResult(), Red));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_Opaque_Nearest)
+{
+  Scene scene(PxExtent2D::Create(8, 8));
+  scene.QuadRenderer->Clear(Colors::Black());
+
+  Bitmap bitmap(PxSize2D::Create(2, 2), PixelFormat::R8G8B8A8_UNORM);
+  bitmap.SetNativePixel(0, 0, Red);
+  bitmap.SetNativePixel(1, 0, Green);
+  bitmap.SetNativePixel(0, 1, Blue);
+  bitmap.SetNativePixel(1, 1, White);
+  const Texture2D texture = scene.CreateTexture(bitmap);
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(2, 2, 4, 4), Colors::White());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(Black, result.GetNativePixel(1, 1));
+  EXPECT_EQ(Red, result.GetNativePixel(2, 2));
+  EXPECT_EQ(Red, result.GetNativePixel(3, 3));
+  EXPECT_EQ(Green, result.GetNativePixel(4, 2));
+  EXPECT_EQ(Green, result.GetNativePixel(5, 3));
+  EXPECT_EQ(Blue, result.GetNativePixel(2, 4));
+  EXPECT_EQ(White, result.GetNativePixel(5, 5));
+  EXPECT_EQ(Black, result.GetNativePixel(6, 6));
+  EXPECT_EQ(64u - 16u, CountPixels(result, Black));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_LowerLeftOriginIsFlipped)
+{
+  Scene scene(PxExtent2D::Create(2, 2));
+
+  Bitmap bitmap(PxSize2D::Create(1, 2), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::LowerLeft);
+  // SetNativePixel always uses the upper left corner as 0,0
+  bitmap.SetNativePixel(0, 0, Red);
+  bitmap.SetNativePixel(0, 1, Green);
+  const Texture2D texture = scene.CreateTexture(bitmap);
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 2, 2), Colors::White());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(Red, result.GetNativePixel(0, 0));
+  EXPECT_EQ(Green, result.GetNativePixel(1, 1));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_PixelCenterCoverage)
+{
+  Scene scene(PxExtent2D::Create(8, 1));
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, White));
+
+  scene.Batch.Begin(BlendState::Opaque);
+  // Covers the pixel centers 1.5 and 2.5
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(1.4f, 0.0f, 1.6f, 1.0f), Colors::White());
+  // Covers no pixel centers
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(5.6f, 0.0f, 0.8f, 1.0f), Colors::White());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(0u, result.GetNativePixel(0, 0));
+  EXPECT_EQ(White, result.GetNativePixel(1, 0));
+  EXPECT_EQ(White, result.GetNativePixel(2, 0));
+  EXPECT_EQ(0u, result.GetNativePixel(3, 0));
+  EXPECT_EQ(2u, CountPixels(result, White));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_AdjacentQuadsDoNotOverlap)
+{
+  Scene scene(PxExtent2D::Create(8, 1));
+  scene.QuadRenderer->Clear(Colors::Black());
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, 0xFF404040));
+
+  scene.Batch.Begin(BlendState::Additive);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0.0f, 0.0f, 3.5f, 1.0f), Colors::White());
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(3.5f, 0.0f, 4.5f, 1.0f), Colors::White());
+  scene.Batch.End();
+
+  EXPECT_EQ(8u, CountPixels(scene.GetResult(), 0xFF404040));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_Outside)
+{
+  Scene scene(PxExtent2D::Create(8, 8));
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, White));
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(-100, -100, 50, 50), Colors::White());
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(100, 100, 50, 50), Colors::White());
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(-1.0e20f, 6.0f, 2.0e20f, 1.0f), Colors::White());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(8u, CountPixels(result, White));
+  EXPECT_EQ(White, result.GetNativePixel(0, 6));
+  EXPECT_EQ(White, result.GetNativePixel(7, 6));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_ColorModulates)
+{
+  Scene scene(PxExtent2D::Create(4, 4));
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, White));
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 4), Color(0x40, 0x80, 0xC0, 0xFF));
+  scene.Batch.End();
+
+  EXPECT_EQ(16u, CountPixels(scene.GetResult(), 0xFFC08040));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_AlphaBlend)
+{
+  Scene scene(PxExtent2D::Create(4, 4));
+  scene.QuadRenderer->Clear(Colors::Red());
+  // A premultiplied 50% blue
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, 0x80800000));
+
+  scene.Batch.Begin(BlendState::AlphaBlend);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 4), Colors::White());
+  scene.Batch.End();
+
+  const uint32_t pixel = scene.GetResult().GetNativePixel(1, 1);
+  EXPECT_TRUE(IsNear(0xFF80007F, pixel)) << std::hex << pixel;
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_NonPremultiplied)
+{
+  Scene scene(PxExtent2D::Create(4, 4));
+  scene.QuadRenderer->Clear(Colors::Red());
+  // A non premultiplied 50% blue
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, 0x80FF0000));
+
+  scene.Batch.Begin(BlendState::NonPremultiplied);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 4), Colors::White());
+  scene.Batch.End();
+
+  // alpha = 0.5 * 0.5 + 1.0 * 0.5
+  const uint32_t pixel = scene.GetResult().GetNativePixel(1, 1);
+  EXPECT_TRUE(IsNear(0xBF80007F, pixel)) << std::hex << pixel;
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_AdditiveSaturates)
+{
+  Scene scene(PxExtent2D::Create(4, 4));
+  scene.QuadRenderer->Clear(Color(0xC0, 0x10, 0x00, 0xFF));
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(1, 1, 0x00002080));
+
+  scene.Batch.Begin(BlendState::Additive);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 4), Colors::White());
+  scene.Batch.End();
+
+  EXPECT_EQ(16u, CountPixels(scene.GetResult(), 0xFF0030FF));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_Bilinear)
+{
+  Scene scene(PxExtent2D::Create(4, 1));
+  Bitmap bitmap(PxSize2D::Create(2, 1), PixelFormat::R8G8B8A8_UNORM);
+  bitmap.SetNativePixel(0, 0, Black);
+  bitmap.SetNativePixel(1, 0, White);
+  const Texture2D texture = scene.CreateTexture(bitmap, Texture2DFilterHint::Smooth);
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 1), Colors::White());
+  scene.Batch.End();
+
+  // The pixel centers sample the texture at 0.25, 0.75, 1.25 and 1.75 texels which is clamped at the edges
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(Black, result.GetNativePixel(0, 0));
+  EXPECT_TRUE(IsNear(0xFF404040, result.GetNativePixel(1, 0))) << std::hex << result.GetNativePixel(1, 0);
+  EXPECT_TRUE(IsNear(0xFFBFBFBF, result.GetNativePixel(2, 0))) << std::hex << result.GetNativePixel(2, 0);
+  EXPECT_EQ(White, result.GetNativePixel(3, 0));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_Sdf)
+{
+  Scene scene(PxExtent2D::Create(3, 1));
+  scene.QuadRenderer->Clear(Colors::Black());
+
+  // The alpha channel holds the distance, 0.5 is the edge
+  Bitmap bitmap(PxSize2D::Create(3, 1), PixelFormat::R8G8B8A8_UNORM);
+  bitmap.SetNativePixel(0, 0, 0x00000000);
+  bitmap.SetNativePixel(1, 0, 0x80000000);
+  bitmap.SetNativePixel(2, 0, 0xFF000000);
+  const Texture2D texture = scene.CreateTexture(bitmap);
+
+  scene.Batch.Begin(BlendState::Sdf);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 3, 1), Colors::Green());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(Black, result.GetNativePixel(0, 0));
+  const uint32_t edgePixel = result.GetNativePixel(1, 0);
+  EXPECT_GT((edgePixel >> 8) & 0xFF, 0x60u);
+  EXPECT_LT((edgePixel >> 8) & 0xFF, 0xA0u);
+  EXPECT_EQ(Green, result.GetNativePixel(2, 0));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_Rotated)
+{
+  Scene scene(PxExtent2D::Create(16, 16));
+  const Texture2D texture = scene.CreateTexture(CreateBitmap(4, 2, White));
+
+  scene.Batch.Begin(BlendState::Opaque);
+  // Rotate the 4x2 texture 90 degrees around its center placed at 8,8 so it becomes 2x4
+  scene.Batch.Draw(texture, Vector2(8, 8), Colors::White(), MathHelper::ToRadians(90), Vector2(2, 1), Vector2(1, 1));
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ(8u, CountPixels(result, White));
+  EXPECT_EQ(White, result.GetNativePixel(7, 6));
+  EXPECT_EQ(White, result.GetNativePixel(8, 9));
+  EXPECT_EQ(0u, result.GetNativePixel(6, 6));
+  EXPECT_EQ(0u, result.GetNativePixel(9, 9));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_OrderIsKeptAcrossTiles)
+{
+  Scene scene(PxExtent2D::Create(200, 100));
+  const Texture2D red = scene.CreateTexture(CreateBitmap(1, 1, Red));
+  const Texture2D green = scene.CreateTexture(CreateBitmap(1, 1, Green));
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(red, PxAreaRectangleF::Create(0, 0, 200, 100), Colors::White());
+  scene.Batch.Draw(green, PxAreaRectangleF::Create(50, 20, 100, 60), Colors::White());
+  scene.Batch.Draw(red, PxAreaRectangleF::Create(60, 30, 80, 40), Colors::White());
+  scene.Batch.End();
+
+  const Bitmap result = scene.GetResult();
+  EXPECT_EQ((100u * 60u) - (80u * 40u), CountPixels(result, Green));
+  EXPECT_EQ(Red, result.GetNativePixel(100, 50));
+  EXPECT_EQ(Green, result.GetNativePixel(55, 50));
+}
+
+
+TEST(TestRenderSoftware_SoftwareNativeBatch2D, Draw_ForeignTextureIsIgnored)
+{
+  Scene scene(PxExtent2D::Create(4, 4));
+  const Texture2D texture(std::make_shared<NativeGraphicsTestImpl>(), CreateBitmap(1, 1, White), Texture2DFilterHint::Nearest);
+
+  scene.Batch.Begin(BlendState::Opaque);
+  scene.Batch.Draw(texture, PxAreaRectangleF::Create(0, 0, 4, 4), Colors::White());
+  scene.Batch.End();
+
+  EXPECT_EQ(16u, CountPixels(scene.GetResult(), 0u));
+}
@@ -0,0 +1,324 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/Sdf/SdfGenerator.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestSdf_SdfGenerator = TestFixtureFslGraphics;
+
+  struct TestImage
+  {
+    uint32_t Width{0};
+    uint32_t Height{0};
+    std::vector<uint8_t> Content;
+
+    TestImage(const uint32_t width, const uint32_t height)
+      : Width(width)
+      , Height(height)
+      , Content(static_cast<std::size_t>(width) * height)
+    {
+    }
+
+    void Fill(const uint32_t x, const uint32_t y, const uint32_t width, const uint32_t height)
+    {
+      for (uint32_t dy = 0; dy < height; ++dy)
+      {
+        std::fill_n(Content.begin() + static_cast<std::ptrdiff_t>(((y + dy) * Width) + x), width, uint8_t(255));
+      }
+    }
+
+    bool IsInside(const int64_t x, const int64_t y) const
+    {
+      return x >= 0 && y >= 0 && x < Width && y < Height && Content[(y * Width) + x] >= 128u;
+    }
+
+    ReadOnlyRawBitmap AsBitmap() const
+    {
+      return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(Content), PxExtent2D::Create(Width, Height), PixelFormat::R8_UNORM,
+                                       BitmapOrigin::UpperLeft);
+    }
+  };
+
+  //! A irregular shape with holes
+  TestImage CreateBlob(const uint32_t width, const uint32_t height)
+  {
+    TestImage image(width, height);
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      for (uint32_t x = 0; x < width; ++x)
+      {
+        const float fx = static_cast<float>(x) / static_cast<float>(width);
+        const float fy = static_cast<float>(y) / static_cast<float>(height);
+        const bool inside = ((fx - 0.5f) * (fx - 0.5f)) + ((fy - 0.45f) * (fy - 0.45f)) < 0.12f && ((x / 3u) + (y / 5u)) % 4u != 0u;
+        image.Content[(y * width) + x] = inside ? 255u : 0u;
+      }
+    }
+    return image;
+  }
+
+  //! Brute force reference for a unscaled generation
+  uint8_t CalcExpected(const TestImage& image, const int64_t x, const int64_t y, const float distanceRangePx)
+  {
+    const bool inside = image.IsInside(x, y);
+    float best = std::numeric_limits<float>::max();
+    for (int64_t sy = 0; sy < image.Height; ++sy)
+    {
+      for (int64_t sx = 0; sx < image.Width; ++sx)
+      {
+        if (image.IsInside(sx, sy) != inside)
+        {
+          best = std::min(best, static_cast<float>(((sx - x) * (sx - x)) + ((sy - y) * (sy - y))));
+        }
+      }
+    }
+    // Pixels outside the image are outside the shape
+    if (inside)
+    {
+      const auto toEdgeX = static_cast<float>(std::min(x + 1, static_cast<int64_t>(image.Width) - x));
+      const auto toEdgeY = static_cast<float>(std::min(y + 1, static_cast<int64_t>(image.Height) - y));
+      best = std::min({best, toEdgeX * toEdgeX, toEdgeY * toEdgeY});
+    }
+    const float distance = inside ? (std::sqrt(best) - 0.5f) : (0.5f - std::sqrt(best));
+    const float value = std::clamp(0.5f + (distance / distanceRangePx), 0.0f, 1.0f);
+    return static_cast<uint8_t>((value * 255.0f) + 0.5f);
+  }
+
+  uint8_t GetPixel(const Bitmap& bitmap, const uint32_t x, const uint32_t y)
+  {
+    const Bitmap::ScopedDirectReadAccess access(bitmap);
+    return static_cast<const uint8_t*>(access.AsRawBitmap().Content())[(y * access.AsRawBitmap().Stride()) + x];
+  }
+
+  void ExpectEqualContent(const Bitmap& lhs, const Bitmap& rhs)
+  {
+    ASSERT_EQ(lhs.GetExtent(), rhs.GetExtent());
+    for (uint32_t y = 0; y < lhs.RawUnsignedHeight(); ++y)
+    {
+      for (uint32_t x = 0; x < lhs.RawUnsignedWidth(); ++x)
+      {
+        ASSERT_EQ(GetPixel(lhs, x, y), GetPixel(rhs, x, y)) << "at " << x << "," << y;
+      }
+    }
+  }
+}
+
+
+TEST(TestSdf_SdfGenerator, CalcPaddingPx)
+{
+  EXPECT_EQ(2u, SdfGenerator::CalcPaddingPx(SdfGeneratorConfig(128, 1, 4.0f)));
+  EXPECT_EQ(3u, SdfGenerator::CalcPaddingPx(SdfGeneratorConfig(128, 1, 5.0f)));
+  EXPECT_THROW(SdfGenerator::CalcPaddingPx(SdfGeneratorConfig(128, 0, 4.0f)), std::invalid_argument);
+  EXPECT_THROW(SdfGenerator::CalcPaddingPx(SdfGeneratorConfig(128, 1, 0.0f)), std::invalid_argument);
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_Empty)
+{
+  const TestImage image(8, 8);
+  const SdfGenerator generator;
+
+  const Bitmap result = generator.Generate(image.AsBitmap(), SdfGeneratorConfig(128, 1, 4.0f));
+
+  EXPECT_EQ(PxExtent2D::Create(12, 12), result.GetExtent());
+  EXPECT_EQ(PixelFormat::R8_UNORM, result.GetPixelFormat());
+  EXPECT_EQ(0u, GetPixel(result, 0, 0));
+  EXPECT_EQ(0u, GetPixel(result, 6, 6));
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_Square)
+{
+  TestImage image(8, 8);
+  image.Fill(2, 2, 4, 4);
+  const SdfGenerator generator;
+
+  const Bitmap result = generator.Generate(image.AsBitmap(), SdfGeneratorConfig(128, 1, 4.0f));
+
+  // padding 2, so the square covers [4,8)
+  // The edge is half a pixel away from the pixels next to it: 0.5 +- 0.5 / 4
+  EXPECT_EQ(159u, GetPixel(result, 4, 5));
+  EXPECT_EQ(96u, GetPixel(result, 3, 5));
+  // Two pixels inside
+  EXPECT_EQ(223u, GetPixel(result, 5, 5));
+  // Symmetric
+  EXPECT_EQ(GetPixel(result, 4, 5), GetPixel(result, 7, 5));
+  EXPECT_EQ(GetPixel(result, 3, 5), GetPixel(result, 8, 5));
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_MatchesBruteForce)
+{
+  const TestImage image = CreateBlob(24, 20);
+  const SdfGeneratorConfig config(128, 1, 6.0f);
+  const SdfGenerator generator;
+
+  const Bitmap result = generator.Generate(image.AsBitmap(), config);
+
+  const auto paddingPx = static_cast<int64_t>(SdfGenerator::CalcPaddingPx(config));
+  ASSERT_EQ(PxExtent2D::Create(24 + (2 * paddingPx), 20 + (2 * paddingPx)), result.GetExtent());
+  for (uint32_t y = 0; y < result.RawUnsignedHeight(); ++y)
+  {
+    for (uint32_t x = 0; x < result.RawUnsignedWidth(); ++x)
+    {
+      ASSERT_EQ(CalcExpected(image, x - paddingPx, y - paddingPx, config.DistanceRangePx), GetPixel(result, x, y)) << "at " << x << "," << y;
+    }
+  }
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_ParallelMatchesSerial)
+{
+  const TestImage image = CreateBlob(300, 200);
+  const SdfGeneratorConfig config(128, 2, 8.0f);
+
+  const Bitmap serial = SdfGenerator().Generate(image.AsBitmap(), config);
+  const Bitmap parallel = SdfGenerator(std::make_shared<WorkerThreadPool>(3)).Generate(image.AsBitmap(), config);
+
+  ExpectEqualContent(serial, parallel);
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_Downscale)
+{
+  TestImage image(32, 32);
+  image.Fill(8, 8, 16, 16);
+  const SdfGenerator generator;
+
+  const Bitmap result = generator.Generate(image.AsBitmap(), SdfGeneratorConfig(128, 4, 4.0f));
+
+  // 32 / 4 + 2 * 2
+  EXPECT_EQ(PxExtent2D::Create(12, 12), result.GetExtent());
+  // The square covers output pixels [4,8) so the center is inside and the corner far outside
+  EXPECT_GT(GetPixel(result, 6, 6), 128u);
+  EXPECT_LT(GetPixel(result, 3, 6), 128u);
+  EXPECT_EQ(0u, GetPixel(result, 0, 0));
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_LowerLeftOrigin)
+{
+  TestImage image(8, 8);
+  image.Fill(0, 0, 8, 2);
+  const auto flipped = ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(image.Content), PxExtent2D::Create(8, 8), PixelFormat::R8_UNORM,
+                                                 BitmapOrigin::LowerLeft);
+  const SdfGenerator generator;
+
+  const Bitmap result = generator.Generate(flipped, SdfGeneratorConfig(128, 1, 4.0f));
+
+  // The filled rows are at the bottom of the image
+  EXPECT_LT(GetPixel(result, 5, 3), 128u);
+  EXPECT_GT(GetPixel(result, 5, 8), 128u);
+}
+
+
+TEST(TestSdf_SdfGenerator, Generate_UnsupportedFormat)
+{
+  const std::vector<uint8_t> content(4 * 4 * 3);
+  const auto bitmap =
+    ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(content), PxExtent2D::Create(4, 4), PixelFormat::R8G8B8_UNORM, BitmapOrigin::UpperLeft);
+
+  EXPECT_THROW(SdfGenerator().Generate(bitmap, SdfGeneratorConfig()), NotSupportedException);
+}
+
+
+TEST(TestSdf_SdfGenerator, GenerateFont)
+{
+  // Two 8x8 glyphs and a space at 4x the output resolution
+  TestImage image(64, 32);
+  image.Fill(0, 0, 32, 32);
+  image.Fill(40, 8, 16, 16);
+  const std::vector<BitmapFontChar> chars = {
+    BitmapFontChar(32, PxRectangleU32(), PxPoint2(), PxValueU16(16)),
+    BitmapFontChar(65, PxRectangleU32::Create(0, 0, 32, 32), PxPoint2::Create(4, 8), PxValueU16(36)),
+    BitmapFontChar(66, PxRectangleU32::Create(32, 0, 32, 32), PxPoint2::Create(-4, 8), PxValueU16(40)),
+  };
+  const std::vector<BitmapFontKerning> kernings = {BitmapFontKerning(65, 66, PxValue(-8))};
+  const BitmapFont srcFont(std::string("test"), 160, 64, PxValueU16(72), PxValueU16(56), PxThicknessU16::Create(4, 4, 4, 4),
+                           std::string("test.png"), BitmapFontType::Bitmap, BitmapFontSdfParams(), chars, kernings);
+  const SdfGeneratorConfig config(128, 4, 4.0f);
+
+  const SdfGeneratorFontResult result = SdfGenerator(std::make_shared<WorkerThreadPool>(2)).GenerateFont(srcFont, image.AsBitmap(), config);
+
+  const BitmapFont& font = result.Font;
+  EXPECT_EQ(BitmapFontType::SDF, font.GetFontType());
+  EXPECT_EQ(BitmapFontSdfParams(4.0f, 1.0f), font.GetSdfParams());
+  EXPECT_EQ(16u, font.GetSize());
+  EXPECT_EQ(PxValueU16(18), font.GetLineSpacingPx());
+  EXPECT_EQ(PxValueU16(14), font.GetBaseLinePx());
+  EXPECT_EQ(PxThicknessU16::Create(3, 3, 3, 3), font.GetPaddingPx());
+  EXPECT_EQ(PixelFormat::R8_UNORM, result.FontBitmap.GetPixelFormat());
+
+  ASSERT_EQ(3u, font.GetCharCount());
+  const auto dstChars = font.GetChars();
+  EXPECT_EQ(PxRectangleU32(), dstChars[0].SrcTextureRectPx);
+  EXPECT_EQ(PxValueU16(4), dstChars[0].XAdvancePx);
+  // 8 pixels + 2 * 2 padding
+  EXPECT_EQ(PxExtent2D::Create(12, 12), dstChars[1].SrcTextureRectPx.GetExtent());
+  EXPECT_EQ(PxPoint2::Create(1 - 2, 2 - 2), dstChars[1].OffsetPx);
+  EXPECT_EQ(PxValueU16(9), dstChars[1].XAdvancePx);
+  EXPECT_EQ(PxPoint2::Create(-1 - 2, 2 - 2), dstChars[2].OffsetPx);
+  EXPECT_FALSE(dstChars[1].SrcTextureRectPx.Intersects(dstChars[2].SrcTextureRectPx));
+
+  const PxRectangleU32 atlasRectPx(PxValueU(0), PxValueU(0), result.FontBitmap.UnsignedWidth(), result.FontBitmap.UnsignedHeight());
+  EXPECT_TRUE(atlasRectPx.Contains(dstChars[1].SrcTextureRectPx));
+  EXPECT_TRUE(atlasRectPx.Contains(dstChars[2].SrcTextureRectPx));
+
+  // The fully filled glyph is inside at its center
+  const PxPoint2U center = dstChars[1].SrcTextureRectPx.GetCenter();
+  EXPECT_GT(GetPixel(result.FontBitmap, center.X.Value, center.Y.Value), 128u);
+
+  ASSERT_EQ(1u, font.GetKerningsCount());
+  EXPECT_EQ(PxValue(-2), font.GetKernings()[0].AmountPx);
+}
+
+
+TEST(TestSdf_SdfGenerator, GenerateFont_NotBitmapFont)
+{
+  const TestImage image(8, 8);
+  const BitmapFont srcFont(std::string("test"), 160, 64, PxValueU16(72), PxValueU16(56), PxThicknessU16(), std::string("test.png"),
+                           BitmapFontType::SDF, BitmapFontSdfParams(4.0f, 1.0f), std::vector<BitmapFontChar>(), std::vector<BitmapFontKerning>());
+
+  EXPECT_THROW(SdfGenerator().GenerateFont(srcFont, image.AsBitmap(), SdfGeneratorConfig()), UsageErrorException);
+}
@@ -0,0 +1,250 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayout.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutCache.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFontLayout_TextLayout = TestFixtureFslGraphics;
+
+  constexpr uint16_t FontDpi = 160;
+
+  TextureAtlasSpriteFont CreateTestFont()
+  {
+    std::vector<BitmapFontChar> chars;
+    chars.emplace_back(' ', PxRectangleU32::Create(0, 0, 0, 0), PxPoint2(), PxValueU16(10));
+    const std::string glyphs("abcdefghijklmnopqrstuvwxyz0123456789:.");
+    for (std::size_t i = 0; i < glyphs.size(); ++i)
+    {
+      chars.emplace_back(static_cast<uint32_t>(glyphs[i]), PxRectangleU32::Create(static_cast<uint32_t>(i) * 10u, 0, 8, 10), PxPoint2(),
+                         PxValueU16(10));
+    }
+    const BitmapFont font(std::string("Test"), FontDpi, 10, PxValueU16(12), PxValueU16(10), PxThicknessU16(), std::string("Test.png"),
+                          BitmapFontType::Bitmap, BitmapFontSdfParams(), std::move(chars), std::vector<BitmapFontKerning>());
+    return TextureAtlasSpriteFont(SpriteNativeAreaCalc(false), PxExtent2D::Create(512, 512), font, FontDpi);
+  }
+
+  TextLayoutConfig CreateConfig(const int32_t maxWidthPx, const TextLineBreakMode mode = TextLineBreakMode::Greedy)
+  {
+    return {PxSize1D::Create(maxWidthPx), BitmapFontConfig(), mode};
+  }
+
+  //! Check that a layout matches a full layout of the same text
+  void ExpectMatchesFullLayout(const TextLayout& layout, const TextureAtlasSpriteFont& font)
+  {
+    TextLayout fullLayout;
+    fullLayout.SetText(font, layout.GetText(), layout.GetConfig());
+
+    const auto lines = layout.GetLines();
+    const auto expectedLines = fullLayout.GetLines();
+    ASSERT_EQ(expectedLines.size(), lines.size());
+    for (std::size_t i = 0; i < lines.size(); ++i)
+    {
+      EXPECT_EQ(expectedLines[i], lines[i]);
+    }
+
+    const auto glyphs = layout.GetGlyphs();
+    const auto expectedGlyphs = fullLayout.GetGlyphs();
+    ASSERT_EQ(expectedGlyphs.size(), glyphs.size());
+    for (std::size_t i = 0; i < glyphs.size(); ++i)
+    {
+      EXPECT_EQ(expectedGlyphs[i].DstRectPxf, glyphs[i].DstRectPxf);
+      EXPECT_EQ(expectedGlyphs[i].TextureArea, glyphs[i].TextureArea);
+    }
+    EXPECT_EQ(fullLayout.GetSizePx(), layout.GetSizePx());
+  }
+}
+
+
+TEST(TestFontLayout_TextLayout, Construct_Default)
+{
+  TextLayout layout;
+  EXPECT_TRUE(layout.GetText().empty());
+  EXPECT_TRUE(layout.GetLines().empty());
+  EXPECT_TRUE(layout.GetGlyphs().empty());
+  EXPECT_EQ(PxSize2D(), layout.GetSizePx());
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayout layout;
+
+  EXPECT_TRUE(layout.SetText(font, StringViewLite("aaa bbb ccc"), CreateConfig(70)));
+  EXPECT_EQ(2u, layout.GetLines().size());
+  EXPECT_EQ(10u, layout.GetGlyphs().size());
+  EXPECT_EQ(PxSize2D::Create(68, 24), layout.GetSizePx());
+
+  // Nothing changed
+  EXPECT_FALSE(layout.SetText(font, StringViewLite("aaa bbb ccc"), CreateConfig(70)));
+  // The config changed
+  EXPECT_TRUE(layout.SetText(font, StringViewLite("aaa bbb ccc"), CreateConfig(200)));
+  EXPECT_EQ(1u, layout.GetLines().size());
+
+  layout.Clear();
+  EXPECT_TRUE(layout.GetLines().empty());
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText_NumericSuffixChange)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayout layout;
+
+  layout.SetText(font, StringViewLite("frames per second value: 1"), CreateConfig(100));
+  ASSERT_EQ(3u, layout.GetLines().size());
+
+  layout.SetText(font, StringViewLite("frames per second value: 42"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+
+  // The suffix grows so it no longer fits on the last line
+  layout.SetText(font, StringViewLite("frames per second value: 123456789"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+  EXPECT_EQ(4u, layout.GetLines().size());
+
+  // And shrinks again
+  layout.SetText(font, StringViewLite("frames per second value: 7"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+  EXPECT_EQ(3u, layout.GetLines().size());
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText_ChangeBeforeLastLine)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayout layout;
+
+  layout.SetText(font, StringViewLite("frames per second value: 1"), CreateConfig(100));
+  // The first word of the last line decides the previous break, so changing it requires a full layout
+  layout.SetText(font, StringViewLite("frames per second v: 1"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+
+  layout.SetText(font, StringViewLite("fr per second v: 1"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText_NewLine)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayout layout;
+
+  layout.SetText(font, StringViewLite("title\nfps: 60"), CreateConfig(100));
+  ASSERT_EQ(2u, layout.GetLines().size());
+  layout.SetText(font, StringViewLite("title\nfps: 59"), CreateConfig(100));
+  ExpectMatchesFullLayout(layout, font);
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText_Optimal)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayout layout;
+
+  layout.SetText(font, StringViewLite("aaa bb cc ddddd"), CreateConfig(60, TextLineBreakMode::Optimal));
+  layout.SetText(font, StringViewLite("aaa bb cc dddd"), CreateConfig(60, TextLineBreakMode::Optimal));
+  ExpectMatchesFullLayout(layout, font);
+}
+
+
+TEST(TestFontLayout_TextLayout, SetText_Cache)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayoutCache cache;
+  TextLayout layout0;
+  TextLayout layout1;
+
+  layout0.SetText(font, StringViewLite("aaa bbb ccc"), CreateConfig(70), &cache);
+  layout1.SetText(font, StringViewLite("aaa bbb ccc"), CreateConfig(70), &cache);
+  EXPECT_EQ(1u, cache.GetMissCount());
+  EXPECT_EQ(1u, cache.GetHitCount());
+  EXPECT_EQ(1u, cache.Count());
+  ExpectMatchesFullLayout(layout1, font);
+}
+
+
+TEST(TestFontLayout_TextLayoutCache, Construct_InvalidCapacity)
+{
+  EXPECT_THROW(TextLayoutCache(0), std::invalid_argument);
+}
+
+
+TEST(TestFontLayout_TextLayoutCache, BreakLines)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayoutCache cache(2);
+
+  const auto lines = cache.BreakLines(font, StringViewLite("aaa bbb ccc"), CreateConfig(70));
+  EXPECT_EQ(2u, lines.size());
+  EXPECT_EQ(0u, cache.GetHitCount());
+  EXPECT_EQ(1u, cache.GetMissCount());
+
+  // A different width is a different key
+  EXPECT_EQ(1u, cache.BreakLines(font, StringViewLite("aaa bbb ccc"), CreateConfig(200)).size());
+  EXPECT_EQ(2u, cache.GetMissCount());
+  EXPECT_EQ(2u, cache.BreakLines(font, StringViewLite("aaa bbb ccc"), CreateConfig(70)).size());
+  EXPECT_EQ(1u, cache.GetHitCount());
+  EXPECT_EQ(2u, cache.Count());
+}
+
+
+TEST(TestFontLayout_TextLayoutCache, BreakLines_EvictsLeastRecentlyUsed)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  TextLayoutCache cache(2);
+
+  cache.BreakLines(font, StringViewLite("a"), CreateConfig(70));
+  cache.BreakLines(font, StringViewLite("b"), CreateConfig(70));
+  // Touch "a" so "b" becomes the least recently used
+  cache.BreakLines(font, StringViewLite("a"), CreateConfig(70));
+  cache.BreakLines(font, StringViewLite("c"), CreateConfig(70));
+  EXPECT_EQ(2u, cache.Count());
+  EXPECT_EQ(1u, cache.GetHitCount());
+  EXPECT_EQ(3u, cache.GetMissCount());
+
+  cache.BreakLines(font, StringViewLite("a"), CreateConfig(70));
+  EXPECT_EQ(2u, cache.GetHitCount());
+  cache.BreakLines(font, StringViewLite("b"), CreateConfig(70));
+  EXPECT_EQ(4u, cache.GetMissCount());
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Count());
+}
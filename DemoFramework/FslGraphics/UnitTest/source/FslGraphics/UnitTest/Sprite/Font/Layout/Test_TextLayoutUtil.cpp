@@ -0,0 +1,195 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutUtil.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestFontLayout_TextLayoutUtil = TestFixtureFslGraphics;
+
+  constexpr uint16_t FontDpi = 160;
+  constexpr auto GlyphWidthPx = 8;
+  constexpr auto AdvancePx = 10;
+  constexpr auto LineSpacingPx = 12;
+
+  //! A mono spaced font where a string of N characters is (N - 1) * AdvancePx + GlyphWidthPx wide
+  TextureAtlasSpriteFont CreateTestFont()
+  {
+    std::vector<BitmapFontChar> chars;
+    chars.emplace_back(' ', PxRectangleU32::Create(0, 0, 0, 0), PxPoint2(), PxValueU16(AdvancePx));
+    const std::string glyphs("abcdefghijklmnopqrstuvwxyz0123456789:.");
+    for (std::size_t i = 0; i < glyphs.size(); ++i)
+    {
+      chars.emplace_back(static_cast<uint32_t>(glyphs[i]), PxRectangleU32::Create(static_cast<uint32_t>(i) * 10u, 0, GlyphWidthPx, 10), PxPoint2(),
+                         PxValueU16(AdvancePx));
+    }
+    const BitmapFont font(std::string("Test"), FontDpi, 10, PxValueU16(LineSpacingPx), PxValueU16(10), PxThicknessU16(), std::string("Test.png"),
+                          BitmapFontType::Bitmap, BitmapFontSdfParams(), std::move(chars), std::vector<BitmapFontKerning>());
+    return TextureAtlasSpriteFont(SpriteNativeAreaCalc(false), PxExtent2D::Create(512, 512), font, FontDpi);
+  }
+
+  constexpr int32_t TextWidth(const int32_t charCount)
+  {
+    return ((charCount - 1) * AdvancePx) + GlyphWidthPx;
+  }
+
+  std::vector<TextLayoutLine> BreakLines(const TextureAtlasSpriteFont& font, const char* const pszText, const int32_t maxWidthPx,
+                                         const TextLineBreakMode mode = TextLineBreakMode::Greedy)
+  {
+    std::vector<TextLayoutLine> lines;
+    TextLayoutUtil::BreakLines(lines, font, StringViewLite(pszText), TextLayoutConfig(PxSize1D::Create(maxWidthPx), BitmapFontConfig(), mode));
+    return lines;
+  }
+
+  TextLayoutLine Line(const uint32_t startIndex, const uint32_t length, const int32_t widthPx)
+  {
+    return {startIndex, length, PxSize1D::Create(widthPx)};
+  }
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_Empty)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  EXPECT_TRUE(BreakLines(font, "", 100).empty());
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_Greedy)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const auto lines = BreakLines(font, "aaa bbb ccc", 70);
+
+  ASSERT_EQ(2u, lines.size());
+  EXPECT_EQ(Line(0, 7, TextWidth(7)), lines[0]);
+  EXPECT_EQ(Line(8, 3, TextWidth(3)), lines[1]);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_NewLine)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const auto lines = BreakLines(font, "aa\n\nbb", 100);
+
+  ASSERT_EQ(3u, lines.size());
+  EXPECT_EQ(Line(0, 2, TextWidth(2)), lines[0]);
+  EXPECT_EQ(Line(3, 0, 0), lines[1]);
+  EXPECT_EQ(Line(4, 2, TextWidth(2)), lines[2]);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_LeadingSpacesKept)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const auto lines = BreakLines(font, "  aa  ", 100);
+
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ(Line(0, 4, TextWidth(4)), lines[0]);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_OverflowingWord)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const auto lines = BreakLines(font, "aaaaaaaaaa b", 50);
+
+  ASSERT_EQ(2u, lines.size());
+  EXPECT_EQ(Line(0, 10, TextWidth(10)), lines[0]);
+  EXPECT_EQ(Line(11, 1, TextWidth(1)), lines[1]);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_Optimal)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+
+  // Greedy fills the first line and leaves a very short second line
+  const auto greedyLines = BreakLines(font, "aaa bb cc ddddd", 60, TextLineBreakMode::Greedy);
+  ASSERT_EQ(3u, greedyLines.size());
+  EXPECT_EQ(Line(0, 6, TextWidth(6)), greedyLines[0]);
+  EXPECT_EQ(Line(7, 2, TextWidth(2)), greedyLines[1]);
+  EXPECT_EQ(Line(10, 5, TextWidth(5)), greedyLines[2]);
+
+  const auto optimalLines = BreakLines(font, "aaa bb cc ddddd", 60, TextLineBreakMode::Optimal);
+  ASSERT_EQ(3u, optimalLines.size());
+  EXPECT_EQ(Line(0, 3, TextWidth(3)), optimalLines[0]);
+  EXPECT_EQ(Line(4, 5, TextWidth(5)), optimalLines[1]);
+  EXPECT_EQ(Line(10, 5, TextWidth(5)), optimalLines[2]);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, BreakLines_StartIndex)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  std::vector<TextLayoutLine> lines;
+  TextLayoutUtil::BreakLines(lines, font, StringViewLite("aaa bbb ccc"), TextLayoutConfig(PxSize1D::Create(70), BitmapFontConfig()), 8);
+
+  ASSERT_EQ(1u, lines.size());
+  EXPECT_EQ(Line(8, 3, TextWidth(3)), lines[0]);
+  EXPECT_THROW(TextLayoutUtil::BreakLines(lines, font, StringViewLite("aa"), TextLayoutConfig(), 3), std::invalid_argument);
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, ExtractGlyphs)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const StringViewLite text("aaa bbb ccc");
+  const auto lines = BreakLines(font, "aaa bbb ccc", 70);
+
+  std::vector<SpriteFontGlyphPosition> glyphs;
+  TextLayoutUtil::ExtractGlyphs(glyphs, font, text, ReadOnlySpan<TextLayoutLine>(lines.data(), lines.size()), BitmapFontConfig());
+
+  ASSERT_EQ(10u, glyphs.size());
+  EXPECT_FLOAT_EQ(0.0f, glyphs[0].DstRectPxf.RawLeft());
+  EXPECT_FLOAT_EQ(0.0f, glyphs[0].DstRectPxf.RawTop());
+  EXPECT_FLOAT_EQ(static_cast<float>(6 * AdvancePx), glyphs[6].DstRectPxf.RawLeft());
+  // The first glyph of the second line
+  EXPECT_FLOAT_EQ(0.0f, glyphs[7].DstRectPxf.RawLeft());
+  EXPECT_FLOAT_EQ(static_cast<float>(LineSpacingPx), glyphs[7].DstRectPxf.RawTop());
+}
+
+
+TEST(TestFontLayout_TextLayoutUtil, CalcSize)
+{
+  const TextureAtlasSpriteFont font = CreateTestFont();
+  const auto lines = BreakLines(font, "aaa bbb ccc", 70);
+
+  EXPECT_EQ(PxSize2D::Create(TextWidth(7), 2 * LineSpacingPx),
+            TextLayoutUtil::CalcSize(font, ReadOnlySpan<TextLayoutLine>(lines.data(), lines.size()), BitmapFontConfig()));
+}
@@ -32,6 +32,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/String/StringViewLite.hpp>
 #include <FslGraphics/Sprite/BasicImageSprite.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFont.hpp>
 #include <FslGraphics/Sprite/ImageSprite.hpp>
 #include <FslGraphics/Sprite/SpriteDpConfig.hpp>
 #include <FslGraphics/Sprite/SpriteManager.hpp>
@@ -273,3 +274,113 @@ TEST(TestSprite_SpriteManager, AddImageSprite)
   EXPECT_EQ(1u, manager.Count());
   EXPECT_TRUE(manager.Contains(value));
 }
+
+
+TEST(TestSprite_SpriteManager, Remove_KeepsOtherSprites)
+{
+  auto material0 = std::make_shared<DummyUIMaterial>();
+  auto material1 = std::make_shared<DummyUIMaterial>();
+  auto material2 = std::make_shared<DummyUIMaterial>();
+
+  SpriteManager manager(160, false);
+  manager.Add(material0);
+  manager.Add(material1);
+  manager.Add(material2);
+
+  manager.Remove(material0);
+  EXPECT_EQ(2u, manager.Count());
+  EXPECT_FALSE(manager.Contains(material0));
+  EXPECT_TRUE(manager.Contains(material1));
+  EXPECT_TRUE(manager.Contains(material2));
+
+  manager.Remove(material2);
+  EXPECT_EQ(1u, manager.Count());
+  EXPECT_TRUE(manager.Contains(material1));
+  EXPECT_FALSE(manager.Contains(material2));
+
+  // Removing a unknown sprite is ignored
+  manager.Remove(material2);
+  EXPECT_EQ(1u, manager.Count());
+
+  manager.Add(material0);
+  EXPECT_EQ(2u, manager.Count());
+  EXPECT_TRUE(manager.Contains(material0));
+}
+
+
+TEST(TestSprite_SpriteManager, Resize_LazyImageSprite)
+{
+  SpriteManager manager(SpriteDpConfig::BaseDpi, false);
+
+  constexpr SpriteMaterialId SpriteMaterialId(1);
+  constexpr auto TextureExtent = PxExtent2D::Create(512, 1024);
+  auto renderMaterial = std::make_shared<SpriteMaterialImpl>(SpriteMaterialId, TextureExtent);
+  const SpriteMaterialInfo spriteMaterialInfo(SpriteMaterialId, TextureExtent, true, BasicPrimitiveTopology::TriangleList, renderMaterial);
+  constexpr AtlasTextureInfo TextureInfo(PxRectangleU32::Create(10, 20, 30, 40), PxThicknessU(), SpriteDpConfig::BaseDpi);
+
+  auto sprite = manager.AddImageSprite(spriteMaterialInfo, TextureInfo, IO::PathView("test"));
+  auto eagerSprite = std::make_shared<DummyUIMaterial>();
+  manager.Add(eagerSprite);
+  EXPECT_EQ(PxSize2D::Create(30, 40), sprite->GetRenderSizePx());
+
+  manager.Resize(SpriteDpConfig::BaseDpi * 2);
+  EXPECT_EQ(SpriteDpConfig::BaseDpi * 2, manager.GetDensityDpi());
+  // Sprites added with Add are still resized immediately, the ones created by the manager resolve on access
+  EXPECT_EQ(SpriteDpConfig::BaseDpi * 2, eagerSprite->TestDensityDpi);
+  EXPECT_EQ(PxSize2D::Create(60, 80), sprite->GetRenderSizePx());
+  EXPECT_EQ(PxSize2D::Create(60, 80), sprite->GetRenderInfo().ScaledSizePx);
+
+  manager.Resize(SpriteDpConfig::BaseDpi);
+  EXPECT_EQ(PxSize2D::Create(30, 40), sprite->GetInfo().RenderInfo.ScaledSizePx);
+}
+
+
+TEST(TestSprite_SpriteManager, Resize_LazySpriteExplicitResize)
+{
+  SpriteManager manager(SpriteDpConfig::BaseDpi, false);
+
+  constexpr SpriteMaterialId SpriteMaterialId(1);
+  constexpr auto TextureExtent = PxExtent2D::Create(512, 1024);
+  auto renderMaterial = std::make_shared<SpriteMaterialImpl>(SpriteMaterialId, TextureExtent);
+  const SpriteMaterialInfo spriteMaterialInfo(SpriteMaterialId, TextureExtent, true, BasicPrimitiveTopology::TriangleList, renderMaterial);
+  constexpr AtlasTextureInfo TextureInfo(PxRectangleU32::Create(10, 20, 30, 40), PxThicknessU(), SpriteDpConfig::BaseDpi);
+
+  auto sprite = manager.AddBasicImageSprite(spriteMaterialInfo, TextureInfo, IO::PathView("test"));
+  manager.Resize(SpriteDpConfig::BaseDpi * 2);
+
+  // A explicit resize overrides the pending density change until the manager density changes again
+  sprite->Resize(SpriteDpConfig::BaseDpi);
+  EXPECT_EQ(PxSize2D::Create(30, 40), sprite->GetRenderSizePx());
+
+  manager.Resize(SpriteDpConfig::BaseDpi * 3);
+  EXPECT_EQ(PxSize2D::Create(90, 120), sprite->GetRenderSizePx());
+}
+
+
+TEST(TestSprite_SpriteManager, Resize_ZeroDensity)
+{
+  SpriteManager manager(SpriteDpConfig::BaseDpi, false);
+  EXPECT_THROW(manager.Resize(0), std::invalid_argument);
+  EXPECT_EQ(SpriteDpConfig::BaseDpi, manager.GetDensityDpi());
+
+  SpriteDensityState densityState(SpriteDpConfig::BaseDpi);
+  EXPECT_THROW(densityState.SetDensityDpi(0), std::invalid_argument);
+  EXPECT_EQ(SpriteDpConfig::BaseDpi, densityState.GetDensityDpi());
+  EXPECT_EQ(0u, densityState.GetGeneration());
+}
+
+
+TEST(TestSprite_SpriteManager, SetDensitySource_DefaultSprite)
+{
+  auto densityState = std::make_shared<SpriteDensityState>(SpriteDpConfig::BaseDpi);
+
+  // Default constructed sprites use the base image dpi so a lazy resolve can not fail
+  BasicImageSprite sprite;
+  SpriteFont font;
+  sprite.SetDensitySource(densityState);
+  font.SetDensitySource(densityState);
+
+  densityState->SetDensityDpi(SpriteDpConfig::BaseDpi * 2);
+  EXPECT_EQ(PxSize2D(), sprite.GetRenderSizePx());
+  EXPECT_EQ(2.0f, font.GetInfo().FontConfig.Scale);
+}
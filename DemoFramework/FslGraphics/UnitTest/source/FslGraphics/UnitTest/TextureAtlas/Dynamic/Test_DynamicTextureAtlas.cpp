@@ -0,0 +1,382 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxRectangleU32.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/DynamicTextureAtlas.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <array>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestTextureAtlasDynamic_DynamicTextureAtlas = TestFixtureFslGraphics;
+
+  constexpr uint32_t TestDpi = 160;
+
+  DynamicTextureAtlasConfig CreateConfig(const uint32_t pageSize, const uint32_t paddingPx, const uint32_t bleedPx, const uint32_t maxPages)
+  {
+    return {PxExtent2D::Create(pageSize, pageSize), PixelFormat::R8_UNORM, paddingPx, bleedPx, maxPages, TestDpi};
+  }
+
+  //! A R8 bitmap where each pixel is (y * width) + x + 1
+  std::vector<uint8_t> CreateContent(const uint32_t width, const uint32_t height)
+  {
+    std::vector<uint8_t> content(static_cast<std::size_t>(width) * height);
+    for (std::size_t i = 0; i < content.size(); ++i)
+    {
+      content[i] = static_cast<uint8_t>(i + 1u);
+    }
+    return content;
+  }
+
+  ReadOnlyRawBitmap AsBitmap(const std::vector<uint8_t>& content, const uint32_t width, const uint32_t height,
+                             const BitmapOrigin origin = BitmapOrigin::UpperLeft)
+  {
+    return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(content), PxExtent2D::Create(width, height), PixelFormat::R8_UNORM, origin);
+  }
+
+  uint8_t GetPixel(const ReadOnlyRawBitmap& bitmap, const uint32_t x, const uint32_t y)
+  {
+    return static_cast<const uint8_t*>(bitmap.Content())[(y * bitmap.Stride()) + x];
+  }
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Construct)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 1, 1, 2));
+
+  EXPECT_EQ(0u, atlas.Count());
+  EXPECT_EQ(0u, atlas.PageCount());
+  EXPECT_FALSE(atlas.TryGet("a").has_value());
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Construct_Invalid)
+{
+  EXPECT_THROW(DynamicTextureAtlas(CreateConfig(0, 1, 1, 2)), std::invalid_argument);
+  EXPECT_THROW(DynamicTextureAtlas(CreateConfig(64, 1, 1, 0)), std::invalid_argument);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 1, 2, 2));
+  const auto content = CreateContent(4, 3);
+
+  const DynamicTextureAtlasRegion region = atlas.Add("a", AsBitmap(content, 4, 3));
+
+  EXPECT_EQ(0u, region.PageIndex);
+  EXPECT_EQ(PxRectangleU32::Create(2, 2, 4, 3), region.TextureInfo.TrimmedRectPx);
+  EXPECT_EQ(PxExtent2D::Create(4, 3), region.TextureInfo.ExtentPx);
+  EXPECT_EQ(TestDpi, region.TextureInfo.Dpi);
+  EXPECT_EQ(1u, atlas.Count());
+  EXPECT_EQ(1u, atlas.PageCount());
+  EXPECT_TRUE(atlas.Contains("a"));
+  EXPECT_EQ(region, atlas.TryGet("a"));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_Duplicate)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 1, 1, 2));
+  const auto content = CreateContent(4, 4);
+
+  atlas.Add("a", AsBitmap(content, 4, 4));
+  EXPECT_THROW(atlas.Add("a", AsBitmap(content, 4, 4)), UsageErrorException);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_WrongPixelFormat)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 1, 1, 2));
+  const std::vector<uint8_t> content(4 * 4 * 4);
+  const auto bitmap =
+    ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(content), PxExtent2D::Create(4, 4), PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+
+  EXPECT_THROW(atlas.Add("a", bitmap), UsageErrorException);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_TooLarge)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 1, 1, 2));
+  const auto content = CreateContent(15, 15);
+
+  // 15 + 2 * bleed does not fit
+  EXPECT_THROW(atlas.Add("a", AsBitmap(content, 15, 15)), NotSupportedException);
+  // 14 + 2 * bleed fits when the padding is dropped at the page edge
+  EXPECT_NO_THROW(atlas.Add("b", AsBitmap(content, 14, 14)));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_Bleed)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 1, 1));
+  const auto content = CreateContent(2, 2);
+
+  atlas.Add("a", AsBitmap(content, 2, 2));
+  const ReadOnlyRawBitmap page = atlas.GetPageBitmap(0);
+
+  // The image is at (1,1) and every edge pixel is repeated one pixel outwards, including the corners
+  const std::array<uint8_t, 16> expected = {1, 1, 2, 2, 1, 1, 2, 2, 3, 3, 4, 4, 3, 3, 4, 4};
+  for (uint32_t y = 0; y < 4; ++y)
+  {
+    for (uint32_t x = 0; x < 4; ++x)
+    {
+      EXPECT_EQ(expected[(y * 4) + x], GetPixel(page, x, y));
+    }
+  }
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_LowerLeftOrigin)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 1));
+  const auto content = CreateContent(2, 2);
+
+  atlas.Add("a", AsBitmap(content, 2, 2, BitmapOrigin::LowerLeft));
+  const ReadOnlyRawBitmap page = atlas.GetPageBitmap(0);
+
+  EXPECT_EQ(3u, GetPixel(page, 0, 0));
+  EXPECT_EQ(4u, GetPixel(page, 1, 0));
+  EXPECT_EQ(1u, GetPixel(page, 0, 1));
+  EXPECT_EQ(2u, GetPixel(page, 1, 1));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_Padding)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 3, 1, 1));
+  const auto content = CreateContent(4, 4);
+
+  const auto region0 = atlas.Add("a", AsBitmap(content, 4, 4));
+  const auto region1 = atlas.Add("b", AsBitmap(content, 4, 4));
+
+  // bleed + width + bleed + padding + bleed
+  EXPECT_EQ(PxRectangleU32::Create(1, 1, 4, 4), region0.TextureInfo.TrimmedRectPx);
+  EXPECT_EQ(PxRectangleU32::Create(1 + 4 + 1 + 3 + 1, 1, 4, 4), region1.TextureInfo.TrimmedRectPx);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_GrowsPages)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 3));
+  const auto content = CreateContent(16, 16);
+
+  EXPECT_EQ(0u, atlas.Add("a", AsBitmap(content, 16, 16)).PageIndex);
+  EXPECT_EQ(1u, atlas.Add("b", AsBitmap(content, 16, 16)).PageIndex);
+  EXPECT_EQ(2u, atlas.Add("c", AsBitmap(content, 16, 16)).PageIndex);
+  EXPECT_EQ(3u, atlas.PageCount());
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, TryAdd_NoEvictionDuringSameFrame)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 1));
+  const auto content = CreateContent(16, 16);
+
+  EXPECT_TRUE(atlas.TryAdd("a", AsBitmap(content, 16, 16)).has_value());
+  EXPECT_FALSE(atlas.TryAdd("b", AsBitmap(content, 16, 16)).has_value());
+  EXPECT_THROW(atlas.Add("b", AsBitmap(content, 16, 16)), UsageErrorException);
+  EXPECT_TRUE(atlas.Contains("a"));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, TryAdd_EvictLeastRecentlyUsed)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 2));
+  const auto content = CreateContent(16, 16);
+
+  atlas.Add("a", AsBitmap(content, 16, 16));
+  atlas.NextFrame();
+  atlas.Add("b", AsBitmap(content, 16, 16));
+  atlas.NextFrame();
+  // Touch "a" so page 1 is the least recently used
+  EXPECT_TRUE(atlas.TryGet("a").has_value());
+  atlas.NextFrame();
+
+  const auto region = atlas.TryAdd("c", AsBitmap(content, 16, 16));
+  ASSERT_TRUE(region.has_value());
+  EXPECT_EQ(1u, region->PageIndex);
+  EXPECT_TRUE(atlas.Contains("a"));
+  EXPECT_FALSE(atlas.Contains("b"));
+  EXPECT_TRUE(atlas.Contains("c"));
+  EXPECT_EQ(1u, atlas.GetEvictedPageCount());
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Remove_ReclaimsEmptyPage)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 1));
+  const auto content = CreateContent(8, 16);
+
+  atlas.Add("a", AsBitmap(content, 8, 16));
+  atlas.Add("b", AsBitmap(content, 8, 16));
+  EXPECT_TRUE(atlas.Remove("a"));
+  EXPECT_FALSE(atlas.Remove("a"));
+  // "b" still occupies the page so there is no room
+  EXPECT_FALSE(atlas.TryAdd("c", AsBitmap(content, 8, 16)).has_value());
+  EXPECT_TRUE(atlas.Remove("b"));
+  EXPECT_EQ(0u, atlas.Add("c", AsBitmap(content, 8, 16)).PageIndex);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, DirtyRect)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 0, 1, 1));
+  const auto content = CreateContent(4, 4);
+
+  atlas.Add("a", AsBitmap(content, 4, 4));
+  EXPECT_TRUE(atlas.IsPageDirty(0));
+  EXPECT_EQ(PxRectangleU32::Create(0, 0, 6, 6), atlas.GetPageDirtyRect(0));
+
+  atlas.ClearPageDirtyRect(0);
+  EXPECT_FALSE(atlas.IsPageDirty(0));
+  EXPECT_EQ(PxRectangleU32(), atlas.GetPageDirtyRect(0));
+  EXPECT_EQ(0u, atlas.GetPageDirtyRowBitmap(0).RawUnsignedHeight());
+
+  // Only the second entry is dirty
+  atlas.Add("b", AsBitmap(content, 4, 4));
+  EXPECT_EQ(PxRectangleU32::Create(6, 0, 6, 6), atlas.GetPageDirtyRect(0));
+
+  const ReadOnlyRawBitmap rows = atlas.GetPageDirtyRowBitmap(0);
+  EXPECT_EQ(64u, rows.RawUnsignedWidth());
+  EXPECT_EQ(6u, rows.RawUnsignedHeight());
+  EXPECT_EQ(1u, GetPixel(rows, 7, 1));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Update)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 0, 0, 1));
+  const auto content = CreateContent(4, 4);
+  const std::vector<uint8_t> newContent(4 * 4, 42);
+
+  atlas.Add("a", AsBitmap(content, 4, 4));
+  atlas.Add("b", AsBitmap(content, 4, 4));
+  atlas.ClearPageDirtyRect(0);
+
+  EXPECT_TRUE(atlas.Update("b", AsBitmap(newContent, 4, 4)));
+  EXPECT_EQ(PxRectangleU32::Create(4, 0, 4, 4), atlas.GetPageDirtyRect(0));
+  EXPECT_EQ(42u, GetPixel(atlas.GetPageBitmap(0), 4, 0));
+  EXPECT_EQ(1u, GetPixel(atlas.GetPageBitmap(0), 0, 0));
+
+  EXPECT_FALSE(atlas.Update("c", AsBitmap(newContent, 4, 4)));
+  EXPECT_THROW(atlas.Update("a", AsBitmap(newContent, 2, 2)), UsageErrorException);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Clear)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 0, 0, 1));
+  const auto content = CreateContent(4, 4);
+
+  atlas.Add("a", AsBitmap(content, 4, 4));
+  atlas.Clear();
+  EXPECT_EQ(0u, atlas.Count());
+  EXPECT_EQ(0u, atlas.PageCount());
+  EXPECT_THROW(atlas.GetPageBitmap(0), std::invalid_argument);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, Add_FillsActivePageFirst)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 2));
+  const auto content = CreateContent(16, 12);
+
+  EXPECT_EQ(0u, atlas.Add("a", AsBitmap(content, 16, 8)).PageIndex);
+  EXPECT_EQ(1u, atlas.Add("b", AsBitmap(content, 16, 12)).PageIndex);
+  // Both pages have room, but the page that received the last entry is used so consecutive entries share a page
+  EXPECT_EQ(1u, atlas.Add("c", AsBitmap(content, 16, 4)).PageIndex);
+  // Page 1 is full, so the remaining room on page 0 is used
+  EXPECT_EQ(0u, atlas.Add("d", AsBitmap(content, 16, 4)).PageIndex);
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, IsValid_Evicted)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 1));
+  const auto content = CreateContent(16, 16);
+
+  const DynamicTextureAtlasRegion regionA = atlas.Add("a", AsBitmap(content, 16, 16));
+  EXPECT_TRUE(atlas.IsValid(regionA));
+  atlas.NextFrame();
+
+  // "b" evicts the page "a" lived on, so the region handed out for "a" now points at the texels of "b"
+  const DynamicTextureAtlasRegion regionB = atlas.Add("b", AsBitmap(content, 16, 16));
+  EXPECT_EQ(regionA.PageIndex, regionB.PageIndex);
+  EXPECT_EQ(regionA.TextureInfo, regionB.TextureInfo);
+  EXPECT_NE(regionA, regionB);
+  EXPECT_FALSE(atlas.IsValid(regionA));
+  EXPECT_TRUE(atlas.IsValid(regionB));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, IsValid_Reclaimed)
+{
+  DynamicTextureAtlas atlas(CreateConfig(16, 0, 0, 1));
+  const auto content = CreateContent(8, 16);
+
+  const DynamicTextureAtlasRegion regionA = atlas.Add("a", AsBitmap(content, 8, 16));
+  const DynamicTextureAtlasRegion regionB = atlas.Add("b", AsBitmap(content, 8, 16));
+
+  // The texels of a removed entry are left untouched until the page is reclaimed
+  EXPECT_TRUE(atlas.Remove("a"));
+  EXPECT_TRUE(atlas.IsValid(regionA));
+  EXPECT_TRUE(atlas.IsValid(regionB));
+
+  EXPECT_TRUE(atlas.Remove("b"));
+  EXPECT_FALSE(atlas.IsValid(regionA));
+  EXPECT_FALSE(atlas.IsValid(regionB));
+  EXPECT_TRUE(atlas.IsValid(atlas.Add("c", AsBitmap(content, 8, 16))));
+}
+
+
+TEST(TestTextureAtlasDynamic_DynamicTextureAtlas, IsValid_Clear)
+{
+  DynamicTextureAtlas atlas(CreateConfig(64, 0, 0, 1));
+  const auto content = CreateContent(4, 4);
+
+  const DynamicTextureAtlasRegion regionA = atlas.Add("a", AsBitmap(content, 4, 4));
+  atlas.Clear();
+  EXPECT_FALSE(atlas.IsValid(regionA));
+
+  const DynamicTextureAtlasRegion regionB = atlas.Add("b", AsBitmap(content, 4, 4));
+  EXPECT_EQ(regionA.PageIndex, regionB.PageIndex);
+  EXPECT_FALSE(atlas.IsValid(regionA));
+  EXPECT_TRUE(atlas.IsValid(regionB));
+}
@@ -0,0 +1,124 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/Pixel/LogPxRectangleU32.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/SkylineBinPacker.hpp>
+#include <FslGraphics/UnitTest/Helper/Common.hpp>
+#include <FslGraphics/UnitTest/Helper/TestFixtureFslGraphics.hpp>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestTextureAtlasDynamic_SkylineBinPacker = TestFixtureFslGraphics;
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, Construct_Default)
+{
+  SkylineBinPacker packer;
+
+  EXPECT_EQ(PxExtent2D(), packer.GetExtent());
+  EXPECT_EQ(0u, packer.GetUsedArea());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(1, 1)).has_value());
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, TryAllocate_Empty)
+{
+  SkylineBinPacker packer(PxExtent2D::Create(64, 64));
+
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(0, 10)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(10, 0)).has_value());
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, TryAllocate_TooLarge)
+{
+  SkylineBinPacker packer(PxExtent2D::Create(64, 64));
+
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(65, 1)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(1, 65)).has_value());
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, TryAllocate_BottomLeft)
+{
+  SkylineBinPacker packer(PxExtent2D::Create(64, 64));
+
+  EXPECT_EQ(PxRectangleU32::Create(0, 0, 32, 16), packer.TryAllocate(PxExtent2D::Create(32, 16)));
+  EXPECT_EQ(PxRectangleU32::Create(32, 0, 16, 8), packer.TryAllocate(PxExtent2D::Create(16, 8)));
+  // The lowest top edge is next to the 16x8 entry
+  EXPECT_EQ(PxRectangleU32::Create(48, 0, 16, 8), packer.TryAllocate(PxExtent2D::Create(16, 8)));
+  // The two 8 high entries merged into one segment that can hold the next one
+  EXPECT_EQ(PxRectangleU32::Create(32, 8, 32, 8), packer.TryAllocate(PxExtent2D::Create(32, 8)));
+  EXPECT_EQ(1u, packer.GetSegmentCount());
+  EXPECT_EQ(PxRectangleU32::Create(0, 16, 64, 48), packer.TryAllocate(PxExtent2D::Create(64, 48)));
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(1, 1)).has_value());
+  EXPECT_EQ(64u * 64u, packer.GetUsedArea());
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, TryAllocate_Clear)
+{
+  SkylineBinPacker packer(PxExtent2D::Create(16, 16));
+
+  EXPECT_TRUE(packer.TryAllocate(PxExtent2D::Create(16, 16)).has_value());
+  EXPECT_FALSE(packer.TryAllocate(PxExtent2D::Create(1, 1)).has_value());
+
+  packer.Clear();
+  EXPECT_EQ(0u, packer.GetUsedArea());
+  EXPECT_EQ(PxRectangleU32::Create(0, 0, 16, 16), packer.TryAllocate(PxExtent2D::Create(16, 16)));
+}
+
+
+TEST(TestTextureAtlasDynamic_SkylineBinPacker, TryAllocate_NoOverlap)
+{
+  SkylineBinPacker packer(PxExtent2D::Create(128, 128));
+
+  std::vector<PxRectangleU32> allocated;
+  for (uint32_t i = 0; i < 200; ++i)
+  {
+    const auto rect = packer.TryAllocate(PxExtent2D::Create(3 + ((i * 7) % 13), 2 + ((i * 5) % 11)));
+    if (rect.has_value())
+    {
+      EXPECT_LE(rect->RawRight(), 128u);
+      EXPECT_LE(rect->RawBottom(), 128u);
+      for (const auto& entry : allocated)
+      {
+        EXPECT_FALSE(entry.Intersects(rect.value()));
+      }
+      allocated.push_back(rect.value());
+    }
+  }
+  EXPECT_GT(allocated.size(), 100u);
+}
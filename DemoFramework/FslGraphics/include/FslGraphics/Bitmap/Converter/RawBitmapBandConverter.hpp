@@ -0,0 +1,60 @@
+#ifndef FSLGRAPHICS_BITMAP_CONVERTER_RAWBITMAPBANDCONVERTER_HPP
+#define FSLGRAPHICS_BITMAP_CONVERTER_RAWBITMAPBANDCONVERTER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+
+namespace Fsl
+{
+  class ReadOnlyRawBitmap;
+  class RawBitmapEx;
+
+  //! Writes horizontal bands of a source image straight into their final place in a destination bitmap.
+  //! This allows a decoder to convert pixel format and origin in one pass while it only keeps a small band of the source image in memory.
+  class RawBitmapBandConverter
+  {
+  public:
+    //! @brief Check if a band in the srcPixelFormat can be written to a bitmap in the dstPixelFormat
+    static bool IsSupported(const PixelFormat srcPixelFormat, const PixelFormat dstPixelFormat) noexcept;
+
+    //! @brief Convert a band of source rows directly into the destination bitmap
+    //! @param rDstBitmap the full destination bitmap, its pixel format and origin decides the conversion that is applied.
+    //! @param srcBand the band of source rows. Its origin describes the row order of the full source image.
+    //! @param srcFirstRow the index of the first band row in the source image (in the source image storage order).
+    //! @return true if the band was written, false if the conversion is unsupported or the band does not fit the destination bitmap.
+    //! @note The buffers can not overlap.
+    static bool TryWriteBand(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBand, const uint32_t srcFirstRow);
+  };
+}
+
+#endif
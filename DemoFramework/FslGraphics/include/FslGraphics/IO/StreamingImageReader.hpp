@@ -0,0 +1,86 @@
+#ifndef FSLGRAPHICS_IO_STREAMINGIMAGEREADER_HPP
+#define FSLGRAPHICS_IO_STREAMINGIMAGEREADER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslGraphics/Bitmap/BitmapOrigin.hpp>
+#include <FslGraphics/ImageFormat.hpp>
+#include <FslGraphics/PixelChannelOrder.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+#include <istream>
+
+namespace Fsl
+{
+  class Bitmap;
+
+  //! Decodes images a band of rows at a time, converting each band straight into the final pixel format and origin.
+  //! Unlike a full decode followed by a conversion this never holds more than the destination bitmap and a single band in memory.
+  //!
+  //! Supported variants:
+  //! - BMP: uncompressed (BI_RGB) 24bpp and 32bpp.
+  //! - TGA: uncompressed and RLE true color (image type 2 and 10) 24bpp and 32bpp.
+  //! Everything else is reported as unsupported so the caller can fall back to a full decoder.
+  class StreamingImageReader
+  {
+  public:
+    static constexpr uint32_t DefaultBandHeight = 64;
+
+    StreamingImageReader(const StreamingImageReader&) = delete;
+    StreamingImageReader& operator=(const StreamingImageReader&) = delete;
+
+    //! @brief Check if the image format can be streamed (the variant used by a given file might still be unsupported)
+    static bool IsSupported(const ImageFormat imageFormat) noexcept;
+
+    //! @brief Decode the image from the file
+    //! @param desiredPixelFormat the pixel format of the bitmap (PixelFormat::Undefined keeps the pixel format used by the file).
+    //! @param desiredOrigin the origin of the bitmap (BitmapOrigin::Undefined keeps the origin used by the file).
+    //! @param preferredChannelOrder applied to the pixel format used by the file when desiredPixelFormat is PixelFormat::Undefined.
+    //! @return true if the image was decoded, false if the file could not be opened, the variant or the conversion is unsupported.
+    //! @throws FormatException if the file is truncated or corrupt.
+    static bool TryRead(Bitmap& rBitmap, const IO::Path& path, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat,
+                        const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder,
+                        const uint32_t bandHeight = DefaultBandHeight);
+
+    //! @brief Decode the image from the stream
+    //! @param desiredPixelFormat the pixel format of the bitmap (PixelFormat::Undefined keeps the pixel format used by the file).
+    //! @param desiredOrigin the origin of the bitmap (BitmapOrigin::Undefined keeps the origin used by the file).
+    //! @param preferredChannelOrder applied to the pixel format used by the file when desiredPixelFormat is PixelFormat::Undefined.
+    //! @return true if the image was decoded, false if the variant or the conversion is unsupported (rBitmap is left untouched).
+    //! @throws FormatException if the stream is truncated or corrupt.
+    static bool TryRead(Bitmap& rBitmap, std::istream& rStream, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat,
+                        const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder,
+                        const uint32_t bandHeight = DefaultBandHeight);
+  };
+}
+
+#endif
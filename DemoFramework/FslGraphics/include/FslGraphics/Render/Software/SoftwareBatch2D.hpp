@@ -0,0 +1,50 @@
+#ifndef FSLGRAPHICS_RENDER_SOFTWARE_SOFTWAREBATCH2D_HPP
+#define FSLGRAPHICS_RENDER_SOFTWARE_SOFTWAREBATCH2D_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Render/GenericBatch2D_fwd.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2DQuadRenderer.hpp>
+#include <FslGraphics/Render/Software/SoftwareTextureInfo.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  //! @brief A GenericBatch2D that renders using the CPU.
+  //! @note  The quads are rasterized when SoftwareBatch2DQuadRenderer::Flush or GetTarget is called.
+  class SoftwareBatch2D : public GenericBatch2D<std::shared_ptr<SoftwareBatch2DQuadRenderer>, SoftwareTextureInfo, GenericBatch2DFormat::Normal>
+  {
+  public:
+    SoftwareBatch2D(const std::shared_ptr<SoftwareBatch2DQuadRenderer>& quadRenderer, const PxExtent2D& extentPx);
+  };
+}
+
+#endif
@@ -0,0 +1,134 @@
+#ifndef FSLGRAPHICS_RENDER_SOFTWARE_SOFTWAREBATCH2DQUADRENDERER_HPP
+#define FSLGRAPHICS_RENDER_SOFTWARE_SOFTWAREBATCH2DQUADRENDERER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/Color.hpp>
+#include <FslGraphics/Render/BatchSdfRenderConfig.hpp>
+#include <FslGraphics/Render/BlendState.hpp>
+#include <FslGraphics/Render/Software/SoftwareTextureInfo.hpp>
+#include <FslGraphics/Render/Stats/NativeBatch2DStats.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorTexture.hpp>
+#include <array>
+#include <memory>
+#include <vector>
+
+namespace Fsl
+{
+  class WorkerThreadPool;
+
+  //! @brief A CPU implementation of the quad renderer GenericBatch2D expects, it renders into a R8G8B8A8_UNORM target kept in system memory.
+  //!        The quads are recorded on DrawQuads and rasterized on Flush where they are binned into fixed size tiles,
+  //!        each tile renders its quads in submission order so the tiles can be processed in parallel without any locking.
+  //!        The texture sampling and blending is done in 8bit fixed point with two color channels per 32bit operation.
+  //! @note  The result matches what the GLES3 quad renderer produces for the supported blend states within a rounding error,
+  //!        the screen extent given to Begin is expected to match the target extent (quads are clipped against the target).
+  class SoftwareBatch2DQuadRenderer
+  {
+  public:
+    static constexpr uint32_t TileSizePx = 64;
+
+  private:
+    struct Command
+    {
+      SoftwareTextureInfo TextureInfo;
+      BlendState ActiveBlendState{BlendState::AlphaBlend};
+      uint32_t SdfTableIndex{0};
+    };
+
+    using SdfAlphaTable = std::array<uint8_t, 256>;
+
+    std::shared_ptr<WorkerThreadPool> m_workerPool;
+    PxExtent2D m_extentPx;
+    std::vector<uint32_t> m_target;
+
+    std::vector<Command> m_commands;
+    //! Four vertices per quad
+    std::vector<VertexPositionColorTexture> m_vertices;
+    //! The command index of each quad
+    std::vector<uint32_t> m_quadCommands;
+    std::vector<SdfAlphaTable> m_sdfTables;
+    std::vector<float> m_sdfTableSmoothing;
+
+    uint32_t m_tilesX{0};
+    uint32_t m_tilesY{0};
+    std::vector<std::vector<uint32_t>> m_tileQuads;
+
+    bool m_inBegin{false};
+    BlendState m_blendState{BlendState::AlphaBlend};
+    uint32_t m_sdfTableIndex{0};
+    NativeBatch2DStats m_stats{};
+
+  public:
+    //! @brief Create a renderer that rasterizes on the calling thread
+    explicit SoftwareBatch2DQuadRenderer(const PxExtent2D extentPx);
+    //! @param workerPool the tiles are split across the pool on flush (can be null)
+    SoftwareBatch2DQuadRenderer(const PxExtent2D extentPx, std::shared_ptr<WorkerThreadPool> workerPool);
+    ~SoftwareBatch2DQuadRenderer();
+
+    void Begin(const PxSize2D& sizePx, const BlendState blendState, const BatchSdfRenderConfig& sdfRenderConfig, const bool restoreState);
+    void End();
+    void DrawQuads(const VertexPositionColorTexture* const pVertices, const uint32_t length, const SoftwareTextureInfo& textureInfo);
+
+    NativeBatch2DStats GetStats() const
+    {
+      return m_stats;
+    }
+
+    PxExtent2D GetExtent() const noexcept
+    {
+      return m_extentPx;
+    }
+
+    //! @brief Change the target extent, this discards the current content and any pending quads
+    void SetExtent(const PxExtent2D extentPx);
+
+    //! @brief Rasterize the pending quads and fill the target with the given color
+    void Clear(const Color color);
+
+    //! @brief Rasterize all pending quads into the target
+    void Flush();
+
+    //! @brief Rasterize all pending quads and get access to the target.
+    //! @note  The returned bitmap is only valid until the next call to a non const method.
+    ReadOnlyRawBitmap GetTarget();
+
+  private:
+    void BinQuads();
+    void RasterizeTiles(const std::size_t beginTile, const std::size_t endTile);
+  };
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef FSLGRAPHICS_RENDER_SOFTWARE_SOFTWARENATIVETEXTURE2D_HPP
+#define FSLGRAPHICS_RENDER_SOFTWARE_SOFTWARENATIVETEXTURE2D_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslGraphics/Render/Adapter/IDynamicNativeTexture2D.hpp>
+#include <FslGraphics/Render/Software/SoftwareTextureInfo.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A texture that lives in system memory so it can be sampled by the SoftwareBatch2DQuadRenderer.
+  //!        The content is converted to R8G8B8A8_UNORM with the origin in the upper left corner on upload.
+  //!        Missing channels are filled in like a GPU would do it (R8 becomes (r, 0, 0, 255) and RGB gets a alpha of 255).
+  class SoftwareNativeTexture2D final : public IDynamicNativeTexture2D
+  {
+    std::vector<uint32_t> m_texels;
+    PxExtent2D m_extentPx;
+    Texture2DFilterHint m_filterHint{Texture2DFilterHint::Smooth};
+
+  public:
+    SoftwareNativeTexture2D(const ReadOnlyRawTexture& texture, const Texture2DFilterHint filterHint, const TextureFlags textureFlags);
+
+    NativeTextureArea CalcNativeTextureArea(const PxRectangleU32& imageRectanglePx) const final;
+
+    BasicNativeTextureHandle TryGetNativeHandle() const noexcept final
+    {
+      return {};
+    }
+
+    //! @note Changing the content while there are unflushed quads that use the texture is not supported.
+    void SetData(const ReadOnlyRawTexture& texture, const Texture2DFilterHint filterHint, const TextureFlags textureFlags) final;
+
+    PxExtent2D GetExtent() const noexcept
+    {
+      return m_extentPx;
+    }
+
+    SoftwareTextureInfo GetTextureInfo() const noexcept
+    {
+      return {m_texels.data(), m_extentPx, m_filterHint};
+    }
+  };
+}
+
+#endif
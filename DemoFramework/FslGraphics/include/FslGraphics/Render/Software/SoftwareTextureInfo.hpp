@@ -0,0 +1,76 @@
+#ifndef FSLGRAPHICS_RENDER_SOFTWARE_SOFTWARETEXTUREINFO_HPP
+#define FSLGRAPHICS_RENDER_SOFTWARE_SOFTWARETEXTUREINFO_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxExtent3D.hpp>
+#include <FslGraphics/Render/Texture2DFilterHint.hpp>
+
+namespace Fsl
+{
+  //! @brief The texture information the software quad renderer needs.
+  //!        The texels are tightly packed R8G8B8A8_UNORM values (R in the lowest byte) with the origin in the upper left corner.
+  //! @note  The texels are referenced not copied so they must stay valid until the quads that use them have been flushed.
+  struct SoftwareTextureInfo
+  {
+    const uint32_t* pTexels{nullptr};
+    PxExtent3D Extent;
+    Texture2DFilterHint FilterHint{Texture2DFilterHint::Smooth};
+
+    constexpr SoftwareTextureInfo() noexcept = default;
+
+    constexpr SoftwareTextureInfo(const uint32_t* const pTexelsParam, const PxExtent2D extentPx, const Texture2DFilterHint filterHint) noexcept
+      : pTexels(pTexelsParam)
+      , Extent(extentPx, PxValueU(1))
+      , FilterHint(filterHint)
+    {
+    }
+
+    constexpr bool IsValid() const noexcept
+    {
+      return pTexels != nullptr && Extent.Width.Value > 0u && Extent.Height.Value > 0u;
+    }
+
+    constexpr bool operator==(const SoftwareTextureInfo& rhs) const noexcept
+    {
+      return pTexels == rhs.pTexels && Extent == rhs.Extent && FilterHint == rhs.FilterHint;
+    }
+
+    constexpr bool operator!=(const SoftwareTextureInfo& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,81 @@
+#ifndef FSLGRAPHICS_SDF_SDFGENERATOR_HPP
+#define FSLGRAPHICS_SDF_SDFGENERATOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sdf/SdfGeneratorConfig.hpp>
+#include <memory>
+
+namespace Fsl
+{
+  class ReadOnlyRawBitmap;
+  class WorkerThreadPool;
+
+  struct SdfGeneratorFontResult
+  {
+    BitmapFont Font;
+    Bitmap FontBitmap;
+  };
+
+  //! @brief Generate single channel signed distance fields from high resolution alpha bitmaps.
+  //!        The shape is found by thresholding the alpha, then a exact euclidean distance transform (Felzenszwalb & Huttenlocher) is run
+  //!        as a column pass followed by a row pass, which is linear in the pixel count. The passes are split across the worker pool.
+  //! @note  Multi channel fields (MSDF) require the vector outline of the shape so they can not be generated from a bitmap.
+  class SdfGenerator
+  {
+    std::shared_ptr<WorkerThreadPool> m_workerPool;
+
+  public:
+    //! @brief Create a generator that runs everything on the calling thread
+    SdfGenerator();
+    explicit SdfGenerator(std::shared_ptr<WorkerThreadPool> workerPool);
+
+    //! @brief Get the number of output pixels added on each side so the field is not clipped
+    static uint32_t CalcPaddingPx(const SdfGeneratorConfig& config);
+
+    //! @brief Generate a R8_UNORM distance field for the full source bitmap (for icons).
+    //!        The result is ceil(size / DownscaleFactor) + (2 * CalcPaddingPx) on each axis.
+    //! @param srcBitmap a R8, R8G8B8A8 or B8G8R8A8 bitmap, for R8 the value is used as alpha.
+    Bitmap Generate(const ReadOnlyRawBitmap& srcBitmap, const SdfGeneratorConfig& config) const;
+
+    //! @brief Convert a high resolution bitmap font into a SDF font.
+    //!        Every glyph is converted on its own and packed into a new R8_UNORM atlas, the font metrics are scaled by 1 / DownscaleFactor.
+    //! @param srcFont the font, it must be a BitmapFontType::Bitmap font.
+    //! @param srcFontBitmap the font texture.
+    SdfGeneratorFontResult GenerateFont(const BitmapFont& srcFont, const ReadOnlyRawBitmap& srcFontBitmap, const SdfGeneratorConfig& config) const;
+  };
+}
+
+#endif
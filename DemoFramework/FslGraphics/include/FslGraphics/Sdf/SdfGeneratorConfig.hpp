@@ -0,0 +1,57 @@
+#ifndef FSLGRAPHICS_SDF_SDFGENERATORCONFIG_HPP
+#define FSLGRAPHICS_SDF_SDFGENERATORCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl
+{
+  struct SdfGeneratorConfig
+  {
+    //! Source pixels with a alpha at or above this value are considered inside the shape
+    uint8_t AlphaThreshold{128};
+    //! The source is expected to be rendered at this many times the output resolution, it is downscaled while generating the field
+    uint32_t DownscaleFactor{1};
+    //! The distance in output pixels that is mapped to the full 0-255 range (this matches BitmapFontSdfParams::DistanceRange)
+    float DistanceRangePx{8.0f};
+
+    constexpr SdfGeneratorConfig() noexcept = default;
+    constexpr SdfGeneratorConfig(const uint8_t alphaThreshold, const uint32_t downscaleFactor, const float distanceRangePx) noexcept
+      : AlphaThreshold(alphaThreshold)
+      , DownscaleFactor(downscaleFactor)
+      , DistanceRangePx(distanceRangePx)
+    {
+    }
+  };
+}
+
+#endif
@@ -34,15 +34,20 @@
 #include <FslGraphics/Sprite/IImageSprite.hpp>
 #include <FslGraphics/Sprite/Info/BasicImageSpriteInfo.hpp>
 #include <FslGraphics/Sprite/Info/Core/RenderConverter.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 
 namespace Fsl
 {
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class BasicImageSprite final : public IImageSprite
+  class BasicImageSprite final
+    : public IImageSprite
+    , public SpriteDensityLinked<BasicImageSprite>
   {
-    BasicImageSpriteInfo m_info;
+    friend class SpriteDensityLinked<BasicImageSprite>;
+
+    mutable BasicImageSpriteInfo m_info;
 
   public:
     BasicImageSprite() = default;
@@ -56,6 +61,7 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
@@ -68,6 +74,7 @@ namespace Fsl
 
     const BasicImageSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -78,6 +85,7 @@ namespace Fsl
 
     const RenderBasicImageInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -89,6 +97,9 @@ namespace Fsl
 
     const SpriteMaterialInfo& GetMaterialInfo(const uint32_t index) const final;
     void Resize(const uint32_t densityDpi) final;
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
@@ -34,15 +34,20 @@
 #include <FslGraphics/Sprite/INineSliceSprite.hpp>
 #include <FslGraphics/Sprite/Info/BasicNineSliceSpriteInfo.hpp>
 #include <FslGraphics/Sprite/Info/Core/RenderConverter.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 
 namespace Fsl
 {
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class BasicNineSliceSprite final : public INineSliceSprite
+  class BasicNineSliceSprite final
+    : public INineSliceSprite
+    , public SpriteDensityLinked<BasicNineSliceSprite>
   {
-    BasicNineSliceSpriteInfo m_info;
+    friend class SpriteDensityLinked<BasicNineSliceSprite>;
+
+    mutable BasicNineSliceSpriteInfo m_info;
 
   public:
     BasicNineSliceSprite() = default;
@@ -57,16 +62,19 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
     const PxThickness& GetRenderContentMarginPx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledContentMarginPx;
     }
 
     RenderContentInfo GetRenderContentInfo() const noexcept final
     {
+      EnsureResolved();
       return {m_info.RenderInfo.ScaledSizePx, m_info.RenderInfo.ScaledContentMarginPx};
     }
 
@@ -78,6 +86,7 @@ namespace Fsl
 
     const BasicNineSliceSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -88,6 +97,7 @@ namespace Fsl
 
     const RenderBasicNineSliceInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -97,6 +107,9 @@ namespace Fsl
     }
     const SpriteMaterialInfo& GetMaterialInfo(const uint32_t index) const final;
     void Resize(const uint32_t densityDpi) final;
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
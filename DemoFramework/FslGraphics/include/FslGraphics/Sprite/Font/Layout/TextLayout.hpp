@@ -0,0 +1,105 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUT_HPP
+#define FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutConfig.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutLine.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontGlyphPosition.hpp>
+#include <string>
+#include <vector>
+
+namespace Fsl
+{
+  class TextLayoutCache;
+  class TextureAtlasSpriteFont;
+
+  //! @brief The multi line layout of one text, ready for batching.
+  //!        When the text changes but the font and config stay the same, a greedy layout only redoes the lines that can be affected.
+  //!        For example a multi line label that ends with a counter only re-measures its last line.
+  class TextLayout final
+  {
+    const TextureAtlasSpriteFont* m_pFont{nullptr};
+    TextLayoutConfig m_config;
+    std::string m_text;
+    std::vector<TextLayoutLine> m_lines;
+    std::vector<SpriteFontGlyphPosition> m_glyphs;
+    PxSize2D m_sizePx;
+
+  public:
+    TextLayout() = default;
+
+    //! @brief Update the layout.
+    //! @param pCache a optional cache that is used for the line breaks when a full layout is required.
+    //! @note  The font must stay alive and unmodified while the layout refers to it, call Clear if it is reset.
+    //! @return true if the layout changed, false if it was already up to date.
+    bool SetText(const TextureAtlasSpriteFont& font, const StringViewLite text, const TextLayoutConfig& config,
+                 TextLayoutCache* const pCache = nullptr);
+
+    void Clear() noexcept;
+
+    StringViewLite GetText() const noexcept
+    {
+      return StringViewLite(m_text.data(), m_text.size());
+    }
+
+    const TextLayoutConfig& GetConfig() const noexcept
+    {
+      return m_config;
+    }
+
+    ReadOnlySpan<TextLayoutLine> GetLines() const noexcept
+    {
+      return ReadOnlySpan<TextLayoutLine>(m_lines.data(), m_lines.size());
+    }
+
+    //! @brief The glyphs of all lines, one entry per byte of each line (see TextureAtlasSpriteFont::ExtractRenderRules)
+    ReadOnlySpan<SpriteFontGlyphPosition> GetGlyphs() const noexcept
+    {
+      return ReadOnlySpan<SpriteFontGlyphPosition>(m_glyphs.data(), m_glyphs.size());
+    }
+
+    PxSize2D GetSizePx() const noexcept
+    {
+      return m_sizePx;
+    }
+
+  private:
+    bool TryRelayoutLastLine(const TextureAtlasSpriteFont& font, const StringViewLite text);
+    void Relayout(const TextureAtlasSpriteFont& font, const StringViewLite text, const TextLayoutConfig& config, TextLayoutCache* const pCache);
+  };
+}
+
+#endif
@@ -0,0 +1,122 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTCACHE_HPP
+#define FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTCACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutConfig.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutLine.hpp>
+#include <list>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl
+{
+  class TextureAtlasSpriteFont;
+
+  //! @brief A least recently used cache of line break results keyed by text, font and layout config.
+  //!        Fonts are identified by their address, so call Clear when a font is destroyed or its content is reset.
+  class TextLayoutCache final
+  {
+    struct Key
+    {
+      const TextureAtlasSpriteFont* pFont{nullptr};
+      TextLayoutConfig Config;
+      //! Points to the text owned by the record (or to the query text during a lookup)
+      std::string_view Text;
+
+      bool operator==(const Key& rhs) const noexcept
+      {
+        return pFont == rhs.pFont && Config == rhs.Config && Text == rhs.Text;
+      }
+    };
+
+    struct KeyHash
+    {
+      std::size_t operator()(const Key& key) const noexcept;
+    };
+
+    struct Record
+    {
+      const TextureAtlasSpriteFont* pFont{nullptr};
+      TextLayoutConfig Config;
+      std::string Text;
+      std::vector<TextLayoutLine> Lines;
+    };
+
+    uint32_t m_capacity;
+    //! Most recently used record first, list nodes never move so the keys can point to the record text
+    std::list<Record> m_records;
+    std::unordered_map<Key, std::list<Record>::iterator, KeyHash> m_lookup;
+    uint64_t m_hitCount{0};
+    uint64_t m_missCount{0};
+
+  public:
+    static constexpr uint32_t DefaultCapacity = 512;
+
+    TextLayoutCache(const TextLayoutCache&) = delete;
+    TextLayoutCache& operator=(const TextLayoutCache&) = delete;
+
+    explicit TextLayoutCache(const uint32_t capacity = DefaultCapacity);
+
+    uint32_t GetCapacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_records.size());
+    }
+
+    uint64_t GetHitCount() const noexcept
+    {
+      return m_hitCount;
+    }
+
+    uint64_t GetMissCount() const noexcept
+    {
+      return m_missCount;
+    }
+
+    void Clear() noexcept;
+
+    //! @brief Get the line breaks for the text, they are calculated and cached on a miss.
+    //! @return the lines, the span is valid until the next call to a non const method.
+    ReadOnlySpan<TextLayoutLine> BreakLines(const TextureAtlasSpriteFont& font, const StringViewLite text, const TextLayoutConfig& config);
+  };
+}
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTCONFIG_HPP
+#define FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxSize1D.hpp>
+#include <FslGraphics/Font/BitmapFontConfig.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLineBreakMode.hpp>
+#include <limits>
+
+namespace Fsl
+{
+  struct TextLayoutConfig
+  {
+    //! The maximum width of a line. Lines are only broken at spaces, so a single word that is wider than this will overflow.
+    PxSize1D MaxWidthPx{PxSize1D::Create(std::numeric_limits<PxSize1D::raw_value_type>::max())};
+    BitmapFontConfig FontConfig;
+    TextLineBreakMode LineBreakMode{TextLineBreakMode::Greedy};
+
+    constexpr TextLayoutConfig() noexcept = default;
+
+    constexpr TextLayoutConfig(const PxSize1D maxWidthPx, const BitmapFontConfig& fontConfig,
+                               const TextLineBreakMode lineBreakMode = TextLineBreakMode::Greedy) noexcept
+      : MaxWidthPx(maxWidthPx)
+      , FontConfig(fontConfig)
+      , LineBreakMode(lineBreakMode)
+    {
+    }
+
+    constexpr bool operator==(const TextLayoutConfig& rhs) const noexcept
+    {
+      return MaxWidthPx == rhs.MaxWidthPx && FontConfig == rhs.FontConfig && LineBreakMode == rhs.LineBreakMode;
+    }
+
+    constexpr bool operator!=(const TextLayoutConfig& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
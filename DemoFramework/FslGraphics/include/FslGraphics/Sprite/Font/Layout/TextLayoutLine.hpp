@@ -0,0 +1,68 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTLINE_HPP
+#define FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTLINE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxSize1D.hpp>
+
+namespace Fsl
+{
+  struct TextLayoutLine
+  {
+    //! The byte offset of the first character of the line in the text
+    uint32_t StartIndex{0};
+    //! The number of bytes in the line (the spaces at a line break are not part of any line)
+    uint32_t Length{0};
+    //! The measured width of the line
+    PxSize1D WidthPx;
+
+    constexpr TextLayoutLine() noexcept = default;
+    constexpr TextLayoutLine(const uint32_t startIndex, const uint32_t length, const PxSize1D widthPx) noexcept
+      : StartIndex(startIndex)
+      , Length(length)
+      , WidthPx(widthPx)
+    {
+    }
+
+    constexpr bool operator==(const TextLayoutLine& rhs) const noexcept
+    {
+      return StartIndex == rhs.StartIndex && Length == rhs.Length && WidthPx == rhs.WidthPx;
+    }
+
+    constexpr bool operator!=(const TextLayoutLine& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
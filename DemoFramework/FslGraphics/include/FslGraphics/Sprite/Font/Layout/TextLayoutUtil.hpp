@@ -0,0 +1,67 @@
+#ifndef FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTUTIL_HPP
+#define FSLGRAPHICS_SPRITE_FONT_LAYOUT_TEXTLAYOUTUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutConfig.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutLine.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFontGlyphPosition.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  class TextureAtlasSpriteFont;
+
+  namespace TextLayoutUtil
+  {
+    //! @brief Break the text into lines that fit inside config.MaxWidthPx.
+    //!        Lines are broken at spaces and always at '\n'. The spaces at a soft line break are dropped.
+    //! @param rLines the lines are appended to this
+    //! @param startIndex the byte offset to start at, this must be the start of a line in a previous layout of the same text prefix
+    void BreakLines(std::vector<TextLayoutLine>& rLines, const TextureAtlasSpriteFont& font, const StringViewLite text,
+                    const TextLayoutConfig& config, const uint32_t startIndex = 0);
+
+    //! @brief Append the glyph positions of the lines to rGlyphs.
+    //!        Like TextureAtlasSpriteFont::ExtractRenderRules there is one entry per byte of each line (unused entries are empty).
+    //! @param firstLineIndex the index of lines[0] in the full layout, used to calculate the y-offset of the lines.
+    void ExtractGlyphs(std::vector<SpriteFontGlyphPosition>& rGlyphs, const TextureAtlasSpriteFont& font, const StringViewLite text,
+                       const ReadOnlySpan<TextLayoutLine> lines, const BitmapFontConfig& fontConfig, const uint32_t firstLineIndex = 0);
+
+    //! @brief Calculate the size of the layout (the widest line times the number of lines at the font line spacing)
+    PxSize2D CalcSize(const TextureAtlasSpriteFont& font, const ReadOnlySpan<TextLayoutLine> lines, const BitmapFontConfig& fontConfig);
+  }
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include <FslGraphics/Sprite/Font/SpriteFontInfo.hpp>
 #include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
 #include <FslGraphics/Sprite/ISprite.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 
 namespace Fsl
 {
@@ -42,9 +43,13 @@ namespace Fsl
   struct SpriteMaterialInfo;
   class SpriteNativeAreaCalc;
 
-  class SpriteFont final : public ISprite
+  class SpriteFont final
+    : public ISprite
+    , public SpriteDensityLinked<SpriteFont>
   {
-    SpriteFontInfo m_info;
+    friend class SpriteDensityLinked<SpriteFont>;
+
+    mutable SpriteFontInfo m_info;
     TextureAtlasSpriteFont m_bitmapFontAtlas;
 
   public:
@@ -62,6 +67,7 @@ namespace Fsl
 
     const SpriteFontInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -81,6 +87,9 @@ namespace Fsl
     {
       return m_bitmapFontAtlas;
     }
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
@@ -36,6 +36,7 @@
 #include <FslBase/Math/Pixel/PxValueU16.hpp>
 #include <FslGraphics/Font/BitmapFontConfig.hpp>
 #include <FslGraphics/Sprite/Material/SpriteMaterialInfo.hpp>
+#include <FslGraphics/Sprite/SpriteDpConfig.hpp>
 
 namespace Fsl
 {
@@ -59,7 +60,7 @@ namespace Fsl
     //! The actual number of pixels from the absolute top of the line to the base of the characters.
     PxValueU16 BaseLinePx;
 
-    uint32_t ImageDpi{};
+    uint32_t ImageDpi{SpriteDpConfig::BaseDpi};
 
     bool IsSdfBased{false};
 
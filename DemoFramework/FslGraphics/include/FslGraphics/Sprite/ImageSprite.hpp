@@ -33,15 +33,20 @@
 
 #include <FslGraphics/Sprite/IImageSprite.hpp>
 #include <FslGraphics/Sprite/Info/ImageSpriteInfo.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 
 namespace Fsl
 {
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class ImageSprite final : public IImageSprite
+  class ImageSprite final
+    : public IImageSprite
+    , public SpriteDensityLinked<ImageSprite>
   {
-    ImageSpriteInfo m_info;
+    friend class SpriteDensityLinked<ImageSprite>;
+
+    mutable ImageSpriteInfo m_info;
 
   public:
     ImageSprite() = default;
@@ -56,6 +61,7 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
@@ -67,6 +73,7 @@ namespace Fsl
 
     const ImageSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -77,6 +84,7 @@ namespace Fsl
 
     const RenderImageInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -92,13 +100,16 @@ namespace Fsl
 
     bool operator==(const ImageSprite& rhs) const
     {
-      return m_info == rhs.m_info;
+      return GetInfo() == rhs.GetInfo();
     }
 
     bool operator!=(const ImageSprite& rhs) const
     {
       return !(*this == rhs);
     }
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
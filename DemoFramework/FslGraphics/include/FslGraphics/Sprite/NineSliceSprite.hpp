@@ -34,15 +34,20 @@
 #include <FslGraphics/Sprite/INineSliceSprite.hpp>
 #include <FslGraphics/Sprite/Info/Core/RenderConverter.hpp>
 #include <FslGraphics/Sprite/Info/NineSliceSpriteInfo.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 
 namespace Fsl
 {
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class NineSliceSprite final : public INineSliceSprite
+  class NineSliceSprite final
+    : public INineSliceSprite
+    , public SpriteDensityLinked<NineSliceSprite>
   {
-    NineSliceSpriteInfo m_info;
+    friend class SpriteDensityLinked<NineSliceSprite>;
+
+    mutable NineSliceSpriteInfo m_info;
 
   public:
     NineSliceSprite() = default;
@@ -57,16 +62,19 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
     const PxThickness& GetRenderContentMarginPx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledContentMarginPx;
     }
 
     RenderContentInfo GetRenderContentInfo() const noexcept final
     {
+      EnsureResolved();
       return {m_info.RenderInfo.ScaledSizePx, m_info.RenderInfo.ScaledContentMarginPx};
     }
 
@@ -77,6 +85,7 @@ namespace Fsl
 
     const NineSliceSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -87,6 +96,7 @@ namespace Fsl
 
     const RenderNineSliceInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -97,6 +107,9 @@ namespace Fsl
     }
     const SpriteMaterialInfo& GetMaterialInfo(const uint32_t index) const final;
     void Resize(const uint32_t densityDpi) final;
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
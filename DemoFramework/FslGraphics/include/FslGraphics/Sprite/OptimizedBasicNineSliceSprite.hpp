@@ -34,6 +34,7 @@
 #include <FslGraphics/Sprite/INineSliceSprite.hpp>
 #include <FslGraphics/Sprite/Info/Core/RenderConverter.hpp>
 #include <FslGraphics/Sprite/Info/OptimizedBasicNineSliceSpriteInfo.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 #include <FslGraphics/TextureAtlas/AtlasNineSliceFlags.hpp>
 
 namespace Fsl
@@ -41,9 +42,13 @@ namespace Fsl
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class OptimizedBasicNineSliceSprite final : public INineSliceSprite
+  class OptimizedBasicNineSliceSprite final
+    : public INineSliceSprite
+    , public SpriteDensityLinked<OptimizedBasicNineSliceSprite>
   {
-    OptimizedBasicNineSliceSpriteInfo m_info;
+    friend class SpriteDensityLinked<OptimizedBasicNineSliceSprite>;
+
+    mutable OptimizedBasicNineSliceSpriteInfo m_info;
 
   public:
     OptimizedBasicNineSliceSprite() = default;
@@ -60,16 +65,19 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
     const PxThickness& GetRenderContentMarginPx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledContentMarginPx;
     }
 
     RenderContentInfo GetRenderContentInfo() const noexcept final
     {
+      EnsureResolved();
       return {m_info.RenderInfo.ScaledSizePx, m_info.RenderInfo.ScaledContentMarginPx};
     }
 
@@ -82,6 +90,7 @@ namespace Fsl
 
     const OptimizedBasicNineSliceSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -92,6 +101,7 @@ namespace Fsl
 
     const RenderOptimizedBasicNineSliceInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -101,6 +111,9 @@ namespace Fsl
     }
     const SpriteMaterialInfo& GetMaterialInfo(const uint32_t index) const final;
     void Resize(const uint32_t densityDpi) final;
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
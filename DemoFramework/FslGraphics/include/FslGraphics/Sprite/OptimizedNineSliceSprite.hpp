@@ -33,6 +33,7 @@
 
 #include <FslGraphics/Sprite/INineSliceSprite.hpp>
 #include <FslGraphics/Sprite/Info/OptimizedNineSliceSpriteInfo.hpp>
+#include <FslGraphics/Sprite/SpriteDensityLink.hpp>
 #include <FslGraphics/TextureAtlas/AtlasNineSliceFlags.hpp>
 
 namespace Fsl
@@ -40,9 +41,13 @@ namespace Fsl
   class SpriteNativeAreaCalc;
   class StringViewLite;
 
-  class OptimizedNineSliceSprite final : public INineSliceSprite
+  class OptimizedNineSliceSprite final
+    : public INineSliceSprite
+    , public SpriteDensityLinked<OptimizedNineSliceSprite>
   {
-    OptimizedNineSliceSpriteInfo m_info;
+    friend class SpriteDensityLinked<OptimizedNineSliceSprite>;
+
+    mutable OptimizedNineSliceSpriteInfo m_info;
 
   public:
     OptimizedNineSliceSprite() = default;
@@ -59,16 +64,19 @@ namespace Fsl
 
     PxSize2D GetRenderSizePx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledSizePx;
     }
 
     const PxThickness& GetRenderContentMarginPx() const noexcept final
     {
+      EnsureResolved();
       return m_info.RenderInfo.ScaledContentMarginPx;
     }
 
     RenderContentInfo GetRenderContentInfo() const noexcept final
     {
+      EnsureResolved();
       return {m_info.RenderInfo.ScaledSizePx, m_info.RenderInfo.ScaledContentMarginPx};
     }
 
@@ -80,6 +88,7 @@ namespace Fsl
 
     const OptimizedNineSliceSpriteInfo& GetInfo() const noexcept
     {
+      EnsureResolved();
       return m_info;
     }
 
@@ -90,6 +99,7 @@ namespace Fsl
 
     const RenderOptimizedNineSliceInfo& GetRenderInfo() const noexcept
     {
+      EnsureResolved();
       return m_info.RenderInfo;
     }
 
@@ -100,6 +110,9 @@ namespace Fsl
     }
     const SpriteMaterialInfo& GetMaterialInfo(const uint32_t index) const final;
     void Resize(const uint32_t densityDpi) final;
+
+  private:
+    void DoResolve(const uint32_t densityDpi) const;
   };
 }
 
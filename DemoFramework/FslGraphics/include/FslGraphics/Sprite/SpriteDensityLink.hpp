@@ -0,0 +1,140 @@
+#ifndef FSLGRAPHICS_SPRITE_SPRITEDENSITYLINK_HPP
+#define FSLGRAPHICS_SPRITE_SPRITEDENSITYLINK_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/Sprite/SpriteDensityState.hpp>
+#include <memory>
+#include <utility>
+
+namespace Fsl
+{
+  //! @brief Tracks which SpriteDensityState generation a sprite was last resolved against.
+  //!        A default constructed link is never stale, so sprites created outside a SpriteManager behave exactly like before.
+  class SpriteDensityLink final
+  {
+    std::shared_ptr<const SpriteDensityState> m_state;
+    uint32_t m_generation{0};
+
+  public:
+    SpriteDensityLink() = default;
+
+    explicit SpriteDensityLink(std::shared_ptr<const SpriteDensityState> state) noexcept
+      : m_state(std::move(state))
+      , m_generation(m_state ? m_state->GetGeneration() : 0u)
+    {
+    }
+
+    bool IsAttached() const noexcept
+    {
+      return static_cast<bool>(m_state);
+    }
+
+    bool IsStale() const noexcept
+    {
+      return m_state && m_state->GetGeneration() != m_generation;
+    }
+
+    //! @brief Mark the link as resolved against the current generation
+    void MarkResolved() noexcept
+    {
+      if (m_state)
+      {
+        m_generation = m_state->GetGeneration();
+      }
+    }
+
+    //! @brief The density the sprite should be resolved to (only valid if the link is attached to a state)
+    uint32_t GetDensityDpi() const noexcept
+    {
+      return m_state ? m_state->GetDensityDpi() : 0u;
+    }
+
+    //! @brief If the link is stale call resolveFunc(densityDpi) and mark the link as resolved once it returns.
+    //!        If resolveFunc throws the link stays stale.
+    template <typename TResolveFunc>
+    void ResolveIfStale(TResolveFunc&& resolveFunc)
+    {
+      if (IsStale())
+      {
+        std::forward<TResolveFunc>(resolveFunc)(m_state->GetDensityDpi());
+        m_generation = m_state->GetGeneration();
+      }
+    }
+  };
+
+  //! @brief CRTP base for the sprites that can resolve density changes lazily from a SpriteDensityState.
+  //!        TSprite must implement 'void DoResolve(const uint32_t densityDpi) const' which updates its mutable render info and
+  //!        befriend this class. DoResolve may only throw for a zero image or density dpi. The sprite infos never hold a zero image dpi
+  //!        (their constructors reject it) and SpriteDensityState rejects a zero density, so the lazy resolve done by the noexcept getters
+  //!        can not throw.
+  //!
+  //!        The const getters of a linked sprite write the render info on the first access after a density change,
+  //!        so a sprite is NOT safe to read from multiple threads at the same time.
+  template <typename TSprite>
+  class SpriteDensityLinked
+  {
+    mutable SpriteDensityLink m_densityLink;
+
+  public:
+    //! @brief Attach the sprite to a shared density so density changes are resolved on the next access instead of requiring a Resize.
+    //!        The sprite is resolved to the current density right away.
+    void SetDensitySource(std::shared_ptr<const SpriteDensityState> densityState)
+    {
+      SpriteDensityLink densityLink(std::move(densityState));
+      if (densityLink.IsAttached())
+      {
+        static_cast<const TSprite*>(this)->DoResolve(densityLink.GetDensityDpi());
+      }
+      m_densityLink = std::move(densityLink);
+    }
+
+  protected:
+    SpriteDensityLinked() = default;
+    ~SpriteDensityLinked() = default;
+
+    //! @brief Resolve the sprite to the given density, this overrides the linked density until it changes again
+    void ResolveDensity(const uint32_t densityDpi)
+    {
+      static_cast<const TSprite*>(this)->DoResolve(densityDpi);
+      m_densityLink.MarkResolved();
+    }
+
+    //! @brief Resolve the sprite if the linked density changed since the last resolve
+    void EnsureResolved() const noexcept
+    {
+      m_densityLink.ResolveIfStale([this](const uint32_t densityDpi) { static_cast<const TSprite*>(this)->DoResolve(densityDpi); });
+    }
+  };
+}
+
+#endif
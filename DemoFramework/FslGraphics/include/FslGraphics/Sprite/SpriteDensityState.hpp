@@ -0,0 +1,85 @@
+#ifndef FSLGRAPHICS_SPRITE_SPRITEDENSITYSTATE_HPP
+#define FSLGRAPHICS_SPRITE_SPRITEDENSITYSTATE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <stdexcept>
+
+namespace Fsl
+{
+  //! @brief The density shared between a SpriteManager and the sprites it created.
+  //!        Every density change bumps the generation so sprites can detect that they are stale and re-resolve on their next access.
+  //!        The density is never zero.
+  class SpriteDensityState final
+  {
+    uint32_t m_densityDpi;
+    uint32_t m_generation{0};
+
+  public:
+    explicit SpriteDensityState(const uint32_t densityDpi)
+      : m_densityDpi(densityDpi)
+    {
+      if (densityDpi == 0u)
+      {
+        throw std::invalid_argument("densityDpi can not be zero");
+      }
+    }
+
+    uint32_t GetDensityDpi() const noexcept
+    {
+      return m_densityDpi;
+    }
+
+    uint32_t GetGeneration() const noexcept
+    {
+      return m_generation;
+    }
+
+    //! @return true if the density changed
+    bool SetDensityDpi(const uint32_t densityDpi)
+    {
+      if (densityDpi == 0u)
+      {
+        throw std::invalid_argument("densityDpi can not be zero");
+      }
+      if (densityDpi == m_densityDpi)
+      {
+        return false;
+      }
+      m_densityDpi = densityDpi;
+      ++m_generation;
+      return true;
+    }
+  };
+}
+
+#endif
@@ -34,9 +34,11 @@
 #include <FslBase/IO/PathView.hpp>
 #include <FslGraphics/Font/BitmapFont.hpp>
 #include <FslGraphics/Sprite/ISprite.hpp>
+#include <FslGraphics/Sprite/SpriteDensityState.hpp>
 #include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
-#include <list>
 #include <memory>
+#include <unordered_map>
+#include <vector>
 
 namespace Fsl
 {
@@ -55,11 +57,32 @@ namespace Fsl
   struct SpriteMaterialInfo;
 
   //! @brief Very basic material manager
+  //!        Sprites created by the manager share its density state and resolve density changes lazily on their next access,
+  //!        so a Resize only touches the sprites that are actually used afterwards. Sprites registered with Add are resized eagerly.
+  //!        As the lazy resolve writes to the sprite, the sprites created by the manager must not be read from multiple threads at the same time.
   class SpriteManager final
   {
+    struct RecordIndex
+    {
+      bool IsLazy{false};
+      std::size_t Index{0};
+
+      constexpr RecordIndex() noexcept = default;
+      constexpr RecordIndex(const bool isLazy, const std::size_t index) noexcept
+        : IsLazy(isLazy)
+        , Index(index)
+      {
+      }
+    };
+
     SpriteNativeAreaCalc m_spriteNativeAreaCalc;
-    std::list<std::shared_ptr<ISprite>> m_sprites;
-    uint32_t m_densityDpi;
+    std::shared_ptr<SpriteDensityState> m_densityState;
+    //! Sprites created by the manager, they resolve density changes on their next access
+    std::vector<std::shared_ptr<ISprite>> m_lazySprites;
+    //! Sprites registered with Add, they are resized as soon as the density changes
+    std::vector<std::shared_ptr<ISprite>> m_eagerSprites;
+    //! Sprite to record index
+    std::unordered_map<const ISprite*, RecordIndex> m_lookup;
 
   public:
     explicit SpriteManager(const uint32_t densityDpi, const bool useYFlipTextureCoordinates);
@@ -72,7 +95,7 @@ namespace Fsl
 
     uint32_t GetDensityDpi() const
     {
-      return m_densityDpi;
+      return m_densityState->GetDensityDpi();
     }
 
     std::size_t Count() const;
@@ -121,6 +144,11 @@ namespace Fsl
 
     void PatchSpriteFont(const std::shared_ptr<SpriteFont>& font, const SpriteMaterialInfo& spriteMaterialInfo, const BitmapFont& bitmapFont,
                          const IO::PathView& debugName);
+
+  private:
+    template <typename TSprite>
+    void AddLazy(const std::shared_ptr<TSprite>& sprite);
+    void AddRecord(std::shared_ptr<ISprite> sprite, const bool isLazy);
   };
 }
 
@@ -0,0 +1,175 @@
+#ifndef FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLAS_HPP
+#define FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLAS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/DynamicTextureAtlasConfig.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/DynamicTextureAtlasRegion.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/SkylineBinPacker.hpp>
+#include <functional>
+#include <map>
+#include <optional>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A texture atlas that is packed at runtime, so images that are loaded or generated on the fly can share a texture and be batched.
+  //!        The atlas only manages the CPU side copy of the pages, the owner uploads the pages that are reported dirty to its textures.
+  //!        Pages are added on demand until DynamicTextureAtlasConfig::MaxPages is reached, after that the least recently used page that
+  //!        has not been used during the current frame is evicted and all its entries removed.
+  //!        Evicting or reclaiming a page changes its generation, so regions handed out earlier can be detected as stale with IsValid.
+  class DynamicTextureAtlas
+  {
+    struct Page
+    {
+      SkylineBinPacker Packer;
+      std::vector<uint8_t> Content;
+      //! The area modified since the last ClearDirtyRect
+      PxRectangleU32 DirtyRectPx;
+      bool IsDirty{false};
+      uint32_t EntryCount{0};
+      uint64_t LastUsedFrame{0};
+      //! Changed every time the page content is discarded
+      uint32_t Generation{0};
+    };
+
+    struct Record
+    {
+      uint32_t PageIndex{0};
+      //! The location of the image excluding its bleed and padding
+      PxRectangleU32 RectPx;
+    };
+
+    DynamicTextureAtlasConfig m_config;
+    uint32_t m_bytesPerPixel;
+    uint32_t m_pageStride;
+    std::vector<Page> m_pages;
+    std::map<IO::Path, Record, std::less<>> m_entries;
+    uint64_t m_frame{0};
+    uint32_t m_evictedPageCount{0};
+    //! The last generation given to a page, generations are unique for the lifetime of the atlas (even across Clear)
+    uint32_t m_lastPageGeneration{0};
+    //! The page that received the last entry, its tried first so consecutive adds end up on the same page
+    uint32_t m_activePageIndex{0};
+
+  public:
+    explicit DynamicTextureAtlas(const DynamicTextureAtlasConfig& config);
+
+    const DynamicTextureAtlasConfig& GetConfig() const noexcept
+    {
+      return m_config;
+    }
+
+    //! @brief The number of entries
+    std::size_t Count() const noexcept
+    {
+      return m_entries.size();
+    }
+
+    uint32_t PageCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_pages.size());
+    }
+
+    //! @brief The number of pages that have been evicted since the atlas was created
+    uint32_t GetEvictedPageCount() const noexcept
+    {
+      return m_evictedPageCount;
+    }
+
+    //! @brief Mark the start of a new frame, pages used during the current frame are never evicted
+    void NextFrame() noexcept
+    {
+      ++m_frame;
+    }
+
+    bool Contains(const IO::Path& name) const;
+
+    //! @brief Check if the region still refers to its content, it becomes stale once its page is evicted, reclaimed or the atlas is cleared.
+    bool IsValid(const DynamicTextureAtlasRegion& region) const noexcept;
+
+    //! @brief Lookup a entry and mark it as used during the current frame
+    //! @return the region or nullopt if the entry is unknown or was evicted
+    std::optional<DynamicTextureAtlasRegion> TryGet(const IO::Path& name);
+
+    //! @brief Add a bitmap to the atlas
+    //! @return the region or nullopt if there was no room for it (all pages are in use by the current frame)
+    //! @throws UsageErrorException if the name is already in use or the pixel format does not match the atlas
+    //! @throws NotSupportedException if the bitmap can never fit inside a page
+    std::optional<DynamicTextureAtlasRegion> TryAdd(const IO::Path& name, const ReadOnlyRawBitmap& bitmap);
+
+    //! @brief Add a bitmap to the atlas
+    //! @throws UsageErrorException if there was no room for it, see TryAdd for the rest
+    DynamicTextureAtlasRegion Add(const IO::Path& name, const ReadOnlyRawBitmap& bitmap);
+
+    //! @brief Replace the content of a existing entry in place, only the entry area is marked dirty.
+    //! @return false if the entry is unknown
+    //! @throws UsageErrorException if the bitmap extent or pixel format does not match the entry
+    bool Update(const IO::Path& name, const ReadOnlyRawBitmap& bitmap);
+
+    //! @brief Remove a entry, the space is reclaimed once all entries on the page are removed.
+    bool Remove(const IO::Path& name);
+
+    //! @brief Remove all entries and pages
+    void Clear();
+
+    //! @brief Get the full content of a page
+    ReadOnlyRawBitmap GetPageBitmap(const uint32_t pageIndex) const;
+
+    //! @brief Check if the page has been modified since the last ClearDirtyRect
+    bool IsPageDirty(const uint32_t pageIndex) const;
+
+    //! @brief Get the area of the page that was modified since the last ClearDirtyRect (empty if the page is clean)
+    PxRectangleU32 GetPageDirtyRect(const uint32_t pageIndex) const;
+
+    //! @brief Get the full width rows covered by the dirty area as one contiguous bitmap (empty if the page is clean).
+    //!        Uploading the rows only requires a y offset, so it works even on APIs that can not specify a source row length (like GLES2).
+    ReadOnlyRawBitmap GetPageDirtyRowBitmap(const uint32_t pageIndex) const;
+
+    //! @brief Mark the page as uploaded
+    void ClearPageDirtyRect(const uint32_t pageIndex);
+
+  private:
+    const Page& GetPage(const uint32_t pageIndex) const;
+    std::optional<uint32_t> TryFindEvictablePage() const noexcept;
+    void EvictPage(const uint32_t pageIndex);
+    std::optional<PxRectangleU32> TryAllocateOnExistingPage(const PxExtent2D cellExtentPx, uint32_t& rPageIndex);
+    void ResetPage(Page& rPage);
+    DynamicTextureAtlasRegion ToRegion(const Record& record) const noexcept;
+    void Blit(Page& rPage, const PxRectangleU32& dstRectPx, const ReadOnlyRawBitmap& bitmap);
+  };
+}
+
+#endif
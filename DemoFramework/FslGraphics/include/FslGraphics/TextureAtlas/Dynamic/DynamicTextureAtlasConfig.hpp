@@ -0,0 +1,69 @@
+#ifndef FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLASCONFIG_HPP
+#define FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLASCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslGraphics/PixelFormat.hpp>
+
+namespace Fsl
+{
+  struct DynamicTextureAtlasConfig
+  {
+    //! The extent of each atlas page
+    PxExtent2D PageExtentPx{PxExtent2D::Create(1024, 1024)};
+    //! The pixel format of the pages, all added bitmaps must use this format
+    PixelFormat PagePixelFormat{PixelFormat::R8G8B8A8_UNORM};
+    //! The number of empty pixels between two entries
+    uint32_t PaddingPx{1};
+    //! The number of times the edge pixels of each entry is repeated around it, so linear filtering never samples a neighbour
+    uint32_t BleedPx{1};
+    //! The maximum number of pages, once reached the least recently used page is evicted to make room
+    uint32_t MaxPages{4};
+    //! The density the entries are authored for
+    uint32_t Dpi{160};
+
+    constexpr DynamicTextureAtlasConfig() noexcept = default;
+    constexpr DynamicTextureAtlasConfig(const PxExtent2D pageExtentPx, const PixelFormat pagePixelFormat, const uint32_t paddingPx,
+                                        const uint32_t bleedPx, const uint32_t maxPages, const uint32_t dpi) noexcept
+      : PageExtentPx(pageExtentPx)
+      , PagePixelFormat(pagePixelFormat)
+      , PaddingPx(paddingPx)
+      , BleedPx(bleedPx)
+      , MaxPages(maxPages)
+      , Dpi(dpi)
+    {
+    }
+  };
+}
+
+#endif
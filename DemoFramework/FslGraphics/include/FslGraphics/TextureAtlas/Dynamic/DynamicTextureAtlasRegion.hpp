@@ -0,0 +1,69 @@
+#ifndef FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLASREGION_HPP
+#define FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_DYNAMICTEXTUREATLASREGION_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/TextureAtlas/AtlasTextureInfo.hpp>
+
+namespace Fsl
+{
+  struct DynamicTextureAtlasRegion
+  {
+    //! The page that contains the entry, each page is a separate texture
+    uint32_t PageIndex{0};
+    //! The generation of the page when the region was created, once the page is evicted or reclaimed the generation changes.
+    //! Use DynamicTextureAtlas::IsValid to check if the region still refers to its content.
+    uint32_t PageGeneration{0};
+    //! The location of the entry inside the page (this is compatible with the SpriteManager)
+    AtlasTextureInfo TextureInfo;
+
+    constexpr DynamicTextureAtlasRegion() noexcept = default;
+    constexpr DynamicTextureAtlasRegion(const uint32_t pageIndex, const uint32_t pageGeneration, const AtlasTextureInfo& textureInfo) noexcept
+      : PageIndex(pageIndex)
+      , PageGeneration(pageGeneration)
+      , TextureInfo(textureInfo)
+    {
+    }
+
+    constexpr bool operator==(const DynamicTextureAtlasRegion& rhs) const noexcept
+    {
+      return PageIndex == rhs.PageIndex && PageGeneration == rhs.PageGeneration && TextureInfo == rhs.TextureInfo;
+    }
+
+    constexpr bool operator!=(const DynamicTextureAtlasRegion& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,104 @@
+#ifndef FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_SKYLINEBINPACKER_HPP
+#define FSLGRAPHICS_TEXTUREATLAS_DYNAMIC_SKYLINEBINPACKER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <optional>
+#include <vector>
+
+namespace Fsl
+{
+  //! @brief A skyline bin packer using the bottom-left heuristic.
+  //!        The skyline only tracks the top edge of the packed rectangles so allocation is O(n) in the number of skyline segments,
+  //!        which makes it a good fit for runtime packing. Individual rectangles can not be freed, only the full bin can be cleared.
+  class SkylineBinPacker
+  {
+    struct Segment
+    {
+      uint32_t X{0};
+      uint32_t Y{0};
+      uint32_t Width{0};
+
+      constexpr Segment() noexcept = default;
+      constexpr Segment(const uint32_t x, const uint32_t y, const uint32_t width) noexcept
+        : X(x)
+        , Y(y)
+        , Width(width)
+      {
+      }
+    };
+
+    PxExtent2D m_extentPx;
+    std::vector<Segment> m_skyline;
+    uint64_t m_usedAreaPx{0};
+
+  public:
+    SkylineBinPacker();
+    explicit SkylineBinPacker(const PxExtent2D extentPx);
+
+    PxExtent2D GetExtent() const noexcept
+    {
+      return m_extentPx;
+    }
+
+    //! @brief Get the area covered by the allocated rectangles
+    uint64_t GetUsedArea() const noexcept
+    {
+      return m_usedAreaPx;
+    }
+
+    //! @brief Get the number of segments in the skyline
+    std::size_t GetSegmentCount() const noexcept
+    {
+      return m_skyline.size();
+    }
+
+    //! @brief Remove all allocations
+    void Clear();
+
+    //! @brief Remove all allocations and change the extent of the bin
+    void Reset(const PxExtent2D extentPx);
+
+    //! @brief Try to allocate a rectangle of the given extent
+    //! @return the allocated rectangle or nullopt if there was no room for it (a empty extent is never allocated)
+    std::optional<PxRectangleU32> TryAllocate(const PxExtent2D extentPx);
+
+  private:
+    //! @brief Find the lowest y the rectangle can be placed at when its left edge starts at the given segment
+    std::optional<uint32_t> TryFit(const std::size_t segmentIndex, const uint32_t width, const uint32_t height) const noexcept;
+    void AddSkylineLevel(const std::size_t segmentIndex, const uint32_t x, const uint32_t y, const uint32_t width, const uint32_t height);
+  };
+}
+
+#endif
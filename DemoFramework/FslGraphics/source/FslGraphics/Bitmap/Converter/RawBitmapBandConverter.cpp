@@ -0,0 +1,144 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Log3Core.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/RawBitmapUtil.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+
+namespace Fsl
+{
+  namespace
+  {
+    bool TryConvertRows(RawBitmapEx& rDstRows, const ReadOnlyRawBitmap& srcRows)
+    {
+      if (rDstRows.GetPixelFormat() == srcRows.GetPixelFormat())
+      {
+        // RawBitmapConverter considers equal formats a no-op, but here the rows live in two different buffers
+        RawBitmapUtil::MemoryCopy(rDstRows, srcRows);
+        return true;
+      }
+      return RawBitmapConverter::TryConvert(rDstRows, srcRows);
+    }
+
+    RawBitmapEx CreateDstRows(RawBitmapEx& rDstBitmap, const uint32_t firstRow, const uint32_t rowCount)
+    {
+      const uint32_t stride = rDstBitmap.Stride();
+      auto* const pContent = static_cast<uint8_t*>(rDstBitmap.Content()) + (static_cast<std::size_t>(firstRow) * stride);
+      const PxSize2D sizePx = PxSize2D::Create(rDstBitmap.RawWidth(), UncheckedNumericCast<int32_t>(rowCount));
+      return RawBitmapEx::UncheckedCreate(pContent, rowCount * stride, sizePx, rDstBitmap.GetPixelFormat(), stride, rDstBitmap.GetOrigin());
+    }
+
+    ReadOnlyRawBitmap CreateSrcRows(const ReadOnlyRawBitmap& srcBand, const uint32_t firstRow, const uint32_t rowCount, const BitmapOrigin origin)
+    {
+      // The views are given the destination origin so the converters treat them as a plain copy of rows
+      const uint32_t stride = srcBand.Stride();
+      const auto* const pContent = static_cast<const uint8_t*>(srcBand.Content()) + (static_cast<std::size_t>(firstRow) * stride);
+      const PxSize2D sizePx = PxSize2D::Create(srcBand.RawWidth(), UncheckedNumericCast<int32_t>(rowCount));
+      return ReadOnlyRawBitmap::UncheckedCreate(pContent, rowCount * stride, sizePx, srcBand.GetPixelFormat(), stride, origin);
+    }
+
+    constexpr bool IsFlipped(const BitmapOrigin srcOrigin, const BitmapOrigin dstOrigin) noexcept
+    {
+      return srcOrigin != BitmapOrigin::Undefined && dstOrigin != BitmapOrigin::Undefined && srcOrigin != dstOrigin;
+    }
+  }
+
+
+  bool RawBitmapBandConverter::IsSupported(const PixelFormat srcPixelFormat, const PixelFormat dstPixelFormat) noexcept
+  {
+    if (srcPixelFormat == PixelFormat::Undefined || dstPixelFormat == PixelFormat::Undefined)
+    {
+      return false;
+    }
+    if (PixelFormatUtil::GetPixelFormatLayout(srcPixelFormat) == PixelFormatUtil::GetPixelFormatLayout(dstPixelFormat))
+    {
+      return true;
+    }
+    const SupportedConversion conversion(srcPixelFormat, dstPixelFormat);
+    for (const auto& entry : RawBitmapConverter::GetSupportedConversionsNonOverlapping())
+    {
+      if (entry == conversion)
+      {
+        return true;
+      }
+    }
+    return false;
+  }
+
+
+  bool RawBitmapBandConverter::TryWriteBand(RawBitmapEx& rDstBitmap, const ReadOnlyRawBitmap& srcBand, const uint32_t srcFirstRow)
+  {
+    if (!rDstBitmap.IsValid() || !srcBand.IsValid())
+    {
+      FSLLOG3_DEBUG_WARNING("TryWriteBand called with invalid bitmap");
+      return false;
+    }
+    const uint32_t dstHeight = rDstBitmap.RawUnsignedHeight();
+    const uint32_t bandHeight = srcBand.RawUnsignedHeight();
+    if (srcBand.Width() != rDstBitmap.Width() || srcFirstRow > dstHeight || bandHeight > (dstHeight - srcFirstRow))
+    {
+      return false;
+    }
+    if (!IsSupported(srcBand.GetPixelFormat(), rDstBitmap.GetPixelFormat()))
+    {
+      return false;
+    }
+    if (bandHeight == 0 || rDstBitmap.RawUnsignedWidth() == 0)
+    {
+      return true;
+    }
+
+    const BitmapOrigin dstOrigin = rDstBitmap.GetOrigin();
+    if (!IsFlipped(srcBand.GetOrigin(), dstOrigin))
+    {
+      // Same row order, so the band maps to one continuous block of destination rows
+      RawBitmapEx dstRows = CreateDstRows(rDstBitmap, srcFirstRow, bandHeight);
+      return TryConvertRows(dstRows, CreateSrcRows(srcBand, 0, bandHeight, dstOrigin));
+    }
+
+    // The row order is reversed, so convert one row at a time into its mirrored position
+    const uint32_t lastDstRow = dstHeight - 1u - srcFirstRow;
+    for (uint32_t y = 0; y < bandHeight; ++y)
+    {
+      RawBitmapEx dstRow = CreateDstRows(rDstBitmap, lastDstRow - y, 1u);
+      if (!TryConvertRows(dstRow, CreateSrcRows(srcBand, y, 1u, dstOrigin)))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+}
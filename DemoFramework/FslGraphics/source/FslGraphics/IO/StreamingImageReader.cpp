@@ -0,0 +1,452 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteArrayUtil.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/System/Platform/PlatformPathTransform.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/IO/StreamingImageReader.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <optional>
+#include <vector>
+
+// BMP format explained:
+// http://en.wikipedia.org/wiki/BMP_file_format
+// TGA format explained:
+// http://www.paulbourke.net/dataformats/tga/
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr std::size_t ReadBufferSize = 64 * 1024;
+      // The max bitmap size is 512MB (same limit as BMPUtil)
+      constexpr uint64_t MaxBitmapSize = 1024 * 1024 * 512;
+    }
+
+    namespace BmpConfig
+    {
+      constexpr uint16_t FileType = 0x4D42;
+      constexpr uint32_t SizeFileHeader = 14;
+      constexpr uint32_t SizeInfoHeader = 40;
+      constexpr uint32_t CompressionRGB = 0;
+
+      // Offsets relative to the start of the file
+      constexpr std::size_t OffsetFileType = 0;
+      constexpr std::size_t OffsetBitmapOffset = 10;
+      constexpr std::size_t OffsetInfoHeaderSize = 14;
+      constexpr std::size_t OffsetImageWidth = 18;
+      constexpr std::size_t OffsetImageHeight = 22;
+      constexpr std::size_t OffsetPlanes = 26;
+      constexpr std::size_t OffsetBitsPerPixel = 28;
+      constexpr std::size_t OffsetCompression = 30;
+    }
+
+    namespace TgaConfig
+    {
+      constexpr uint32_t SizeHeader = 18;
+      constexpr uint8_t ImageTypeTrueColor = 2;
+      constexpr uint8_t ImageTypeTrueColorRLE = 10;
+      constexpr uint8_t DescriptorRightToLeft = 0x10;
+      constexpr uint8_t DescriptorTopToBottom = 0x20;
+      constexpr uint8_t PacketRunFlag = 0x80;
+      constexpr uint8_t PacketCountMask = 0x7F;
+
+      constexpr std::size_t OffsetIdLength = 0;
+      constexpr std::size_t OffsetColorMapType = 1;
+      constexpr std::size_t OffsetImageType = 2;
+      constexpr std::size_t OffsetImageWidth = 12;
+      constexpr std::size_t OffsetImageHeight = 14;
+      constexpr std::size_t OffsetPixelDepth = 16;
+      constexpr std::size_t OffsetDescriptor = 17;
+    }
+
+    //! Describes the pixel rows exactly as they are stored in the file
+    struct StoredImageLayout
+    {
+      PxSize2D SizePx;
+      PixelFormat Format{PixelFormat::Undefined};
+      BitmapOrigin Origin{BitmapOrigin::Undefined};
+      //! The number of bytes used for each stored row (including any padding)
+      uint32_t Stride{0};
+      uint32_t BytesPerPixel{0};
+      bool IsRLE{false};
+    };
+
+    class BufferedStreamReader
+    {
+      std::istream& m_rStream;
+      std::vector<uint8_t> m_buffer;
+      std::size_t m_position{0};
+      std::size_t m_size{0};
+
+    public:
+      explicit BufferedStreamReader(std::istream& rStream)
+        : m_rStream(rStream)
+        , m_buffer(LocalConfig::ReadBufferSize)
+      {
+      }
+
+      uint8_t ReadByte()
+      {
+        if (m_position >= m_size && !TryFill())
+        {
+          throw FormatException("Failed to read the expected amount of bytes");
+        }
+        return m_buffer[m_position++];
+      }
+
+      void Read(uint8_t* pDst, std::size_t count)
+      {
+        const std::size_t cbBuffered = std::min(count, m_size - m_position);
+        std::memcpy(pDst, m_buffer.data() + m_position, cbBuffered);
+        m_position += cbBuffered;
+        pDst += cbBuffered;
+        count -= cbBuffered;
+        if (count == 0)
+        {
+          return;
+        }
+        if (count >= m_buffer.size())
+        {
+          // Large requests bypass the buffer
+          m_rStream.read(reinterpret_cast<char*>(pDst), NumericCast<std::streamsize>(count));
+          if (static_cast<std::size_t>(m_rStream.gcount()) != count)
+          {
+            throw FormatException("Failed to read the expected amount of bytes");
+          }
+          return;
+        }
+        if (!TryFill() || m_size < count)
+        {
+          throw FormatException("Failed to read the expected amount of bytes");
+        }
+        std::memcpy(pDst, m_buffer.data(), count);
+        m_position = count;
+      }
+
+      void Skip(std::size_t count)
+      {
+        while (count > 0)
+        {
+          if (m_position >= m_size && !TryFill())
+          {
+            throw FormatException("Failed to skip the expected amount of bytes");
+          }
+          const std::size_t cbSkip = std::min(count, m_size - m_position);
+          m_position += cbSkip;
+          count -= cbSkip;
+        }
+      }
+
+    private:
+      bool TryFill()
+      {
+        m_rStream.read(reinterpret_cast<char*>(m_buffer.data()), NumericCast<std::streamsize>(m_buffer.size()));
+        m_size = static_cast<std::size_t>(m_rStream.gcount());
+        m_position = 0;
+        return m_size > 0;
+      }
+    };
+
+
+    //! TGA RLE packets are allowed to cross row boundaries, so the packet state is kept between calls
+    class TgaRleDecoder
+    {
+      uint32_t m_bytesPerPixel;
+      uint32_t m_remaining{0};
+      bool m_isRun{false};
+      std::array<uint8_t, 4> m_pixel{};
+
+    public:
+      explicit TgaRleDecoder(const uint32_t bytesPerPixel)
+        : m_bytesPerPixel(bytesPerPixel)
+      {
+        assert(bytesPerPixel <= m_pixel.size());
+      }
+
+      void DecodeRow(BufferedStreamReader& rReader, uint8_t* pDst, const uint32_t pixelCount)
+      {
+        uint32_t pixelsLeft = pixelCount;
+        while (pixelsLeft > 0)
+        {
+          if (m_remaining == 0)
+          {
+            const uint8_t packetHeader = rReader.ReadByte();
+            m_remaining = (packetHeader & TgaConfig::PacketCountMask) + 1u;
+            m_isRun = (packetHeader & TgaConfig::PacketRunFlag) != 0;
+            if (m_isRun)
+            {
+              rReader.Read(m_pixel.data(), m_bytesPerPixel);
+            }
+          }
+
+          const uint32_t count = std::min(m_remaining, pixelsLeft);
+          if (m_isRun)
+          {
+            for (uint32_t i = 0; i < count; ++i)
+            {
+              std::memcpy(pDst, m_pixel.data(), m_bytesPerPixel);
+              pDst += m_bytesPerPixel;
+            }
+          }
+          else
+          {
+            rReader.Read(pDst, static_cast<std::size_t>(count) * m_bytesPerPixel);
+            pDst += static_cast<std::size_t>(count) * m_bytesPerPixel;
+          }
+          m_remaining -= count;
+          pixelsLeft -= count;
+        }
+      }
+    };
+
+
+    std::optional<StoredImageLayout> TryReadBmpHeader(BufferedStreamReader& rReader)
+    {
+      std::array<uint8_t, BmpConfig::SizeFileHeader + BmpConfig::SizeInfoHeader> header{};
+      rReader.Read(header.data(), BmpConfig::SizeFileHeader + 4u);
+
+      if (ByteArrayUtil::ReadUInt16LE(header.data(), header.size(), BmpConfig::OffsetFileType) != BmpConfig::FileType)
+      {
+        throw FormatException("Unsupported BMP file format");
+      }
+      const uint32_t bitmapOffset = ByteArrayUtil::ReadUInt32LE(header.data(), header.size(), BmpConfig::OffsetBitmapOffset);
+      const uint32_t infoHeaderSize = ByteArrayUtil::ReadUInt32LE(header.data(), header.size(), BmpConfig::OffsetInfoHeaderSize);
+      if (infoHeaderSize < BmpConfig::SizeInfoHeader)
+      {
+        // The old OS/2 headers are not supported
+        return {};
+      }
+      rReader.Read(header.data() + BmpConfig::SizeFileHeader + 4u, BmpConfig::SizeInfoHeader - 4u);
+
+      const int32_t width = ByteArrayUtil::ReadInt32LE(header.data(), header.size(), BmpConfig::OffsetImageWidth);
+      const int32_t height = ByteArrayUtil::ReadInt32LE(header.data(), header.size(), BmpConfig::OffsetImageHeight);
+      const uint16_t planes = ByteArrayUtil::ReadUInt16LE(header.data(), header.size(), BmpConfig::OffsetPlanes);
+      const uint16_t bitsPerPixel = ByteArrayUtil::ReadUInt16LE(header.data(), header.size(), BmpConfig::OffsetBitsPerPixel);
+      const uint32_t compression = ByteArrayUtil::ReadUInt32LE(header.data(), header.size(), BmpConfig::OffsetCompression);
+      if (compression != BmpConfig::CompressionRGB || (bitsPerPixel != 24 && bitsPerPixel != 32) || planes != 1 || width <= 0 || height == 0 ||
+          height == std::numeric_limits<int32_t>::min())
+      {
+        return {};
+      }
+
+      const uint64_t cbConsumed = static_cast<uint64_t>(BmpConfig::SizeFileHeader) + infoHeaderSize;
+      if (bitmapOffset < cbConsumed)
+      {
+        throw FormatException("The BMP pixel data offset is invalid");
+      }
+      rReader.Skip(static_cast<std::size_t>(bitmapOffset - cbConsumed));
+
+      StoredImageLayout layout;
+      layout.SizePx = PxSize2D::Create(width, std::abs(height));
+      layout.Format = bitsPerPixel == 24 ? PixelFormat::B8G8R8_UINT : PixelFormat::B8G8R8A8_UINT;
+      // A positive height means the rows are stored bottom-up
+      layout.Origin = height > 0 ? BitmapOrigin::LowerLeft : BitmapOrigin::UpperLeft;
+      layout.BytesPerPixel = bitsPerPixel / 8u;
+      // Each stored row is padded to a 4 byte boundary
+      const uint64_t stride = ((static_cast<uint64_t>(width) * layout.BytesPerPixel) + 3u) & ~static_cast<uint64_t>(3u);
+      if (stride > LocalConfig::MaxBitmapSize)
+      {
+        throw FormatException("The bitmap size was exceeded");
+      }
+      layout.Stride = static_cast<uint32_t>(stride);
+      return layout;
+    }
+
+
+    std::optional<StoredImageLayout> TryReadTgaHeader(BufferedStreamReader& rReader)
+    {
+      std::array<uint8_t, TgaConfig::SizeHeader> header{};
+      rReader.Read(header.data(), header.size());
+
+      const uint8_t idLength = header[TgaConfig::OffsetIdLength];
+      const uint8_t colorMapType = header[TgaConfig::OffsetColorMapType];
+      const uint8_t imageType = header[TgaConfig::OffsetImageType];
+      const uint16_t width = ByteArrayUtil::ReadUInt16LE(header.data(), header.size(), TgaConfig::OffsetImageWidth);
+      const uint16_t height = ByteArrayUtil::ReadUInt16LE(header.data(), header.size(), TgaConfig::OffsetImageHeight);
+      const uint8_t pixelDepth = header[TgaConfig::OffsetPixelDepth];
+      const uint8_t descriptor = header[TgaConfig::OffsetDescriptor];
+      if (colorMapType != 0 || (imageType != TgaConfig::ImageTypeTrueColor && imageType != TgaConfig::ImageTypeTrueColorRLE) ||
+          (pixelDepth != 24 && pixelDepth != 32) || (descriptor & TgaConfig::DescriptorRightToLeft) != 0 || width == 0 || height == 0)
+      {
+        return {};
+      }
+      rReader.Skip(idLength);
+
+      StoredImageLayout layout;
+      layout.SizePx = PxSize2D::Create(width, height);
+      layout.Format = pixelDepth == 24 ? PixelFormat::B8G8R8_UINT : PixelFormat::B8G8R8A8_UINT;
+      layout.Origin = (descriptor & TgaConfig::DescriptorTopToBottom) != 0 ? BitmapOrigin::UpperLeft : BitmapOrigin::LowerLeft;
+      layout.BytesPerPixel = pixelDepth / 8u;
+      layout.Stride = width * layout.BytesPerPixel;
+      layout.IsRLE = imageType == TgaConfig::ImageTypeTrueColorRLE;
+      return layout;
+    }
+
+
+    std::optional<StoredImageLayout> TryReadHeader(BufferedStreamReader& rReader, const ImageFormat imageFormat)
+    {
+      switch (imageFormat)
+      {
+      case ImageFormat::Bmp:
+        return TryReadBmpHeader(rReader);
+      case ImageFormat::Tga:
+        return TryReadTgaHeader(rReader);
+      default:
+        return {};
+      }
+    }
+
+
+    //! Decode the next rows of the image into pDst, the rows are written with the stored stride
+    void DecodeRows(BufferedStreamReader& rReader, TgaRleDecoder& rRleDecoder, const StoredImageLayout& layout, uint8_t* const pDst,
+                    const uint32_t rowCount)
+    {
+      if (!layout.IsRLE)
+      {
+        rReader.Read(pDst, static_cast<std::size_t>(rowCount) * layout.Stride);
+        return;
+      }
+      for (uint32_t y = 0; y < rowCount; ++y)
+      {
+        rRleDecoder.DecodeRow(rReader, pDst + (static_cast<std::size_t>(y) * layout.Stride), layout.SizePx.RawUnsignedWidth());
+      }
+    }
+  }
+
+
+  bool StreamingImageReader::IsSupported(const ImageFormat imageFormat) noexcept
+  {
+    return imageFormat == ImageFormat::Bmp || imageFormat == ImageFormat::Tga;
+  }
+
+
+  bool StreamingImageReader::TryRead(Bitmap& rBitmap, const IO::Path& path, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat,
+                                     const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder, const uint32_t bandHeight)
+  {
+    if (!IsSupported(imageFormat))
+    {
+      return false;
+    }
+    std::ifstream file(PlatformPathTransform::ToSystemPath(path), std::ios::in | std::ios::binary);
+    if (!file.good())
+    {
+      return false;
+    }
+    return TryRead(rBitmap, file, imageFormat, desiredPixelFormat, desiredOrigin, preferredChannelOrder, bandHeight);
+  }
+
+
+  bool StreamingImageReader::TryRead(Bitmap& rBitmap, std::istream& rStream, const ImageFormat imageFormat, const PixelFormat desiredPixelFormat,
+                                     const BitmapOrigin desiredOrigin, const PixelChannelOrder preferredChannelOrder, const uint32_t bandHeight)
+  {
+    if (bandHeight == 0)
+    {
+      throw std::invalid_argument("bandHeight can not be zero");
+    }
+    if (!IsSupported(imageFormat))
+    {
+      return false;
+    }
+
+    BufferedStreamReader reader(rStream);
+    const std::optional<StoredImageLayout> layout = TryReadHeader(reader, imageFormat);
+    if (!layout.has_value())
+    {
+      return false;
+    }
+
+    const PixelFormat dstPixelFormat =
+      desiredPixelFormat != PixelFormat::Undefined ? desiredPixelFormat : PixelFormatUtil::Transform(layout->Format, preferredChannelOrder);
+    const BitmapOrigin dstOrigin = desiredOrigin != BitmapOrigin::Undefined ? desiredOrigin : layout->Origin;
+    if (!RawBitmapBandConverter::IsSupported(layout->Format, dstPixelFormat))
+    {
+      return false;
+    }
+
+    const uint32_t imageHeight = layout->SizePx.RawUnsignedHeight();
+    // When nothing needs converting the rows are decoded straight into the bitmap, keeping the stored stride
+    const bool isDirect = dstPixelFormat == layout->Format && dstOrigin == layout->Origin;
+    const uint32_t dstStride = isDirect ? layout->Stride : PixelFormatUtil::CalcMinimumStride(layout->SizePx.Width(), dstPixelFormat);
+    if ((static_cast<uint64_t>(std::max(dstStride, layout->Stride)) * imageHeight) > LocalConfig::MaxBitmapSize)
+    {
+      throw FormatException("The bitmap size was exceeded");
+    }
+
+    Bitmap bitmap;
+    bitmap.Reset(layout->SizePx, dstPixelFormat, dstStride, dstOrigin, BitmapClearMethod::DontModify);
+    {
+      Bitmap::ScopedDirectReadWriteAccess scopedAccess(bitmap);
+      RawBitmapEx& rDstBitmap = scopedAccess.AsRawBitmap();
+      TgaRleDecoder rleDecoder(layout->BytesPerPixel);
+      if (isDirect)
+      {
+        DecodeRows(reader, rleDecoder, *layout, static_cast<uint8_t*>(rDstBitmap.Content()), imageHeight);
+      }
+      else
+      {
+        const uint32_t maxBandRows = std::min(bandHeight, imageHeight);
+        std::vector<uint8_t> band(static_cast<std::size_t>(maxBandRows) * layout->Stride);
+        for (uint32_t firstRow = 0; firstRow < imageHeight; firstRow += maxBandRows)
+        {
+          const uint32_t bandRows = std::min(maxBandRows, imageHeight - firstRow);
+          DecodeRows(reader, rleDecoder, *layout, band.data(), bandRows);
+
+          const PxSize2D bandSizePx = PxSize2D::Create(layout->SizePx.RawWidth(), UncheckedNumericCast<int32_t>(bandRows));
+          const ReadOnlyRawBitmap srcBand = ReadOnlyRawBitmap::UncheckedCreate(band.data(), bandRows * layout->Stride, bandSizePx, layout->Format,
+                                                                               layout->Stride, layout->Origin);
+          if (!RawBitmapBandConverter::TryWriteBand(rDstBitmap, srcBand, firstRow))
+          {
+            throw InternalErrorException("The supported band conversion failed");
+          }
+        }
+      }
+    }
+    rBitmap = std::move(bitmap);
+    return true;
+  }
+}
@@ -0,0 +1,683 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/MathHelper_Clamp.hpp>
+#include <FslBase/Math/Vector4.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Font/SdfFontUtil.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2DQuadRenderer.hpp>
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr uint32_t VerticesPerQuad = 4;
+      constexpr std::size_t MinTilesPerChunk = 2;
+      constexpr float MinQuadArea = 1.0e-6f;
+      constexpr float MinPixelCoordinate = -1073741824.0f;
+      constexpr float MaxPixelCoordinate = 1073741824.0f;
+    }
+
+    constexpr uint32_t MaskRB = 0x00FF00FF;
+    constexpr uint32_t MaskGA = 0xFF00FF00;
+    constexpr uint32_t MaskOverflow = 0x01000100;
+    constexpr int64_t FixedOne = 0x10000;
+    constexpr int64_t FixedHalf = 0x8000;
+
+    constexpr uint32_t Pack(const Color color) noexcept
+    {
+      return static_cast<uint32_t>(color.RawR()) | (static_cast<uint32_t>(color.RawG()) << 8) | (static_cast<uint32_t>(color.RawB()) << 16) |
+             (static_cast<uint32_t>(color.RawA()) << 24);
+    }
+
+    //! Convert a 0..255 value to a 0..256 weight so 255 becomes a exact 1.0
+    constexpr uint32_t ToWeight(const uint32_t value) noexcept
+    {
+      return value + (value >> 7);
+    }
+
+    //! Interpolate all four channels, two at a time (the 16bit lanes can hold 255 * 256 without overflowing into the next channel)
+    inline uint32_t Lerp(const uint32_t c0, const uint32_t c1, const uint32_t weight1) noexcept
+    {
+      const uint32_t weight0 = 256u - weight1;
+      const uint32_t rb = ((((c0 & MaskRB) * weight0) + ((c1 & MaskRB) * weight1)) >> 8) & MaskRB;
+      const uint32_t ga = ((((c0 >> 8) & MaskRB) * weight0) + (((c1 >> 8) & MaskRB) * weight1)) & MaskGA;
+      return rb | ga;
+    }
+
+    inline uint32_t Scale(const uint32_t color, const uint32_t weight) noexcept
+    {
+      const uint32_t rb = (((color & MaskRB) * weight) >> 8) & MaskRB;
+      const uint32_t ga = (((color >> 8) & MaskRB) * weight) & MaskGA;
+      return rb | ga;
+    }
+
+    inline uint32_t AddSaturate(const uint32_t c0, const uint32_t c1) noexcept
+    {
+      uint32_t rb = (c0 & MaskRB) + (c1 & MaskRB);
+      uint32_t ga = ((c0 >> 8) & MaskRB) + ((c1 >> 8) & MaskRB);
+      // A lane that overflowed has bit 8 set, turn that into 0xFF for the lane
+      rb |= (rb & MaskOverflow) - ((rb & MaskOverflow) >> 8);
+      ga |= (ga & MaskOverflow) - ((ga & MaskOverflow) >> 8);
+      return (rb & MaskRB) | ((ga & MaskRB) << 8);
+    }
+
+    //! Per channel multiply, (t * c + 255) >> 8 is exact when c is 0 or 255
+    inline uint32_t Modulate(const uint32_t texel, const uint32_t color) noexcept
+    {
+      const uint32_t r = (((texel & 0xFF) * (color & 0xFF)) + 255u) >> 8;
+      const uint32_t g = ((((texel >> 8) & 0xFF) * ((color >> 8) & 0xFF)) + 255u) >> 8;
+      const uint32_t b = ((((texel >> 16) & 0xFF) * ((color >> 16) & 0xFF)) + 255u) >> 8;
+      const uint32_t a = (((texel >> 24) * (color >> 24)) + 255u) >> 8;
+      return r | (g << 8) | (b << 16) | (a << 24);
+    }
+
+    struct TextureState
+    {
+      const uint32_t* pTexels{nullptr};
+      int64_t Width{0};
+      int64_t Height{0};
+    };
+
+    struct QuadContext
+    {
+      TextureState Texture;
+      const std::array<uint8_t, 256>* pSdfTable{nullptr};
+      uint32_t* pTarget{nullptr};
+      std::size_t TargetStride{0};
+      int32_t ClipX0{0};
+      int32_t ClipY0{0};
+      int32_t ClipX1{0};
+      int32_t ClipY1{0};
+    };
+
+    // The samplers take the coordinate in texel space as 16.16 fixed point and clamp to the edge
+
+    struct NearestSampler
+    {
+      static inline uint32_t Sample(const TextureState& texture, const int64_t u, const int64_t v) noexcept
+      {
+        const int64_t x = MathHelper::Clamp(u >> 16, int64_t(0), texture.Width - 1);
+        const int64_t y = MathHelper::Clamp(v >> 16, int64_t(0), texture.Height - 1);
+        return texture.pTexels[(y * texture.Width) + x];
+      }
+    };
+
+    struct BilinearSampler
+    {
+      static inline uint32_t Sample(const TextureState& texture, const int64_t u, const int64_t v) noexcept
+      {
+        const int64_t su = u - FixedHalf;
+        const int64_t sv = v - FixedHalf;
+        const auto fx = static_cast<uint32_t>((su >> 8) & 0xFF);
+        const auto fy = static_cast<uint32_t>((sv >> 8) & 0xFF);
+        const int64_t x0 = MathHelper::Clamp(su >> 16, int64_t(0), texture.Width - 1);
+        const int64_t x1 = MathHelper::Clamp((su >> 16) + 1, int64_t(0), texture.Width - 1);
+        const int64_t y0 = MathHelper::Clamp(sv >> 16, int64_t(0), texture.Height - 1);
+        const int64_t y1 = MathHelper::Clamp((sv >> 16) + 1, int64_t(0), texture.Height - 1);
+        const uint32_t* const pRow0 = texture.pTexels + (y0 * texture.Width);
+        const uint32_t* const pRow1 = texture.pTexels + (y1 * texture.Width);
+        return Lerp(Lerp(pRow0[x0], pRow0[x1], fx), Lerp(pRow1[x0], pRow1[x1], fx), fy);
+      }
+    };
+
+    struct ShadeNormal
+    {
+      static inline uint32_t Shade(const uint32_t texel, const uint32_t color, const std::array<uint8_t, 256>* /*pSdfTable*/) noexcept
+      {
+        return color == 0xFFFFFFFF ? texel : Modulate(texel, color);
+      }
+    };
+
+    //! Matches the GLES3 sdf shader: the texel alpha is the distance and the alpha is found with a smoothstep
+    struct ShadeSdf
+    {
+      static inline uint32_t Shade(const uint32_t texel, const uint32_t color, const std::array<uint8_t, 256>* pSdfTable) noexcept
+      {
+        assert(pSdfTable != nullptr);
+        const uint32_t alpha = (*pSdfTable)[texel >> 24];
+        const uint32_t a = (((color >> 24) * alpha) + 255u) >> 8;
+        return (color & 0x00FFFFFF) | (a << 24);
+      }
+    };
+
+    struct BlendOpaque
+    {
+      static inline uint32_t Blend(const uint32_t src, const uint32_t /*dst*/) noexcept
+      {
+        return src;
+      }
+    };
+
+    //! ONE, ONE
+    struct BlendAdditive
+    {
+      static inline uint32_t Blend(const uint32_t src, const uint32_t dst) noexcept
+      {
+        return AddSaturate(src, dst);
+      }
+    };
+
+    //! ONE, ONE_MINUS_SRC_ALPHA
+    struct BlendPremultiplied
+    {
+      static inline uint32_t Blend(const uint32_t src, const uint32_t dst) noexcept
+      {
+        return AddSaturate(src, Scale(dst, 256u - ToWeight(src >> 24)));
+      }
+    };
+
+    //! SRC_ALPHA, ONE_MINUS_SRC_ALPHA
+    struct BlendNonPremultiplied
+    {
+      static inline uint32_t Blend(const uint32_t src, const uint32_t dst) noexcept
+      {
+        return Lerp(dst, src, ToWeight(src >> 24));
+      }
+    };
+
+    //! The first pixel whose center is at or after the given coordinate (clamped so it can always be converted to a int32_t)
+    inline int32_t ToPixelStart(const float value) noexcept
+    {
+      return static_cast<int32_t>(MathHelper::Clamp(std::ceil(value - 0.5f), LocalConfig::MinPixelCoordinate, LocalConfig::MaxPixelCoordinate));
+    }
+
+    inline int64_t ToFixed(const double value) noexcept
+    {
+      return static_cast<int64_t>(std::llround(value * static_cast<double>(FixedOne)));
+    }
+
+    inline bool IsAxisAligned(const VertexPositionColorTexture* const pQuad) noexcept
+    {
+      return pQuad[0].Position.Y == pQuad[1].Position.Y && pQuad[2].Position.Y == pQuad[3].Position.Y &&
+             pQuad[0].Position.X == pQuad[2].Position.X && pQuad[1].Position.X == pQuad[3].Position.X &&
+             pQuad[0].TextureCoordinate.X == pQuad[2].TextureCoordinate.X && pQuad[1].TextureCoordinate.X == pQuad[3].TextureCoordinate.X &&
+             pQuad[0].TextureCoordinate.Y == pQuad[1].TextureCoordinate.Y && pQuad[2].TextureCoordinate.Y == pQuad[3].TextureCoordinate.Y &&
+             pQuad[0].Color == pQuad[1].Color && pQuad[0].Color == pQuad[2].Color && pQuad[0].Color == pQuad[3].Color;
+    }
+
+    //! The common case, a axis aligned quad with a single color. The texture coordinate is stepped in fixed point along each span.
+    template <typename TSampler, typename TShader, typename TBlender>
+    void RasterizeAxisAligned(const QuadContext& context, const VertexPositionColorTexture* const pQuad)
+    {
+      const float x0 = pQuad[0].Position.X;
+      const float x1 = pQuad[1].Position.X;
+      const float y0 = pQuad[0].Position.Y;
+      const float y1 = pQuad[2].Position.Y;
+
+      const int32_t startX = std::max(context.ClipX0, ToPixelStart(std::min(x0, x1)));
+      const int32_t endX = std::min(context.ClipX1, ToPixelStart(std::max(x0, x1)));
+      const int32_t startY = std::max(context.ClipY0, ToPixelStart(std::min(y0, y1)));
+      const int32_t endY = std::min(context.ClipY1, ToPixelStart(std::max(y0, y1)));
+      if (startX >= endX || startY >= endY)
+      {
+        return;
+      }
+
+      // Texel space derivatives, calculated from the quad (not the tile) so all tiles agree on the mapping
+      const auto texWidth = static_cast<double>(context.Texture.Width);
+      const auto texHeight = static_cast<double>(context.Texture.Height);
+      const double dU = (static_cast<double>(pQuad[1].TextureCoordinate.X) - pQuad[0].TextureCoordinate.X) * texWidth / (double(x1) - x0);
+      const double dV = (static_cast<double>(pQuad[2].TextureCoordinate.Y) - pQuad[0].TextureCoordinate.Y) * texHeight / (double(y1) - y0);
+      const double baseU = (static_cast<double>(pQuad[0].TextureCoordinate.X) * texWidth) + ((startX + 0.5 - x0) * dU);
+      const double baseV = (static_cast<double>(pQuad[0].TextureCoordinate.Y) * texHeight) + ((startY + 0.5 - y0) * dV);
+      const int64_t startU = ToFixed(baseU);
+      const int64_t stepU = ToFixed(dU);
+
+      const uint32_t color = Pack(pQuad[0].Color);
+      for (int32_t y = startY; y < endY; ++y)
+      {
+        const int64_t v = ToFixed(baseV + (double(y - startY) * dV));
+        uint32_t* pDst = context.pTarget + (static_cast<std::size_t>(y) * context.TargetStride);
+        int64_t u = startU;
+        for (int32_t x = startX; x < endX; ++x)
+        {
+          const uint32_t src = TShader::Shade(TSampler::Sample(context.Texture, u, v), color, context.pSdfTable);
+          pDst[x] = TBlender::Blend(src, pDst[x]);
+          u += stepU;
+        }
+      }
+    }
+
+    struct EdgeFunction
+    {
+      float A{0.0f};
+      float B{0.0f};
+      float C{0.0f};
+      //! Decides which of two quads sharing this edge owns the pixels exactly on it
+      bool IncludeOnEdge{false};
+
+      EdgeFunction() = default;
+      EdgeFunction(const Vector3& from, const Vector3& to, const float orientation)
+        : A(-(to.Y - from.Y) * orientation)
+        , B((to.X - from.X) * orientation)
+        , C(-((A * from.X) + (B * from.Y)))
+        , IncludeOnEdge(A > 0.0f || (A == 0.0f && B > 0.0f))
+      {
+      }
+
+      bool IsInside(const float x, const float y) const noexcept
+      {
+        const float value = (A * x) + (B * y) + C;
+        return value > 0.0f || (value == 0.0f && IncludeOnEdge);
+      }
+    };
+
+    //! Rotated, mirrored or multi colored quads. The quad is treated as the convex polygon 0-1-3-2 and the attributes are
+    //! interpolated with the triangle on the same side of the 1-2 diagonal as the pixel.
+    template <typename TSampler, typename TShader, typename TBlender>
+    void RasterizeConvexQuad(const QuadContext& context, const VertexPositionColorTexture* const pQuad)
+    {
+      const Vector3& p0 = pQuad[0].Position;
+      const Vector3& p1 = pQuad[1].Position;
+      const Vector3& p2 = pQuad[2].Position;
+      const Vector3& p3 = pQuad[3].Position;
+
+      const float area = ((p1.X - p0.X) * (p3.Y - p0.Y)) - ((p3.X - p0.X) * (p1.Y - p0.Y)) + ((p3.X - p0.X) * (p2.Y - p0.Y)) -
+                         ((p2.X - p0.X) * (p3.Y - p0.Y));
+      if (std::abs(area) < LocalConfig::MinQuadArea)
+      {
+        return;
+      }
+      const float orientation = area > 0.0f ? 1.0f : -1.0f;
+      const std::array<EdgeFunction, 4> edges = {EdgeFunction(p0, p1, orientation), EdgeFunction(p1, p3, orientation),
+                                                 EdgeFunction(p3, p2, orientation), EdgeFunction(p2, p0, orientation)};
+
+      const float minX = std::min(std::min(p0.X, p1.X), std::min(p2.X, p3.X));
+      const float maxX = std::max(std::max(p0.X, p1.X), std::max(p2.X, p3.X));
+      const float minY = std::min(std::min(p0.Y, p1.Y), std::min(p2.Y, p3.Y));
+      const float maxY = std::max(std::max(p0.Y, p1.Y), std::max(p2.Y, p3.Y));
+      const int32_t startX = std::max(context.ClipX0, ToPixelStart(minX));
+      const int32_t endX = std::min(context.ClipX1, ToPixelStart(maxX));
+      const int32_t startY = std::max(context.ClipY0, ToPixelStart(minY));
+      const int32_t endY = std::min(context.ClipY1, ToPixelStart(maxY));
+      if (startX >= endX || startY >= endY)
+      {
+        return;
+      }
+
+      // The two triangles (origin, axis1, axis2): 0-1-2 and 3-2-1
+      const std::array<const VertexPositionColorTexture*, 6> triangles = {&pQuad[0], &pQuad[1], &pQuad[2], &pQuad[3], &pQuad[2], &pQuad[1]};
+      const EdgeFunction diagonal(p1, p2, 1.0f);
+      const bool originSide = ((diagonal.A * p0.X) + (diagonal.B * p0.Y) + diagonal.C) >= 0.0f;
+      const bool uniformColor = pQuad[0].Color == pQuad[1].Color && pQuad[0].Color == pQuad[2].Color && pQuad[0].Color == pQuad[3].Color;
+      const uint32_t uniformPackedColor = Pack(pQuad[0].Color);
+      const auto texWidth = static_cast<double>(context.Texture.Width);
+      const auto texHeight = static_cast<double>(context.Texture.Height);
+
+      for (int32_t y = startY; y < endY; ++y)
+      {
+        const float centerY = static_cast<float>(y) + 0.5f;
+        uint32_t* pDst = context.pTarget + (static_cast<std::size_t>(y) * context.TargetStride);
+        for (int32_t x = startX; x < endX; ++x)
+        {
+          const float centerX = static_cast<float>(x) + 0.5f;
+          if (!edges[0].IsInside(centerX, centerY) || !edges[1].IsInside(centerX, centerY) || !edges[2].IsInside(centerX, centerY) ||
+              !edges[3].IsInside(centerX, centerY))
+          {
+            continue;
+          }
+
+          const bool isOriginSide = (((diagonal.A * centerX) + (diagonal.B * centerY) + diagonal.C) >= 0.0f) == originSide;
+          const VertexPositionColorTexture* const* pTriangle = isOriginSide ? &triangles[0] : &triangles[3];
+          const VertexPositionColorTexture& origin = *pTriangle[0];
+          const VertexPositionColorTexture& axis1 = *pTriangle[1];
+          const VertexPositionColorTexture& axis2 = *pTriangle[2];
+
+          // Solve center = origin + s * (axis1 - origin) + t * (axis2 - origin)
+          const double e1x = double(axis1.Position.X) - origin.Position.X;
+          const double e1y = double(axis1.Position.Y) - origin.Position.Y;
+          const double e2x = double(axis2.Position.X) - origin.Position.X;
+          const double e2y = double(axis2.Position.Y) - origin.Position.Y;
+          const double det = (e1x * e2y) - (e2x * e1y);
+          const double px = double(centerX) - origin.Position.X;
+          const double py = double(centerY) - origin.Position.Y;
+          const double s = ((px * e2y) - (e2x * py)) / det;
+          const double t = ((e1x * py) - (px * e1y)) / det;
+
+          const double texU = origin.TextureCoordinate.X + (s * (double(axis1.TextureCoordinate.X) - origin.TextureCoordinate.X)) +
+                              (t * (double(axis2.TextureCoordinate.X) - origin.TextureCoordinate.X));
+          const double texV = origin.TextureCoordinate.Y + (s * (double(axis1.TextureCoordinate.Y) - origin.TextureCoordinate.Y)) +
+                              (t * (double(axis2.TextureCoordinate.Y) - origin.TextureCoordinate.Y));
+
+          uint32_t color = uniformPackedColor;
+          if (!uniformColor)
+          {
+            const Vector4 c0 = origin.Color.ToVector4();
+            const Vector4 c1 = axis1.Color.ToVector4();
+            const Vector4 c2 = axis2.Color.ToVector4();
+            const auto fs = static_cast<float>(s);
+            const auto ft = static_cast<float>(t);
+            color = Pack(Color(c0.X + (fs * (c1.X - c0.X)) + (ft * (c2.X - c0.X)), c0.Y + (fs * (c1.Y - c0.Y)) + (ft * (c2.Y - c0.Y)),
+                               c0.Z + (fs * (c1.Z - c0.Z)) + (ft * (c2.Z - c0.Z)), c0.W + (fs * (c1.W - c0.W)) + (ft * (c2.W - c0.W))));
+          }
+
+          const uint32_t src = TShader::Shade(TSampler::Sample(context.Texture, ToFixed(texU * texWidth), ToFixed(texV * texHeight)), color,
+                                              context.pSdfTable);
+          pDst[x] = TBlender::Blend(src, pDst[x]);
+        }
+      }
+    }
+
+    template <typename TSampler, typename TShader, typename TBlender>
+    void RasterizeQuad(const QuadContext& context, const VertexPositionColorTexture* const pQuad)
+    {
+      if (IsAxisAligned(pQuad))
+      {
+        RasterizeAxisAligned<TSampler, TShader, TBlender>(context, pQuad);
+      }
+      else
+      {
+        RasterizeConvexQuad<TSampler, TShader, TBlender>(context, pQuad);
+      }
+    }
+
+    template <typename TSampler>
+    void RasterizeQuad(const QuadContext& context, const BlendState blendState, const VertexPositionColorTexture* const pQuad)
+    {
+      switch (blendState)
+      {
+      case BlendState::Additive:
+        RasterizeQuad<TSampler, ShadeNormal, BlendAdditive>(context, pQuad);
+        break;
+      case BlendState::AlphaBlend:
+        RasterizeQuad<TSampler, ShadeNormal, BlendPremultiplied>(context, pQuad);
+        break;
+      case BlendState::NonPremultiplied:
+        RasterizeQuad<TSampler, ShadeNormal, BlendNonPremultiplied>(context, pQuad);
+        break;
+      case BlendState::Sdf:
+        RasterizeQuad<TSampler, ShadeSdf, BlendNonPremultiplied>(context, pQuad);
+        break;
+      case BlendState::Opaque:
+      default:
+        RasterizeQuad<TSampler, ShadeNormal, BlendOpaque>(context, pQuad);
+        break;
+      }
+    }
+
+    std::array<uint8_t, 256> CreateSdfAlphaTable(const float smoothing)
+    {
+      const float edge0 = 0.5f - smoothing;
+      const float edge1 = 0.5f + smoothing;
+      std::array<uint8_t, 256> table{};
+      for (std::size_t i = 0; i < table.size(); ++i)
+      {
+        const float distance = static_cast<float>(i) / 255.0f;
+        const float t = MathHelper::Clamp((distance - edge0) / (edge1 - edge0), 0.0f, 1.0f);
+        const float alpha = t * t * (3.0f - (2.0f * t));
+        table[i] = static_cast<uint8_t>((alpha * 255.0f) + 0.5f);
+      }
+      return table;
+    }
+  }
+
+
+  SoftwareBatch2DQuadRenderer::SoftwareBatch2DQuadRenderer(const PxExtent2D extentPx)
+    : SoftwareBatch2DQuadRenderer(extentPx, {})
+  {
+  }
+
+
+  SoftwareBatch2DQuadRenderer::SoftwareBatch2DQuadRenderer(const PxExtent2D extentPx, std::shared_ptr<WorkerThreadPool> workerPool)
+    : m_workerPool(std::move(workerPool))
+  {
+    SetExtent(extentPx);
+  }
+
+
+  SoftwareBatch2DQuadRenderer::~SoftwareBatch2DQuadRenderer() = default;
+
+
+  void SoftwareBatch2DQuadRenderer::Begin(const PxSize2D& sizePx, const BlendState blendState, const BatchSdfRenderConfig& sdfRenderConfig,
+                                          const bool restoreState)
+  {
+    FSL_PARAM_NOT_USED(sizePx);
+    FSL_PARAM_NOT_USED(restoreState);
+    if (m_inBegin)
+    {
+      throw UsageErrorException("Already in a begin block");
+    }
+    m_inBegin = true;
+    m_blendState = blendState;
+    if (blendState == BlendState::Sdf)
+    {
+      const float smoothing = SdfFontUtil::CalcSmooth(sdfRenderConfig.Spread, sdfRenderConfig.Scale);
+      const auto itrFind = std::find(m_sdfTableSmoothing.begin(), m_sdfTableSmoothing.end(), smoothing);
+      if (itrFind != m_sdfTableSmoothing.end())
+      {
+        m_sdfTableIndex = static_cast<uint32_t>(itrFind - m_sdfTableSmoothing.begin());
+      }
+      else
+      {
+        m_sdfTableIndex = static_cast<uint32_t>(m_sdfTables.size());
+        m_sdfTables.push_back(CreateSdfAlphaTable(smoothing));
+        m_sdfTableSmoothing.push_back(smoothing);
+      }
+    }
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::End()
+  {
+    if (!m_inBegin)
+    {
+      throw UsageErrorException("Not in a begin block");
+    }
+    m_inBegin = false;
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::DrawQuads(const VertexPositionColorTexture* const pVertices, const uint32_t length,
+                                              const SoftwareTextureInfo& textureInfo)
+  {
+    assert(pVertices != nullptr);
+    assert(length >= 1);
+    assert(m_inBegin);
+    if (!textureInfo.IsValid())
+    {
+      return;
+    }
+
+    const uint32_t sdfTableIndex = m_blendState == BlendState::Sdf ? m_sdfTableIndex : 0u;
+    if (m_commands.empty() || m_commands.back().TextureInfo != textureInfo || m_commands.back().ActiveBlendState != m_blendState ||
+        m_commands.back().SdfTableIndex != sdfTableIndex)
+    {
+      m_commands.push_back(Command{textureInfo, m_blendState, sdfTableIndex});
+    }
+    const auto commandIndex = static_cast<uint32_t>(m_commands.size() - 1u);
+    m_vertices.insert(m_vertices.end(), pVertices, pVertices + (std::size_t(length) * LocalConfig::VerticesPerQuad));
+    m_quadCommands.insert(m_quadCommands.end(), length, commandIndex);
+
+    ++m_stats.DrawCalls;
+    m_stats.Vertices += length * LocalConfig::VerticesPerQuad;
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::SetExtent(const PxExtent2D extentPx)
+  {
+    if (m_inBegin)
+    {
+      throw UsageErrorException("Can not change the extent inside a begin block");
+    }
+    if (extentPx.Width.Value > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()) ||
+        extentPx.Height.Value > static_cast<uint32_t>(std::numeric_limits<int32_t>::max()))
+    {
+      throw std::invalid_argument("extent is too large");
+    }
+    m_extentPx = extentPx;
+    m_target.assign(std::size_t(extentPx.Width.Value) * extentPx.Height.Value, 0u);
+    m_tilesX = (extentPx.Width.Value + TileSizePx - 1u) / TileSizePx;
+    m_tilesY = (extentPx.Height.Value + TileSizePx - 1u) / TileSizePx;
+    m_tileQuads.resize(std::size_t(m_tilesX) * m_tilesY);
+
+    m_commands.clear();
+    m_vertices.clear();
+    m_quadCommands.clear();
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::Clear(const Color color)
+  {
+    Flush();
+    std::fill(m_target.begin(), m_target.end(), Pack(color));
+    m_stats = {};
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::Flush()
+  {
+    if (!m_quadCommands.empty())
+    {
+      BinQuads();
+      const std::size_t tileCount = m_tileQuads.size();
+      if (m_workerPool)
+      {
+        m_workerPool->ParallelFor(tileCount, LocalConfig::MinTilesPerChunk,
+                                  [this](const std::size_t begin, const std::size_t end) { RasterizeTiles(begin, end); });
+      }
+      else
+      {
+        RasterizeTiles(0, tileCount);
+      }
+
+      m_commands.clear();
+      m_vertices.clear();
+      m_quadCommands.clear();
+    }
+    if (!m_inBegin)
+    {
+      m_sdfTables.clear();
+      m_sdfTableSmoothing.clear();
+    }
+  }
+
+
+  ReadOnlyRawBitmap SoftwareBatch2DQuadRenderer::GetTarget()
+  {
+    Flush();
+    return ReadOnlyRawBitmap::Create(ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(m_target.data()), m_target.size() * sizeof(uint32_t)),
+                                     m_extentPx, PixelFormat::R8G8B8A8_UNORM, BitmapOrigin::UpperLeft);
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::BinQuads()
+  {
+    for (auto& rEntry : m_tileQuads)
+    {
+      rEntry.clear();
+    }
+
+    const auto targetWidth = static_cast<int32_t>(m_extentPx.Width.Value);
+    const auto targetHeight = static_cast<int32_t>(m_extentPx.Height.Value);
+    const std::size_t quadCount = m_quadCommands.size();
+    for (std::size_t quadIndex = 0; quadIndex < quadCount; ++quadIndex)
+    {
+      const VertexPositionColorTexture* const pQuad = m_vertices.data() + (quadIndex * LocalConfig::VerticesPerQuad);
+      const float minX = std::min(std::min(pQuad[0].Position.X, pQuad[1].Position.X), std::min(pQuad[2].Position.X, pQuad[3].Position.X));
+      const float maxX = std::max(std::max(pQuad[0].Position.X, pQuad[1].Position.X), std::max(pQuad[2].Position.X, pQuad[3].Position.X));
+      const float minY = std::min(std::min(pQuad[0].Position.Y, pQuad[1].Position.Y), std::min(pQuad[2].Position.Y, pQuad[3].Position.Y));
+      const float maxY = std::max(std::max(pQuad[0].Position.Y, pQuad[1].Position.Y), std::max(pQuad[2].Position.Y, pQuad[3].Position.Y));
+      // Reject quads outside the target before converting to integers so huge coordinates can not overflow
+      if (!(maxX > 0.0f && maxY > 0.0f && minX < static_cast<float>(targetWidth) && minY < static_cast<float>(targetHeight)))
+      {
+        continue;
+      }
+      const int32_t startX = std::max(0, ToPixelStart(minX));
+      const int32_t endX = std::min(targetWidth, ToPixelStart(maxX));
+      const int32_t startY = std::max(0, ToPixelStart(minY));
+      const int32_t endY = std::min(targetHeight, ToPixelStart(maxY));
+      if (startX >= endX || startY >= endY)
+      {
+        continue;
+      }
+      const auto tileX0 = static_cast<uint32_t>(startX) / TileSizePx;
+      const auto tileX1 = static_cast<uint32_t>(endX - 1) / TileSizePx;
+      const auto tileY0 = static_cast<uint32_t>(startY) / TileSizePx;
+      const auto tileY1 = static_cast<uint32_t>(endY - 1) / TileSizePx;
+      for (uint32_t tileY = tileY0; tileY <= tileY1; ++tileY)
+      {
+        for (uint32_t tileX = tileX0; tileX <= tileX1; ++tileX)
+        {
+          m_tileQuads[(std::size_t(tileY) * m_tilesX) + tileX].push_back(static_cast<uint32_t>(quadIndex));
+        }
+      }
+    }
+  }
+
+
+  void SoftwareBatch2DQuadRenderer::RasterizeTiles(const std::size_t beginTile, const std::size_t endTile)
+  {
+    QuadContext context;
+    context.pTarget = m_target.data();
+    context.TargetStride = m_extentPx.Width.Value;
+
+    for (std::size_t tileIndex = beginTile; tileIndex < endTile; ++tileIndex)
+    {
+      const std::vector<uint32_t>& quads = m_tileQuads[tileIndex];
+      if (quads.empty())
+      {
+        continue;
+      }
+      const auto tileX = static_cast<uint32_t>(tileIndex % m_tilesX);
+      const auto tileY = static_cast<uint32_t>(tileIndex / m_tilesX);
+      context.ClipX0 = static_cast<int32_t>(tileX * TileSizePx);
+      context.ClipY0 = static_cast<int32_t>(tileY * TileSizePx);
+      context.ClipX1 = static_cast<int32_t>(std::min((tileX + 1u) * TileSizePx, m_extentPx.Width.Value));
+      context.ClipY1 = static_cast<int32_t>(std::min((tileY + 1u) * TileSizePx, m_extentPx.Height.Value));
+
+      for (const uint32_t quadIndex : quads)
+      {
+        const Command& command = m_commands[m_quadCommands[quadIndex]];
+        context.Texture = TextureState{command.TextureInfo.pTexels, command.TextureInfo.Extent.Width.Value, command.TextureInfo.Extent.Height.Value};
+        context.pSdfTable = command.ActiveBlendState == BlendState::Sdf ? &m_sdfTables[command.SdfTableIndex] : nullptr;
+
+        const VertexPositionColorTexture* const pQuad = m_vertices.data() + (std::size_t(quadIndex) * LocalConfig::VerticesPerQuad);
+        if (command.TextureInfo.FilterHint == Texture2DFilterHint::Nearest)
+        {
+          RasterizeQuad<NearestSampler>(context, command.ActiveBlendState, pQuad);
+        }
+        else
+        {
+          RasterizeQuad<BilinearSampler>(context, command.ActiveBlendState, pQuad);
+        }
+      }
+    }
+  }
+}
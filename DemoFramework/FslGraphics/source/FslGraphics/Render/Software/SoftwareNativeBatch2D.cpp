@@ -0,0 +1,651 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Log3Core.hpp>
+#include <FslGraphics/Render/Adapter/INativeTexture2D.hpp>
+#include <FslGraphics/Render/AtlasTexture2D.hpp>
+#include <FslGraphics/Render/Basic/IBasicRenderSystem.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeBatch2D.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeTexture2D.hpp>
+#include <FslGraphics/Render/Texture2D.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFont.hpp>
+#include <FslGraphics/Sprite/Material/Basic/BasicSpriteMaterial.hpp>
+#include <FslGraphics/Sprite/Material/ISpriteMaterial.hpp>
+#include <cassert>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    inline SoftwareTextureInfo TryExtract(const INativeTexture2D& srcTexture)
+    {
+      const auto* const pSoftwareTexture = dynamic_cast<const SoftwareNativeTexture2D*>(&srcTexture);
+      if (pSoftwareTexture == nullptr)
+      {
+        FSLLOG3_DEBUG_WARNING("The texture is not a SoftwareNativeTexture2D, call ignored");
+        return {};
+      }
+      return pSoftwareTexture->GetTextureInfo();
+    }
+
+    inline SoftwareTextureInfo TryExtract(const IBasicRenderSystem* const pBasicRenderSystem, const BasicSpriteMaterial& material)
+    {
+      if (pBasicRenderSystem == nullptr)
+      {
+        FSLLOG3_DEBUG_WARNING("pBasicRenderSystem is invalid, call ignored");
+        return {};
+      }
+      std::shared_ptr<INativeTexture2D> nativeTexture = pBasicRenderSystem->TryGetMaterialTexture(material.Material);
+      if (!nativeTexture)
+      {
+        FSLLOG3_DEBUG_WARNING("material texture not of the expected type, call ignored");
+        return {};
+      }
+      return TryExtract(*nativeTexture);
+    }
+
+    inline SoftwareTextureInfo TryExtract(const IBasicRenderSystem* const pBasicRenderSystem, const SpriteFont& font)
+    {
+      assert(font.GetMaterialCount() == 1u);
+      const auto* pBasicSpriteMaterial = dynamic_cast<const BasicSpriteMaterial*>(font.GetMaterialInfo(0u).Material.get());
+      if (pBasicSpriteMaterial == nullptr)
+      {
+        FSLLOG3_DEBUG_WARNING("material texture not of the expected type, call ignored");
+        return {};
+      }
+      return TryExtract(pBasicRenderSystem, *pBasicSpriteMaterial);
+    }
+
+
+    inline SoftwareTextureInfo TryExtract(const BaseTexture2D& srcTexture)
+    {
+      const INativeTexture2D* const pNativeTexture2D = srcTexture.TryGetNativePointer();
+      if (pNativeTexture2D == nullptr)
+      {
+        FSLLOG3_DEBUG_WARNING("Trying to render a invalid texture, call ignored");
+        return {};
+      }
+      return TryExtract(*pNativeTexture2D);
+    }
+
+
+    inline SoftwareTextureInfo TryExtract(const AtlasTexture2D& srcTexture)
+    {
+      const INativeTexture2D* const pNativeTexture2D = srcTexture.TryGetNativePointer();
+      if (pNativeTexture2D == nullptr)
+      {
+        FSLLOG3_DEBUG_WARNING("Trying to render a invalid texture, call ignored");
+        return {};
+      }
+      return TryExtract(*pNativeTexture2D);
+    }
+  }
+
+
+  SoftwareNativeBatch2D::SoftwareNativeBatch2D(const std::shared_ptr<SoftwareBatch2DQuadRenderer>& quadRenderer, const PxExtent2D& extentPx)
+    : SoftwareNativeBatch2D(quadRenderer, extentPx, {})
+  {
+  }
+
+
+  SoftwareNativeBatch2D::SoftwareNativeBatch2D(const std::shared_ptr<SoftwareBatch2DQuadRenderer>& quadRenderer, const PxExtent2D& extentPx,
+                                               std::weak_ptr<IBasicRenderSystem> basicRenderSystem)
+    : SoftwareBatch2D(quadRenderer, extentPx)
+    , m_quadRenderer(quadRenderer)
+    , m_renderSystem(std::move(basicRenderSystem))
+  {
+  }
+
+
+  SoftwareNativeBatch2D::~SoftwareNativeBatch2D() = default;
+
+
+  void SoftwareNativeBatch2D::End()
+  {
+    SoftwareBatch2D::End();
+    m_currentRenderSystem.reset();
+    m_quadRenderer->Flush();
+  }
+
+  // ---------- 0
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeTextureArea& srcArea, const PxAreaRectangleF& dstRectanglePxf,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeTextureArea& srcArea, const PxAreaRectangleF& dstRectanglePxf,
+                                   const Vector4& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeQuadTextureCoords& srcArea,
+                                   const PxAreaRectangleF& dstRectanglePxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeQuadTextureCoords& srcArea,
+                                   const PxAreaRectangleF& dstRectanglePxf, const Vector4& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color);
+  }
+
+
+  // ---------- 0 with clip
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeTextureArea& srcArea, const PxAreaRectangleF& dstRectanglePxf,
+                                   const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color, clipRectPx);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeTextureArea& srcArea, const PxAreaRectangleF& dstRectanglePxf,
+                                   const Vector4& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color, clipRectPx);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeQuadTextureCoords& srcArea,
+                                   const PxAreaRectangleF& dstRectanglePxf, const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color, clipRectPx);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const INativeTexture2D& srcTexture, const NativeQuadTextureCoords& srcArea,
+                                   const PxAreaRectangleF& dstRectanglePxf, const Vector4& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, srcArea, dstRectanglePxf, color, clipRectPx);
+  }
+
+  // ---------- 1
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxRectangle& dstRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxRectangle& dstRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePxf, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePxf, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color,
+                                   const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePxf, color, effect);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color,
+                                   const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePxf, color, effect);
+  }
+
+  // ---------- 2
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color);
+  }
+
+  // ---------- 2 with clip
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color, clipRectPx);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color, clipRectPx);
+  }
+
+  // ---------- 2A
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color, effect);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color, effect);
+  }
+
+  // ---------- 3
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxRectangle& dstRectanglePx, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePx, srcRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxRectangle& dstRectanglePx, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePx, srcRectanglePx, color);
+  }
+
+  // ---------- 4
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePxf, srcRectanglePx, color);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePxf, srcRectanglePx, color);
+  }
+
+  // ---------- 4 with clip
+
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePxf, srcRectanglePx, color, clipRectPx);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePxf, srcRectanglePx, color, clipRectPx);
+  }
+
+
+  // ---------- 4A
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstRectanglePxf, srcRectanglePx, color, effect);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const PxAreaRectangleF& dstRectanglePxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const BatchEffect effect)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstRectanglePxf, srcRectanglePx, color, effect);
+  }
+
+
+  // ---------- 5
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color, const Vector2& origin,
+                                   const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, color, origin, scale);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color, const Vector2& origin,
+                                   const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, color, origin, scale);
+  }
+
+  // ---------- 6
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color, const float rotation,
+                                   const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, color, rotation, origin, scale);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const Color& color, const float rotation,
+                                   const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, color, rotation, origin, scale);
+  }
+
+  // ---------- 7
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color, origin,
+                          scale);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color, origin, scale);
+  }
+
+  // ---------- 7 with clip
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const Vector2& origin, const Vector2& scale, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color, origin,
+                          scale, clipRectPx);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const Vector2& origin, const Vector2& scale, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color, origin, scale, clipRectPx);
+  }
+
+  // ---------- 8
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const float rotation, const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), dstPositionPxf, srcRectanglePx, color, rotation,
+                          origin, scale);
+  }
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2& dstPositionPxf, const PxRectangleU32& srcRectanglePx,
+                                   const Color& color, const float rotation, const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, dstPositionPxf, srcRectanglePx, color, rotation, origin, scale);
+  }
+
+  // ---------- 9
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2* const pDstPositions, const int32_t dstPositionsLength,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), pDstPositions, dstPositionsLength, color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2* const pDstPositions, const int32_t dstPositionsLength,
+                                   const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, pDstPositions, dstPositionsLength, color);
+  }
+
+  // ---------- 10
+
+  void SoftwareNativeBatch2D::Draw(const AtlasTexture2D& srcTexture, const Vector2* const pDstPositions, const int32_t dstPositionsLength,
+                                   const PxRectangleU32& srcRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(SoftwareBatch2D::atlas_texture_type(textureInfo, srcTexture.GetInfo()), pDstPositions, dstPositionsLength, srcRectanglePx,
+                          color);
+  }
+
+
+  void SoftwareNativeBatch2D::Draw(const BaseTexture2D& srcTexture, const Vector2* const pDstPositions, const int32_t dstPositionsLength,
+                                   const PxRectangleU32& srcRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::Draw(textureInfo, pDstPositions, dstPositionsLength, srcRectanglePx, color);
+  }
+
+  // ---------- 11
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const StringViewLite& strView,
+                                         const Vector2& dstPositionPxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, strView, dstPositionPxf, color);
+  }
+
+  // ---------- 12
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const StringViewLite& strView,
+                                         const Vector2& dstPositionPxf, const Color& color, const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, strView, dstPositionPxf, color, origin, scale);
+  }
+
+  // ---------- 13
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const BitmapFontConfig& fontConfig,
+                                         const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, fontConfig, strView, dstPositionPxf, color);
+  }
+
+  // ---------- 13 with clip
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const BitmapFontConfig& fontConfig,
+                                         const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color,
+                                         const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, fontConfig, strView, dstPositionPxf, color, clipRectPx);
+  }
+
+  // ---------- 14
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const BitmapFontConfig& fontConfig,
+                                         const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color, const Vector2& origin,
+                                         const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, fontConfig, strView, dstPositionPxf, color, origin, scale);
+  }
+
+  // ---------- 14 with clip
+
+  void SoftwareNativeBatch2D::DrawString(const BaseTexture2D& srcTexture, const TextureAtlasSpriteFont& font, const BitmapFontConfig& fontConfig,
+                                         const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color, const Vector2& origin,
+                                         const Vector2& scale, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcTexture);
+    SoftwareBatch2D::DrawString(textureInfo, font, fontConfig, strView, dstPositionPxf, color, origin, scale, clipRectPx);
+  }
+
+  // ---------- 15
+
+  void SoftwareNativeBatch2D::DrawString(const SpriteFont& font, const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(m_currentRenderSystem.get(), font);
+    const auto& fontInfo = font.GetInfo();
+    SoftwareBatch2D::DrawString(textureInfo, font.GetTextureAtlasSpriteFont(), fontInfo.FontConfig, strView, dstPositionPxf, color);
+  }
+
+  // ---------- 15 with clip
+
+  void SoftwareNativeBatch2D::DrawString(const SpriteFont& font, const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color,
+                                         const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(m_currentRenderSystem.get(), font);
+    const auto& fontInfo = font.GetInfo();
+    SoftwareBatch2D::DrawString(textureInfo, font.GetTextureAtlasSpriteFont(), fontInfo.FontConfig, strView, dstPositionPxf, color, clipRectPx);
+  }
+
+  // ---------- 16
+
+  void SoftwareNativeBatch2D::DrawString(const SpriteFont& font, const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color,
+                                         const Vector2& origin, const Vector2& scale)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(m_currentRenderSystem.get(), font);
+    const auto& fontInfo = font.GetInfo();
+    SoftwareBatch2D::DrawString(textureInfo, font.GetTextureAtlasSpriteFont(), fontInfo.FontConfig, strView, dstPositionPxf, color, origin, scale);
+  }
+
+  // ---------- 16 with clip
+
+  void SoftwareNativeBatch2D::DrawString(const SpriteFont& font, const StringViewLite& strView, const Vector2& dstPositionPxf, const Color& color,
+                                         const Vector2& origin, const Vector2& scale, const PxClipRectangle& clipRectPx)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(m_currentRenderSystem.get(), font);
+    const auto& fontInfo = font.GetInfo();
+    SoftwareBatch2D::DrawString(textureInfo, font.GetTextureAtlasSpriteFont(), fontInfo.FontConfig, strView, dstPositionPxf, color, origin, scale,
+                                clipRectPx);
+  }
+  // ----------
+
+  void SoftwareNativeBatch2D::DebugDrawRectangle(const AtlasTexture2D& srcFillTexture, const PxRectangle& dstRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawRectangle(SoftwareBatch2D::atlas_texture_type(textureInfo, srcFillTexture.GetInfo()), dstRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::DebugDrawRectangle(const BaseTexture2D& srcFillTexture, const PxRectangle& dstRectanglePx, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawRectangle(textureInfo, dstRectanglePx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::DebugDrawRectangle(const AtlasTexture2D& srcFillTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawRectangle(SoftwareBatch2D::atlas_texture_type(textureInfo, srcFillTexture.GetInfo()), dstRectanglePxf, color);
+  }
+
+
+  void SoftwareNativeBatch2D::DebugDrawRectangle(const BaseTexture2D& srcFillTexture, const PxAreaRectangleF& dstRectanglePxf, const Color& color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawRectangle(textureInfo, dstRectanglePxf, color);
+  }
+
+  // ----------
+
+  void SoftwareNativeBatch2D::DebugDrawLine(const AtlasTexture2D& srcFillTexture, const PxPoint2 dstFromPx, const PxPoint2 dstToPx, const Color color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawLine(SoftwareBatch2D::atlas_texture_type(textureInfo, srcFillTexture.GetInfo()), dstFromPx, dstToPx, color);
+  }
+
+
+  void SoftwareNativeBatch2D::DebugDrawLine(const AtlasTexture2D& srcFillTexture, const PxVector2 dstFromPxf, const PxVector2 dstToPxf,
+                                            const Color color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawLine(SoftwareBatch2D::atlas_texture_type(textureInfo, srcFillTexture.GetInfo()), dstFromPxf, dstToPxf, color);
+  }
+
+  void SoftwareNativeBatch2D::DebugDrawLine(const BaseTexture2D& srcFillTexture, const PxPoint2 dstFromPx, const PxPoint2 dstToPx, const Color color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawLine(textureInfo, dstFromPx, dstToPx, color);
+  }
+
+  void SoftwareNativeBatch2D::DebugDrawLine(const BaseTexture2D& srcFillTexture, const PxVector2 dstFromPxf, const PxVector2 dstToPxf,
+                                            const Color color)
+  {
+    const SoftwareTextureInfo textureInfo = TryExtract(srcFillTexture);
+    SoftwareBatch2D::DebugDrawLine(textureInfo, dstFromPxf, dstToPxf, color);
+  }
+}
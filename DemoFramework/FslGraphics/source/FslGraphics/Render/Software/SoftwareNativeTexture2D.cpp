@@ -0,0 +1,139 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Pixel/PxRectangleU32.hpp>
+#include <FslGraphics/NativeTextureAreaUtil.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeTexture2D.hpp>
+#include <FslGraphics/Texture/ReadOnlyRawTexture.hpp>
+#include <fmt/format.h>
+#include <stdexcept>
+
+namespace Fsl
+{
+  namespace
+  {
+    constexpr uint32_t Pack(const uint32_t r, const uint32_t g, const uint32_t b, const uint32_t a) noexcept
+    {
+      return r | (g << 8) | (b << 16) | (a << 24);
+    }
+
+    template <typename TFunc>
+    void ConvertRows(std::vector<uint32_t>& rDst, const uint8_t* const pSrc, const uint32_t width, const uint32_t height, const std::size_t srcStride,
+                     const bool flipY, const uint32_t srcBytesPerPixel, TFunc func)
+    {
+      for (uint32_t y = 0; y < height; ++y)
+      {
+        const uint8_t* pSrcRow = pSrc + (srcStride * (flipY ? (height - 1u - y) : y));
+        uint32_t* pDstRow = rDst.data() + (std::size_t(width) * y);
+        for (uint32_t x = 0; x < width; ++x)
+        {
+          pDstRow[x] = func(pSrcRow);
+          pSrcRow += srcBytesPerPixel;
+        }
+      }
+    }
+
+    void Convert(std::vector<uint32_t>& rDst, const ReadOnlyRawTexture& texture)
+    {
+      const PxExtent2D extentPx = texture.GetExtent2D();
+      const uint32_t width = extentPx.Width.Value;
+      const uint32_t height = extentPx.Height.Value;
+      const std::size_t srcStride = texture.GetStride();
+      const BlobRecord blob = texture.GetTextureBlob();
+      if (srcStride * height > blob.Size)
+      {
+        throw std::invalid_argument("texture content is too small");
+      }
+
+      const auto* const pSrc = static_cast<const uint8_t*>(texture.GetContent()) + blob.Offset;
+      const bool flipY = texture.GetBitmapOrigin() == BitmapOrigin::LowerLeft;
+      rDst.resize(std::size_t(width) * height);
+
+      switch (texture.GetPixelFormat())
+      {
+      case PixelFormat::R8G8B8A8_UNORM:
+      case PixelFormat::R8G8B8A8_SRGB:
+        ConvertRows(rDst, pSrc, width, height, srcStride, flipY, 4u, [](const uint8_t* p) { return Pack(p[0], p[1], p[2], p[3]); });
+        break;
+      case PixelFormat::B8G8R8A8_UNORM:
+      case PixelFormat::B8G8R8A8_SRGB:
+        ConvertRows(rDst, pSrc, width, height, srcStride, flipY, 4u, [](const uint8_t* p) { return Pack(p[2], p[1], p[0], p[3]); });
+        break;
+      case PixelFormat::R8G8B8_UNORM:
+      case PixelFormat::R8G8B8_SRGB:
+        ConvertRows(rDst, pSrc, width, height, srcStride, flipY, 3u, [](const uint8_t* p) { return Pack(p[0], p[1], p[2], 0xFF); });
+        break;
+      case PixelFormat::B8G8R8_UNORM:
+      case PixelFormat::B8G8R8_SRGB:
+        ConvertRows(rDst, pSrc, width, height, srcStride, flipY, 3u, [](const uint8_t* p) { return Pack(p[2], p[1], p[0], 0xFF); });
+        break;
+      case PixelFormat::R8_UNORM:
+        ConvertRows(rDst, pSrc, width, height, srcStride, flipY, 1u, [](const uint8_t* p) { return Pack(p[0], 0, 0, 0xFF); });
+        break;
+      default:
+        throw NotSupportedException(fmt::format("SoftwareNativeTexture2D does not support the pixel format: {}",
+                                                static_cast<uint32_t>(texture.GetPixelFormat())));
+      }
+    }
+  }
+
+
+  SoftwareNativeTexture2D::SoftwareNativeTexture2D(const ReadOnlyRawTexture& texture, const Texture2DFilterHint filterHint,
+                                                   const TextureFlags textureFlags)
+  {
+    SetData(texture, filterHint, textureFlags);
+  }
+
+
+  NativeTextureArea SoftwareNativeTexture2D::CalcNativeTextureArea(const PxRectangleU32& imageRectanglePx) const
+  {
+    return NativeTextureAreaUtil::CalcNativeTextureArea(imageRectanglePx, m_extentPx);
+  }
+
+
+  void SoftwareNativeTexture2D::SetData(const ReadOnlyRawTexture& texture, const Texture2DFilterHint filterHint, const TextureFlags textureFlags)
+  {
+    FSL_PARAM_NOT_USED(textureFlags);
+    if (!texture.IsValid())
+    {
+      throw std::invalid_argument("texture must be valid");
+    }
+    if (texture.GetTextureType() != TextureType::Tex2D)
+    {
+      throw NotSupportedException("SoftwareNativeTexture2D only supports Tex2D textures");
+    }
+
+    Convert(m_texels, texture);
+    m_extentPx = texture.GetExtent2D();
+    m_filterHint = filterHint;
+  }
+}
@@ -0,0 +1,494 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/Sdf/SdfGenerator.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/SkylineBinPacker.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! A finite 'infinity' so the parabola intersections never calculate inf - inf
+      constexpr float Infinity = 1e20f;
+      //! The smallest number of rows or columns worth handing to another thread
+      constexpr std::size_t MinLinesPerChunk = 32;
+      //! The empty space between two glyphs in the generated font atlas
+      constexpr uint32_t GlyphSpacingPx = 1;
+    }
+
+    //! Provides access to the alpha channel of the supported source formats
+    struct AlphaSource
+    {
+      const uint8_t* pContent{nullptr};
+      uint32_t Stride{0};
+      uint32_t BytesPerPixel{0};
+      uint32_t AlphaOffset{0};
+      uint32_t Height{0};
+      bool FlipY{false};
+
+      const uint8_t* GetRow(const uint32_t y) const noexcept
+      {
+        return pContent + (static_cast<std::size_t>(FlipY ? (Height - 1u - y) : y) * Stride);
+      }
+    };
+
+    AlphaSource CreateAlphaSource(const ReadOnlyRawBitmap& bitmap)
+    {
+      AlphaSource source;
+      switch (PixelFormatUtil::GetPixelFormatLayout(bitmap.GetPixelFormat()))
+      {
+      case PixelFormatLayout::R8:
+        source.BytesPerPixel = 1;
+        source.AlphaOffset = 0;
+        break;
+      case PixelFormatLayout::R8G8B8A8:
+      case PixelFormatLayout::B8G8R8A8:
+        source.BytesPerPixel = 4;
+        source.AlphaOffset = 3;
+        break;
+      default:
+        throw NotSupportedException("The source bitmap must be a R8, R8G8B8A8 or B8G8R8A8 bitmap");
+      }
+      source.pContent = static_cast<const uint8_t*>(bitmap.Content());
+      source.Stride = bitmap.Stride();
+      source.Height = bitmap.RawUnsignedHeight();
+      source.FlipY = bitmap.GetOrigin() == BitmapOrigin::LowerLeft;
+      return source;
+    }
+
+    void ValidateConfig(const SdfGeneratorConfig& config)
+    {
+      if (config.DownscaleFactor == 0u)
+      {
+        throw std::invalid_argument("DownscaleFactor can not be zero");
+      }
+      if (!(config.DistanceRangePx > 0.0f))
+      {
+        throw std::invalid_argument("DistanceRangePx must be larger than zero");
+      }
+    }
+
+    template <typename TFunc>
+    void ForEachChunk(WorkerThreadPool* const pWorkerPool, const std::size_t count, const std::size_t minChunkSize, TFunc&& func)
+    {
+      if (pWorkerPool != nullptr)
+      {
+        pWorkerPool->ParallelFor(count, minChunkSize, std::forward<TFunc>(func));
+      }
+      else
+      {
+        func(std::size_t(0), count);
+      }
+    }
+
+    //! Scratch memory for the one dimensional transform of a line
+    struct LineScratch
+    {
+      std::vector<float> Src;
+      std::vector<float> Dst;
+      std::vector<int32_t> Vertices;
+      std::vector<float> Boundaries;
+
+      explicit LineScratch(const std::size_t length)
+        : Src(length)
+        , Dst(length)
+        , Vertices(length)
+        , Boundaries(length + 1u)
+      {
+      }
+    };
+
+    //! @brief One dimensional squared euclidean distance transform (Felzenszwalb & Huttenlocher).
+    //!        Builds the lower envelope of the parabolas rooted at each sample and then samples it, both steps are linear.
+    void TransformLine(LineScratch& rScratch, const int32_t length)
+    {
+      const float* const pSrc = rScratch.Src.data();
+      float* const pDst = rScratch.Dst.data();
+      int32_t* const pV = rScratch.Vertices.data();
+      float* const pZ = rScratch.Boundaries.data();
+
+      int32_t k = 0;
+      pV[0] = 0;
+      pZ[0] = -LocalConfig::Infinity;
+      pZ[1] = LocalConfig::Infinity;
+      for (int32_t q = 1; q < length; ++q)
+      {
+        const auto fq = pSrc[q] + static_cast<float>(q * q);
+        float s = 0.0f;
+        while (true)
+        {
+          const int32_t v = pV[k];
+          s = (fq - (pSrc[v] + static_cast<float>(v * v))) / static_cast<float>(2 * (q - v));
+          // pZ[0] is -infinity so this always terminates at k == 0
+          if (s > pZ[k])
+          {
+            break;
+          }
+          --k;
+        }
+        ++k;
+        pV[k] = q;
+        pZ[k] = s;
+        pZ[k + 1] = LocalConfig::Infinity;
+      }
+
+      k = 0;
+      for (int32_t q = 0; q < length; ++q)
+      {
+        while (pZ[k + 1] < static_cast<float>(q))
+        {
+          ++k;
+        }
+        const int32_t v = pV[k];
+        pDst[q] = static_cast<float>((q - v) * (q - v)) + pSrc[v];
+      }
+    }
+
+    //! @brief Two dimensional squared euclidean distance transform, a column pass followed by a row pass.
+    //! @param rField contains 0 for the feature pixels and LocalConfig::Infinity for the rest, it is replaced by the squared distances.
+    void TransformField(WorkerThreadPool* const pWorkerPool, std::vector<float>& rField, const uint32_t width, const uint32_t height)
+    {
+      float* const pField = rField.data();
+      ForEachChunk(pWorkerPool, width, LocalConfig::MinLinesPerChunk,
+                   [pField, width, height](const std::size_t begin, const std::size_t end)
+                   {
+                     LineScratch scratch(height);
+                     for (std::size_t x = begin; x < end; ++x)
+                     {
+                       for (uint32_t y = 0; y < height; ++y)
+                       {
+                         scratch.Src[y] = pField[(static_cast<std::size_t>(y) * width) + x];
+                       }
+                       TransformLine(scratch, static_cast<int32_t>(height));
+                       for (uint32_t y = 0; y < height; ++y)
+                       {
+                         pField[(static_cast<std::size_t>(y) * width) + x] = scratch.Dst[y];
+                       }
+                     }
+                   });
+
+      ForEachChunk(pWorkerPool, height, LocalConfig::MinLinesPerChunk,
+                   [pField, width](const std::size_t begin, const std::size_t end)
+                   {
+                     LineScratch scratch(width);
+                     for (std::size_t y = begin; y < end; ++y)
+                     {
+                       float* const pRow = pField + (y * width);
+                       std::copy(pRow, pRow + width, scratch.Src.begin());
+                       TransformLine(scratch, static_cast<int32_t>(width));
+                       std::copy(scratch.Dst.begin(), scratch.Dst.end(), pRow);
+                     }
+                   });
+    }
+
+    uint32_t DivideRoundUp(const uint32_t value, const uint32_t divisor) noexcept
+    {
+      return (value / divisor) + ((value % divisor) != 0u ? 1u : 0u);
+    }
+
+    PxExtent2D CalcOutputExtent(const PxRectangleU32& srcRectPx, const uint32_t downscaleFactor, const uint32_t paddingPx)
+    {
+      return PxExtent2D::Create(DivideRoundUp(srcRectPx.Width.Value, downscaleFactor) + (2u * paddingPx),
+                                DivideRoundUp(srcRectPx.Height.Value, downscaleFactor) + (2u * paddingPx));
+    }
+
+    //! @brief Generate the distance field for the srcRectPx area of the source, pixels outside the area are considered to be outside the shape.
+    //! @param pDst receives CalcOutputExtent pixels using dstStride
+    void GenerateRegion(WorkerThreadPool* const pWorkerPool, const AlphaSource& source, const PxRectangleU32& srcRectPx,
+                        const SdfGeneratorConfig& config, const uint32_t paddingPx, uint8_t* const pDst, const uint32_t dstStride)
+    {
+      const uint32_t scale = config.DownscaleFactor;
+      const PxExtent2D dstExtentPx = CalcOutputExtent(srcRectPx, scale, paddingPx);
+      const uint32_t dstWidth = dstExtentPx.Width.Value;
+      const uint32_t dstHeight = dstExtentPx.Height.Value;
+      // The working area is the output area at the source resolution
+      const uint32_t width = dstWidth * scale;
+      const uint32_t height = dstHeight * scale;
+      const int64_t originX = static_cast<int64_t>(srcRectPx.X.Value) - (static_cast<int64_t>(paddingPx) * scale);
+      const int64_t originY = static_cast<int64_t>(srcRectPx.Y.Value) - (static_cast<int64_t>(paddingPx) * scale);
+      const auto srcLeft = static_cast<int64_t>(srcRectPx.Left().Value);
+      const auto srcTop = static_cast<int64_t>(srcRectPx.Top().Value);
+      const auto srcRight = static_cast<int64_t>(srcRectPx.Right().Value);
+      const auto srcBottom = static_cast<int64_t>(srcRectPx.Bottom().Value);
+
+      // toInside is the distance to the closest inside pixel and toOutside the distance to the closest outside pixel
+      const std::size_t pixelCount = static_cast<std::size_t>(width) * height;
+      std::vector<float> toInside(pixelCount);
+      std::vector<float> toOutside(pixelCount);
+      ForEachChunk(pWorkerPool, height, LocalConfig::MinLinesPerChunk,
+                   [&](const std::size_t begin, const std::size_t end)
+                   {
+                     for (std::size_t y = begin; y < end; ++y)
+                     {
+                       float* const pToInside = toInside.data() + (y * width);
+                       float* const pToOutside = toOutside.data() + (y * width);
+                       const int64_t srcY = originY + static_cast<int64_t>(y);
+                       const bool rowInside = srcY >= srcTop && srcY < srcBottom;
+                       const uint8_t* const pSrcRow = rowInside ? source.GetRow(static_cast<uint32_t>(srcY)) : nullptr;
+                       for (uint32_t x = 0; x < width; ++x)
+                       {
+                         const int64_t srcX = originX + x;
+                         const bool inside = rowInside && srcX >= srcLeft && srcX < srcRight &&
+                                             pSrcRow[(static_cast<std::size_t>(srcX) * source.BytesPerPixel) + source.AlphaOffset] >=
+                                               config.AlphaThreshold;
+                         pToInside[x] = inside ? 0.0f : LocalConfig::Infinity;
+                         pToOutside[x] = inside ? LocalConfig::Infinity : 0.0f;
+                       }
+                     }
+                   });
+
+      TransformField(pWorkerPool, toInside, width, height);
+      TransformField(pWorkerPool, toOutside, width, height);
+
+      // The edge lies halfway between a inside and a outside pixel, each output pixel is the average signed distance of the source pixels it covers
+      const float toOutputScale = 1.0f / (static_cast<float>(scale) * static_cast<float>(scale) * static_cast<float>(scale));
+      const float rangeScale = 1.0f / config.DistanceRangePx;
+      ForEachChunk(pWorkerPool, dstHeight, LocalConfig::MinLinesPerChunk / scale + 1u,
+                   [&](const std::size_t begin, const std::size_t end)
+                   {
+                     for (std::size_t dstY = begin; dstY < end; ++dstY)
+                     {
+                       uint8_t* const pDstRow = pDst + (dstY * dstStride);
+                       for (uint32_t dstX = 0; dstX < dstWidth; ++dstX)
+                       {
+                         float sum = 0.0f;
+                         for (uint32_t sy = 0; sy < scale; ++sy)
+                         {
+                           const std::size_t rowOffset = (((dstY * scale) + sy) * width) + (static_cast<std::size_t>(dstX) * scale);
+                           for (uint32_t sx = 0; sx < scale; ++sx)
+                           {
+                             const std::size_t index = rowOffset + sx;
+                             sum += toInside[index] <= 0.0f ? (std::sqrt(toOutside[index]) - 0.5f) : (0.5f - std::sqrt(toInside[index]));
+                           }
+                         }
+                         const float distancePx = sum * toOutputScale;
+                         const float value = std::clamp(0.5f + (distancePx * rangeScale), 0.0f, 1.0f);
+                         pDstRow[dstX] = static_cast<uint8_t>((value * 255.0f) + 0.5f);
+                       }
+                     }
+                   });
+    }
+
+    int32_t ScaleMetric(const int32_t value, const uint32_t downscaleFactor)
+    {
+      return static_cast<int32_t>(std::lround(static_cast<double>(value) / static_cast<double>(downscaleFactor)));
+    }
+
+    uint16_t ScaleMetric(const uint16_t value, const uint32_t downscaleFactor)
+    {
+      return static_cast<uint16_t>(ScaleMetric(static_cast<int32_t>(value), downscaleFactor));
+    }
+
+    struct GlyphField
+    {
+      PxExtent2D ExtentPx;
+      std::vector<uint8_t> Content;
+      PxRectangleU32 DstRectPx;
+    };
+
+    //! Pack the glyph fields into the smallest power of two atlas, returns the atlas extent
+    PxExtent2D PackGlyphs(std::vector<GlyphField>& rGlyphs)
+    {
+      std::vector<std::size_t> order;
+      uint64_t totalArea = 0;
+      for (std::size_t i = 0; i < rGlyphs.size(); ++i)
+      {
+        const PxExtent2D extentPx = rGlyphs[i].ExtentPx;
+        if (extentPx.Width.Value > 0u && extentPx.Height.Value > 0u)
+        {
+          order.push_back(i);
+          totalArea +=
+            static_cast<uint64_t>(extentPx.Width.Value + LocalConfig::GlyphSpacingPx) * (extentPx.Height.Value + LocalConfig::GlyphSpacingPx);
+        }
+      }
+      // Tallest first gives the skyline a much flatter top
+      std::stable_sort(order.begin(), order.end(),
+                       [&rGlyphs](const std::size_t lhs, const std::size_t rhs)
+                       { return rGlyphs[lhs].ExtentPx.Height.Value > rGlyphs[rhs].ExtentPx.Height.Value; });
+
+      uint32_t width = 16;
+      uint32_t height = 16;
+      while ((static_cast<uint64_t>(width) * height) < totalArea)
+      {
+        (width <= height ? width : height) *= 2u;
+      }
+
+      SkylineBinPacker packer;
+      while (true)
+      {
+        packer.Reset(PxExtent2D::Create(width, height));
+        bool packed = true;
+        for (const std::size_t index : order)
+        {
+          GlyphField& rGlyph = rGlyphs[index];
+          const PxExtent2D cellExtentPx(rGlyph.ExtentPx.Width + PxValueU(LocalConfig::GlyphSpacingPx),
+                                        rGlyph.ExtentPx.Height + PxValueU(LocalConfig::GlyphSpacingPx));
+          const std::optional<PxRectangleU32> rect = packer.TryAllocate(cellExtentPx);
+          if (!rect.has_value())
+          {
+            packed = false;
+            break;
+          }
+          rGlyph.DstRectPx = PxRectangleU32(rect->X, rect->Y, rGlyph.ExtentPx.Width, rGlyph.ExtentPx.Height);
+        }
+        if (packed)
+        {
+          return PxExtent2D::Create(width, height);
+        }
+        (width <= height ? width : height) *= 2u;
+      }
+    }
+  }
+
+
+  SdfGenerator::SdfGenerator() = default;
+
+
+  SdfGenerator::SdfGenerator(std::shared_ptr<WorkerThreadPool> workerPool)
+    : m_workerPool(std::move(workerPool))
+  {
+  }
+
+
+  uint32_t SdfGenerator::CalcPaddingPx(const SdfGeneratorConfig& config)
+  {
+    ValidateConfig(config);
+    return static_cast<uint32_t>(std::ceil(config.DistanceRangePx * 0.5f));
+  }
+
+
+  Bitmap SdfGenerator::Generate(const ReadOnlyRawBitmap& srcBitmap, const SdfGeneratorConfig& config) const
+  {
+    const uint32_t paddingPx = CalcPaddingPx(config);
+    const AlphaSource source = CreateAlphaSource(srcBitmap);
+    const PxRectangleU32 srcRectPx(PxValueU(0), PxValueU(0), srcBitmap.UnsignedWidth(), srcBitmap.UnsignedHeight());
+    const PxExtent2D dstExtentPx = CalcOutputExtent(srcRectPx, config.DownscaleFactor, paddingPx);
+
+    std::vector<uint8_t> content(static_cast<std::size_t>(dstExtentPx.Width.Value) * dstExtentPx.Height.Value);
+    GenerateRegion(m_workerPool.get(), source, srcRectPx, config, paddingPx, content.data(), dstExtentPx.Width.Value);
+    return {std::move(content), dstExtentPx, PixelFormat::R8_UNORM, BitmapOrigin::UpperLeft};
+  }
+
+
+  SdfGeneratorFontResult SdfGenerator::GenerateFont(const BitmapFont& srcFont, const ReadOnlyRawBitmap& srcFontBitmap,
+                                                    const SdfGeneratorConfig& config) const
+  {
+    if (srcFont.GetFontType() != BitmapFontType::Bitmap)
+    {
+      throw UsageErrorException("The source font must be a bitmap font");
+    }
+    const uint32_t paddingPx = CalcPaddingPx(config);
+    const uint32_t scale = config.DownscaleFactor;
+    const AlphaSource source = CreateAlphaSource(srcFontBitmap);
+    const PxRectangleU32 srcBitmapRectPx(PxValueU(0), PxValueU(0), srcFontBitmap.UnsignedWidth(), srcFontBitmap.UnsignedHeight());
+    const ReadOnlySpan<BitmapFontChar> srcChars = srcFont.GetChars();
+    for (const BitmapFontChar& srcChar : srcChars)
+    {
+      if (!srcBitmapRectPx.Contains(srcChar.SrcTextureRectPx))
+      {
+        throw UsageErrorException(fmt::format("The glyph rect of char {} is outside the font bitmap", srcChar.Id));
+      }
+    }
+
+    // The glyphs are independent, so the glyphs are spread across the pool instead of the passes inside each glyph
+    std::vector<GlyphField> glyphs(srcChars.size());
+    ForEachChunk(m_workerPool.get(), glyphs.size(), 1u,
+                 [&](const std::size_t begin, const std::size_t end)
+                 {
+                   for (std::size_t i = begin; i < end; ++i)
+                   {
+                     const PxRectangleU32& srcRectPx = srcChars[i].SrcTextureRectPx;
+                     if (srcRectPx.Width.Value > 0u && srcRectPx.Height.Value > 0u)
+                     {
+                       GlyphField& rGlyph = glyphs[i];
+                       rGlyph.ExtentPx = CalcOutputExtent(srcRectPx, scale, paddingPx);
+                       rGlyph.Content.resize(static_cast<std::size_t>(rGlyph.ExtentPx.Width.Value) * rGlyph.ExtentPx.Height.Value);
+                       GenerateRegion(nullptr, source, srcRectPx, config, paddingPx, rGlyph.Content.data(), rGlyph.ExtentPx.Width.Value);
+                     }
+                   }
+                 });
+
+    const PxExtent2D atlasExtentPx = PackGlyphs(glyphs);
+    std::vector<uint8_t> atlasContent(static_cast<std::size_t>(atlasExtentPx.Width.Value) * atlasExtentPx.Height.Value);
+    std::vector<BitmapFontChar> dstChars(srcChars.size());
+    for (std::size_t i = 0; i < glyphs.size(); ++i)
+    {
+      const GlyphField& glyph = glyphs[i];
+      const BitmapFontChar& srcChar = srcChars[i];
+      for (uint32_t y = 0; y < glyph.ExtentPx.Height.Value; ++y)
+      {
+        std::memcpy(atlasContent.data() + ((static_cast<std::size_t>(glyph.DstRectPx.Y.Value) + y) * atlasExtentPx.Width.Value) +
+                      glyph.DstRectPx.X.Value,
+                    glyph.Content.data() + (static_cast<std::size_t>(y) * glyph.ExtentPx.Width.Value), glyph.ExtentPx.Width.Value);
+      }
+      // The field is larger than the glyph so the offset moves up and left by the padding
+      const int32_t padding = glyph.Content.empty() ? 0 : static_cast<int32_t>(paddingPx);
+      const PxPoint2 offsetPx = PxPoint2::Create(ScaleMetric(srcChar.OffsetPx.X.Value, scale) - padding,
+                                                 ScaleMetric(srcChar.OffsetPx.Y.Value, scale) - padding);
+      dstChars[i] = BitmapFontChar(srcChar.Id, glyph.DstRectPx, offsetPx, PxValueU16(ScaleMetric(srcChar.XAdvancePx.Value, scale)));
+    }
+
+    std::vector<BitmapFontKerning> dstKernings;
+    dstKernings.reserve(srcFont.GetKerningsCount());
+    for (const BitmapFontKerning& srcKerning : srcFont.GetKernings())
+    {
+      dstKernings.emplace_back(srcKerning.First, srcKerning.Second, PxValue(ScaleMetric(srcKerning.AmountPx.Value, scale)));
+    }
+
+    const PxThicknessU16 srcPaddingPx = srcFont.GetPaddingPx();
+    const auto padding16 = UncheckedNumericCast<uint16_t>(paddingPx);
+    const PxThicknessU16 dstPaddingPx = PxThicknessU16::Create(
+      ScaleMetric(srcPaddingPx.Left.Value, scale) + padding16, ScaleMetric(srcPaddingPx.Top.Value, scale) + padding16,
+      ScaleMetric(srcPaddingPx.Right.Value, scale) + padding16, ScaleMetric(srcPaddingPx.Bottom.Value, scale) + padding16);
+
+    const PxValueU16 lineSpacingPx(ScaleMetric(srcFont.GetLineSpacingPx().Value, scale));
+    const PxValueU16 baseLinePx(ScaleMetric(srcFont.GetBaseLinePx().Value, scale));
+    BitmapFont dstFont(srcFont.GetName(), srcFont.GetDpi(), ScaleMetric(srcFont.GetSize(), scale), lineSpacingPx, baseLinePx, dstPaddingPx,
+                       srcFont.GetTextureName(), BitmapFontType::SDF, BitmapFontSdfParams(config.DistanceRangePx, 1.0f), std::move(dstChars),
+                       std::move(dstKernings));
+    return {std::move(dstFont), Bitmap(std::move(atlasContent), atlasExtentPx, PixelFormat::R8_UNORM, BitmapOrigin::UpperLeft)};
+  }
+}
@@ -61,6 +61,12 @@ namespace Fsl
   }
 
   void BasicImageSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void BasicImageSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
     m_info.RenderInfo =
@@ -61,6 +61,12 @@ namespace Fsl
   }
 
   void BasicNineSliceSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void BasicNineSliceSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
 
@@ -0,0 +1,158 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Sprite/Font/Layout/TextLayout.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutCache.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutUtil.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace Fsl
+{
+  namespace
+  {
+    std::size_t CalcCommonPrefixLength(const StringViewLite lhs, const StringViewLite rhs) noexcept
+    {
+      const std::size_t count = std::min(lhs.size(), rhs.size());
+      std::size_t index = 0;
+      while (index < count && lhs[index] == rhs[index])
+      {
+        ++index;
+      }
+      return index;
+    }
+
+    //! The greedy decisions for all lines before 'line' only depend on the text before the returned index.
+    //! If the line was started by a '\n' that is the line start, otherwise the previous line measured the first word of this line
+    //! to decide that it did not fit.
+    std::size_t CalcLineDependencyEnd(const StringViewLite text, const TextLayoutLine& line) noexcept
+    {
+      assert(line.StartIndex > 0u);
+      if (text[line.StartIndex - 1u] == '\n')
+      {
+        return line.StartIndex;
+      }
+      std::size_t index = line.StartIndex;
+      while (index < text.size() && text[index] != ' ' && text[index] != '\n')
+      {
+        ++index;
+      }
+      // The character that ended the word must also be unchanged
+      return index + 1u;
+    }
+  }
+
+
+  bool TextLayout::SetText(const TextureAtlasSpriteFont& font, const StringViewLite text, const TextLayoutConfig& config,
+                           TextLayoutCache* const pCache)
+  {
+    if (m_pFont == &font && m_config == config)
+    {
+      if (text == GetText())
+      {
+        return false;
+      }
+      if (TryRelayoutLastLine(font, text))
+      {
+        return true;
+      }
+    }
+    Relayout(font, text, config, pCache);
+    return true;
+  }
+
+
+  void TextLayout::Clear() noexcept
+  {
+    m_pFont = nullptr;
+    m_config = {};
+    m_text.clear();
+    m_lines.clear();
+    m_glyphs.clear();
+    m_sizePx = {};
+  }
+
+
+  bool TextLayout::TryRelayoutLastLine(const TextureAtlasSpriteFont& font, const StringViewLite text)
+  {
+    if (m_config.LineBreakMode != TextLineBreakMode::Greedy || m_lines.size() < 2u)
+    {
+      return false;
+    }
+
+    const TextLayoutLine lastLine = m_lines.back();
+    const std::size_t prefixLength = CalcCommonPrefixLength(GetText(), text);
+    if (prefixLength < CalcLineDependencyEnd(GetText(), lastLine))
+    {
+      return false;
+    }
+
+    // Drop the last line and its glyphs, then lay out the remaining text from the start of that line
+    m_lines.pop_back();
+    std::size_t keptGlyphCount = 0;
+    for (const TextLayoutLine& line : m_lines)
+    {
+      keptGlyphCount += line.Length;
+    }
+    m_glyphs.resize(keptGlyphCount);
+
+    const auto firstNewLineIndex = static_cast<uint32_t>(m_lines.size());
+    TextLayoutUtil::BreakLines(m_lines, font, text, m_config, lastLine.StartIndex);
+    const ReadOnlySpan<TextLayoutLine> newLines(m_lines.data() + firstNewLineIndex, m_lines.size() - firstNewLineIndex);
+    TextLayoutUtil::ExtractGlyphs(m_glyphs, font, text, newLines, m_config.FontConfig, firstNewLineIndex);
+    m_text.assign(text.data(), text.size());
+    m_sizePx = TextLayoutUtil::CalcSize(font, GetLines(), m_config.FontConfig);
+    return true;
+  }
+
+
+  void TextLayout::Relayout(const TextureAtlasSpriteFont& font, const StringViewLite text, const TextLayoutConfig& config,
+                            TextLayoutCache* const pCache)
+  {
+    m_lines.clear();
+    if (pCache != nullptr)
+    {
+      const ReadOnlySpan<TextLayoutLine> lines = pCache->BreakLines(font, text, config);
+      m_lines.assign(lines.begin(), lines.end());
+    }
+    else
+    {
+      TextLayoutUtil::BreakLines(m_lines, font, text, config);
+    }
+    m_glyphs.clear();
+    TextLayoutUtil::ExtractGlyphs(m_glyphs, font, text, GetLines(), config.FontConfig);
+
+    m_pFont = &font;
+    m_config = config;
+    m_text.assign(text.data(), text.size());
+    m_sizePx = TextLayoutUtil::CalcSize(font, GetLines(), config.FontConfig);
+  }
+}
@@ -0,0 +1,117 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutCache.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutUtil.hpp>
+#include <functional>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    inline std::size_t Combine(const std::size_t seed, const std::size_t value) noexcept
+    {
+      return seed ^ (value + 0x9e3779b9u + (seed << 6u) + (seed >> 2u));
+    }
+  }
+
+
+  std::size_t TextLayoutCache::KeyHash::operator()(const Key& key) const noexcept
+  {
+    std::size_t hash = std::hash<std::string_view>()(key.Text);
+    hash = Combine(hash, std::hash<const void*>()(key.pFont));
+    hash = Combine(hash, std::hash<int32_t>()(key.Config.MaxWidthPx.RawValue()));
+    hash = Combine(hash, std::hash<float>()(key.Config.FontConfig.Scale));
+    hash = Combine(hash, (key.Config.FontConfig.Kerning ? 1u : 0u) | (static_cast<uint32_t>(key.Config.LineBreakMode) << 1u));
+    return hash;
+  }
+
+
+  TextLayoutCache::TextLayoutCache(const uint32_t capacity)
+    : m_capacity(capacity)
+  {
+    if (capacity <= 0u)
+    {
+      throw std::invalid_argument("capacity must be >= 1");
+    }
+    m_lookup.reserve(capacity);
+  }
+
+
+  void TextLayoutCache::Clear() noexcept
+  {
+    m_lookup.clear();
+    m_records.clear();
+  }
+
+
+  ReadOnlySpan<TextLayoutLine> TextLayoutCache::BreakLines(const TextureAtlasSpriteFont& font, const StringViewLite text,
+                                                           const TextLayoutConfig& config)
+  {
+    const Key queryKey{&font, config, std::string_view(text.data(), text.size())};
+    auto itrFind = m_lookup.find(queryKey);
+    if (itrFind != m_lookup.end())
+    {
+      ++m_hitCount;
+      m_records.splice(m_records.begin(), m_records, itrFind->second);
+      const std::vector<TextLayoutLine>& lines = itrFind->second->Lines;
+      return ReadOnlySpan<TextLayoutLine>(lines.data(), lines.size());
+    }
+
+    ++m_missCount;
+    std::vector<TextLayoutLine> lines;
+    TextLayoutUtil::BreakLines(lines, font, text, config);
+
+    if (m_records.size() >= m_capacity)
+    {
+      // Evict the least recently used record and reuse its storage
+      Record& rOldest = m_records.back();
+      m_lookup.erase(Key{rOldest.pFont, rOldest.Config, std::string_view(rOldest.Text)});
+      m_records.splice(m_records.begin(), m_records, std::prev(m_records.end()));
+      Record& rRecord = m_records.front();
+      rRecord.pFont = &font;
+      rRecord.Config = config;
+      rRecord.Text.assign(text.data(), text.size());
+      rRecord.Lines = std::move(lines);
+    }
+    else
+    {
+      m_records.push_front(Record{&font, config, std::string(text.data(), text.size()), std::move(lines)});
+    }
+
+    const Record& record = m_records.front();
+    m_lookup.emplace(Key{record.pFont, record.Config, std::string_view(record.Text)}, m_records.begin());
+    return ReadOnlySpan<TextLayoutLine>(record.Lines.data(), record.Lines.size());
+  }
+}
@@ -0,0 +1,271 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutUtil.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <algorithm>
+#include <limits>
+#include <vector>
+
+namespace Fsl
+{
+  namespace
+  {
+    struct WordRange
+    {
+      uint32_t Begin{0};
+      uint32_t End{0};
+
+      constexpr WordRange(const uint32_t begin, const uint32_t end) noexcept
+        : Begin(begin)
+        , End(end)
+      {
+      }
+    };
+
+    class LineMeasurer
+    {
+      const TextureAtlasSpriteFont& m_font;
+      const StringViewLite m_text;
+      const BitmapFontConfig m_fontConfig;
+
+    public:
+      LineMeasurer(const TextureAtlasSpriteFont& font, const StringViewLite text, const BitmapFontConfig& fontConfig) noexcept
+        : m_font(font)
+        , m_text(text)
+        , m_fontConfig(fontConfig)
+      {
+      }
+
+      PxSize1D Measure(const uint32_t begin, const uint32_t end) const
+      {
+        assert(begin <= end);
+        return m_font.MeasureString(m_text.substr(begin, end - begin), m_fontConfig).Width();
+      }
+    };
+
+    //! Find the words in [begin, end), words are separated by spaces
+    void FindWords(std::vector<WordRange>& rWords, const StringViewLite text, const uint32_t begin, const uint32_t end)
+    {
+      rWords.clear();
+      uint32_t index = begin;
+      while (index < end)
+      {
+        while (index < end && text[index] == ' ')
+        {
+          ++index;
+        }
+        const uint32_t wordBegin = index;
+        while (index < end && text[index] != ' ')
+        {
+          ++index;
+        }
+        if (index > wordBegin)
+        {
+          rWords.emplace_back(wordBegin, index);
+        }
+      }
+    }
+
+    //! The first line of a paragraph keeps its leading spaces, lines started by a soft break begin at the word
+    inline uint32_t LineBegin(const ReadOnlySpan<WordRange> words, const std::size_t wordIndex, const uint32_t paragraphBegin) noexcept
+    {
+      return wordIndex == 0u ? paragraphBegin : words[wordIndex].Begin;
+    }
+
+    void BreakParagraphGreedy(std::vector<TextLayoutLine>& rLines, const LineMeasurer& measurer, const ReadOnlySpan<WordRange> words,
+                              const uint32_t paragraphBegin, const PxSize1D maxWidthPx)
+    {
+      assert(!words.empty());
+      uint32_t lineBegin = paragraphBegin;
+      uint32_t lineEnd = words[0].End;
+      PxSize1D lineWidthPx = measurer.Measure(lineBegin, lineEnd);
+      for (std::size_t i = 1; i < words.size(); ++i)
+      {
+        const PxSize1D candidateWidthPx = measurer.Measure(lineBegin, words[i].End);
+        if (candidateWidthPx <= maxWidthPx)
+        {
+          lineEnd = words[i].End;
+          lineWidthPx = candidateWidthPx;
+        }
+        else
+        {
+          rLines.emplace_back(lineBegin, lineEnd - lineBegin, lineWidthPx);
+          lineBegin = words[i].Begin;
+          lineEnd = words[i].End;
+          lineWidthPx = measurer.Measure(lineBegin, lineEnd);
+        }
+      }
+      rLines.emplace_back(lineBegin, lineEnd - lineBegin, lineWidthPx);
+    }
+
+    //! Minimum raggedness line breaking.
+    //! The cost of a line is its squared free space, the last line is free and a single overflowing word costs nothing extra as it cant be broken.
+    void BreakParagraphOptimal(std::vector<TextLayoutLine>& rLines, const LineMeasurer& measurer, const ReadOnlySpan<WordRange> words,
+                               const uint32_t paragraphBegin, const PxSize1D maxWidthPx)
+    {
+      assert(!words.empty());
+      const std::size_t wordCount = words.size();
+      // minCost[i] is the minimal cost of laying out words [i, wordCount), nextBreak[i] the first word of the next line in that layout
+      std::vector<double> minCost(wordCount + 1u, 0.0);
+      std::vector<std::size_t> nextBreak(wordCount + 1u, wordCount);
+      std::vector<PxSize1D> lineWidthPx(wordCount + 1u);
+      for (std::size_t i = wordCount; i > 0u; --i)
+      {
+        const std::size_t firstWord = i - 1u;
+        const uint32_t lineBegin = LineBegin(words, firstWord, paragraphBegin);
+        minCost[firstWord] = std::numeric_limits<double>::max();
+        for (std::size_t lastWord = firstWord; lastWord < wordCount; ++lastWord)
+        {
+          const PxSize1D widthPx = measurer.Measure(lineBegin, words[lastWord].End);
+          if (widthPx > maxWidthPx && lastWord > firstWord)
+          {
+            break;
+          }
+          const bool isLastLine = (lastWord + 1u) == wordCount;
+          const double freePx = widthPx <= maxWidthPx ? static_cast<double>(maxWidthPx.RawValue() - widthPx.RawValue()) : 0.0;
+          const double cost = (isLastLine ? 0.0 : freePx * freePx) + minCost[lastWord + 1u];
+          if (cost < minCost[firstWord])
+          {
+            minCost[firstWord] = cost;
+            nextBreak[firstWord] = lastWord + 1u;
+            lineWidthPx[firstWord] = widthPx;
+          }
+        }
+      }
+
+      std::size_t wordIndex = 0;
+      while (wordIndex < wordCount)
+      {
+        const std::size_t nextWordIndex = nextBreak[wordIndex];
+        const uint32_t lineBegin = LineBegin(words, wordIndex, paragraphBegin);
+        rLines.emplace_back(lineBegin, words[nextWordIndex - 1u].End - lineBegin, lineWidthPx[wordIndex]);
+        wordIndex = nextWordIndex;
+      }
+    }
+  }
+
+
+  namespace TextLayoutUtil
+  {
+    void BreakLines(std::vector<TextLayoutLine>& rLines, const TextureAtlasSpriteFont& font, const StringViewLite text,
+                    const TextLayoutConfig& config, const uint32_t startIndex)
+    {
+      if (text.size() > std::numeric_limits<uint32_t>::max())
+      {
+        throw std::invalid_argument("text can not be larger than a uint32");
+      }
+      if (startIndex > text.size())
+      {
+        throw std::invalid_argument("startIndex out of bounds");
+      }
+      if (text.empty())
+      {
+        return;
+      }
+
+      const LineMeasurer measurer(font, text, config.FontConfig);
+      const auto textLength = static_cast<uint32_t>(text.size());
+      std::vector<WordRange> words;
+      uint32_t paragraphBegin = startIndex;
+      while (true)
+      {
+        const std::size_t newLineIndex = text.find('\n', paragraphBegin);
+        const uint32_t paragraphEnd = newLineIndex != StringViewLite::npos ? static_cast<uint32_t>(newLineIndex) : textLength;
+
+        FindWords(words, text, paragraphBegin, paragraphEnd);
+        if (words.empty())
+        {
+          rLines.emplace_back(paragraphBegin, 0u, PxSize1D());
+        }
+        else if (config.LineBreakMode == TextLineBreakMode::Optimal)
+        {
+          BreakParagraphOptimal(rLines, measurer, ReadOnlySpan<WordRange>(words.data(), words.size()), paragraphBegin, config.MaxWidthPx);
+        }
+        else
+        {
+          BreakParagraphGreedy(rLines, measurer, ReadOnlySpan<WordRange>(words.data(), words.size()), paragraphBegin, config.MaxWidthPx);
+        }
+
+        if (paragraphEnd >= textLength)
+        {
+          break;
+        }
+        paragraphBegin = paragraphEnd + 1u;
+      }
+    }
+
+
+    void ExtractGlyphs(std::vector<SpriteFontGlyphPosition>& rGlyphs, const TextureAtlasSpriteFont& font, const StringViewLite text,
+                       const ReadOnlySpan<TextLayoutLine> lines, const BitmapFontConfig& fontConfig, const uint32_t firstLineIndex)
+    {
+      const auto lineSpacingPxf = static_cast<float>(font.LineSpacingPx(fontConfig).Value);
+      for (std::size_t i = 0; i < lines.size(); ++i)
+      {
+        const TextLayoutLine& line = lines[i];
+        if (line.Length == 0u)
+        {
+          continue;
+        }
+        if (line.StartIndex > text.size() || line.Length > (text.size() - line.StartIndex))
+        {
+          throw std::invalid_argument("line out of bounds");
+        }
+
+        const std::size_t dstIndex = rGlyphs.size();
+        rGlyphs.resize(dstIndex + line.Length);
+        Span<SpriteFontGlyphPosition> dst(rGlyphs.data() + dstIndex, line.Length);
+        if (font.ExtractRenderRules(dst, text.substr(line.StartIndex, line.Length), fontConfig))
+        {
+          const PxVector2 offsetPxf(PxValueF(0.0f), PxValueF(lineSpacingPxf * static_cast<float>(firstLineIndex + i)));
+          for (SpriteFontGlyphPosition& rGlyph : dst)
+          {
+            rGlyph.DstRectPxf = PxAreaRectangleF::AddLocation(offsetPxf, rGlyph.DstRectPxf);
+          }
+        }
+      }
+    }
+
+
+    PxSize2D CalcSize(const TextureAtlasSpriteFont& font, const ReadOnlySpan<TextLayoutLine> lines, const BitmapFontConfig& fontConfig)
+    {
+      PxSize1D widthPx;
+      for (const TextLayoutLine& line : lines)
+      {
+        widthPx.SetMax(line.WidthPx);
+      }
+      const auto lineSpacingPx = static_cast<int32_t>(font.LineSpacingPx(fontConfig).Value);
+      return PxSize2D::Create(widthPx.RawValue(), NumericCast<int32_t>(lines.size()) * lineSpacingPx);
+    }
+  }
+}
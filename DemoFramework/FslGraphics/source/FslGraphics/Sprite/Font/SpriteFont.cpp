@@ -36,11 +36,23 @@
 #include <FslGraphics/Sprite/Font/SpriteFont.hpp>
 #include <FslGraphics/Sprite/Font/SpriteFontConfig.hpp>
 #include <FslGraphics/Sprite/SpriteUnitConverter.hpp>
+#include <algorithm>
 #include <cassert>
+#include <limits>
 #include <utility>
 
 namespace Fsl
 {
+  namespace
+  {
+    //! The scale is finite (both dpi values are non zero) so clamping to the PxValueU16 range means the conversion can not throw
+    PxValueU16 ToClampedPxValueU16(const float valuePx)
+    {
+      return TypeConverter::UncheckedChangeTo<PxValueU16>(
+        PxValueF(std::clamp(valuePx, 0.0f, static_cast<float>(std::numeric_limits<PxValueU16::value_type>::max()))));
+    }
+  }
+
   SpriteFont::SpriteFont(const SpriteNativeAreaCalc& spriteNativeAreaCalc, const SpriteMaterialInfo& spriteMaterialInfo, const BitmapFont& bitmapFont,
                          const SpriteFontConfig& spriteFontConfig, const uint32_t densityDpi, const StringViewLite& debugName)
     : m_info(spriteMaterialInfo, bitmapFont.GetLineSpacingPx(), bitmapFont.GetBaseLinePx(), bitmapFont.GetDpi(), spriteFontConfig.EnableKerning,
@@ -82,6 +94,12 @@ namespace Fsl
 
 
   void SpriteFont::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void SpriteFont::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
     auto scale = unitConverter.CalcImageDensityScale(m_info.ImageDpi);
@@ -90,12 +108,13 @@ namespace Fsl
       scale *= m_info.SdfScale;
     }
     m_info.FontConfig.Scale = scale;
-    m_info.ScaledLineSpacingPx = TypeConverter::ChangeTo<PxValueU16>(PxValueF(static_cast<float>(m_info.LineSpacingPx.Value) * scale));
-    m_info.ScaledBaseLinePx = TypeConverter::ChangeTo<PxValueU16>(PxValueF(static_cast<float>(m_info.BaseLinePx.Value) * scale));
+    m_info.ScaledLineSpacingPx = ToClampedPxValueU16(static_cast<float>(m_info.LineSpacingPx.Value) * scale);
+    m_info.ScaledBaseLinePx = ToClampedPxValueU16(static_cast<float>(m_info.BaseLinePx.Value) * scale);
   }
 
   PxSize2D SpriteFont::MeasureString(const StringViewLite& strView) const
   {
+    EnsureResolved();
     return m_bitmapFontAtlas.MeasureString(strView, m_info.FontConfig);
   }
 }
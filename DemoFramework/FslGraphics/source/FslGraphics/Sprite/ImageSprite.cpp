@@ -63,6 +63,12 @@ namespace Fsl
   }
 
   void ImageSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void ImageSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
 
@@ -65,6 +65,12 @@ namespace Fsl
   }
 
   void NineSliceSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void NineSliceSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
 
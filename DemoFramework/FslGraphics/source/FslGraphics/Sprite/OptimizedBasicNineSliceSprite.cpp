@@ -65,6 +65,12 @@ namespace Fsl
   }
 
   void OptimizedBasicNineSliceSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void OptimizedBasicNineSliceSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
 
@@ -68,6 +68,12 @@ namespace Fsl
   }
 
   void OptimizedNineSliceSprite::Resize(const uint32_t densityDpi)
+  {
+    ResolveDensity(densityDpi);
+  }
+
+
+  void OptimizedNineSliceSprite::DoResolve(const uint32_t densityDpi) const
   {
     SpriteUnitConverter unitConverter(densityDpi);
 
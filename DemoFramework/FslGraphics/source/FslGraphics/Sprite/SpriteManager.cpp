@@ -43,14 +43,14 @@
 #include <FslGraphics/Sprite/SpriteManager.hpp>
 #include <FslGraphics/TextureAtlas/AtlasNineSlicePatchInfo.hpp>
 #include <FslGraphics/TextureAtlas/AtlasTextureInfo.hpp>
-#include <algorithm>
 #include <utility>
+#include <vector>
 
 namespace Fsl
 {
   SpriteManager::SpriteManager(const uint32_t densityDpi, const bool useYFlipTextureCoordinates)
     : m_spriteNativeAreaCalc(useYFlipTextureCoordinates)
-    , m_densityDpi(densityDpi)
+    , m_densityState(std::make_shared<SpriteDensityState>(densityDpi))
   {
     if (densityDpi <= 0)
     {
@@ -61,34 +61,45 @@ namespace Fsl
 
   std::size_t SpriteManager::Count() const
   {
-    return m_sprites.size();
+    return m_lazySprites.size() + m_eagerSprites.size();
   }
 
 
   void SpriteManager::Clear()
   {
-    m_sprites.clear();
+    m_lazySprites.clear();
+    m_eagerSprites.clear();
+    m_lookup.clear();
   }
 
   void SpriteManager::Add(std::shared_ptr<ISprite> sprite)
   {
-    if (Contains(sprite))
-    {
-      throw std::invalid_argument("sprite already added");
-    }
-
-    m_sprites.emplace_back(std::move(sprite));
+    AddRecord(std::move(sprite), false);
   }
 
   void SpriteManager::Remove(const std::shared_ptr<ISprite>& sprite)
   {
-    m_sprites.remove(sprite);
+    const auto itrFind = m_lookup.find(sprite.get());
+    if (itrFind == m_lookup.end())
+    {
+      return;
+    }
+    // Swap the last record into the hole so the record vectors stay dense
+    const RecordIndex record = itrFind->second;
+    m_lookup.erase(itrFind);
+    std::vector<std::shared_ptr<ISprite>>& rSprites = record.IsLazy ? m_lazySprites : m_eagerSprites;
+    if (record.Index != (rSprites.size() - 1u))
+    {
+      rSprites[record.Index] = std::move(rSprites.back());
+      m_lookup[rSprites[record.Index].get()] = record;
+    }
+    rSprites.pop_back();
   }
 
 
   bool SpriteManager::Contains(const std::shared_ptr<ISprite>& sprite) const
   {
-    return std::find(m_sprites.begin(), m_sprites.end(), sprite) != m_sprites.end();
+    return m_lookup.find(sprite.get()) != m_lookup.end();
   }
 
 
@@ -98,11 +109,39 @@ namespace Fsl
     {
       throw std::invalid_argument("densityDpi must be >= 0");
     }
-    for (const auto& entry : m_sprites)
+    if (!m_densityState->SetDensityDpi(densityDpi))
+    {
+      return;
+    }
+    // The lazy sprites detect the new generation on their next access
+    for (const auto& entry : m_eagerSprites)
     {
       entry->Resize(densityDpi);
     }
-    m_densityDpi = densityDpi;
+  }
+
+
+  template <typename TSprite>
+  void SpriteManager::AddLazy(const std::shared_ptr<TSprite>& sprite)
+  {
+    sprite->SetDensitySource(m_densityState);
+    AddRecord(sprite, true);
+  }
+
+
+  void SpriteManager::AddRecord(std::shared_ptr<ISprite> sprite, const bool isLazy)
+  {
+    if (!sprite)
+    {
+      throw std::invalid_argument("sprite can not be null");
+    }
+    if (Contains(sprite))
+    {
+      throw std::invalid_argument("sprite already added");
+    }
+    std::vector<std::shared_ptr<ISprite>>& rSprites = isLazy ? m_lazySprites : m_eagerSprites;
+    m_lookup.emplace(sprite.get(), RecordIndex(isLazy, rSprites.size()));
+    rSprites.push_back(std::move(sprite));
   }
 
 
@@ -121,9 +160,9 @@ namespace Fsl
 
     auto sprite =
       std::make_shared<BasicImageSprite>(m_spriteNativeAreaCalc, spriteMaterialInfo, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
-                                         textureInfo.Dpi, debugName, m_densityDpi);
+                                         textureInfo.Dpi, debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -138,9 +177,9 @@ namespace Fsl
 
     auto sprite =
       std::make_shared<ImageSprite>(m_spriteNativeAreaCalc, spriteMaterialInfo, textureInfo.TrimMarginPx,
-                                    TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), textureInfo.Dpi, debugName, m_densityDpi);
+                                    TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), textureInfo.Dpi, debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -167,7 +206,7 @@ namespace Fsl
         }
 
         pImageSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
-                                 textureInfo.Dpi, debugName, m_densityDpi);
+                                 textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -176,7 +215,7 @@ namespace Fsl
       if (pImageSprite != nullptr)
       {
         pImageSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, textureInfo.TrimMarginPx,
-                                 TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), textureInfo.Dpi, debugName, m_densityDpi);
+                                 TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -245,9 +284,9 @@ namespace Fsl
 
     auto sprite =
       std::make_shared<BasicNineSliceSprite>(m_spriteNativeAreaCalc, spriteMaterialInfo, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
-                                             patchInfo.NineSlicePx, patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, m_densityDpi);
+                                             patchInfo.NineSlicePx, patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -263,9 +302,9 @@ namespace Fsl
 
     auto sprite = std::make_shared<NineSliceSprite>(m_spriteNativeAreaCalc, spriteMaterialInfo, textureInfo.TrimMarginPx,
                                                     TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), patchInfo.NineSlicePx,
-                                                    patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, m_densityDpi);
+                                                    patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -291,9 +330,9 @@ namespace Fsl
 
     auto sprite = std::make_shared<OptimizedBasicNineSliceSprite>(
       m_spriteNativeAreaCalc, opaqueSpriteMaterialInfo, transparentSpriteMaterialInfo, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
-      patchInfo.NineSlicePx, patchInfo.ContentMarginPx, patchInfo.Flags, textureInfo.Dpi, debugName, m_densityDpi);
+      patchInfo.NineSlicePx, patchInfo.ContentMarginPx, patchInfo.Flags, textureInfo.Dpi, debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -316,9 +355,9 @@ namespace Fsl
     auto sprite = std::make_shared<OptimizedNineSliceSprite>(m_spriteNativeAreaCalc, opaqueSpriteMaterialInfo, transparentSpriteMaterialInfo,
                                                              textureInfo.TrimMarginPx, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
                                                              patchInfo.NineSlicePx, patchInfo.ContentMarginPx, patchInfo.Flags, textureInfo.Dpi,
-                                                             debugName, m_densityDpi);
+                                                             debugName, GetDensityDpi());
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -345,7 +384,7 @@ namespace Fsl
         }
 
         pNineSliceSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx),
-                                     patchInfo.NineSlicePx, patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, m_densityDpi);
+                                     patchInfo.NineSlicePx, patchInfo.ContentMarginPx, textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -355,7 +394,7 @@ namespace Fsl
       {
         pNineSliceSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, textureInfo.TrimMarginPx,
                                      TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), patchInfo.NineSlicePx, patchInfo.ContentMarginPx,
-                                     textureInfo.Dpi, debugName, m_densityDpi);
+                                     textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -391,7 +430,7 @@ namespace Fsl
 
         pNineSliceSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo0, spriteMaterialInfo1,
                                      TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), patchInfo.NineSlicePx, patchInfo.ContentMarginPx,
-                                     patchInfo.Flags, textureInfo.Dpi, debugName, m_densityDpi);
+                                     patchInfo.Flags, textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -401,7 +440,7 @@ namespace Fsl
       {
         pNineSliceSprite->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo0, spriteMaterialInfo1, textureInfo.TrimMarginPx,
                                      TypeConverter::To<PxRectangleU16>(textureInfo.TrimmedRectPx), patchInfo.NineSlicePx, patchInfo.ContentMarginPx,
-                                     patchInfo.Flags, textureInfo.Dpi, debugName, m_densityDpi);
+                                     patchInfo.Flags, textureInfo.Dpi, debugName, GetDensityDpi());
         return;
       }
     }
@@ -416,9 +455,9 @@ namespace Fsl
       throw std::invalid_argument("spriteMaterialInfo must be valid");
     }
 
-    auto sprite = std::make_shared<SpriteFont>(m_spriteNativeAreaCalc, spriteMaterialInfo, bitmapFont, spriteFontConfig, m_densityDpi, debugName);
+    auto sprite = std::make_shared<SpriteFont>(m_spriteNativeAreaCalc, spriteMaterialInfo, bitmapFont, spriteFontConfig, GetDensityDpi(), debugName);
 
-    Add(sprite);
+    AddLazy(sprite);
     return sprite;
   }
 
@@ -434,7 +473,7 @@ namespace Fsl
     const auto fontConfig = font->GetInfo().FontConfig;
     const SpriteFontConfig spriteFontConfig(fontConfig.Kerning);
 
-    font->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, bitmapFont, spriteFontConfig, m_densityDpi, debugName);
+    font->SetContent(m_spriteNativeAreaCalc, spriteMaterialInfo, bitmapFont, spriteFontConfig, GetDensityDpi(), debugName);
   }
 
 }
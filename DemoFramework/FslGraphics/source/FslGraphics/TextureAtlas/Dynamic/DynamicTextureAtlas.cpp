@@ -0,0 +1,416 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/IO/FmtPath.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Exceptions.hpp>
+#include <FslGraphics/PixelFormatUtil.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/DynamicTextureAtlas.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+
+namespace Fsl
+{
+  namespace
+  {
+    void ValidateBitmap(const ReadOnlyRawBitmap& bitmap, const PixelFormat pixelFormat)
+    {
+      if (bitmap.GetPixelFormat() != pixelFormat)
+      {
+        throw UsageErrorException("The bitmap pixel format must match the atlas pixel format");
+      }
+      if (bitmap.RawUnsignedWidth() == 0u || bitmap.RawUnsignedHeight() == 0u)
+      {
+        throw UsageErrorException("Can not add a empty bitmap");
+      }
+      if (bitmap.GetOrigin() != BitmapOrigin::UpperLeft && bitmap.GetOrigin() != BitmapOrigin::LowerLeft)
+      {
+        throw UsageErrorException("Unsupported bitmap origin");
+      }
+    }
+
+    //! The padding is only needed between entries so it is dropped at the edge of the page
+    uint32_t CalcCellSize(const uint32_t sizePx, const uint32_t bleedPx, const uint32_t paddingPx, const uint32_t pageSizePx)
+    {
+      const uint64_t contentSizePx = static_cast<uint64_t>(sizePx) + (2u * static_cast<uint64_t>(bleedPx));
+      if (contentSizePx > pageSizePx)
+      {
+        throw NotSupportedException(fmt::format("The bitmap can not fit inside a page ({} > {})", contentSizePx, pageSizePx));
+      }
+      return static_cast<uint32_t>(std::min(contentSizePx + paddingPx, static_cast<uint64_t>(pageSizePx)));
+    }
+  }
+
+
+  DynamicTextureAtlas::DynamicTextureAtlas(const DynamicTextureAtlasConfig& config)
+    : m_config(config)
+    , m_bytesPerPixel(PixelFormatUtil::GetBytesPerPixel(config.PagePixelFormat))
+    , m_pageStride(PixelFormatUtil::CalcMinimumStride(config.PageExtentPx.Width, config.PagePixelFormat))
+  {
+    if (PixelFormatUtil::IsCompressed(config.PagePixelFormat) || m_bytesPerPixel == 0u)
+    {
+      throw NotSupportedException("The atlas pixel format must be a uncompressed format");
+    }
+    if (config.PageExtentPx.Width.Value == 0u || config.PageExtentPx.Height.Value == 0u)
+    {
+      throw std::invalid_argument("The page extent can not be empty");
+    }
+    if (config.MaxPages == 0u)
+    {
+      throw std::invalid_argument("MaxPages must be at least one");
+    }
+  }
+
+
+  bool DynamicTextureAtlas::Contains(const IO::Path& name) const
+  {
+    return m_entries.find(name) != m_entries.end();
+  }
+
+
+  bool DynamicTextureAtlas::IsValid(const DynamicTextureAtlasRegion& region) const noexcept
+  {
+    return region.PageIndex < m_pages.size() && m_pages[region.PageIndex].Generation == region.PageGeneration;
+  }
+
+
+  std::optional<DynamicTextureAtlasRegion> DynamicTextureAtlas::TryGet(const IO::Path& name)
+  {
+    const auto itr = m_entries.find(name);
+    if (itr == m_entries.end())
+    {
+      return {};
+    }
+    m_pages[itr->second.PageIndex].LastUsedFrame = m_frame;
+    return ToRegion(itr->second);
+  }
+
+
+  std::optional<DynamicTextureAtlasRegion> DynamicTextureAtlas::TryAdd(const IO::Path& name, const ReadOnlyRawBitmap& bitmap)
+  {
+    ValidateBitmap(bitmap, m_config.PagePixelFormat);
+    if (Contains(name))
+    {
+      throw UsageErrorException(fmt::format("The atlas already contains a entry named '{}'", name));
+    }
+
+    const PxExtent2D cellExtentPx(
+      PxValueU(CalcCellSize(bitmap.RawUnsignedWidth(), m_config.BleedPx, m_config.PaddingPx, m_config.PageExtentPx.Width.Value)),
+      PxValueU(CalcCellSize(bitmap.RawUnsignedHeight(), m_config.BleedPx, m_config.PaddingPx, m_config.PageExtentPx.Height.Value)));
+
+    // 1. Try the existing pages
+    uint32_t pageIndex = 0;
+    std::optional<PxRectangleU32> cellRectPx = TryAllocateOnExistingPage(cellExtentPx, pageIndex);
+    if (!cellRectPx.has_value())
+    {
+      if (m_pages.size() < m_config.MaxPages)
+      {
+        // 2. Grow by adding a new page
+        Page& rNewPage = m_pages.emplace_back();
+        rNewPage.Packer.Reset(m_config.PageExtentPx);
+        rNewPage.Content.resize(static_cast<std::size_t>(m_pageStride) * m_config.PageExtentPx.Height.Value);
+        rNewPage.Generation = ++m_lastPageGeneration;
+        pageIndex = static_cast<uint32_t>(m_pages.size() - 1u);
+      }
+      else
+      {
+        // 3. Reuse the least recently used page
+        const std::optional<uint32_t> evictIndex = TryFindEvictablePage();
+        if (!evictIndex.has_value())
+        {
+          return {};
+        }
+        pageIndex = evictIndex.value();
+        EvictPage(pageIndex);
+      }
+      cellRectPx = m_pages[pageIndex].Packer.TryAllocate(cellExtentPx);
+    }
+    if (!cellRectPx.has_value())
+    {
+      // Can only occur if the cell can not fit inside a empty page which CalcCellSize prevents
+      throw InternalErrorException("Failed to allocate a entry inside a empty page");
+    }
+
+    Record record;
+    record.PageIndex = pageIndex;
+    record.RectPx = PxRectangleU32(cellRectPx->X + PxValueU(m_config.BleedPx), cellRectPx->Y + PxValueU(m_config.BleedPx), bitmap.UnsignedWidth(),
+                                   bitmap.UnsignedHeight());
+
+    Page& rPage = m_pages[pageIndex];
+    Blit(rPage, record.RectPx, bitmap);
+    ++rPage.EntryCount;
+    rPage.LastUsedFrame = m_frame;
+    m_activePageIndex = pageIndex;
+    m_entries.emplace(name, record);
+    return ToRegion(record);
+  }
+
+
+  DynamicTextureAtlasRegion DynamicTextureAtlas::Add(const IO::Path& name, const ReadOnlyRawBitmap& bitmap)
+  {
+    const std::optional<DynamicTextureAtlasRegion> region = TryAdd(name, bitmap);
+    if (!region.has_value())
+    {
+      throw UsageErrorException(fmt::format("No room for '{}', all pages are in use by the current frame", name));
+    }
+    return region.value();
+  }
+
+
+  bool DynamicTextureAtlas::Update(const IO::Path& name, const ReadOnlyRawBitmap& bitmap)
+  {
+    const auto itr = m_entries.find(name);
+    if (itr == m_entries.end())
+    {
+      return false;
+    }
+    ValidateBitmap(bitmap, m_config.PagePixelFormat);
+    const Record& record = itr->second;
+    if (bitmap.UnsignedWidth() != record.RectPx.Width || bitmap.UnsignedHeight() != record.RectPx.Height)
+    {
+      throw UsageErrorException("The bitmap extent must match the entry");
+    }
+    Page& rPage = m_pages[record.PageIndex];
+    Blit(rPage, record.RectPx, bitmap);
+    rPage.LastUsedFrame = m_frame;
+    return true;
+  }
+
+
+  bool DynamicTextureAtlas::Remove(const IO::Path& name)
+  {
+    const auto itr = m_entries.find(name);
+    if (itr == m_entries.end())
+    {
+      return false;
+    }
+    Page& rPage = m_pages[itr->second.PageIndex];
+    m_entries.erase(itr);
+    assert(rPage.EntryCount > 0u);
+    --rPage.EntryCount;
+    if (rPage.EntryCount == 0u)
+    {
+      // The skyline can not free individual rectangles, but once the page is empty all of it can be reused
+      ResetPage(rPage);
+    }
+    return true;
+  }
+
+
+  void DynamicTextureAtlas::Clear()
+  {
+    m_entries.clear();
+    m_pages.clear();
+    m_activePageIndex = 0;
+  }
+
+
+  ReadOnlyRawBitmap DynamicTextureAtlas::GetPageBitmap(const uint32_t pageIndex) const
+  {
+    const Page& page = GetPage(pageIndex);
+    return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(page.Content), m_config.PageExtentPx, m_config.PagePixelFormat, m_pageStride,
+                                     BitmapOrigin::UpperLeft);
+  }
+
+
+  bool DynamicTextureAtlas::IsPageDirty(const uint32_t pageIndex) const
+  {
+    return GetPage(pageIndex).IsDirty;
+  }
+
+
+  PxRectangleU32 DynamicTextureAtlas::GetPageDirtyRect(const uint32_t pageIndex) const
+  {
+    const Page& page = GetPage(pageIndex);
+    return page.IsDirty ? page.DirtyRectPx : PxRectangleU32();
+  }
+
+
+  ReadOnlyRawBitmap DynamicTextureAtlas::GetPageDirtyRowBitmap(const uint32_t pageIndex) const
+  {
+    const Page& page = GetPage(pageIndex);
+    if (!page.IsDirty)
+    {
+      return {};
+    }
+    const std::size_t offset = static_cast<std::size_t>(page.DirtyRectPx.Y.Value) * m_pageStride;
+    const std::size_t byteCount = static_cast<std::size_t>(page.DirtyRectPx.Height.Value) * m_pageStride;
+    return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(page.Content, offset, byteCount),
+                                     PxExtent2D(m_config.PageExtentPx.Width, page.DirtyRectPx.Height), m_config.PagePixelFormat, m_pageStride,
+                                     BitmapOrigin::UpperLeft);
+  }
+
+
+  void DynamicTextureAtlas::ClearPageDirtyRect(const uint32_t pageIndex)
+  {
+    if (pageIndex >= m_pages.size())
+    {
+      throw std::invalid_argument("pageIndex out of bounds");
+    }
+    Page& rPage = m_pages[pageIndex];
+    rPage.IsDirty = false;
+    rPage.DirtyRectPx = {};
+  }
+
+
+  const DynamicTextureAtlas::Page& DynamicTextureAtlas::GetPage(const uint32_t pageIndex) const
+  {
+    if (pageIndex >= m_pages.size())
+    {
+      throw std::invalid_argument("pageIndex out of bounds");
+    }
+    return m_pages[pageIndex];
+  }
+
+
+  std::optional<uint32_t> DynamicTextureAtlas::TryFindEvictablePage() const noexcept
+  {
+    std::optional<uint32_t> result;
+    uint64_t oldestFrame = std::numeric_limits<uint64_t>::max();
+    for (uint32_t i = 0; i < m_pages.size(); ++i)
+    {
+      const uint64_t lastUsedFrame = m_pages[i].LastUsedFrame;
+      if (lastUsedFrame < m_frame && lastUsedFrame < oldestFrame)
+      {
+        oldestFrame = lastUsedFrame;
+        result = i;
+      }
+    }
+    return result;
+  }
+
+
+  void DynamicTextureAtlas::EvictPage(const uint32_t pageIndex)
+  {
+    for (auto itr = m_entries.begin(); itr != m_entries.end();)
+    {
+      itr = (itr->second.PageIndex == pageIndex ? m_entries.erase(itr) : std::next(itr));
+    }
+    ResetPage(m_pages[pageIndex]);
+    ++m_evictedPageCount;
+  }
+
+
+  std::optional<PxRectangleU32> DynamicTextureAtlas::TryAllocateOnExistingPage(const PxExtent2D cellExtentPx, uint32_t& rPageIndex)
+  {
+    // Plain first fit lets small entries back fill older pages, which interleaves the pages of consecutive entries and splits batches.
+    // So the page that received the last entry is filled first.
+    if (m_activePageIndex < m_pages.size())
+    {
+      std::optional<PxRectangleU32> cellRectPx = m_pages[m_activePageIndex].Packer.TryAllocate(cellExtentPx);
+      if (cellRectPx.has_value())
+      {
+        rPageIndex = m_activePageIndex;
+        return cellRectPx;
+      }
+    }
+    for (uint32_t i = 0; i < m_pages.size(); ++i)
+    {
+      if (i != m_activePageIndex)
+      {
+        std::optional<PxRectangleU32> cellRectPx = m_pages[i].Packer.TryAllocate(cellExtentPx);
+        if (cellRectPx.has_value())
+        {
+          rPageIndex = i;
+          return cellRectPx;
+        }
+      }
+    }
+    return {};
+  }
+
+
+  void DynamicTextureAtlas::ResetPage(Page& rPage)
+  {
+    // The old pixels are left in place, they are never sampled and will be overwritten by the new entries.
+    // A new generation marks the regions that were handed out for the old entries as stale.
+    rPage.Packer.Clear();
+    rPage.EntryCount = 0;
+    rPage.Generation = ++m_lastPageGeneration;
+  }
+
+
+  DynamicTextureAtlasRegion DynamicTextureAtlas::ToRegion(const Record& record) const noexcept
+  {
+    return {record.PageIndex, m_pages[record.PageIndex].Generation, AtlasTextureInfo(record.RectPx, PxThicknessU(), m_config.Dpi)};
+  }
+
+
+  void DynamicTextureAtlas::Blit(Page& rPage, const PxRectangleU32& dstRectPx, const ReadOnlyRawBitmap& bitmap)
+  {
+    const uint32_t bpp = m_bytesPerPixel;
+    const uint32_t width = dstRectPx.Width.Value;
+    const uint32_t height = dstRectPx.Height.Value;
+    const uint32_t bleedPx = m_config.BleedPx;
+    const uint32_t dstX = dstRectPx.X.Value;
+    const uint32_t dstY = dstRectPx.Y.Value;
+    const uint32_t srcStride = bitmap.Stride();
+    const bool flipY = bitmap.GetOrigin() == BitmapOrigin::LowerLeft;
+    const auto* const pSrc = static_cast<const uint8_t*>(bitmap.Content());
+    uint8_t* const pDst = rPage.Content.data();
+
+    for (uint32_t y = 0; y < height; ++y)
+    {
+      const uint8_t* const pSrcRow = pSrc + (static_cast<std::size_t>(flipY ? (height - 1u - y) : y) * srcStride);
+      uint8_t* const pDstRow = pDst + (static_cast<std::size_t>(dstY + y) * m_pageStride) + (static_cast<std::size_t>(dstX) * bpp);
+      std::memcpy(pDstRow, pSrcRow, static_cast<std::size_t>(width) * bpp);
+      // Repeat the edge pixels to the left and right
+      for (uint32_t i = 1; i <= bleedPx; ++i)
+      {
+        std::memcpy(pDstRow - (static_cast<std::size_t>(i) * bpp), pDstRow, bpp);
+        std::memcpy(pDstRow + (static_cast<std::size_t>(width - 1u + i) * bpp), pDstRow + (static_cast<std::size_t>(width - 1u) * bpp), bpp);
+      }
+    }
+
+    // Repeat the top and bottom rows (including the bleed columns so the corners are filled too)
+    const std::size_t bleedRowOffset = static_cast<std::size_t>(dstX - bleedPx) * bpp;
+    const std::size_t bleedRowBytes = static_cast<std::size_t>(width + (2u * bleedPx)) * bpp;
+    const uint8_t* const pTopRow = pDst + (static_cast<std::size_t>(dstY) * m_pageStride) + bleedRowOffset;
+    const uint8_t* const pBottomRow = pDst + (static_cast<std::size_t>(dstY + height - 1u) * m_pageStride) + bleedRowOffset;
+    for (uint32_t i = 1; i <= bleedPx; ++i)
+    {
+      std::memcpy(pDst + (static_cast<std::size_t>(dstY - i) * m_pageStride) + bleedRowOffset, pTopRow, bleedRowBytes);
+      std::memcpy(pDst + (static_cast<std::size_t>(dstY + height - 1u + i) * m_pageStride) + bleedRowOffset, pBottomRow, bleedRowBytes);
+    }
+
+    const PxRectangleU32 modifiedRectPx =
+      PxRectangleU32::Create(dstX - bleedPx, dstY - bleedPx, width + (2u * bleedPx), height + (2u * bleedPx));
+    rPage.DirtyRectPx = rPage.IsDirty ? PxRectangleU32::Union(rPage.DirtyRectPx, modifiedRectPx) : modifiedRectPx;
+    rPage.IsDirty = true;
+  }
+}
@@ -0,0 +1,178 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/TextureAtlas/Dynamic/SkylineBinPacker.hpp>
+#include <algorithm>
+#include <limits>
+
+namespace Fsl
+{
+  SkylineBinPacker::SkylineBinPacker() = default;
+
+
+  SkylineBinPacker::SkylineBinPacker(const PxExtent2D extentPx)
+  {
+    Reset(extentPx);
+  }
+
+
+  void SkylineBinPacker::Clear()
+  {
+    m_skyline.clear();
+    m_usedAreaPx = 0;
+    if (m_extentPx.Width.Value > 0u && m_extentPx.Height.Value > 0u)
+    {
+      m_skyline.emplace_back(0u, 0u, m_extentPx.Width.Value);
+    }
+  }
+
+
+  void SkylineBinPacker::Reset(const PxExtent2D extentPx)
+  {
+    m_extentPx = extentPx;
+    Clear();
+  }
+
+
+  std::optional<PxRectangleU32> SkylineBinPacker::TryAllocate(const PxExtent2D extentPx)
+  {
+    const uint32_t width = extentPx.Width.Value;
+    const uint32_t height = extentPx.Height.Value;
+    if (width == 0u || height == 0u || width > m_extentPx.Width.Value || height > m_extentPx.Height.Value)
+    {
+      return {};
+    }
+
+    // Bottom-left: pick the position that leaves the lowest top edge, break ties by the narrowest segment to reduce the wasted area
+    std::size_t bestIndex = m_skyline.size();
+    uint32_t bestBottom = std::numeric_limits<uint32_t>::max();
+    uint32_t bestWidth = std::numeric_limits<uint32_t>::max();
+    uint32_t bestY = 0;
+    for (std::size_t i = 0; i < m_skyline.size(); ++i)
+    {
+      const std::optional<uint32_t> y = TryFit(i, width, height);
+      if (y.has_value())
+      {
+        const uint32_t bottom = y.value() + height;
+        if (bottom < bestBottom || (bottom == bestBottom && m_skyline[i].Width < bestWidth))
+        {
+          bestIndex = i;
+          bestBottom = bottom;
+          bestWidth = m_skyline[i].Width;
+          bestY = y.value();
+        }
+      }
+    }
+    if (bestIndex >= m_skyline.size())
+    {
+      return {};
+    }
+
+    const uint32_t x = m_skyline[bestIndex].X;
+    AddSkylineLevel(bestIndex, x, bestY, width, height);
+    m_usedAreaPx += static_cast<uint64_t>(width) * height;
+    return PxRectangleU32::Create(x, bestY, width, height);
+  }
+
+
+  std::optional<uint32_t> SkylineBinPacker::TryFit(const std::size_t segmentIndex, const uint32_t width, const uint32_t height) const noexcept
+  {
+    const uint32_t x = m_skyline[segmentIndex].X;
+    if (width > (m_extentPx.Width.Value - x))
+    {
+      return {};
+    }
+    uint32_t y = 0;
+    uint32_t widthLeft = width;
+    std::size_t index = segmentIndex;
+    while (widthLeft > 0u)
+    {
+      // The skyline always covers the full width so we can not run out of segments before the width is consumed
+      const Segment& segment = m_skyline[index];
+      y = std::max(y, segment.Y);
+      if (height > (m_extentPx.Height.Value - y))
+      {
+        return {};
+      }
+      widthLeft -= std::min(widthLeft, segment.Width);
+      ++index;
+    }
+    return y;
+  }
+
+
+  void SkylineBinPacker::AddSkylineLevel(const std::size_t segmentIndex, const uint32_t x, const uint32_t y, const uint32_t width,
+                                         const uint32_t height)
+  {
+    m_skyline.insert(m_skyline.begin() + static_cast<std::ptrdiff_t>(segmentIndex), Segment(x, y + height, width));
+
+    // Shrink or remove the segments that are now covered by the new one
+    const uint32_t newRight = x + width;
+    std::size_t index = segmentIndex + 1;
+    while (index < m_skyline.size())
+    {
+      Segment& rSegment = m_skyline[index];
+      if (rSegment.X >= newRight)
+      {
+        break;
+      }
+      const uint32_t segmentRight = rSegment.X + rSegment.Width;
+      if (segmentRight <= newRight)
+      {
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(index));
+      }
+      else
+      {
+        rSegment.Width = segmentRight - newRight;
+        rSegment.X = newRight;
+        break;
+      }
+    }
+
+    // Merge neighbouring segments at the same height
+    std::size_t i = (segmentIndex > 0u ? segmentIndex - 1u : 0u);
+    const std::size_t end = std::min(segmentIndex + 2u, m_skyline.size());
+    std::size_t mergeEnd = end;
+    while ((i + 1u) < mergeEnd)
+    {
+      if (m_skyline[i].Y == m_skyline[i + 1u].Y)
+      {
+        m_skyline[i].Width += m_skyline[i + 1u].Width;
+        m_skyline.erase(m_skyline.begin() + static_cast<std::ptrdiff_t>(i + 1u));
+        --mergeEnd;
+      }
+      else
+      {
+        ++i;
+      }
+    }
+  }
+}
@@ -0,0 +1,247 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics2D/Physics/VerletSolver2D.hpp>
+#include <cmath>
+#include <set>
+#include <stdexcept>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_VerletSolver2D = TestFixtureFslBase;
+
+  constexpr Rect TestBounds(0.0f, 0.0f, 1000.0f, 1000.0f);
+
+  VerletSolver2DConfig CreateConfig(const Vector2& gravity, const bool enableCollisions)
+  {
+    return {gravity, 1.0f, 0.5f, 1.0f, 3, enableCollisions};
+  }
+
+  // A cloth like grid of particles connected to their right and lower neighbors, the top row is pinned
+  void AddCloth(VerletSolver2D& rSolver, const uint32_t countX, const uint32_t countY, const float spacing)
+  {
+    const uint32_t firstIndex = rSolver.GetParticleCount();
+    for (uint32_t y = 0; y < countY; ++y)
+    {
+      for (uint32_t x = 0; x < countX; ++x)
+      {
+        const Vector2 position(100.0f + (static_cast<float>(x) * spacing), 100.0f + (static_cast<float>(y) * spacing));
+        rSolver.AddParticle(position, position, y == 0u ? 0.0f : 1.0f);
+      }
+    }
+    for (uint32_t y = 0; y < countY; ++y)
+    {
+      for (uint32_t x = 0; x < countX; ++x)
+      {
+        const uint32_t index = firstIndex + (y * countX) + x;
+        if ((x + 1u) < countX)
+        {
+          rSolver.AddStick(index, index + 1u);
+        }
+        if ((y + 1u) < countY)
+        {
+          rSolver.AddStick(index, index + countX);
+        }
+      }
+    }
+  }
+}
+
+
+TEST(Test_VerletSolver2D, Construct)
+{
+  const VerletSolver2D solver(TestBounds, VerletSolver2DConfig());
+
+  EXPECT_EQ(TestBounds, solver.GetBounds());
+  EXPECT_EQ(0u, solver.GetParticleCount());
+  EXPECT_EQ(0u, solver.GetStickCount());
+}
+
+
+TEST(Test_VerletSolver2D, Construct_InvalidRadius)
+{
+  VerletSolver2DConfig config;
+  config.ParticleRadius = 0.0f;
+  EXPECT_THROW(VerletSolver2D(TestBounds, config), std::invalid_argument);
+}
+
+
+TEST(Test_VerletSolver2D, AddStick_Invalid)
+{
+  VerletSolver2D solver(TestBounds, VerletSolver2DConfig());
+  const uint32_t index = solver.AddParticle(Vector2(1.0f, 1.0f), Vector2(1.0f, 1.0f));
+
+  EXPECT_THROW(solver.AddStick(index, index), std::invalid_argument);
+  EXPECT_THROW(solver.AddStick(index, index + 1u), std::invalid_argument);
+}
+
+
+TEST(Test_VerletSolver2D, Update_Integrate)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(0.0f, 0.5f), false));
+  const uint32_t moving = solver.AddParticle(Vector2(100.0f, 100.0f), Vector2(98.0f, 100.0f));
+  const uint32_t pinned = solver.AddParticle(Vector2(200.0f, 100.0f), Vector2(198.0f, 100.0f), 0.0f);
+
+  solver.Update();
+
+  EXPECT_FLOAT_EQ(102.0f, solver.GetPosition(moving).X);
+  EXPECT_FLOAT_EQ(100.5f, solver.GetPosition(moving).Y);
+  EXPECT_EQ(Vector2(200.0f, 100.0f), solver.GetPosition(pinned));
+}
+
+
+TEST(Test_VerletSolver2D, Update_ConstrainToBounds)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(), false));
+  const uint32_t index = solver.AddParticle(Vector2(998.0f, 500.0f), Vector2(990.0f, 500.0f));
+
+  solver.Update();
+
+  // The particle is stopped one radius from the edge and its velocity is reversed and scaled by the bounce
+  EXPECT_FLOAT_EQ(999.0f, solver.GetPosition(index).X);
+  solver.Update();
+  EXPECT_FLOAT_EQ(995.0f, solver.GetPosition(index).X);
+}
+
+
+TEST(Test_VerletSolver2D, Update_Stick)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(), false));
+  const uint32_t index0 = solver.AddParticle(Vector2(100.0f, 100.0f), Vector2(100.0f, 100.0f));
+  const uint32_t index1 = solver.AddParticle(Vector2(104.0f, 100.0f), Vector2(104.0f, 100.0f));
+  solver.AddStick(index0, index1, 10.0f);
+
+  solver.Update();
+
+  EXPECT_FLOAT_EQ(97.0f, solver.GetPosition(index0).X);
+  EXPECT_FLOAT_EQ(107.0f, solver.GetPosition(index1).X);
+}
+
+
+TEST(Test_VerletSolver2D, Update_Stick_Pinned)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(), false));
+  const uint32_t index0 = solver.AddParticle(Vector2(100.0f, 100.0f), Vector2(100.0f, 100.0f), 0.0f);
+  const uint32_t index1 = solver.AddParticle(Vector2(104.0f, 100.0f), Vector2(104.0f, 100.0f));
+  solver.AddStick(index0, index1, 10.0f);
+
+  solver.Update();
+
+  EXPECT_FLOAT_EQ(100.0f, solver.GetPosition(index0).X);
+  EXPECT_FLOAT_EQ(110.0f, solver.GetPosition(index1).X);
+}
+
+
+TEST(Test_VerletSolver2D, Update_StickBatchesShareNoParticles)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(0.0f, 0.5f), false));
+  AddCloth(solver, 20, 10, 5.0f);
+  solver.Update();
+
+  ASSERT_GT(solver.GetStickBatchCount(), 1u);
+  const auto index0 = solver.GetStickIndex0();
+  const auto index1 = solver.GetStickIndex1();
+  uint32_t totalSticks = 0;
+  for (uint32_t batchIndex = 0; batchIndex < solver.GetStickBatchCount(); ++batchIndex)
+  {
+    uint32_t start = 0;
+    uint32_t end = 0;
+    solver.GetStickBatchRange(batchIndex, start, end);
+    std::set<uint32_t> usedParticles;
+    for (uint32_t i = start; i < end; ++i)
+    {
+      EXPECT_TRUE(usedParticles.insert(index0[i]).second);
+      EXPECT_TRUE(usedParticles.insert(index1[i]).second);
+    }
+    totalSticks += end - start;
+  }
+  EXPECT_EQ(solver.GetStickCount(), totalSticks);
+}
+
+
+TEST(Test_VerletSolver2D, Update_Collision)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(), true));
+  const uint32_t index0 = solver.AddParticle(Vector2(100.0f, 100.0f), Vector2(100.0f, 100.0f));
+  const uint32_t index1 = solver.AddParticle(Vector2(101.0f, 100.0f), Vector2(101.0f, 100.0f));
+  const uint32_t farAway = solver.AddParticle(Vector2(500.0f, 500.0f), Vector2(500.0f, 500.0f));
+
+  solver.Update();
+
+  // The particles are pushed apart until they just touch (two radii)
+  EXPECT_FLOAT_EQ(2.0f, Vector2::Distance(solver.GetPosition(index0), solver.GetPosition(index1)));
+  EXPECT_FLOAT_EQ(100.5f, (solver.GetPosition(index0).X + solver.GetPosition(index1).X) * 0.5f);
+  EXPECT_EQ(Vector2(500.0f, 500.0f), solver.GetPosition(farAway));
+}
+
+
+TEST(Test_VerletSolver2D, Update_Collision_Disabled)
+{
+  VerletSolver2D solver(TestBounds, CreateConfig(Vector2(), false));
+  const uint32_t index0 = solver.AddParticle(Vector2(100.0f, 100.0f), Vector2(100.0f, 100.0f));
+  const uint32_t index1 = solver.AddParticle(Vector2(101.0f, 100.0f), Vector2(101.0f, 100.0f));
+
+  solver.Update();
+
+  EXPECT_FLOAT_EQ(1.0f, Vector2::Distance(solver.GetPosition(index0), solver.GetPosition(index1)));
+}
+
+
+TEST(Test_VerletSolver2D, Update_WorkerPool_MatchesSingleThreaded)
+{
+  WorkerThreadPool pool(3);
+  VerletSolver2D solver1(TestBounds, CreateConfig(Vector2(0.0f, 0.5f), true));
+  VerletSolver2D solver2(TestBounds, CreateConfig(Vector2(0.0f, 0.5f), true));
+  AddCloth(solver1, 200, 100, 3.0f);
+  AddCloth(solver2, 200, 100, 3.0f);
+
+  for (uint32_t i = 0; i < 5; ++i)
+  {
+    solver1.Update();
+    solver2.Update(pool);
+  }
+
+  const auto positionX1 = solver1.GetPositionX();
+  const auto positionY1 = solver1.GetPositionY();
+  const auto positionX2 = solver2.GetPositionX();
+  const auto positionY2 = solver2.GetPositionY();
+  ASSERT_EQ(positionX1.size(), positionX2.size());
+  for (std::size_t i = 0; i < positionX1.size(); ++i)
+  {
+    ASSERT_EQ(positionX1[i], positionX2[i]);
+    ASSERT_EQ(positionY1[i], positionY2[i]);
+  }
+}
@@ -0,0 +1,187 @@
+#ifndef FSLGRAPHICS2D_PHYSICS_VERLETSOLVER2D_HPP
+#define FSLGRAPHICS2D_PHYSICS_VERLETSOLVER2D_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Rect.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics2D/Physics/VerletSolver2DConfig.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  class WorkerThreadPool;
+
+  //! @brief Position based Verlet solver for particles connected by sticks.
+  //!        - Particles and sticks are stored as a structure of arrays.
+  //!        - Sticks are graph colored into batches where no two sticks share a particle, so each batch can be solved in parallel.
+  //!        - Particle-particle collisions are found with a uniform spatial hash grid and resolved Jacobi style
+  //!          (every particle accumulates its own correction), so they can be solved in parallel too.
+  //!        - Given the same input the single threaded and the WorkerThreadPool update produce identical results.
+  class VerletSolver2D
+  {
+    Rect m_bounds;
+    VerletSolver2DConfig m_config;
+
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_oldPositionX;
+    std::vector<float> m_oldPositionY;
+    std::vector<float> m_invMass;
+    std::vector<float> m_correctionX;
+    std::vector<float> m_correctionY;
+
+    std::vector<uint32_t> m_stickIndex0;
+    std::vector<uint32_t> m_stickIndex1;
+    std::vector<float> m_stickLength;
+    //! The end offset of each stick batch, the sticks inside a batch share no particles
+    std::vector<uint32_t> m_stickBatchEnd;
+    //! The first batch index that has to be solved serially (its sticks could not be colored)
+    uint32_t m_serialStickBatch{0};
+    bool m_sticksDirty{false};
+
+    struct Grid
+    {
+      float CellSize{0.0f};
+      float InvCellSize{0.0f};
+      uint32_t CellCountX{0};
+      uint32_t CellCountY{0};
+      //! CellStart[cell] to CellStart[cell+1] is the range inside Particles that belongs to the cell
+      std::vector<uint32_t> CellStart;
+      std::vector<uint32_t> Particles;
+      std::vector<uint32_t> ParticleCell;
+    };
+    Grid m_grid;
+
+  public:
+    VerletSolver2D(const Rect& bounds, const VerletSolver2DConfig& config);
+
+    const Rect& GetBounds() const noexcept
+    {
+      return m_bounds;
+    }
+
+    void SetBounds(const Rect& bounds);
+
+    const VerletSolver2DConfig& GetConfig() const noexcept
+    {
+      return m_config;
+    }
+
+    void SetConfig(const VerletSolver2DConfig& config);
+
+    uint32_t GetParticleCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_positionX.size());
+    }
+
+    uint32_t GetStickCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_stickLength.size());
+    }
+
+    //! @brief Get the number of stick batches (only valid after a update)
+    uint32_t GetStickBatchCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_stickBatchEnd.size());
+    }
+
+    void Reserve(const uint32_t particleCapacity, const uint32_t stickCapacity);
+
+    //! @brief Add a particle that starts with the velocity 'position - oldPosition'.
+    //! @param invMass the inverse mass of the particle, zero pins the particle in place.
+    //! @return the particle index.
+    uint32_t AddParticle(const Vector2& position, const Vector2& oldPosition, const float invMass = 1.0f);
+
+    //! @brief Add a stick that keeps the two particles at their current distance.
+    //! @note  The sticks are reordered when they are batched, so stick indices are not stable.
+    void AddStick(const uint32_t particleIndex0, const uint32_t particleIndex1);
+    void AddStick(const uint32_t particleIndex0, const uint32_t particleIndex1, const float length);
+
+    void Clear() noexcept;
+
+    //! @brief Advance the simulation one step
+    void Update();
+    void Update(WorkerThreadPool& rWorkerPool);
+
+    Vector2 GetPosition(const uint32_t particleIndex) const
+    {
+      return {m_positionX.at(particleIndex), m_positionY.at(particleIndex)};
+    }
+
+    void SetPosition(const uint32_t particleIndex, const Vector2& position, const Vector2& oldPosition);
+
+    ReadOnlySpan<float> GetPositionX() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_positionX);
+    }
+
+    ReadOnlySpan<float> GetPositionY() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_positionY);
+    }
+
+    ReadOnlySpan<uint32_t> GetStickIndex0() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_stickIndex0);
+    }
+
+    ReadOnlySpan<uint32_t> GetStickIndex1() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_stickIndex1);
+    }
+
+    ReadOnlySpan<float> GetStickLength() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_stickLength);
+    }
+
+    //! @brief Get the sticks of the given batch as a index range into the stick arrays
+    void GetStickBatchRange(const uint32_t batchIndex, uint32_t& rStart, uint32_t& rEnd) const;
+
+  private:
+    void DoUpdate(WorkerThreadPool* const pWorkerPool);
+    void RebuildStickBatches();
+    void RebuildGridLayout();
+    void BuildGrid(WorkerThreadPool* const pWorkerPool);
+    void Integrate(const std::size_t begin, const std::size_t end) noexcept;
+    void SolveSticks(const std::size_t begin, const std::size_t end) noexcept;
+    void CalculateCollisionCorrections(const std::size_t begin, const std::size_t end) noexcept;
+    void ApplyCorrections(const std::size_t begin, const std::size_t end) noexcept;
+    void ConstrainToBounds(const std::size_t begin, const std::size_t end) noexcept;
+    void CalculateParticleCells(const std::size_t begin, const std::size_t end) noexcept;
+  };
+}
+
+#endif
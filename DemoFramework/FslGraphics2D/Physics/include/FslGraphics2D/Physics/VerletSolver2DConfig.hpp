@@ -0,0 +1,68 @@
+#ifndef FSLGRAPHICS2D_PHYSICS_VERLETSOLVER2DCONFIG_HPP
+#define FSLGRAPHICS2D_PHYSICS_VERLETSOLVER2DCONFIG_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Vector2.hpp>
+
+namespace Fsl
+{
+  struct VerletSolver2DConfig
+  {
+    //! The gravity displacement added to every movable particle each step
+    Vector2 Gravity{0.0f, 0.5f};
+    //! The velocity multiplier applied each step
+    float Friction{0.999f};
+    //! The fraction of the velocity kept when a particle bounces of the bounds
+    float Bounce{0.9f};
+    //! The radius of all particles, used for the bounds and particle-particle collisions
+    float ParticleRadius{1.0f};
+    //! The number of constraint relaxation iterations per step
+    uint32_t Iterations{3};
+    bool EnableCollisions{true};
+
+    constexpr VerletSolver2DConfig() noexcept = default;
+
+    constexpr VerletSolver2DConfig(const Vector2& gravity, const float friction, const float bounce, const float particleRadius,
+                                   const uint32_t iterations, const bool enableCollisions) noexcept
+      : Gravity(gravity)
+      , Friction(friction)
+      , Bounce(bounce)
+      , ParticleRadius(particleRadius)
+      , Iterations(iterations)
+      , EnableCollisions(enableCollisions)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,607 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics2D/Physics/VerletSolver2D.hpp>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The smallest amount of work worth handing to another thread
+      constexpr std::size_t MinParticleChunkSize = 8 * 1024;
+      constexpr std::size_t MinStickChunkSize = 8 * 1024;
+      constexpr std::size_t MinCollisionChunkSize = 2 * 1024;
+
+      //! Sticks that can not be given one of these colors end up in a final batch that is solved serially
+      constexpr uint32_t MaxStickColors = 63;
+
+      //! The cell size is grown until the grid covering the bounds fits inside this many cells
+      constexpr uint64_t MaxGridCells = 4 * 1024 * 1024;
+    }
+
+    template <typename TFunc>
+    void ForEachChunk(WorkerThreadPool* const pWorkerPool, const std::size_t count, const std::size_t minChunkSize, TFunc&& func)
+    {
+      if (pWorkerPool != nullptr)
+      {
+        pWorkerPool->ParallelFor(count, minChunkSize, std::forward<TFunc>(func));
+      }
+      else if (count > 0u)
+      {
+        func(std::size_t(0u), count);
+      }
+    }
+
+    void ValidateConfig(const VerletSolver2DConfig& config)
+    {
+      if (!(config.ParticleRadius > 0.0f))
+      {
+        throw std::invalid_argument("ParticleRadius must be > 0");
+      }
+    }
+
+    uint32_t ToCellCount(const float size, const float cellSize)
+    {
+      return std::max(static_cast<uint32_t>(std::ceil(size / cellSize)), 1u);
+    }
+  }
+
+
+  VerletSolver2D::VerletSolver2D(const Rect& bounds, const VerletSolver2DConfig& config)
+    : m_bounds(bounds)
+    , m_config(config)
+  {
+    ValidateConfig(config);
+    RebuildGridLayout();
+  }
+
+
+  void VerletSolver2D::SetBounds(const Rect& bounds)
+  {
+    if (bounds != m_bounds)
+    {
+      m_bounds = bounds;
+      RebuildGridLayout();
+    }
+  }
+
+
+  void VerletSolver2D::SetConfig(const VerletSolver2DConfig& config)
+  {
+    ValidateConfig(config);
+    const bool radiusChanged = config.ParticleRadius != m_config.ParticleRadius;
+    m_config = config;
+    if (radiusChanged)
+    {
+      RebuildGridLayout();
+    }
+  }
+
+
+  void VerletSolver2D::Reserve(const uint32_t particleCapacity, const uint32_t stickCapacity)
+  {
+    m_positionX.reserve(particleCapacity);
+    m_positionY.reserve(particleCapacity);
+    m_oldPositionX.reserve(particleCapacity);
+    m_oldPositionY.reserve(particleCapacity);
+    m_invMass.reserve(particleCapacity);
+    m_correctionX.reserve(particleCapacity);
+    m_correctionY.reserve(particleCapacity);
+    m_grid.Particles.reserve(particleCapacity);
+    m_grid.ParticleCell.reserve(particleCapacity);
+
+    m_stickIndex0.reserve(stickCapacity);
+    m_stickIndex1.reserve(stickCapacity);
+    m_stickLength.reserve(stickCapacity);
+  }
+
+
+  uint32_t VerletSolver2D::AddParticle(const Vector2& position, const Vector2& oldPosition, const float invMass)
+  {
+    if (invMass < 0.0f)
+    {
+      throw std::invalid_argument("invMass can not be negative");
+    }
+    const auto index = static_cast<uint32_t>(m_positionX.size());
+    m_positionX.push_back(position.X);
+    m_positionY.push_back(position.Y);
+    m_oldPositionX.push_back(oldPosition.X);
+    m_oldPositionY.push_back(oldPosition.Y);
+    m_invMass.push_back(invMass);
+    m_correctionX.push_back(0.0f);
+    m_correctionY.push_back(0.0f);
+    return index;
+  }
+
+
+  void VerletSolver2D::AddStick(const uint32_t particleIndex0, const uint32_t particleIndex1)
+  {
+    if (particleIndex0 >= m_positionX.size() || particleIndex1 >= m_positionX.size())
+    {
+      throw std::invalid_argument("particle index out of bounds");
+    }
+    AddStick(particleIndex0, particleIndex1, Vector2::Distance(GetPosition(particleIndex0), GetPosition(particleIndex1)));
+  }
+
+
+  void VerletSolver2D::AddStick(const uint32_t particleIndex0, const uint32_t particleIndex1, const float length)
+  {
+    if (particleIndex0 >= m_positionX.size() || particleIndex1 >= m_positionX.size())
+    {
+      throw std::invalid_argument("particle index out of bounds");
+    }
+    if (particleIndex0 == particleIndex1)
+    {
+      throw std::invalid_argument("a stick needs two different particles");
+    }
+    m_stickIndex0.push_back(particleIndex0);
+    m_stickIndex1.push_back(particleIndex1);
+    m_stickLength.push_back(length);
+    m_sticksDirty = true;
+  }
+
+
+  void VerletSolver2D::Clear() noexcept
+  {
+    m_positionX.clear();
+    m_positionY.clear();
+    m_oldPositionX.clear();
+    m_oldPositionY.clear();
+    m_invMass.clear();
+    m_correctionX.clear();
+    m_correctionY.clear();
+    m_stickIndex0.clear();
+    m_stickIndex1.clear();
+    m_stickLength.clear();
+    m_stickBatchEnd.clear();
+    m_serialStickBatch = 0;
+    m_sticksDirty = false;
+  }
+
+
+  void VerletSolver2D::Update()
+  {
+    DoUpdate(nullptr);
+  }
+
+
+  void VerletSolver2D::Update(WorkerThreadPool& rWorkerPool)
+  {
+    DoUpdate(&rWorkerPool);
+  }
+
+
+  void VerletSolver2D::SetPosition(const uint32_t particleIndex, const Vector2& position, const Vector2& oldPosition)
+  {
+    if (particleIndex >= m_positionX.size())
+    {
+      throw std::invalid_argument("particle index out of bounds");
+    }
+    m_positionX[particleIndex] = position.X;
+    m_positionY[particleIndex] = position.Y;
+    m_oldPositionX[particleIndex] = oldPosition.X;
+    m_oldPositionY[particleIndex] = oldPosition.Y;
+  }
+
+
+  void VerletSolver2D::GetStickBatchRange(const uint32_t batchIndex, uint32_t& rStart, uint32_t& rEnd) const
+  {
+    rEnd = m_stickBatchEnd.at(batchIndex);
+    rStart = batchIndex > 0u ? m_stickBatchEnd[batchIndex - 1u] : 0u;
+  }
+
+
+  void VerletSolver2D::DoUpdate(WorkerThreadPool* const pWorkerPool)
+  {
+    if (m_sticksDirty)
+    {
+      RebuildStickBatches();
+    }
+
+    const std::size_t particleCount = m_positionX.size();
+    ForEachChunk(pWorkerPool, particleCount, LocalConfig::MinParticleChunkSize,
+                 [this](const std::size_t begin, const std::size_t end) { Integrate(begin, end); });
+
+    // The grid is built once per step, the particles only move a fraction of a cell during the relaxation iterations
+    const bool enableCollisions = m_config.EnableCollisions && particleCount > 1u;
+    if (enableCollisions)
+    {
+      BuildGrid(pWorkerPool);
+    }
+
+    for (uint32_t iteration = 0; iteration < m_config.Iterations; ++iteration)
+    {
+      uint32_t batchStart = 0;
+      for (uint32_t batchIndex = 0; batchIndex < m_stickBatchEnd.size(); ++batchIndex)
+      {
+        const uint32_t batchEnd = m_stickBatchEnd[batchIndex];
+        if (batchIndex < m_serialStickBatch)
+        {
+          ForEachChunk(pWorkerPool, batchEnd - batchStart, LocalConfig::MinStickChunkSize,
+                       [this, batchStart](const std::size_t begin, const std::size_t end) { SolveSticks(batchStart + begin, batchStart + end); });
+        }
+        else
+        {
+          SolveSticks(batchStart, batchEnd);
+        }
+        batchStart = batchEnd;
+      }
+
+      if (enableCollisions)
+      {
+        ForEachChunk(pWorkerPool, particleCount, LocalConfig::MinCollisionChunkSize,
+                     [this](const std::size_t begin, const std::size_t end) { CalculateCollisionCorrections(begin, end); });
+        ForEachChunk(pWorkerPool, particleCount, LocalConfig::MinParticleChunkSize,
+                     [this](const std::size_t begin, const std::size_t end)
+                     {
+                       ApplyCorrections(begin, end);
+                       ConstrainToBounds(begin, end);
+                     });
+      }
+      else
+      {
+        ForEachChunk(pWorkerPool, particleCount, LocalConfig::MinParticleChunkSize,
+                     [this](const std::size_t begin, const std::size_t end) { ConstrainToBounds(begin, end); });
+      }
+    }
+  }
+
+
+  void VerletSolver2D::RebuildStickBatches()
+  {
+    // Greedy graph coloring, each stick gets the lowest color that none of its particles has been given yet.
+    const std::size_t stickCount = m_stickLength.size();
+    std::vector<uint64_t> particleColors(m_positionX.size(), 0u);
+    std::vector<uint8_t> stickColors(stickCount);
+    std::vector<uint32_t> colorOffsets(LocalConfig::MaxStickColors + 2u, 0u);
+    for (std::size_t i = 0; i < stickCount; ++i)
+    {
+      uint64_t& rColors0 = particleColors[m_stickIndex0[i]];
+      uint64_t& rColors1 = particleColors[m_stickIndex1[i]];
+      const auto color = std::min(static_cast<uint32_t>(std::countr_one(rColors0 | rColors1)), LocalConfig::MaxStickColors);
+      if (color < LocalConfig::MaxStickColors)
+      {
+        const uint64_t colorBit = uint64_t(1u) << color;
+        rColors0 |= colorBit;
+        rColors1 |= colorBit;
+      }
+      stickColors[i] = static_cast<uint8_t>(color);
+      ++colorOffsets[color + 1u];
+    }
+
+    // Sort the sticks by color (counting sort)
+    for (std::size_t i = 1; i < colorOffsets.size(); ++i)
+    {
+      colorOffsets[i] += colorOffsets[i - 1];
+    }
+
+    m_stickBatchEnd.clear();
+    m_serialStickBatch = 0;
+    for (uint32_t color = 0; color <= LocalConfig::MaxStickColors; ++color)
+    {
+      if (colorOffsets[color + 1u] > colorOffsets[color])
+      {
+        if (color == LocalConfig::MaxStickColors)
+        {
+          m_serialStickBatch = static_cast<uint32_t>(m_stickBatchEnd.size());
+        }
+        m_stickBatchEnd.push_back(colorOffsets[color + 1u]);
+      }
+    }
+    if (colorOffsets[LocalConfig::MaxStickColors + 1u] == colorOffsets[LocalConfig::MaxStickColors])
+    {
+      m_serialStickBatch = static_cast<uint32_t>(m_stickBatchEnd.size());
+    }
+
+    std::vector<uint32_t> index0(stickCount);
+    std::vector<uint32_t> index1(stickCount);
+    std::vector<float> length(stickCount);
+    for (std::size_t i = 0; i < stickCount; ++i)
+    {
+      const uint32_t dstIndex = colorOffsets[stickColors[i]]++;
+      index0[dstIndex] = m_stickIndex0[i];
+      index1[dstIndex] = m_stickIndex1[i];
+      length[dstIndex] = m_stickLength[i];
+    }
+    m_stickIndex0 = std::move(index0);
+    m_stickIndex1 = std::move(index1);
+    m_stickLength = std::move(length);
+    m_sticksDirty = false;
+  }
+
+
+  void VerletSolver2D::RebuildGridLayout()
+  {
+    // Two particles can only touch if they are in the same or neighboring cells as long as the cells are at least one diameter wide
+    float cellSize = m_config.ParticleRadius * 2.0f;
+    const float width = std::max(m_bounds.Width(), 0.0f);
+    const float height = std::max(m_bounds.Height(), 0.0f);
+    while ((static_cast<uint64_t>(ToCellCount(width, cellSize)) * ToCellCount(height, cellSize)) > LocalConfig::MaxGridCells)
+    {
+      cellSize *= 2.0f;
+    }
+    m_grid.CellSize = cellSize;
+    m_grid.InvCellSize = 1.0f / cellSize;
+    m_grid.CellCountX = ToCellCount(width, cellSize);
+    m_grid.CellCountY = ToCellCount(height, cellSize);
+    m_grid.CellStart.resize((static_cast<std::size_t>(m_grid.CellCountX) * m_grid.CellCountY) + 1u);
+  }
+
+
+  void VerletSolver2D::BuildGrid(WorkerThreadPool* const pWorkerPool)
+  {
+    const std::size_t particleCount = m_positionX.size();
+    m_grid.ParticleCell.resize(particleCount);
+    m_grid.Particles.resize(particleCount);
+
+    ForEachChunk(pWorkerPool, particleCount, LocalConfig::MinParticleChunkSize,
+                 [this](const std::size_t begin, const std::size_t end) { CalculateParticleCells(begin, end); });
+
+    // Counting sort of the particles by cell, the particles inside a cell stay in index order
+    std::fill(m_grid.CellStart.begin(), m_grid.CellStart.end(), 0u);
+    uint32_t* const pCellStart = m_grid.CellStart.data();
+    const uint32_t* const pParticleCell = m_grid.ParticleCell.data();
+    for (std::size_t i = 0; i < particleCount; ++i)
+    {
+      ++pCellStart[pParticleCell[i] + 1u];
+    }
+    const std::size_t cellCount = m_grid.CellStart.size() - 1u;
+    for (std::size_t i = 1; i <= cellCount; ++i)
+    {
+      pCellStart[i] += pCellStart[i - 1];
+    }
+    uint32_t* const pParticles = m_grid.Particles.data();
+    for (std::size_t i = 0; i < particleCount; ++i)
+    {
+      pParticles[pCellStart[pParticleCell[i]]++] = static_cast<uint32_t>(i);
+    }
+    // The scatter advanced every start to the start of the next cell, so shift them back
+    for (std::size_t i = cellCount; i > 0; --i)
+    {
+      pCellStart[i] = pCellStart[i - 1];
+    }
+    pCellStart[0] = 0;
+  }
+
+
+  void VerletSolver2D::Integrate(const std::size_t begin, const std::size_t end) noexcept
+  {
+    const float friction = m_config.Friction;
+    const float gravityX = m_config.Gravity.X;
+    const float gravityY = m_config.Gravity.Y;
+    const float* const pInvMass = m_invMass.data();
+    {
+      float* const pPosition = m_positionX.data();
+      float* const pOldPosition = m_oldPositionX.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const float movable = pInvMass[i] > 0.0f ? 1.0f : 0.0f;
+        const float velocity = (pPosition[i] - pOldPosition[i]) * friction;
+        pOldPosition[i] = pPosition[i];
+        pPosition[i] += (velocity + gravityX) * movable;
+      }
+    }
+    {
+      float* const pPosition = m_positionY.data();
+      float* const pOldPosition = m_oldPositionY.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const float movable = pInvMass[i] > 0.0f ? 1.0f : 0.0f;
+        const float velocity = (pPosition[i] - pOldPosition[i]) * friction;
+        pOldPosition[i] = pPosition[i];
+        pPosition[i] += (velocity + gravityY) * movable;
+      }
+    }
+  }
+
+
+  void VerletSolver2D::SolveSticks(const std::size_t begin, const std::size_t end) noexcept
+  {
+    float* const pPositionX = m_positionX.data();
+    float* const pPositionY = m_positionY.data();
+    const float* const pInvMass = m_invMass.data();
+    const uint32_t* const pIndex0 = m_stickIndex0.data();
+    const uint32_t* const pIndex1 = m_stickIndex1.data();
+    const float* const pLength = m_stickLength.data();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const uint32_t index0 = pIndex0[i];
+      const uint32_t index1 = pIndex1[i];
+      const float deltaX = pPositionX[index1] - pPositionX[index0];
+      const float deltaY = pPositionY[index1] - pPositionY[index0];
+      const float distance = std::sqrt((deltaX * deltaX) + (deltaY * deltaY));
+      const float invMass0 = pInvMass[index0];
+      const float invMass1 = pInvMass[index1];
+      const float invMassSum = invMass0 + invMass1;
+      if (distance > 0.0f && invMassSum > 0.0f)
+      {
+        const float percent = (pLength[i] - distance) / (distance * invMassSum);
+        const float offsetX = deltaX * percent;
+        const float offsetY = deltaY * percent;
+        pPositionX[index0] -= offsetX * invMass0;
+        pPositionY[index0] -= offsetY * invMass0;
+        pPositionX[index1] += offsetX * invMass1;
+        pPositionY[index1] += offsetY * invMass1;
+      }
+    }
+  }
+
+
+  void VerletSolver2D::CalculateCollisionCorrections(const std::size_t begin, const std::size_t end) noexcept
+  {
+    const float minDistance = m_config.ParticleRadius * 2.0f;
+    const float minDistanceSquared = minDistance * minDistance;
+    const float* const pPositionX = m_positionX.data();
+    const float* const pPositionY = m_positionY.data();
+    const float* const pInvMass = m_invMass.data();
+    const uint32_t* const pCellStart = m_grid.CellStart.data();
+    const uint32_t* const pParticles = m_grid.Particles.data();
+    const uint32_t* const pParticleCell = m_grid.ParticleCell.data();
+    const uint32_t cellCountX = m_grid.CellCountX;
+    const uint32_t cellCountY = m_grid.CellCountY;
+    float* const pCorrectionX = m_correctionX.data();
+    float* const pCorrectionY = m_correctionY.data();
+
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      float correctionX = 0.0f;
+      float correctionY = 0.0f;
+      const float invMass = pInvMass[i];
+      if (invMass > 0.0f)
+      {
+        const float positionX = pPositionX[i];
+        const float positionY = pPositionY[i];
+        const uint32_t cellX = pParticleCell[i] % cellCountX;
+        const uint32_t cellY = pParticleCell[i] / cellCountX;
+        const uint32_t startX = cellX > 0u ? cellX - 1u : 0u;
+        const uint32_t startY = cellY > 0u ? cellY - 1u : 0u;
+        const uint32_t endX = std::min(cellX + 2u, cellCountX);
+        const uint32_t endY = std::min(cellY + 2u, cellCountY);
+        for (uint32_t y = startY; y < endY; ++y)
+        {
+          const uint32_t rowOffset = y * cellCountX;
+          const uint32_t entryEnd = pCellStart[rowOffset + endX];
+          // The cells of a row are stored back to back, so the entire row segment is one continuous range
+          for (uint32_t entry = pCellStart[rowOffset + startX]; entry < entryEnd; ++entry)
+          {
+            const uint32_t otherIndex = pParticles[entry];
+            const float deltaX = positionX - pPositionX[otherIndex];
+            const float deltaY = positionY - pPositionY[otherIndex];
+            const float distanceSquared = (deltaX * deltaX) + (deltaY * deltaY);
+            // This also skips the particle itself (distance zero)
+            if (distanceSquared < minDistanceSquared && distanceSquared > 0.0f)
+            {
+              const float distance = std::sqrt(distanceSquared);
+              const float share = invMass / (invMass + pInvMass[otherIndex]);
+              const float scale = ((minDistance - distance) / distance) * share;
+              correctionX += deltaX * scale;
+              correctionY += deltaY * scale;
+            }
+          }
+        }
+      }
+      pCorrectionX[i] = correctionX;
+      pCorrectionY[i] = correctionY;
+    }
+  }
+
+
+  void VerletSolver2D::ApplyCorrections(const std::size_t begin, const std::size_t end) noexcept
+  {
+    float* const pPositionX = m_positionX.data();
+    float* const pPositionY = m_positionY.data();
+    const float* const pCorrectionX = m_correctionX.data();
+    const float* const pCorrectionY = m_correctionY.data();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      pPositionX[i] += pCorrectionX[i];
+      pPositionY[i] += pCorrectionY[i];
+    }
+  }
+
+
+  void VerletSolver2D::ConstrainToBounds(const std::size_t begin, const std::size_t end) noexcept
+  {
+    const float friction = m_config.Friction;
+    const float bounce = m_config.Bounce;
+    const float radius = m_config.ParticleRadius;
+    {
+      const float minValue = std::min(m_bounds.Left() + radius, m_bounds.Left() + (m_bounds.Width() * 0.5f));
+      const float maxValue = std::max(m_bounds.Right() - radius, minValue);
+      float* const pPosition = m_positionX.data();
+      float* const pOldPosition = m_oldPositionX.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const float velocity = (pPosition[i] - pOldPosition[i]) * friction;
+        if (pPosition[i] > maxValue)
+        {
+          pPosition[i] = maxValue;
+          pOldPosition[i] = maxValue + (velocity * bounce);
+        }
+        else if (pPosition[i] < minValue)
+        {
+          pPosition[i] = minValue;
+          pOldPosition[i] = minValue + (velocity * bounce);
+        }
+      }
+    }
+    {
+      const float minValue = std::min(m_bounds.Top() + radius, m_bounds.Top() + (m_bounds.Height() * 0.5f));
+      const float maxValue = std::max(m_bounds.Bottom() - radius, minValue);
+      float* const pPosition = m_positionY.data();
+      float* const pOldPosition = m_oldPositionY.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        const float velocity = (pPosition[i] - pOldPosition[i]) * friction;
+        if (pPosition[i] > maxValue)
+        {
+          pPosition[i] = maxValue;
+          pOldPosition[i] = maxValue + (velocity * bounce);
+        }
+        else if (pPosition[i] < minValue)
+        {
+          pPosition[i] = minValue;
+          pOldPosition[i] = minValue + (velocity * bounce);
+        }
+      }
+    }
+  }
+
+
+  void VerletSolver2D::CalculateParticleCells(const std::size_t begin, const std::size_t end) noexcept
+  {
+    const float left = m_bounds.Left();
+    const float top = m_bounds.Top();
+    const float invCellSize = m_grid.InvCellSize;
+    const auto maxCellX = static_cast<float>(m_grid.CellCountX - 1u);
+    const auto maxCellY = static_cast<float>(m_grid.CellCountY - 1u);
+    const uint32_t cellCountX = m_grid.CellCountX;
+    const float* const pPositionX = m_positionX.data();
+    const float* const pPositionY = m_positionY.data();
+    uint32_t* const pParticleCell = m_grid.ParticleCell.data();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      // Particles outside the bounds are clamped to the edge cells
+      const auto cellX = static_cast<uint32_t>(std::clamp((pPositionX[i] - left) * invCellSize, 0.0f, maxCellX));
+      const auto cellY = static_cast<uint32_t>(std::clamp((pPositionY[i] - top) * invCellSize, 0.0f, maxCellY));
+      pParticleCell[i] = (cellY * cellCountX) + cellX;
+    }
+  }
+}
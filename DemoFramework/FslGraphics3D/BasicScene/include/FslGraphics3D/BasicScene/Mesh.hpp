@@ -38,9 +38,12 @@
 #include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
 #include <FslGraphics3D/BasicScene/RawMeshContent.hpp>
 #include <FslGraphics3D/BasicScene/RawMeshContentEx.hpp>
+#include <memory>
 
 namespace Fsl::Graphics3D
 {
+  class MeshletData;
+
   class Mesh
   {
     UTF8String m_name;
@@ -49,6 +52,7 @@ namespace Fsl::Graphics3D
     PrimitiveType m_primitiveType;
     uint32_t m_primitiveCount;
     uint32_t m_materialIndex;
+    std::shared_ptr<const MeshletData> m_meshlets;
     bool m_isValid;
 
   public:
@@ -96,6 +100,17 @@ namespace Fsl::Graphics3D
     //! @brief Get the name of this mesh
     void SetName(const UTF8String& name);
 
+    //! @brief Get the meshlets of this mesh (can be null)
+    const std::shared_ptr<const MeshletData>& GetMeshlets() const
+    {
+      return m_meshlets;
+    }
+
+    //! @brief Set the meshlets of this mesh
+    //! @note  The meshlets are not automatically updated when the vertices or indices are modified through GenericDirectAccess,
+    //!        so anyone that modifies them is expected to rebuild or clear the meshlets.
+    void SetMeshlets(const std::shared_ptr<const MeshletData>& meshlets);
+
     virtual void Reset();
     virtual void Reset(const int32_t vertexCount, const int32_t indexCount, const PrimitiveType primitiveType);
     virtual void Reset(const std::size_t vertexCount, const std::size_t indexCount, const PrimitiveType primitiveType);
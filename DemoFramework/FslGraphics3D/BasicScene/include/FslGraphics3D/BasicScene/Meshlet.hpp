@@ -0,0 +1,93 @@
+#ifndef FSLGRAPHICS3D_BASICSCENE_MESHLET_HPP
+#define FSLGRAPHICS3D_BASICSCENE_MESHLET_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingSphere.hpp>
+#include <FslBase/Math/Vector3.hpp>
+
+namespace Fsl::Graphics3D
+{
+  //! @brief A small cluster of triangles from a mesh.
+  //!        The meshlet vertices are stored as indices into the mesh vertex array and the triangles are stored as local (8bit) indices into the
+  //!        meshlet vertices, see MeshletData.
+  struct Meshlet
+  {
+    //! Offset into the MeshletData vertex index array
+    uint32_t VertexOffset{0};
+    //! Offset into the MeshletData triangle index array (in indices, not triangles)
+    uint32_t TriangleOffset{0};
+    //! The number of vertices used by this meshlet
+    uint32_t VertexCount{0};
+    //! The number of triangles in this meshlet
+    uint32_t TriangleCount{0};
+
+    //! A sphere that encloses all vertices in the meshlet
+    BoundingSphere Bounds;
+
+    //! The normal cone apex, all triangles are back facing when viewed from a position inside the negative cone (see ConeCutoff).
+    Vector3 ConeApex;
+    //! The normalized normal cone axis
+    Vector3 ConeAxis;
+    //! The sine of the normal cone half angle, a value of 1 means the cone is degenerate and back face culling can not be applied.
+    //! The meshlet is back facing if dot(normalize(ConeApex - cameraPosition), ConeAxis) >= ConeCutoff
+    float ConeCutoff{1.0f};
+
+    constexpr Meshlet() noexcept = default;
+    constexpr Meshlet(const uint32_t vertexOffset, const uint32_t triangleOffset, const uint32_t vertexCount, const uint32_t triangleCount,
+                      const BoundingSphere& bounds, const Vector3& coneApex, const Vector3& coneAxis, const float coneCutoff) noexcept
+      : VertexOffset(vertexOffset)
+      , TriangleOffset(triangleOffset)
+      , VertexCount(vertexCount)
+      , TriangleCount(triangleCount)
+      , Bounds(bounds)
+      , ConeApex(coneApex)
+      , ConeAxis(coneAxis)
+      , ConeCutoff(coneCutoff)
+    {
+    }
+
+    constexpr bool operator==(const Meshlet& rhs) const noexcept
+    {
+      return VertexOffset == rhs.VertexOffset && TriangleOffset == rhs.TriangleOffset && VertexCount == rhs.VertexCount &&
+             TriangleCount == rhs.TriangleCount && Bounds == rhs.Bounds && ConeApex == rhs.ConeApex && ConeAxis == rhs.ConeAxis &&
+             ConeCutoff == rhs.ConeCutoff;
+    }
+
+    constexpr bool operator!=(const Meshlet& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,115 @@
+#ifndef FSLGRAPHICS3D_BASICSCENE_MESHLETDATA_HPP
+#define FSLGRAPHICS3D_BASICSCENE_MESHLETDATA_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics3D/BasicScene/Meshlet.hpp>
+#include <vector>
+
+namespace Fsl::Graphics3D
+{
+  //! @brief The meshlets of a mesh.
+  //!        - Each meshlet references a range in the vertex index array and a range in the triangle index array.
+  //!        - The vertex index array contains indices into the mesh vertex array.
+  //!        - The triangle index array contains three local indices (relative to the meshlet vertex range) per triangle.
+  class MeshletData
+  {
+    uint32_t m_maxVertices{0};
+    uint32_t m_maxTriangles{0};
+    std::vector<Meshlet> m_meshlets;
+    std::vector<uint32_t> m_vertexIndices;
+    std::vector<uint8_t> m_triangleIndices;
+
+  public:
+    MeshletData() = default;
+    MeshletData(const uint32_t maxVertices, const uint32_t maxTriangles, std::vector<Meshlet> meshlets, std::vector<uint32_t> vertexIndices,
+                std::vector<uint8_t> triangleIndices);
+
+    //! @brief The max vertices a meshlet was allowed to contain when this was build
+    uint32_t GetMaxVertices() const noexcept
+    {
+      return m_maxVertices;
+    }
+
+    //! @brief The max triangles a meshlet was allowed to contain when this was build
+    uint32_t GetMaxTriangles() const noexcept
+    {
+      return m_maxTriangles;
+    }
+
+    bool Empty() const noexcept
+    {
+      return m_meshlets.empty();
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_meshlets.size());
+    }
+
+    const Meshlet& operator[](const uint32_t index) const
+    {
+      return m_meshlets[index];
+    }
+
+    ReadOnlySpan<Meshlet> GetMeshlets() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_meshlets);
+    }
+
+    ReadOnlySpan<uint32_t> GetVertexIndices() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_vertexIndices);
+    }
+
+    ReadOnlySpan<uint8_t> GetTriangleIndices() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_triangleIndices);
+    }
+
+    //! @brief Get the mesh vertex indices used by the given meshlet
+    ReadOnlySpan<uint32_t> GetVertexIndices(const Meshlet& meshlet) const
+    {
+      return GetVertexIndices().subspan(meshlet.VertexOffset, meshlet.VertexCount);
+    }
+
+    //! @brief Get the local triangle indices used by the given meshlet
+    ReadOnlySpan<uint8_t> GetTriangleIndices(const Meshlet& meshlet) const
+    {
+      return GetTriangleIndices().subspan(meshlet.TriangleOffset, meshlet.TriangleCount * 3u);
+    }
+  };
+}
+
+#endif
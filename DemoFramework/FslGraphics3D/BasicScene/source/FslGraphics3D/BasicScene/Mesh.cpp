@@ -32,6 +32,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslGraphics/PrimitiveTypeUtil.hpp>
 #include <FslGraphics3D/BasicScene/Mesh.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
 #include <limits>
 
 namespace Fsl::Graphics3D
@@ -88,6 +89,7 @@ namespace Fsl::Graphics3D
     m_primitiveCount = 0;
     m_name.Clear();
     m_materialIndex = 0;
+    m_meshlets.reset();
     m_isValid = false;
   }
 
@@ -105,6 +107,7 @@ namespace Fsl::Graphics3D
     m_primitiveCount = PrimitiveTypeUtil::CalcPrimitiveCount(m_indexCount, primitiveType);
     m_name.Clear();
     m_materialIndex = 0;
+    m_meshlets.reset();
     m_isValid = true;
   }
 
@@ -122,6 +125,7 @@ namespace Fsl::Graphics3D
     m_primitiveCount = PrimitiveTypeUtil::CalcPrimitiveCount(m_indexCount, primitiveType);
     m_name.Clear();
     m_materialIndex = 0;
+    m_meshlets.reset();
     m_isValid = true;
   }
 
@@ -144,6 +148,12 @@ namespace Fsl::Graphics3D
   }
 
 
+  void Mesh::SetMeshlets(const std::shared_ptr<const MeshletData>& meshlets)
+  {
+    m_meshlets = meshlets;
+  }
+
+
   bool Mesh::IsValid() const
   {
     return m_isValid;
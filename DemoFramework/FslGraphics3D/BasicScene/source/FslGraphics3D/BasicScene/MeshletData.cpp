@@ -0,0 +1,74 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
+#include <utility>
+
+namespace Fsl::Graphics3D
+{
+  MeshletData::MeshletData(const uint32_t maxVertices, const uint32_t maxTriangles, std::vector<Meshlet> meshlets,
+                           std::vector<uint32_t> vertexIndices, std::vector<uint8_t> triangleIndices)
+    : m_maxVertices(maxVertices)
+    , m_maxTriangles(maxTriangles)
+    , m_meshlets(std::move(meshlets))
+    , m_vertexIndices(std::move(vertexIndices))
+    , m_triangleIndices(std::move(triangleIndices))
+  {
+    if (maxVertices > 256u)
+    {
+      throw std::invalid_argument("maxVertices can not exceed 256 as the local triangle indices are 8bit");
+    }
+    for (const Meshlet& meshlet : m_meshlets)
+    {
+      if (meshlet.VertexCount > maxVertices || meshlet.TriangleCount > maxTriangles)
+      {
+        throw std::invalid_argument("meshlet exceeds the max vertex or triangle count");
+      }
+      if (meshlet.VertexOffset > m_vertexIndices.size() || meshlet.VertexCount > (m_vertexIndices.size() - meshlet.VertexOffset))
+      {
+        throw std::invalid_argument("meshlet vertex range is out of bounds");
+      }
+      if (meshlet.TriangleOffset > m_triangleIndices.size() || (meshlet.TriangleCount * 3u) > (m_triangleIndices.size() - meshlet.TriangleOffset))
+      {
+        throw std::invalid_argument("meshlet triangle range is out of bounds");
+      }
+      const std::size_t triangleEnd = meshlet.TriangleOffset + (std::size_t(meshlet.TriangleCount) * 3u);
+      for (std::size_t i = meshlet.TriangleOffset; i < triangleEnd; ++i)
+      {
+        if (m_triangleIndices[i] >= meshlet.VertexCount)
+        {
+          throw std::invalid_argument("meshlet local triangle index is out of bounds");
+        }
+      }
+    }
+  }
+}
@@ -0,0 +1,183 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/MeshAllocator.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodGenerator.hpp>
+#include <cmath>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshLodGenerator = TestFixtureFslBase;
+  using TestMesh = GenericMesh<VertexPositionTexture, uint16_t>;
+
+  //! A closed sphere with the given radius
+  std::shared_ptr<TestMesh> CreateSphere(const uint32_t segments, const uint32_t rings, const float radius)
+  {
+    std::vector<VertexPositionTexture> vertices;
+    vertices.emplace_back(Vector3(0.0f, radius, 0.0f), Vector2());
+    for (uint32_t ring = 1; ring < rings; ++ring)
+    {
+      const float theta = MathHelper::PI * static_cast<float>(ring) / static_cast<float>(rings);
+      for (uint32_t segment = 0; segment < segments; ++segment)
+      {
+        const float phi = MathHelper::RADS360 * static_cast<float>(segment) / static_cast<float>(segments);
+        vertices.emplace_back(Vector3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)) * radius, Vector2());
+      }
+    }
+    vertices.emplace_back(Vector3(0.0f, -radius, 0.0f), Vector2());
+    const auto bottom = static_cast<uint16_t>(vertices.size() - 1);
+
+    const auto ringStart = [segments](const uint32_t ring) { return static_cast<uint16_t>(1 + ((ring - 1) * segments)); };
+    std::vector<uint16_t> indices;
+    for (uint32_t segment = 0; segment < segments; ++segment)
+    {
+      const auto next = static_cast<uint16_t>((segment + 1) % segments);
+      const auto current = static_cast<uint16_t>(segment);
+      indices.insert(indices.end(), {0, static_cast<uint16_t>(ringStart(1) + next), static_cast<uint16_t>(ringStart(1) + current)});
+      indices.insert(indices.end(),
+                     {bottom, static_cast<uint16_t>(ringStart(rings - 1) + current), static_cast<uint16_t>(ringStart(rings - 1) + next)});
+      for (uint32_t ring = 1; ring < (rings - 1); ++ring)
+      {
+        const auto i0 = static_cast<uint16_t>(ringStart(ring) + current);
+        const auto i1 = static_cast<uint16_t>(ringStart(ring) + next);
+        const auto i2 = static_cast<uint16_t>(ringStart(ring + 1) + current);
+        const auto i3 = static_cast<uint16_t>(ringStart(ring + 1) + next);
+        indices.insert(indices.end(), {i0, i1, i2, i1, i3, i2});
+      }
+    }
+    auto mesh = std::make_shared<TestMesh>(vertices, indices, PrimitiveType::TriangleList);
+    mesh->SetName(UTF8String("sphere"));
+    mesh->SetMaterialIndex(3);
+    return mesh;
+  }
+}
+
+
+TEST(Test_MeshLodGenerator, Generate)
+{
+  constexpr float Radius = 10.0f;
+  const auto mesh = CreateSphere(64, 32, Radius);
+  const MeshLodChain chain = MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 4);
+
+  ASSERT_GE(chain.Count(), 3u);
+  EXPECT_LE(chain.Count(), 4u);
+  EXPECT_EQ(mesh, chain.GetMesh(0));
+  EXPECT_EQ(0.0f, chain.GetError(0));
+
+  for (uint32_t level = 1; level < chain.Count(); ++level)
+  {
+    const auto previous = std::dynamic_pointer_cast<TestMesh>(chain.GetMesh(level - 1));
+    const auto current = std::dynamic_pointer_cast<TestMesh>(chain.GetMesh(level));
+    ASSERT_TRUE(current);
+    EXPECT_LT(current->GetIndexCount(), previous->GetIndexCount());
+    EXPECT_LE(current->GetVertexCount(), previous->GetVertexCount());
+    EXPECT_EQ(mesh->GetName(), current->GetName());
+    EXPECT_EQ(mesh->GetMaterialIndex(), current->GetMaterialIndex());
+    EXPECT_GE(chain.GetError(level), chain.GetError(level - 1));
+    // The error is in model space and can not exceed the default max error (relative to the 2 * Radius extent)
+    EXPECT_LE(chain.GetError(level), MeshLodGenerator::DefaultMaxError * 2.0f * Radius * 1.001f);
+
+    // Only the used vertices are kept and they are all on the sphere
+    const auto& vertices = current->GetVertexArray();
+    std::vector<bool> used(vertices.size(), false);
+    for (const uint16_t index : current->GetIndexArray())
+    {
+      ASSERT_LT(index, vertices.size());
+      used[index] = true;
+    }
+    for (std::size_t i = 0; i < vertices.size(); ++i)
+    {
+      EXPECT_TRUE(used[i]);
+      EXPECT_NEAR(Radius, vertices[i].Position.Length(), 0.001f);
+    }
+  }
+}
+
+
+TEST(Test_MeshLodGenerator, Generate_SingleLevel)
+{
+  const auto mesh = CreateSphere(16, 8, 1.0f);
+  const MeshLodChain chain = MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 1);
+  ASSERT_EQ(1u, chain.Count());
+  EXPECT_EQ(mesh, chain.GetMesh(0));
+}
+
+
+TEST(Test_MeshLodGenerator, Generate_ZeroError)
+{
+  // Nothing can be removed from a sphere without introducing an error
+  const auto mesh = CreateSphere(16, 8, 1.0f);
+  const MeshLodChain chain = MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 4, MeshLodGenerator::DefaultReduction, 0.0f);
+  EXPECT_EQ(1u, chain.Count());
+}
+
+
+TEST(Test_MeshLodGenerator, Generate_NotTriangleList)
+{
+  const std::vector<VertexPositionTexture> vertices = {VertexPositionTexture(Vector3(0, 0, 0), Vector2()),
+                                                       VertexPositionTexture(Vector3(1, 0, 0), Vector2())};
+  const std::vector<uint16_t> indices = {0, 1};
+  const auto mesh = std::make_shared<TestMesh>(vertices, indices, PrimitiveType::LineList);
+  const MeshLodChain chain = MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 4);
+  EXPECT_EQ(1u, chain.Count());
+}
+
+
+TEST(Test_MeshLodGenerator, Generate_InvalidArguments)
+{
+  const auto mesh = CreateSphere(16, 8, 1.0f);
+  EXPECT_THROW(MeshLodGenerator::Generate({}, MeshAllocator::Allocate<TestMesh>, 4), std::invalid_argument);
+  EXPECT_THROW(MeshLodGenerator::Generate(mesh, {}, 4), std::invalid_argument);
+  EXPECT_THROW(MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 0), std::invalid_argument);
+  EXPECT_THROW(MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<TestMesh>, 4, 1.0f), std::invalid_argument);
+  // The allocator must produce meshes with the same vertex layout
+  EXPECT_THROW(MeshLodGenerator::Generate(mesh, MeshAllocator::Allocate<GenericMesh<VertexPosition, uint16_t>>, 4), NotSupportedException);
+}
+
+
+TEST(Test_MeshLodGenerator, Chain_InvalidArguments)
+{
+  const auto mesh = CreateSphere(16, 8, 1.0f);
+  EXPECT_THROW(MeshLodChain({mesh}, {}), std::invalid_argument);
+  EXPECT_THROW(MeshLodChain({mesh, nullptr}, {0.0f, 1.0f}), std::invalid_argument);
+  EXPECT_THROW(MeshLodChain({mesh, mesh}, {1.0f, 0.5f}), std::invalid_argument);
+}
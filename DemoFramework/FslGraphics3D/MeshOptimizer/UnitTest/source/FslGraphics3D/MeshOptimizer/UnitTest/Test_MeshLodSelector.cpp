@@ -0,0 +1,123 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodSelector.hpp>
+#include <array>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshLodSelector = TestFixtureFslBase;
+
+  //! With a 90 degree field of view one model space unit at distance one covers half the viewport height
+  constexpr float FovY = MathHelper::ToRadians(90.0f);
+  constexpr float ViewportHeight = 1000.0f;
+}
+
+
+TEST(Test_MeshLodSelector, Construct_Default)
+{
+  const MeshLodSelector selector;
+  const std::array<float, 3> errors = {0.0f, 0.01f, 0.1f};
+
+  EXPECT_EQ(0u, selector.Select(ReadOnlySpan<float>(errors.data(), errors.size()), 100.0f));
+}
+
+
+TEST(Test_MeshLodSelector, CalcScreenError)
+{
+  const MeshLodSelector selector(FovY, ViewportHeight, 1.0f);
+
+  EXPECT_NEAR(500.0f, selector.CalcScreenError(1.0f, 1.0f), 0.01f);
+  EXPECT_NEAR(1.0f, selector.CalcScreenError(0.01f, 5.0f), 0.0001f);
+  EXPECT_EQ(0.0f, selector.CalcScreenError(0.0f, 0.0f));
+}
+
+
+TEST(Test_MeshLodSelector, Select)
+{
+  const MeshLodSelector selector(FovY, ViewportHeight, 1.0f);
+  const std::array<float, 3> errorArray = {0.0f, 0.01f, 0.1f};
+  const ReadOnlySpan<float> errors(errorArray.data(), errorArray.size());
+
+  EXPECT_EQ(0u, selector.Select(errors, 0.0f));
+  EXPECT_EQ(0u, selector.Select(errors, 1.0f));
+  EXPECT_EQ(1u, selector.Select(errors, 5.0f));
+  EXPECT_EQ(1u, selector.Select(errors, 49.0f));
+  EXPECT_EQ(2u, selector.Select(errors, 51.0f));
+  EXPECT_EQ(2u, selector.Select(errors, 5000.0f));
+  // A scaled instance has a larger world space error
+  EXPECT_EQ(1u, selector.Select(errors, 51.0f, 2.0f));
+  EXPECT_EQ(0u, selector.Select(ReadOnlySpan<float>(), 51.0f));
+}
+
+
+TEST(Test_MeshLodSelector, Select_MaxScreenError)
+{
+  MeshLodSelector selector(FovY, ViewportHeight, 1.0f);
+  const std::array<float, 3> errorArray = {0.0f, 0.01f, 0.1f};
+  const ReadOnlySpan<float> errors(errorArray.data(), errorArray.size());
+
+  EXPECT_EQ(1u, selector.Select(errors, 10.0f));
+  selector.SetMaxScreenError(6.0f);
+  EXPECT_EQ(2u, selector.Select(errors, 10.0f));
+  // A smaller viewport makes the error smaller on screen
+  selector.SetMaxScreenError(1.0f);
+  selector.SetProjection(FovY, ViewportHeight / 10.0f);
+  EXPECT_EQ(2u, selector.Select(errors, 10.0f));
+}
+
+
+TEST(Test_MeshLodSelector, SelectByDistance)
+{
+  const std::array<float, 2> distanceArray = {10.0f, 20.0f};
+  const ReadOnlySpan<float> distances(distanceArray.data(), distanceArray.size());
+
+  EXPECT_EQ(0u, MeshLodSelector::SelectByDistance(distances, 0.0f));
+  EXPECT_EQ(0u, MeshLodSelector::SelectByDistance(distances, 9.9f));
+  EXPECT_EQ(1u, MeshLodSelector::SelectByDistance(distances, 10.0f));
+  EXPECT_EQ(2u, MeshLodSelector::SelectByDistance(distances, 20.0f));
+  EXPECT_EQ(0u, MeshLodSelector::SelectByDistance(ReadOnlySpan<float>(), 20.0f));
+}
+
+
+TEST(Test_MeshLodSelector, InvalidArguments)
+{
+  EXPECT_THROW(MeshLodSelector(0.0f, ViewportHeight, 1.0f), std::invalid_argument);
+  EXPECT_THROW(MeshLodSelector(MathHelper::PI, ViewportHeight, 1.0f), std::invalid_argument);
+  EXPECT_THROW(MeshLodSelector(FovY, -1.0f, 1.0f), std::invalid_argument);
+  EXPECT_THROW(MeshLodSelector(FovY, ViewportHeight, 0.0f), std::invalid_argument);
+}
@@ -0,0 +1,141 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshOptimizer.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshOptimizer = TestFixtureFslBase;
+  using TestMesh = GenericMesh<VertexPositionTexture, uint16_t>;
+
+  //! Two separate quads (each with its own vertices) that share a edge, the shared edge vertices are duplicated and there is a unused vertex
+  TestMesh CreateMesh()
+  {
+    const std::vector<VertexPositionTexture> vertices = {
+      VertexPositionTexture(Vector3(0, 0, 0), Vector2(0, 0)), VertexPositionTexture(Vector3(1, 0, 0), Vector2(1, 0)),
+      VertexPositionTexture(Vector3(0, 1, 0), Vector2(0, 1)), VertexPositionTexture(Vector3(1, 1, 0), Vector2(1, 1)),
+      VertexPositionTexture(Vector3(9, 9, 9), Vector2(9, 9)),    // unused
+      VertexPositionTexture(Vector3(1, 0, 0), Vector2(1, 0)), VertexPositionTexture(Vector3(2, 0, 0), Vector2(2, 0)),
+      VertexPositionTexture(Vector3(1, 1, 0), Vector2(1, 1)), VertexPositionTexture(Vector3(2, 1, 0), Vector2(2, 1))};
+    const std::vector<uint16_t> indices = {0, 2, 1, 1, 2, 3, 5, 7, 6, 6, 7, 8};
+    TestMesh mesh(vertices, indices, PrimitiveType::TriangleList);
+    mesh.SetName(UTF8String("test"));
+    mesh.SetMaterialIndex(2);
+    return mesh;
+  }
+
+  //! Resolve the triangles to positions so we can compare meshes with different vertex/index layouts
+  std::vector<std::array<VertexPositionTexture, 3>> ResolveTriangles(const TestMesh& mesh)
+  {
+    const auto& vertices = mesh.GetVertexArray();
+    const auto& indices = mesh.GetIndexArray();
+    std::vector<std::array<VertexPositionTexture, 3>> triangles;
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+      triangles.push_back({vertices[indices[i]], vertices[indices[i + 1]], vertices[indices[i + 2]]});
+    }
+    return triangles;
+  }
+
+  bool Contains(const std::vector<std::array<VertexPositionTexture, 3>>& triangles, const std::array<VertexPositionTexture, 3>& triangle)
+  {
+    return std::find(triangles.begin(), triangles.end(), triangle) != triangles.end();
+  }
+}
+
+
+TEST(Test_MeshOptimizer, Optimize_Default)
+{
+  TestMesh mesh = CreateMesh();
+  const auto srcTriangles = ResolveTriangles(mesh);
+
+  EXPECT_TRUE(MeshOptimizer::Optimize(mesh));
+
+  // The unused vertex is removed
+  EXPECT_EQ(8u, mesh.GetVertexCount());
+  EXPECT_EQ(12u, mesh.GetIndexCount());
+  EXPECT_EQ(UTF8String("test"), mesh.GetName());
+  EXPECT_EQ(2u, mesh.GetMaterialIndex());
+
+  const auto dstTriangles = ResolveTriangles(mesh);
+  ASSERT_EQ(srcTriangles.size(), dstTriangles.size());
+  for (const auto& triangle : srcTriangles)
+  {
+    EXPECT_TRUE(Contains(dstTriangles, triangle));
+  }
+}
+
+
+TEST(Test_MeshOptimizer, Optimize_All)
+{
+  TestMesh mesh = CreateMesh();
+  const auto srcTriangles = ResolveTriangles(mesh);
+
+  EXPECT_TRUE(MeshOptimizer::Optimize(mesh, MeshOptimizeFlags::All));
+
+  // The unused vertex is removed and the shared edge is welded
+  EXPECT_EQ(6u, mesh.GetVertexCount());
+  const auto dstTriangles = ResolveTriangles(mesh);
+  ASSERT_EQ(srcTriangles.size(), dstTriangles.size());
+  for (const auto& triangle : srcTriangles)
+  {
+    EXPECT_TRUE(Contains(dstTriangles, triangle));
+  }
+}
+
+
+TEST(Test_MeshOptimizer, Optimize_NotTriangleList)
+{
+  const std::vector<VertexPositionTexture> vertices(2);
+  const std::vector<uint16_t> indices = {0, 1};
+  TestMesh mesh(vertices, indices, PrimitiveType::LineList);
+
+  EXPECT_FALSE(MeshOptimizer::Optimize(mesh));
+}
+
+
+TEST(Test_MeshOptimizer, Analyze)
+{
+  const TestMesh mesh = CreateMesh();
+  const auto stats = MeshOptimizer::Analyze(mesh);
+  EXPECT_EQ(8u, stats.VerticesTransformed);
+  EXPECT_FLOAT_EQ(2.0f, stats.ACMR);
+}
@@ -0,0 +1,317 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshSimplifier.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshSimplifier = TestFixtureFslBase;
+
+  struct TestMesh
+  {
+    std::vector<VertexPositionTexture> Vertices;
+    std::vector<uint32_t> Indices;
+  };
+
+  //! A flat grid in the XY plane, if seamX is less than quadsX the vertices of that column are duplicated with a different texture coordinate
+  TestMesh CreateGrid(const uint32_t quadsX, const uint32_t quadsY, const uint32_t seamX = 0xFFFFFFFF)
+  {
+    TestMesh mesh;
+    const uint32_t verticesX = quadsX + 1;
+    for (uint32_t y = 0; y <= quadsY; ++y)
+    {
+      for (uint32_t x = 0; x < verticesX; ++x)
+      {
+        mesh.Vertices.emplace_back(Vector3(static_cast<float>(x), static_cast<float>(y), 0.0f), Vector2(0.0f, 0.0f));
+      }
+    }
+    const auto seamStart = static_cast<uint32_t>(mesh.Vertices.size());
+    if (seamX < quadsX)
+    {
+      for (uint32_t y = 0; y <= quadsY; ++y)
+      {
+        mesh.Vertices.emplace_back(Vector3(static_cast<float>(seamX), static_cast<float>(y), 0.0f), Vector2(1.0f, 0.0f));
+      }
+    }
+
+    for (uint32_t y = 0; y < quadsY; ++y)
+    {
+      for (uint32_t x = 0; x < quadsX; ++x)
+      {
+        uint32_t i0 = (y * verticesX) + x;
+        const uint32_t i1 = i0 + 1;
+        uint32_t i2 = i0 + verticesX;
+        const uint32_t i3 = i2 + 1;
+        if (x == seamX)
+        {
+          // The quads to the right of the seam use the duplicated vertices
+          i0 = seamStart + y;
+          i2 = seamStart + y + 1;
+        }
+        mesh.Indices.insert(mesh.Indices.end(), {i0, i2, i1, i1, i2, i3});
+      }
+    }
+    return mesh;
+  }
+
+  //! A closed unit sphere without any seams
+  TestMesh CreateSphere(const uint32_t segments, const uint32_t rings)
+  {
+    TestMesh mesh;
+    mesh.Vertices.emplace_back(Vector3(0.0f, 1.0f, 0.0f), Vector2());
+    for (uint32_t ring = 1; ring < rings; ++ring)
+    {
+      const float theta = MathHelper::PI * static_cast<float>(ring) / static_cast<float>(rings);
+      for (uint32_t segment = 0; segment < segments; ++segment)
+      {
+        const float phi = MathHelper::TO_RADS * 360.0f * static_cast<float>(segment) / static_cast<float>(segments);
+        mesh.Vertices.emplace_back(Vector3(std::sin(theta) * std::cos(phi), std::cos(theta), std::sin(theta) * std::sin(phi)), Vector2());
+      }
+    }
+    mesh.Vertices.emplace_back(Vector3(0.0f, -1.0f, 0.0f), Vector2());
+    const auto bottom = static_cast<uint32_t>(mesh.Vertices.size() - 1);
+
+    const auto ringStart = [segments](const uint32_t ring) { return 1 + ((ring - 1) * segments); };
+    for (uint32_t segment = 0; segment < segments; ++segment)
+    {
+      const uint32_t next = (segment + 1) % segments;
+      mesh.Indices.insert(mesh.Indices.end(), {0, ringStart(1) + next, ringStart(1) + segment});
+      mesh.Indices.insert(mesh.Indices.end(), {bottom, ringStart(rings - 1) + segment, ringStart(rings - 1) + next});
+      for (uint32_t ring = 1; ring < (rings - 1); ++ring)
+      {
+        const uint32_t i0 = ringStart(ring) + segment;
+        const uint32_t i1 = ringStart(ring) + next;
+        const uint32_t i2 = ringStart(ring + 1) + segment;
+        const uint32_t i3 = ringStart(ring + 1) + next;
+        mesh.Indices.insert(mesh.Indices.end(), {i0, i1, i2, i1, i3, i2});
+      }
+    }
+    return mesh;
+  }
+
+  MeshSimplifyResult Simplify(std::vector<uint32_t>& rDst, const TestMesh& mesh, const uint32_t targetIndexCount, const float targetError)
+  {
+    rDst.resize(mesh.Indices.size());
+    const MeshSimplifyResult result =
+      MeshSimplifier::Simplify(SpanUtil::AsSpan(rDst), SpanUtil::AsReadOnlySpan(mesh.Indices), mesh.Vertices.data(),
+                               static_cast<uint32_t>(mesh.Vertices.size()), sizeof(VertexPositionTexture), 0, targetIndexCount, targetError);
+    rDst.resize(result.IndexCount);
+    return result;
+  }
+
+  Vector3 CalcNormal(const TestMesh& mesh, const std::vector<uint32_t>& indices, const std::size_t offset)
+  {
+    const Vector3 p0 = mesh.Vertices[indices[offset]].Position;
+    const Vector3 p1 = mesh.Vertices[indices[offset + 1]].Position;
+    const Vector3 p2 = mesh.Vertices[indices[offset + 2]].Position;
+    return Vector3::Cross(p1 - p0, p2 - p0);
+  }
+
+  bool IsReferenced(const std::vector<uint32_t>& indices, const uint32_t vertexIndex)
+  {
+    return std::find(indices.begin(), indices.end(), vertexIndex) != indices.end();
+  }
+}
+
+
+TEST(Test_MeshSimplifier, Empty)
+{
+  const TestMesh mesh = CreateGrid(1, 1);
+  std::vector<uint32_t> dst;
+  const MeshSimplifyResult result = MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), ReadOnlySpan<uint32_t>(), mesh.Vertices.data(),
+                                                             static_cast<uint32_t>(mesh.Vertices.size()), sizeof(VertexPositionTexture), 0, 0, 1.0f);
+  EXPECT_EQ(MeshSimplifyResult(), result);
+}
+
+
+TEST(Test_MeshSimplifier, ErrorScale)
+{
+  const TestMesh mesh = CreateGrid(8, 4);
+  EXPECT_FLOAT_EQ(8.0f, MeshSimplifier::CalcErrorScale(mesh.Vertices.data(), static_cast<uint32_t>(mesh.Vertices.size()),
+                                                       sizeof(VertexPositionTexture), 0));
+}
+
+
+TEST(Test_MeshSimplifier, FlatGrid)
+{
+  const TestMesh mesh = CreateGrid(16, 16);
+  std::vector<uint32_t> indices;
+  const MeshSimplifyResult result = Simplify(indices, mesh, 0, 0.001f);
+
+  // A plane can be simplified without any error, the border quadrics keeps the corners in place
+  EXPECT_LE(result.Error, 0.001f);
+  EXPECT_LT(result.IndexCount, static_cast<uint32_t>(mesh.Indices.size() / 4));
+  EXPECT_TRUE(IsReferenced(indices, 0));
+  EXPECT_TRUE(IsReferenced(indices, 16));
+  EXPECT_TRUE(IsReferenced(indices, 17 * 16));
+  EXPECT_TRUE(IsReferenced(indices, (17 * 17) - 1));
+
+  // The area must be unchanged and no triangle may have flipped
+  float area = 0.0f;
+  for (std::size_t i = 0; i < indices.size(); i += 3)
+  {
+    const Vector3 normal = CalcNormal(mesh, indices, i);
+    EXPECT_LT(normal.Z, 0.0f);
+    area += normal.Length() * 0.5f;
+  }
+  EXPECT_NEAR(256.0f, area, 0.01f);
+}
+
+
+TEST(Test_MeshSimplifier, Sphere_ErrorBound)
+{
+  const TestMesh mesh = CreateSphere(32, 16);
+  constexpr float TargetError = 0.02f;
+  std::vector<uint32_t> indices;
+  const MeshSimplifyResult result = Simplify(indices, mesh, 0, TargetError);
+
+  EXPECT_GT(result.Error, 0.0f);
+  EXPECT_LE(result.Error, TargetError);
+  EXPECT_LT(result.IndexCount, static_cast<uint32_t>(mesh.Indices.size()));
+  EXPECT_GT(result.IndexCount, 0u);
+
+  // The error is an area weighted average distance to the original planes, so the max deviation of the triangles from the
+  // surface is allowed to be a bit larger (the sphere extent is two)
+  const float maxDistance = result.Error * 2.0f * 3.0f;
+  for (std::size_t i = 0; i < indices.size(); i += 3)
+  {
+    const Vector3 centroid =
+      (mesh.Vertices[indices[i]].Position + mesh.Vertices[indices[i + 1]].Position + mesh.Vertices[indices[i + 2]].Position) / 3.0f;
+    EXPECT_GE(centroid.Length(), 1.0f - maxDistance);
+    // The triangles must still face outwards
+    EXPECT_GT(Vector3::Dot(CalcNormal(mesh, indices, i), centroid), 0.0f);
+  }
+}
+
+
+TEST(Test_MeshSimplifier, Sphere_ZeroError)
+{
+  // Any collapse on a curved surface introduces an error so nothing can be removed
+  const TestMesh mesh = CreateSphere(16, 8);
+  std::vector<uint32_t> indices;
+  const MeshSimplifyResult result = Simplify(indices, mesh, 0, 0.0f);
+
+  EXPECT_EQ(static_cast<uint32_t>(mesh.Indices.size()), result.IndexCount);
+  EXPECT_EQ(0.0f, result.Error);
+  EXPECT_EQ(mesh.Indices, indices);
+}
+
+
+TEST(Test_MeshSimplifier, Sphere_TargetIndexCount)
+{
+  const TestMesh mesh = CreateSphere(32, 16);
+  const auto targetIndexCount = static_cast<uint32_t>(((mesh.Indices.size() / 3) / 2) * 3);
+  std::vector<uint32_t> indices;
+  const MeshSimplifyResult result = Simplify(indices, mesh, targetIndexCount, 1.0f);
+
+  EXPECT_LE(result.IndexCount, targetIndexCount);
+  // The simplifier should not overshoot the target by much
+  EXPECT_GE(result.IndexCount, targetIndexCount - (targetIndexCount / 4));
+}
+
+
+TEST(Test_MeshSimplifier, Sphere_ErrorGrowsWithReduction)
+{
+  const TestMesh mesh = CreateSphere(32, 16);
+  const auto triangleCount = static_cast<uint32_t>(mesh.Indices.size() / 3);
+  std::vector<uint32_t> indices;
+  const MeshSimplifyResult result50 = Simplify(indices, mesh, (triangleCount / 2) * 3, 1.0f);
+  const MeshSimplifyResult result10 = Simplify(indices, mesh, (triangleCount / 10) * 3, 1.0f);
+
+  EXPECT_LT(result10.IndexCount, result50.IndexCount);
+  EXPECT_GT(result50.Error, 0.0f);
+  EXPECT_GT(result10.Error, result50.Error);
+}
+
+
+TEST(Test_MeshSimplifier, Seam)
+{
+  const TestMesh mesh = CreateGrid(16, 16, 8);
+  std::vector<uint32_t> indices;
+  Simplify(indices, mesh, 0, 0.001f);
+
+  // Both sides of the texture seam must be kept intact
+  for (uint32_t y = 0; y <= 16; ++y)
+  {
+    EXPECT_TRUE(IsReferenced(indices, (y * 17) + 8));
+    EXPECT_TRUE(IsReferenced(indices, (17 * 17) + y));
+  }
+  EXPECT_LT(indices.size(), mesh.Indices.size() / 2);
+}
+
+
+TEST(Test_MeshSimplifier, InPlace)
+{
+  const TestMesh mesh = CreateSphere(32, 16);
+  std::vector<uint32_t> expected;
+  const MeshSimplifyResult expectedResult = Simplify(expected, mesh, 0, 0.02f);
+
+  std::vector<uint32_t> indices = mesh.Indices;
+  const MeshSimplifyResult result =
+    MeshSimplifier::Simplify(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(indices), mesh.Vertices.data(),
+                             static_cast<uint32_t>(mesh.Vertices.size()), sizeof(VertexPositionTexture), 0, 0, 0.02f);
+  indices.resize(result.IndexCount);
+  EXPECT_EQ(expectedResult, result);
+  EXPECT_EQ(expected, indices);
+}
+
+
+TEST(Test_MeshSimplifier, InvalidArguments)
+{
+  const TestMesh mesh = CreateGrid(2, 2);
+  const auto vertexCount = static_cast<uint32_t>(mesh.Vertices.size());
+  std::vector<uint32_t> dst(mesh.Indices.size());
+  const auto src = SpanUtil::AsReadOnlySpan(mesh.Indices);
+  constexpr uint32_t Stride = sizeof(VertexPositionTexture);
+
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), src.subspan(0, 4), mesh.Vertices.data(), vertexCount, Stride, 0, 0, 1.0f),
+               std::invalid_argument);
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst).subspan(0, 3), src, mesh.Vertices.data(), vertexCount, Stride, 0, 0, 1.0f),
+               std::invalid_argument);
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), src, mesh.Vertices.data(), vertexCount - 1, Stride, 0, 0, 1.0f),
+               std::invalid_argument);
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), src, mesh.Vertices.data(), vertexCount, Stride, 12, 0, 1.0f),
+               std::invalid_argument);
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), src, nullptr, vertexCount, Stride, 0, 0, 1.0f), std::invalid_argument);
+  EXPECT_THROW(MeshSimplifier::Simplify(SpanUtil::AsSpan(dst), src, mesh.Vertices.data(), vertexCount, Stride, 0, 0, -1.0f),
+               std::invalid_argument);
+}
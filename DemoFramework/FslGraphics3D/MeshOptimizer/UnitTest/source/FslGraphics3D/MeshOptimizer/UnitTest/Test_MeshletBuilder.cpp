@@ -0,0 +1,232 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletBuilder.hpp>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshletBuilder = TestFixtureFslBase;
+
+  //! A flat grid in the XY plane with all triangles facing -Z
+  struct Grid
+  {
+    std::vector<VertexPosition> Vertices;
+    std::vector<uint32_t> Indices;
+  };
+
+  Grid CreateGrid(const uint32_t quadsX, const uint32_t quadsY)
+  {
+    Grid grid;
+    const uint32_t verticesX = quadsX + 1;
+    for (uint32_t y = 0; y <= quadsY; ++y)
+    {
+      for (uint32_t x = 0; x < verticesX; ++x)
+      {
+        grid.Vertices.emplace_back(static_cast<float>(x), static_cast<float>(y), 0.0f);
+      }
+    }
+    for (uint32_t y = 0; y < quadsY; ++y)
+    {
+      for (uint32_t x = 0; x < quadsX; ++x)
+      {
+        const uint32_t i0 = (y * verticesX) + x;
+        const uint32_t i1 = i0 + 1;
+        const uint32_t i2 = i0 + verticesX;
+        const uint32_t i3 = i2 + 1;
+        grid.Indices.insert(grid.Indices.end(), {i0, i2, i1, i1, i2, i3});
+      }
+    }
+    return grid;
+  }
+
+  MeshletData Build(const Grid& grid, const uint32_t maxVertices, const uint32_t maxTriangles)
+  {
+    return MeshletBuilder::Build(SpanUtil::AsReadOnlySpan(grid.Indices), grid.Vertices.data(), static_cast<uint32_t>(grid.Vertices.size()),
+                                 sizeof(VertexPosition), 0, maxVertices, maxTriangles);
+  }
+
+  //! Convert the meshlets back to a sorted list of triangles using the original vertex indices
+  std::vector<std::array<uint32_t, 3>> ToSortedTriangles(const MeshletData& meshlets)
+  {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (const Meshlet& meshlet : meshlets.GetMeshlets())
+    {
+      const auto vertexIndices = meshlets.GetVertexIndices(meshlet);
+      const auto triangleIndices = meshlets.GetTriangleIndices(meshlet);
+      for (std::size_t i = 0; i < triangleIndices.size(); i += 3)
+      {
+        triangles.push_back({vertexIndices[triangleIndices[i]], vertexIndices[triangleIndices[i + 1]], vertexIndices[triangleIndices[i + 2]]});
+      }
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  }
+
+  std::vector<std::array<uint32_t, 3>> ToSortedTriangles(const std::vector<uint32_t>& indices)
+  {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+      triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  }
+}
+
+
+TEST(Test_MeshletBuilder, Build_Empty)
+{
+  const std::vector<uint32_t> indices;
+  const std::vector<VertexPosition> vertices;
+  const MeshletData meshlets = MeshletBuilder::Build(SpanUtil::AsReadOnlySpan(indices), vertices.data(), 0, sizeof(VertexPosition), 0);
+  EXPECT_TRUE(meshlets.Empty());
+  EXPECT_EQ(0u, meshlets.Count());
+}
+
+
+TEST(Test_MeshletBuilder, Build_Grid)
+{
+  const Grid grid = CreateGrid(32, 32);
+  const MeshletData meshlets = Build(grid, MeshletBuilder::DefaultMaxVertices, MeshletBuilder::DefaultMaxTriangles);
+
+  EXPECT_EQ(MeshletBuilder::DefaultMaxVertices, meshlets.GetMaxVertices());
+  EXPECT_EQ(MeshletBuilder::DefaultMaxTriangles, meshlets.GetMaxTriangles());
+
+  // 2048 triangles need at least 17 meshlets
+  EXPECT_GE(meshlets.Count(), 17u);
+  // The grid is fully connected so the meshlets should be reasonably full
+  EXPECT_LE(meshlets.Count(), 40u);
+
+  for (const Meshlet& meshlet : meshlets.GetMeshlets())
+  {
+    EXPECT_GT(meshlet.TriangleCount, 0u);
+    EXPECT_LE(meshlet.VertexCount, MeshletBuilder::DefaultMaxVertices);
+    EXPECT_LE(meshlet.TriangleCount, MeshletBuilder::DefaultMaxTriangles);
+  }
+
+  // Every triangle must be present exactly once with the same winding
+  EXPECT_EQ(ToSortedTriangles(grid.Indices), ToSortedTriangles(meshlets));
+}
+
+
+TEST(Test_MeshletBuilder, Build_Bounds)
+{
+  const Grid grid = CreateGrid(16, 16);
+  const MeshletData meshlets = Build(grid, 32, 48);
+
+  for (const Meshlet& meshlet : meshlets.GetMeshlets())
+  {
+    for (const uint32_t vertexIndex : meshlets.GetVertexIndices(meshlet))
+    {
+      const float distance = Vector3::Distance(grid.Vertices[vertexIndex].Position, meshlet.Bounds.Center);
+      EXPECT_LE(distance, meshlet.Bounds.Radius + 0.0001f);
+    }
+  }
+}
+
+
+TEST(Test_MeshletBuilder, Build_Cone)
+{
+  const Grid grid = CreateGrid(8, 8);
+  const MeshletData meshlets = Build(grid, MeshletBuilder::DefaultMaxVertices, MeshletBuilder::DefaultMaxTriangles);
+  ASSERT_FALSE(meshlets.Empty());
+
+  // A flat surface produces a perfect cone
+  for (const Meshlet& meshlet : meshlets.GetMeshlets())
+  {
+    EXPECT_FLOAT_EQ(-1.0f, meshlet.ConeAxis.Z);
+    EXPECT_NEAR(0.0f, meshlet.ConeCutoff, 0.001f);
+  }
+}
+
+
+TEST(Test_MeshletBuilder, Build_DegenerateCone)
+{
+  // Two triangles facing in opposite directions
+  const std::vector<VertexPosition> vertices = {VertexPosition(0, 0, 0), VertexPosition(1, 0, 0), VertexPosition(0, 1, 0)};
+  const std::vector<uint16_t> indices = {0, 1, 2, 0, 2, 1};
+  const MeshletData meshlets = MeshletBuilder::Build(SpanUtil::AsReadOnlySpan(indices), vertices.data(), 3, sizeof(VertexPosition), 0);
+  ASSERT_EQ(1u, meshlets.Count());
+  EXPECT_EQ(1.0f, meshlets[0].ConeCutoff);
+}
+
+
+TEST(Test_MeshletBuilder, Build_SingleTriangleMeshlets)
+{
+  const Grid grid = CreateGrid(4, 4);
+  const MeshletData meshlets = Build(grid, 3, 1);
+  EXPECT_EQ(grid.Indices.size() / 3, meshlets.Count());
+  EXPECT_EQ(ToSortedTriangles(grid.Indices), ToSortedTriangles(meshlets));
+}
+
+
+TEST(Test_MeshletBuilder, Build_InvalidArguments)
+{
+  const Grid grid = CreateGrid(1, 1);
+  EXPECT_THROW(Build(grid, 2, 1), std::invalid_argument);
+  EXPECT_THROW(Build(grid, MeshletBuilder::MaxVerticesLimit + 1, 1), std::invalid_argument);
+  EXPECT_THROW(Build(grid, 3, 0), std::invalid_argument);
+  EXPECT_THROW(Build(grid, 3, MeshletBuilder::MaxTrianglesLimit + 1), std::invalid_argument);
+
+  const std::vector<uint32_t> indices = {0, 1, 4};
+  EXPECT_THROW(MeshletBuilder::Build(SpanUtil::AsReadOnlySpan(indices), grid.Vertices.data(), static_cast<uint32_t>(grid.Vertices.size()),
+                                     sizeof(VertexPosition), 0),
+               std::invalid_argument);
+}
+
+
+TEST(Test_MeshletBuilder, Build_Mesh)
+{
+  const Grid grid = CreateGrid(4, 4);
+  std::vector<uint16_t> indices(grid.Indices.begin(), grid.Indices.end());
+  GenericMesh<VertexPosition, uint16_t> mesh(grid.Vertices, indices, PrimitiveType::TriangleList);
+
+  EXPECT_FALSE(mesh.GetMeshlets());
+  EXPECT_TRUE(MeshletBuilder::Build(mesh));
+  ASSERT_TRUE(mesh.GetMeshlets());
+  EXPECT_EQ(ToSortedTriangles(grid.Indices), ToSortedTriangles(*mesh.GetMeshlets()));
+
+  // Reset invalidates the meshlets
+  mesh.Reset();
+  EXPECT_FALSE(mesh.GetMeshlets());
+}
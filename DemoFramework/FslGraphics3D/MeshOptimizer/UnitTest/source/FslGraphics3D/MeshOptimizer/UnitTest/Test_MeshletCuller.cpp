@@ -0,0 +1,165 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletBuilder.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletCuller.hpp>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshletCuller = TestFixtureFslBase;
+
+  //! A flat 64x64 grid centered around origo in the XY plane with all triangles facing -Z
+  MeshletData CreateGridMeshlets()
+  {
+    constexpr uint32_t QuadsX = 64;
+    constexpr uint32_t QuadsY = 64;
+    constexpr uint32_t VerticesX = QuadsX + 1;
+    std::vector<VertexPosition> vertices;
+    for (uint32_t y = 0; y <= QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < VerticesX; ++x)
+      {
+        vertices.emplace_back(static_cast<float>(x) - (QuadsX / 2.0f), static_cast<float>(y) - (QuadsY / 2.0f), 0.0f);
+      }
+    }
+    std::vector<uint32_t> indices;
+    for (uint32_t y = 0; y < QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < QuadsX; ++x)
+      {
+        const uint32_t i0 = (y * VerticesX) + x;
+        const uint32_t i1 = i0 + 1;
+        const uint32_t i2 = i0 + VerticesX;
+        const uint32_t i3 = i2 + 1;
+        indices.insert(indices.end(), {i0, i2, i1, i1, i2, i3});
+      }
+    }
+    return MeshletBuilder::Build(SpanUtil::AsReadOnlySpan(indices), vertices.data(), static_cast<uint32_t>(vertices.size()),
+                                 sizeof(VertexPosition), 0);
+  }
+
+  BoundingFrustum CreateFrustum(const Vector3& cameraPosition, const Vector3& target)
+  {
+    const Matrix view = Matrix::CreateLookAt(cameraPosition, target, Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 1.0f, 0.1f, 1000.0f);
+    return BoundingFrustum(view * projection);
+  }
+}
+
+
+TEST(Test_MeshletCuller, Cull_FrontFacing)
+{
+  const MeshletData meshlets = CreateGridMeshlets();
+  const Vector3 cameraPosition(0.0f, 0.0f, -100.0f);
+  const BoundingFrustum frustum = CreateFrustum(cameraPosition, Vector3());
+
+  std::vector<uint32_t> visible(meshlets.Count());
+  const MeshletCullStats stats = MeshletCuller::Cull(SpanUtil::AsSpan(visible), meshlets, frustum, cameraPosition);
+  EXPECT_EQ(meshlets.Count(), stats.Visible);
+  EXPECT_EQ(0u, stats.FrustumCulled);
+  EXPECT_EQ(0u, stats.BackfaceCulled);
+}
+
+
+TEST(Test_MeshletCuller, Cull_BackFacing)
+{
+  const MeshletData meshlets = CreateGridMeshlets();
+  const Vector3 cameraPosition(0.0f, 0.0f, 100.0f);
+  const BoundingFrustum frustum = CreateFrustum(cameraPosition, Vector3());
+
+  std::vector<uint32_t> visible(meshlets.Count());
+  const MeshletCullStats stats = MeshletCuller::Cull(SpanUtil::AsSpan(visible), meshlets, frustum, cameraPosition);
+  EXPECT_EQ(0u, stats.Visible);
+  EXPECT_EQ(0u, stats.FrustumCulled);
+  EXPECT_EQ(meshlets.Count(), stats.BackfaceCulled);
+}
+
+
+TEST(Test_MeshletCuller, Cull_Frustum)
+{
+  const MeshletData meshlets = CreateGridMeshlets();
+  // Look at a corner of the grid from close by so most of the grid is outside the frustum
+  const Vector3 cameraPosition(28.0f, 28.0f, -4.0f);
+  const BoundingFrustum frustum = CreateFrustum(cameraPosition, Vector3(28.0f, 28.0f, 0.0f));
+
+  std::vector<uint32_t> visible(meshlets.Count());
+  const MeshletCullStats stats = MeshletCuller::Cull(SpanUtil::AsSpan(visible), meshlets, frustum, cameraPosition);
+  EXPECT_GT(stats.Visible, 0u);
+  EXPECT_GT(stats.FrustumCulled, 0u);
+  EXPECT_EQ(meshlets.Count(), stats.Visible + stats.FrustumCulled + stats.BackfaceCulled);
+
+  for (uint32_t i = 0; i < stats.Visible; ++i)
+  {
+    EXPECT_TRUE(MeshletCuller::IsVisible(meshlets[visible[i]], frustum, cameraPosition));
+  }
+}
+
+
+TEST(Test_MeshletCuller, Cull_DstTooSmall)
+{
+  const MeshletData meshlets = CreateGridMeshlets();
+  const Vector3 cameraPosition(0.0f, 0.0f, -100.0f);
+  const BoundingFrustum frustum = CreateFrustum(cameraPosition, Vector3());
+
+  std::vector<uint32_t> visible(meshlets.Count() - 1);
+  EXPECT_THROW(MeshletCuller::Cull(SpanUtil::AsSpan(visible), meshlets, frustum, cameraPosition), std::invalid_argument);
+}
+
+
+TEST(Test_MeshletCuller, ExtractIndices)
+{
+  const MeshletData meshlets = CreateGridMeshlets();
+  std::vector<uint32_t> meshletIndices;
+  for (uint32_t i = 0; i < meshlets.Count(); ++i)
+  {
+    meshletIndices.push_back(i);
+  }
+
+  const uint32_t indexCount = MeshletCuller::CalcIndexCount(meshlets, SpanUtil::AsReadOnlySpan(meshletIndices));
+  EXPECT_EQ(64u * 64u * 6u, indexCount);
+
+  std::vector<uint32_t> indices(indexCount);
+  EXPECT_EQ(indexCount, MeshletCuller::ExtractIndices(SpanUtil::AsSpan(indices), meshlets, SpanUtil::AsReadOnlySpan(meshletIndices)));
+
+  std::vector<uint16_t> indices16(indexCount - 1);
+  EXPECT_THROW(MeshletCuller::ExtractIndices(SpanUtil::AsSpan(indices16), meshlets, SpanUtil::AsReadOnlySpan(meshletIndices)),
+               std::invalid_argument);
+}
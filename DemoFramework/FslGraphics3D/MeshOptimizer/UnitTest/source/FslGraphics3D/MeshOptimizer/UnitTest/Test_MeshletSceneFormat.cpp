@@ -0,0 +1,201 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPosition.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/GenericScene.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletBuilder.hpp>
+#include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_MeshletSceneFormat = TestFixtureFslBase;
+  using TestMesh = GenericMesh<VertexPosition, uint16_t>;
+  using TestScene = GenericScene<TestMesh>;
+
+  std::shared_ptr<TestMesh> CreateMesh(const float z)
+  {
+    std::vector<VertexPosition> vertices;
+    std::vector<uint16_t> indices;
+    for (uint16_t y = 0; y <= 8; ++y)
+    {
+      for (uint16_t x = 0; x <= 8; ++x)
+      {
+        vertices.emplace_back(static_cast<float>(x), static_cast<float>(y), z);
+      }
+    }
+    for (uint16_t y = 0; y < 8; ++y)
+    {
+      for (uint16_t x = 0; x < 8; ++x)
+      {
+        const auto i0 = static_cast<uint16_t>((y * 9) + x);
+        const auto i1 = static_cast<uint16_t>(i0 + 1);
+        const auto i2 = static_cast<uint16_t>(i0 + 9);
+        const auto i3 = static_cast<uint16_t>(i2 + 1);
+        indices.insert(indices.end(), {i0, i2, i1, i1, i2, i3});
+      }
+    }
+    return std::make_shared<TestMesh>(vertices, indices, PrimitiveType::TriangleList);
+  }
+
+  std::shared_ptr<TestScene> SaveAndLoad(const TestScene& scene, const IO::Path& filename)
+  {
+    SceneFormat::BasicSceneFormat sceneFormat;
+    sceneFormat.Save(filename, scene);
+    auto result = sceneFormat.Load<TestScene>(filename);
+    std::remove(filename.ToUTF8String().c_str());
+    return result;
+  }
+
+  //! Copy the meshlet data and set the first local triangle index of the first meshlet to its vertex count (one past the last valid index)
+  void CreateInvalidLocalIndexData(const MeshletData& src, std::vector<Meshlet>& rMeshlets, std::vector<uint32_t>& rVertexIndices,
+                                   std::vector<uint8_t>& rTriangleIndices)
+  {
+    rMeshlets.clear();
+    for (uint32_t i = 0; i < src.Count(); ++i)
+    {
+      rMeshlets.push_back(src[i]);
+    }
+    const auto vertexIndices = src.GetVertexIndices();
+    const auto triangleIndices = src.GetTriangleIndices();
+    rVertexIndices.assign(vertexIndices.begin(), vertexIndices.end());
+    rTriangleIndices.assign(triangleIndices.begin(), triangleIndices.end());
+    rTriangleIndices[rMeshlets[0].TriangleOffset] = static_cast<uint8_t>(rMeshlets[0].VertexCount);
+  }
+}
+
+
+TEST(Test_MeshletSceneFormat, RoundTrip)
+{
+  TestScene scene;
+  scene.AddMesh(CreateMesh(0.0f));
+  scene.AddMesh(CreateMesh(1.0f));
+  scene.SetRootNode(std::make_shared<SceneNode>());
+  // Only build meshlets for the second mesh
+  ASSERT_TRUE(MeshletBuilder::Build(*scene.Meshes[1], 32, 32));
+
+  const auto loaded = SaveAndLoad(scene, IO::Path("Test_MeshletSceneFormat_RoundTrip.fsf"));
+  ASSERT_EQ(2, loaded->GetMeshCount());
+  EXPECT_FALSE(loaded->Meshes[0]->GetMeshlets());
+  ASSERT_TRUE(loaded->Meshes[1]->GetMeshlets());
+
+  const MeshletData& expected = *scene.Meshes[1]->GetMeshlets();
+  const MeshletData& actual = *loaded->Meshes[1]->GetMeshlets();
+  EXPECT_EQ(expected.GetMaxVertices(), actual.GetMaxVertices());
+  EXPECT_EQ(expected.GetMaxTriangles(), actual.GetMaxTriangles());
+  ASSERT_EQ(expected.Count(), actual.Count());
+  for (uint32_t i = 0; i < expected.Count(); ++i)
+  {
+    EXPECT_EQ(expected[i], actual[i]);
+  }
+  const auto expectedVertexIndices = expected.GetVertexIndices();
+  const auto actualVertexIndices = actual.GetVertexIndices();
+  EXPECT_TRUE(std::equal(expectedVertexIndices.begin(), expectedVertexIndices.end(), actualVertexIndices.begin(), actualVertexIndices.end()));
+  const auto expectedTriangleIndices = expected.GetTriangleIndices();
+  const auto actualTriangleIndices = actual.GetTriangleIndices();
+  EXPECT_TRUE(
+    std::equal(expectedTriangleIndices.begin(), expectedTriangleIndices.end(), actualTriangleIndices.begin(), actualTriangleIndices.end()));
+}
+
+
+TEST(Test_MeshletSceneFormat, RoundTrip_NoMeshlets)
+{
+  TestScene scene;
+  scene.AddMesh(CreateMesh(0.0f));
+  scene.SetRootNode(std::make_shared<SceneNode>());
+
+  const auto loaded = SaveAndLoad(scene, IO::Path("Test_MeshletSceneFormat_RoundTrip_NoMeshlets.fsf"));
+  ASSERT_EQ(1, loaded->GetMeshCount());
+  EXPECT_FALSE(loaded->Meshes[0]->GetMeshlets());
+}
+
+
+TEST(Test_MeshletSceneFormat, MeshletData_InvalidLocalTriangleIndex)
+{
+  auto mesh = CreateMesh(0.0f);
+  ASSERT_TRUE(MeshletBuilder::Build(*mesh, 32, 32));
+  const MeshletData& src = *mesh->GetMeshlets();
+
+  std::vector<Meshlet> meshlets;
+  std::vector<uint32_t> vertexIndices;
+  std::vector<uint8_t> triangleIndices;
+  CreateInvalidLocalIndexData(src, meshlets, vertexIndices, triangleIndices);
+  EXPECT_THROW(MeshletData(src.GetMaxVertices(), src.GetMaxTriangles(), meshlets, vertexIndices, triangleIndices), std::invalid_argument);
+
+  // The last valid local index is accepted
+  triangleIndices[meshlets[0].TriangleOffset] = static_cast<uint8_t>(meshlets[0].VertexCount - 1u);
+  EXPECT_NO_THROW(MeshletData(src.GetMaxVertices(), src.GetMaxTriangles(), meshlets, vertexIndices, triangleIndices));
+}
+
+
+TEST(Test_MeshletSceneFormat, Load_InvalidLocalTriangleIndex)
+{
+  TestScene scene;
+  scene.AddMesh(CreateMesh(0.0f));
+  scene.SetRootNode(std::make_shared<SceneNode>());
+  ASSERT_TRUE(MeshletBuilder::Build(*scene.Meshes[0], 32, 32));
+  const MeshletData& src = *scene.Meshes[0]->GetMeshlets();
+
+  const IO::Path filename("Test_MeshletSceneFormat_Load_InvalidLocalTriangleIndex.fsf");
+  SceneFormat::BasicSceneFormat sceneFormat;
+  sceneFormat.Save(filename, scene);
+
+  // Patch the stored triangle indices the same way a corrupt file would
+  std::vector<char> content;
+  {
+    std::ifstream stream(filename.ToUTF8String(), std::ios::in | std::ios::binary);
+    content.assign(std::istreambuf_iterator<char>(stream), std::istreambuf_iterator<char>());
+  }
+  const auto triangleIndices = src.GetTriangleIndices();
+  auto itrFind = std::search(content.begin(), content.end(), triangleIndices.begin(), triangleIndices.end(),
+                             [](const char lhs, const uint8_t rhs) { return static_cast<uint8_t>(lhs) == rhs; });
+  ASSERT_NE(content.end(), itrFind);
+  *(itrFind + src[0].TriangleOffset) = static_cast<char>(src[0].VertexCount);
+  {
+    std::ofstream stream(filename.ToUTF8String(), std::ios::out | std::ios::binary | std::ios::trunc);
+    stream.write(content.data(), static_cast<std::streamsize>(content.size()));
+  }
+
+  EXPECT_THROW(sceneFormat.Load<TestScene>(filename), FormatException);
+  std::remove(filename.ToUTF8String().c_str());
+}
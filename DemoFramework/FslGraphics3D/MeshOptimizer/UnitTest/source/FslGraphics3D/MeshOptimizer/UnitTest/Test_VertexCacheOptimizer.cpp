@@ -0,0 +1,199 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheOptimizer.hpp>
+#include <algorithm>
+#include <array>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_VertexCacheOptimizer = TestFixtureFslBase;
+
+  //! Create a grid of quads as a triangle list in a random triangle order
+  std::vector<uint32_t> CreateShuffledGrid(const uint32_t quadsX, const uint32_t quadsY)
+  {
+    const uint32_t verticesX = quadsX + 1;
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (uint32_t y = 0; y < quadsY; ++y)
+    {
+      for (uint32_t x = 0; x < quadsX; ++x)
+      {
+        const uint32_t i0 = (y * verticesX) + x;
+        const uint32_t i1 = i0 + 1;
+        const uint32_t i2 = i0 + verticesX;
+        const uint32_t i3 = i2 + 1;
+        triangles.push_back({i0, i2, i1});
+        triangles.push_back({i1, i2, i3});
+      }
+    }
+    std::mt19937 random(1337);
+    std::shuffle(triangles.begin(), triangles.end(), random);
+
+    std::vector<uint32_t> indices;
+    for (const auto& triangle : triangles)
+    {
+      indices.insert(indices.end(), triangle.begin(), triangle.end());
+    }
+    return indices;
+  }
+
+  std::vector<std::array<uint32_t, 3>> ToSortedTriangles(const std::vector<uint32_t>& indices)
+  {
+    std::vector<std::array<uint32_t, 3>> triangles;
+    for (std::size_t i = 0; i < indices.size(); i += 3)
+    {
+      triangles.push_back({indices[i], indices[i + 1], indices[i + 2]});
+    }
+    std::sort(triangles.begin(), triangles.end());
+    return triangles;
+  }
+}
+
+
+TEST(Test_VertexCacheOptimizer, Analyze_Empty)
+{
+  const std::vector<uint16_t> indices;
+  const auto stats = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), 0);
+  EXPECT_EQ(0u, stats.VerticesTransformed);
+}
+
+
+TEST(Test_VertexCacheOptimizer, Analyze_Triangle)
+{
+  const std::vector<uint16_t> indices = {0, 1, 2};
+  const auto stats = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), 3);
+  EXPECT_EQ(3u, stats.VerticesTransformed);
+  EXPECT_FLOAT_EQ(3.0f, stats.ACMR);
+  EXPECT_FLOAT_EQ(1.0f, stats.ATVR);
+}
+
+
+TEST(Test_VertexCacheOptimizer, Analyze_Quad)
+{
+  const std::vector<uint16_t> indices = {0, 1, 2, 2, 1, 3};
+  const auto stats = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), 4);
+  EXPECT_EQ(4u, stats.VerticesTransformed);
+  EXPECT_FLOAT_EQ(2.0f, stats.ACMR);
+  EXPECT_FLOAT_EQ(1.0f, stats.ATVR);
+}
+
+
+TEST(Test_VertexCacheOptimizer, Analyze_CacheEviction)
+{
+  // With a cache size of three the first vertex has been evicted when it is referenced again
+  const std::vector<uint16_t> indices = {0, 1, 2, 3, 4, 5, 0, 1, 2};
+  const auto stats = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), 6, 3);
+  EXPECT_EQ(9u, stats.VerticesTransformed);
+  EXPECT_FLOAT_EQ(1.5f, stats.ATVR);
+}
+
+
+TEST(Test_VertexCacheOptimizer, Analyze_InvalidTriangleList)
+{
+  const std::vector<uint16_t> indices = {0, 1};
+  EXPECT_THROW(VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), 2), std::invalid_argument);
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeForsyth_Empty)
+{
+  std::vector<uint16_t> indices;
+  std::vector<uint16_t> result;
+  VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), 0);
+  EXPECT_TRUE(result.empty());
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeForsyth_InvalidSize)
+{
+  std::vector<uint16_t> indices = {0, 1, 2};
+  std::vector<uint16_t> result(2);
+  EXPECT_THROW(VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), 3), std::invalid_argument);
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeForsyth_IndexOutOfBounds)
+{
+  std::vector<uint16_t> indices = {0, 1, 3};
+  std::vector<uint16_t> result(3);
+  EXPECT_THROW(VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), 3), std::invalid_argument);
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeForsyth_Grid)
+{
+  const std::vector<uint32_t> indices = CreateShuffledGrid(32, 32);
+  const uint32_t vertexCount = 33 * 33;
+  std::vector<uint32_t> result(indices.size());
+
+  VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), vertexCount);
+
+  // The same triangles must be present (with the same winding)
+  EXPECT_EQ(ToSortedTriangles(indices), ToSortedTriangles(result));
+
+  const auto before = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), vertexCount);
+  const auto after = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(result), vertexCount);
+  EXPECT_LT(after.ACMR, before.ACMR);
+  EXPECT_LT(after.ACMR, 0.8f);
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeTipsify_Grid)
+{
+  const std::vector<uint32_t> indices = CreateShuffledGrid(32, 32);
+  const uint32_t vertexCount = 33 * 33;
+  std::vector<uint32_t> result(indices.size());
+
+  VertexCacheOptimizer::OptimizeTipsify(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), vertexCount, 16);
+
+  EXPECT_EQ(ToSortedTriangles(indices), ToSortedTriangles(result));
+
+  const auto before = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), vertexCount, 16);
+  const auto after = VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(result), vertexCount, 16);
+  EXPECT_LT(after.ACMR, before.ACMR);
+  EXPECT_LT(after.ACMR, 0.9f);
+}
+
+
+TEST(Test_VertexCacheOptimizer, OptimizeTipsify_InvalidCacheSize)
+{
+  std::vector<uint16_t> indices = {0, 1, 2};
+  std::vector<uint16_t> result(3);
+  EXPECT_THROW(VertexCacheOptimizer::OptimizeTipsify(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(indices), 3, 2), std::invalid_argument);
+}
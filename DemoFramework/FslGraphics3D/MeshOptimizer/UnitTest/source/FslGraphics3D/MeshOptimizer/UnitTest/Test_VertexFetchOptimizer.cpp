@@ -0,0 +1,100 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexFetchOptimizer.hpp>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_VertexFetchOptimizer = TestFixtureFslBase;
+}
+
+
+TEST(Test_VertexFetchOptimizer, BuildRemap)
+{
+  const std::vector<uint16_t> indices = {3, 1, 0, 0, 1, 4};
+  std::vector<uint32_t> remap(5);
+
+  const uint32_t usedCount = VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(indices));
+
+  EXPECT_EQ(4u, usedCount);
+  EXPECT_EQ(2u, remap[0]);
+  EXPECT_EQ(1u, remap[1]);
+  EXPECT_EQ(VertexFetchOptimizer::UnusedVertex, remap[2]);
+  EXPECT_EQ(0u, remap[3]);
+  EXPECT_EQ(3u, remap[4]);
+}
+
+
+TEST(Test_VertexFetchOptimizer, BuildRemap_IndexOutOfBounds)
+{
+  const std::vector<uint16_t> indices = {0, 1, 2};
+  std::vector<uint32_t> remap(2);
+  EXPECT_THROW(VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(indices)), std::invalid_argument);
+}
+
+
+TEST(Test_VertexFetchOptimizer, Remap)
+{
+  std::vector<uint32_t> indices = {3, 1, 0, 0, 1, 4};
+  const std::vector<float> vertices = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f};
+  std::vector<uint32_t> remap(vertices.size());
+
+  const uint32_t usedCount = VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(indices));
+  std::vector<float> dstVertices(usedCount);
+  VertexFetchOptimizer::RemapVertices(SpanUtil::AsSpan(dstVertices), SpanUtil::AsReadOnlySpan(vertices), SpanUtil::AsReadOnlySpan(remap));
+  VertexFetchOptimizer::RemapIndices(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(remap));
+
+  // The vertices are now referenced in ascending order
+  const std::vector<uint32_t> expectedIndices = {0, 1, 2, 2, 1, 3};
+  const std::vector<float> expectedVertices = {3.0f, 1.0f, 0.0f, 4.0f};
+  EXPECT_EQ(expectedIndices, indices);
+  EXPECT_EQ(expectedVertices, dstVertices);
+}
+
+
+TEST(Test_VertexFetchOptimizer, RemapVertices_Raw)
+{
+  const std::vector<uint16_t> vertices = {10, 11, 20, 21, 30, 31};
+  const std::vector<uint32_t> remap = {1, VertexFetchOptimizer::UnusedVertex, 0};
+  std::vector<uint16_t> dstVertices(4);
+
+  VertexFetchOptimizer::RemapVertices(dstVertices.data(), vertices.data(), sizeof(uint16_t) * 2, SpanUtil::AsReadOnlySpan(remap));
+
+  const std::vector<uint16_t> expected = {30, 31, 10, 11};
+  EXPECT_EQ(expected, dstVertices);
+}
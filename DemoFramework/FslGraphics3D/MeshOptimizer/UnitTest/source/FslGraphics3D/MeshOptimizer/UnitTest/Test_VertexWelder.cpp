@@ -0,0 +1,114 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexWelder.hpp>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_VertexWelder = TestFixtureFslBase;
+
+  uint32_t Weld(std::vector<uint32_t>& rRemap, std::vector<VertexPositionTexture>& rDst, const std::vector<VertexPositionTexture>& src,
+                const float epsilon)
+  {
+    rRemap.resize(src.size());
+    rDst.resize(src.size());
+    const auto count = static_cast<uint32_t>(src.size());
+    const uint32_t uniqueCount =
+      VertexWelder::Weld(SpanUtil::AsSpan(rRemap), rDst.data(), src.data(), count, sizeof(VertexPositionTexture), 0, epsilon);
+    rDst.resize(uniqueCount);
+    return uniqueCount;
+  }
+}
+
+
+TEST(Test_VertexWelder, Weld_Exact)
+{
+  const std::vector<VertexPositionTexture> vertices = {
+    VertexPositionTexture(Vector3(0, 0, 0), Vector2(0, 0)), VertexPositionTexture(Vector3(1, 0, 0), Vector2(1, 0)),
+    VertexPositionTexture(Vector3(0, 0, 0), Vector2(0, 0)), VertexPositionTexture(Vector3(1, 0, 0), Vector2(1, 0))};
+
+  std::vector<uint32_t> remap;
+  std::vector<VertexPositionTexture> result;
+  EXPECT_EQ(2u, Weld(remap, result, vertices, 0.0f));
+  EXPECT_EQ(0u, remap[0]);
+  EXPECT_EQ(1u, remap[1]);
+  EXPECT_EQ(0u, remap[2]);
+  EXPECT_EQ(1u, remap[3]);
+  EXPECT_EQ(vertices[0], result[0]);
+  EXPECT_EQ(vertices[1], result[1]);
+}
+
+
+TEST(Test_VertexWelder, Weld_Epsilon)
+{
+  // The two vertices are located in different grid cells but within epsilon of each other
+  const std::vector<VertexPositionTexture> vertices = {VertexPositionTexture(Vector3(0.0999f, 0, 0), Vector2(0, 0)),
+                                                       VertexPositionTexture(Vector3(0.1001f, 0, 0), Vector2(0, 0)),
+                                                       VertexPositionTexture(Vector3(0.5f, 0, 0), Vector2(0, 0))};
+
+  std::vector<uint32_t> remap;
+  std::vector<VertexPositionTexture> result;
+  EXPECT_EQ(2u, Weld(remap, result, vertices, 0.1f));
+  EXPECT_EQ(0u, remap[0]);
+  EXPECT_EQ(0u, remap[1]);
+  EXPECT_EQ(1u, remap[2]);
+}
+
+
+TEST(Test_VertexWelder, Weld_PreserveSeams)
+{
+  // Same position, different texture coordinate
+  const std::vector<VertexPositionTexture> vertices = {VertexPositionTexture(Vector3(0, 0, 0), Vector2(0, 0)),
+                                                       VertexPositionTexture(Vector3(0, 0, 0), Vector2(1, 0))};
+
+  std::vector<uint32_t> remap;
+  std::vector<VertexPositionTexture> result;
+  EXPECT_EQ(2u, Weld(remap, result, vertices, 0.01f));
+}
+
+
+TEST(Test_VertexWelder, Weld_InvalidPositionOffset)
+{
+  std::vector<VertexPositionTexture> vertices(1);
+  std::vector<VertexPositionTexture> result(1);
+  std::vector<uint32_t> remap(1);
+  EXPECT_THROW(VertexWelder::Weld(SpanUtil::AsSpan(remap), result.data(), vertices.data(), 1, sizeof(VertexPositionTexture),
+                                  sizeof(VertexPositionTexture) - 4, 0.0f),
+               std::invalid_argument);
+}
@@ -0,0 +1,86 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODCHAIN_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODCHAIN_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <memory>
+#include <vector>
+
+namespace Fsl::Graphics3D
+{
+  class Mesh;
+
+  //! A chain of meshes with decreasing detail, level zero is the full detail mesh.
+  class MeshLodChain
+  {
+    std::vector<std::shared_ptr<Mesh>> m_meshes;
+    std::vector<float> m_errors;
+
+  public:
+    MeshLodChain() = default;
+
+    //! @param meshes the meshes (can not contain null entries)
+    //! @param errors the geometric error of each level in model space units (must be one per mesh and never decrease)
+    MeshLodChain(std::vector<std::shared_ptr<Mesh>> meshes, std::vector<float> errors);
+
+    bool Empty() const noexcept
+    {
+      return m_meshes.empty();
+    }
+
+    //! @brief Get the number of levels
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_meshes.size());
+    }
+
+    const std::shared_ptr<Mesh>& GetMesh(const uint32_t level) const
+    {
+      return m_meshes.at(level);
+    }
+
+    //! @brief Get the geometric error of the given level in model space units.
+    float GetError(const uint32_t level) const
+    {
+      return m_errors.at(level);
+    }
+
+    //! @brief Get the geometric error of all levels in model space units.
+    ReadOnlySpan<float> GetErrors() const noexcept
+    {
+      return ReadOnlySpan<float>(m_errors.data(), m_errors.size());
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODGENERATOR_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODGENERATOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics3D/BasicScene/MeshAllocatorFunc.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodChain.hpp>
+#include <memory>
+
+namespace Fsl::Graphics3D
+{
+  class Mesh;
+}
+
+namespace Fsl::Graphics3D::MeshLodGenerator
+{
+  //! Each level targets half the triangles of the previous level
+  constexpr float DefaultReduction = 0.5f;
+  //! The max error relative to the mesh extent
+  constexpr float DefaultMaxError = 0.05f;
+
+  //! @brief Generate a LOD chain for the mesh.
+  //!        Every level is simplified from the source mesh and only receives the vertices it uses.
+  //!        The generation stops early when a level can not be reduced to less than 90% of the previous level within maxError.
+  //! @param srcMesh the full detail mesh (becomes level zero).
+  //! @param meshAllocator used to allocate the level meshes, it must create meshes with the same vertex declaration as srcMesh.
+  //! @param maxLevels the max number of levels including level zero (>= 1).
+  //! @param reduction the triangle count of a level relative to the previous (0 < reduction < 1).
+  //! @param maxError the max error relative to the mesh extent.
+  //! @return the chain, meshes that are not triangle lists or that lack a Vector3 position only get level zero.
+  MeshLodChain Generate(const std::shared_ptr<Mesh>& srcMesh, const MeshAllocatorFunc& meshAllocator, const uint32_t maxLevels,
+                        const float reduction = DefaultReduction, const float maxError = DefaultMaxError);
+}
+
+#endif
@@ -0,0 +1,112 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODSELECTOR_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHLODSELECTOR_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodChain.hpp>
+#include <limits>
+
+namespace Fsl::Graphics3D
+{
+  //! Selects the coarsest level of a MeshLodChain whose geometric error projects to less than the allowed number of pixels.
+  class MeshLodSelector
+  {
+    //! Converts an error at distance one to pixels
+    float m_projectionScale{std::numeric_limits<float>::max()};
+    float m_maxScreenError{1.0f};
+
+  public:
+    //! The default selector has no projection so it only selects levels without any error
+    constexpr MeshLodSelector() noexcept = default;
+
+    //! @param fovY the vertical field of view in radians (0 < fovY < pi)
+    //! @param viewportHeight the viewport height in pixels
+    //! @param maxScreenError the max allowed error in pixels (> 0)
+    MeshLodSelector(const float fovY, const float viewportHeight, const float maxScreenError);
+
+    //! @brief Update the projection (call this when the viewport is resized or the field of view changes)
+    void SetProjection(const float fovY, const float viewportHeight);
+
+    float GetMaxScreenError() const noexcept
+    {
+      return m_maxScreenError;
+    }
+
+    void SetMaxScreenError(const float maxScreenError);
+
+    //! @brief Calculate the size in pixels of a model space error at the given distance from the camera.
+    float CalcScreenError(const float error, const float distance) const noexcept
+    {
+      return distance > 0.0f ? (error * m_projectionScale) / distance : (error > 0.0f ? std::numeric_limits<float>::infinity() : 0.0f);
+    }
+
+    //! @brief Select the level to render.
+    //! @param levelErrors the model space error of each level (never decreasing).
+    //! @param distance the distance from the camera to the closest point of the mesh bounds.
+    //! @param scale the largest scale of the world matrix (converts the model space errors to world space).
+    //! @return the selected level (levelErrors.size() - 1 at most, zero if levelErrors is empty).
+    uint32_t Select(const ReadOnlySpan<float> levelErrors, const float distance, const float scale = 1.0f) const noexcept
+    {
+      auto level = static_cast<uint32_t>(levelErrors.size());
+      while (level > 1u)
+      {
+        --level;
+        if (CalcScreenError(levelErrors[level] * scale, distance) <= m_maxScreenError)
+        {
+          return level;
+        }
+      }
+      return 0u;
+    }
+
+    uint32_t Select(const MeshLodChain& chain, const float distance, const float scale = 1.0f) const noexcept
+    {
+      return Select(chain.GetErrors(), distance, scale);
+    }
+
+    //! @brief Select a level using fixed distances.
+    //! @param levelDistances levelDistances[i] is the distance where level i + 1 starts to be used (must be increasing).
+    //! @return the selected level
+    static uint32_t SelectByDistance(const ReadOnlySpan<float> levelDistances, const float distance) noexcept
+    {
+      uint32_t level = 0;
+      while (level < levelDistances.size() && distance >= levelDistances[level])
+      {
+        ++level;
+      }
+      return level;
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,72 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHOPTIMIZEFLAGS_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHOPTIMIZEFLAGS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::Graphics3D
+{
+  enum class MeshOptimizeFlags : uint32_t
+  {
+    NoFlags = 0x00,
+    //! Merge duplicated vertices (requires a Vector3 position element)
+    WeldVertices = 0x01,
+    //! Reorder the triangles for the post transform vertex cache (forsyth)
+    VertexCache = 0x02,
+    //! Reorder the vertices in the order they are first used and drop unused vertices
+    VertexFetch = 0x04,
+
+    Default = VertexCache | VertexFetch,
+    All = WeldVertices | VertexCache | VertexFetch
+  };
+
+  constexpr inline MeshOptimizeFlags operator|(const MeshOptimizeFlags lhs, const MeshOptimizeFlags rhs) noexcept
+  {
+    return static_cast<MeshOptimizeFlags>(static_cast<uint32_t>(lhs) | static_cast<uint32_t>(rhs));
+  }
+
+  constexpr inline MeshOptimizeFlags operator&(const MeshOptimizeFlags lhs, const MeshOptimizeFlags rhs) noexcept
+  {
+    return static_cast<MeshOptimizeFlags>(static_cast<uint32_t>(lhs) & static_cast<uint32_t>(rhs));
+  }
+
+
+  namespace MeshOptimizeFlagsUtil
+  {
+    constexpr inline bool IsEnabled(const MeshOptimizeFlags srcFlag, MeshOptimizeFlags flag) noexcept
+    {
+      return (srcFlag & flag) == flag;
+    }
+  }
+}
+
+#endif
@@ -0,0 +1,64 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHOPTIMIZER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHOPTIMIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshOptimizeFlags.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheStats.hpp>
+
+namespace Fsl::Graphics3D
+{
+  class Mesh;
+  class Scene;
+
+  //! @brief Applies the mesh optimization passes directly to a Graphics3D mesh (any vertex type and 8, 16 or 32 bit indices).
+  //!        This can be used at build time before saving the mesh or directly after a mesh was generated or imported.
+  //! @note  Only triangle lists are optimized, other primitive types are left untouched.
+  namespace MeshOptimizer
+  {
+    //! @brief Optimize the given mesh
+    //! @param rMesh the mesh to optimize
+    //! @param flags the passes to run
+    //! @param weldEpsilon the position epsilon used when welding vertices
+    //! @return true if the mesh was optimized, false if it was left untouched
+    bool Optimize(Mesh& rMesh, const MeshOptimizeFlags flags = MeshOptimizeFlags::Default, const float weldEpsilon = 0.0f);
+
+    //! @brief Optimize all meshes in the given scene
+    //! @return the number of meshes that were optimized
+    uint32_t Optimize(Scene& rScene, const MeshOptimizeFlags flags = MeshOptimizeFlags::Default, const float weldEpsilon = 0.0f);
+
+    //! @brief Analyze the vertex cache efficiency of a triangle list mesh
+    VertexCacheStats Analyze(const Mesh& mesh, const uint32_t cacheSize = 16);
+  }
+}
+
+#endif
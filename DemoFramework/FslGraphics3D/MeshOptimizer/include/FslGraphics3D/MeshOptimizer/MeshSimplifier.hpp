@@ -0,0 +1,66 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHSIMPLIFIER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHSIMPLIFIER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshSimplifyResult.hpp>
+
+//! Triangle list simplification using quadric error metrics and half edge collapses.
+//! The simplifier only rewrites the index buffer so all levels produced from the same vertex buffer can share it.
+//!
+//! Attribute handling:
+//! - Vertices that share a position but have different attributes (normal/uv seams) are never moved, so the seams stay intact.
+//! - Vertices on an open border can only slide along the border and the border edges are given an extra quadric, so the outline is preserved.
+namespace Fsl::Graphics3D::MeshSimplifier
+{
+  //! @brief Calculate the value needed to convert a relative MeshSimplifyResult.Error to model space units (the largest side of the bounding box).
+  float CalcErrorScale(const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride, const uint32_t positionOffset);
+
+  //! @brief Simplify a triangle list.
+  //! @param dstIndices receives the simplified triangle list (dstIndices.size() >= srcIndices.size()).
+  //! @param srcIndices the triangle list (must be a multiple of three).
+  //! @param pVertices the vertices.
+  //! @param vertexCount the number of vertices (all indices must be < vertexCount).
+  //! @param vertexStride the byte size of one vertex.
+  //! @param positionOffset the byte offset of the Vector3 position inside the vertex.
+  //! @param targetIndexCount the simplifier stops once the index count is <= this.
+  //! @param targetError the max error allowed relative to the mesh extent (0.01 = one percent), the simplifier stops before exceeding it
+  //!                    even if targetIndexCount has not been reached.
+  //! @note  dstIndices and srcIndices may be the same span.
+  MeshSimplifyResult Simplify(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const void* const pVertices,
+                              const uint32_t vertexCount, const uint32_t vertexStride, const uint32_t positionOffset, const uint32_t targetIndexCount,
+                              const float targetError);
+}
+
+#endif
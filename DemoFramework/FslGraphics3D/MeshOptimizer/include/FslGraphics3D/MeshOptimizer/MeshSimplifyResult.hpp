@@ -0,0 +1,65 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHSIMPLIFYRESULT_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHSIMPLIFYRESULT_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::Graphics3D
+{
+  struct MeshSimplifyResult
+  {
+    //! The number of indices in the simplified triangle list
+    uint32_t IndexCount{0};
+    //! The approximate geometric error introduced by the simplification relative to the mesh extent
+    //! (multiply with MeshSimplifier::CalcErrorScale to get it in model space units).
+    float Error{0.0f};
+
+    constexpr MeshSimplifyResult() noexcept = default;
+    constexpr MeshSimplifyResult(const uint32_t indexCount, const float error) noexcept
+      : IndexCount(indexCount)
+      , Error(error)
+    {
+    }
+
+    constexpr bool operator==(const MeshSimplifyResult& rhs) const noexcept
+    {
+      return IndexCount == rhs.IndexCount && Error == rhs.Error;
+    }
+
+    constexpr bool operator!=(const MeshSimplifyResult& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
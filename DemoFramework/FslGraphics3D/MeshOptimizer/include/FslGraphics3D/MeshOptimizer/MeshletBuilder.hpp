@@ -0,0 +1,80 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHLETBUILDER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHLETBUILDER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
+
+namespace Fsl::Graphics3D
+{
+  class Mesh;
+  class Scene;
+}
+
+namespace Fsl::Graphics3D::MeshletBuilder
+{
+  //! The default meshlet limits (fits the common mesh shader recommendations of 64 vertices and 124 triangles)
+  constexpr uint32_t DefaultMaxVertices = 64;
+  constexpr uint32_t DefaultMaxTriangles = 124;
+
+  //! The meshlet triangles use 8bit local indices
+  constexpr uint32_t MaxVerticesLimit = 256;
+  constexpr uint32_t MaxTrianglesLimit = 512;
+
+  //! @brief Split a triangle list into meshlets.
+  //!        The triangles are grouped greedily by connectivity starting from the triangle order of the index buffer, so running the vertex cache
+  //!        optimizer first generally produces tighter meshlets.
+  //! @param indices the triangle list (must be a multiple of three).
+  //! @param pVertices the vertices.
+  //! @param vertexCount the number of vertices (all indices must be < vertexCount).
+  //! @param vertexStride the byte size of one vertex.
+  //! @param positionOffset the byte offset of the Vector3 position inside the vertex.
+  //! @param maxVertices the max number of vertices per meshlet (3 <= maxVertices <= MaxVerticesLimit).
+  //! @param maxTriangles the max number of triangles per meshlet (1 <= maxTriangles <= MaxTrianglesLimit).
+  MeshletData Build(const ReadOnlySpan<uint16_t> indices, const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                    const uint32_t positionOffset, const uint32_t maxVertices = DefaultMaxVertices,
+                    const uint32_t maxTriangles = DefaultMaxTriangles);
+  MeshletData Build(const ReadOnlySpan<uint32_t> indices, const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                    const uint32_t positionOffset, const uint32_t maxVertices = DefaultMaxVertices,
+                    const uint32_t maxTriangles = DefaultMaxTriangles);
+
+  //! @brief Build the meshlets for the mesh and assign them to it.
+  //! @return true if meshlets were build, false if the mesh is not a triangle list or has no Vector3 position.
+  bool Build(Mesh& rMesh, const uint32_t maxVertices = DefaultMaxVertices, const uint32_t maxTriangles = DefaultMaxTriangles);
+
+  //! @brief Build the meshlets for all meshes in the scene.
+  //! @return the number of meshes that received meshlets.
+  uint32_t Build(Scene& rScene, const uint32_t maxVertices = DefaultMaxVertices, const uint32_t maxTriangles = DefaultMaxTriangles);
+}
+
+#endif
@@ -0,0 +1,76 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHLETCULLER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHLETCULLER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/BoundingFrustum.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletCullStats.hpp>
+
+//! CPU culling of meshlets.
+//! All tests expect the frustum and camera position to be in the same space as the mesh (model space), so for a instanced mesh transform the
+//! camera into the instance space (or transform the frustum with the inverse world matrix) instead of transforming every meshlet.
+namespace Fsl::Graphics3D::MeshletCuller
+{
+  //! @brief Check if all triangles in the meshlet are facing away from the camera
+  inline bool IsBackFacing(const Meshlet& meshlet, const Vector3& cameraPosition) noexcept
+  {
+    const Vector3 direction = meshlet.ConeApex - cameraPosition;
+    const float lengthSquared = direction.LengthSquared();
+    // dot(normalize(direction), axis) >= cutoff without the sqrt and division
+    const float dot = Vector3::Dot(direction, meshlet.ConeAxis);
+    return meshlet.ConeCutoff < 1.0f && dot >= 0.0f && (dot * dot) >= (meshlet.ConeCutoff * meshlet.ConeCutoff * lengthSquared);
+  }
+
+  //! @brief Check if the meshlet is inside the frustum and not back facing
+  bool IsVisible(const Meshlet& meshlet, const BoundingFrustum& frustum, const Vector3& cameraPosition);
+
+  //! @brief Cull all meshlets
+  //! @param dstVisibleMeshlets receives the indices of the visible meshlets (must be able to hold meshlets.Count() entries)
+  //! @return the culling stats, the first stats.Visible entries of dstVisibleMeshlets are valid.
+  MeshletCullStats Cull(Span<uint32_t> dstVisibleMeshlets, const MeshletData& meshlets, const BoundingFrustum& frustum,
+                        const Vector3& cameraPosition);
+
+  //! @brief Calculate the number of mesh indices needed to render the given meshlets as a triangle list.
+  uint32_t CalcIndexCount(const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices);
+
+  //! @brief Write the mesh triangle list for the given meshlets (so only the visible parts of a mesh can be drawn with a dynamic index buffer)
+  //! @param dstIndices receives the mesh indices (must be able to hold CalcIndexCount entries).
+  //! @return the number of indices written
+  uint32_t ExtractIndices(Span<uint32_t> dstIndices, const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices);
+  uint32_t ExtractIndices(Span<uint16_t> dstIndices, const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices);
+}
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXCACHEOPTIMIZER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXCACHEOPTIMIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheStats.hpp>
+
+namespace Fsl::Graphics3D::VertexCacheOptimizer
+{
+  //! The cache size used by the forsyth scoring function
+  constexpr uint32_t DefaultForsythCacheSize = 32;
+  //! The cache size used by default by tipsify
+  constexpr uint32_t DefaultTipsifyCacheSize = 16;
+  //! The FIFO cache size used by default when analyzing
+  constexpr uint32_t DefaultAnalyzeCacheSize = 16;
+
+  //! @brief Reorder the triangles of a triangle list to improve post transform vertex cache utilization.
+  //!        This uses Tom Forsyth's 'Linear-Speed Vertex Cache Optimisation' which is cache size independent and works well on most hardware.
+  //! @param dstIndices the reordered triangle list (dstIndices.size() == srcIndices.size()).
+  //! @param srcIndices the triangle list to reorder (must be a multiple of three).
+  //! @param vertexCount the number of vertices referenced by the indices (all indices must be < vertexCount).
+  //! @note  srcIndices and dstIndices can not overlap.
+  void OptimizeForsyth(Span<uint16_t> dstIndices, const ReadOnlySpan<uint16_t> srcIndices, const uint32_t vertexCount);
+  void OptimizeForsyth(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const uint32_t vertexCount);
+
+  //! @brief Reorder the triangles of a triangle list to improve post transform vertex cache utilization and overdraw.
+  //!        This uses 'Tipsify' (Sander, Nehab and Barczak 2007) which targets a specific FIFO cache size and runs in linear time.
+  //!        Tipsify generally produces slightly worse ACMR than forsyth, but is faster and produces more localized clusters.
+  //! @param dstIndices the reordered triangle list (dstIndices.size() == srcIndices.size()).
+  //! @param srcIndices the triangle list to reorder (must be a multiple of three).
+  //! @param vertexCount the number of vertices referenced by the indices (all indices must be < vertexCount).
+  //! @param cacheSize the size of the FIFO cache to optimize for.
+  //! @note  srcIndices and dstIndices can not overlap.
+  void OptimizeTipsify(Span<uint16_t> dstIndices, const ReadOnlySpan<uint16_t> srcIndices, const uint32_t vertexCount,
+                       const uint32_t cacheSize = DefaultTipsifyCacheSize);
+  void OptimizeTipsify(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const uint32_t vertexCount,
+                       const uint32_t cacheSize = DefaultTipsifyCacheSize);
+
+  //! @brief Simulate a FIFO post transform vertex cache of the given size and calculate the ACMR and ATVR of the triangle list.
+  VertexCacheStats Analyze(const ReadOnlySpan<uint16_t> indices, const uint32_t vertexCount, const uint32_t cacheSize = DefaultAnalyzeCacheSize);
+  VertexCacheStats Analyze(const ReadOnlySpan<uint32_t> indices, const uint32_t vertexCount, const uint32_t cacheSize = DefaultAnalyzeCacheSize);
+}
+
+#endif
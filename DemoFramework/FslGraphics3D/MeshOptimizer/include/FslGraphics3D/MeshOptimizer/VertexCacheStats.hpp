@@ -0,0 +1,58 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXCACHESTATS_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXCACHESTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::Graphics3D
+{
+  //! @brief The result of simulating a post transform vertex cache
+  struct VertexCacheStats
+  {
+    //! The number of vertices that had to be transformed (cache misses)
+    uint32_t VerticesTransformed{0};
+    //! Average cache miss ratio (transformed vertices per triangle), 0.5 is the theoretical optimum for a regular grid, 3.0 is the worst case.
+    float ACMR{0.0f};
+    //! Average transform to vertex ratio (transformed vertices per referenced vertex), 1.0 is optimal.
+    float ATVR{0.0f};
+
+    constexpr VertexCacheStats() noexcept = default;
+    constexpr VertexCacheStats(const uint32_t verticesTransformed, const float acmr, const float atvr) noexcept
+      : VerticesTransformed(verticesTransformed)
+      , ACMR(acmr)
+      , ATVR(atvr)
+    {
+    }
+  };
+}
+
+#endif
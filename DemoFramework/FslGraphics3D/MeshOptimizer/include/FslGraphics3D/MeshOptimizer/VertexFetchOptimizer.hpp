@@ -0,0 +1,82 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXFETCHOPTIMIZER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXFETCHOPTIMIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <stdexcept>
+
+namespace Fsl::Graphics3D::VertexFetchOptimizer
+{
+  //! Marks a vertex that is not referenced by any index in a remap table
+  constexpr uint32_t UnusedVertex = 0xFFFFFFFF;
+
+  //! @brief Build a remap table that orders the vertices in the order they are first referenced by the index buffer.
+  //!        Applying it improves the locality of the vertex fetches and removes all unreferenced vertices.
+  //! @param dstRemap the remap table (dstRemap.size() == vertexCount), unreferenced vertices are marked with UnusedVertex
+  //! @param indices the index buffer
+  //! @return the number of referenced vertices.
+  uint32_t BuildRemap(Span<uint32_t> dstRemap, const ReadOnlySpan<uint16_t> indices);
+  uint32_t BuildRemap(Span<uint32_t> dstRemap, const ReadOnlySpan<uint32_t> indices);
+
+  //! @brief Apply a remap table to the index buffer (in place)
+  void RemapIndices(Span<uint16_t> indices, const ReadOnlySpan<uint32_t> remap);
+  void RemapIndices(Span<uint32_t> indices, const ReadOnlySpan<uint32_t> remap);
+
+  //! @brief Apply a remap table to a raw vertex buffer
+  //! @param pDstVertices the dst vertex buffer (capacity must be >= the number of referenced vertices)
+  //! @param pSrcVertices the src vertex buffer (contains remap.size() vertices)
+  //! @param vertexStride the size of one vertex in bytes
+  //! @note  pDstVertices and pSrcVertices can not overlap.
+  void RemapVertices(void* const pDstVertices, const void* const pSrcVertices, const uint32_t vertexStride, const ReadOnlySpan<uint32_t> remap);
+
+  //! @brief Apply a remap table to a typed vertex buffer
+  //! @note  dstVertices and srcVertices can not overlap.
+  template <typename TVertex>
+  void RemapVertices(Span<TVertex> dstVertices, const ReadOnlySpan<TVertex> srcVertices, const ReadOnlySpan<uint32_t> remap)
+  {
+    if (srcVertices.size() != remap.size())
+    {
+      throw std::invalid_argument("remap must contain one entry per src vertex");
+    }
+    for (std::size_t i = 0; i < remap.size(); ++i)
+    {
+      if (remap[i] != UnusedVertex)
+      {
+        dstVertices[remap[i]] = srcVertices[i];
+      }
+    }
+  }
+}
+
+#endif
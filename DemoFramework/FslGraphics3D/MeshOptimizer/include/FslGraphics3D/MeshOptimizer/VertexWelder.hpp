@@ -0,0 +1,56 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXWELDER_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_VERTEXWELDER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+
+namespace Fsl::Graphics3D::VertexWelder
+{
+  //! @brief Merge vertices whose position is within 'positionEpsilon' of each other and whose remaining bytes are identical.
+  //!        Vertices are located through a uniform hash grid with a cell size of 'positionEpsilon' so the cost is linear in the vertex count.
+  //!        Requiring all other attributes to be bitwise equal means that normal, color and texture coordinate seams are preserved.
+  //! @param dstRemap receives the index of the unique vertex each src vertex was merged into (dstRemap.size() == vertexCount)
+  //! @param pDstVertices receives the unique vertices (capacity must be >= vertexCount)
+  //! @param pSrcVertices the src vertices
+  //! @param vertexCount the number of vertices in pSrcVertices
+  //! @param vertexStride the byte size of one vertex
+  //! @param positionOffset the byte offset of the Vector3 position inside the vertex
+  //! @param positionEpsilon the max distance per axis between two positions that are considered equal (0 for exact matches)
+  //! @return the number of unique vertices written to pDstVertices
+  //! @note  pDstVertices and pSrcVertices can not overlap.
+  uint32_t Weld(Span<uint32_t> dstRemap, void* const pDstVertices, const void* const pSrcVertices, const uint32_t vertexCount,
+                const uint32_t vertexStride, const uint32_t positionOffset, const float positionEpsilon);
+}
+
+#endif
@@ -0,0 +1,97 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include "MeshContentUtil.hpp"
+#include <FslBase/Exceptions.hpp>
+#include <cstring>
+
+namespace Fsl::Graphics3D::MeshContentUtil
+{
+  void ReadIndices(std::vector<uint32_t>& rDst, const void* const pSrc, const uint32_t indexCount, const uint32_t indexStride)
+  {
+    rDst.resize(indexCount);
+    switch (indexStride)
+    {
+    case 1:
+      for (uint32_t i = 0; i < indexCount; ++i)
+      {
+        rDst[i] = static_cast<const uint8_t*>(pSrc)[i];
+      }
+      break;
+    case 2:
+      for (uint32_t i = 0; i < indexCount; ++i)
+      {
+        rDst[i] = static_cast<const uint16_t*>(pSrc)[i];
+      }
+      break;
+    case 4:
+      std::memcpy(rDst.data(), pSrc, indexCount * sizeof(uint32_t));
+      break;
+    default:
+      throw NotSupportedException("Unsupported index stride");
+    }
+  }
+
+  void WriteIndices(void* const pDst, const uint32_t indexStride, const std::vector<uint32_t>& src)
+  {
+    switch (indexStride)
+    {
+    case 1:
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        static_cast<uint8_t*>(pDst)[i] = static_cast<uint8_t>(src[i]);
+      }
+      break;
+    case 2:
+      for (std::size_t i = 0; i < src.size(); ++i)
+      {
+        static_cast<uint16_t*>(pDst)[i] = static_cast<uint16_t>(src[i]);
+      }
+      break;
+    case 4:
+      std::memcpy(pDst, src.data(), src.size() * sizeof(uint32_t));
+      break;
+    default:
+      throw NotSupportedException("Unsupported index stride");
+    }
+  }
+
+  bool TryGetPositionOffset(const VertexDeclarationSpan& vertexDeclaration, uint32_t& rOffset)
+  {
+    const int32_t index = vertexDeclaration.VertexElementIndexOf(VertexElementUsage::Position, 0);
+    if (index < 0 || vertexDeclaration[index].Format != VertexElementFormat::Vector3)
+    {
+      return false;
+    }
+    rOffset = vertexDeclaration[index].Offset;
+    return true;
+  }
+}
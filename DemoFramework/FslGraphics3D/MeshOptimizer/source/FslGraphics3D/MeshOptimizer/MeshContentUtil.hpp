@@ -0,0 +1,50 @@
+#ifndef FSLGRAPHICS3D_MESHOPTIMIZER_MESHCONTENTUTIL_HPP
+#define FSLGRAPHICS3D_MESHOPTIMIZER_MESHCONTENTUTIL_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <vector>
+
+namespace Fsl::Graphics3D::MeshContentUtil
+{
+  //! @brief Read 8, 16 or 32 bit indices into a 32bit index array
+  void ReadIndices(std::vector<uint32_t>& rDst, const void* const pSrc, const uint32_t indexCount, const uint32_t indexStride);
+
+  //! @brief Write the 32bit indices to a 8, 16 or 32 bit index array
+  void WriteIndices(void* const pDst, const uint32_t indexStride, const std::vector<uint32_t>& src);
+
+  //! @brief Locate the offset of the Vector3 position in the vertex
+  bool TryGetPositionOffset(const VertexDeclarationSpan& vertexDeclaration, uint32_t& rOffset);
+}
+
+#endif
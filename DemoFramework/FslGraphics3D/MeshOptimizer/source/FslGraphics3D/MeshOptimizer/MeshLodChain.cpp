@@ -0,0 +1,59 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics3D/BasicScene/Mesh.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodChain.hpp>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl::Graphics3D
+{
+  MeshLodChain::MeshLodChain(std::vector<std::shared_ptr<Mesh>> meshes, std::vector<float> errors)
+    : m_meshes(std::move(meshes))
+    , m_errors(std::move(errors))
+  {
+    if (m_meshes.size() != m_errors.size())
+    {
+      throw std::invalid_argument("there must be one error per mesh");
+    }
+    for (std::size_t i = 0; i < m_meshes.size(); ++i)
+    {
+      if (!m_meshes[i])
+      {
+        throw std::invalid_argument("meshes can not contain null");
+      }
+      if (m_errors[i] < 0.0f || (i > 0 && m_errors[i] < m_errors[i - 1]))
+      {
+        throw std::invalid_argument("errors must be positive and never decrease");
+      }
+    }
+  }
+}
@@ -0,0 +1,137 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics3D/BasicScene/Mesh.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodGenerator.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshSimplifier.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexFetchOptimizer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <vector>
+#include "MeshContentUtil.hpp"
+
+namespace Fsl::Graphics3D::MeshLodGenerator
+{
+  using namespace MeshContentUtil;
+
+  namespace
+  {
+    //! A level must have less than this many triangles compared to the previous level, or the generation stops
+    constexpr float MinLevelReduction = 0.9f;
+
+    std::shared_ptr<Mesh> CreateLevelMesh(const Mesh& srcMesh, const MeshAllocatorFunc& meshAllocator, const RawMeshContent& srcContent,
+                                          std::vector<uint32_t>& rIndices)
+    {
+      // Only keep the vertices used by this level
+      std::vector<uint32_t> remap(srcContent.VertexCount);
+      const uint32_t vertexCount = VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(rIndices));
+      VertexFetchOptimizer::RemapIndices(SpanUtil::AsSpan(rIndices), SpanUtil::AsReadOnlySpan(remap));
+
+      std::shared_ptr<Mesh> mesh = meshAllocator(vertexCount, rIndices.size(), PrimitiveType::TriangleList);
+      if (!mesh || mesh->AsVertexDeclarationSpan() != srcMesh.AsVertexDeclarationSpan())
+      {
+        throw NotSupportedException("The mesh allocator must create meshes with the same vertex declaration as the source mesh");
+      }
+      mesh->SetName(srcMesh.GetName());
+      mesh->SetMaterialIndex(srcMesh.GetMaterialIndex());
+
+      RawMeshContentEx dstContent = mesh->GenericDirectAccess();
+      VertexFetchOptimizer::RemapVertices(dstContent.pVertices, srcContent.pVertices, static_cast<uint32_t>(srcContent.VertexStride),
+                                          SpanUtil::AsReadOnlySpan(remap));
+      WriteIndices(dstContent.pIndices, dstContent.IndexStride, rIndices);
+      return mesh;
+    }
+  }
+
+
+  MeshLodChain Generate(const std::shared_ptr<Mesh>& srcMesh, const MeshAllocatorFunc& meshAllocator, const uint32_t maxLevels,
+                        const float reduction, const float maxError)
+  {
+    if (!srcMesh)
+    {
+      throw std::invalid_argument("srcMesh can not be null");
+    }
+    if (!meshAllocator)
+    {
+      throw std::invalid_argument("meshAllocator can not be null");
+    }
+    if (maxLevels < 1)
+    {
+      throw std::invalid_argument("maxLevels must be >= 1");
+    }
+    if (reduction <= 0.0f || reduction >= 1.0f)
+    {
+      throw std::invalid_argument("reduction must be in the range ]0, 1[");
+    }
+
+    std::vector<std::shared_ptr<Mesh>> meshes{srcMesh};
+    std::vector<float> errors{0.0f};
+
+    uint32_t positionOffset = 0;
+    if (maxLevels == 1 || srcMesh->GetPrimitiveType() != PrimitiveType::TriangleList ||
+        !TryGetPositionOffset(srcMesh->AsVertexDeclarationSpan(), positionOffset))
+    {
+      return {std::move(meshes), std::move(errors)};
+    }
+
+    const RawMeshContent content = static_cast<const Mesh&>(*srcMesh).GenericDirectAccess();
+    const auto vertexCount = static_cast<uint32_t>(content.VertexCount);
+    const auto vertexStride = static_cast<uint32_t>(content.VertexStride);
+    std::vector<uint32_t> srcIndices;
+    ReadIndices(srcIndices, content.pIndices, static_cast<uint32_t>(content.IndexCount), static_cast<uint32_t>(content.IndexStride));
+
+    const float errorScale = MeshSimplifier::CalcErrorScale(content.pVertices, vertexCount, vertexStride, positionOffset);
+    std::vector<uint32_t> indices(srcIndices.size());
+    auto previousTriangleCount = static_cast<uint32_t>(srcIndices.size() / 3);
+    float targetTriangleCount = static_cast<float>(previousTriangleCount);
+    while (meshes.size() < maxLevels && previousTriangleCount > 1)
+    {
+      targetTriangleCount *= reduction;
+      const auto targetIndexCount = static_cast<uint32_t>(targetTriangleCount) * 3u;
+      // Simplifying from the source every time keeps the error of one level from accumulating into the next
+      const MeshSimplifyResult result = MeshSimplifier::Simplify(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(srcIndices), content.pVertices,
+                                                                 vertexCount, vertexStride, positionOffset, targetIndexCount, maxError);
+      const uint32_t triangleCount = result.IndexCount / 3;
+      if (triangleCount == 0 || static_cast<float>(triangleCount) >= (static_cast<float>(previousTriangleCount) * MinLevelReduction))
+      {
+        break;
+      }
+
+      std::vector<uint32_t> levelIndices(indices.begin(), indices.begin() + result.IndexCount);
+      meshes.push_back(CreateLevelMesh(*srcMesh, meshAllocator, content, levelIndices));
+      errors.push_back(std::max(result.Error * errorScale, errors.back()));
+      previousTriangleCount = triangleCount;
+    }
+    return {std::move(meshes), std::move(errors)};
+  }
+}
@@ -0,0 +1,68 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshLodSelector.hpp>
+#include <cmath>
+#include <stdexcept>
+
+namespace Fsl::Graphics3D
+{
+  MeshLodSelector::MeshLodSelector(const float fovY, const float viewportHeight, const float maxScreenError)
+  {
+    SetProjection(fovY, viewportHeight);
+    SetMaxScreenError(maxScreenError);
+  }
+
+
+  void MeshLodSelector::SetProjection(const float fovY, const float viewportHeight)
+  {
+    if (fovY <= 0.0f || fovY >= MathHelper::PI)
+    {
+      throw std::invalid_argument("fovY must be in the range ]0, pi[");
+    }
+    if (viewportHeight < 0.0f)
+    {
+      throw std::invalid_argument("viewportHeight can not be negative");
+    }
+    m_projectionScale = viewportHeight / (2.0f * std::tan(fovY * 0.5f));
+  }
+
+
+  void MeshLodSelector::SetMaxScreenError(const float maxScreenError)
+  {
+    if (maxScreenError <= 0.0f)
+    {
+      throw std::invalid_argument("maxScreenError must be positive");
+    }
+    m_maxScreenError = maxScreenError;
+  }
+}
@@ -0,0 +1,159 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <FslGraphics3D/BasicScene/Mesh.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
+#include <FslGraphics3D/BasicScene/Scene.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshOptimizer.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheOptimizer.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexFetchOptimizer.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexWelder.hpp>
+#include <cstring>
+#include <vector>
+#include "MeshContentUtil.hpp"
+
+namespace Fsl::Graphics3D::MeshOptimizer
+{
+  using namespace MeshContentUtil;
+
+  bool Optimize(Mesh& rMesh, const MeshOptimizeFlags flags, const float weldEpsilon)
+  {
+    if (rMesh.GetPrimitiveType() != PrimitiveType::TriangleList || flags == MeshOptimizeFlags::NoFlags)
+    {
+      return false;
+    }
+
+    const RawMeshContent content = static_cast<const Mesh&>(rMesh).GenericDirectAccess();
+    if (content.IndexCount == 0 || content.VertexCount == 0)
+    {
+      return false;
+    }
+
+    const auto srcVertexCount = static_cast<uint32_t>(content.VertexCount);
+    const auto vertexStride = static_cast<uint32_t>(content.VertexStride);
+    uint32_t vertexCount = srcVertexCount;
+
+    std::vector<uint32_t> indices;
+    ReadIndices(indices, content.pIndices, static_cast<uint32_t>(content.IndexCount), static_cast<uint32_t>(content.IndexStride));
+
+    const auto* const pSrcVertices = static_cast<const uint8_t*>(content.pVertices);
+    std::vector<uint8_t> vertices(pSrcVertices, pSrcVertices + (content.VertexCount * content.VertexStride));
+    std::vector<uint8_t> scratchVertices;
+    std::vector<uint32_t> remap;
+
+    uint32_t positionOffset = 0;
+    if (MeshOptimizeFlagsUtil::IsEnabled(flags, MeshOptimizeFlags::WeldVertices))
+    {
+      if (TryGetPositionOffset(rMesh.AsVertexDeclarationSpan(), positionOffset))
+      {
+        remap.resize(vertexCount);
+        scratchVertices.resize(vertices.size());
+        vertexCount = VertexWelder::Weld(SpanUtil::AsSpan(remap), scratchVertices.data(), vertices.data(), vertexCount, vertexStride, positionOffset,
+                                         weldEpsilon);
+        VertexFetchOptimizer::RemapIndices(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(remap));
+        scratchVertices.resize(static_cast<std::size_t>(vertexCount) * vertexStride);
+        vertices.swap(scratchVertices);
+      }
+      else
+      {
+        FSLLOG3_WARNING("MeshOptimizer: WeldVertices requires a Vector3 position, skipping weld");
+      }
+    }
+
+    if (MeshOptimizeFlagsUtil::IsEnabled(flags, MeshOptimizeFlags::VertexCache))
+    {
+      std::vector<uint32_t> optimizedIndices(indices.size());
+      VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(optimizedIndices), SpanUtil::AsReadOnlySpan(indices), vertexCount);
+      indices.swap(optimizedIndices);
+    }
+
+    if (MeshOptimizeFlagsUtil::IsEnabled(flags, MeshOptimizeFlags::VertexFetch))
+    {
+      remap.resize(vertexCount);
+      const uint32_t usedVertexCount = VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(indices));
+      scratchVertices.resize(static_cast<std::size_t>(usedVertexCount) * vertexStride);
+      VertexFetchOptimizer::RemapVertices(scratchVertices.data(), vertices.data(), vertexStride, SpanUtil::AsReadOnlySpan(remap));
+      VertexFetchOptimizer::RemapIndices(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(remap));
+      vertices.swap(scratchVertices);
+      vertexCount = usedVertexCount;
+    }
+
+    if (vertexCount != srcVertexCount)
+    {
+      // Reset clears the name and material index so we restore them
+      const UTF8String name = rMesh.GetName();
+      const uint32_t materialIndex = rMesh.GetMaterialIndex();
+      rMesh.Reset(static_cast<std::size_t>(vertexCount), indices.size(), PrimitiveType::TriangleList);
+      rMesh.SetName(name);
+      rMesh.SetMaterialIndex(materialIndex);
+    }
+
+    RawMeshContentEx dstContent = rMesh.GenericDirectAccess();
+    std::memcpy(dstContent.pVertices, vertices.data(), vertices.size());
+    WriteIndices(dstContent.pIndices, dstContent.IndexStride, indices);
+    // The triangle order changed so any existing meshlets are no longer valid
+    rMesh.SetMeshlets({});
+    return true;
+  }
+
+
+  uint32_t Optimize(Scene& rScene, const MeshOptimizeFlags flags, const float weldEpsilon)
+  {
+    uint32_t optimizedCount = 0;
+    const int32_t meshCount = rScene.GetMeshCount();
+    for (int32_t i = 0; i < meshCount; ++i)
+    {
+      auto mesh = rScene.GetMeshAt(i);
+      if (mesh && Optimize(*mesh, flags, weldEpsilon))
+      {
+        ++optimizedCount;
+      }
+    }
+    return optimizedCount;
+  }
+
+
+  VertexCacheStats Analyze(const Mesh& mesh, const uint32_t cacheSize)
+  {
+    if (mesh.GetPrimitiveType() != PrimitiveType::TriangleList)
+    {
+      throw NotSupportedException("Only triangle lists can be analyzed");
+    }
+    const RawMeshContent content = mesh.GenericDirectAccess();
+    std::vector<uint32_t> indices;
+    ReadIndices(indices, content.pIndices, static_cast<uint32_t>(content.IndexCount), static_cast<uint32_t>(content.IndexStride));
+    return VertexCacheOptimizer::Analyze(SpanUtil::AsReadOnlySpan(indices), static_cast<uint32_t>(content.VertexCount), cacheSize);
+  }
+}
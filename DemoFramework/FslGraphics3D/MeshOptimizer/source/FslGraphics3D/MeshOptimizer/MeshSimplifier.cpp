@@ -0,0 +1,605 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshSimplifier.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl::Graphics3D::MeshSimplifier
+{
+  namespace
+  {
+    //! Border edges get an extra plane perpendicular to the triangle, it is scaled by this to make moving the outline expensive
+    constexpr float BorderWeight = 10.0f;
+
+    //! A pass stops at collapses that cost more than this times the cost of the collapse at the pass goal
+    constexpr float PassCostFactor = 1.5f;
+
+    enum class VertexKind : uint8_t
+    {
+      //! The vertex can collapse onto any neighbour
+      Manifold,
+      //! The vertex is on an open border and can only collapse along the border
+      Border,
+      //! The vertex is on an attribute seam or a non manifold edge and can not be moved
+      Locked
+    };
+
+    //! A symmetric 4x4 matrix storing the sum of squared distances to a set of planes
+    struct Quadric
+    {
+      float A00{0.0f};
+      float A11{0.0f};
+      float A22{0.0f};
+      float A10{0.0f};
+      float A20{0.0f};
+      float A21{0.0f};
+      float B0{0.0f};
+      float B1{0.0f};
+      float B2{0.0f};
+      float C{0.0f};
+      float Weight{0.0f};
+
+      void AddPlane(const Vector3& normal, const float distance, const float weight) noexcept
+      {
+        A00 += weight * normal.X * normal.X;
+        A11 += weight * normal.Y * normal.Y;
+        A22 += weight * normal.Z * normal.Z;
+        A10 += weight * normal.Y * normal.X;
+        A20 += weight * normal.Z * normal.X;
+        A21 += weight * normal.Z * normal.Y;
+        B0 += weight * normal.X * distance;
+        B1 += weight * normal.Y * distance;
+        B2 += weight * normal.Z * distance;
+        C += weight * distance * distance;
+      }
+
+      void Add(const Quadric& other) noexcept
+      {
+        A00 += other.A00;
+        A11 += other.A11;
+        A22 += other.A22;
+        A10 += other.A10;
+        A20 += other.A20;
+        A21 += other.A21;
+        B0 += other.B0;
+        B1 += other.B1;
+        B2 += other.B2;
+        C += other.C;
+        Weight += other.Weight;
+      }
+
+      //! @brief Get the weighted average squared distance from p to the planes
+      float Evaluate(const Vector3& p) const noexcept
+      {
+        const float ax = (A00 * p.X) + (A10 * p.Y) + (A20 * p.Z);
+        const float ay = (A10 * p.X) + (A11 * p.Y) + (A21 * p.Z);
+        const float az = (A20 * p.X) + (A21 * p.Y) + (A22 * p.Z);
+        const float result = (p.X * ax) + (p.Y * ay) + (p.Z * az) + (2.0f * ((B0 * p.X) + (B1 * p.Y) + (B2 * p.Z))) + C;
+        return std::abs(result) / (Weight > 0.0f ? Weight : 1.0f);
+      }
+    };
+
+    struct Collapse
+    {
+      uint32_t From{0};
+      uint32_t To{0};
+      float Cost{0.0f};
+    };
+
+    //! Vertex to triangle adjacency stored as a compressed sparse row
+    struct TriangleAdjacency
+    {
+      std::vector<uint32_t> Offsets;
+      std::vector<uint32_t> Triangles;
+
+      ReadOnlySpan<uint32_t> Get(const uint32_t vertexIndex) const noexcept
+      {
+        return ReadOnlySpan<uint32_t>(Triangles.data() + Offsets[vertexIndex], Offsets[vertexIndex + 1] - Offsets[vertexIndex]);
+      }
+    };
+
+    //! @param remap maps the indices to the vertex used for the adjacency
+    void BuildAdjacency(TriangleAdjacency& rAdjacency, const ReadOnlySpan<uint32_t> indices, const std::vector<uint32_t>& remap)
+    {
+      const auto vertexCount = static_cast<uint32_t>(remap.size());
+      rAdjacency.Offsets.assign(static_cast<std::size_t>(vertexCount) + 1u, 0u);
+      for (const uint32_t index : indices)
+      {
+        ++rAdjacency.Offsets[remap[index] + 1u];
+      }
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        rAdjacency.Offsets[i + 1] += rAdjacency.Offsets[i];
+      }
+
+      std::vector<uint32_t> fill(rAdjacency.Offsets.begin(), rAdjacency.Offsets.end() - 1);
+      rAdjacency.Triangles.resize(indices.size());
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        rAdjacency.Triangles[fill[remap[indices[i]]]++] = static_cast<uint32_t>(i / 3);
+      }
+    }
+
+    //! Read the positions and scale them so the mesh fits inside a unit cube, this keeps the quadrics well conditioned
+    //! and makes the error relative to the mesh extent.
+    std::vector<Vector3> ReadNormalizedPositions(const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                                                 const uint32_t positionOffset)
+    {
+      const auto* const pSrc = static_cast<const uint8_t*>(pVertices);
+      std::vector<Vector3> positions(vertexCount);
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        std::memcpy(&positions[i], pSrc + (static_cast<std::size_t>(i) * vertexStride) + positionOffset, sizeof(Vector3));
+      }
+      if (positions.empty())
+      {
+        return positions;
+      }
+
+      Vector3 min = positions[0];
+      Vector3 max = positions[0];
+      for (const Vector3& position : positions)
+      {
+        min = Vector3::Min(min, position);
+        max = Vector3::Max(max, position);
+      }
+      const Vector3 size = max - min;
+      const float extent = std::max(std::max(size.X, size.Y), size.Z);
+      const float scale = extent > 0.0f ? 1.0f / extent : 1.0f;
+      for (Vector3& rPosition : positions)
+      {
+        rPosition = (rPosition - min) * scale;
+      }
+      return positions;
+    }
+
+    struct PositionKey
+    {
+      std::array<uint32_t, 3> Bits{};
+
+      explicit PositionKey(const Vector3& position) noexcept
+      {
+        // Adding zero turns -0 into +0 so they compare equal
+        const std::array<float, 3> values = {position.X + 0.0f, position.Y + 0.0f, position.Z + 0.0f};
+        std::memcpy(Bits.data(), values.data(), sizeof(Bits));
+      }
+
+      bool operator==(const PositionKey& rhs) const noexcept
+      {
+        return Bits == rhs.Bits;
+      }
+    };
+
+    struct PositionKeyHash
+    {
+      std::size_t operator()(const PositionKey& key) const noexcept
+      {
+        return ((key.Bits[0] * 73856093u) ^ (key.Bits[1] * 19349663u) ^ (key.Bits[2] * 83492791u));
+      }
+    };
+
+    //! Map every vertex to the first vertex with the same position
+    std::vector<uint32_t> BuildPositionRemap(const std::vector<Vector3>& positions)
+    {
+      std::vector<uint32_t> remap(positions.size());
+      std::unordered_map<PositionKey, uint32_t, PositionKeyHash> lookup(positions.size());
+      for (uint32_t i = 0; i < static_cast<uint32_t>(positions.size()); ++i)
+      {
+        remap[i] = lookup.try_emplace(PositionKey(positions[i]), i).first->second;
+      }
+      return remap;
+    }
+
+    uint32_t CountTrianglesWithVertex(const ReadOnlySpan<uint32_t> triangles, const Span<uint32_t> indices, const std::vector<uint32_t>& remap,
+                                      const uint32_t vertexIndex)
+    {
+      uint32_t count = 0;
+      for (const uint32_t triangle : triangles)
+      {
+        const uint32_t offset = triangle * 3;
+        if (remap[indices[offset]] == vertexIndex || remap[indices[offset + 1]] == vertexIndex || remap[indices[offset + 2]] == vertexIndex)
+        {
+          ++count;
+        }
+      }
+      return count;
+    }
+
+    //! Classify the vertices and build the initial quadrics
+    void Classify(std::vector<VertexKind>& rKinds, std::vector<Quadric>& rQuadrics, const Span<uint32_t> indices,
+                  const std::vector<Vector3>& positions, const std::vector<uint32_t>& positionRemap)
+    {
+      const std::size_t vertexCount = positions.size();
+
+      // Vertices sharing a position with another referenced vertex are on an attribute seam
+      std::vector<uint8_t> referenced(vertexCount, 0u);
+      for (const uint32_t index : indices)
+      {
+        referenced[index] = 1u;
+      }
+      std::vector<uint32_t> wedgeCount(vertexCount, 0u);
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        if (referenced[i] != 0u)
+        {
+          ++wedgeCount[positionRemap[i]];
+        }
+      }
+
+      TriangleAdjacency adjacency;
+      BuildAdjacency(adjacency, indices, positionRemap);
+
+      rQuadrics.assign(vertexCount, Quadric());
+      std::vector<uint32_t> borderEdgeCount(vertexCount, 0u);
+      std::vector<uint8_t> nonManifold(vertexCount, 0u);
+      for (std::size_t offset = 0; offset < indices.size(); offset += 3)
+      {
+        const std::array<uint32_t, 3> triangle = {positionRemap[indices[offset]], positionRemap[indices[offset + 1]],
+                                                  positionRemap[indices[offset + 2]]};
+        const Vector3 normal = Vector3::Cross(positions[triangle[1]] - positions[triangle[0]], positions[triangle[2]] - positions[triangle[0]]);
+        const float length = normal.Length();
+        if (length <= 0.0f)
+        {
+          continue;
+        }
+        const Vector3 unitNormal = normal / length;
+        const float area = length * 0.5f;
+
+        Quadric quadric;
+        quadric.AddPlane(unitNormal, -Vector3::Dot(unitNormal, positions[triangle[0]]), area);
+        quadric.Weight = area;
+        for (const uint32_t vertexIndex : triangle)
+        {
+          rQuadrics[vertexIndex].Add(quadric);
+        }
+
+        for (uint32_t edge = 0; edge < 3; ++edge)
+        {
+          const uint32_t v0 = triangle[edge];
+          const uint32_t v1 = triangle[(edge + 1) % 3];
+          const uint32_t sharedCount = CountTrianglesWithVertex(adjacency.Get(v0), indices, positionRemap, v1);
+          if (sharedCount == 1)
+          {
+            // An open border, add a plane through the edge that is perpendicular to the triangle
+            const Vector3 edgeVector = positions[v1] - positions[v0];
+            const float edgeLength = edgeVector.Length();
+            const Vector3 borderNormal = Vector3::Cross(edgeVector, unitNormal) / edgeLength;
+            Quadric borderQuadric;
+            borderQuadric.AddPlane(borderNormal, -Vector3::Dot(borderNormal, positions[v0]), edgeLength * edgeLength * BorderWeight);
+            rQuadrics[v0].Add(borderQuadric);
+            rQuadrics[v1].Add(borderQuadric);
+            ++borderEdgeCount[v0];
+            ++borderEdgeCount[v1];
+          }
+          else if (sharedCount > 2)
+          {
+            nonManifold[v0] = 1u;
+            nonManifold[v1] = 1u;
+          }
+        }
+      }
+
+      rKinds.assign(vertexCount, VertexKind::Locked);
+      for (std::size_t i = 0; i < vertexCount; ++i)
+      {
+        const uint32_t vertexIndex = positionRemap[i];
+        if (wedgeCount[vertexIndex] == 1u && nonManifold[vertexIndex] == 0u)
+        {
+          if (borderEdgeCount[vertexIndex] == 0u)
+          {
+            rKinds[i] = VertexKind::Manifold;
+          }
+          else if (borderEdgeCount[vertexIndex] == 2u)
+          {
+            rKinds[i] = VertexKind::Border;
+          }
+        }
+      }
+    }
+
+    bool CanCollapse(const std::vector<VertexKind>& kinds, const uint32_t from, const uint32_t to) noexcept
+    {
+      switch (kinds[from])
+      {
+      case VertexKind::Manifold:
+        return true;
+      case VertexKind::Border:
+        return kinds[to] != VertexKind::Manifold;
+      default:
+        return false;
+      }
+    }
+
+    float CalcCollapseCost(const std::vector<Quadric>& quadrics, const std::vector<Vector3>& positions, const std::vector<uint32_t>& positionRemap,
+                           const uint32_t from, const uint32_t to) noexcept
+    {
+      return quadrics[positionRemap[from]].Evaluate(positions[to]);
+    }
+
+    void PickCollapses(std::vector<Collapse>& rCollapses, const Span<uint32_t> indices, const std::vector<VertexKind>& kinds,
+                       const std::vector<Quadric>& quadrics, const std::vector<Vector3>& positions, const std::vector<uint32_t>& positionRemap,
+                       const float maxCost)
+    {
+      rCollapses.clear();
+      for (std::size_t offset = 0; offset < indices.size(); offset += 3)
+      {
+        for (uint32_t edge = 0; edge < 3; ++edge)
+        {
+          const uint32_t v0 = indices[offset + edge];
+          const uint32_t v1 = indices[offset + ((edge + 1) % 3)];
+          const bool canCollapse0 = CanCollapse(kinds, v0, v1);
+          const bool canCollapse1 = CanCollapse(kinds, v1, v0);
+          if (!canCollapse0 && !canCollapse1)
+          {
+            continue;
+          }
+          // Pick the cheapest direction
+          const float cost0 = canCollapse0 ? CalcCollapseCost(quadrics, positions, positionRemap, v0, v1) : std::numeric_limits<float>::max();
+          const float cost1 = canCollapse1 ? CalcCollapseCost(quadrics, positions, positionRemap, v1, v0) : std::numeric_limits<float>::max();
+          const Collapse collapse = cost0 <= cost1 ? Collapse{v0, v1, cost0} : Collapse{v1, v0, cost1};
+          if (collapse.Cost <= maxCost)
+          {
+            rCollapses.push_back(collapse);
+          }
+        }
+      }
+      std::sort(rCollapses.begin(), rCollapses.end(), [](const Collapse& lhs, const Collapse& rhs) { return lhs.Cost < rhs.Cost; });
+    }
+
+    //! @brief Check that the collapse does not flip any of the remaining triangles around 'from' and count the triangles it removes.
+    //! @return false if the collapse is invalid.
+    bool TryValidateCollapse(uint32_t& rRemovedCount, const ReadOnlySpan<uint32_t> triangles, const Span<uint32_t> indices,
+                             const std::vector<uint32_t>& collapseRemap, const std::vector<uint32_t>& positionRemap,
+                             const std::vector<Vector3>& positions, const VertexKind fromKind, const uint32_t from, const uint32_t to)
+    {
+      const uint32_t toPosition = positionRemap[to];
+      uint32_t removedCount = 0;
+      for (const uint32_t triangle : triangles)
+      {
+        const uint32_t offset = triangle * 3;
+        const std::array<uint32_t, 3> vertices = {collapseRemap[indices[offset]], collapseRemap[indices[offset + 1]],
+                                                  collapseRemap[indices[offset + 2]]};
+        if (positionRemap[vertices[0]] == toPosition || positionRemap[vertices[1]] == toPosition || positionRemap[vertices[2]] == toPosition)
+        {
+          ++removedCount;
+          continue;
+        }
+
+        const Vector3 p0 = positions[vertices[0]];
+        const Vector3 p1 = positions[vertices[1]];
+        const Vector3 p2 = positions[vertices[2]];
+        const Vector3 normalBefore = Vector3::Cross(p1 - p0, p2 - p0);
+        const Vector3 q0 = vertices[0] == from ? positions[to] : p0;
+        const Vector3 q1 = vertices[1] == from ? positions[to] : p1;
+        const Vector3 q2 = vertices[2] == from ? positions[to] : p2;
+        const Vector3 normalAfter = Vector3::Cross(q1 - q0, q2 - q0);
+        if (Vector3::Dot(normalBefore, normalAfter) <= 0.0f)
+        {
+          return false;
+        }
+      }
+      // A border vertex can only slide along the border edge (which only has one triangle)
+      if (removedCount == 0 || (fromKind == VertexKind::Border && removedCount != 1))
+      {
+        return false;
+      }
+      rRemovedCount = removedCount;
+      return true;
+    }
+
+    //! @return the new index count
+    uint32_t ApplyCollapses(Span<uint32_t> indices, const std::vector<uint32_t>& collapseRemap, const std::vector<uint32_t>& positionRemap)
+    {
+      uint32_t dstIndex = 0;
+      for (std::size_t offset = 0; offset < indices.size(); offset += 3)
+      {
+        const uint32_t v0 = collapseRemap[indices[offset]];
+        const uint32_t v1 = collapseRemap[indices[offset + 1]];
+        const uint32_t v2 = collapseRemap[indices[offset + 2]];
+        const uint32_t p0 = positionRemap[v0];
+        const uint32_t p1 = positionRemap[v1];
+        const uint32_t p2 = positionRemap[v2];
+        if (p0 != p1 && p0 != p2 && p1 != p2)
+        {
+          indices[dstIndex] = v0;
+          indices[dstIndex + 1] = v1;
+          indices[dstIndex + 2] = v2;
+          dstIndex += 3;
+        }
+      }
+      return dstIndex;
+    }
+  }
+
+
+  float CalcErrorScale(const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride, const uint32_t positionOffset)
+  {
+    if (pVertices == nullptr && vertexCount > 0)
+    {
+      throw std::invalid_argument("pVertices can not be null");
+    }
+    if ((positionOffset + sizeof(Vector3)) > vertexStride)
+    {
+      throw std::invalid_argument("the position must be inside the vertex");
+    }
+    const auto* const pSrc = static_cast<const uint8_t*>(pVertices);
+    Vector3 min(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(), std::numeric_limits<float>::max());
+    Vector3 max(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest());
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      Vector3 position;
+      std::memcpy(&position, pSrc + (static_cast<std::size_t>(i) * vertexStride) + positionOffset, sizeof(Vector3));
+      min = Vector3::Min(min, position);
+      max = Vector3::Max(max, position);
+    }
+    const Vector3 size = max - min;
+    const float extent = vertexCount > 0 ? std::max(std::max(size.X, size.Y), size.Z) : 0.0f;
+    return extent > 0.0f ? extent : 1.0f;
+  }
+
+
+  MeshSimplifyResult Simplify(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const void* const pVertices,
+                              const uint32_t vertexCount, const uint32_t vertexStride, const uint32_t positionOffset, const uint32_t targetIndexCount,
+                              const float targetError)
+  {
+    if ((srcIndices.size() % 3) != 0)
+    {
+      throw std::invalid_argument("srcIndices must be a triangle list");
+    }
+    if (dstIndices.size() < srcIndices.size())
+    {
+      throw std::invalid_argument("dstIndices must be able to hold srcIndices.size() entries");
+    }
+    if (srcIndices.size() > std::numeric_limits<uint32_t>::max())
+    {
+      throw std::invalid_argument("too many indices");
+    }
+    if (pVertices == nullptr && vertexCount > 0)
+    {
+      throw std::invalid_argument("pVertices can not be null");
+    }
+    if ((positionOffset + sizeof(Vector3)) > vertexStride)
+    {
+      throw std::invalid_argument("the position must be inside the vertex");
+    }
+    if (targetError < 0.0f)
+    {
+      throw std::invalid_argument("targetError can not be negative");
+    }
+    for (const uint32_t index : srcIndices)
+    {
+      if (index >= vertexCount)
+      {
+        throw std::invalid_argument("index out of bounds");
+      }
+    }
+
+    if (dstIndices.data() != srcIndices.data())
+    {
+      std::copy(srcIndices.begin(), srcIndices.end(), dstIndices.begin());
+    }
+    auto indexCount = static_cast<uint32_t>(srcIndices.size());
+    if (indexCount <= targetIndexCount)
+    {
+      return {indexCount, 0.0f};
+    }
+
+    const std::vector<Vector3> positions = ReadNormalizedPositions(pVertices, vertexCount, vertexStride, positionOffset);
+    const std::vector<uint32_t> positionRemap = BuildPositionRemap(positions);
+
+    std::vector<VertexKind> kinds;
+    std::vector<Quadric> quadrics;
+    Classify(kinds, quadrics, dstIndices.subspan(0, indexCount), positions, positionRemap);
+
+    std::vector<uint32_t> identityRemap(vertexCount);
+    for (uint32_t i = 0; i < vertexCount; ++i)
+    {
+      identityRemap[i] = i;
+    }
+
+    const float maxCost = targetError * targetError;
+    float resultCost = 0.0f;
+    TriangleAdjacency adjacency;
+    std::vector<Collapse> collapses;
+    std::vector<uint32_t> collapseRemap(vertexCount);
+    std::vector<uint8_t> collapseLocked(vertexCount);
+    while (indexCount > targetIndexCount)
+    {
+      const Span<uint32_t> indices = dstIndices.subspan(0, indexCount);
+      PickCollapses(collapses, indices, kinds, quadrics, positions, positionRemap, maxCost);
+      if (collapses.empty())
+      {
+        break;
+      }
+
+      BuildAdjacency(adjacency, indices, identityRemap);
+      std::copy(identityRemap.begin(), identityRemap.end(), collapseRemap.begin());
+      std::fill(collapseLocked.begin(), collapseLocked.end(), uint8_t(0));
+
+      // Every edge collapse removes around two triangles. Many of the cheapest collapses get blocked by the locks, so stop the pass
+      // before it reaches collapses that are a lot more expensive than needed, they will be cheaper to evaluate with updated quadrics.
+      // If that blocks every collapse (which happens when lots of collapses are free) we retry without the limit.
+      const uint32_t triangleGoal = (indexCount - targetIndexCount + 2) / 3;
+      const std::size_t edgeGoal = (triangleGoal + 1) / 2;
+      const float limitedCost = edgeGoal < collapses.size() ? collapses[edgeGoal].Cost * PassCostFactor : maxCost;
+      uint32_t removedTriangles = 0;
+      for (uint32_t attempt = 0; attempt < 2 && removedTriangles == 0; ++attempt)
+      {
+        const float passMaxCost = attempt == 0 ? limitedCost : maxCost;
+        for (const Collapse& collapse : collapses)
+        {
+          if (collapse.Cost > passMaxCost)
+          {
+            break;
+          }
+          const uint32_t fromPosition = positionRemap[collapse.From];
+          const uint32_t toPosition = positionRemap[collapse.To];
+          if (collapseLocked[fromPosition] != 0u || collapseLocked[toPosition] != 0u)
+          {
+            continue;
+          }
+          uint32_t removedCount = 0;
+          if (!TryValidateCollapse(removedCount, adjacency.Get(collapse.From), indices, collapseRemap, positionRemap, positions,
+                                   kinds[collapse.From], collapse.From, collapse.To))
+          {
+            continue;
+          }
+
+          collapseRemap[collapse.From] = collapse.To;
+          quadrics[toPosition].Add(quadrics[fromPosition]);
+          collapseLocked[fromPosition] = 1u;
+          collapseLocked[toPosition] = 1u;
+          resultCost = std::max(resultCost, collapse.Cost);
+          removedTriangles += removedCount;
+          if (removedTriangles >= triangleGoal)
+          {
+            break;
+          }
+        }
+      }
+      if (removedTriangles == 0)
+      {
+        break;
+      }
+      indexCount = ApplyCollapses(indices, collapseRemap, positionRemap);
+    }
+    return {indexCount, std::sqrt(resultCost)};
+  }
+}
@@ -0,0 +1,439 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics3D/BasicScene/Mesh.hpp>
+#include <FslGraphics3D/BasicScene/Scene.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletBuilder.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <vector>
+#include "MeshContentUtil.hpp"
+
+namespace Fsl::Graphics3D::MeshletBuilder
+{
+  namespace
+  {
+    constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    //! Cones where the normals spread more than this (the dot product between the axis and a normal is lower) are considered useless
+    constexpr float MinConeDot = 0.1f;
+
+    //! Vertex to triangle adjacency stored as a compressed sparse row
+    struct TriangleAdjacency
+    {
+      std::vector<uint32_t> Offsets;
+      std::vector<uint32_t> Triangles;
+    };
+
+    template <typename TIndex>
+    void BuildAdjacency(TriangleAdjacency& rAdjacency, const ReadOnlySpan<TIndex> indices, const uint32_t vertexCount)
+    {
+      rAdjacency.Offsets.assign(static_cast<std::size_t>(vertexCount) + 1u, 0u);
+      for (const TIndex index : indices)
+      {
+        ++rAdjacency.Offsets[index + 1u];
+      }
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        rAdjacency.Offsets[i + 1] += rAdjacency.Offsets[i];
+      }
+
+      std::vector<uint32_t> fill(rAdjacency.Offsets.begin(), rAdjacency.Offsets.end() - 1);
+      rAdjacency.Triangles.resize(indices.size());
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        rAdjacency.Triangles[fill[indices[i]]++] = static_cast<uint32_t>(i / 3);
+      }
+    }
+
+    class PositionReader
+    {
+      const uint8_t* m_pVertices;
+      uint32_t m_vertexStride;
+      uint32_t m_positionOffset;
+
+    public:
+      PositionReader(const void* const pVertices, const uint32_t vertexStride, const uint32_t positionOffset)
+        : m_pVertices(static_cast<const uint8_t*>(pVertices))
+        , m_vertexStride(vertexStride)
+        , m_positionOffset(positionOffset)
+      {
+      }
+
+      Vector3 Get(const uint32_t vertexIndex) const noexcept
+      {
+        Vector3 position;
+        std::memcpy(&position, m_pVertices + (static_cast<std::size_t>(vertexIndex) * m_vertexStride) + m_positionOffset, sizeof(Vector3));
+        return position;
+      }
+    };
+
+    //! Ritter's bounding sphere
+    BoundingSphere CalcBounds(const PositionReader& positions, const ReadOnlySpan<uint32_t> vertexIndices)
+    {
+      assert(!vertexIndices.empty());
+      const Vector3 p0 = positions.Get(vertexIndices[0]);
+      Vector3 pA = p0;
+      float maxDistance = -1.0f;
+      for (const uint32_t vertexIndex : vertexIndices)
+      {
+        const Vector3 p = positions.Get(vertexIndex);
+        const float distance = Vector3::DistanceSquared(p, p0);
+        if (distance > maxDistance)
+        {
+          maxDistance = distance;
+          pA = p;
+        }
+      }
+      Vector3 pB = pA;
+      maxDistance = -1.0f;
+      for (const uint32_t vertexIndex : vertexIndices)
+      {
+        const Vector3 p = positions.Get(vertexIndex);
+        const float distance = Vector3::DistanceSquared(p, pA);
+        if (distance > maxDistance)
+        {
+          maxDistance = distance;
+          pB = p;
+        }
+      }
+
+      Vector3 center = (pA + pB) * 0.5f;
+      float radius = std::sqrt(maxDistance) * 0.5f;
+      for (const uint32_t vertexIndex : vertexIndices)
+      {
+        const Vector3 p = positions.Get(vertexIndex);
+        const float distance = Vector3::Distance(p, center);
+        if (distance > radius)
+        {
+          const float newRadius = (radius + distance) * 0.5f;
+          center += (p - center) * ((newRadius - radius) / distance);
+          radius = newRadius;
+        }
+      }
+      return {center, radius};
+    }
+
+    Meshlet CreateMeshlet(const PositionReader& positions, const std::vector<uint32_t>& allVertexIndices,
+                          const std::vector<uint8_t>& allTriangleIndices, const uint32_t vertexOffset, const uint32_t triangleOffset)
+    {
+      const auto vertexCount = static_cast<uint32_t>(allVertexIndices.size() - vertexOffset);
+      const auto triangleIndexCount = static_cast<uint32_t>(allTriangleIndices.size() - triangleOffset);
+      const ReadOnlySpan<uint32_t> vertexIndices(allVertexIndices.data() + vertexOffset, vertexCount);
+      const ReadOnlySpan<uint8_t> triangleIndices(allTriangleIndices.data() + triangleOffset, triangleIndexCount);
+
+      const BoundingSphere bounds = CalcBounds(positions, vertexIndices);
+
+      // Calculate the normal cone
+      Vector3 axis;
+      for (std::size_t i = 0; i < triangleIndices.size(); i += 3)
+      {
+        const Vector3 p0 = positions.Get(vertexIndices[triangleIndices[i]]);
+        const Vector3 p1 = positions.Get(vertexIndices[triangleIndices[i + 1]]);
+        const Vector3 p2 = positions.Get(vertexIndices[triangleIndices[i + 2]]);
+        const Vector3 normal = Vector3::Cross(p1 - p0, p2 - p0);
+        const float length = normal.Length();
+        if (length > 0.0f)
+        {
+          axis += normal / length;
+        }
+      }
+
+      const float axisLength = axis.Length();
+      float minDot = 1.0f;
+      if (axisLength > 0.0f)
+      {
+        axis /= axisLength;
+        for (std::size_t i = 0; i < triangleIndices.size(); i += 3)
+        {
+          const Vector3 p0 = positions.Get(vertexIndices[triangleIndices[i]]);
+          const Vector3 p1 = positions.Get(vertexIndices[triangleIndices[i + 1]]);
+          const Vector3 p2 = positions.Get(vertexIndices[triangleIndices[i + 2]]);
+          const Vector3 normal = Vector3::Cross(p1 - p0, p2 - p0);
+          const float length = normal.Length();
+          if (length > 0.0f)
+          {
+            minDot = std::min(minDot, Vector3::Dot(normal / length, axis));
+          }
+        }
+      }
+
+      if (axisLength <= 0.0f || minDot <= MinConeDot)
+      {
+        // The normals are too spread out (or degenerate) to be useful for culling
+        return {vertexOffset, triangleOffset, vertexCount, triangleIndexCount / 3, bounds, bounds.Center, axis, 1.0f};
+      }
+
+      // Move the apex back along the axis until it is behind all the triangle planes
+      float apexDistance = 0.0f;
+      for (std::size_t i = 0; i < triangleIndices.size(); i += 3)
+      {
+        const Vector3 p0 = positions.Get(vertexIndices[triangleIndices[i]]);
+        const Vector3 p1 = positions.Get(vertexIndices[triangleIndices[i + 1]]);
+        const Vector3 p2 = positions.Get(vertexIndices[triangleIndices[i + 2]]);
+        const Vector3 normal = Vector3::Cross(p1 - p0, p2 - p0);
+        const float length = normal.Length();
+        if (length > 0.0f)
+        {
+          const Vector3 unitNormal = normal / length;
+          const float distance = Vector3::Dot(bounds.Center - p0, unitNormal) / Vector3::Dot(axis, unitNormal);
+          apexDistance = std::max(apexDistance, distance);
+        }
+      }
+
+      const Vector3 apex = bounds.Center - (axis * apexDistance);
+      const float cutoff = std::sqrt(1.0f - (minDot * minDot));
+      return {vertexOffset, triangleOffset, vertexCount, triangleIndexCount / 3, bounds, apex, axis, cutoff};
+    }
+
+
+    template <typename TIndex>
+    MeshletData DoBuild(const ReadOnlySpan<TIndex> indices, const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                        const uint32_t positionOffset, const uint32_t maxVertices, const uint32_t maxTriangles)
+    {
+      if ((indices.size() % 3) != 0)
+      {
+        throw std::invalid_argument("indices must contain a triangle list");
+      }
+      if (maxVertices < 3 || maxVertices > MaxVerticesLimit)
+      {
+        throw std::invalid_argument("maxVertices is out of range");
+      }
+      if (maxTriangles < 1 || maxTriangles > MaxTrianglesLimit)
+      {
+        throw std::invalid_argument("maxTriangles is out of range");
+      }
+      if (pVertices == nullptr && vertexCount > 0)
+      {
+        throw std::invalid_argument("pVertices can not be null");
+      }
+      if ((positionOffset + sizeof(Vector3)) > vertexStride)
+      {
+        throw std::invalid_argument("The position must be inside the vertex");
+      }
+      if (indices.size() >= std::numeric_limits<uint32_t>::max())
+      {
+        throw NotSupportedException("Too many indices");
+      }
+      for (const TIndex index : indices)
+      {
+        if (index >= vertexCount)
+        {
+          throw std::invalid_argument("index out of bounds");
+        }
+      }
+
+      const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+      const PositionReader positions(pVertices, vertexStride, positionOffset);
+
+      TriangleAdjacency adjacency;
+      BuildAdjacency(adjacency, indices, vertexCount);
+
+      std::vector<Meshlet> meshlets;
+      std::vector<uint32_t> vertexIndices;
+      std::vector<uint8_t> triangleIndices;
+      meshlets.reserve((triangleCount / maxTriangles) + 1);
+      vertexIndices.reserve(indices.size() / 2);
+      triangleIndices.reserve(indices.size());
+
+      std::vector<bool> emitted(triangleCount, false);
+      // The local meshlet index of each vertex (InvalidIndex if the vertex is not part of the current meshlet)
+      std::vector<uint32_t> localIndices(vertexCount, InvalidIndex);
+
+      uint32_t meshletVertexOffset = 0;
+      uint32_t meshletTriangleOffset = 0;
+      uint32_t meshletVertexCount = 0;
+      uint32_t meshletTriangleCount = 0;
+      uint32_t lastTriangle = InvalidIndex;
+      uint32_t seedCursor = 0;
+
+      const auto flushMeshlet = [&]()
+      {
+        if (meshletTriangleCount > 0)
+        {
+          meshlets.push_back(CreateMeshlet(positions, vertexIndices, triangleIndices, meshletVertexOffset, meshletTriangleOffset));
+          for (uint32_t i = meshletVertexOffset; i < vertexIndices.size(); ++i)
+          {
+            localIndices[vertexIndices[i]] = InvalidIndex;
+          }
+        }
+        meshletVertexOffset = static_cast<uint32_t>(vertexIndices.size());
+        meshletTriangleOffset = static_cast<uint32_t>(triangleIndices.size());
+        meshletVertexCount = 0;
+        meshletTriangleCount = 0;
+      };
+
+      const auto countNewVertices = [&](const uint32_t triangle)
+      {
+        const std::size_t base = static_cast<std::size_t>(triangle) * 3;
+        return (localIndices[indices[base]] == InvalidIndex ? 1u : 0u) + (localIndices[indices[base + 1]] == InvalidIndex ? 1u : 0u) +
+               (localIndices[indices[base + 2]] == InvalidIndex ? 1u : 0u);
+      };
+
+      // Find the connected triangle that adds the fewest new vertices (ties are resolved by the original triangle order)
+      const auto findBestNeighbor = [&](const uint32_t* const pVertexBegin, const uint32_t* const pVertexEnd, const bool useIndexBuffer)
+      {
+        uint32_t bestTriangle = InvalidIndex;
+        uint32_t bestScore = std::numeric_limits<uint32_t>::max();
+        for (const uint32_t* pVertex = pVertexBegin; pVertex != pVertexEnd; ++pVertex)
+        {
+          const uint32_t vertexIndex = useIndexBuffer ? static_cast<uint32_t>(indices[*pVertex]) : *pVertex;
+          for (uint32_t i = adjacency.Offsets[vertexIndex]; i < adjacency.Offsets[vertexIndex + 1]; ++i)
+          {
+            const uint32_t triangle = adjacency.Triangles[i];
+            if (!emitted[triangle])
+            {
+              const uint32_t newVertices = countNewVertices(triangle);
+              if ((meshletVertexCount + newVertices) <= maxVertices &&
+                  (newVertices < bestScore || (newVertices == bestScore && triangle < bestTriangle)))
+              {
+                bestTriangle = triangle;
+                bestScore = newVertices;
+              }
+            }
+          }
+        }
+        return bestTriangle;
+      };
+
+      std::array<uint32_t, 3> lastTriangleIndexOffsets{};
+      for (uint32_t emittedCount = 0; emittedCount < triangleCount; ++emittedCount)
+      {
+        if (meshletTriangleCount >= maxTriangles)
+        {
+          flushMeshlet();
+        }
+
+        uint32_t triangle = InvalidIndex;
+        if (lastTriangle != InvalidIndex)
+        {
+          // Prefer neighbors of the last triangle as they are most likely to share vertices with the meshlet.
+          // This is also done right after a full meshlet was flushed so the next meshlet starts next to the previous one.
+          triangle = findBestNeighbor(lastTriangleIndexOffsets.data(), lastTriangleIndexOffsets.data() + 3, true);
+          if (triangle == InvalidIndex && meshletTriangleCount > 0)
+          {
+            // Fall back to anything connected to the meshlet
+            triangle = findBestNeighbor(vertexIndices.data() + meshletVertexOffset, vertexIndices.data() + vertexIndices.size(), false);
+          }
+        }
+        if (triangle == InvalidIndex)
+        {
+          // Nothing connected, so start a new meshlet at the first unused triangle
+          flushMeshlet();
+          while (emitted[seedCursor])
+          {
+            ++seedCursor;
+          }
+          triangle = seedCursor;
+        }
+
+        // Add the triangle to the meshlet
+        const std::size_t base = static_cast<std::size_t>(triangle) * 3;
+        for (std::size_t i = 0; i < 3; ++i)
+        {
+          const auto vertexIndex = static_cast<uint32_t>(indices[base + i]);
+          if (localIndices[vertexIndex] == InvalidIndex)
+          {
+            localIndices[vertexIndex] = meshletVertexCount;
+            vertexIndices.push_back(vertexIndex);
+            ++meshletVertexCount;
+          }
+          triangleIndices.push_back(static_cast<uint8_t>(localIndices[vertexIndex]));
+          lastTriangleIndexOffsets[i] = static_cast<uint32_t>(base + i);
+        }
+        emitted[triangle] = true;
+        lastTriangle = triangle;
+        ++meshletTriangleCount;
+      }
+      flushMeshlet();
+
+      return {maxVertices, maxTriangles, std::move(meshlets), std::move(vertexIndices), std::move(triangleIndices)};
+    }
+  }
+
+
+  MeshletData Build(const ReadOnlySpan<uint16_t> indices, const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                    const uint32_t positionOffset, const uint32_t maxVertices, const uint32_t maxTriangles)
+  {
+    return DoBuild(indices, pVertices, vertexCount, vertexStride, positionOffset, maxVertices, maxTriangles);
+  }
+
+
+  MeshletData Build(const ReadOnlySpan<uint32_t> indices, const void* const pVertices, const uint32_t vertexCount, const uint32_t vertexStride,
+                    const uint32_t positionOffset, const uint32_t maxVertices, const uint32_t maxTriangles)
+  {
+    return DoBuild(indices, pVertices, vertexCount, vertexStride, positionOffset, maxVertices, maxTriangles);
+  }
+
+
+  bool Build(Mesh& rMesh, const uint32_t maxVertices, const uint32_t maxTriangles)
+  {
+    uint32_t positionOffset = 0;
+    if (rMesh.GetPrimitiveType() != PrimitiveType::TriangleList ||
+        !MeshContentUtil::TryGetPositionOffset(rMesh.AsVertexDeclarationSpan(), positionOffset))
+    {
+      return false;
+    }
+
+    const RawMeshContent content = static_cast<const Mesh&>(rMesh).GenericDirectAccess();
+    std::vector<uint32_t> indices;
+    MeshContentUtil::ReadIndices(indices, content.pIndices, static_cast<uint32_t>(content.IndexCount), static_cast<uint32_t>(content.IndexStride));
+
+    rMesh.SetMeshlets(std::make_shared<MeshletData>(Build(SpanUtil::AsReadOnlySpan(indices), content.pVertices,
+                                                          static_cast<uint32_t>(content.VertexCount), static_cast<uint32_t>(content.VertexStride),
+                                                          positionOffset, maxVertices, maxTriangles)));
+    return true;
+  }
+
+
+  uint32_t Build(Scene& rScene, const uint32_t maxVertices, const uint32_t maxTriangles)
+  {
+    uint32_t count = 0;
+    const int32_t meshCount = rScene.GetMeshCount();
+    for (int32_t i = 0; i < meshCount; ++i)
+    {
+      auto mesh = rScene.GetMeshAt(i);
+      if (mesh && Build(*mesh, maxVertices, maxTriangles))
+      {
+        ++count;
+      }
+    }
+    return count;
+  }
+}
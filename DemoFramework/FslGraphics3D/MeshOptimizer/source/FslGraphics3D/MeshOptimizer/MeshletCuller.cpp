@@ -0,0 +1,123 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BoundingSphere.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletCuller.hpp>
+#include <stdexcept>
+
+namespace Fsl::Graphics3D::MeshletCuller
+{
+  namespace
+  {
+    template <typename TIndex>
+    uint32_t DoExtractIndices(Span<TIndex> dstIndices, const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices)
+    {
+      const ReadOnlySpan<uint32_t> vertexIndices = meshlets.GetVertexIndices();
+      const ReadOnlySpan<uint8_t> triangleIndices = meshlets.GetTriangleIndices();
+      std::size_t dstIndex = 0;
+      for (const uint32_t meshletIndex : meshletIndices)
+      {
+        const Meshlet& meshlet = meshlets[meshletIndex];
+        const std::size_t indexCount = static_cast<std::size_t>(meshlet.TriangleCount) * 3u;
+        if (indexCount > (dstIndices.size() - dstIndex))
+        {
+          throw std::invalid_argument("dstIndices is too small");
+        }
+        for (std::size_t i = 0; i < indexCount; ++i)
+        {
+          dstIndices[dstIndex + i] = static_cast<TIndex>(vertexIndices[meshlet.VertexOffset + triangleIndices[meshlet.TriangleOffset + i]]);
+        }
+        dstIndex += indexCount;
+      }
+      return static_cast<uint32_t>(dstIndex);
+    }
+  }
+
+
+  bool IsVisible(const Meshlet& meshlet, const BoundingFrustum& frustum, const Vector3& cameraPosition)
+  {
+    return frustum.Intersects(meshlet.Bounds) && !IsBackFacing(meshlet, cameraPosition);
+  }
+
+
+  MeshletCullStats Cull(Span<uint32_t> dstVisibleMeshlets, const MeshletData& meshlets, const BoundingFrustum& frustum,
+                        const Vector3& cameraPosition)
+  {
+    if (dstVisibleMeshlets.size() < meshlets.Count())
+    {
+      throw std::invalid_argument("dstVisibleMeshlets is too small");
+    }
+
+    MeshletCullStats stats;
+    const ReadOnlySpan<Meshlet> entries = meshlets.GetMeshlets();
+    for (uint32_t i = 0; i < entries.size(); ++i)
+    {
+      const Meshlet& meshlet = entries[i];
+      if (!frustum.Intersects(meshlet.Bounds))
+      {
+        ++stats.FrustumCulled;
+      }
+      else if (IsBackFacing(meshlet, cameraPosition))
+      {
+        ++stats.BackfaceCulled;
+      }
+      else
+      {
+        dstVisibleMeshlets[stats.Visible] = i;
+        ++stats.Visible;
+      }
+    }
+    return stats;
+  }
+
+
+  uint32_t CalcIndexCount(const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices)
+  {
+    uint32_t count = 0;
+    for (const uint32_t meshletIndex : meshletIndices)
+    {
+      count += meshlets[meshletIndex].TriangleCount * 3u;
+    }
+    return count;
+  }
+
+
+  uint32_t ExtractIndices(Span<uint32_t> dstIndices, const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices)
+  {
+    return DoExtractIndices(dstIndices, meshlets, meshletIndices);
+  }
+
+
+  uint32_t ExtractIndices(Span<uint16_t> dstIndices, const MeshletData& meshlets, const ReadOnlySpan<uint32_t> meshletIndices)
+  {
+    return DoExtractIndices(dstIndices, meshlets, meshletIndices);
+  }
+}
@@ -0,0 +1,505 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheOptimizer.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace Fsl::Graphics3D::VertexCacheOptimizer
+{
+  namespace
+  {
+    namespace ForsythConfig
+    {
+      constexpr uint32_t CacheSize = DefaultForsythCacheSize;
+      constexpr float CacheDecayPower = 1.5f;
+      constexpr float LastTriScore = 0.75f;
+      constexpr float ValenceBoostScale = 2.0f;
+      constexpr float ValenceBoostPower = 0.5f;
+      // Score tables are used for vertices with a valence below this
+      constexpr uint32_t MaxValenceLookup = 32;
+    }
+
+    constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    //! Vertex -> triangle adjacency stored as a compressed row table.
+    struct TriangleAdjacency
+    {
+      std::vector<uint32_t> Offsets;
+      std::vector<uint32_t> Counts;
+      std::vector<uint32_t> Triangles;
+    };
+
+    template <typename TIndex>
+    void ValidateInput(const Span<TIndex> dstIndices, const ReadOnlySpan<TIndex> srcIndices, const uint32_t vertexCount)
+    {
+      if (dstIndices.size() != srcIndices.size())
+      {
+        throw std::invalid_argument("dstIndices must be the same size as srcIndices");
+      }
+      if ((srcIndices.size() % 3) != 0)
+      {
+        throw std::invalid_argument("srcIndices must contain a triangle list");
+      }
+      if (srcIndices.size() > std::numeric_limits<uint32_t>::max())
+      {
+        throw NotSupportedException("Too many indices");
+      }
+      for (const TIndex index : srcIndices)
+      {
+        if (index >= vertexCount)
+        {
+          throw std::invalid_argument("index out of bounds");
+        }
+      }
+    }
+
+    template <typename TIndex>
+    void BuildAdjacency(TriangleAdjacency& rAdjacency, const ReadOnlySpan<TIndex> indices, const uint32_t vertexCount)
+    {
+      rAdjacency.Offsets.assign(vertexCount, 0u);
+      rAdjacency.Counts.assign(vertexCount, 0u);
+      rAdjacency.Triangles.resize(indices.size());
+
+      for (const TIndex index : indices)
+      {
+        ++rAdjacency.Counts[index];
+      }
+      uint32_t offset = 0;
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        rAdjacency.Offsets[i] = offset;
+        offset += rAdjacency.Counts[i];
+      }
+      // Fill it (we reuse counts as the insert position)
+      std::fill(rAdjacency.Counts.begin(), rAdjacency.Counts.end(), 0u);
+      const auto triangleCount = static_cast<uint32_t>(indices.size() / 3);
+      for (uint32_t triangleIndex = 0; triangleIndex < triangleCount; ++triangleIndex)
+      {
+        for (uint32_t j = 0; j < 3; ++j)
+        {
+          const TIndex vertexIndex = indices[(triangleIndex * 3) + j];
+          rAdjacency.Triangles[rAdjacency.Offsets[vertexIndex] + rAdjacency.Counts[vertexIndex]] = triangleIndex;
+          ++rAdjacency.Counts[vertexIndex];
+        }
+      }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    class ForsythScoreTable
+    {
+      std::array<float, ForsythConfig::CacheSize> m_cacheScore{};
+      std::array<float, ForsythConfig::MaxValenceLookup> m_valenceScore{};
+
+    public:
+      ForsythScoreTable() noexcept
+      {
+        for (uint32_t i = 0; i < ForsythConfig::CacheSize; ++i)
+        {
+          if (i < 3)
+          {
+            // This vertex was used in the last triangle, so it has a fixed score whichever of the three it's in.
+            m_cacheScore[i] = ForsythConfig::LastTriScore;
+          }
+          else
+          {
+            const float scaler = 1.0f / static_cast<float>(ForsythConfig::CacheSize - 3);
+            m_cacheScore[i] = std::pow(1.0f - (static_cast<float>(i - 3) * scaler), ForsythConfig::CacheDecayPower);
+          }
+        }
+        for (uint32_t i = 0; i < ForsythConfig::MaxValenceLookup; ++i)
+        {
+          m_valenceScore[i] = CalcValenceBoost(i);
+        }
+      }
+
+      float Score(const int32_t cachePosition, const uint32_t activeTriangleCount) const noexcept
+      {
+        if (activeTriangleCount == 0)
+        {
+          // No triangles left using this vertex
+          return -1.0f;
+        }
+        float score = cachePosition >= 0 ? m_cacheScore[cachePosition] : 0.0f;
+        score += activeTriangleCount < ForsythConfig::MaxValenceLookup ? m_valenceScore[activeTriangleCount] : CalcValenceBoost(activeTriangleCount);
+        return score;
+      }
+
+    private:
+      static float CalcValenceBoost(const uint32_t activeTriangleCount) noexcept
+      {
+        // Bonus points for having a low number of triangles left, so we get rid of lone vertices quickly
+        return activeTriangleCount > 0
+                 ? ForsythConfig::ValenceBoostScale * std::pow(static_cast<float>(activeTriangleCount), -ForsythConfig::ValenceBoostPower)
+                 : 0.0f;
+      }
+    };
+
+
+    template <typename TIndex>
+    void DoOptimizeForsyth(Span<TIndex> dstIndices, const ReadOnlySpan<TIndex> srcIndices, const uint32_t vertexCount)
+    {
+      ValidateInput(dstIndices, srcIndices, vertexCount);
+      const auto triangleCount = static_cast<uint32_t>(srcIndices.size() / 3);
+      if (triangleCount == 0)
+      {
+        return;
+      }
+
+      static const ForsythScoreTable g_scoreTable;
+
+      // The adjacency 'Counts' is used to track the number of triangles that still needs to be added for each vertex,
+      // the active triangles are kept at the front of each vertex's triangle list.
+      TriangleAdjacency adjacency;
+      BuildAdjacency(adjacency, srcIndices, vertexCount);
+
+      std::vector<float> vertexScores(vertexCount);
+      std::vector<int32_t> vertexCachePositions(vertexCount, -1);
+      for (uint32_t i = 0; i < vertexCount; ++i)
+      {
+        vertexScores[i] = g_scoreTable.Score(-1, adjacency.Counts[i]);
+      }
+
+      std::vector<float> triangleScores(triangleCount);
+      std::vector<bool> triangleAdded(triangleCount, false);
+      uint32_t bestTriangle = InvalidIndex;
+      float bestScore = -1.0f;
+      for (uint32_t i = 0; i < triangleCount; ++i)
+      {
+        const float score = vertexScores[srcIndices[i * 3]] + vertexScores[srcIndices[(i * 3) + 1]] + vertexScores[srcIndices[(i * 3) + 2]];
+        triangleScores[i] = score;
+        if (score > bestScore)
+        {
+          bestScore = score;
+          bestTriangle = i;
+        }
+      }
+
+      // The cache holds three extra entries so the vertices pushed out by the newest triangle can be updated
+      std::array<uint32_t, ForsythConfig::CacheSize + 3> cache{};
+      std::array<uint32_t, ForsythConfig::CacheSize + 3> newCache{};
+      uint32_t cacheCount = 0;
+
+      uint32_t scanCursor = 0;
+      for (uint32_t outTriangle = 0; outTriangle < triangleCount; ++outTriangle)
+      {
+        if (bestTriangle == InvalidIndex)
+        {
+          // Nothing in the cache is connected to a remaining triangle, so pick the next unused triangle
+          while (triangleAdded[scanCursor])
+          {
+            ++scanCursor;
+          }
+          bestTriangle = scanCursor;
+        }
+
+        const uint32_t srcOffset = bestTriangle * 3;
+        const std::array<uint32_t, 3> triangleVertices = {srcIndices[srcOffset], srcIndices[srcOffset + 1], srcIndices[srcOffset + 2]};
+        dstIndices[(outTriangle * 3)] = srcIndices[srcOffset];
+        dstIndices[(outTriangle * 3) + 1] = srcIndices[srcOffset + 1];
+        dstIndices[(outTriangle * 3) + 2] = srcIndices[srcOffset + 2];
+        triangleAdded[bestTriangle] = true;
+
+        // Remove the triangle from the active list of its vertices
+        for (const uint32_t vertexIndex : triangleVertices)
+        {
+          const uint32_t offset = adjacency.Offsets[vertexIndex];
+          uint32_t& rActiveCount = adjacency.Counts[vertexIndex];
+          for (uint32_t i = 0; i < rActiveCount; ++i)
+          {
+            if (adjacency.Triangles[offset + i] == bestTriangle)
+            {
+              std::swap(adjacency.Triangles[offset + i], adjacency.Triangles[offset + rActiveCount - 1]);
+              --rActiveCount;
+              break;
+            }
+          }
+        }
+
+        // Build the new LRU cache with the triangle vertices in front
+        uint32_t newCacheCount = 0;
+        for (const uint32_t vertexIndex : triangleVertices)
+        {
+          // The same vertex can appear multiple times in a degenerate triangle
+          if (std::find(newCache.begin(), newCache.begin() + newCacheCount, vertexIndex) == newCache.begin() + newCacheCount)
+          {
+            newCache[newCacheCount] = vertexIndex;
+            ++newCacheCount;
+          }
+        }
+        for (uint32_t i = 0; i < cacheCount && newCacheCount < newCache.size(); ++i)
+        {
+          const uint32_t vertexIndex = cache[i];
+          if (vertexIndex != triangleVertices[0] && vertexIndex != triangleVertices[1] && vertexIndex != triangleVertices[2])
+          {
+            newCache[newCacheCount] = vertexIndex;
+            ++newCacheCount;
+          }
+        }
+
+        // Update the vertex scores and propagate the change to the triangles that use them
+        bestTriangle = InvalidIndex;
+        bestScore = -1.0f;
+        for (uint32_t i = 0; i < newCacheCount; ++i)
+        {
+          const uint32_t vertexIndex = newCache[i];
+          const int32_t cachePosition = i < ForsythConfig::CacheSize ? static_cast<int32_t>(i) : -1;
+          vertexCachePositions[vertexIndex] = cachePosition;
+
+          const uint32_t activeCount = adjacency.Counts[vertexIndex];
+          const float newScore = g_scoreTable.Score(cachePosition, activeCount);
+          const float scoreDelta = newScore - vertexScores[vertexIndex];
+          vertexScores[vertexIndex] = newScore;
+
+          const uint32_t offset = adjacency.Offsets[vertexIndex];
+          for (uint32_t j = 0; j < activeCount; ++j)
+          {
+            const uint32_t triangleIndex = adjacency.Triangles[offset + j];
+            const float triangleScore = triangleScores[triangleIndex] + scoreDelta;
+            triangleScores[triangleIndex] = triangleScore;
+            if (triangleScore > bestScore)
+            {
+              bestScore = triangleScore;
+              bestTriangle = triangleIndex;
+            }
+          }
+        }
+
+        cacheCount = std::min(newCacheCount, ForsythConfig::CacheSize);
+        std::copy(newCache.begin(), newCache.begin() + cacheCount, cache.begin());
+      }
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    uint32_t SkipDeadEnd(const std::vector<uint32_t>& liveTriangles, std::vector<uint32_t>& rDeadEndStack, uint32_t& rCursor,
+                         const uint32_t vertexCount)
+    {
+      // Check the dead-end stack
+      while (!rDeadEndStack.empty())
+      {
+        const uint32_t vertexIndex = rDeadEndStack.back();
+        rDeadEndStack.pop_back();
+        if (liveTriangles[vertexIndex] > 0)
+        {
+          return vertexIndex;
+        }
+      }
+      // Fall back to the input order
+      while (rCursor < vertexCount)
+      {
+        if (liveTriangles[rCursor] > 0)
+        {
+          return rCursor;
+        }
+        ++rCursor;
+      }
+      return InvalidIndex;
+    }
+
+    uint32_t GetNextVertex(const std::vector<uint32_t>& candidates, const std::vector<uint32_t>& liveTriangles,
+                           const std::vector<uint32_t>& cacheTime, const uint32_t timeStamp, const uint32_t cacheSize,
+                           std::vector<uint32_t>& rDeadEndStack, uint32_t& rCursor, const uint32_t vertexCount)
+    {
+      uint32_t bestVertex = InvalidIndex;
+      int64_t bestPriority = -1;
+      for (const uint32_t vertexIndex : candidates)
+      {
+        if (liveTriangles[vertexIndex] > 0)
+        {
+          // Vertices that will still be in the cache after fanning around them get a priority based on their age
+          int64_t priority = 0;
+          const int64_t age = static_cast<int64_t>(timeStamp) - cacheTime[vertexIndex];
+          if ((age + (2 * static_cast<int64_t>(liveTriangles[vertexIndex]))) <= cacheSize)
+          {
+            priority = age;
+          }
+          if (priority > bestPriority)
+          {
+            bestPriority = priority;
+            bestVertex = vertexIndex;
+          }
+        }
+      }
+      return bestVertex != InvalidIndex ? bestVertex : SkipDeadEnd(liveTriangles, rDeadEndStack, rCursor, vertexCount);
+    }
+
+
+    template <typename TIndex>
+    void DoOptimizeTipsify(Span<TIndex> dstIndices, const ReadOnlySpan<TIndex> srcIndices, const uint32_t vertexCount, const uint32_t cacheSize)
+    {
+      ValidateInput(dstIndices, srcIndices, vertexCount);
+      if (cacheSize < 3)
+      {
+        throw std::invalid_argument("cacheSize must be >= 3");
+      }
+      if (srcIndices.empty())
+      {
+        return;
+      }
+
+      TriangleAdjacency adjacency;
+      BuildAdjacency(adjacency, srcIndices, vertexCount);
+
+      // Number of triangles that still needs to be emitted for each vertex
+      std::vector<uint32_t> liveTriangles(adjacency.Counts);
+      std::vector<uint32_t> cacheTime(vertexCount, 0u);
+      std::vector<uint32_t> deadEndStack;
+      deadEndStack.reserve(srcIndices.size());
+      std::vector<uint32_t> candidates;
+      candidates.reserve(64);
+      std::vector<bool> triangleEmitted(srcIndices.size() / 3, false);
+
+      uint32_t timeStamp = cacheSize + 1;
+      uint32_t cursor = 0;
+      std::size_t dstIndex = 0;
+      uint32_t fanningVertex = SkipDeadEnd(liveTriangles, deadEndStack, cursor, vertexCount);
+      while (fanningVertex != InvalidIndex)
+      {
+        candidates.clear();
+        const uint32_t offset = adjacency.Offsets[fanningVertex];
+        const uint32_t count = adjacency.Counts[fanningVertex];
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          const uint32_t triangleIndex = adjacency.Triangles[offset + i];
+          if (!triangleEmitted[triangleIndex])
+          {
+            for (uint32_t j = 0; j < 3; ++j)
+            {
+              const TIndex vertexIndex = srcIndices[(triangleIndex * 3) + j];
+              dstIndices[dstIndex] = vertexIndex;
+              ++dstIndex;
+              deadEndStack.push_back(vertexIndex);
+              candidates.push_back(vertexIndex);
+              --liveTriangles[vertexIndex];
+              if ((timeStamp - cacheTime[vertexIndex]) > cacheSize)
+              {
+                cacheTime[vertexIndex] = timeStamp;
+                ++timeStamp;
+              }
+            }
+            triangleEmitted[triangleIndex] = true;
+          }
+        }
+        fanningVertex = GetNextVertex(candidates, liveTriangles, cacheTime, timeStamp, cacheSize, deadEndStack, cursor, vertexCount);
+      }
+      assert(dstIndex == srcIndices.size());
+    }
+
+    // -----------------------------------------------------------------------------------------------------------------------------------------------
+
+    template <typename TIndex>
+    VertexCacheStats DoAnalyze(const ReadOnlySpan<TIndex> indices, const uint32_t vertexCount, const uint32_t cacheSize)
+    {
+      if ((indices.size() % 3) != 0)
+      {
+        throw std::invalid_argument("indices must contain a triangle list");
+      }
+      if (cacheSize == 0)
+      {
+        throw std::invalid_argument("cacheSize must be > 0");
+      }
+      if (indices.empty())
+      {
+        return {};
+      }
+
+      std::vector<uint32_t> cacheTime(vertexCount, 0u);
+      std::vector<bool> referenced(vertexCount, false);
+      uint32_t timeStamp = cacheSize + 1;
+      uint32_t transformed = 0;
+      uint32_t uniqueVertexCount = 0;
+      for (const TIndex vertexIndex : indices)
+      {
+        if (vertexIndex >= vertexCount)
+        {
+          throw std::invalid_argument("index out of bounds");
+        }
+        if ((timeStamp - cacheTime[vertexIndex]) > cacheSize)
+        {
+          cacheTime[vertexIndex] = timeStamp;
+          ++timeStamp;
+          ++transformed;
+        }
+        if (!referenced[vertexIndex])
+        {
+          referenced[vertexIndex] = true;
+          ++uniqueVertexCount;
+        }
+      }
+      const auto triangleCount = static_cast<float>(indices.size() / 3);
+      return {transformed, static_cast<float>(transformed) / triangleCount, static_cast<float>(transformed) / static_cast<float>(uniqueVertexCount)};
+    }
+  }
+
+
+  void OptimizeForsyth(Span<uint16_t> dstIndices, const ReadOnlySpan<uint16_t> srcIndices, const uint32_t vertexCount)
+  {
+    DoOptimizeForsyth(dstIndices, srcIndices, vertexCount);
+  }
+
+
+  void OptimizeForsyth(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const uint32_t vertexCount)
+  {
+    DoOptimizeForsyth(dstIndices, srcIndices, vertexCount);
+  }
+
+
+  void OptimizeTipsify(Span<uint16_t> dstIndices, const ReadOnlySpan<uint16_t> srcIndices, const uint32_t vertexCount, const uint32_t cacheSize)
+  {
+    DoOptimizeTipsify(dstIndices, srcIndices, vertexCount, cacheSize);
+  }
+
+
+  void OptimizeTipsify(Span<uint32_t> dstIndices, const ReadOnlySpan<uint32_t> srcIndices, const uint32_t vertexCount, const uint32_t cacheSize)
+  {
+    DoOptimizeTipsify(dstIndices, srcIndices, vertexCount, cacheSize);
+  }
+
+
+  VertexCacheStats Analyze(const ReadOnlySpan<uint16_t> indices, const uint32_t vertexCount, const uint32_t cacheSize)
+  {
+    return DoAnalyze(indices, vertexCount, cacheSize);
+  }
+
+
+  VertexCacheStats Analyze(const ReadOnlySpan<uint32_t> indices, const uint32_t vertexCount, const uint32_t cacheSize)
+  {
+    return DoAnalyze(indices, vertexCount, cacheSize);
+  }
+}
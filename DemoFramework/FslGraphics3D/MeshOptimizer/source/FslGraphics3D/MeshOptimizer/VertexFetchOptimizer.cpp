@@ -0,0 +1,116 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics3D/MeshOptimizer/VertexFetchOptimizer.hpp>
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace Fsl::Graphics3D::VertexFetchOptimizer
+{
+  namespace
+  {
+    template <typename TIndex>
+    uint32_t DoBuildRemap(Span<uint32_t> dstRemap, const ReadOnlySpan<TIndex> indices)
+    {
+      std::fill(dstRemap.begin(), dstRemap.end(), UnusedVertex);
+      uint32_t nextVertex = 0;
+      for (const TIndex vertexIndex : indices)
+      {
+        if (vertexIndex >= dstRemap.size())
+        {
+          throw std::invalid_argument("index out of bounds");
+        }
+        if (dstRemap[vertexIndex] == UnusedVertex)
+        {
+          dstRemap[vertexIndex] = nextVertex;
+          ++nextVertex;
+        }
+      }
+      return nextVertex;
+    }
+
+    template <typename TIndex>
+    void DoRemapIndices(Span<TIndex> indices, const ReadOnlySpan<uint32_t> remap)
+    {
+      for (TIndex& rIndex : indices)
+      {
+        if (rIndex >= remap.size() || remap[rIndex] == UnusedVertex)
+        {
+          throw std::invalid_argument("index can not be remapped");
+        }
+        rIndex = static_cast<TIndex>(remap[rIndex]);
+      }
+    }
+  }
+
+
+  uint32_t BuildRemap(Span<uint32_t> dstRemap, const ReadOnlySpan<uint16_t> indices)
+  {
+    return DoBuildRemap(dstRemap, indices);
+  }
+
+
+  uint32_t BuildRemap(Span<uint32_t> dstRemap, const ReadOnlySpan<uint32_t> indices)
+  {
+    return DoBuildRemap(dstRemap, indices);
+  }
+
+
+  void RemapIndices(Span<uint16_t> indices, const ReadOnlySpan<uint32_t> remap)
+  {
+    DoRemapIndices(indices, remap);
+  }
+
+
+  void RemapIndices(Span<uint32_t> indices, const ReadOnlySpan<uint32_t> remap)
+  {
+    DoRemapIndices(indices, remap);
+  }
+
+
+  void RemapVertices(void* const pDstVertices, const void* const pSrcVertices, const uint32_t vertexStride, const ReadOnlySpan<uint32_t> remap)
+  {
+    if (pDstVertices == nullptr || pSrcVertices == nullptr)
+    {
+      throw std::invalid_argument("vertices can not be null");
+    }
+    auto* pDst = static_cast<uint8_t*>(pDstVertices);
+    const auto* pSrc = static_cast<const uint8_t*>(pSrcVertices);
+    for (std::size_t i = 0; i < remap.size(); ++i)
+    {
+      if (remap[i] != UnusedVertex)
+      {
+        std::memcpy(pDst + (static_cast<std::size_t>(remap[i]) * vertexStride), pSrc + (i * vertexStride), vertexStride);
+      }
+    }
+  }
+}
@@ -0,0 +1,171 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Vector3.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexWelder.hpp>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace Fsl::Graphics3D::VertexWelder
+{
+  namespace
+  {
+    constexpr uint32_t EndOfList = std::numeric_limits<uint32_t>::max();
+
+    struct CellCoordinate
+    {
+      int32_t X;
+      int32_t Y;
+      int32_t Z;
+    };
+
+    inline uint64_t ToCellKey(const int32_t x, const int32_t y, const int32_t z) noexcept
+    {
+      // 21 bits per axis is more than enough for any sane mesh, collisions are harmless as the candidates are always verified
+      constexpr uint64_t Mask = (1u << 21) - 1u;
+      return (static_cast<uint64_t>(static_cast<uint32_t>(x)) & Mask) | ((static_cast<uint64_t>(static_cast<uint32_t>(y)) & Mask) << 21) |
+             ((static_cast<uint64_t>(static_cast<uint32_t>(z)) & Mask) << 42);
+    }
+
+    inline int32_t ToCell(const float value, const float invCellSize) noexcept
+    {
+      return static_cast<int32_t>(std::floor(value * invCellSize));
+    }
+
+    inline Vector3 ReadPosition(const uint8_t* const pVertex, const uint32_t positionOffset) noexcept
+    {
+      Vector3 position;
+      std::memcpy(&position, pVertex + positionOffset, sizeof(Vector3));
+      return position;
+    }
+
+    //! Compare everything except the position
+    inline bool IsAttributesEqual(const uint8_t* const pLhs, const uint8_t* const pRhs, const uint32_t vertexStride,
+                                  const uint32_t positionOffset) noexcept
+    {
+      const uint32_t positionEnd = positionOffset + sizeof(Vector3);
+      return std::memcmp(pLhs, pRhs, positionOffset) == 0 && std::memcmp(pLhs + positionEnd, pRhs + positionEnd, vertexStride - positionEnd) == 0;
+    }
+
+    inline bool IsPositionEqual(const Vector3& lhs, const Vector3& rhs, const float epsilon) noexcept
+    {
+      return std::abs(lhs.X - rhs.X) <= epsilon && std::abs(lhs.Y - rhs.Y) <= epsilon && std::abs(lhs.Z - rhs.Z) <= epsilon;
+    }
+  }
+
+
+  uint32_t Weld(Span<uint32_t> dstRemap, void* const pDstVertices, const void* const pSrcVertices, const uint32_t vertexCount,
+                const uint32_t vertexStride, const uint32_t positionOffset, const float positionEpsilon)
+  {
+    if (pDstVertices == nullptr || pSrcVertices == nullptr)
+    {
+      throw std::invalid_argument("vertices can not be null");
+    }
+    if (dstRemap.size() != vertexCount)
+    {
+      throw std::invalid_argument("dstRemap must contain one entry per vertex");
+    }
+    if (positionOffset + sizeof(Vector3) > vertexStride)
+    {
+      throw std::invalid_argument("The position must be inside the vertex");
+    }
+    if (positionEpsilon < 0.0f || !std::isfinite(positionEpsilon))
+    {
+      throw std::invalid_argument("positionEpsilon must be a finite positive value");
+    }
+
+    auto* pDst = static_cast<uint8_t*>(pDstVertices);
+    const auto* pSrc = static_cast<const uint8_t*>(pSrcVertices);
+
+    // With a zero epsilon we still use a grid, the cell size just becomes a arbitrary bucket size
+    const float cellSize = positionEpsilon > 0.0f ? positionEpsilon : 1.0f / 1024.0f;
+    const float invCellSize = 1.0f / cellSize;
+    // Matches within epsilon can be located in the neighbor cells, exact matches will always be in the same cell
+    const int32_t searchRadius = positionEpsilon > 0.0f ? 1 : 0;
+
+    // Each cell links to the first unique vertex stored in it, the remaining vertices in the cell are linked through 'nextInCell'
+    std::unordered_map<uint64_t, uint32_t> cells;
+    cells.reserve(vertexCount);
+    std::vector<uint32_t> nextInCell;
+    nextInCell.reserve(vertexCount);
+
+    uint32_t uniqueCount = 0;
+    for (uint32_t srcIndex = 0; srcIndex < vertexCount; ++srcIndex)
+    {
+      const uint8_t* const pSrcVertex = pSrc + (static_cast<std::size_t>(srcIndex) * vertexStride);
+      const Vector3 position = ReadPosition(pSrcVertex, positionOffset);
+      const CellCoordinate cell{ToCell(position.X, invCellSize), ToCell(position.Y, invCellSize), ToCell(position.Z, invCellSize)};
+
+      uint32_t match = EndOfList;
+      for (int32_t z = -searchRadius; z <= searchRadius && match == EndOfList; ++z)
+      {
+        for (int32_t y = -searchRadius; y <= searchRadius && match == EndOfList; ++y)
+        {
+          for (int32_t x = -searchRadius; x <= searchRadius && match == EndOfList; ++x)
+          {
+            const auto itrFind = cells.find(ToCellKey(cell.X + x, cell.Y + y, cell.Z + z));
+            if (itrFind != cells.end())
+            {
+              uint32_t candidate = itrFind->second;
+              while (candidate != EndOfList)
+              {
+                const uint8_t* const pCandidate = pDst + (static_cast<std::size_t>(candidate) * vertexStride);
+                if (IsPositionEqual(position, ReadPosition(pCandidate, positionOffset), positionEpsilon) &&
+                    IsAttributesEqual(pSrcVertex, pCandidate, vertexStride, positionOffset))
+                {
+                  match = candidate;
+                  break;
+                }
+                candidate = nextInCell[candidate];
+              }
+            }
+          }
+        }
+      }
+
+      if (match == EndOfList)
+      {
+        match = uniqueCount;
+        std::memcpy(pDst + (static_cast<std::size_t>(uniqueCount) * vertexStride), pSrcVertex, vertexStride);
+        auto& rHead = cells.try_emplace(ToCellKey(cell.X, cell.Y, cell.Z), EndOfList).first->second;
+        nextInCell.push_back(rHead);
+        rHead = uniqueCount;
+        ++uniqueCount;
+      }
+      dstRemap[srcIndex] = match;
+    }
+    return uniqueCount;
+  }
+}
@@ -0,0 +1,229 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  using Test_ParticleEngine = TestFixtureFslBase;
+
+  ParticleDesc CreateParticle(const float energy, const float x = 0.0f)
+  {
+    return {Vector3(x, 0.0f, 0.0f), Vector3(1.0f, 2.0f, 3.0f), energy, 1.0f, 3.0f, 0};
+  }
+
+  // Fill the engine with particles that die at different times, the particle id is stored in the x coordinate
+  void Fill(ParticleEngine& rEngine, const uint32_t count)
+  {
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      ASSERT_TRUE(rEngine.Add(CreateParticle(static_cast<float>((i % 7u) + 1u), static_cast<float>(i))));
+    }
+  }
+
+  std::vector<float> GetSortedX(const ParticleEngine& engine)
+  {
+    const auto span = engine.GetPositionX();
+    std::vector<float> result(span.begin(), span.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+}
+
+
+TEST(Test_ParticleEngine, Construct)
+{
+  const ParticleEngine engine(100);
+
+  EXPECT_EQ(100u, engine.GetCapacity());
+  EXPECT_EQ(0u, engine.GetCount());
+  EXPECT_TRUE(engine.GetPositionX().empty());
+}
+
+
+TEST(Test_ParticleEngine, Add)
+{
+  ParticleEngine engine(2);
+
+  EXPECT_TRUE(engine.Add(CreateParticle(1.0f)));
+  EXPECT_TRUE(engine.Add(CreateParticle(1.0f)));
+  EXPECT_FALSE(engine.Add(CreateParticle(1.0f)));
+  EXPECT_EQ(2u, engine.GetCount());
+  EXPECT_EQ(1.0f, engine.GetSize()[0]);
+}
+
+
+TEST(Test_ParticleEngine, Add_DeadOnArrival)
+{
+  ParticleEngine engine(2);
+
+  EXPECT_TRUE(engine.Add(CreateParticle(0.0f)));
+  EXPECT_EQ(0u, engine.GetCount());
+}
+
+
+TEST(Test_ParticleEngine, Add_Span)
+{
+  ParticleEngine engine(3);
+  const std::vector<ParticleDesc> particles(5, CreateParticle(1.0f));
+
+  EXPECT_EQ(3u, engine.Add(SpanUtil::AsReadOnlySpan(particles)));
+  EXPECT_EQ(3u, engine.GetCount());
+  EXPECT_EQ(0u, engine.Add(SpanUtil::AsReadOnlySpan(particles)));
+}
+
+
+TEST(Test_ParticleEngine, Update)
+{
+  ParticleEngine engine(10);
+  engine.Add(CreateParticle(2.0f));
+
+  engine.Update(0.5f, Vector3(0.0f, -2.0f, 0.0f));
+
+  ASSERT_EQ(1u, engine.GetCount());
+  // The gravity is applied to the velocity before the position is updated
+  EXPECT_FLOAT_EQ(0.5f, engine.GetPositionX()[0]);
+  EXPECT_FLOAT_EQ(0.5f, engine.GetPositionY()[0]);
+  EXPECT_FLOAT_EQ(1.5f, engine.GetPositionZ()[0]);
+  EXPECT_FLOAT_EQ(1.5f, engine.GetEnergy()[0]);
+  // A quarter of the life time has passed
+  EXPECT_FLOAT_EQ(1.5f, engine.GetSize()[0]);
+}
+
+
+TEST(Test_ParticleEngine, Update_RemoveDead)
+{
+  ParticleEngine engine(10);
+  engine.Add(CreateParticle(1.0f, 0.0f));
+  engine.Add(CreateParticle(3.0f, 1.0f));
+  engine.Add(CreateParticle(1.0f, 2.0f));
+  engine.Add(CreateParticle(1.0f, 3.0f));
+  engine.Add(CreateParticle(3.0f, 4.0f));
+
+  engine.Update(1.0f, Vector3());
+
+  ASSERT_EQ(2u, engine.GetCount());
+  const auto positions = GetSortedX(engine);
+  EXPECT_FLOAT_EQ(2.0f, positions[0]);
+  EXPECT_FLOAT_EQ(5.0f, positions[1]);
+
+  engine.Update(2.0f, Vector3());
+  EXPECT_EQ(0u, engine.GetCount());
+}
+
+
+TEST(Test_ParticleEngine, Update_WorkerPool_MatchesSingleThreaded)
+{
+  constexpr uint32_t Count = 100000;
+  WorkerThreadPool pool(3);
+  ParticleEngine engine1(Count);
+  ParticleEngine engine2(Count);
+  Fill(engine1, Count);
+  Fill(engine2, Count);
+
+  for (uint32_t i = 0; i < 4; ++i)
+  {
+    engine1.Update(1.5f, Vector3(0.0f, -1.0f, 0.0f));
+    engine2.Update(1.5f, Vector3(0.0f, -1.0f, 0.0f), pool);
+    ASSERT_EQ(engine1.GetCount(), engine2.GetCount());
+  }
+  EXPECT_EQ(GetSortedX(engine1), GetSortedX(engine2));
+}
+
+
+TEST(Test_ParticleEngine, WritePointVertices)
+{
+  ParticleEngine engine(10);
+  engine.Add(CreateParticle(1.0f, 5.0f));
+  engine.Add(CreateParticle(1.0f, 6.0f));
+
+  std::vector<ParticlePointVertex> vertices(2);
+  engine.WritePointVertices(SpanUtil::AsSpan(vertices));
+  EXPECT_EQ(ParticlePointVertex(Vector3(5.0f, 0.0f, 0.0f), 1.0f), vertices[0]);
+  EXPECT_EQ(ParticlePointVertex(Vector3(6.0f, 0.0f, 0.0f), 1.0f), vertices[1]);
+
+  std::vector<ParticlePointVertex> tooSmall(1);
+  EXPECT_THROW(engine.WritePointVertices(SpanUtil::AsSpan(tooSmall)), std::invalid_argument);
+}
+
+
+TEST(Test_ParticleEngine, WriteQuadVertices)
+{
+  ParticleEngine engine(10);
+  engine.Add(CreateParticle(1.0f, 5.0f));
+  const Vector4 color(1.0f, 0.5f, 0.25f, 1.0f);
+
+  std::vector<VertexPositionColorNormalTexture> vertices(ParticleEngine::QuadVerticesPerParticle);
+  engine.WriteQuadVertices(SpanUtil::AsSpan(vertices), color);
+  for (const auto& vertex : vertices)
+  {
+    EXPECT_EQ(Vector3(5.0f, 0.0f, 0.0f), vertex.Position);
+    EXPECT_EQ(color, vertex.Color);
+    EXPECT_EQ(1.0f, vertex.Normal.Z);
+    EXPECT_EQ(0.5f, std::abs(vertex.Normal.X));
+    EXPECT_EQ(0.5f, std::abs(vertex.Normal.Y));
+  }
+  // The texture coordinates follow the corner offsets
+  EXPECT_EQ(Vector2(0.0f, 1.0f), vertices[0].TextureCoordinate);
+  EXPECT_EQ(Vector3(-0.5f, 0.5f, 1.0f), vertices[0].Normal);
+  EXPECT_EQ(Vector2(1.0f, 1.0f), vertices[5].TextureCoordinate);
+  EXPECT_EQ(Vector3(0.5f, 0.5f, 1.0f), vertices[5].Normal);
+}
+
+
+TEST(Test_ParticleEngine, WriteVertices_WorkerPool)
+{
+  constexpr uint32_t Count = 50000;
+  WorkerThreadPool pool(3);
+  ParticleEngine engine(Count);
+  Fill(engine, Count);
+
+  std::vector<ParticlePointVertex> points1(Count);
+  std::vector<ParticlePointVertex> points2(Count);
+  engine.WritePointVertices(SpanUtil::AsSpan(points1));
+  engine.WritePointVertices(SpanUtil::AsSpan(points2), pool);
+  EXPECT_EQ(points1, points2);
+
+  std::vector<VertexPositionColorNormalTexture> quads1(Count * ParticleEngine::QuadVerticesPerParticle);
+  std::vector<VertexPositionColorNormalTexture> quads2(Count * ParticleEngine::QuadVerticesPerParticle);
+  engine.WriteQuadVertices(SpanUtil::AsSpan(quads1), Vector4::One());
+  engine.WriteQuadVertices(SpanUtil::AsSpan(quads2), Vector4::One(), pool);
+  EXPECT_EQ(quads1, quads2);
+}
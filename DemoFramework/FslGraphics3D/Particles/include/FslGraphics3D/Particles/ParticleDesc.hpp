@@ -0,0 +1,65 @@
+#ifndef FSLGRAPHICS3D_PARTICLES_PARTICLEDESC_HPP
+#define FSLGRAPHICS3D_PARTICLES_PARTICLEDESC_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Vector3.hpp>
+
+namespace Fsl::Graphics3D
+{
+  //! @brief Describes a new particle
+  struct ParticleDesc
+  {
+    Vector3 Position;
+    Vector3 Velocity;
+    //! The life time of the particle in seconds
+    float Energy{0.0f};
+    float StartSize{0.0f};
+    float EndSize{0.0f};
+    uint8_t TextureId{0};
+
+    constexpr ParticleDesc() noexcept = default;
+
+    constexpr ParticleDesc(const Vector3& position, const Vector3& velocity, const float energy, const float startSize, const float endSize,
+                           const uint8_t textureId) noexcept
+      : Position(position)
+      , Velocity(velocity)
+      , Energy(energy)
+      , StartSize(startSize)
+      , EndSize(endSize)
+      , TextureId(textureId)
+    {
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,158 @@
+#ifndef FSLGRAPHICS3D_PARTICLES_PARTICLEENGINE_HPP
+#define FSLGRAPHICS3D_PARTICLES_PARTICLEENGINE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Math/Vector4.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/Span.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Vertices/VertexPositionColorNormalTexture.hpp>
+#include <FslGraphics3D/Particles/ParticleDesc.hpp>
+#include <FslGraphics3D/Particles/ParticlePointVertex.hpp>
+#include <vector>
+
+namespace Fsl
+{
+  class WorkerThreadPool;
+}
+
+namespace Fsl::Graphics3D
+{
+  //! @brief CPU particle simulation that stores the particles as a structure of arrays.
+  //!        Each attribute lives in its own contiguous array so the update kernels are simple loops over floats that the compiler vectorizes,
+  //!        and large particle counts can be split across a WorkerThreadPool.
+  //!        Dead particles are removed by moving the last particle into their slot, so the particle order is not stable.
+  class ParticleEngine
+  {
+  public:
+    //! The number of vertices WriteQuadVertices writes per particle
+    static constexpr uint32_t QuadVerticesPerParticle = 6;
+
+  private:
+    uint32_t m_capacity;
+    uint32_t m_count{0};
+
+    std::vector<float> m_positionX;
+    std::vector<float> m_positionY;
+    std::vector<float> m_positionZ;
+    std::vector<float> m_velocityX;
+    std::vector<float> m_velocityY;
+    std::vector<float> m_velocityZ;
+    std::vector<float> m_energy;
+    std::vector<float> m_invStartEnergy;
+    std::vector<float> m_startSize;
+    std::vector<float> m_sizeDelta;
+    std::vector<float> m_size;
+    std::vector<uint8_t> m_textureId;
+
+  public:
+    explicit ParticleEngine(const uint32_t capacity);
+
+    uint32_t GetCapacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    uint32_t GetCount() const noexcept
+    {
+      return m_count;
+    }
+
+    //! @brief Add a particle, particles without any energy are dead on arrival and are silently dropped.
+    //! @return false if the engine is full (the particle is discarded)
+    bool Add(const ParticleDesc& particle) noexcept;
+
+    //! @brief Add as many particles as there is room for
+    //! @return the number of particles that were consumed from the span
+    uint32_t Add(const ReadOnlySpan<ParticleDesc> particles) noexcept;
+
+    void Clear() noexcept;
+
+    //! @brief Age, resize and move all particles and remove the ones that died
+    void Update(const float deltaTime, const Vector3& gravity) noexcept;
+
+    //! @brief Age, resize and move all particles using the worker pool and remove the ones that died
+    void Update(const float deltaTime, const Vector3& gravity, WorkerThreadPool& rWorkerPool);
+
+    //! @brief Write one point vertex per particle.
+    //! @param dstVertices must be able to hold GetCount() vertices
+    void WritePointVertices(Span<ParticlePointVertex> dstVertices) const;
+    void WritePointVertices(Span<ParticlePointVertex> dstVertices, WorkerThreadPool& rWorkerPool) const;
+
+    //! @brief Write two camera facing triangles per particle (QuadVerticesPerParticle vertices).
+    //!        The layout matches a billboard vertex shader: Normal.XY is the corner offset and Normal.Z the particle size.
+    //! @param dstVertices must be able to hold GetCount() * QuadVerticesPerParticle vertices
+    void WriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color) const;
+    void WriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color, WorkerThreadPool& rWorkerPool) const;
+
+    ReadOnlySpan<float> GetPositionX() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_positionX, 0u, m_count);
+    }
+
+    ReadOnlySpan<float> GetPositionY() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_positionY, 0u, m_count);
+    }
+
+    ReadOnlySpan<float> GetPositionZ() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_positionZ, 0u, m_count);
+    }
+
+    ReadOnlySpan<float> GetEnergy() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_energy, 0u, m_count);
+    }
+
+    ReadOnlySpan<float> GetSize() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_size, 0u, m_count);
+    }
+
+    ReadOnlySpan<uint8_t> GetTextureId() const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_textureId, 0u, m_count);
+    }
+
+  private:
+    void Integrate(const std::size_t begin, const std::size_t end, const float deltaTime, const Vector3& gravity) noexcept;
+    void RemoveDead() noexcept;
+    void DoWritePointVertices(Span<ParticlePointVertex> dstVertices, const std::size_t begin, const std::size_t end) const noexcept;
+    void DoWriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color, const std::size_t begin,
+                             const std::size_t end) const noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef FSLGRAPHICS3D_PARTICLES_PARTICLEPOINTVERTEX_HPP
+#define FSLGRAPHICS3D_PARTICLES_PARTICLEPOINTVERTEX_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Vector3.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationArray.hpp>
+#include <FslGraphics/Vertices/VertexDeclarationSpan.hpp>
+#include <cstddef>
+
+namespace Fsl::Graphics3D
+{
+  //! @brief The vertex format used for point sprite and geometry shader expanded particles
+  struct ParticlePointVertex
+  {
+    using position_type = Vector3;
+
+    Vector3 Position;
+    float PointSize{0.0f};
+
+    constexpr ParticlePointVertex() noexcept = default;
+
+    constexpr ParticlePointVertex(const Vector3& position, const float pointSize) noexcept
+      : Position(position)
+      , PointSize(pointSize)
+    {
+    }
+
+    constexpr static VertexDeclarationArray<2> GetVertexDeclarationArray()
+    {
+      constexpr BasicVertexDeclarationArray<2> Elements = {
+        VertexElement(offsetof(ParticlePointVertex, Position), VertexElementFormat::Vector3, VertexElementUsage::Position, 0),
+        VertexElement(offsetof(ParticlePointVertex, PointSize), VertexElementFormat::Single, VertexElementUsage::PointSize, 0)};
+      return {Elements, sizeof(ParticlePointVertex)};
+    }
+
+    static VertexDeclarationSpan AsVertexDeclarationSpan()
+    {
+      constexpr static VertexDeclarationArray<2> Decl = GetVertexDeclarationArray();
+      return Decl.AsReadOnlySpan();
+    }
+
+    constexpr bool operator==(const ParticlePointVertex& rhs) const noexcept
+    {
+      return Position == rhs.Position && PointSize == rhs.PointSize;
+    }
+
+    constexpr bool operator!=(const ParticlePointVertex& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,301 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace Fsl::Graphics3D
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The smallest number of particles worth handing to another thread
+      constexpr std::size_t MinUpdateChunkSize = 16 * 1024;
+      constexpr std::size_t MinWriteChunkSize = 16 * 1024;
+    }
+
+    // 0 3
+    // |\|
+    // 1 2
+    constexpr std::array<Vector2, ParticleEngine::QuadVerticesPerParticle> QuadCornerOffsets = {
+      Vector2(-0.5f, +0.5f), Vector2(-0.5f, -0.5f), Vector2(+0.5f, -0.5f), Vector2(-0.5f, +0.5f), Vector2(+0.5f, -0.5f), Vector2(+0.5f, +0.5f)};
+
+    constexpr std::array<Vector2, ParticleEngine::QuadVerticesPerParticle> QuadTextureCoordinates = {
+      Vector2(0.0f, 1.0f), Vector2(0.0f, 0.0f), Vector2(1.0f, 0.0f), Vector2(0.0f, 1.0f), Vector2(1.0f, 0.0f), Vector2(1.0f, 1.0f)};
+  }
+
+
+  ParticleEngine::ParticleEngine(const uint32_t capacity)
+    : m_capacity(capacity)
+    , m_positionX(capacity)
+    , m_positionY(capacity)
+    , m_positionZ(capacity)
+    , m_velocityX(capacity)
+    , m_velocityY(capacity)
+    , m_velocityZ(capacity)
+    , m_energy(capacity)
+    , m_invStartEnergy(capacity)
+    , m_startSize(capacity)
+    , m_sizeDelta(capacity)
+    , m_size(capacity)
+    , m_textureId(capacity)
+  {
+  }
+
+
+  bool ParticleEngine::Add(const ParticleDesc& particle) noexcept
+  {
+    if (particle.Energy <= 0.0f)
+    {
+      // The particle is dead on arrival
+      return true;
+    }
+    if (m_count >= m_capacity)
+    {
+      return false;
+    }
+    const uint32_t index = m_count;
+    m_positionX[index] = particle.Position.X;
+    m_positionY[index] = particle.Position.Y;
+    m_positionZ[index] = particle.Position.Z;
+    m_velocityX[index] = particle.Velocity.X;
+    m_velocityY[index] = particle.Velocity.Y;
+    m_velocityZ[index] = particle.Velocity.Z;
+    m_energy[index] = particle.Energy;
+    m_invStartEnergy[index] = 1.0f / particle.Energy;
+    m_startSize[index] = particle.StartSize;
+    m_sizeDelta[index] = particle.EndSize - particle.StartSize;
+    m_size[index] = particle.StartSize;
+    m_textureId[index] = particle.TextureId;
+    ++m_count;
+    return true;
+  }
+
+
+  uint32_t ParticleEngine::Add(const ReadOnlySpan<ParticleDesc> particles) noexcept
+  {
+    uint32_t addedCount = 0;
+    for (std::size_t i = 0; i < particles.size() && m_count < m_capacity; ++i)
+    {
+      addedCount += Add(particles[i]) ? 1u : 0u;
+    }
+    return addedCount;
+  }
+
+
+  void ParticleEngine::Clear() noexcept
+  {
+    m_count = 0;
+  }
+
+
+  void ParticleEngine::Update(const float deltaTime, const Vector3& gravity) noexcept
+  {
+    Integrate(0u, m_count, deltaTime, gravity);
+    RemoveDead();
+  }
+
+
+  void ParticleEngine::Update(const float deltaTime, const Vector3& gravity, WorkerThreadPool& rWorkerPool)
+  {
+    rWorkerPool.ParallelFor(m_count, LocalConfig::MinUpdateChunkSize, [this, deltaTime, &gravity](const std::size_t begin, const std::size_t end)
+                            { Integrate(begin, end, deltaTime, gravity); });
+    RemoveDead();
+  }
+
+
+  void ParticleEngine::WritePointVertices(Span<ParticlePointVertex> dstVertices) const
+  {
+    if (dstVertices.size() < m_count)
+    {
+      throw std::invalid_argument("dstVertices is too small");
+    }
+    DoWritePointVertices(dstVertices, 0u, m_count);
+  }
+
+
+  void ParticleEngine::WritePointVertices(Span<ParticlePointVertex> dstVertices, WorkerThreadPool& rWorkerPool) const
+  {
+    if (dstVertices.size() < m_count)
+    {
+      throw std::invalid_argument("dstVertices is too small");
+    }
+    rWorkerPool.ParallelFor(m_count, LocalConfig::MinWriteChunkSize, [this, dstVertices](const std::size_t begin, const std::size_t end)
+                            { DoWritePointVertices(dstVertices, begin, end); });
+  }
+
+
+  void ParticleEngine::WriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color) const
+  {
+    if (dstVertices.size() < (static_cast<std::size_t>(m_count) * QuadVerticesPerParticle))
+    {
+      throw std::invalid_argument("dstVertices is too small");
+    }
+    DoWriteQuadVertices(dstVertices, color, 0u, m_count);
+  }
+
+
+  void ParticleEngine::WriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color,
+                                         WorkerThreadPool& rWorkerPool) const
+  {
+    if (dstVertices.size() < (static_cast<std::size_t>(m_count) * QuadVerticesPerParticle))
+    {
+      throw std::invalid_argument("dstVertices is too small");
+    }
+    rWorkerPool.ParallelFor(m_count, LocalConfig::MinWriteChunkSize, [this, dstVertices, &color](const std::size_t begin, const std::size_t end)
+                            { DoWriteQuadVertices(dstVertices, color, begin, end); });
+  }
+
+
+  void ParticleEngine::Integrate(const std::size_t begin, const std::size_t end, const float deltaTime, const Vector3& gravity) noexcept
+  {
+    assert(begin <= end);
+    assert(end <= m_count);
+
+    // Each loop only touches a few streams and has no branches so the compiler can vectorize it
+    const float gravityVelocityX = gravity.X * deltaTime;
+    const float gravityVelocityY = gravity.Y * deltaTime;
+    const float gravityVelocityZ = gravity.Z * deltaTime;
+    {
+      float* const pPositionX = m_positionX.data();
+      float* const pVelocityX = m_velocityX.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        pVelocityX[i] += gravityVelocityX;
+        pPositionX[i] += pVelocityX[i] * deltaTime;
+      }
+    }
+    {
+      float* const pPositionY = m_positionY.data();
+      float* const pVelocityY = m_velocityY.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        pVelocityY[i] += gravityVelocityY;
+        pPositionY[i] += pVelocityY[i] * deltaTime;
+      }
+    }
+    {
+      float* const pPositionZ = m_positionZ.data();
+      float* const pVelocityZ = m_velocityZ.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        pVelocityZ[i] += gravityVelocityZ;
+        pPositionZ[i] += pVelocityZ[i] * deltaTime;
+      }
+    }
+    {
+      float* const pEnergy = m_energy.data();
+      float* const pSize = m_size.data();
+      const float* const pInvStartEnergy = m_invStartEnergy.data();
+      const float* const pStartSize = m_startSize.data();
+      const float* const pSizeDelta = m_sizeDelta.data();
+      for (std::size_t i = begin; i < end; ++i)
+      {
+        pEnergy[i] -= deltaTime;
+        pSize[i] = pStartSize[i] + (pSizeDelta[i] * (1.0f - (pEnergy[i] * pInvStartEnergy[i])));
+      }
+    }
+  }
+
+
+  void ParticleEngine::RemoveDead() noexcept
+  {
+    // Swap remove: the last particle is moved into the dead particles slot (and then checked as it might be dead too)
+    const float* const pEnergy = m_energy.data();
+    uint32_t count = m_count;
+    uint32_t index = 0;
+    while (index < count)
+    {
+      if (pEnergy[index] > 0.0f)
+      {
+        ++index;
+      }
+      else
+      {
+        --count;
+        m_positionX[index] = m_positionX[count];
+        m_positionY[index] = m_positionY[count];
+        m_positionZ[index] = m_positionZ[count];
+        m_velocityX[index] = m_velocityX[count];
+        m_velocityY[index] = m_velocityY[count];
+        m_velocityZ[index] = m_velocityZ[count];
+        m_energy[index] = m_energy[count];
+        m_invStartEnergy[index] = m_invStartEnergy[count];
+        m_startSize[index] = m_startSize[count];
+        m_sizeDelta[index] = m_sizeDelta[count];
+        m_size[index] = m_size[count];
+        m_textureId[index] = m_textureId[count];
+      }
+    }
+    m_count = count;
+  }
+
+
+  void ParticleEngine::DoWritePointVertices(Span<ParticlePointVertex> dstVertices, const std::size_t begin, const std::size_t end) const noexcept
+  {
+    assert(end <= m_count);
+    assert(end <= dstVertices.size());
+    ParticlePointVertex* const pDst = dstVertices.data();
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      pDst[i].Position = Vector3(m_positionX[i], m_positionY[i], m_positionZ[i]);
+      pDst[i].PointSize = m_size[i];
+    }
+  }
+
+
+  void ParticleEngine::DoWriteQuadVertices(Span<VertexPositionColorNormalTexture> dstVertices, const Vector4& color, const std::size_t begin,
+                                           const std::size_t end) const noexcept
+  {
+    assert(end <= m_count);
+    assert((end * QuadVerticesPerParticle) <= dstVertices.size());
+    VertexPositionColorNormalTexture* pDst = dstVertices.data() + (begin * QuadVerticesPerParticle);
+    for (std::size_t i = begin; i < end; ++i)
+    {
+      const Vector3 position(m_positionX[i], m_positionY[i], m_positionZ[i]);
+      const float size = m_size[i];
+      for (uint32_t j = 0; j < QuadVerticesPerParticle; ++j)
+      {
+        pDst[j].Position = position;
+        pDst[j].Color = color;
+        pDst[j].Normal = Vector3(QuadCornerOffsets[j].X, QuadCornerOffsets[j].Y, size);
+        pDst[j].TextureCoordinate = QuadTextureCoordinates[j];
+      }
+      pDst += QuadVerticesPerParticle;
+    }
+  }
+}
@@ -37,7 +37,8 @@ namespace Fsl::SceneFormat
   {
     VertexDeclarations = 0,
     Meshes = 1,
-    Nodes = 2
+    Nodes = 2,
+    Meshlets = 3
   };
 }
 
@@ -36,6 +36,7 @@
 #include <FslBase/System/Platform/PlatformPathTransform.hpp>
 #include <FslGraphics/Vertices/IndexConverter.hpp>
 #include <FslGraphics/Vertices/VertexConverter.hpp>
+#include <FslGraphics3D/BasicScene/MeshletData.hpp>
 #include <FslGraphics3D/SceneFormat/BasicSceneFormat.hpp>
 #include <FslGraphics3D/SceneFormat/ChunkType.hpp>
 #include <FslGraphics3D/SceneFormat/PrimitiveType.hpp>
@@ -43,6 +44,7 @@
 #include <FslGraphics3D/SceneFormat/VertexElementUsage.hpp>
 #include <algorithm>
 #include <array>
+#include <bit>
 #include <cassert>
 #include <deque>
 #include <fstream>
@@ -146,11 +148,16 @@ namespace Fsl::SceneFormat
   {
     // FSF
     constexpr uint32_t FormatMagic = 0x00465346;
-    constexpr uint32_t FormatCurrentVersion = 0;
+    // Version 1 adds the meshlet chunk after the nodes chunk.
+    // Scenes without meshlets are still written as version 0 so they stay readable by older loaders.
+    constexpr uint32_t FormatBaseVersion = 0;
+    constexpr uint32_t FormatMeshletVersion = 1;
+    constexpr uint32_t FormatCurrentVersion = FormatMeshletVersion;
 
     constexpr uint16_t ChunkVersionVertexDeclaration = 0;
     constexpr uint16_t ChunkVersionMeshes = 0;
     constexpr uint16_t ChunkVersionNodes = 0;
+    constexpr uint16_t ChunkVersionMeshlets = 0;
 
 
     constexpr uint32_t FormatheaderOffsetMagic = 0;
@@ -281,6 +288,50 @@ namespace Fsl::SceneFormat
     //  uint8_t ChildCount;
     //};
 
+    constexpr uint32_t SizeofMeshletListHeader = sizeof(uint32_t);
+
+    // struct MeshletList
+    //{
+    //  uint32_t Entries;
+    //};
+
+    constexpr uint32_t MeshletsOffsetMeshIndex = 0;
+    constexpr uint32_t MeshletsOffsetMaxVertices = MeshletsOffsetMeshIndex + sizeof(uint32_t);
+    constexpr uint32_t MeshletsOffsetMaxTriangles = MeshletsOffsetMaxVertices + sizeof(uint32_t);
+    constexpr uint32_t MeshletsOffsetMeshletCount = MeshletsOffsetMaxTriangles + sizeof(uint32_t);
+    constexpr uint32_t MeshletsOffsetVertexIndexCount = MeshletsOffsetMeshletCount + sizeof(uint32_t);
+    constexpr uint32_t MeshletsOffsetTriangleIndexCount = MeshletsOffsetVertexIndexCount + sizeof(uint32_t);
+    constexpr uint32_t SizeofMeshletsHeader = MeshletsOffsetTriangleIndexCount + sizeof(uint32_t);
+
+    // struct ChunkMeshletsHeader
+    //{
+    //  uint32_t MeshIndex;
+    //  uint32_t MaxVertices;
+    //  uint32_t MaxTriangles;
+    //  uint32_t MeshletCount;
+    //  uint32_t VertexIndexCount;
+    //  uint32_t TriangleIndexCount;
+    //};
+    // Followed by:
+    // - MeshletCount * Meshlet
+    // - VertexIndexCount * uint32_t
+    // - TriangleIndexCount * uint8_t
+    // - Padding to a four byte boundary
+
+    // struct Meshlet
+    //{
+    //  uint32_t VertexOffset;
+    //  uint32_t TriangleOffset;
+    //  uint32_t VertexCount;
+    //  uint32_t TriangleCount;
+    //  float BoundsCenter[3];
+    //  float BoundsRadius;
+    //  float ConeApex[3];
+    //  float ConeAxis[3];
+    //  float ConeCutoff;
+    //};
+    constexpr uint32_t SizeofMeshlet = (4 * sizeof(uint32_t)) + (11 * sizeof(float));
+
 
     FormatHeader ReadHeader(std::ifstream& rStream)
     {
@@ -294,7 +345,7 @@ namespace Fsl::SceneFormat
       const uint32_t magic = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), FormatheaderOffsetMagic);
       const uint32_t version = ByteArrayUtil::ReadUInt32LE(buffer.data(), buffer.size(), FormatheaderOffsetVersion);
 
-      if (magic != FormatMagic || version != FormatCurrentVersion)
+      if (magic != FormatMagic || version > FormatCurrentVersion)
       {
         throw NotSupportedException("File format not supported");
       }
@@ -1508,6 +1559,247 @@ namespace Fsl::SceneFormat
     }
 
 
+    bool HasMeshlets(const Scene& scene)
+    {
+      const int32_t meshCount = scene.GetMeshCount();
+      for (int32_t i = 0; i < meshCount; ++i)
+      {
+        const auto mesh = scene.GetMeshAt(i);
+        if (mesh && mesh->GetMeshlets())
+        {
+          return true;
+        }
+      }
+      return false;
+    }
+
+
+    std::size_t CalcMeshletsEntryByteSize(const MeshletData& meshlets)
+    {
+      const std::size_t byteSize = SizeofMeshletsHeader + (meshlets.Count() * std::size_t(SizeofMeshlet)) +
+                                   (meshlets.GetVertexIndices().size() * sizeof(uint32_t)) + meshlets.GetTriangleIndices().size();
+      // Pad to a four byte boundary
+      return (byteSize + 3u) & ~std::size_t(3u);
+    }
+
+
+    std::size_t ReadFloatLE(const uint8_t* const pSrc, const std::size_t srcLength, const std::size_t index, float& rValue)
+    {
+      rValue = std::bit_cast<float>(ByteArrayUtil::ReadUInt32LE(pSrc, srcLength, index));
+      return sizeof(float);
+    }
+
+
+    std::size_t WriteFloatLE(uint8_t* pDst, const std::size_t dstLength, const std::size_t dstIndex, const float value)
+    {
+      return ByteArrayUtil::WriteUInt32LE(pDst, dstLength, dstIndex, std::bit_cast<uint32_t>(value));
+    }
+
+
+    std::size_t ReadVector3LE(const uint8_t* const pSrc, const std::size_t srcLength, const std::size_t index, Vector3& rValue)
+    {
+      std::size_t srcIndex = index;
+      srcIndex += ReadFloatLE(pSrc, srcLength, srcIndex, rValue.X);
+      srcIndex += ReadFloatLE(pSrc, srcLength, srcIndex, rValue.Y);
+      srcIndex += ReadFloatLE(pSrc, srcLength, srcIndex, rValue.Z);
+      return srcIndex - index;
+    }
+
+
+    std::size_t WriteVector3LE(uint8_t* pDst, const std::size_t dstLength, const std::size_t dstIndex, const Vector3& value)
+    {
+      std::size_t index = dstIndex;
+      index += WriteFloatLE(pDst, dstLength, index, value.X);
+      index += WriteFloatLE(pDst, dstLength, index, value.Y);
+      index += WriteFloatLE(pDst, dstLength, index, value.Z);
+      return index - dstIndex;
+    }
+
+
+    void ReadMeshletsChunk(std::ifstream& rStream, Scene& rScene)
+    {
+      const ChunkHeader header = ReadChunkHeader(rStream);
+      if (header.Type != ChunkType::Meshlets)
+      {
+        throw FormatException("Did not find the expected meshlets chunk");
+      }
+      if (header.Version != ChunkVersionMeshlets)
+      {
+        throw FormatException("Unsupported meshlets chunk version");
+      }
+      if (header.ByteSize < SizeofMeshletListHeader)
+      {
+        throw FormatException("MeshletsChunk was of a unexpected size");
+      }
+
+      std::vector<uint8_t> content(header.ByteSize);
+      rStream.read(reinterpret_cast<char*>(content.data()), header.ByteSize);
+      if (!rStream.good())
+      {
+        throw FormatException("Failed to read the expected data");
+      }
+
+      const auto sceneMeshCount = static_cast<uint32_t>(rScene.GetMeshCount());
+      std::size_t srcIndex = 0;
+      const uint32_t entryCount = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex);
+      srcIndex += sizeof(uint32_t);
+      for (uint32_t entryIndex = 0; entryIndex < entryCount; ++entryIndex)
+      {
+        const std::size_t entryStart = srcIndex;
+        if ((content.size() - srcIndex) < SizeofMeshletsHeader)
+        {
+          throw FormatException("MeshletsChunk was of a unexpected size");
+        }
+        const uint32_t meshIndex = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetMeshIndex);
+        const uint32_t maxVertices = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetMaxVertices);
+        const uint32_t maxTriangles = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetMaxTriangles);
+        const uint32_t meshletCount = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetMeshletCount);
+        const uint32_t vertexIndexCount = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetVertexIndexCount);
+        const uint32_t triangleIndexCount =
+          ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), entryStart + MeshletsOffsetTriangleIndexCount);
+        srcIndex += SizeofMeshletsHeader;
+
+        if (meshIndex >= sceneMeshCount)
+        {
+          throw FormatException("Meshlets reference a unknown mesh");
+        }
+        const std::size_t payloadByteSize =
+          (meshletCount * std::size_t(SizeofMeshlet)) + (vertexIndexCount * sizeof(uint32_t)) + std::size_t(triangleIndexCount);
+        if (payloadByteSize > (content.size() - srcIndex))
+        {
+          throw FormatException("MeshletsChunk was of a unexpected size");
+        }
+
+        std::vector<Meshlet> meshlets(meshletCount);
+        for (Meshlet& rMeshlet : meshlets)
+        {
+          rMeshlet.VertexOffset = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex);
+          rMeshlet.TriangleOffset = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex + 4);
+          rMeshlet.VertexCount = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex + 8);
+          rMeshlet.TriangleCount = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex + 12);
+          srcIndex += 16;
+          srcIndex += ReadVector3LE(content.data(), content.size(), srcIndex, rMeshlet.Bounds.Center);
+          srcIndex += ReadFloatLE(content.data(), content.size(), srcIndex, rMeshlet.Bounds.Radius);
+          srcIndex += ReadVector3LE(content.data(), content.size(), srcIndex, rMeshlet.ConeApex);
+          srcIndex += ReadVector3LE(content.data(), content.size(), srcIndex, rMeshlet.ConeAxis);
+          srcIndex += ReadFloatLE(content.data(), content.size(), srcIndex, rMeshlet.ConeCutoff);
+        }
+
+        auto mesh = rScene.GetMeshAt(static_cast<int32_t>(meshIndex));
+        const uint32_t meshVertexCount = mesh->GetVertexCount();
+        std::vector<uint32_t> vertexIndices(vertexIndexCount);
+        for (uint32_t& rVertexIndex : vertexIndices)
+        {
+          rVertexIndex = ByteArrayUtil::ReadUInt32LE(content.data(), content.size(), srcIndex);
+          if (rVertexIndex >= meshVertexCount)
+          {
+            throw FormatException("Meshlet vertex index out of bounds");
+          }
+          srcIndex += sizeof(uint32_t);
+        }
+        std::vector<uint8_t> triangleIndices(content.begin() + static_cast<std::ptrdiff_t>(srcIndex),
+                                             content.begin() + static_cast<std::ptrdiff_t>(srcIndex + triangleIndexCount));
+        srcIndex += triangleIndexCount;
+        srcIndex = (srcIndex + 3u) & ~std::size_t(3u);
+
+        try
+        {
+          mesh->SetMeshlets(std::make_shared<MeshletData>(maxVertices, maxTriangles, std::move(meshlets), std::move(vertexIndices),
+                                                          std::move(triangleIndices)));
+        }
+        catch (const std::invalid_argument& ex)
+        {
+          throw FormatException(std::string("Invalid meshlet data: ") + ex.what());
+        }
+      }
+
+      if (srcIndex != content.size())
+      {
+        throw FormatException("MeshletsChunk was of a unexpected size");
+      }
+    }
+
+
+    void WriteMeshletsChunk(std::ofstream& rStream, const Scene& scene)
+    {
+      const int32_t meshCount = scene.GetMeshCount();
+
+      std::size_t totalByteSize = SizeofMeshletListHeader;
+      uint32_t entryCount = 0;
+      for (int32_t i = 0; i < meshCount; ++i)
+      {
+        const auto mesh = scene.GetMeshAt(i);
+        if (mesh && mesh->GetMeshlets())
+        {
+          totalByteSize += CalcMeshletsEntryByteSize(*mesh->GetMeshlets());
+          ++entryCount;
+        }
+      }
+      if (totalByteSize > std::numeric_limits<uint32_t>::max())
+      {
+        throw NotSupportedException("Only support up to 32bit chunk size");
+      }
+
+      ChunkHeader header(static_cast<uint32_t>(totalByteSize), ChunkType::Meshlets, ChunkVersionMeshlets);
+      WriteChunkHeader(rStream, header);
+
+      std::vector<uint8_t> content(totalByteSize);
+      std::size_t dstIndex = 0;
+      dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, entryCount);
+      for (int32_t i = 0; i < meshCount; ++i)
+      {
+        const auto mesh = scene.GetMeshAt(i);
+        if (!mesh || !mesh->GetMeshlets())
+        {
+          continue;
+        }
+        const MeshletData& meshlets = *mesh->GetMeshlets();
+        const ReadOnlySpan<uint32_t> vertexIndices = meshlets.GetVertexIndices();
+        const ReadOnlySpan<uint8_t> triangleIndices = meshlets.GetTriangleIndices();
+#if !defined(NDEBUG)
+        const auto dstStartIndex = dstIndex;
+#endif
+
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, static_cast<uint32_t>(i));
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlets.GetMaxVertices());
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlets.GetMaxTriangles());
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlets.Count());
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, static_cast<uint32_t>(vertexIndices.size()));
+        dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, static_cast<uint32_t>(triangleIndices.size()));
+        assert((dstIndex - dstStartIndex) == SizeofMeshletsHeader);
+
+        for (const Meshlet& meshlet : meshlets.GetMeshlets())
+        {
+          dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlet.VertexOffset);
+          dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlet.TriangleOffset);
+          dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlet.VertexCount);
+          dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, meshlet.TriangleCount);
+          dstIndex += WriteVector3LE(content.data(), content.size(), dstIndex, meshlet.Bounds.Center);
+          dstIndex += WriteFloatLE(content.data(), content.size(), dstIndex, meshlet.Bounds.Radius);
+          dstIndex += WriteVector3LE(content.data(), content.size(), dstIndex, meshlet.ConeApex);
+          dstIndex += WriteVector3LE(content.data(), content.size(), dstIndex, meshlet.ConeAxis);
+          dstIndex += WriteFloatLE(content.data(), content.size(), dstIndex, meshlet.ConeCutoff);
+        }
+        for (const uint32_t vertexIndex : vertexIndices)
+        {
+          dstIndex += ByteArrayUtil::WriteUInt32LE(content.data(), content.size(), dstIndex, vertexIndex);
+        }
+        if (!triangleIndices.empty())
+        {
+          dstIndex += ByteArrayUtil::WriteBytes(content.data(), content.size(), dstIndex, triangleIndices.data(), triangleIndices.size());
+        }
+        // The content buffer is zero initialized so the padding only needs to be skipped
+        dstIndex = (dstIndex + 3u) & ~std::size_t(3u);
+        assert((dstIndex - dstStartIndex) == CalcMeshletsEntryByteSize(meshlets));
+      }
+
+      // Verify that we wrote the expected amount of bytes
+      assert(dstIndex == totalByteSize);
+
+      rStream.write(reinterpret_cast<const char*>(content.data()), NumericCast<std::streamsize>(content.size()));
+    }
+
+
     //! @brief Verify that a float is 4bytes big and that the endian used by float and uint32_t is the same.
     //! @return true if the host is little endian
     bool CheckEndianAssumptions()
@@ -1572,7 +1864,7 @@ namespace Fsl::SceneFormat
     try
     {
       // Read and validate header
-      ReadHeader(rStream);
+      const FormatHeader header = ReadHeader(rStream);
       m_sceneScratchpad->Clear();
       ReadVertexDeclarationsChunk(rStream, m_sceneScratchpad->VertexDeclarations);
 
@@ -1580,6 +1872,10 @@ namespace Fsl::SceneFormat
         ReadMeshesChunk(rStream, m_sceneScratchpad->VertexDeclarations, sceneAllocator, pDstDefaultValues, cbDstDefaultValues, m_hostIsLittleEndian);
 
       ReadNodesChunk(rStream, *scene, m_hostIsLittleEndian);
+      if (header.Version >= FormatMeshletVersion)
+      {
+        ReadMeshletsChunk(rStream, *scene);
+      }
 
       m_sceneScratchpad->Clear();
       return scene;
@@ -1608,11 +1904,16 @@ namespace Fsl::SceneFormat
       ExtractUniqueVertexDeclarations(*m_sceneScratchpad, scene);
 
       // Write the scene content
-      FormatHeader header(FormatMagic, FormatCurrentVersion);
+      const bool hasMeshlets = HasMeshlets(scene);
+      FormatHeader header(FormatMagic, hasMeshlets ? FormatMeshletVersion : FormatBaseVersion);
       WriteHeader(rStream, header);
       WriteVertexDeclarationsChunk(rStream, m_sceneScratchpad->VertexDeclarations);
       WriteMeshesChunk(rStream, *m_sceneScratchpad);
       WriteNodesChunk(rStream, scene);
+      if (hasMeshlets)
+      {
+        WriteMeshletsChunk(rStream, scene);
+      }
 
       m_sceneScratchpad->Clear();
     }
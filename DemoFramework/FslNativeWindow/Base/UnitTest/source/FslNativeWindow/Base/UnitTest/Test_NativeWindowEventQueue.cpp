@@ -0,0 +1,335 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslNativeWindow/Base/NativeWindowEventHelper.hpp>
+#include <FslNativeWindow/Base/NativeWindowEventQueue.hpp>
+#include <array>
+#include <limits>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestNativeWindowEventQueue = TestFixtureFslBase;
+
+  constexpr std::array<NativeWindowEventQueueBackend, 2> Backends = {NativeWindowEventQueueBackend::ConcurrentQueue,
+                                                                     NativeWindowEventQueueBackend::SingleProducerRing};
+
+  //! Small enough that a handful of events overflows the ring
+  constexpr uint32_t SmallRingCapacity = 4;
+
+  NativeWindowEvent CreateEvent(const int32_t sequence)
+  {
+    return {MillisecondTickCount32(sequence), NativeWindowEventType::InputKey, sequence};
+  }
+
+  void PostEvents(NativeWindowEventQueue& rQueue, const int32_t firstSequence, const int32_t count)
+  {
+    for (int32_t i = 0; i < count; ++i)
+    {
+      rQueue.PostEvent(CreateEvent(firstSequence + i));
+    }
+  }
+
+  //! Dequeue one event at a time and check that they arrive in sequence
+  void ExpectSequence(NativeWindowEventQueue& rQueue, const int32_t firstSequence, const int32_t count)
+  {
+    NativeWindowEvent event;
+    for (int32_t i = 0; i < count; ++i)
+    {
+      ASSERT_TRUE(rQueue.TryDequeue(event));
+      EXPECT_EQ(firstSequence + i, event.Arg1);
+    }
+    EXPECT_FALSE(rQueue.TryDequeue(event));
+  }
+
+  //! Dequeue all events at once and check that they arrive in sequence
+  void ExpectSequenceAll(NativeWindowEventQueue& rQueue, const int32_t firstSequence, const int32_t count)
+  {
+    std::vector<NativeWindowEvent> events;
+    EXPECT_EQ(static_cast<std::size_t>(count), rQueue.TryDequeueAll(events));
+    ASSERT_EQ(static_cast<std::size_t>(count), events.size());
+    for (int32_t i = 0; i < count; ++i)
+    {
+      EXPECT_EQ(firstSequence + i, events[i].Arg1);
+    }
+    EXPECT_EQ(0u, rQueue.TryDequeueAll(events));
+  }
+
+  NativeWindowEvent MouseMove(const int32_t timestamp, const int32_t x, const VirtualMouseButtonFlags flags = VirtualMouseButtonFlags(),
+                              const bool isTouch = false)
+  {
+    return NativeWindowEventHelper::EncodeInputMouseMoveEvent(MillisecondTickCount32(timestamp), PxPoint2::Create(x, 0), flags, isTouch);
+  }
+
+  NativeWindowEvent RawMouseMove(const int32_t dx, const int32_t dy, const VirtualMouseButtonFlags flags = VirtualMouseButtonFlags())
+  {
+    return NativeWindowEventHelper::EncodeInputRawMouseMoveEvent(MillisecondTickCount32(), PxPoint2::Create(dx, dy), flags);
+  }
+
+  NativeWindowEvent MouseWheel(const int32_t delta, const int32_t x)
+  {
+    return NativeWindowEventHelper::EncodeInputMouseWheelEvent(MillisecondTickCount32(), delta, PxPoint2::Create(x, 0));
+  }
+
+  std::vector<NativeWindowEvent> PostAndDequeueCoalesced(const NativeWindowEventQueueBackend backend, const std::vector<NativeWindowEvent>& events)
+  {
+    NativeWindowEventQueue queue(backend);
+    for (const NativeWindowEvent& event : events)
+    {
+      queue.PostEvent(event);
+    }
+    std::vector<NativeWindowEvent> result;
+    queue.TryDequeueAllCoalesced(result);
+    return result;
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, Construct_Default)
+{
+  NativeWindowEventQueue queue;
+
+  EXPECT_EQ(NativeWindowEventQueueBackend::ConcurrentQueue, queue.GetBackend());
+  NativeWindowEvent event;
+  EXPECT_FALSE(queue.TryDequeue(event));
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeue_Order)
+{
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    NativeWindowEventQueue queue(backend);
+    PostEvents(queue, 0, 10);
+    ExpectSequence(queue, 0, 10);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, Ring_Overflow_TryDequeue_Order)
+{
+  NativeWindowEventQueue queue(NativeWindowEventQueueBackend::SingleProducerRing, SmallRingCapacity);
+
+  // Fill the ring and spill the rest into the overflow queue
+  PostEvents(queue, 0, 12);
+
+  // Dequeueing frees a ring slot, but the overflow is still active so the next events must be queued behind the spilled ones
+  NativeWindowEvent event;
+  ASSERT_TRUE(queue.TryDequeue(event));
+  EXPECT_EQ(0, event.Arg1);
+  PostEvents(queue, 12, 2);
+  ExpectSequence(queue, 1, 13);
+
+  // Once drained the producer is handed back to the ring
+  PostEvents(queue, 14, SmallRingCapacity);
+  ExpectSequence(queue, 14, SmallRingCapacity);
+}
+
+
+TEST(TestNativeWindowEventQueue, Ring_Overflow_TryDequeueAll_Order)
+{
+  NativeWindowEventQueue queue(NativeWindowEventQueueBackend::SingleProducerRing, SmallRingCapacity);
+
+  PostEvents(queue, 0, 12);
+  ExpectSequenceAll(queue, 0, 12);
+
+  // ring -> spill -> ring again
+  PostEvents(queue, 12, 3 * SmallRingCapacity);
+  ExpectSequenceAll(queue, 12, 3 * SmallRingCapacity);
+  PostEvents(queue, 24, 2);
+  ExpectSequenceAll(queue, 24, 2);
+}
+
+
+TEST(TestNativeWindowEventQueue, Ring_Clear_InOverflow)
+{
+  NativeWindowEventQueue queue(NativeWindowEventQueueBackend::SingleProducerRing, SmallRingCapacity);
+
+  PostEvents(queue, 0, 12);
+  queue.Clear();
+
+  NativeWindowEvent event;
+  EXPECT_FALSE(queue.TryDequeue(event));
+  std::vector<NativeWindowEvent> events;
+  EXPECT_EQ(0u, queue.TryDequeueAll(events));
+
+  PostEvents(queue, 100, 3);
+  ExpectSequence(queue, 100, 3);
+  PostEvents(queue, 200, 10);
+  ExpectSequenceAll(queue, 200, 10);
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAll_DoesNotCoalesce)
+{
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    NativeWindowEventQueue queue(backend);
+    queue.PostEvent(MouseMove(1, 10));
+    queue.PostEvent(MouseMove(2, 20));
+    queue.PostEvent(MouseWheel(1, 20));
+    queue.PostEvent(MouseWheel(1, 20));
+
+    std::vector<NativeWindowEvent> events;
+    EXPECT_EQ(4u, queue.TryDequeueAll(events));
+    ASSERT_EQ(4u, events.size());
+    EXPECT_EQ(MouseMove(1, 10).Arg1, events[0].Arg1);
+    EXPECT_EQ(MouseMove(2, 20).Arg1, events[1].Arg1);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_MouseMove_KeepsLatest)
+{
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {MouseMove(1, 10), MouseMove(2, 20), MouseMove(3, 30)});
+
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(MouseMove(3, 30).Arg1, events[0].Arg1);
+    EXPECT_EQ(3, events[0].Timestamp.Ticks());
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_MouseMove_StopsAtButtonChange)
+{
+  const VirtualMouseButtonFlags left(VirtualMouseButton::Left);
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events =
+      PostAndDequeueCoalesced(backend, {MouseMove(1, 10), MouseMove(2, 20, left), MouseMove(3, 30, left), MouseMove(4, 40), MouseMove(5, 50)});
+
+    ASSERT_EQ(3u, events.size());
+    EXPECT_EQ(1, events[0].Timestamp.Ticks());
+    EXPECT_EQ(3, events[1].Timestamp.Ticks());
+    EXPECT_EQ(NativeWindowEventHelper::EncodeVirtualMouseButtonFlags(left), events[1].Arg2);
+    EXPECT_EQ(5, events[2].Timestamp.Ticks());
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_MouseMove_StopsAtTouchChange)
+{
+  const VirtualMouseButtonFlags flags;
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events =
+      PostAndDequeueCoalesced(backend, {MouseMove(1, 10, flags, true), MouseMove(2, 20, flags, true), MouseMove(3, 30, flags, false)});
+
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(2, events[0].Timestamp.Ticks());
+    EXPECT_EQ(1, events[0].Arg3);
+    EXPECT_EQ(3, events[1].Timestamp.Ticks());
+    EXPECT_EQ(0, events[1].Arg3);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_StopsAtOtherEvent)
+{
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {MouseMove(1, 10), CreateEvent(2), MouseMove(3, 30)});
+
+    ASSERT_EQ(3u, events.size());
+    EXPECT_EQ(NativeWindowEventType::InputMouseMove, events[0].Type);
+    EXPECT_EQ(NativeWindowEventType::InputKey, events[1].Type);
+    EXPECT_EQ(NativeWindowEventType::InputMouseMove, events[2].Type);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_RawMouseMove_SumsDeltas)
+{
+  const VirtualMouseButtonFlags left(VirtualMouseButton::Left);
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {RawMouseMove(1, 2), RawMouseMove(3, -4), RawMouseMove(5, 6, left)});
+
+    ASSERT_EQ(2u, events.size());
+    EXPECT_EQ(4, events[0].Arg1);
+    EXPECT_EQ(-2, events[0].Arg2);
+    EXPECT_EQ(5, events[1].Arg1);
+    EXPECT_EQ(6, events[1].Arg2);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_RawMouseMove_Saturates)
+{
+  constexpr int32_t Max = std::numeric_limits<int32_t>::max();
+  constexpr int32_t Min = std::numeric_limits<int32_t>::min();
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {RawMouseMove(Max - 1, Min + 1), RawMouseMove(5, -5), RawMouseMove(-2, 2)});
+
+    ASSERT_EQ(1u, events.size());
+    EXPECT_EQ(Max - 2, events[0].Arg1);
+    EXPECT_EQ(Min + 2, events[0].Arg2);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_MouseWheel_SumsDeltas)
+{
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {MouseWheel(120, 10), MouseWheel(-40, 20), MouseWheel(120, 30)});
+
+    ASSERT_EQ(1u, events.size());
+    int32_t delta = 0;
+    PxPoint2 position;
+    NativeWindowEventHelper::DecodeInputMouseWheelEvent(events[0], delta, position);
+    EXPECT_EQ(200, delta);
+    EXPECT_EQ(PxPoint2::Create(30, 0), position);
+  }
+}
+
+
+TEST(TestNativeWindowEventQueue, TryDequeueAllCoalesced_MouseWheel_Saturates)
+{
+  constexpr int32_t Max = std::numeric_limits<int32_t>::max();
+  constexpr int32_t Min = std::numeric_limits<int32_t>::min();
+  for (const NativeWindowEventQueueBackend backend : Backends)
+  {
+    const auto events = PostAndDequeueCoalesced(backend, {MouseWheel(Max, 0), MouseWheel(Max, 0), MouseWheel(Min, 0), MouseWheel(Min, 0),
+                                                          MouseWheel(Min, 0)});
+
+    ASSERT_EQ(1u, events.size());
+    // Max + Max saturates at Max, the first Min brings it to -1 and the next ones saturate at Min
+    EXPECT_EQ(Min, events[0].Arg1);
+  }
+}
@@ -32,20 +32,43 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Collections/Concurrent/ConcurrentQueue_fwd.hpp>
+#include <FslBase/Collections/Concurrent/ConcurrentSpscRingBuffer.hpp>
 #include <FslNativeWindow/Base/INativeWindowEventQueue.hpp>
+#include <FslNativeWindow/Base/NativeWindowEventQueueBackend.hpp>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 namespace Fsl
 {
   //! @brief Simple queue interface for positing events
   //! Beware this object is thread safe.
+  //! @note When using NativeWindowEventQueueBackend::SingleProducerRing only one thread may post events and only one thread may dequeue them.
   class NativeWindowEventQueue : public INativeWindowEventQueue
   {
+  public:
+    static constexpr uint32_t DefaultRingCapacity = 1024;
+
+  private:
+    NativeWindowEventQueueBackend m_backend;
+    //! The queue used by the ConcurrentQueue backend and as the overflow queue of the ring backend
     ConcurrentQueue<NativeWindowEvent> m_queue;
+    std::unique_ptr<ConcurrentSpscRingBuffer<NativeWindowEvent>> m_ring;
+    //! Guards the transitions in and out of the ring overflow state
+    std::mutex m_overflowMutex;
+    std::atomic<bool> m_overflowActive{false};
 
   public:
     NativeWindowEventQueue();
+    explicit NativeWindowEventQueue(const NativeWindowEventQueueBackend backend, const uint32_t ringCapacity = DefaultRingCapacity);
     ~NativeWindowEventQueue() override;
 
+    NativeWindowEventQueueBackend GetBackend() const noexcept
+    {
+      return m_backend;
+    }
+
     //! @brief Clear all events from the queue
     void Clear();
 
@@ -53,8 +76,21 @@ namespace Fsl
     //! @return true on success, false if unsuccessful. When false rValue will be set to T().
     bool TryDequeue(NativeWindowEvent& rEvent);
 
+    //! @brief Remove all queued events and append them to rEvents.
+    //! @return the number of events that was appended.
+    std::size_t TryDequeueAll(std::vector<NativeWindowEvent>& rEvents);
+
+    //! @brief Remove all queued events and append them to rEvents.
+    //!        Consecutive mouse move, raw mouse move and mouse wheel events from the same source are coalesced into one event.
+    //! @note  Only use this if the consumer does not need the intermediate samples (stroke drawing or velocity tracking does).
+    //! @return the number of events that was appended.
+    std::size_t TryDequeueAllCoalesced(std::vector<NativeWindowEvent>& rEvents);
+
     // From INativeWindowEventQueue
     void PostEvent(const NativeWindowEvent& event) override;
+
+  private:
+    void PostOverflowEvent(const NativeWindowEvent& event);
   };
 }
 
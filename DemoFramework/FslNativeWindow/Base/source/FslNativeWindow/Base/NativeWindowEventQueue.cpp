@@ -31,10 +31,101 @@
 
 #include <FslBase/Collections/Concurrent/ConcurrentQueue.hpp>
 #include <FslNativeWindow/Base/NativeWindowEventQueue.hpp>
+#include <algorithm>
+#include <limits>
+#include <queue>
+#include <stdexcept>
 
 namespace Fsl
 {
-  NativeWindowEventQueue::NativeWindowEventQueue() = default;
+  namespace
+  {
+    int32_t AddSaturate(const int32_t lhs, const int32_t rhs) noexcept
+    {
+      const int64_t result = static_cast<int64_t>(lhs) + static_cast<int64_t>(rhs);
+      return static_cast<int32_t>(std::clamp(result, static_cast<int64_t>(std::numeric_limits<int32_t>::min()),
+                                             static_cast<int64_t>(std::numeric_limits<int32_t>::max())));
+    }
+
+    //! @brief Try to merge 'event' into 'rTarget'
+    bool TryCoalesce(NativeWindowEvent& rTarget, const NativeWindowEvent& event) noexcept
+    {
+      if (rTarget.Type != event.Type)
+      {
+        return false;
+      }
+      switch (event.Type)
+      {
+      case NativeWindowEventType::InputMouseMove:
+        // Absolute positions, so the latest event wins as long as the button state and touch flag are the same.
+        if (rTarget.Arg2 != event.Arg2 || rTarget.Arg3 != event.Arg3)
+        {
+          return false;
+        }
+        rTarget = event;
+        return true;
+      case NativeWindowEventType::InputRawMouseMove:
+        // Relative movement, so the deltas are accumulated as long as the button state is the same.
+        if (rTarget.Arg3 != event.Arg3)
+        {
+          return false;
+        }
+        rTarget.Timestamp = event.Timestamp;
+        rTarget.Arg1 = AddSaturate(rTarget.Arg1, event.Arg1);
+        rTarget.Arg2 = AddSaturate(rTarget.Arg2, event.Arg2);
+        return true;
+      case NativeWindowEventType::InputMouseWheel:
+        // Accumulate the wheel delta and use the latest position
+        rTarget.Timestamp = event.Timestamp;
+        rTarget.Arg1 = AddSaturate(rTarget.Arg1, event.Arg1);
+        rTarget.Arg2 = event.Arg2;
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    //! @brief Coalesce the events starting at startIndex in place
+    void Coalesce(std::vector<NativeWindowEvent>& rEvents, const std::size_t startIndex)
+    {
+      if ((rEvents.size() - startIndex) < 2u)
+      {
+        return;
+      }
+      std::size_t dstIndex = startIndex;
+      for (std::size_t srcIndex = startIndex + 1u; srcIndex < rEvents.size(); ++srcIndex)
+      {
+        if (!TryCoalesce(rEvents[dstIndex], rEvents[srcIndex]))
+        {
+          ++dstIndex;
+          rEvents[dstIndex] = rEvents[srcIndex];
+        }
+      }
+      rEvents.resize(dstIndex + 1u);
+    }
+  }
+
+
+  NativeWindowEventQueue::NativeWindowEventQueue()
+    : NativeWindowEventQueue(NativeWindowEventQueueBackend::ConcurrentQueue)
+  {
+  }
+
+
+  NativeWindowEventQueue::NativeWindowEventQueue(const NativeWindowEventQueueBackend backend, const uint32_t ringCapacity)
+    : m_backend(backend)
+  {
+    switch (backend)
+    {
+    case NativeWindowEventQueueBackend::ConcurrentQueue:
+      break;
+    case NativeWindowEventQueueBackend::SingleProducerRing:
+      m_ring = std::make_unique<ConcurrentSpscRingBuffer<NativeWindowEvent>>(ringCapacity);
+      break;
+    default:
+      throw std::invalid_argument("unsupported backend");
+    }
+  }
 
 
   NativeWindowEventQueue::~NativeWindowEventQueue() = default;
@@ -42,18 +133,116 @@ namespace Fsl
 
   void NativeWindowEventQueue::Clear()
   {
-    return m_queue.Clear();
+    if (!m_ring)
+    {
+      m_queue.Clear();
+      return;
+    }
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    m_ring->Clear();
+    m_queue.Clear();
+    m_overflowActive.store(false, std::memory_order_release);
   }
 
 
   bool NativeWindowEventQueue::TryDequeue(NativeWindowEvent& rEvent)
   {
-    return m_queue.TryDequeue(rEvent);
+    if (!m_ring)
+    {
+      return m_queue.TryDequeue(rEvent);
+    }
+    if (m_ring->TryDequeue(rEvent))
+    {
+      return true;
+    }
+    if (!m_overflowActive.load(std::memory_order_acquire))
+    {
+      return false;
+    }
+
+    // While the overflow is active the producer never writes to the ring, so anything still in it was posted before the overflow events.
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    if (m_ring->TryDequeue(rEvent))
+    {
+      return true;
+    }
+    if (m_queue.TryDequeue(rEvent))
+    {
+      return true;
+    }
+    m_overflowActive.store(false, std::memory_order_release);
+    return false;
+  }
+
+
+  std::size_t NativeWindowEventQueue::TryDequeueAll(std::vector<NativeWindowEvent>& rEvents)
+  {
+    const std::size_t startIndex = rEvents.size();
+    if (!m_ring)
+    {
+      std::queue<NativeWindowEvent> pending;
+      m_queue.SwapQueue(pending);
+      while (!pending.empty())
+      {
+        rEvents.push_back(pending.front());
+        pending.pop();
+      }
+    }
+    else
+    {
+      m_ring->TryDequeueAll(rEvents);
+      if (m_overflowActive.load(std::memory_order_acquire))
+      {
+        std::lock_guard<std::mutex> lock(m_overflowMutex);
+        m_ring->TryDequeueAll(rEvents);
+        std::queue<NativeWindowEvent> pending;
+        m_queue.SwapQueue(pending);
+        while (!pending.empty())
+        {
+          rEvents.push_back(pending.front());
+          pending.pop();
+        }
+        m_overflowActive.store(false, std::memory_order_release);
+      }
+    }
+    return rEvents.size() - startIndex;
+  }
+
+
+  std::size_t NativeWindowEventQueue::TryDequeueAllCoalesced(std::vector<NativeWindowEvent>& rEvents)
+  {
+    const std::size_t startIndex = rEvents.size();
+    TryDequeueAll(rEvents);
+    Coalesce(rEvents, startIndex);
+    return rEvents.size() - startIndex;
   }
 
 
   void NativeWindowEventQueue::PostEvent(const NativeWindowEvent& event)
   {
+    if (!m_ring)
+    {
+      m_queue.Enqueue(event);
+      return;
+    }
+    // Only the producer sets the overflow flag, so if its clear here it stays clear until this thread sets it.
+    if (!m_overflowActive.load(std::memory_order_acquire) && m_ring->TryEnqueue(event))
+    {
+      return;
+    }
+    PostOverflowEvent(event);
+  }
+
+
+  void NativeWindowEventQueue::PostOverflowEvent(const NativeWindowEvent& event)
+  {
+    std::lock_guard<std::mutex> lock(m_overflowMutex);
+    // The consumer might have drained the overflow since we checked
+    if (!m_overflowActive.load(std::memory_order_relaxed) && m_ring->TryEnqueue(event))
+    {
+      return;
+    }
+    m_overflowActive.store(true, std::memory_order_release);
     m_queue.Enqueue(event);
   }
 }
@@ -0,0 +1,142 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslAssimp/CachedSceneImporter.hpp>
+#include <FslAssimp/SceneImporter.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslGraphics/Vertices/VertexPositionNormalTexture.hpp>
+#include <FslGraphics3D/BasicScene/GenericMesh.hpp>
+#include <FslGraphics3D/BasicScene/GenericScene.hpp>
+#include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr const char* const ModelKnight = "Resources/Models/Knight2/armor.obj";
+    constexpr const char* const ModelDragon = "Resources/Models/Dragon/dragon.3ds";
+    constexpr const char* const CacheDirectory = "AssimpSceneCache.tmp";
+  }
+
+  using TestMesh = Graphics3D::GenericMesh<VertexPositionNormalTexture, uint16_t>;
+  using TestScene = Graphics3D::GenericScene<TestMesh>;
+
+  bool TryGetModelPath(IO::Path& rPath, const char* const pszRelativePath)
+  {
+    const char* const pszSdkPath = std::getenv("FSL_GRAPHICS_SDK");
+    if (pszSdkPath == nullptr)
+    {
+      return false;
+    }
+    rPath = IO::Path::Combine(IO::Path(pszSdkPath), IO::Path(pszRelativePath));
+    return true;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  //! The old way, run assimp every time
+  void SceneImporter_Load(benchmark::State& state, const char* const pszRelativePath)
+  {
+    IO::Path modelPath;
+    if (!TryGetModelPath(modelPath, pszRelativePath))
+    {
+      state.SkipWithError("FSL_GRAPHICS_SDK not defined");
+      return;
+    }
+
+    SceneImporter importer;
+    for (auto _ : state)
+    {
+      auto scene = importer.Load<TestScene>(modelPath);
+      benchmark::DoNotOptimize(scene);
+    }
+  }
+
+  //! Cold cache: run assimp and write the cache entry
+  void CachedSceneImporter_ColdLoad(benchmark::State& state, const char* const pszRelativePath)
+  {
+    IO::Path modelPath;
+    if (!TryGetModelPath(modelPath, pszRelativePath))
+    {
+      state.SkipWithError("FSL_GRAPHICS_SDK not defined");
+      return;
+    }
+
+    CachedSceneImporter importer{IO::Path(LocalConfig::CacheDirectory)};
+    const IO::Path cacheFilename =
+      importer.GetCacheFilename(modelPath, aiProcessPreset_TargetRealtime_Quality, VertexPositionNormalTexture::AsVertexDeclarationSpan());
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      std::remove(cacheFilename.ToUTF8String().c_str());
+      state.ResumeTiming();
+
+      auto scene = importer.Load<TestScene>(modelPath);
+      benchmark::DoNotOptimize(scene);
+    }
+    state.counters["Misses"] = importer.GetStats().CacheMisses;
+  }
+
+  //! Warm cache: load the cooked scene
+  void CachedSceneImporter_WarmLoad(benchmark::State& state, const char* const pszRelativePath)
+  {
+    IO::Path modelPath;
+    if (!TryGetModelPath(modelPath, pszRelativePath))
+    {
+      state.SkipWithError("FSL_GRAPHICS_SDK not defined");
+      return;
+    }
+
+    CachedSceneImporter importer{IO::Path(LocalConfig::CacheDirectory)};
+    // Ensure that the cache entry exist
+    importer.Load<TestScene>(modelPath);
+    for (auto _ : state)
+    {
+      auto scene = importer.Load<TestScene>(modelPath);
+      benchmark::DoNotOptimize(scene);
+    }
+    state.counters["Hits"] = importer.GetStats().CacheHits;
+  }
+}
+
+
+BENCHMARK_CAPTURE(SceneImporter_Load, Knight, LocalConfig::ModelKnight)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CachedSceneImporter_ColdLoad, Knight, LocalConfig::ModelKnight)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CachedSceneImporter_WarmLoad, Knight, LocalConfig::ModelKnight)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(SceneImporter_Load, Dragon, LocalConfig::ModelDragon)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CachedSceneImporter_ColdLoad, Dragon, LocalConfig::ModelDragon)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(CachedSceneImporter_WarmLoad, Dragon, LocalConfig::ModelDragon)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,221 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataDecimationPyramid.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Seed = 1337;
+    constexpr uint32_t SampleCount = 1000000;
+    constexpr uint32_t ChannelCount = 2;
+    //! A full HD wide chart
+    constexpr uint32_t ColumnCount = 1920;
+  }
+
+  //! Simulates a two channel cpu/gpu time history with the occasional spike
+  class SampleGenerator
+  {
+    std::mt19937 m_random{LocalConfig::Seed};
+    std::uniform_int_distribution<uint32_t> m_value{4000, 9000};
+    std::uniform_int_distribution<uint32_t> m_spike{0, 999};
+
+  public:
+    UI::ChartDataEntry Next()
+    {
+      UI::ChartDataEntry entry(m_value(m_random));
+      entry.Values[1] = m_value(m_random) * (m_spike(m_random) == 0 ? 4u : 1u);
+      return entry;
+    }
+  };
+
+  struct ChartSetup
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    std::shared_ptr<UI::ChartData> Data;
+    std::shared_ptr<UI::ChartDataView> View;
+    SampleGenerator Generator;
+
+    explicit ChartSetup(const uint32_t viewEntries)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+      , Data(std::make_shared<UI::ChartData>(DataBinding, LocalConfig::SampleCount, LocalConfig::ChannelCount, UI::ChartData::Constraints()))
+      , View(std::make_shared<UI::ChartDataView>(Data))
+    {
+      View->SetMaxViewEntries(viewEntries);
+      // Fill the circular buffer so every append evicts the oldest sample
+      for (uint32_t i = 0; i < LocalConfig::SampleCount; ++i)
+      {
+        Data->Append(Generator.Next());
+      }
+    }
+
+    void AppendSample()
+    {
+      Data->Append(Generator.Next());
+    }
+  };
+
+  uint32_t CalcStackedValue(const UI::ChartDataEntry& entry) noexcept
+  {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < LocalConfig::ChannelCount; ++i)
+    {
+      sum += entry.Values[i];
+    }
+    return sum;
+  }
+
+  //! The old ChartData behavior when a view is smaller than the buffer: a linear scan of the view
+  MinMax<uint32_t> CalculateViewMinMaxLinear(const UI::ChartDataView& dataView)
+  {
+    uint32_t min = std::numeric_limits<uint32_t>::max();
+    uint32_t max = 0;
+    const auto dataInfo = dataView.DataInfo();
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        const auto value = CalcStackedValue(entry);
+        min = std::min(min, value);
+        max = std::max(max, value);
+      }
+    }
+    return MinMax<uint32_t>(min, max);
+  }
+
+  //! Decimate by scanning every sample of the view
+  void DecimateLinear(const UI::ChartDataView& dataView, const uint32_t columnCount, std::vector<UI::ChartDataEntry>& rColumns)
+  {
+    std::vector<const UI::ChartDataEntry*> entries;
+    entries.reserve(dataView.Count());
+    const auto dataInfo = dataView.DataInfo();
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        entries.push_back(&entry);
+      }
+    }
+    rColumns.clear();
+    const auto count = static_cast<uint64_t>(entries.size());
+    for (uint32_t columnIndex = 0; columnIndex < columnCount; ++columnIndex)
+    {
+      const uint64_t begin = (static_cast<uint64_t>(columnIndex) * count) / columnCount;
+      const uint64_t end = (static_cast<uint64_t>(columnIndex + 1u) * count) / columnCount;
+      const UI::ChartDataEntry* pPeak = entries[begin];
+      for (uint64_t i = begin + 1; i < end; ++i)
+      {
+        if (CalcStackedValue(*entries[i]) > CalcStackedValue(*pPeak))
+        {
+          pPeak = entries[i];
+        }
+      }
+      rColumns.push_back(*pPeak);
+    }
+  }
+
+
+  void BM_ViewMinMax_Linear(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      benchmark::DoNotOptimize(CalculateViewMinMaxLinear(*setup.View));
+    }
+  }
+
+  void BM_ViewMinMax_SlidingWindow(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      benchmark::DoNotOptimize(setup.View->CalculateDataStats());
+    }
+  }
+
+  void BM_Decimate_Linear(benchmark::State& state)
+  {
+    ChartSetup setup(LocalConfig::SampleCount);
+    std::vector<UI::ChartDataEntry> columns;
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      DecimateLinear(*setup.View, LocalConfig::ColumnCount, columns);
+      benchmark::DoNotOptimize(columns.data());
+    }
+  }
+
+  void BM_Decimate_Pyramid(benchmark::State& state)
+  {
+    ChartSetup setup(LocalConfig::SampleCount);
+    UI::ChartDataDecimationPyramid pyramid;
+    std::vector<UI::ChartDataEntry> columns;
+    // Build the pyramid so the benchmark measures the steady state
+    pyramid.Update(*setup.View);
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      benchmark::DoNotOptimize(pyramid.TryDecimate(*setup.View, LocalConfig::ColumnCount, columns));
+    }
+  }
+
+  void BM_Decimate_PyramidRebuild(benchmark::State& state)
+  {
+    ChartSetup setup(LocalConfig::SampleCount);
+    std::vector<UI::ChartDataEntry> columns;
+    for (auto _ : state)
+    {
+      UI::ChartDataDecimationPyramid pyramid;
+      benchmark::DoNotOptimize(pyramid.TryDecimate(*setup.View, LocalConfig::ColumnCount, columns));
+    }
+  }
+}
+
+// The view sizes are a quarter of and the full 1M sample buffer
+BENCHMARK(BM_ViewMinMax_Linear)->Arg(250000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ViewMinMax_SlidingWindow)->Arg(250000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Decimate_Linear)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Decimate_Pyramid)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Decimate_PyramidRebuild)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,177 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/BoxPlotHelper.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Seed = 1337;
+  }
+
+  //! Simulates a frame time history (in microseconds) with the occasional hitch
+  class FrameTimeGenerator
+  {
+    std::mt19937 m_random{LocalConfig::Seed};
+    std::normal_distribution<double> m_frameTime{16667.0, 800.0};
+    std::uniform_int_distribution<uint32_t> m_hitch{0, 99};
+
+  public:
+    uint32_t Next()
+    {
+      const double value = m_frameTime(m_random) * (m_hitch(m_random) == 0 ? 3.0 : 1.0);
+      return static_cast<uint32_t>(std::max(value, 0.0));
+    }
+  };
+
+  struct ChartSetup
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    std::shared_ptr<UI::ChartData> Data;
+    std::shared_ptr<UI::ChartDataView> View;
+    FrameTimeGenerator Generator;
+
+    explicit ChartSetup(const uint32_t sampleCount)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+      , Data(std::make_shared<UI::ChartData>(DataBinding, sampleCount, 1, UI::ChartData::Constraints()))
+      , View(std::make_shared<UI::ChartDataView>(Data))
+    {
+      // Fill the circular buffer so every append evicts the oldest sample
+      for (uint32_t i = 0; i < sampleCount; ++i)
+      {
+        Data->Append(UI::ChartDataEntry(Generator.Next()));
+      }
+    }
+
+    void AppendSample()
+    {
+      Data->Append(UI::ChartDataEntry(Generator.Next()));
+    }
+  };
+
+  //! The old ChartSortedDataChannelView behavior, where the sorted data was rebuilt using a insertion sort on every change
+  void RebuildInsertionSorted(const UI::ChartDataView& dataView, std::vector<uint32_t>& rSorted)
+  {
+    const auto dataInfo = dataView.DataInfo();
+    rSorted.clear();
+    rSorted.reserve(dataInfo.TotalElementCount);
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        const auto value = entry.Values[0];
+        rSorted.insert(std::lower_bound(rSorted.begin(), rSorted.end(), value), value);
+      }
+    }
+  }
+
+  //! Rebuild the sorted data with a full sort on every change
+  void RebuildFullSort(const UI::ChartDataView& dataView, std::vector<uint32_t>& rSorted)
+  {
+    const auto dataInfo = dataView.DataInfo();
+    rSorted.clear();
+    rSorted.reserve(dataInfo.TotalElementCount);
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        rSorted.push_back(entry.Values[0]);
+      }
+    }
+    std::sort(rSorted.begin(), rSorted.end());
+  }
+
+
+  void BM_AppendBoxPlot_LegacyInsertionSort(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    std::vector<uint32_t> sorted;
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      RebuildInsertionSorted(*setup.View, sorted);
+      benchmark::DoNotOptimize(UI::BoxPlotHelper::Calculate(ReadOnlySpan<uint32_t>(sorted.data(), sorted.size())));
+    }
+  }
+
+  void BM_AppendBoxPlot_FullSort(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    std::vector<uint32_t> sorted;
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      RebuildFullSort(*setup.View, sorted);
+      benchmark::DoNotOptimize(UI::BoxPlotHelper::Calculate(ReadOnlySpan<uint32_t>(sorted.data(), sorted.size())));
+    }
+  }
+
+  void BM_AppendBoxPlot_Incremental(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    UI::ChartSortedDataChannelView sortedView(setup.View, 0);
+    // Build the initial cache so the benchmark measures the steady state
+    benchmark::DoNotOptimize(sortedView.GetChannelViewSpan());
+    for (auto _ : state)
+    {
+      setup.AppendSample();
+      benchmark::DoNotOptimize(UI::BoxPlotHelper::Calculate(sortedView.GetChannelViewSpan()));
+    }
+  }
+
+  void BM_BoxPlotCalculate(benchmark::State& state)
+  {
+    ChartSetup setup(static_cast<uint32_t>(state.range(0)));
+    UI::ChartSortedDataChannelView sortedView(setup.View, 0);
+    const auto sortedSpan = sortedView.GetChannelViewSpan();
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(UI::BoxPlotHelper::Calculate(sortedSpan));
+    }
+  }
+}
+
+BENCHMARK(BM_AppendBoxPlot_LegacyInsertionSort)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AppendBoxPlot_FullSort)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AppendBoxPlot_Incremental)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_BoxPlotCalculate)->Arg(1000)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
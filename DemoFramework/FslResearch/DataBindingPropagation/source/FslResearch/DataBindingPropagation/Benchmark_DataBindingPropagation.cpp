@@ -0,0 +1,205 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/Bind/MultiConverterBinding.hpp>
+#include <FslDataBinding/Base/Binding.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslDataBinding/Base/Object/DependencyObject.hpp>
+#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    // 1000 * 100 = 100k bound properties
+    constexpr uint32_t GraphWidth = 1000;
+    constexpr uint32_t GraphDepth = 100;
+  }
+
+  class BenchObject final : public DataBinding::DependencyObject
+  {
+    DataBinding::TypedDependencyProperty<float> m_propertyValue;
+
+  public:
+    explicit BenchObject(const std::shared_ptr<DataBinding::DataBindingService>& dataBinding)
+      : DataBinding::DependencyObject(dataBinding)
+    {
+    }
+
+    float GetValue() const noexcept
+    {
+      return m_propertyValue.Get();
+    }
+
+    bool SetValue(const float value)
+    {
+      return m_propertyValue.Set(ThisDependencyObject(), value, DataBinding::PropertyChangeReason::Modified);
+    }
+
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyValue;
+
+  protected:
+    DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final
+    {
+      using namespace DataBinding;
+      auto res = DependencyObjectHelper::TryGetPropertyHandle(this, ThisDependencyObject(), sourceDef, PropLinkRefs(PropertyValue, m_propertyValue));
+      return res.IsValid() ? res : DependencyObject::TryGetPropertyHandleNow(sourceDef);
+    }
+
+    DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                           const DataBinding::Binding& binding) final
+    {
+      using namespace DataBinding;
+      auto res =
+        DependencyObjectHelper::TrySetBinding(this, ThisDependencyObject(), targetDef, binding, PropLinkRefs(PropertyValue, m_propertyValue));
+      return res != PropertySetBindingResult::NotFound ? res : DependencyObject::TrySetBindingNow(targetDef, binding);
+    }
+  };
+
+  DataBinding::DependencyPropertyDefinition BenchObject::PropertyValue =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<float, BenchObject, &BenchObject::GetValue, &BenchObject::SetValue>("Value");
+
+
+  enum class GraphType
+  {
+    //! GraphWidth independent chains that are GraphDepth long
+    Chains,
+    //! Every node is bound to two nodes of the previous layer, so every node is the bottom of multiple diamonds
+    DiamondGrid
+  };
+
+  struct GraphSetup
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    std::vector<std::unique_ptr<BenchObject>> Nodes;
+    float Value{0.0f};
+
+    explicit GraphSetup(const GraphType graphType)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+    {
+      Nodes.reserve(LocalConfig::GraphWidth * LocalConfig::GraphDepth);
+      for (uint32_t i = 0; i < (LocalConfig::GraphWidth * LocalConfig::GraphDepth); ++i)
+      {
+        Nodes.push_back(std::make_unique<BenchObject>(DataBinding));
+      }
+      auto averageBinding = std::make_shared<DataBinding::MultiConverterBinding<float, float, float>>([](const float value0, const float value1)
+                                                                                                        { return (value0 + value1) * 0.5f; });
+      for (uint32_t layer = 1; layer < LocalConfig::GraphDepth; ++layer)
+      {
+        for (uint32_t x = 0; x < LocalConfig::GraphWidth; ++x)
+        {
+          BenchObject& rTarget = Get(x, layer);
+          if (graphType == GraphType::Chains)
+          {
+            rTarget.SetBinding(BenchObject::PropertyValue, Get(x, layer - 1).GetPropertyHandle(BenchObject::PropertyValue));
+          }
+          else
+          {
+            const uint32_t x1 = (x + 1) % LocalConfig::GraphWidth;
+            rTarget.SetBinding(BenchObject::PropertyValue,
+                               DataBinding::Binding(averageBinding, Get(x, layer - 1).GetPropertyHandle(BenchObject::PropertyValue),
+                                                    Get(x1, layer - 1).GetPropertyHandle(BenchObject::PropertyValue)));
+          }
+        }
+      }
+      DataBinding->ExecuteChanges();
+    }
+
+    BenchObject& Get(const uint32_t x, const uint32_t layer)
+    {
+      return *Nodes[(layer * LocalConfig::GraphWidth) + x];
+    }
+
+    void ChangeRoots(const uint32_t count)
+    {
+      Value += 1.0f;
+      for (uint32_t x = 0; x < count; ++x)
+      {
+        Get(x, 0).SetValue(Value);
+      }
+    }
+  };
+
+
+  void SetCounters(benchmark::State& state, const DataBinding::DataBindingServiceStats& stats)
+  {
+    state.counters["NodesVisited"] = static_cast<double>(stats.NodesVisited);
+    state.counters["GetSetCalls"] = static_cast<double>(stats.PropertyGetSetCalls);
+  }
+
+
+  void BM_ExecuteChanges_Chains(benchmark::State& state)
+  {
+    GraphSetup setup(GraphType::Chains);
+    const auto rootCount = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+      setup.ChangeRoots(rootCount);
+      setup.DataBinding->ExecuteChanges();
+    }
+    SetCounters(state, setup.DataBinding->GetLastExecuteStats());
+  }
+
+  void BM_ExecuteChanges_DiamondGrid(benchmark::State& state)
+  {
+    GraphSetup setup(GraphType::DiamondGrid);
+    const auto rootCount = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+      setup.ChangeRoots(rootCount);
+      setup.DataBinding->ExecuteChanges();
+    }
+    SetCounters(state, setup.DataBinding->GetLastExecuteStats());
+  }
+
+  void BM_ExecuteChanges_NoChanges(benchmark::State& state)
+  {
+    GraphSetup setup(GraphType::DiamondGrid);
+    for (auto _ : state)
+    {
+      setup.DataBinding->ExecuteChanges();
+    }
+    SetCounters(state, setup.DataBinding->GetLastExecuteStats());
+  }
+}
+
+BENCHMARK(BM_ExecuteChanges_Chains)->Arg(1)->Arg(LocalConfig::GraphWidth)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ExecuteChanges_DiamondGrid)->Arg(1)->Arg(LocalConfig::GraphWidth)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_ExecuteChanges_NoChanges)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,202 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/Logger0.hpp>
+#include <FslBase/Math/BasicWindowMetrics.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFont.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Base/System/UIManager.hpp>
+#include <FslSimpleUI/Base/WindowContext.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCompiler.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateLoader.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateSerializer.hpp>
+#include <FslSimpleUI/Declarative/UIReader.hpp>
+#include <FslSimpleUI/Declarative/UnitTest/Helper/TestThemeControlFactory.hpp>
+#include <FslSimpleUI/Render/Stub/RenderSystem.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t DensityDpi = 160;
+    //! The number of controls created for each dialog row
+    constexpr uint32_t NodesPerRow = 7;
+  }
+
+  //! A layout heavy settings style dialog, each row is a grid with a icon strip, a bound filler and a value column
+  std::string CreateDialogXml(const uint32_t rows)
+  {
+    std::string xml;
+    xml += "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n<DeclarativeUITest>\n";
+    xml += "  <StackLayout Name=\"dialog\" Orientation=\"Vertical\" Spacing=\"4\" Margin=\"8,8,8,8\" AlignmentX=\"Center\" AlignmentY=\"Center\" "
+           "MaxWidth=\"640\">\n";
+    for (uint32_t row = 0; row < rows; ++row)
+    {
+      xml += fmt::format("    <GridLayout Name=\"row{}\" Margin=\"0,2,0,2\" AlignmentX=\"Stretch\">\n", row);
+      xml += "      <GridLayout.ColumnDefinitions>\n";
+      xml += "        <GridColumnDefinition Width=\"Auto\"/>\n";
+      xml += "        <GridColumnDefinition Width=\"*\"/>\n";
+      xml += "        <GridColumnDefinition Width=\"64\"/>\n";
+      xml += "      </GridLayout.ColumnDefinitions>\n";
+      xml += "      <GridLayout.RowDefinitions>\n";
+      xml += "        <GridRowDefinition Height=\"Auto\"/>\n";
+      xml += "      </GridLayout.RowDefinitions>\n";
+      xml += "      <StackLayout GridLayout.Column=\"0\" Orientation=\"Horizontal\" Spacing=\"2\" MinWidth=\"32\" AlignmentY=\"Center\">\n";
+      xml += "        <FillLayout Width=\"16\" Height=\"16\" Margin=\"1,1,1,1\"/>\n";
+      xml += "        <FillLayout Width=\"16\" Height=\"16\" Margin=\"1,1,1,1\"/>\n";
+      xml += "      </StackLayout>\n";
+      xml += "      <FillLayout GridLayout.Column=\"1\" Width=\"{Binding ElementName=dialog,Path=MaxWidth}\" AlignmentY=\"Center\"/>\n";
+      xml += "      <StackLayout GridLayout.Column=\"2\" Orientation=\"Vertical\" AlignmentX=\"Far\">\n";
+      xml += "        <FillLayout MaxWidth=\"64\" Height=\"24\" Margin=\"2,0,2,0\"/>\n";
+      xml += "      </StackLayout>\n";
+      xml += "    </GridLayout>\n";
+    }
+    xml += "  </StackLayout>\n</DeclarativeUITest>\n";
+    return xml;
+  }
+
+
+  struct DialogSetup
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    UI::UIManager Manager;
+    std::shared_ptr<UI::WindowContext> WindowContext;
+    UI::Declarative::ControlFactory ControlFactory;
+    uint32_t NodeCount;
+    std::string Xml;
+    IO::Path XmlPath;
+
+    explicit DialogSetup(const uint32_t rows)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+      , Manager(DataBinding, std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear, false,
+                BasicWindowMetrics(PxExtent2D::Create(800, 600), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+      , WindowContext(std::make_shared<UI::WindowContext>(Manager.GetUIContext(), std::make_shared<SpriteFont>(), LocalConfig::DensityDpi,
+                                                          UI::UIColorSpace::SRGBNonLinear))
+      , ControlFactory(std::make_shared<UI::TestThemeControlFactory>(WindowContext))
+      , NodeCount(1u + (rows * LocalConfig::NodesPerRow))
+      , Xml(CreateDialogXml(rows))
+      , XmlPath((std::filesystem::temp_directory_path() / fmt::format("FslResearch.DeclarativeUITemplate.{}.xml", rows)).string())
+    {
+      // The reader logs the xml load result on every load
+      LogConfig::SetLogLevel(LogType::Warning);
+      IO::File::WriteAllText(XmlPath, Xml);
+    }
+
+    ~DialogSetup()
+    {
+      std::error_code ec;
+      std::filesystem::remove(XmlPath.ToUTF8String(), ec);
+    }
+
+    ReadOnlySpan<uint8_t> GetXmlSpan() const noexcept
+    {
+      return ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(Xml.data()), Xml.size());
+    }
+  };
+
+
+  void SetNodeCounter(benchmark::State& state, const DialogSetup& setup)
+  {
+    state.counters["Nodes"] = benchmark::Counter(static_cast<double>(setup.NodeCount), benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+
+  //! The complete load from a xml file as done by the declarative demo apps (parse + resolve + instantiate)
+  void BM_UIReaderLoad(benchmark::State& state)
+  {
+    DialogSetup setup(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+      auto window = UI::Declarative::UIReader::Load(setup.ControlFactory, setup.DataBinding, setup.XmlPath);
+      benchmark::DoNotOptimize(window);
+    }
+    SetNodeCounter(state, setup);
+  }
+
+  //! The one time cost of turning the xml into a template
+  void BM_TemplateCompile(benchmark::State& state)
+  {
+    DialogSetup setup(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+      auto uiTemplate = UI::Declarative::UITemplateCompiler::CompileFromMemory(setup.ControlFactory, setup.GetXmlSpan());
+      benchmark::DoNotOptimize(uiTemplate);
+    }
+    SetNodeCounter(state, setup);
+  }
+
+  //! Loading a template that was compiled offline
+  void BM_TemplateDeserialize(benchmark::State& state)
+  {
+    DialogSetup setup(static_cast<uint32_t>(state.range(0)));
+    const std::vector<uint8_t> binary = UI::Declarative::UITemplateSerializer::Serialize(
+      UI::Declarative::UITemplateCompiler::CompileFromMemory(setup.ControlFactory, setup.GetXmlSpan()));
+    for (auto _ : state)
+    {
+      auto uiTemplate = UI::Declarative::UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(binary));
+      benchmark::DoNotOptimize(uiTemplate);
+    }
+    state.counters["Bytes"] = static_cast<double>(binary.size());
+    SetNodeCounter(state, setup);
+  }
+
+  //! Creating the controls from a already loaded template, this is all that remains on a cache hit
+  void BM_TemplateInstantiate(benchmark::State& state)
+  {
+    DialogSetup setup(static_cast<uint32_t>(state.range(0)));
+    const UI::Declarative::UITemplate uiTemplate = UI::Declarative::UITemplateCompiler::CompileFromMemory(setup.ControlFactory, setup.GetXmlSpan());
+    for (auto _ : state)
+    {
+      auto window = UI::Declarative::UITemplateLoader::Instantiate(setup.ControlFactory, setup.DataBinding, uiTemplate);
+      benchmark::DoNotOptimize(window);
+    }
+    SetNodeCounter(state, setup);
+  }
+}
+
+BENCHMARK(BM_UIReaderLoad)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TemplateCompile)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TemplateDeserialize)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_TemplateInstantiate)->Arg(8)->Arg(32)->Unit(benchmark::kMicrosecond);
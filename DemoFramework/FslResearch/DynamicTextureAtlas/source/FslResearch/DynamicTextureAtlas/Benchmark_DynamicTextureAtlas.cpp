@@ -0,0 +1,270 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxExtent2D.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Colors.hpp>
+#include <FslGraphics/Render/GenericBatch2D.hpp>
+#include <FslGraphics/Render/Stats/NativeBatch2DStats.hpp>
+#include <FslGraphics/TextureAtlas/Dynamic/DynamicTextureAtlas.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Seed = 1234;
+    constexpr uint32_t MinThumbnailSizePx = 16;
+    constexpr uint32_t MaxThumbnailSizePx = 96;
+    constexpr PxExtent2D PageExtentPx = PxExtent2D::Create(1024, 1024);
+    constexpr PxExtent2D ScreenExtentPx = PxExtent2D::Create(1920, 1080);
+  }
+
+  struct Thumbnail
+  {
+    IO::Path Name;
+    PxExtent2D ExtentPx;
+    std::vector<uint8_t> Content;
+  };
+
+  //! Chart thumbnails and runtime loaded icons of varying size
+  std::vector<Thumbnail> CreateThumbnails(const uint32_t count)
+  {
+    std::mt19937 random(LocalConfig::Seed);
+    std::uniform_int_distribution<uint32_t> sizeDist(LocalConfig::MinThumbnailSizePx, LocalConfig::MaxThumbnailSizePx);
+    std::vector<Thumbnail> thumbnails(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      Thumbnail& rEntry = thumbnails[i];
+      rEntry.Name = IO::Path(fmt::format("thumbnail{}", i));
+      rEntry.ExtentPx = PxExtent2D::Create(sizeDist(random), sizeDist(random));
+      rEntry.Content.resize(static_cast<std::size_t>(rEntry.ExtentPx.Width.Value) * rEntry.ExtentPx.Height.Value * 4u, static_cast<uint8_t>(i));
+    }
+    return thumbnails;
+  }
+
+  ReadOnlyRawBitmap AsBitmap(const Thumbnail& thumbnail)
+  {
+    return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(thumbnail.Content), thumbnail.ExtentPx, PixelFormat::R8G8B8A8_UNORM,
+                                     BitmapOrigin::UpperLeft);
+  }
+
+  DynamicTextureAtlasConfig CreateAtlasConfig(const uint32_t maxPages)
+  {
+    return {LocalConfig::PageExtentPx, PixelFormat::R8G8B8A8_UNORM, 1, 1, maxPages, 160};
+  }
+
+  // A minimal texture and native batch so we can count the draw calls GenericBatch2D issues
+
+  struct CountingTexture
+  {
+    uint32_t Id{0};
+    PxExtent2D Extent;
+
+    bool IsValid() const
+    {
+      return true;
+    }
+
+    bool operator==(const CountingTexture& rhs) const
+    {
+      return Id == rhs.Id && Extent == rhs.Extent;
+    }
+
+    bool operator!=(const CountingTexture& rhs) const
+    {
+      return !(*this == rhs);
+    }
+  };
+
+  class CountingNativeBatch
+  {
+    NativeBatch2DStats m_stats;
+
+  public:
+    void Begin(const PxSize2D& /*sizePx*/, const BlendState /*blendState*/, const BatchSdfRenderConfig& /*sdfRenderConfig*/,
+               const bool /*restoreState*/)
+    {
+      m_stats = {};
+    }
+
+    void DrawQuads(const VertexPositionColorTexture* const pVertices, const uint32_t length, const CountingTexture& /*textureInfo*/)
+    {
+      benchmark::DoNotOptimize(pVertices);
+      ++m_stats.DrawCalls;
+      m_stats.Vertices += length * 4u;
+    }
+
+    void End()
+    {
+    }
+
+    NativeBatch2DStats GetStats() const
+    {
+      return m_stats;
+    }
+  };
+
+  using CountingBatch2D = GenericBatch2D<std::shared_ptr<CountingNativeBatch>, CountingTexture, GenericBatch2DFormat::Normal>;
+
+  struct DrawRecord
+  {
+    CountingTexture Texture;
+    PxRectangleU32 SrcRectPx;
+  };
+
+  void DrawFrame(CountingBatch2D& rBatch, const std::vector<DrawRecord>& records)
+  {
+    rBatch.Begin();
+    float x = 0;
+    float y = 0;
+    for (const DrawRecord& record : records)
+    {
+      rBatch.Draw(record.Texture, Vector2(x, y), record.SrcRectPx, Colors::White());
+      x += static_cast<float>(LocalConfig::MaxThumbnailSizePx);
+      if (x >= static_cast<float>(LocalConfig::ScreenExtentPx.Width.Value))
+      {
+        x = 0;
+        y += static_cast<float>(LocalConfig::MaxThumbnailSizePx);
+      }
+    }
+    rBatch.End();
+  }
+
+  void RunDrawBenchmark(benchmark::State& state, const std::vector<DrawRecord>& records)
+  {
+    auto native = std::make_shared<CountingNativeBatch>();
+    CountingBatch2D batch(native, LocalConfig::ScreenExtentPx);
+    for (auto _ : state)
+    {
+      DrawFrame(batch, records);
+    }
+    state.counters["DrawCalls"] = static_cast<double>(batch.GetStats().Native.DrawCalls);
+    state.counters["Quads"] = static_cast<double>(records.size());
+  }
+
+
+  //! Packing cost, the atlas is filled from scratch every iteration
+  void BM_AtlasPack(benchmark::State& state)
+  {
+    const auto thumbnails = CreateThumbnails(static_cast<uint32_t>(state.range(0)));
+    uint32_t pageCount = 0;
+    for (auto _ : state)
+    {
+      DynamicTextureAtlas atlas(CreateAtlasConfig(16));
+      for (const Thumbnail& thumbnail : thumbnails)
+      {
+        atlas.Add(thumbnail.Name, AsBitmap(thumbnail));
+      }
+      pageCount = atlas.PageCount();
+      benchmark::DoNotOptimize(atlas);
+    }
+    state.counters["Pages"] = static_cast<double>(pageCount);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  //! Every thumbnail has its own texture (the behavior before the dynamic atlas)
+  void BM_DrawSeparateTextures(benchmark::State& state)
+  {
+    const auto thumbnails = CreateThumbnails(static_cast<uint32_t>(state.range(0)));
+    std::vector<DrawRecord> records;
+    for (uint32_t i = 0; i < thumbnails.size(); ++i)
+    {
+      const PxExtent2D extentPx = thumbnails[i].ExtentPx;
+      records.push_back({CountingTexture{i, extentPx}, PxRectangleU32(PxValueU(0), PxValueU(0), extentPx.Width, extentPx.Height)});
+    }
+    RunDrawBenchmark(state, records);
+  }
+
+  //! The thumbnails are packed into atlas pages
+  void BM_DrawAtlas(benchmark::State& state)
+  {
+    const auto thumbnails = CreateThumbnails(static_cast<uint32_t>(state.range(0)));
+    DynamicTextureAtlas atlas(CreateAtlasConfig(16));
+    std::vector<DrawRecord> records;
+    for (const Thumbnail& thumbnail : thumbnails)
+    {
+      const DynamicTextureAtlasRegion region = atlas.Add(thumbnail.Name, AsBitmap(thumbnail));
+      records.push_back({CountingTexture{region.PageIndex, LocalConfig::PageExtentPx}, region.TextureInfo.TrimmedRectPx});
+    }
+    RunDrawBenchmark(state, records);
+    state.counters["Pages"] = static_cast<double>(atlas.PageCount());
+  }
+
+  //! One thumbnail changes per frame, compare the bytes a full page upload needs with the dirty rows
+  void BM_AtlasUpdateUpload(benchmark::State& state)
+  {
+    const auto thumbnails = CreateThumbnails(static_cast<uint32_t>(state.range(0)));
+    DynamicTextureAtlas atlas(CreateAtlasConfig(16));
+    for (const Thumbnail& thumbnail : thumbnails)
+    {
+      atlas.Add(thumbnail.Name, AsBitmap(thumbnail));
+    }
+    for (uint32_t i = 0; i < atlas.PageCount(); ++i)
+    {
+      atlas.ClearPageDirtyRect(i);
+    }
+
+    uint64_t dirtyBytes = 0;
+    uint64_t fullPageBytes = 0;
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+      const Thumbnail& thumbnail = thumbnails[index];
+      index = (index + 1) % thumbnails.size();
+      atlas.Update(thumbnail.Name, AsBitmap(thumbnail));
+      for (uint32_t i = 0; i < atlas.PageCount(); ++i)
+      {
+        if (atlas.IsPageDirty(i))
+        {
+          const ReadOnlyRawBitmap rows = atlas.GetPageDirtyRowBitmap(i);
+          dirtyBytes += static_cast<uint64_t>(rows.Stride()) * rows.RawUnsignedHeight();
+          fullPageBytes += static_cast<uint64_t>(atlas.GetPageBitmap(i).Stride()) * LocalConfig::PageExtentPx.Height.Value;
+          benchmark::DoNotOptimize(rows.Content());
+          atlas.ClearPageDirtyRect(i);
+        }
+      }
+    }
+    state.counters["DirtyBytes"] = benchmark::Counter(static_cast<double>(dirtyBytes), benchmark::Counter::kAvgIterations);
+    state.counters["FullPageBytes"] = benchmark::Counter(static_cast<double>(fullPageBytes), benchmark::Counter::kAvgIterations);
+  }
+}
+
+BENCHMARK(BM_AtlasPack)->Arg(64)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DrawSeparateTextures)->Arg(64)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DrawAtlas)->Arg(64)->Arg(256)->Arg(1024)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_AtlasUpdateUpload)->Arg(256);
@@ -0,0 +1,195 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Collections/DenseHandleVector.hpp>
+#include <FslBase/Collections/HandleVector.hpp>
+#include <FslBase/Collections/VersionedHandleVector.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t RandomSeed = 0x1337;
+  }
+
+  //! A record roughly the size of the records stored by the UI mesh managers
+  struct BenchRecord
+  {
+    float Value{};
+    std::array<uint32_t, 7> Payload{};
+  };
+
+  template <typename TVector>
+  float SumValues(const TVector& vector)
+  {
+    const auto span = vector.AsSpan();
+    float sum = 0.0f;
+    for (std::size_t i = 0; i < span.size(); ++i)
+    {
+      sum += span[i].Value;
+    }
+    return sum;
+  }
+
+  // The dense vector can expose its elements as a contiguous span
+  float SumValues(const DenseHandleVector<BenchRecord>& vector)
+  {
+    float sum = 0.0f;
+    for (const BenchRecord& record : vector.AsReadOnlySpan())
+    {
+      sum += record.Value;
+    }
+    return sum;
+  }
+
+  template <typename TVector>
+  std::vector<typename TVector::handle_type> Fill(TVector& rVector, const uint32_t count)
+  {
+    std::vector<typename TVector::handle_type> handles(count);
+    for (uint32_t i = 0; i < count; ++i)
+    {
+      BenchRecord record;
+      record.Value = static_cast<float>(i);
+      handles[i] = rVector.Add(record);
+    }
+    return handles;
+  }
+
+  template <typename TVector>
+  std::vector<typename TVector::handle_type> CreateShuffled(TVector& rVector, const uint32_t count)
+  {
+    auto handles = Fill(rVector, count);
+    std::mt19937 random(LocalConfig::RandomSeed);
+    std::shuffle(handles.begin(), handles.end(), random);
+    return handles;
+  }
+
+  template <typename TVector>
+  void BM_Iterate(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    TVector vector;
+    Fill(vector, count);
+
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(SumValues(vector));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  template <typename TVector>
+  void BM_Lookup(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    TVector vector;
+    const auto handles = CreateShuffled(vector, count);
+
+    for (auto _ : state)
+    {
+      float sum = 0.0f;
+      for (const auto handle : handles)
+      {
+        sum += vector.Get(handle).Value;
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  template <typename TVector>
+  void BM_RemoveBySwap(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    for (auto _ : state)
+    {
+      state.PauseTiming();
+      TVector vector;
+      const auto handles = CreateShuffled(vector, count);
+      state.ResumeTiming();
+
+      for (const auto handle : handles)
+      {
+        vector.RemoveBySwap(handle);
+      }
+      benchmark::DoNotOptimize(vector.Count());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  template <typename TVector>
+  void BM_AddRemoveChurn(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    TVector vector;
+    auto handles = CreateShuffled(vector, count);
+
+    // Replace the entries one by one which recycles the handles
+    for (auto _ : state)
+    {
+      for (auto& rHandle : handles)
+      {
+        vector.RemoveBySwap(rHandle);
+        rHandle = vector.Add(BenchRecord{});
+      }
+      benchmark::DoNotOptimize(vector.Count());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  using BenchHandleVector = HandleVector<BenchRecord>;
+  using BenchVersionedHandleVector = VersionedHandleVector<BenchRecord>;
+  using BenchDenseHandleVector = DenseHandleVector<BenchRecord>;
+}
+
+BENCHMARK_TEMPLATE(BM_Iterate, BenchHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_Iterate, BenchVersionedHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_Iterate, BenchDenseHandleVector)->Arg(1000)->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_Lookup, BenchHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_Lookup, BenchVersionedHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_Lookup, BenchDenseHandleVector)->Arg(1000)->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_RemoveBySwap, BenchHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RemoveBySwap, BenchVersionedHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_RemoveBySwap, BenchDenseHandleVector)->Arg(1000)->Arg(100000);
+
+BENCHMARK_TEMPLATE(BM_AddRemoveChurn, BenchHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_AddRemoveChurn, BenchVersionedHandleVector)->Arg(1000)->Arg(100000);
+BENCHMARK_TEMPLATE(BM_AddRemoveChurn, BenchDenseHandleVector)->Arg(1000)->Arg(100000);
@@ -0,0 +1,367 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Bitmap/BitmapUtil.hpp>
+#include <FslGraphics/Bitmap/Converter/RawBitmapBandConverter.hpp>
+#include <FslGraphics/Bitmap/RawBitmapEx.hpp>
+#include <FslGraphics/Bitmap/ReadOnlyRawBitmap.hpp>
+#include <FslGraphics/IO/StreamingImageReader.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <new>
+#include <string>
+#include <vector>
+
+// Every allocation is tracked so the benchmarks can report the peak amount of heap memory used while decoding an image.
+// The size is stored in front of the returned block.
+
+namespace
+{
+  constexpr std::size_t AllocationHeaderSize = alignof(std::max_align_t);
+
+  std::atomic<std::size_t> g_currentBytes{0};
+  std::atomic<std::size_t> g_peakBytes{0};
+
+  void* TrackedAllocate(const std::size_t size)
+  {
+    auto* pBlock = static_cast<uint8_t*>(std::malloc(size + AllocationHeaderSize));
+    if (pBlock == nullptr)
+    {
+      return nullptr;
+    }
+    *reinterpret_cast<std::size_t*>(pBlock) = size;
+    const std::size_t current = g_currentBytes.fetch_add(size) + size;
+    std::size_t peak = g_peakBytes.load();
+    while (current > peak && !g_peakBytes.compare_exchange_weak(peak, current))
+    {
+    }
+    return pBlock + AllocationHeaderSize;
+  }
+
+  void TrackedFree(void* pMemory) noexcept
+  {
+    if (pMemory != nullptr)
+    {
+      auto* pBlock = static_cast<uint8_t*>(pMemory) - AllocationHeaderSize;
+      g_currentBytes.fetch_sub(*reinterpret_cast<std::size_t*>(pBlock));
+      std::free(pBlock);
+    }
+  }
+}
+
+void* operator new(std::size_t size)
+{
+  void* pMemory = TrackedAllocate(size);
+  if (pMemory == nullptr)
+  {
+    throw std::bad_alloc();
+  }
+  return pMemory;
+}
+
+void* operator new[](std::size_t size)
+{
+  return operator new(size);
+}
+
+void* operator new(std::size_t size, const std::nothrow_t& /*unused*/) noexcept
+{
+  return TrackedAllocate(size);
+}
+
+void* operator new[](std::size_t size, const std::nothrow_t& /*unused*/) noexcept
+{
+  return TrackedAllocate(size);
+}
+
+void operator delete(void* pMemory) noexcept
+{
+  TrackedFree(pMemory);
+}
+
+void operator delete[](void* pMemory) noexcept
+{
+  TrackedFree(pMemory);
+}
+
+void operator delete(void* pMemory, std::size_t /*unused*/) noexcept
+{
+  TrackedFree(pMemory);
+}
+
+void operator delete[](void* pMemory, std::size_t /*unused*/) noexcept
+{
+  TrackedFree(pMemory);
+}
+
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t ImageWidth = 2048;
+    constexpr uint32_t ImageHeight = 2048;
+    // The typical texture upload request
+    constexpr PixelFormat DesiredPixelFormat = PixelFormat::R8G8B8A8_UNORM;
+    constexpr BitmapOrigin DesiredOrigin = BitmapOrigin::LowerLeft;
+  }
+
+  void WriteUInt16(std::string& rDst, const uint32_t value)
+  {
+    rDst.push_back(static_cast<char>(value & 0xFF));
+    rDst.push_back(static_cast<char>((value >> 8) & 0xFF));
+  }
+
+  void WriteUInt32(std::string& rDst, const uint32_t value)
+  {
+    WriteUInt16(rDst, value & 0xFFFF);
+    WriteUInt16(rDst, (value >> 16) & 0xFFFF);
+  }
+
+  uint8_t GetChannel(const uint32_t x, const uint32_t y, const uint32_t channel)
+  {
+    // Blocky content so the RLE encoded TGA gets runs
+    return static_cast<uint8_t>(((x / 16) * 7) + ((y / 16) * 13) + (channel * 31));
+  }
+
+  //! 24bpp bottom-up BMP
+  std::string CreateBmp()
+  {
+    constexpr uint32_t Stride = ((LocalConfig::ImageWidth * 3) + 3) & ~3u;
+    std::string content;
+    content.append("BM");
+    WriteUInt32(content, 14 + 40 + (Stride * LocalConfig::ImageHeight));
+    WriteUInt32(content, 0);
+    WriteUInt32(content, 14 + 40);
+    WriteUInt32(content, 40);
+    WriteUInt32(content, LocalConfig::ImageWidth);
+    WriteUInt32(content, LocalConfig::ImageHeight);
+    WriteUInt16(content, 1);
+    WriteUInt16(content, 24);
+    WriteUInt32(content, 0);
+    WriteUInt32(content, Stride * LocalConfig::ImageHeight);
+    content.append(16, '\0');
+    for (uint32_t y = 0; y < LocalConfig::ImageHeight; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::ImageWidth; ++x)
+      {
+        for (uint32_t channel = 0; channel < 3; ++channel)
+        {
+          content.push_back(static_cast<char>(GetChannel(x, LocalConfig::ImageHeight - 1 - y, channel)));
+        }
+      }
+      content.append(Stride - (LocalConfig::ImageWidth * 3), '\0');
+    }
+    return content;
+  }
+
+  //! 24bpp bottom-up RLE TGA (one run packet per 16 pixel block)
+  std::string CreateTgaRLE()
+  {
+    std::string content;
+    content.append(2, '\0');
+    content.push_back(10);
+    content.append(9, '\0');
+    WriteUInt16(content, LocalConfig::ImageWidth);
+    WriteUInt16(content, LocalConfig::ImageHeight);
+    content.push_back(24);
+    content.push_back(0);
+    for (uint32_t y = 0; y < LocalConfig::ImageHeight; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::ImageWidth; x += 16)
+      {
+        content.push_back(static_cast<char>(0x80 | 15));
+        for (uint32_t channel = 0; channel < 3; ++channel)
+        {
+          content.push_back(static_cast<char>(GetChannel(x, LocalConfig::ImageHeight - 1 - y, channel)));
+        }
+      }
+    }
+    return content;
+  }
+
+  IO::Path GetTestFile(const ImageFormat imageFormat)
+  {
+    const bool isBmp = imageFormat == ImageFormat::Bmp;
+    const auto path = std::filesystem::temp_directory_path() / (isBmp ? "FslResearch.ImageDecode.bmp" : "FslResearch.ImageDecode.tga");
+    if (!std::filesystem::exists(path))
+    {
+      const std::string content = isBmp ? CreateBmp() : CreateTgaRLE();
+      std::ofstream file(path, std::ios::out | std::ios::binary);
+      file.write(content.data(), static_cast<std::streamsize>(content.size()));
+    }
+    return IO::Path(path.generic_string());
+  }
+
+  struct ScopedPeakTracker
+  {
+    std::size_t Baseline;
+
+    ScopedPeakTracker()
+      : Baseline(g_currentBytes.load())
+    {
+      g_peakBytes.store(Baseline);
+    }
+
+    std::size_t GetPeakBytes() const
+    {
+      return g_peakBytes.load() - Baseline;
+    }
+  };
+
+  void SetCounters(benchmark::State& state, const std::size_t peakBytes)
+  {
+    state.counters["PeakBytes"] = benchmark::Counter(static_cast<double>(peakBytes), benchmark::Counter::kDefaults, benchmark::Counter::kIs1024);
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::ImageWidth * LocalConfig::ImageHeight * 4);
+  }
+
+  //! The old flow: a full decode into the RGB(A) upper left layout produced by stb, a copy into the bitmap and then
+  //! the bitmap converter flips the bitmap and expands it to the desired pixel format.
+  void LegacyRead(Bitmap& rBitmap, const IO::Path& path, const ImageFormat imageFormat)
+  {
+    {
+      Bitmap decoded;
+      StreamingImageReader::TryRead(decoded, path, imageFormat, PixelFormat::R8G8B8_UINT, BitmapOrigin::UpperLeft, PixelChannelOrder::Undefined,
+                                    LocalConfig::ImageHeight);
+      rBitmap = decoded;
+    }
+    BitmapUtil::FlipHorizontal(rBitmap);
+    BitmapUtil::Convert(rBitmap, LocalConfig::DesiredPixelFormat);
+  }
+
+  void ImageDecode_Legacy(benchmark::State& state, const ImageFormat imageFormat)
+  {
+    const IO::Path path = GetTestFile(imageFormat);
+    std::size_t peakBytes = 0;
+    for (auto _ : state)
+    {
+      ScopedPeakTracker tracker;
+      Bitmap bitmap;
+      LegacyRead(bitmap, path, imageFormat);
+      benchmark::DoNotOptimize(bitmap);
+      peakBytes = std::max(peakBytes, tracker.GetPeakBytes());
+    }
+    SetCounters(state, peakBytes);
+  }
+
+  void ImageDecode_Streaming(benchmark::State& state, const ImageFormat imageFormat)
+  {
+    const IO::Path path = GetTestFile(imageFormat);
+    std::size_t peakBytes = 0;
+    for (auto _ : state)
+    {
+      ScopedPeakTracker tracker;
+      Bitmap bitmap;
+      if (!StreamingImageReader::TryRead(bitmap, path, imageFormat, LocalConfig::DesiredPixelFormat, LocalConfig::DesiredOrigin,
+                                         PixelChannelOrder::Undefined))
+      {
+        state.SkipWithError("decode failed");
+        break;
+      }
+      benchmark::DoNotOptimize(bitmap);
+      peakBytes = std::max(peakBytes, tracker.GetPeakBytes());
+    }
+    SetCounters(state, peakBytes);
+  }
+
+  //! Formats like PNG must be fully decoded by stb, this measures what happens to the decoded buffer afterwards
+  std::vector<uint8_t> CreateDecodedRGB()
+  {
+    std::vector<uint8_t> content(static_cast<std::size_t>(LocalConfig::ImageWidth) * LocalConfig::ImageHeight * 3);
+    std::size_t index = 0;
+    for (uint32_t y = 0; y < LocalConfig::ImageHeight; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::ImageWidth; ++x)
+      {
+        for (uint32_t channel = 0; channel < 3; ++channel)
+        {
+          content[index++] = GetChannel(x, y, channel);
+        }
+      }
+    }
+    return content;
+  }
+
+  void DecodedConvert_Legacy(benchmark::State& state)
+  {
+    const std::vector<uint8_t> decoded = CreateDecodedRGB();
+    const PxSize2D sizePx = PxSize2D::Create(LocalConfig::ImageWidth, LocalConfig::ImageHeight);
+    std::size_t peakBytes = 0;
+    for (auto _ : state)
+    {
+      ScopedPeakTracker tracker;
+      Bitmap bitmap;
+      bitmap.Reset(SpanUtil::AsReadOnlySpan(decoded), sizePx, PixelFormat::R8G8B8_UINT);
+      BitmapUtil::FlipHorizontal(bitmap);
+      BitmapUtil::Convert(bitmap, LocalConfig::DesiredPixelFormat);
+      benchmark::DoNotOptimize(bitmap);
+      peakBytes = std::max(peakBytes, tracker.GetPeakBytes());
+    }
+    SetCounters(state, peakBytes);
+  }
+
+  void DecodedConvert_SinglePass(benchmark::State& state)
+  {
+    const std::vector<uint8_t> decoded = CreateDecodedRGB();
+    const PxSize2D sizePx = PxSize2D::Create(LocalConfig::ImageWidth, LocalConfig::ImageHeight);
+    const auto srcBitmap = ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(decoded), sizePx, PixelFormat::R8G8B8_UINT, BitmapOrigin::UpperLeft);
+    std::size_t peakBytes = 0;
+    for (auto _ : state)
+    {
+      ScopedPeakTracker tracker;
+      Bitmap bitmap;
+      bitmap.Reset(sizePx, LocalConfig::DesiredPixelFormat, LocalConfig::DesiredOrigin, BitmapClearMethod::DontModify);
+      {
+        Bitmap::ScopedDirectReadWriteAccess scopedAccess(bitmap);
+        RawBitmapBandConverter::TryWriteBand(scopedAccess.AsRawBitmap(), srcBitmap, 0);
+      }
+      benchmark::DoNotOptimize(bitmap);
+      peakBytes = std::max(peakBytes, tracker.GetPeakBytes());
+    }
+    SetCounters(state, peakBytes);
+  }
+}
+
+BENCHMARK_CAPTURE(ImageDecode_Legacy, Bmp24, ImageFormat::Bmp)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ImageDecode_Streaming, Bmp24, ImageFormat::Bmp)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ImageDecode_Legacy, Tga24RLE, ImageFormat::Tga)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(ImageDecode_Streaming, Tga24RLE, ImageFormat::Tga)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodedConvert_Legacy)->Unit(benchmark::kMillisecond);
+BENCHMARK(DecodedConvert_SinglePass)->Unit(benchmark::kMillisecond);
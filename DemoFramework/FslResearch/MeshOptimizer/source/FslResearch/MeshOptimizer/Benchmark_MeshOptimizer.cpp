@@ -0,0 +1,335 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/MathHelper.hpp>
+#include <FslBase/Math/Matrix.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslGraphics/Vertices/VertexPositionTexture.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletBuilder.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshletCuller.hpp>
+#include <FslGraphics3D/MeshOptimizer/MeshSimplifier.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexCacheOptimizer.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexFetchOptimizer.hpp>
+#include <FslGraphics3D/MeshOptimizer/VertexWelder.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    // 708 * 708 * 2 = 1002528 triangles
+    constexpr uint32_t QuadsX = 708;
+    constexpr uint32_t QuadsY = 708;
+    constexpr uint32_t VertexCount = (QuadsX + 1) * (QuadsY + 1);
+    constexpr uint32_t Seed = 1337;
+  }
+
+  //! A grid mesh where both the triangle order and the vertex order has been randomized to simulate a badly exported mesh
+  struct GridMesh
+  {
+    std::vector<VertexPositionTexture> Vertices;
+    std::vector<uint32_t> Indices;
+  };
+
+  GridMesh CreateShuffledGrid()
+  {
+    constexpr uint32_t VerticesX = LocalConfig::QuadsX + 1;
+    std::mt19937 random(LocalConfig::Seed);
+
+    std::vector<uint32_t> vertexShuffle(LocalConfig::VertexCount);
+    for (uint32_t i = 0; i < LocalConfig::VertexCount; ++i)
+    {
+      vertexShuffle[i] = i;
+    }
+    std::shuffle(vertexShuffle.begin(), vertexShuffle.end(), random);
+
+    GridMesh mesh;
+    mesh.Vertices.resize(LocalConfig::VertexCount);
+    for (uint32_t y = 0; y <= LocalConfig::QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < VerticesX; ++x)
+      {
+        const auto fx = static_cast<float>(x);
+        const auto fy = static_cast<float>(y);
+        mesh.Vertices[vertexShuffle[(y * VerticesX) + x]] =
+          VertexPositionTexture(Vector3(fx, fy, 0.0f), Vector2(fx / LocalConfig::QuadsX, fy / LocalConfig::QuadsY));
+      }
+    }
+
+    std::vector<std::array<uint32_t, 3>> triangles;
+    triangles.reserve(std::size_t(LocalConfig::QuadsX) * LocalConfig::QuadsY * 2);
+    for (uint32_t y = 0; y < LocalConfig::QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::QuadsX; ++x)
+      {
+        const uint32_t i0 = vertexShuffle[(y * VerticesX) + x];
+        const uint32_t i1 = vertexShuffle[(y * VerticesX) + x + 1];
+        const uint32_t i2 = vertexShuffle[((y + 1) * VerticesX) + x];
+        const uint32_t i3 = vertexShuffle[((y + 1) * VerticesX) + x + 1];
+        triangles.push_back({i0, i2, i1});
+        triangles.push_back({i1, i2, i3});
+      }
+    }
+    std::shuffle(triangles.begin(), triangles.end(), random);
+
+    mesh.Indices.reserve(triangles.size() * 3);
+    for (const auto& triangle : triangles)
+    {
+      mesh.Indices.insert(mesh.Indices.end(), triangle.begin(), triangle.end());
+    }
+    return mesh;
+  }
+
+  const GridMesh& GetGrid()
+  {
+    static const GridMesh g_grid = CreateShuffledGrid();
+    return g_grid;
+  }
+
+  //! A height field using the grid layout (in order) with a smooth curved surface so the simplifier has to make real decisions
+  GridMesh CreateHeightField()
+  {
+    constexpr uint32_t VerticesX = LocalConfig::QuadsX + 1;
+    GridMesh mesh;
+    mesh.Vertices.reserve(LocalConfig::VertexCount);
+    for (uint32_t y = 0; y <= LocalConfig::QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < VerticesX; ++x)
+      {
+        const auto fx = static_cast<float>(x);
+        const auto fy = static_cast<float>(y);
+        const float height = std::sin(fx * 0.05f) * std::cos(fy * 0.05f) * 8.0f;
+        mesh.Vertices.emplace_back(Vector3(fx, fy, height), Vector2(fx / LocalConfig::QuadsX, fy / LocalConfig::QuadsY));
+      }
+    }
+    mesh.Indices.reserve(std::size_t(LocalConfig::QuadsX) * LocalConfig::QuadsY * 6);
+    for (uint32_t y = 0; y < LocalConfig::QuadsY; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::QuadsX; ++x)
+      {
+        const uint32_t i0 = (y * VerticesX) + x;
+        const uint32_t i1 = i0 + 1;
+        const uint32_t i2 = i0 + VerticesX;
+        const uint32_t i3 = i2 + 1;
+        mesh.Indices.insert(mesh.Indices.end(), {i0, i2, i1, i1, i2, i3});
+      }
+    }
+    return mesh;
+  }
+
+  const GridMesh& GetHeightField()
+  {
+    static const GridMesh g_heightField = CreateHeightField();
+    return g_heightField;
+  }
+
+  //! The grid after the vertex cache optimizer has been run (which is the recommended input for the meshlet builder)
+  const std::vector<uint32_t>& GetOptimizedGridIndices()
+  {
+    static const std::vector<uint32_t> g_indices = []()
+    {
+      const GridMesh& grid = GetGrid();
+      std::vector<uint32_t> indices(grid.Indices.size());
+      Graphics3D::VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(grid.Indices),
+                                                        LocalConfig::VertexCount);
+      return indices;
+    }();
+    return g_indices;
+  }
+
+  Graphics3D::MeshletData BuildMeshlets(const ReadOnlySpan<uint32_t> indices)
+  {
+    const GridMesh& grid = GetGrid();
+    return Graphics3D::MeshletBuilder::Build(indices, grid.Vertices.data(), LocalConfig::VertexCount, sizeof(VertexPositionTexture), 0);
+  }
+
+  void SetCacheCounters(benchmark::State& state, const ReadOnlySpan<uint32_t> indices)
+  {
+    const auto stats = Graphics3D::VertexCacheOptimizer::Analyze(indices, LocalConfig::VertexCount);
+    state.counters["ACMR"] = stats.ACMR;
+    state.counters["ATVR"] = stats.ATVR;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  void VertexCacheOptimizer_Analyze(benchmark::State& state)
+  {
+    const GridMesh& grid = GetGrid();
+    const auto indices = SpanUtil::AsReadOnlySpan(grid.Indices);
+    for (auto _ : state)
+    {
+      benchmark::DoNotOptimize(Graphics3D::VertexCacheOptimizer::Analyze(indices, LocalConfig::VertexCount));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(indices.size() / 3));
+    SetCacheCounters(state, indices);
+  }
+
+  void VertexCacheOptimizer_OptimizeForsyth(benchmark::State& state)
+  {
+    const GridMesh& grid = GetGrid();
+    std::vector<uint32_t> result(grid.Indices.size());
+    for (auto _ : state)
+    {
+      Graphics3D::VertexCacheOptimizer::OptimizeForsyth(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(grid.Indices), LocalConfig::VertexCount);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size() / 3));
+    SetCacheCounters(state, SpanUtil::AsReadOnlySpan(result));
+  }
+
+  void VertexCacheOptimizer_OptimizeTipsify(benchmark::State& state)
+  {
+    const GridMesh& grid = GetGrid();
+    std::vector<uint32_t> result(grid.Indices.size());
+    for (auto _ : state)
+    {
+      Graphics3D::VertexCacheOptimizer::OptimizeTipsify(SpanUtil::AsSpan(result), SpanUtil::AsReadOnlySpan(grid.Indices), LocalConfig::VertexCount);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(result.size() / 3));
+    SetCacheCounters(state, SpanUtil::AsReadOnlySpan(result));
+  }
+
+  void VertexFetchOptimizer_Remap(benchmark::State& state)
+  {
+    const GridMesh& grid = GetGrid();
+    std::vector<uint32_t> remap(grid.Vertices.size());
+    std::vector<uint32_t> indices(grid.Indices.size());
+    std::vector<VertexPositionTexture> vertices(grid.Vertices.size());
+    for (auto _ : state)
+    {
+      std::copy(grid.Indices.begin(), grid.Indices.end(), indices.begin());
+      const uint32_t usedCount = Graphics3D::VertexFetchOptimizer::BuildRemap(SpanUtil::AsSpan(remap), SpanUtil::AsReadOnlySpan(indices));
+      Graphics3D::VertexFetchOptimizer::RemapVertices(SpanUtil::AsSpan(vertices, 0, usedCount), SpanUtil::AsReadOnlySpan(grid.Vertices),
+                                                      SpanUtil::AsReadOnlySpan(remap));
+      Graphics3D::VertexFetchOptimizer::RemapIndices(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(remap));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(vertices.size()));
+  }
+
+  void VertexWelder_Weld(benchmark::State& state)
+  {
+    const GridMesh& grid = GetGrid();
+    // Expand the mesh so every triangle has its own vertices
+    std::vector<VertexPositionTexture> srcVertices(grid.Indices.size());
+    for (std::size_t i = 0; i < grid.Indices.size(); ++i)
+    {
+      srcVertices[i] = grid.Vertices[grid.Indices[i]];
+    }
+
+    const float epsilon = static_cast<float>(state.range(0)) / 1000.0f;
+    std::vector<uint32_t> remap(srcVertices.size());
+    std::vector<VertexPositionTexture> dstVertices(srcVertices.size());
+    uint32_t uniqueCount = 0;
+    for (auto _ : state)
+    {
+      uniqueCount = Graphics3D::VertexWelder::Weld(SpanUtil::AsSpan(remap), dstVertices.data(), srcVertices.data(),
+                                                   static_cast<uint32_t>(srcVertices.size()), sizeof(VertexPositionTexture), 0, epsilon);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(srcVertices.size()));
+    state.counters["UniqueVertices"] = static_cast<double>(uniqueCount);
+  }
+
+  void MeshletBuilder_Build(benchmark::State& state, const bool optimizedInput)
+  {
+    const GridMesh& grid = GetGrid();
+    const auto indices = optimizedInput ? SpanUtil::AsReadOnlySpan(GetOptimizedGridIndices()) : SpanUtil::AsReadOnlySpan(grid.Indices);
+    uint32_t meshletCount = 0;
+    for (auto _ : state)
+    {
+      const Graphics3D::MeshletData meshlets = BuildMeshlets(indices);
+      meshletCount = meshlets.Count();
+      benchmark::DoNotOptimize(meshletCount);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(indices.size() / 3));
+    state.counters["Meshlets"] = static_cast<double>(meshletCount);
+    state.counters["AvgTriangles"] = meshletCount > 0 ? static_cast<double>(indices.size() / 3) / static_cast<double>(meshletCount) : 0.0;
+  }
+
+  void MeshletCuller_Cull(benchmark::State& state)
+  {
+    const Graphics3D::MeshletData meshlets = BuildMeshlets(SpanUtil::AsReadOnlySpan(GetOptimizedGridIndices()));
+
+    // Look at the center of the grid from a position where only a part of the grid is inside the frustum
+    const Vector3 cameraPosition(LocalConfig::QuadsX * 0.5f, LocalConfig::QuadsY * 0.5f, -150.0f);
+    const Matrix view = Matrix::CreateLookAt(cameraPosition, Vector3(LocalConfig::QuadsX * 0.5f, LocalConfig::QuadsY * 0.5f, 0.0f), Vector3::Up());
+    const Matrix projection = Matrix::CreatePerspectiveFieldOfView(MathHelper::ToRadians(60.0f), 16.0f / 9.0f, 0.1f, 1000.0f);
+    const BoundingFrustum frustum(view * projection);
+
+    std::vector<uint32_t> visible(meshlets.Count());
+    Graphics3D::MeshletCullStats stats;
+    for (auto _ : state)
+    {
+      stats = Graphics3D::MeshletCuller::Cull(SpanUtil::AsSpan(visible), meshlets, frustum, cameraPosition);
+      benchmark::DoNotOptimize(stats);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(meshlets.Count()));
+    state.counters["Visible"] = static_cast<double>(stats.Visible);
+    state.counters["FrustumCulled"] = static_cast<double>(stats.FrustumCulled);
+  }
+
+  //! @param state.range(0) the target triangle count in percent of the source triangles
+  void MeshSimplifier_Simplify(benchmark::State& state)
+  {
+    const GridMesh& mesh = GetHeightField();
+    const auto targetIndexCount = static_cast<uint32_t>(((mesh.Indices.size() / 3) * static_cast<std::size_t>(state.range(0)) / 100) * 3);
+    std::vector<uint32_t> indices(mesh.Indices.size());
+    Graphics3D::MeshSimplifyResult result;
+    for (auto _ : state)
+    {
+      result = Graphics3D::MeshSimplifier::Simplify(SpanUtil::AsSpan(indices), SpanUtil::AsReadOnlySpan(mesh.Indices), mesh.Vertices.data(),
+                                                    LocalConfig::VertexCount, sizeof(VertexPositionTexture), 0, targetIndexCount, 1.0f);
+      benchmark::DoNotOptimize(result);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * static_cast<int64_t>(mesh.Indices.size() / 3));
+    state.counters["Triangles"] = static_cast<double>(result.IndexCount / 3);
+    state.counters["Error"] = static_cast<double>(result.Error);
+  }
+}
+
+BENCHMARK(VertexCacheOptimizer_Analyze)->Unit(benchmark::kMillisecond);
+BENCHMARK(VertexCacheOptimizer_OptimizeForsyth)->Unit(benchmark::kMillisecond);
+BENCHMARK(VertexCacheOptimizer_OptimizeTipsify)->Unit(benchmark::kMillisecond);
+BENCHMARK(VertexFetchOptimizer_Remap)->Unit(benchmark::kMillisecond);
+BENCHMARK(VertexWelder_Weld)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MeshletBuilder_Build, Shuffled, false)->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(MeshletBuilder_Build, CacheOptimized, true)->Unit(benchmark::kMillisecond);
+BENCHMARK(MeshletCuller_Cull);
+BENCHMARK(MeshSimplifier_Simplify)->Arg(50)->Arg(10)->Arg(1)->Unit(benchmark::kMillisecond);
@@ -0,0 +1,160 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslNativeWindow/Base/NativeWindowEventHelper.hpp>
+#include <FslNativeWindow/Base/NativeWindowEventQueue.hpp>
+#include <benchmark/benchmark.h>
+#include <thread>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    //! Roughly what a 1000Hz mouse produces during a slow frame
+    constexpr uint32_t EventsPerFrame = 64;
+    constexpr uint32_t ButtonEventInterval = 16;
+    constexpr uint32_t ThreadedEventCount = 100000;
+  }
+
+  NativeWindowEvent CreateEvent(const uint32_t index)
+  {
+    const MillisecondTickCount32 timestamp(index);
+    const PxPoint2 position = PxPoint2::Create(static_cast<int32_t>(index % 1920u), static_cast<int32_t>(index % 1080u));
+    if ((index % LocalConfig::ButtonEventInterval) == (LocalConfig::ButtonEventInterval - 1u))
+    {
+      return NativeWindowEventHelper::EncodeInputMouseButtonEvent(timestamp, VirtualMouseButton::Left, (index & 1u) != 0u, position);
+    }
+    return NativeWindowEventHelper::EncodeInputMouseMoveEvent(timestamp, position);
+  }
+
+  std::vector<NativeWindowEvent> CreateFrameEvents()
+  {
+    std::vector<NativeWindowEvent> events;
+    for (uint32_t i = 0; i < LocalConfig::EventsPerFrame; ++i)
+    {
+      events.push_back(CreateEvent(i));
+    }
+    return events;
+  }
+
+
+  //! The original path: post the events and drain them one at a time
+  //! @param range(0) the backend
+  void BM_PostAndTryDequeue(benchmark::State& state)
+  {
+    NativeWindowEventQueue queue(static_cast<NativeWindowEventQueueBackend>(state.range(0)));
+    const std::vector<NativeWindowEvent> frameEvents = CreateFrameEvents();
+    for (auto _ : state)
+    {
+      for (const NativeWindowEvent& event : frameEvents)
+      {
+        queue.PostEvent(event);
+      }
+      NativeWindowEvent event;
+      while (queue.TryDequeue(event))
+      {
+        benchmark::DoNotOptimize(event);
+      }
+    }
+    state.counters["Events"] = benchmark::Counter(LocalConfig::EventsPerFrame, benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+  //! Post the events and drain them in bulk (with motion coalescing)
+  //! @param range(0) the backend
+  void BM_PostAndTryDequeueAll(benchmark::State& state)
+  {
+    NativeWindowEventQueue queue(static_cast<NativeWindowEventQueueBackend>(state.range(0)));
+    const std::vector<NativeWindowEvent> frameEvents = CreateFrameEvents();
+    std::vector<NativeWindowEvent> events;
+    for (auto _ : state)
+    {
+      for (const NativeWindowEvent& event : frameEvents)
+      {
+        queue.PostEvent(event);
+      }
+      events.clear();
+      queue.TryDequeueAllCoalesced(events);
+      benchmark::DoNotOptimize(events.data());
+    }
+    state.counters["Events"] = benchmark::Counter(LocalConfig::EventsPerFrame, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["Delivered"] = static_cast<double>(events.size());
+  }
+
+  //! A producer thread posts while the calling thread drains in bulk
+  //! @param range(0) the backend
+  void BM_ThreadedProducer(benchmark::State& state)
+  {
+    const auto backend = static_cast<NativeWindowEventQueueBackend>(state.range(0));
+    for (auto _ : state)
+    {
+      NativeWindowEventQueue queue(backend);
+      std::thread producer(
+        [&queue]()
+        {
+          for (uint32_t i = 0; i < LocalConfig::ThreadedEventCount; ++i)
+          {
+            queue.PostEvent(CreateEvent(i));
+          }
+          queue.PostEvent(NativeWindowEventHelper::EncodeLowMemoryEvent());
+        });
+
+      std::vector<NativeWindowEvent> events;
+      bool done = false;
+      while (!done)
+      {
+        events.clear();
+        if (queue.TryDequeueAll(events) == 0u)
+        {
+          std::this_thread::yield();
+        }
+        done = !events.empty() && events.back().Type == NativeWindowEventType::LowMemory;
+      }
+      producer.join();
+    }
+    state.counters["Events"] = benchmark::Counter(LocalConfig::ThreadedEventCount, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_PostAndTryDequeue)
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::ConcurrentQueue))
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::SingleProducerRing));
+BENCHMARK(BM_PostAndTryDequeueAll)
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::ConcurrentQueue))
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::SingleProducerRing));
+BENCHMARK(BM_ThreadedProducer)
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::ConcurrentQueue))
+  ->Arg(static_cast<int64_t>(NativeWindowEventQueueBackend::SingleProducerRing))
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
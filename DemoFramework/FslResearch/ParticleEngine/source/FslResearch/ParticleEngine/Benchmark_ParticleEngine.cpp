@@ -0,0 +1,290 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Vector3.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics3D/Particles/ParticleEngine.hpp>
+#include <benchmark/benchmark.h>
+#include <cassert>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::Graphics3D;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t RandomSeed = 0x1337;
+    constexpr float DeltaTime = 1.0f / 60.0f;
+    constexpr float MinEnergy = 0.5f;
+    constexpr float MaxEnergy = 4.0f;
+  }
+
+  const Vector3 g_gravity(0.0f, -9.8f, 0.0f);
+
+  //! A copy of the array of structs layout and update loop used by the GLES3.ParticleSystem demo (ParticleSystemOneArray)
+  class AosParticleSystem
+  {
+    struct Particle
+    {
+      Vector3 Position;
+      Vector3 Velocity;
+      float Energy{0.0f};
+      float Size{0.0f};
+      float StartEnergy{0.0f};
+      float StartSize{0.0f};
+      float EndSize{0.0f};
+      uint8_t TextureId{0};
+    };
+
+    struct ParticleRecord
+    {
+      Particle Data;
+      uint32_t Index{0};
+    };
+
+    std::vector<ParticleRecord> m_particles;
+    uint32_t m_count{0};
+
+  public:
+    explicit AosParticleSystem(const uint32_t capacity)
+      : m_particles(capacity)
+    {
+    }
+
+    uint32_t GetCount() const
+    {
+      return m_count;
+    }
+
+    void Add(const ParticleDesc& desc)
+    {
+      if (m_count < m_particles.size())
+      {
+        Particle& rParticle = m_particles[m_count].Data;
+        rParticle.Position = desc.Position;
+        rParticle.Velocity = desc.Velocity;
+        rParticle.Energy = desc.Energy;
+        rParticle.Size = desc.StartSize;
+        rParticle.StartEnergy = desc.Energy;
+        rParticle.StartSize = desc.StartSize;
+        rParticle.EndSize = desc.EndSize;
+        rParticle.TextureId = desc.TextureId;
+        ++m_count;
+      }
+    }
+
+    void Update(const float deltaTime, const Vector3& gravity)
+    {
+      const Vector3 accumulatedGravityVelocity = gravity * deltaTime;
+      uint32_t dstIndex = 0;
+      ParticleRecord* pParticles = m_particles.data();
+      for (uint32_t i = 0; i < m_count; ++i)
+      {
+        Particle& rParticle = pParticles[i].Data;
+        rParticle.Energy -= deltaTime;
+        rParticle.Size = rParticle.StartSize + ((rParticle.EndSize - rParticle.StartSize) * (1.0f - (rParticle.Energy / rParticle.StartEnergy)));
+        rParticle.Velocity += accumulatedGravityVelocity;
+        rParticle.Position += rParticle.Velocity * deltaTime;
+        pParticles[dstIndex].Index = i;
+        dstIndex += rParticle.Energy <= 0 ? 1 : 0;
+      }
+
+      if (dstIndex > 0)
+      {
+        // Same as ParticleSystemOneArray::ParticleSystemGCFast
+        if (dstIndex >= m_count)
+        {
+          m_count = 0;
+          return;
+        }
+        const uint32_t count = std::min(dstIndex, m_count - dstIndex);
+        uint32_t lastEntryIndex = m_count - 1;
+        for (uint32_t i = 0; i < count; ++i)
+        {
+          while (pParticles[lastEntryIndex].Data.Energy < 0)
+          {
+            --lastEntryIndex;
+          }
+          pParticles[pParticles[i].Index].Data = pParticles[lastEntryIndex].Data;
+          --lastEntryIndex;
+        }
+        m_count -= dstIndex;
+      }
+    }
+  };
+
+  std::vector<ParticleDesc> CreateParticles(const uint32_t count)
+  {
+    std::mt19937 random(LocalConfig::RandomSeed);
+    std::uniform_real_distribution<float> position(-100.0f, 100.0f);
+    std::uniform_real_distribution<float> velocity(-5.0f, 5.0f);
+    std::uniform_real_distribution<float> energy(LocalConfig::MinEnergy, LocalConfig::MaxEnergy);
+
+    std::vector<ParticleDesc> particles(count);
+    for (ParticleDesc& rParticle : particles)
+    {
+      rParticle = ParticleDesc(Vector3(position(random), position(random), position(random)),
+                               Vector3(velocity(random), velocity(random), velocity(random)), energy(random), 1.0f, 4.0f, 0);
+    }
+    return particles;
+  }
+
+  // Every iteration the dead particles are replaced so the particle count stays stable (like a emitter would do)
+  void Respawn(AosParticleSystem& rSystem, const std::vector<ParticleDesc>& particles, std::size_t& rNextSpawn)
+  {
+    const uint32_t missing = static_cast<uint32_t>(particles.size()) - rSystem.GetCount();
+    for (uint32_t i = 0; i < missing; ++i)
+    {
+      rSystem.Add(particles[rNextSpawn]);
+      rNextSpawn = (rNextSpawn + 1u) % particles.size();
+    }
+  }
+
+  void Respawn(ParticleEngine& rEngine, const std::vector<ParticleDesc>& particles, std::size_t& rNextSpawn)
+  {
+    const uint32_t missing = static_cast<uint32_t>(particles.size()) - rEngine.GetCount();
+    for (uint32_t i = 0; i < missing; ++i)
+    {
+      rEngine.Add(particles[rNextSpawn]);
+      rNextSpawn = (rNextSpawn + 1u) % particles.size();
+    }
+  }
+
+  void BM_Update_AoS(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto particles = CreateParticles(count);
+    AosParticleSystem system(count);
+    std::size_t nextSpawn = 0;
+    Respawn(system, particles, nextSpawn);
+
+    for (auto _ : state)
+    {
+      system.Update(LocalConfig::DeltaTime, g_gravity);
+      Respawn(system, particles, nextSpawn);
+      benchmark::DoNotOptimize(system.GetCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  void BM_Update_SoA(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto particles = CreateParticles(count);
+    ParticleEngine engine(count);
+    std::size_t nextSpawn = 0;
+    Respawn(engine, particles, nextSpawn);
+
+    for (auto _ : state)
+    {
+      engine.Update(LocalConfig::DeltaTime, g_gravity);
+      Respawn(engine, particles, nextSpawn);
+      benchmark::DoNotOptimize(engine.GetCount());
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  void BM_Update_SoA_WorkerPool(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    const auto particles = CreateParticles(count);
+    WorkerThreadPool pool;
+    ParticleEngine engine(count);
+    std::size_t nextSpawn = 0;
+    Respawn(engine, particles, nextSpawn);
+
+    for (auto _ : state)
+    {
+      engine.Update(LocalConfig::DeltaTime, g_gravity, pool);
+      Respawn(engine, particles, nextSpawn);
+      benchmark::DoNotOptimize(engine.GetCount());
+    }
+    state.counters["Threads"] = static_cast<double>(pool.GetConcurrency());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  void BM_WriteQuadVertices(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    ParticleEngine engine(count);
+    engine.Add(SpanUtil::AsReadOnlySpan(CreateParticles(count)));
+    std::vector<VertexPositionColorNormalTexture> vertices(static_cast<std::size_t>(count) * ParticleEngine::QuadVerticesPerParticle);
+
+    for (auto _ : state)
+    {
+      engine.WriteQuadVertices(SpanUtil::AsSpan(vertices), Vector4::One());
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  void BM_WriteQuadVertices_WorkerPool(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    WorkerThreadPool pool;
+    ParticleEngine engine(count);
+    engine.Add(SpanUtil::AsReadOnlySpan(CreateParticles(count)));
+    std::vector<VertexPositionColorNormalTexture> vertices(static_cast<std::size_t>(count) * ParticleEngine::QuadVerticesPerParticle);
+
+    for (auto _ : state)
+    {
+      engine.WriteQuadVertices(SpanUtil::AsSpan(vertices), Vector4::One(), pool);
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+
+  void BM_WritePointVertices(benchmark::State& state)
+  {
+    const auto count = static_cast<uint32_t>(state.range(0));
+    ParticleEngine engine(count);
+    engine.Add(SpanUtil::AsReadOnlySpan(CreateParticles(count)));
+    std::vector<ParticlePointVertex> vertices(count);
+
+    for (auto _ : state)
+    {
+      engine.WritePointVertices(SpanUtil::AsSpan(vertices));
+      benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * count);
+  }
+}
+
+BENCHMARK(BM_Update_AoS)->Arg(100000)->Arg(1000000)->Arg(4000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Update_SoA)->Arg(100000)->Arg(1000000)->Arg(4000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Update_SoA_WorkerPool)->Arg(100000)->Arg(1000000)->Arg(4000000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_WriteQuadVertices)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_WriteQuadVertices_WorkerPool)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_WritePointVertices)->Arg(100000)->Arg(1000000)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,156 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sdf/SdfGenerator.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t SourceSizePx = 4096;
+    constexpr uint32_t GlyphsPerRow = 16;
+    constexpr uint32_t GlyphSizePx = SourceSizePx / GlyphsPerRow;
+    constexpr uint32_t DownscaleFactor = 8;
+    constexpr float DistanceRangePx = 8.0f;
+  }
+
+  //! A ring with a bar through it, big enough to have long distances in every direction
+  void DrawShape(std::vector<uint8_t>& rContent, const uint32_t stride, const uint32_t x0, const uint32_t y0, const uint32_t size,
+                 const uint32_t seed)
+  {
+    const float center = static_cast<float>(size) * 0.5f;
+    const float outer = static_cast<float>(size) * (0.30f + (0.01f * static_cast<float>(seed % 8u)));
+    const float inner = outer * 0.6f;
+    for (uint32_t y = 0; y < size; ++y)
+    {
+      for (uint32_t x = 0; x < size; ++x)
+      {
+        const float dx = static_cast<float>(x) - center;
+        const float dy = static_cast<float>(y) - center;
+        const float d2 = (dx * dx) + (dy * dy);
+        const bool ring = d2 < (outer * outer) && d2 > (inner * inner);
+        const bool bar = (y > (size * 9u / 20u)) && (y < (size * 11u / 20u)) && (x > size / 8u) && (x < (size * 7u / 8u));
+        rContent[((y0 + y) * stride) + x0 + x] = (ring || bar) ? 255u : 0u;
+      }
+    }
+  }
+
+  struct SourceImage
+  {
+    std::vector<uint8_t> Content;
+
+    SourceImage()
+      : Content(static_cast<std::size_t>(LocalConfig::SourceSizePx) * LocalConfig::SourceSizePx)
+    {
+    }
+
+    ReadOnlyRawBitmap AsBitmap() const
+    {
+      return ReadOnlyRawBitmap::Create(SpanUtil::AsReadOnlySpan(Content), PxExtent2D::Create(LocalConfig::SourceSizePx, LocalConfig::SourceSizePx),
+                                       PixelFormat::R8_UNORM, BitmapOrigin::UpperLeft);
+    }
+  };
+
+  //! A single 4K icon
+  SourceImage CreateIconImage()
+  {
+    SourceImage image;
+    DrawShape(image.Content, LocalConfig::SourceSizePx, 0, 0, LocalConfig::SourceSizePx, 0);
+    return image;
+  }
+
+  //! A 4K font atlas with a 16x16 grid of glyphs
+  SourceImage CreateFontImage(std::vector<BitmapFontChar>& rChars)
+  {
+    SourceImage image;
+    for (uint32_t i = 0; i < (LocalConfig::GlyphsPerRow * LocalConfig::GlyphsPerRow); ++i)
+    {
+      const uint32_t x = (i % LocalConfig::GlyphsPerRow) * LocalConfig::GlyphSizePx;
+      const uint32_t y = (i / LocalConfig::GlyphsPerRow) * LocalConfig::GlyphSizePx;
+      DrawShape(image.Content, LocalConfig::SourceSizePx, x, y, LocalConfig::GlyphSizePx, i);
+      rChars.emplace_back(i, PxRectangleU32::Create(x, y, LocalConfig::GlyphSizePx, LocalConfig::GlyphSizePx), PxPoint2(),
+                          PxValueU16(LocalConfig::GlyphSizePx));
+    }
+    return image;
+  }
+
+  std::shared_ptr<WorkerThreadPool> CreatePool(const int64_t workerThreads)
+  {
+    return workerThreads > 0 ? std::make_shared<WorkerThreadPool>(static_cast<uint32_t>(workerThreads)) : std::shared_ptr<WorkerThreadPool>();
+  }
+
+
+  //! @param range(0) the number of worker threads (0 = run on the calling thread only)
+  void BM_GenerateIcon4K(benchmark::State& state)
+  {
+    const SourceImage image = CreateIconImage();
+    const SdfGenerator generator(CreatePool(state.range(0)));
+    const SdfGeneratorConfig config(128, LocalConfig::DownscaleFactor, LocalConfig::DistanceRangePx);
+    for (auto _ : state)
+    {
+      Bitmap result = generator.Generate(image.AsBitmap(), config);
+      benchmark::DoNotOptimize(result);
+    }
+    state.counters["SrcPixels"] =
+      benchmark::Counter(static_cast<double>(LocalConfig::SourceSizePx) * LocalConfig::SourceSizePx, benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+  //! @param range(0) the number of worker threads (0 = run on the calling thread only)
+  void BM_GenerateFont4K(benchmark::State& state)
+  {
+    std::vector<BitmapFontChar> chars;
+    const SourceImage image = CreateFontImage(chars);
+    const BitmapFont font(std::string("Benchmark"), 160, static_cast<uint16_t>(LocalConfig::GlyphSizePx), PxValueU16(LocalConfig::GlyphSizePx),
+                          PxValueU16(LocalConfig::GlyphSizePx), PxThicknessU16(), std::string("Benchmark.png"), BitmapFontType::Bitmap,
+                          BitmapFontSdfParams(), std::move(chars), std::vector<BitmapFontKerning>());
+    const SdfGenerator generator(CreatePool(state.range(0)));
+    const SdfGeneratorConfig config(128, LocalConfig::DownscaleFactor, LocalConfig::DistanceRangePx);
+    for (auto _ : state)
+    {
+      SdfGeneratorFontResult result = generator.GenerateFont(font, image.AsBitmap(), config);
+      benchmark::DoNotOptimize(result);
+    }
+    state.counters["SrcPixels"] =
+      benchmark::Counter(static_cast<double>(LocalConfig::SourceSizePx) * LocalConfig::SourceSizePx, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_GenerateIcon4K)->Arg(0)->Arg(1)->Arg(3)->Arg(7)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(BM_GenerateFont4K)->Arg(0)->Arg(1)->Arg(3)->Arg(7)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,153 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslService/Consumer/ServiceProvider.hpp>
+#include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalSingletonServiceFactoryTemplate.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <utility>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    //! Simulates the content, image and profiler services that spend their construction waiting on io
+    constexpr std::chrono::milliseconds LoaderConstructionTime(20);
+    constexpr uint32_t LoaderCount = 6;
+    constexpr Priority LoaderPriority(100);
+    constexpr Priority ConsumerPriority(0);
+  }
+
+  template <uint32_t TIndex>
+  class ILoaderService
+  {
+  public:
+    virtual ~ILoaderService() = default;
+  };
+
+  template <uint32_t TIndex>
+  class LoaderService final
+    : public ThreadLocalService
+    , public ILoaderService<TIndex>
+  {
+  public:
+    explicit LoaderService(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+    {
+      std::this_thread::sleep_for(LocalConfig::LoaderConstructionTime);
+    }
+  };
+
+  class IConsumerService
+  {
+  public:
+    virtual ~IConsumerService() = default;
+  };
+
+  //! Depends on all the loaders, so it can only be created once they have all been constructed
+  class ConsumerService final
+    : public ThreadLocalService
+    , public IConsumerService
+  {
+  public:
+    explicit ConsumerService(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+    {
+      RequireLoaders(serviceProvider, std::make_integer_sequence<uint32_t, LocalConfig::LoaderCount>());
+    }
+
+  private:
+    template <uint32_t... TIndices>
+    static void RequireLoaders(const ServiceProvider& serviceProvider, std::integer_sequence<uint32_t, TIndices...> /*indices*/)
+    {
+      (serviceProvider.Get<ILoaderService<TIndices>>(), ...);
+    }
+  };
+
+  template <uint32_t... TIndices>
+  RegisteredServiceDeque CreateServices(std::integer_sequence<uint32_t, TIndices...> /*indices*/)
+  {
+    RegisteredServiceDeque services;
+    (services.emplace_back(ProviderId(TIndices + 1u),
+                           std::make_shared<ThreadLocalSingletonServiceFactoryTemplate<LoaderService<TIndices>, ILoaderService<TIndices>>>(),
+                           LocalConfig::LoaderPriority),
+     ...);
+    services.emplace_back(ProviderId(LocalConfig::LoaderCount + 1u),
+                          std::make_shared<ThreadLocalSingletonServiceFactoryTemplate<ConsumerService, IConsumerService>>(),
+                          LocalConfig::ConsumerPriority);
+    return services;
+  }
+
+
+  //! @param range(0) the launch mode
+  void BM_Launch(benchmark::State& state)
+  {
+    const auto launchMode = static_cast<ServiceLaunchMode>(state.range(0));
+    const RegisteredServiceDeque services = CreateServices(std::make_integer_sequence<uint32_t, LocalConfig::LoaderCount>());
+    ServiceLaunchStats stats;
+    for (auto _ : state)
+    {
+      auto serviceInfo = ServiceLauncher::Launch(services, launchMode, stats);
+      benchmark::DoNotOptimize(serviceInfo);
+    }
+
+    // Report the per service construction time of the last launch so regressions show up in the output
+    std::chrono::microseconds constructionTime{};
+    std::chrono::microseconds slowestService{};
+    for (const ServiceLaunchRecordStats& entry : stats.Services)
+    {
+      if (!entry.Started)
+      {
+        state.SkipWithError("A service failed to start");
+      }
+      constructionTime += entry.ConstructionTime;
+      slowestService = std::max(slowestService, entry.ConstructionTime);
+    }
+    state.counters["Services"] = static_cast<double>(stats.Services.size());
+    state.counters["ConstructionMs"] = static_cast<double>(constructionTime.count()) / 1000.0;
+    state.counters["SlowestMs"] = static_cast<double>(slowestService.count()) / 1000.0;
+    state.counters["LaunchMs"] = static_cast<double>(stats.TotalTime.count()) / 1000.0;
+  }
+}
+
+BENCHMARK(BM_Launch)
+  ->Arg(static_cast<int64_t>(ServiceLaunchMode::Serial))
+  ->Arg(static_cast<int64_t>(ServiceLaunchMode::Concurrent))
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
@@ -0,0 +1,184 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxPoint2.hpp>
+#include <FslBase/Time/MillisecondTickCount32.hpp>
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Base/BaseWindowContext.hpp>
+#include <FslSimpleUI/Base/Control/ContentControl.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/Event/WindowContentChangedEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
+#include <FslSimpleUI/Base/Event/WindowEventSender.hpp>
+#include <FslSimpleUI/Base/Event/WindowInputClickEvent.hpp>
+#include <FslSimpleUI/Base/IWindowManager.hpp>
+#include <FslSimpleUI/Base/System/UIManager.hpp>
+#include <FslSimpleUI/Render/Stub/RenderSystem.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint16_t DensityDpi = 160;
+    constexpr float LeafSizeDp = 32.0f;
+    constexpr PxPoint2 ClickPositionPx = PxPoint2::Create(4, 4);
+  }
+
+  //! A window that receives every click and content changed event that is routed through it
+  class RouteWindow final : public UI::ContentControl
+  {
+    uint32_t m_eventCount{0};
+
+  public:
+    explicit RouteWindow(const std::shared_ptr<UI::BaseWindowContext>& context)
+      : UI::ContentControl(context)
+    {
+      Enable(UI::WindowFlags::ClickInput);
+    }
+
+    uint32_t GetEventCount() const noexcept
+    {
+      return m_eventCount;
+    }
+
+  protected:
+    void OnClickInputPreview(const std::shared_ptr<UI::WindowInputClickEvent>& /*theEvent*/) final
+    {
+      ++m_eventCount;
+    }
+
+    void OnClickInput(const std::shared_ptr<UI::WindowInputClickEvent>& /*theEvent*/) final
+    {
+      ++m_eventCount;
+    }
+
+    void OnContentChanged(const std::shared_ptr<UI::WindowContentChangedEvent>& /*theEvent*/) final
+    {
+      ++m_eventCount;
+    }
+  };
+
+  //! A single chain of nested windows 'depth' deep
+  struct TreeSetup
+  {
+    std::shared_ptr<DataBinding::DataBindingService> DataBinding;
+    UI::UIManager Manager;
+    std::shared_ptr<UI::BaseWindowContext> WindowContext;
+    std::vector<std::shared_ptr<RouteWindow>> Windows;
+    MillisecondTickCount32 Timestamp;
+
+    explicit TreeSetup(const uint32_t depth)
+      : DataBinding(std::make_shared<DataBinding::DataBindingService>())
+      , Manager(DataBinding, std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear, false,
+                BasicWindowMetrics(PxExtent2D::Create(800, 600), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+      , WindowContext(std::make_shared<UI::BaseWindowContext>(Manager.GetUIContext(), LocalConfig::DensityDpi, UI::UIColorSpace::SRGBNonLinear))
+    {
+      Windows.reserve(depth);
+      Windows.push_back(std::make_shared<RouteWindow>(WindowContext));
+      Manager.GetWindowManager()->Add(Windows.back());
+      for (uint32_t i = 1; i < depth; ++i)
+      {
+        auto window = std::make_shared<RouteWindow>(WindowContext);
+        Windows.back()->SetContent(window);
+        Windows.push_back(std::move(window));
+      }
+      Windows.back()->SetWidth(UI::DpLayoutSize1D::Create(LocalConfig::LeafSizeDp));
+      Windows.back()->SetHeight(UI::DpLayoutSize1D::Create(LocalConfig::LeafSizeDp));
+
+      // Add all the windows and perform the initial layout so the hit test can locate the leaf
+      for (uint32_t i = 0; i < depth; ++i)
+      {
+        Manager.ProcessEvents();
+      }
+      Manager.Update(TimeSpan::FromMilliseconds(16));
+      DataBinding->ExecuteChanges();
+      Manager.Update(TimeSpan::FromMilliseconds(16));
+    }
+
+    void Click()
+    {
+      Timestamp += TimeSpan::FromMilliseconds(1);
+      Manager.SendMouseButtonEvent(Timestamp, LocalConfig::ClickPositionPx, true, false);
+      Manager.SendMouseButtonEvent(Timestamp, LocalConfig::ClickPositionPx, false, false);
+    }
+
+    uint32_t GetRootEventCount() const noexcept
+    {
+      return Windows.front()->GetEventCount();
+    }
+  };
+
+
+  //! A click is routed as a paired tunnel/bubble transaction through the full depth of the tree (begin + end)
+  void BM_RouteClick(benchmark::State& state)
+  {
+    TreeSetup setup(static_cast<uint32_t>(state.range(0)));
+    for (auto _ : state)
+    {
+      setup.Click();
+    }
+    if (setup.GetRootEventCount() == 0u)
+    {
+      state.SkipWithError("The click events did not reach the root window");
+    }
+    state.counters["Hops"] = benchmark::Counter(static_cast<double>(setup.GetRootEventCount()) * static_cast<double>(state.range(0)),
+                                                benchmark::Counter::kIsRate);
+  }
+
+  //! A content changed event is queued from the leaf and bubbled to the root when the event queue is processed
+  void BM_RouteQueuedBubble(benchmark::State& state)
+  {
+    TreeSetup setup(static_cast<uint32_t>(state.range(0)));
+    const auto& eventPool = setup.Manager.GetEventPool();
+    const auto& eventSender = setup.Manager.GetEventSender();
+    const UI::IWindowId* const pSource = setup.Windows.back().get();
+    for (auto _ : state)
+    {
+      eventSender->SendEvent(eventPool->AcquireWindowContentChangedEvent(0), pSource);
+      setup.Manager.ProcessEvents();
+    }
+    if (setup.GetRootEventCount() == 0u)
+    {
+      state.SkipWithError("The content changed events did not reach the root window");
+    }
+    state.counters["Hops"] = benchmark::Counter(static_cast<double>(setup.GetRootEventCount()) * static_cast<double>(state.range(0)),
+                                                benchmark::Counter::kIsRate);
+  }
+}
+
+BENCHMARK(BM_RouteClick)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_RouteQueuedBubble)->Arg(8)->Arg(32)->Arg(128)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,177 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics/Bitmap/Bitmap.hpp>
+#include <FslGraphics/Colors.hpp>
+#include <FslGraphics/Render/Software/SoftwareBatch2DQuadRenderer.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeBatch2D.hpp>
+#include <FslGraphics/Render/Software/SoftwareNativeGraphics.hpp>
+#include <FslGraphics/Render/Texture2D.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t TargetWidthPx = 1920;
+    constexpr uint32_t TargetHeightPx = 1080;
+    constexpr uint32_t SpriteCount = 4000;
+    constexpr uint32_t SpriteSizePx = 64;
+    constexpr uint32_t GlyphColumns = 160;
+    constexpr uint32_t GlyphRows = 60;
+    constexpr float GlyphWidthPx = 12.0f;
+    constexpr float GlyphHeightPx = 18.0f;
+  }
+
+  Bitmap CreateSpriteBitmap()
+  {
+    Bitmap bitmap(PxSize2D::Create(LocalConfig::SpriteSizePx, LocalConfig::SpriteSizePx), PixelFormat::R8G8B8A8_UNORM);
+    for (uint32_t y = 0; y < LocalConfig::SpriteSizePx; ++y)
+    {
+      for (uint32_t x = 0; x < LocalConfig::SpriteSizePx; ++x)
+      {
+        // premultiplied, with a soft vertical alpha ramp
+        const uint32_t alpha = (y * 255u) / (LocalConfig::SpriteSizePx - 1u);
+        const uint32_t red = (((x * 255u) / (LocalConfig::SpriteSizePx - 1u)) * alpha) / 255u;
+        bitmap.SetNativePixel(x, y, red | (alpha << 24));
+      }
+    }
+    return bitmap;
+  }
+
+  //! A distance field ramp that crosses the edge in the middle of the glyph
+  Bitmap CreateGlyphBitmap()
+  {
+    Bitmap bitmap(PxSize2D::Create(16, 16), PixelFormat::R8G8B8A8_UNORM);
+    for (uint32_t y = 0; y < 16u; ++y)
+    {
+      for (uint32_t x = 0; x < 16u; ++x)
+      {
+        const uint32_t distance = 255u - (std::max(x > 7u ? x - 8u : 7u - x, y > 7u ? y - 8u : 7u - y) * 32u);
+        bitmap.SetNativePixel(x, y, 0x00FFFFFFu | (distance << 24));
+      }
+    }
+    return bitmap;
+  }
+
+  std::shared_ptr<WorkerThreadPool> CreatePool(const int64_t workerThreads)
+  {
+    return workerThreads > 0 ? std::make_shared<WorkerThreadPool>(static_cast<uint32_t>(workerThreads)) : std::shared_ptr<WorkerThreadPool>();
+  }
+
+  struct Scene
+  {
+    std::shared_ptr<SoftwareNativeGraphics> NativeGraphics;
+    std::shared_ptr<SoftwareBatch2DQuadRenderer> QuadRenderer;
+    SoftwareNativeBatch2D Batch;
+
+    explicit Scene(const int64_t workerThreads)
+      : NativeGraphics(std::make_shared<SoftwareNativeGraphics>())
+      , QuadRenderer(std::make_shared<SoftwareBatch2DQuadRenderer>(PxExtent2D::Create(LocalConfig::TargetWidthPx, LocalConfig::TargetHeightPx),
+                                                                   CreatePool(workerThreads)))
+      , Batch(QuadRenderer, PxExtent2D::Create(LocalConfig::TargetWidthPx, LocalConfig::TargetHeightPx))
+    {
+    }
+  };
+
+
+  //! @param range(0) the number of worker threads (0 = run on the calling thread only)
+  //! @param range(1) the blend state
+  void BM_DrawSprites(benchmark::State& state)
+  {
+    Scene scene(state.range(0));
+    const auto blendState = static_cast<BlendState>(state.range(1));
+    const Texture2D texture(scene.NativeGraphics, CreateSpriteBitmap(), Texture2DFilterHint::Smooth);
+
+    std::mt19937 random(42);
+    std::uniform_real_distribution<float> randomX(-32.0f, static_cast<float>(LocalConfig::TargetWidthPx));
+    std::uniform_real_distribution<float> randomY(-32.0f, static_cast<float>(LocalConfig::TargetHeightPx));
+    std::vector<PxAreaRectangleF> sprites(LocalConfig::SpriteCount);
+    for (PxAreaRectangleF& rSprite : sprites)
+    {
+      rSprite = PxAreaRectangleF::Create(randomX(random), randomY(random), 48.0f, 48.0f);
+    }
+
+    for (auto _ : state)
+    {
+      scene.QuadRenderer->Clear(Colors::Black());
+      scene.Batch.Begin(blendState);
+      for (const PxAreaRectangleF& sprite : sprites)
+      {
+        scene.Batch.Draw(texture, sprite, Colors::White());
+      }
+      scene.Batch.End();
+      benchmark::DoNotOptimize(scene.QuadRenderer->GetTarget().Content());
+    }
+    state.counters["Sprites"] = benchmark::Counter(LocalConfig::SpriteCount, benchmark::Counter::kIsIterationInvariantRate);
+  }
+
+  //! A full screen of sdf text sized glyph quads
+  //! @param range(0) the number of worker threads (0 = run on the calling thread only)
+  void BM_DrawSdfText(benchmark::State& state)
+  {
+    Scene scene(state.range(0));
+    const Texture2D texture(scene.NativeGraphics, CreateGlyphBitmap(), Texture2DFilterHint::Smooth);
+
+    for (auto _ : state)
+    {
+      scene.QuadRenderer->Clear(Colors::DarkBlue());
+      scene.Batch.Begin(BlendState::Sdf);
+      for (uint32_t y = 0; y < LocalConfig::GlyphRows; ++y)
+      {
+        for (uint32_t x = 0; x < LocalConfig::GlyphColumns; ++x)
+        {
+          const float xPxf = static_cast<float>(x) * LocalConfig::GlyphWidthPx;
+          const float yPxf = static_cast<float>(y) * LocalConfig::GlyphHeightPx;
+          scene.Batch.Draw(texture, PxAreaRectangleF::Create(xPxf, yPxf, LocalConfig::GlyphWidthPx, LocalConfig::GlyphHeightPx), Colors::White());
+        }
+      }
+      scene.Batch.End();
+      benchmark::DoNotOptimize(scene.QuadRenderer->GetTarget().Content());
+    }
+    state.counters["Glyphs"] =
+      benchmark::Counter(static_cast<double>(LocalConfig::GlyphColumns) * LocalConfig::GlyphRows, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_DrawSprites)
+  ->ArgsProduct({{0, 1, 3, 7}, {static_cast<int64_t>(BlendState::Opaque), static_cast<int64_t>(BlendState::AlphaBlend)}})
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+BENCHMARK(BM_DrawSdfText)->Arg(0)->Arg(1)->Arg(3)->Arg(7)->Unit(benchmark::kMillisecond)->UseRealTime();
@@ -0,0 +1,378 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/BitsUtil.hpp>
+#include <FslBase/Collections/SpatialHashGrid2D.hpp>
+#include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
+#include <FslBase/Math/Pixel/PxSize2D.hpp>
+#include <FslBase/Math/Rect.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <FslResearch/SpatialGrid2D/SpatialHashGrid2DFixedBucketSize.hpp>
+#include <FslResearch/SpatialGrid2D/SpatialHashGrid2DMap.hpp>
+#include <FslResearch/SpatialGrid2D/SpatialHashGrid2DUnorderedMap.hpp>
+#include <FslResearch/SpatialGrid2D/SpatialHashGrid2DVector.hpp>
+#include <benchmark/benchmark.h>
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// Compares the research grid variants with the FslBase SpatialHashGrid2D on uniformly distributed and clustered objects.
+// The research variants have no query or remove support, so the query is implemented here on top of their cell lookup.
+
+#define LOCAL_BENCH_BUILD
+#define LOCAL_BENCH_QUERY
+#define LOCAL_BENCH_MOVE
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t Seed = 1337;
+    constexpr uint32_t QueryCount = 256;
+    constexpr uint32_t ClusterCount = 8;
+    constexpr float ClusterDeviation = 60.0f;
+    constexpr int32_t CellSize = 64;
+
+    constexpr PxSize2D SizePx = PxSize2D::Create(1920, 1080);
+  }
+
+  enum class Distribution
+  {
+    Uniform,
+    Clustered
+  };
+
+  // The fixed bucket variant drops entries once a bucket is full, so it gets buckets large enough for the clustered data
+  using FixedBucketSizeGrid = SpatialHashGrid2DFixedBucketSize<2048>;
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  std::vector<PxAreaRectangleF> CreateObjects(const Distribution distribution, const uint32_t count, const uint32_t seed)
+  {
+    std::mt19937 random(seed);
+    std::uniform_real_distribution<float> randomSize(4.0f, 48.0f);
+
+    const auto maxX = static_cast<float>(LocalConfig::SizePx.RawWidth()) - 48.0f;
+    const auto maxY = static_cast<float>(LocalConfig::SizePx.RawHeight()) - 48.0f;
+    std::uniform_real_distribution<float> randomX(0.0f, maxX);
+    std::uniform_real_distribution<float> randomY(0.0f, maxY);
+
+    std::vector<PxAreaRectangleF> clusters(LocalConfig::ClusterCount);
+    for (auto& rCluster : clusters)
+    {
+      rCluster = PxAreaRectangleF::Create(randomX(random), randomY(random), 0.0f, 0.0f);
+    }
+    std::normal_distribution<float> randomOffset(0.0f, LocalConfig::ClusterDeviation);
+    std::uniform_int_distribution<uint32_t> randomCluster(0, LocalConfig::ClusterCount - 1);
+
+    std::vector<PxAreaRectangleF> result(count);
+    for (auto& rEntry : result)
+    {
+      float x = 0.0f;
+      float y = 0.0f;
+      if (distribution == Distribution::Uniform)
+      {
+        x = randomX(random);
+        y = randomY(random);
+      }
+      else
+      {
+        const PxAreaRectangleF& cluster = clusters[randomCluster(random)];
+        x = std::clamp(cluster.RawLeft() + randomOffset(random), 0.0f, maxX);
+        y = std::clamp(cluster.RawTop() + randomOffset(random), 0.0f, maxY);
+      }
+      rEntry = PxAreaRectangleF::Create(x, y, randomSize(random), randomSize(random));
+    }
+    return result;
+  }
+
+  std::vector<Rect> ToRects(const std::vector<PxAreaRectangleF>& objects)
+  {
+    std::vector<Rect> result(objects.size());
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+      result[i] = Rect::FromLeftTopRightBottom(objects[i].RawLeft(), objects[i].RawTop(), objects[i].RawRight(), objects[i].RawBottom());
+    }
+    return result;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <typename TGrid>
+  TGrid CreateGrid()
+  {
+    const uint32_t stepSize = BitsUtil::NextPowerOfTwo(LocalConfig::CellSize);
+    const uint32_t shift = BitsUtil::IndexOf(stepSize);
+    const uint32_t stepsX = (LocalConfig::SizePx.RawWidth() + stepSize - 1) / stepSize;
+    const uint32_t stepsY = (LocalConfig::SizePx.RawHeight() + stepSize - 1) / stepSize;
+    return TGrid(UncheckedNumericCast<uint16_t>(stepsX), UncheckedNumericCast<uint16_t>(stepsY), UncheckedNumericCast<uint8_t>(shift),
+                 UncheckedNumericCast<uint8_t>(shift));
+  }
+
+  SpatialHashGrid2D CreateFslBaseGrid()
+  {
+    return {Rect(0, 0, static_cast<float>(LocalConfig::SizePx.RawWidth()), static_cast<float>(LocalConfig::SizePx.RawHeight())),
+            static_cast<float>(LocalConfig::CellSize)};
+  }
+
+  template <typename TGrid>
+  uint32_t Build(TGrid& rGrid, const std::vector<PxAreaRectangleF>& objects)
+  {
+    uint32_t droppedCount = 0;
+    for (std::size_t i = 0; i < objects.size(); ++i)
+    {
+      droppedCount += rGrid.TryAdd(objects[i], static_cast<uint32_t>(i)) ? 0u : 1u;
+    }
+    return droppedCount;
+  }
+
+  //! Query a research grid, the visited entries are tracked with a stamp per object so each object is only tested once
+  template <typename TGrid>
+  uint32_t Query(const TGrid& grid, const std::vector<PxAreaRectangleF>& objects, std::vector<uint32_t>& rVisitStamps, const uint32_t stamp,
+                 const PxAreaRectangleF& area)
+  {
+    const auto rangeX = grid.ToXCell(area.RawLeft(), area.RawRight());
+    const auto rangeY = grid.ToYCell(area.RawTop(), area.RawBottom());
+    const auto endX = std::min(static_cast<int32_t>(rangeX.End), grid.GetCellCountX());
+    const auto endY = std::min(static_cast<int32_t>(rangeY.End), grid.GetCellCountY());
+    uint32_t hits = 0;
+    for (int32_t y = rangeY.Start; y < endY; ++y)
+    {
+      for (int32_t x = rangeX.Start; x < endX; ++x)
+      {
+        for (const uint32_t id : grid.TryGetChunkEntries(static_cast<uint16_t>(x), static_cast<uint16_t>(y)))
+        {
+          if (rVisitStamps[id] != stamp)
+          {
+            rVisitStamps[id] = stamp;
+            const PxAreaRectangleF& rect = objects[id];
+            hits += (rect.RawLeft() <= area.RawRight() && area.RawLeft() <= rect.RawRight() && rect.RawTop() <= area.RawBottom() &&
+                     area.RawTop() <= rect.RawBottom())
+                      ? 1u
+                      : 0u;
+          }
+        }
+      }
+    }
+    return hits;
+  }
+
+  // -------------------------------------------------------------------------------------------------------------------------------------------------
+
+  template <Distribution TDistribution, typename TGrid>
+  void BmBuild(benchmark::State& state)
+  {
+    const auto objects = CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed);
+    auto grid = CreateGrid<TGrid>();
+    uint32_t droppedCount = 0;
+    for (auto _ : state)
+    {
+      grid.Clear();
+      droppedCount = Build(grid, objects);
+    }
+    state.counters["Dropped"] = static_cast<double>(droppedCount);
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  template <Distribution TDistribution>
+  void BmBuildFslBaseAdd(benchmark::State& state)
+  {
+    const auto objects = ToRects(CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed));
+    auto grid = CreateFslBaseGrid();
+    for (auto _ : state)
+    {
+      grid.Clear();
+      for (const Rect& object : objects)
+      {
+        benchmark::DoNotOptimize(grid.Add(object));
+      }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  template <Distribution TDistribution>
+  void BmBuildFslBaseAddRange(benchmark::State& state)
+  {
+    const auto objects = ToRects(CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed));
+    std::vector<uint32_t> handles(objects.size());
+    auto grid = CreateFslBaseGrid();
+    for (auto _ : state)
+    {
+      grid.Clear();
+      grid.AddRange(SpanUtil::AsReadOnlySpan(objects), SpanUtil::AsSpan(handles));
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  template <Distribution TDistribution, typename TGrid>
+  void BmQuery(benchmark::State& state)
+  {
+    const auto objects = CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed);
+    // The queries follow the same distribution as the objects
+    const auto queries = CreateObjects(TDistribution, LocalConfig::QueryCount, LocalConfig::Seed + 1);
+    auto grid = CreateGrid<TGrid>();
+    Build(grid, objects);
+
+    std::vector<uint32_t> visitStamps(objects.size(), 0u);
+    uint32_t stamp = 0;
+    for (auto _ : state)
+    {
+      uint32_t hits = 0;
+      for (const auto& query : queries)
+      {
+        ++stamp;
+        hits += Query(grid, objects, visitStamps, stamp, query);
+      }
+      benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::QueryCount);
+  }
+
+  template <Distribution TDistribution>
+  void BmQueryFslBase(benchmark::State& state)
+  {
+    const auto objects = ToRects(CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed));
+    const auto queries = ToRects(CreateObjects(TDistribution, LocalConfig::QueryCount, LocalConfig::Seed + 1));
+    std::vector<uint32_t> handles(objects.size());
+    auto grid = CreateFslBaseGrid();
+    grid.AddRange(SpanUtil::AsReadOnlySpan(objects), SpanUtil::AsSpan(handles));
+
+    for (auto _ : state)
+    {
+      uint32_t hits = 0;
+      for (const Rect& query : queries)
+      {
+        grid.QueryAABB(query, [&hits](const uint32_t /*handle*/) { ++hits; });
+      }
+      benchmark::DoNotOptimize(hits);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::QueryCount);
+  }
+
+  //! The research variants can not remove entries, so moving every object means a full rebuild
+  template <Distribution TDistribution, typename TGrid>
+  void BmMoveAll(benchmark::State& state)
+  {
+    const auto objects0 = CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed);
+    auto objects1 = objects0;
+    for (auto& rEntry : objects1)
+    {
+      rEntry = PxAreaRectangleF::Create(rEntry.RawLeft() + 8.0f, rEntry.RawTop() + 4.0f, rEntry.RawWidth(), rEntry.RawHeight());
+    }
+    auto grid = CreateGrid<TGrid>();
+    bool toggle = false;
+    for (auto _ : state)
+    {
+      grid.Clear();
+      Build(grid, toggle ? objects0 : objects1);
+      toggle = !toggle;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+
+  template <Distribution TDistribution>
+  void BmMoveAllFslBase(benchmark::State& state)
+  {
+    const auto objects0 = ToRects(CreateObjects(TDistribution, static_cast<uint32_t>(state.range(0)), LocalConfig::Seed));
+    auto objects1 = objects0;
+    for (auto& rEntry : objects1)
+    {
+      rEntry = Rect(rEntry.X() + 8.0f, rEntry.Y() + 4.0f, rEntry.Width(), rEntry.Height());
+    }
+    std::vector<uint32_t> handles(objects0.size());
+    auto grid = CreateFslBaseGrid();
+    grid.AddRange(SpanUtil::AsReadOnlySpan(objects0), SpanUtil::AsSpan(handles));
+    bool toggle = false;
+    for (auto _ : state)
+    {
+      const auto& objects = toggle ? objects0 : objects1;
+      for (std::size_t i = 0; i < handles.size(); ++i)
+      {
+        grid.Move(handles[i], objects[i]);
+      }
+      toggle = !toggle;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+  }
+}
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// Build
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef LOCAL_BENCH_BUILD
+BENCHMARK(BmBuild<Distribution::Uniform, SpatialHashGrid2DUnorderedMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Uniform, SpatialHashGrid2DMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Uniform, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Uniform, FixedBucketSizeGrid>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuildFslBaseAdd<Distribution::Uniform>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuildFslBaseAddRange<Distribution::Uniform>)->Arg(1000)->Arg(10000);
+
+BENCHMARK(BmBuild<Distribution::Clustered, SpatialHashGrid2DUnorderedMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Clustered, SpatialHashGrid2DMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Clustered, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuild<Distribution::Clustered, FixedBucketSizeGrid>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuildFslBaseAdd<Distribution::Clustered>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmBuildFslBaseAddRange<Distribution::Clustered>)->Arg(1000)->Arg(10000);
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// Query
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef LOCAL_BENCH_QUERY
+BENCHMARK(BmQuery<Distribution::Uniform, SpatialHashGrid2DUnorderedMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Uniform, SpatialHashGrid2DMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Uniform, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Uniform, FixedBucketSizeGrid>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQueryFslBase<Distribution::Uniform>)->Arg(1000)->Arg(10000);
+
+BENCHMARK(BmQuery<Distribution::Clustered, SpatialHashGrid2DUnorderedMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Clustered, SpatialHashGrid2DMap>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Clustered, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQuery<Distribution::Clustered, FixedBucketSizeGrid>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmQueryFslBase<Distribution::Clustered>)->Arg(1000)->Arg(10000);
+#endif
+
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+// Move
+// ---------------------------------------------------------------------------------------------------------------------------------------------------
+
+#ifdef LOCAL_BENCH_MOVE
+BENCHMARK(BmMoveAll<Distribution::Uniform, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmMoveAllFslBase<Distribution::Uniform>)->Arg(1000)->Arg(10000);
+
+BENCHMARK(BmMoveAll<Distribution::Clustered, SpatialHashGrid2DVector>)->Arg(1000)->Arg(10000);
+BENCHMARK(BmMoveAllFslBase<Distribution::Clustered>)->Arg(1000)->Arg(10000);
+#endif
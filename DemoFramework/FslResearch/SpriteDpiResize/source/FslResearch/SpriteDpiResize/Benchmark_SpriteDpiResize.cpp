@@ -0,0 +1,151 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/PathView.hpp>
+#include <FslGraphics/Sprite/ImageSprite.hpp>
+#include <FslGraphics/Sprite/Material/ISpriteMaterial.hpp>
+#include <FslGraphics/Sprite/Material/SpriteMaterialInfo.hpp>
+#include <FslGraphics/Sprite/NineSliceSprite.hpp>
+#include <FslGraphics/Sprite/SpriteDpConfig.hpp>
+#include <FslGraphics/Sprite/SpriteManager.hpp>
+#include <FslGraphics/TextureAtlas/AtlasNineSlicePatchInfo.hpp>
+#include <FslGraphics/TextureAtlas/AtlasTextureInfo.hpp>
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t SpriteCount = 10000;
+    constexpr uint32_t DensityDpiA = SpriteDpConfig::BaseDpi;
+    constexpr uint32_t DensityDpiB = SpriteDpConfig::BaseDpi * 2;
+    constexpr PxExtent2D TextureExtent = PxExtent2D::Create(2048, 2048);
+  }
+
+  class BenchmarkMaterial final : public ISpriteMaterial
+  {
+  };
+
+  //! Half image sprites, half nine slice sprites just like a typical theme
+  struct SpriteScene
+  {
+    SpriteManager Manager;
+    std::vector<std::shared_ptr<ImageSprite>> ImageSprites;
+    std::vector<std::shared_ptr<NineSliceSprite>> NineSliceSprites;
+
+    //! @param lazy if false the sprites are registered with SpriteManager::Add which makes the manager resize them eagerly
+    explicit SpriteScene(const bool lazy)
+      : Manager(LocalConfig::DensityDpiA, false)
+    {
+      const SpriteMaterialInfo materialInfo(SpriteMaterialId(1), LocalConfig::TextureExtent, false, BasicPrimitiveTopology::TriangleList,
+                                            std::make_shared<BenchmarkMaterial>());
+      const IO::PathView debugName("sprite");
+      for (uint32_t i = 0; i < LocalConfig::SpriteCount; ++i)
+      {
+        const uint32_t x = (i % 64u) * 32u;
+        const uint32_t y = ((i / 64u) % 64u) * 32u;
+        const AtlasTextureInfo textureInfo(PxRectangleU32::Create(x, y, 24, 24), PxThicknessU::Create(1, 1, 1, 1), SpriteDpConfig::BaseDpi);
+        if ((i & 1u) == 0u)
+        {
+          if (lazy)
+          {
+            ImageSprites.push_back(Manager.AddImageSprite(materialInfo, textureInfo, debugName));
+          }
+          else
+          {
+            auto sprite = std::make_shared<ImageSprite>(Manager.GetSpriteNativeAreaCalc(), materialInfo, textureInfo.TrimMarginPx,
+                                                        PxRectangleU16::Create(x, y, 24, 24), textureInfo.Dpi, debugName, LocalConfig::DensityDpiA);
+            Manager.Add(sprite);
+            ImageSprites.push_back(std::move(sprite));
+          }
+        }
+        else
+        {
+          const AtlasNineSlicePatchInfo patchInfo(PxThicknessU::Create(4, 4, 4, 4), PxThicknessU::Create(2, 2, 2, 2), AtlasNineSliceFlags::Opaque);
+          if (lazy)
+          {
+            NineSliceSprites.push_back(Manager.AddNineSliceSprite(materialInfo, textureInfo, patchInfo, debugName));
+          }
+          else
+          {
+            auto sprite = std::make_shared<NineSliceSprite>(Manager.GetSpriteNativeAreaCalc(), materialInfo, textureInfo.TrimMarginPx,
+                                                            PxRectangleU16::Create(x, y, 24, 24), patchInfo.NineSlicePx, patchInfo.ContentMarginPx,
+                                                            textureInfo.Dpi, debugName, LocalConfig::DensityDpiA);
+            Manager.Add(sprite);
+            NineSliceSprites.push_back(std::move(sprite));
+          }
+        }
+      }
+    }
+  };
+
+  //! Change the density and then 'draw' the given percentage of the sprites
+  //! @param range(0) 0 = eager resize, 1 = lazy resize
+  //! @param range(1) the percentage of the sprites that are drawn after the density change
+  void BM_ResizeThenDraw(benchmark::State& state)
+  {
+    SpriteScene scene(state.range(0) != 0);
+    const auto drawImageCount = static_cast<std::size_t>((scene.ImageSprites.size() * static_cast<std::size_t>(state.range(1))) / 100u);
+    const auto drawNineSliceCount = static_cast<std::size_t>((scene.NineSliceSprites.size() * static_cast<std::size_t>(state.range(1))) / 100u);
+    bool useDensityB = true;
+    for (auto _ : state)
+    {
+      scene.Manager.Resize(useDensityB ? LocalConfig::DensityDpiB : LocalConfig::DensityDpiA);
+      useDensityB = !useDensityB;
+
+      int32_t sum = 0;
+      for (std::size_t i = 0; i < drawImageCount; ++i)
+      {
+        sum += scene.ImageSprites[i]->GetRenderSizePx().RawWidth();
+      }
+      for (std::size_t i = 0; i < drawNineSliceCount; ++i)
+      {
+        sum += scene.NineSliceSprites[i]->GetRenderInfo().ScaledSizePx.RawWidth();
+      }
+      benchmark::DoNotOptimize(sum);
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+  }
+}
+
+BENCHMARK(BM_ResizeThenDraw)
+  ->ArgNames({"lazy", "drawPercent"})
+  ->Args({0, 1})
+  ->Args({1, 1})
+  ->Args({0, 10})
+  ->Args({1, 10})
+  ->Args({0, 100})
+  ->Args({1, 100})
+  ->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,182 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslGraphics/Font/BitmapFont.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayout.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutCache.hpp>
+#include <FslGraphics/Sprite/Font/Layout/TextLayoutUtil.hpp>
+#include <FslGraphics/Sprite/Font/TextureAtlasSpriteFont.hpp>
+#include <FslGraphics/Sprite/SpriteNativeAreaCalc.hpp>
+#include <benchmark/benchmark.h>
+#include <fmt/format.h>
+#include <string>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t LabelCount = 1000;
+    constexpr uint16_t FontDpi = 160;
+    constexpr int32_t MaxWidthPx = 320;
+  }
+
+  //! A proportional font covering printable ASCII with a few kerning pairs
+  TextureAtlasSpriteFont CreateFont()
+  {
+    std::vector<BitmapFontChar> chars;
+    for (uint32_t ch = 32; ch < 127; ++ch)
+    {
+      const uint32_t widthPx = ch == ' ' ? 0u : 6u + (ch % 7u);
+      const uint32_t index = ch - 32u;
+      chars.emplace_back(ch, PxRectangleU32::Create((index % 16u) * 16u, (index / 16u) * 20u, widthPx, 16), PxPoint2::Create(1, 2),
+                         PxValueU16(static_cast<uint16_t>(ch == ' ' ? 6u : widthPx + 2u)));
+    }
+    std::vector<BitmapFontKerning> kernings;
+    kernings.emplace_back('A', 'V', PxValue(-2));
+    kernings.emplace_back('T', 'o', PxValue(-1));
+    const BitmapFont font(std::string("Benchmark"), LocalConfig::FontDpi, 16, PxValueU16(20), PxValueU16(16), PxThicknessU16(),
+                          std::string("Benchmark.png"), BitmapFontType::Bitmap, BitmapFontSdfParams(), std::move(chars), std::move(kernings));
+    return TextureAtlasSpriteFont(SpriteNativeAreaCalc(false), PxExtent2D::Create(256, 256), font, LocalConfig::FontDpi);
+  }
+
+  std::string CreateLabelText(const uint32_t index, const uint32_t value)
+  {
+    return fmt::format("Setting {} controls how the renderer balances quality against speed on this device. Current value: {}", index, value);
+  }
+
+  TextLayoutConfig CreateConfig(const TextLineBreakMode mode = TextLineBreakMode::Greedy)
+  {
+    return {PxSize1D::Create(LocalConfig::MaxWidthPx), BitmapFontConfig(1.0f, true), mode};
+  }
+
+
+  //! Full layout of every label, this is what a label without any caching has to do for each change
+  //! @param range(0) the TextLineBreakMode
+  void BM_FullLayout(benchmark::State& state)
+  {
+    const TextureAtlasSpriteFont font = CreateFont();
+    const TextLayoutConfig config = CreateConfig(static_cast<TextLineBreakMode>(state.range(0)));
+    std::vector<std::string> texts;
+    for (uint32_t i = 0; i < LocalConfig::LabelCount; ++i)
+    {
+      texts.push_back(CreateLabelText(i, i));
+    }
+    std::vector<TextLayoutLine> lines;
+    std::vector<SpriteFontGlyphPosition> glyphs;
+    for (auto _ : state)
+    {
+      for (const std::string& text : texts)
+      {
+        const StringViewLite textView(text.data(), text.size());
+        lines.clear();
+        glyphs.clear();
+        TextLayoutUtil::BreakLines(lines, font, textView, config);
+        TextLayoutUtil::ExtractGlyphs(glyphs, font, textView, ReadOnlySpan<TextLayoutLine>(lines.data(), lines.size()), config.FontConfig);
+        benchmark::DoNotOptimize(glyphs.data());
+      }
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::LabelCount);
+  }
+
+
+  //! Every label flips between two texts, so after the first frame the line breaks come from the cache
+  void BM_CachedLayout(benchmark::State& state)
+  {
+    const TextureAtlasSpriteFont font = CreateFont();
+    const TextLayoutConfig config = CreateConfig();
+    std::vector<std::string> texts;
+    for (uint32_t i = 0; i < (LocalConfig::LabelCount * 2u); ++i)
+    {
+      texts.push_back(CreateLabelText(i / 2u, i % 2u));
+    }
+    TextLayoutCache cache(LocalConfig::LabelCount * 2u);
+    std::vector<TextLayout> layouts(LocalConfig::LabelCount);
+    uint32_t frame = 0;
+    for (auto _ : state)
+    {
+      for (uint32_t i = 0; i < LocalConfig::LabelCount; ++i)
+      {
+        const std::string& text = texts[(i * 2u) + (frame % 2u)];
+        // Recreate the layout to force the line breaks to be looked up instead of incrementally updated
+        layouts[i].Clear();
+        layouts[i].SetText(font, StringViewLite(text.data(), text.size()), config, &cache);
+      }
+      ++frame;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::LabelCount);
+    state.counters["HitRate"] = static_cast<double>(cache.GetHitCount()) / static_cast<double>(cache.GetHitCount() + cache.GetMissCount());
+  }
+
+
+  //! Every label ends with a counter that changes each frame
+  //! @param range(0) 0 = full layout on each change, 1 = TextLayout incremental re-layout
+  void BM_SuffixChange(benchmark::State& state)
+  {
+    const bool incremental = state.range(0) != 0;
+    const TextureAtlasSpriteFont font = CreateFont();
+    const TextLayoutConfig config = CreateConfig();
+    std::vector<TextLayout> layouts(LocalConfig::LabelCount);
+    std::vector<std::string> texts(LocalConfig::LabelCount);
+    std::vector<TextLayoutLine> lines;
+    std::vector<SpriteFontGlyphPosition> glyphs;
+    uint32_t frame = 0;
+    for (auto _ : state)
+    {
+      for (uint32_t i = 0; i < LocalConfig::LabelCount; ++i)
+      {
+        std::string& rText = texts[i];
+        rText = CreateLabelText(i, frame * 7u);
+        const StringViewLite textView(rText.data(), rText.size());
+        if (incremental)
+        {
+          layouts[i].SetText(font, textView, config);
+        }
+        else
+        {
+          lines.clear();
+          glyphs.clear();
+          TextLayoutUtil::BreakLines(lines, font, textView, config);
+          TextLayoutUtil::ExtractGlyphs(glyphs, font, textView, ReadOnlySpan<TextLayoutLine>(lines.data(), lines.size()), config.FontConfig);
+          benchmark::DoNotOptimize(glyphs.data());
+        }
+      }
+      ++frame;
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * LocalConfig::LabelCount);
+  }
+}
+
+BENCHMARK(BM_FullLayout)->ArgName("optimal")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_CachedLayout)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_SuffixChange)->ArgName("incremental")->Arg(0)->Arg(1)->Unit(benchmark::kMicrosecond);
@@ -0,0 +1,294 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Rect.hpp>
+#include <FslBase/Math/Vector2.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
+#include <FslGraphics2D/Physics/VerletSolver2D.hpp>
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <deque>
+#include <random>
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t RandomSeed = 0x1337;
+    constexpr Rect Bounds(0.0f, 0.0f, 4096.0f, 4096.0f);
+    constexpr float ParticleRadius = 2.0f;
+    constexpr float ClothSpacing = 4.0f;
+    //! Warm up steps so the benchmark measures a scene where the particles are in contact
+    constexpr uint32_t WarmupSteps = 10;
+  }
+
+  //! The array of structs deque based solver used by the GLES3.VerletIntegration101 demo
+  class DequeSolver
+  {
+    struct Particle
+    {
+      Vector2 Position;
+      Vector2 OldPosition;
+    };
+
+    struct Stick
+    {
+      int32_t PointIndex0{0};
+      int32_t PointIndex1{0};
+      float Length{0};
+    };
+
+    std::deque<Particle> m_particles;
+    std::deque<Stick> m_sticks;
+
+  public:
+    void AddParticle(const Vector2& position)
+    {
+      m_particles.push_back({position, position});
+    }
+
+    void AddStick(const int32_t index0, const int32_t index1)
+    {
+      m_sticks.push_back({index0, index1, Vector2::Distance(m_particles[index0].Position, m_particles[index1].Position)});
+    }
+
+    std::size_t GetParticleCount() const
+    {
+      return m_particles.size();
+    }
+
+    void Update()
+    {
+      const float friction = 0.999f;
+      const float gravity = 0.5f;
+      for (auto itr = m_particles.begin(); itr != m_particles.end(); ++itr)
+      {
+        auto velocity = (itr->Position - itr->OldPosition) * friction;
+        itr->OldPosition = itr->Position;
+        itr->Position += velocity;
+        itr->Position.Y += gravity;
+      }
+      for (std::size_t i = 0; i < 3; ++i)
+      {
+        for (auto itr = m_sticks.begin(); itr != m_sticks.end(); ++itr)
+        {
+          auto delta = m_particles[itr->PointIndex1].Position - m_particles[itr->PointIndex0].Position;
+          auto distance = delta.Length();
+          auto percent = ((itr->Length - distance) / distance) * 0.5f;
+          auto offset = delta * percent;
+          m_particles[itr->PointIndex0].Position -= offset;
+          m_particles[itr->PointIndex1].Position += offset;
+        }
+        ConstrainPoints(friction);
+      }
+    }
+
+  private:
+    void ConstrainPoints(const float friction)
+    {
+      const float bounce = 0.90f;
+      const float left = LocalConfig::Bounds.Left();
+      const float top = LocalConfig::Bounds.Top();
+      const float right = LocalConfig::Bounds.Right();
+      const float bottom = LocalConfig::Bounds.Bottom();
+      for (auto itr = m_particles.begin(); itr != m_particles.end(); ++itr)
+      {
+        auto velocity = (itr->Position - itr->OldPosition) * friction;
+        if (itr->Position.X > right)
+        {
+          itr->Position.X = right;
+          itr->OldPosition.X = itr->Position.X + (velocity.X * bounce);
+        }
+        else if (itr->Position.X < left)
+        {
+          itr->Position.X = left;
+          itr->OldPosition.X = itr->Position.X + (velocity.X * bounce);
+        }
+        if (itr->Position.Y > bottom)
+        {
+          itr->Position.Y = bottom;
+          itr->OldPosition.Y = itr->Position.Y + (velocity.Y * bounce);
+        }
+        else if (itr->Position.Y < top)
+        {
+          itr->Position.Y = top;
+          itr->OldPosition.Y = itr->Position.Y + (velocity.Y * bounce);
+        }
+      }
+    }
+  };
+
+  // A square cloth with the top row pinned
+  template <typename TSolver>
+  void AddCloth(TSolver& rSolver, const uint32_t particleCount)
+  {
+    const auto size = static_cast<uint32_t>(std::sqrt(static_cast<double>(particleCount)));
+    for (uint32_t y = 0; y < size; ++y)
+    {
+      for (uint32_t x = 0; x < size; ++x)
+      {
+        const Vector2 position(16.0f + (static_cast<float>(x) * LocalConfig::ClothSpacing),
+                               16.0f + (static_cast<float>(y) * LocalConfig::ClothSpacing));
+        if constexpr (std::is_same_v<TSolver, VerletSolver2D>)
+        {
+          rSolver.AddParticle(position, position, y == 0u ? 0.0f : 1.0f);
+        }
+        else
+        {
+          rSolver.AddParticle(position);
+        }
+      }
+    }
+    for (uint32_t y = 0; y < size; ++y)
+    {
+      for (uint32_t x = 0; x < size; ++x)
+      {
+        const uint32_t index = (y * size) + x;
+        if ((x + 1u) < size)
+        {
+          rSolver.AddStick(index, index + 1u);
+        }
+        if ((y + 1u) < size)
+        {
+          rSolver.AddStick(index, index + size);
+        }
+      }
+    }
+  }
+
+  void AddBalls(VerletSolver2D& rSolver, const uint32_t particleCount)
+  {
+    std::mt19937 random(LocalConfig::RandomSeed);
+    std::uniform_real_distribution<float> positionX(LocalConfig::Bounds.Left(), LocalConfig::Bounds.Right());
+    std::uniform_real_distribution<float> positionY(LocalConfig::Bounds.Top(), LocalConfig::Bounds.Bottom());
+    std::uniform_real_distribution<float> velocity(-1.0f, 1.0f);
+    for (uint32_t i = 0; i < particleCount; ++i)
+    {
+      const Vector2 position(positionX(random), positionY(random));
+      rSolver.AddParticle(position, position - Vector2(velocity(random), velocity(random)));
+    }
+  }
+
+  VerletSolver2DConfig CreateConfig(const bool enableCollisions)
+  {
+    return {Vector2(0.0f, 0.5f), 0.999f, 0.9f, LocalConfig::ParticleRadius, 3, enableCollisions};
+  }
+
+  void Warmup(VerletSolver2D& rSolver, WorkerThreadPool& rWorkerPool)
+  {
+    for (uint32_t i = 0; i < LocalConfig::WarmupSteps; ++i)
+    {
+      rSolver.Update(rWorkerPool);
+    }
+  }
+
+  void BM_Cloth_Deque(benchmark::State& state)
+  {
+    DequeSolver solver;
+    AddCloth(solver, static_cast<uint32_t>(state.range(0)));
+    for (uint32_t i = 0; i < LocalConfig::WarmupSteps; ++i)
+    {
+      solver.Update();
+    }
+
+    for (auto _ : state)
+    {
+      solver.Update();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * solver.GetParticleCount()));
+  }
+
+  void BM_Cloth(benchmark::State& state)
+  {
+    WorkerThreadPool pool;
+    VerletSolver2D solver(LocalConfig::Bounds, CreateConfig(false));
+    AddCloth(solver, static_cast<uint32_t>(state.range(0)));
+    Warmup(solver, pool);
+
+    for (auto _ : state)
+    {
+      solver.Update();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * solver.GetParticleCount());
+  }
+
+  void BM_Cloth_WorkerPool(benchmark::State& state)
+  {
+    WorkerThreadPool pool;
+    VerletSolver2D solver(LocalConfig::Bounds, CreateConfig(false));
+    AddCloth(solver, static_cast<uint32_t>(state.range(0)));
+    Warmup(solver, pool);
+
+    for (auto _ : state)
+    {
+      solver.Update(pool);
+    }
+    state.counters["Threads"] = static_cast<double>(pool.GetConcurrency());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * solver.GetParticleCount());
+  }
+
+  void BM_Balls(benchmark::State& state)
+  {
+    WorkerThreadPool pool;
+    VerletSolver2D solver(LocalConfig::Bounds, CreateConfig(true));
+    AddBalls(solver, static_cast<uint32_t>(state.range(0)));
+    Warmup(solver, pool);
+
+    for (auto _ : state)
+    {
+      solver.Update();
+    }
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * solver.GetParticleCount());
+  }
+
+  void BM_Balls_WorkerPool(benchmark::State& state)
+  {
+    WorkerThreadPool pool;
+    VerletSolver2D solver(LocalConfig::Bounds, CreateConfig(true));
+    AddBalls(solver, static_cast<uint32_t>(state.range(0)));
+    Warmup(solver, pool);
+
+    for (auto _ : state)
+    {
+      solver.Update(pool);
+    }
+    state.counters["Threads"] = static_cast<double>(pool.GetConcurrency());
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * solver.GetParticleCount());
+  }
+}
+
+BENCHMARK(BM_Cloth_Deque)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Cloth)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Cloth_WorkerPool)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
+BENCHMARK(BM_Balls)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_Balls_WorkerPool)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond)->UseRealTime();
@@ -0,0 +1,262 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslService/Consumer/ServiceProvider.hpp>
+#include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalService.hpp>
+#include <FslService/Impl/ServiceType/Local/ThreadLocalSingletonServiceFactoryBase.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
+#include <array>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <typeinfo>
+#include <utility>
+
+using namespace Fsl;
+
+namespace
+{
+  using TestThreading_Launcher_ServiceLauncher = TestFixtureFslBase;
+
+  constexpr std::array<ServiceLaunchMode, 2> LaunchModes = {ServiceLaunchMode::Serial, ServiceLaunchMode::Concurrent};
+
+  //! The services visible to a factory through the provider it was given
+  using VisibleServices = std::array<bool, 4>;
+
+  template <uint32_t TIndex>
+  class IStubService
+  {
+  public:
+    virtual ~IStubService() = default;
+  };
+
+  template <uint32_t TIndex>
+  class StubService final
+    : public ThreadLocalService
+    , public IStubService<TIndex>
+  {
+  public:
+    explicit StubService(const ServiceProvider& serviceProvider)
+      : ThreadLocalService(serviceProvider)
+    {
+    }
+  };
+
+
+  struct ProbeResult
+  {
+    bool Allocated{false};
+    VisibleServices Visible{};
+  };
+
+
+  template <uint32_t TIndex>
+  class StubServiceFactory final : public ThreadLocalSingletonServiceFactoryBase
+  {
+    std::shared_ptr<ProbeResult> m_result;
+    bool m_fail;
+
+  public:
+    StubServiceFactory(std::shared_ptr<ProbeResult> result, const ServiceCaps::Flags flags, const bool fail)
+      : ThreadLocalSingletonServiceFactoryBase(typeid(IStubService<TIndex>), flags)
+      , m_result(std::move(result))
+      , m_fail(fail)
+    {
+    }
+
+    std::shared_ptr<IService> Allocate(ServiceProvider& provider) override
+    {
+      m_result->Visible = {provider.TryGet<IStubService<0>>() != nullptr, provider.TryGet<IStubService<1>>() != nullptr,
+                           provider.TryGet<IStubService<2>>() != nullptr, provider.TryGet<IStubService<3>>() != nullptr};
+      if (m_fail)
+      {
+        throw std::runtime_error("Stub service failed");
+      }
+      m_result->Allocated = true;
+      return std::make_shared<StubService<TIndex>>(provider);
+    }
+  };
+
+
+  struct StubServices
+  {
+    RegisteredServiceDeque Services;
+    std::array<std::shared_ptr<ProbeResult>, 4> Results{std::make_shared<ProbeResult>(), std::make_shared<ProbeResult>(),
+                                                        std::make_shared<ProbeResult>(), std::make_shared<ProbeResult>()};
+  };
+
+
+  //! Service 0 has the highest priority, service 1 and 2 share a priority and service 3 has the lowest priority.
+  //! The services are registered out of order so the launcher has to sort them.
+  StubServices CreateServices(const ServiceCaps::Flags service2Flags = ServiceCaps::Default, const bool failService2 = false)
+  {
+    StubServices stubs;
+    stubs.Services.emplace_back(ProviderId(4), std::make_shared<StubServiceFactory<3>>(stubs.Results[3], ServiceCaps::Default, false), Priority(0));
+    stubs.Services.emplace_back(ProviderId(2), std::make_shared<StubServiceFactory<1>>(stubs.Results[1], ServiceCaps::Default, false), Priority(50));
+    stubs.Services.emplace_back(ProviderId(1), std::make_shared<StubServiceFactory<0>>(stubs.Results[0], ServiceCaps::Default, false),
+                                Priority(100));
+    stubs.Services.emplace_back(ProviderId(3), std::make_shared<StubServiceFactory<2>>(stubs.Results[2], service2Flags, failService2), Priority(50));
+    return stubs;
+  }
+
+
+  std::string GetFactoryName(const uint32_t index)
+  {
+    switch (index)
+    {
+    case 0:
+      return typeid(StubServiceFactory<0>).name();
+    case 1:
+      return typeid(StubServiceFactory<1>).name();
+    case 2:
+      return typeid(StubServiceFactory<2>).name();
+    case 3:
+      return typeid(StubServiceFactory<3>).name();
+    default:
+      throw std::invalid_argument("unsupported index");
+    }
+  }
+
+
+  const ServiceLaunchRecordStats* TryFindStats(const ServiceLaunchStats& stats, const uint32_t index)
+  {
+    const std::string name = GetFactoryName(index);
+    for (const ServiceLaunchRecordStats& entry : stats.Services)
+    {
+      if (entry.FactoryName == name)
+      {
+        return &entry;
+      }
+    }
+    return nullptr;
+  }
+}
+
+
+TEST(TestThreading_Launcher_ServiceLauncher, Launch_Empty)
+{
+  for (const ServiceLaunchMode launchMode : LaunchModes)
+  {
+    ServiceLaunchStats stats;
+    auto info = ServiceLauncher::Launch(RegisteredServiceDeque(), launchMode, stats);
+
+    EXPECT_NE(nullptr, info);
+    EXPECT_EQ(launchMode, stats.LaunchMode);
+    EXPECT_TRUE(stats.Services.empty());
+  }
+}
+
+
+TEST(TestThreading_Launcher_ServiceLauncher, Launch_Stats)
+{
+  for (const ServiceLaunchMode launchMode : LaunchModes)
+  {
+    StubServices stubs = CreateServices();
+    ServiceLaunchStats stats;
+    auto info = ServiceLauncher::Launch(stubs.Services, launchMode, stats);
+
+    EXPECT_NE(nullptr, info);
+    EXPECT_EQ(launchMode, stats.LaunchMode);
+    ASSERT_EQ(4u, stats.Services.size());
+
+    // The services are launched in priority order
+    EXPECT_EQ(GetFactoryName(0), stats.Services[0].FactoryName);
+    EXPECT_EQ(100, stats.Services[0].StartupPriority.GetValue());
+    EXPECT_EQ(50, stats.Services[1].StartupPriority.GetValue());
+    EXPECT_EQ(50, stats.Services[2].StartupPriority.GetValue());
+    EXPECT_EQ(GetFactoryName(3), stats.Services[3].FactoryName);
+    EXPECT_EQ(0, stats.Services[3].StartupPriority.GetValue());
+    for (uint32_t i = 0; i < 4u; ++i)
+    {
+      const ServiceLaunchRecordStats* pEntry = TryFindStats(stats, i);
+      ASSERT_NE(nullptr, pEntry);
+      EXPECT_TRUE(pEntry->Started);
+      EXPECT_GE(pEntry->ConstructionTime.count(), 0);
+      EXPECT_LE(pEntry->ConstructionTime, stats.TotalTime);
+      EXPECT_TRUE(stubs.Results[i]->Allocated);
+    }
+  }
+}
+
+
+TEST(TestThreading_Launcher_ServiceLauncher, Launch_ProviderSnapshot)
+{
+  for (const ServiceLaunchMode launchMode : LaunchModes)
+  {
+    StubServices stubs = CreateServices();
+    ServiceLaunchStats stats;
+    ServiceLauncher::Launch(stubs.Services, launchMode, stats);
+
+    // A service only sees the services with a higher priority, so the services in a priority group get the same snapshot
+    EXPECT_EQ((VisibleServices{false, false, false, false}), stubs.Results[0]->Visible);
+    EXPECT_EQ((VisibleServices{true, false, false, false}), stubs.Results[1]->Visible);
+    EXPECT_EQ((VisibleServices{true, false, false, false}), stubs.Results[2]->Visible);
+    EXPECT_EQ((VisibleServices{true, true, true, false}), stubs.Results[3]->Visible);
+  }
+}
+
+
+TEST(TestThreading_Launcher_ServiceLauncher, Launch_OptionalFailure)
+{
+  for (const ServiceLaunchMode launchMode : LaunchModes)
+  {
+    StubServices stubs = CreateServices(ServiceCaps::Optional, true);
+    ServiceLaunchStats stats;
+    ServiceLauncher::Launch(stubs.Services, launchMode, stats);
+
+    ASSERT_EQ(4u, stats.Services.size());
+    const ServiceLaunchRecordStats* pFailed = TryFindStats(stats, 2);
+    ASSERT_NE(nullptr, pFailed);
+    EXPECT_FALSE(pFailed->Started);
+    EXPECT_FALSE(stubs.Results[2]->Allocated);
+
+    // The failed optional service is not available to the lower priority services
+    EXPECT_TRUE(stubs.Results[3]->Allocated);
+    EXPECT_EQ((VisibleServices{true, true, false, false}), stubs.Results[3]->Visible);
+  }
+}
+
+
+TEST(TestThreading_Launcher_ServiceLauncher, Launch_RequiredFailure)
+{
+  for (const ServiceLaunchMode launchMode : LaunchModes)
+  {
+    StubServices stubs = CreateServices(ServiceCaps::Default, true);
+    ServiceLaunchStats stats;
+    EXPECT_THROW(ServiceLauncher::Launch(stubs.Services, launchMode, stats), std::runtime_error);
+
+    // The lower priority services are never allocated
+    EXPECT_FALSE(stubs.Results[3]->Allocated);
+  }
+}
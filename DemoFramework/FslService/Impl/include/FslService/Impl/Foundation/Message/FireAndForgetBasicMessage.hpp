@@ -44,6 +44,8 @@ namespace Fsl
     ProviderId TargetId;
     std::shared_ptr<Message> Content;
     std::shared_ptr<IMessagePool> MessagePool;
+    //! The id of the async trace span that covers the message from it was posted until it has been processed (zero if not traced).
+    uint32_t TraceId{0};
 
 
     FireAndForgetBasicMessage() = default;
@@ -66,7 +68,8 @@ namespace Fsl
 
     operator BasicMessage() const    // NOLINT(google-explicit-constructor);
     {
-      return {BasicMessageType::FireAndForgetMessage, UncheckedNumericCast<int32_t>(TargetId.Get()), Content, MessagePool};
+      return {BasicMessageType::FireAndForgetMessage, UncheckedNumericCast<int32_t>(TargetId.Get()), static_cast<int32_t>(TraceId),
+              std::exception_ptr(), Content, MessagePool};
     }
 
 
@@ -77,7 +80,9 @@ namespace Fsl
         throw std::invalid_argument("message was not of the expected type");
       }
 
-      return {ProviderId(UncheckedNumericCast<uint32_t>(message.Param1)), message.Content, message.MessagePool};
+      FireAndForgetBasicMessage result(ProviderId(UncheckedNumericCast<uint32_t>(message.Param1)), message.Content, message.MessagePool);
+      result.TraceId = static_cast<uint32_t>(message.Param2);
+      return result;
     }
   };
 }
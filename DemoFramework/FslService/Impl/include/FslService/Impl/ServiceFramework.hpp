@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslService/Impl/Threading/Launcher/ServiceLaunchStats.hpp>
 #include <memory>
 
 namespace Fsl
@@ -60,6 +61,7 @@ namespace Fsl
     std::shared_ptr<RegisteredServices> m_registeredServices;
 
     std::shared_ptr<RegisteredGlobalServiceInfo> m_registeredGlobalServiceInfo;
+    ServiceLaunchStats m_globalServiceLaunchStats;
 
     std::unique_ptr<ServiceThreadManager> m_threadManager;
     std::shared_ptr<IServiceHost> m_mainHost;
@@ -71,11 +73,20 @@ namespace Fsl
     std::weak_ptr<IServiceRegistry> GetServiceRegistry() const;
 
     void PrepareServices(ServiceOptionParserDeque& rServiceOptionParsers);
-    void LaunchGlobalServices();
+    //! @brief Launch the global services
+    //! @param launchMode the launch mode used for the global services.
+    //! @note  The thread local services are always launched serially on their host thread.
+    void LaunchGlobalServices(const ServiceLaunchMode launchMode = ServiceLaunchMode::Serial);
     void LaunchThreads();
 
     std::shared_ptr<IServiceProvider> GetServiceProvider() const;
 
+    //! @brief Get the construction stats of the global services (valid after LaunchGlobalServices)
+    const ServiceLaunchStats& GetGlobalServiceLaunchStats() const
+    {
+      return m_globalServiceLaunchStats;
+    }
+
     //! @brief Get the service host looper (can be called when the framework is running)
     std::shared_ptr<IServiceHostLooper> GetServiceHostLooper() const;
   };
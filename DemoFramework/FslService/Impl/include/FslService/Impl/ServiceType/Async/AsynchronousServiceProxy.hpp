@@ -32,6 +32,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Exceptions.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
 #include <FslService/Consumer/IBasicService.hpp>
 #include <FslService/Impl/Foundation/Message/FireAndForgetBasicMessage.hpp>
 #include <FslService/Impl/Foundation/Message/IBasicMessageQueue.hpp>
@@ -70,7 +71,13 @@ namespace Fsl
       }
 
       auto future = newMessage->Promise.get_future();
-      serviceQueue->Push(FireAndForgetBasicMessage(m_id, newMessage));
+      FireAndForgetBasicMessage basicMessage(m_id, newMessage);
+      if (TraceRecorder::IsEnabled())
+      {
+        basicMessage.TraceId = TraceRecorder::NextAsyncId();
+        TraceRecorder::RecordAsyncBegin("Service", "AsyncServiceMessage", basicMessage.TraceId);
+      }
+      serviceQueue->Push(basicMessage);
       return future;
     }
   };
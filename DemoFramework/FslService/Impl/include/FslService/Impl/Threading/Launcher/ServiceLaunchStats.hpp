@@ -0,0 +1,74 @@
+#ifndef FSLSERVICE_IMPL_THREADING_LAUNCHER_SERVICELAUNCHSTATS_HPP
+#define FSLSERVICE_IMPL_THREADING_LAUNCHER_SERVICELAUNCHSTATS_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslService/Impl/Priority.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLaunchMode.hpp>
+#include <chrono>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Fsl
+{
+  struct ServiceLaunchRecordStats
+  {
+    //! The type name of the service factory
+    std::string FactoryName;
+    Priority StartupPriority;
+    //! The time spent allocating and linking the service
+    std::chrono::microseconds ConstructionTime{};
+    //! False if the service failed to start or was unavailable (on demand services that returned null)
+    bool Started{false};
+
+    ServiceLaunchRecordStats() = default;
+    ServiceLaunchRecordStats(std::string factoryName, const Priority startupPriority, const std::chrono::microseconds constructionTime,
+                             const bool started)
+      : FactoryName(std::move(factoryName))
+      , StartupPriority(startupPriority)
+      , ConstructionTime(constructionTime)
+      , Started(started)
+    {
+    }
+  };
+
+  struct ServiceLaunchStats
+  {
+    ServiceLaunchMode LaunchMode{ServiceLaunchMode::Serial};
+    //! The stats for each service in the order they were launched
+    std::vector<ServiceLaunchRecordStats> Services;
+    //! The wall clock time spent launching all the services
+    std::chrono::microseconds TotalTime{};
+  };
+}
+
+#endif
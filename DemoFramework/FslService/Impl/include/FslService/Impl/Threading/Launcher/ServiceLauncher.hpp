@@ -31,6 +31,8 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslService/Impl/Threading/Launcher/ServiceLaunchMode.hpp>
+#include <FslService/Impl/Threading/Launcher/ServiceLaunchStats.hpp>
 #include <memory>
 
 namespace Fsl
@@ -50,8 +52,15 @@ namespace Fsl
     ServiceLauncher& operator=(const ServiceLauncher&) = delete;
 
     static std::shared_ptr<RegisteredGlobalServiceInfo> Launch(const RegisteredServiceDeque& services);
+    //! @brief Launch the services using the given launch mode and record the construction time of each service in rStats
+    static std::shared_ptr<RegisteredGlobalServiceInfo> Launch(const RegisteredServiceDeque& services, const ServiceLaunchMode launchMode,
+                                                               ServiceLaunchStats& rStats);
     static std::shared_ptr<ServiceProviderImpl> Launch(const TypeServiceMaps& globalServiceTypeMaps, const RegisteredServiceDeque& services,
                                                        const bool clearOwnedUniqueServices);
+    //! @brief Launch the services using the given launch mode and record the construction time of each service in rStats
+    static std::shared_ptr<ServiceProviderImpl> Launch(const TypeServiceMaps& globalServiceTypeMaps, const RegisteredServiceDeque& services,
+                                                       const bool clearOwnedUniqueServices, const ServiceLaunchMode launchMode,
+                                                       ServiceLaunchStats& rStats);
   };
 }
 
@@ -81,7 +81,7 @@ namespace Fsl
   }
 
 
-  void ServiceFramework::LaunchGlobalServices()
+  void ServiceFramework::LaunchGlobalServices(const ServiceLaunchMode launchMode)
   {
     if (m_state != State::ServicesPrepared)
     {
@@ -94,7 +94,7 @@ namespace Fsl
     assert(!m_mainHost);
 
     // Launch the global services
-    m_registeredGlobalServiceInfo = ServiceLauncher::Launch(m_registeredServices->GlobalServices);
+    m_registeredGlobalServiceInfo = ServiceLauncher::Launch(m_registeredServices->GlobalServices, launchMode, m_globalServiceLaunchStats);
     assert(m_registeredGlobalServiceInfo);
 
     m_state = State::RunThreads;
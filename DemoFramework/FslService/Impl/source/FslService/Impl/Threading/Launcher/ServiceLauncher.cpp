@@ -30,6 +30,7 @@
  ****************************************************************************************************************************************************/
 
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/System/Threading/WorkerThreadPool.hpp>
 #include <FslService/Consumer/ServiceProvider.hpp>
 #include <FslService/Impl/Exceptions.hpp>
 #include <FslService/Impl/Registry/RegisteredServiceDeque.hpp>
@@ -37,8 +38,12 @@
 #include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
 #include <algorithm>
 #include <cassert>
+#include <chrono>
+#include <exception>
 #include <map>
 #include <set>
+#include <thread>
+#include <vector>
 #include "../Provider/ServiceProviderImpl.hpp"
 #include "RegisteredGlobalServiceInfo.hpp"
 #include "TypeServiceMap.hpp"
@@ -48,6 +53,11 @@ namespace Fsl
 {
   namespace
   {
+    namespace LocalConfig
+    {
+      constexpr std::size_t MinConcurrency = 8;
+    }
+
     struct RecordComparator
     {
       bool operator()(const RegisteredServiceRecord& lhs, const RegisteredServiceRecord& rhs)
@@ -117,14 +127,10 @@ namespace Fsl
     }
 
 
-    std::shared_ptr<IService> StartService(std::set<std::type_index>& multiProviderInterfaces, ServiceProvider& provider,
-                                           TypeServiceMaps& rServiceProviderMaps, const RegisteredServiceRecord& record)
+    //! @brief Allocate the service
+    //! @return the service or null if a AvailableOnDemand service was unavailable
+    std::shared_ptr<IService> AllocateService(ServiceProvider& provider, const RegisteredServiceRecord& record)
     {
-      ServiceSupportedInterfaceDeque deque;
-      record.Factory->FillInterfaceType(deque);
-
-      assert(!deque.empty());
-
       std::shared_ptr<IService> service(record.Factory->Allocate(provider));
       if (!service)
       {
@@ -136,9 +142,17 @@ namespace Fsl
         FSLLOG3_ERROR("The service factory '{}' returned a nullptr", SafeGetTypeName(record.Factory));
         throw InvalidServiceFactoryException("The service factory returned a null-ptr");
       }
+      return service;
+    }
+
 
-      // Give the object a chance to do something after construction (useful for shared_from_this)
-      service->Link(provider);
+    void RegisterService(const std::set<std::type_index>& multiProviderInterfaces, TypeServiceMaps& rServiceProviderMaps,
+                         const RegisteredServiceRecord& record, const std::shared_ptr<IService>& service)
+    {
+      ServiceSupportedInterfaceDeque deque;
+      record.Factory->FillInterfaceType(deque);
+
+      assert(!deque.empty());
 
       // Register the object on all interfaces
       auto itr = deque.begin();
@@ -172,70 +186,196 @@ namespace Fsl
 
         ++itr;
       }
-      return service;
+    }
+
+
+    //! The result of a service allocation
+    struct AllocatedService
+    {
+      std::shared_ptr<IService> Service;
+      std::exception_ptr Error;
+      std::chrono::microseconds AllocationTime{};
+    };
+
+
+    AllocatedService TryAllocateService(ServiceProvider& provider, const RegisteredServiceRecord& record)
+    {
+      AllocatedService result;
+      const auto startTime = std::chrono::steady_clock::now();
+      try
+      {
+        result.Service = AllocateService(provider, record);
+      }
+      catch (...)
+      {
+        result.Error = std::current_exception();
+      }
+      result.AllocationTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+      return result;
+    }
+
+
+    //! @brief Link and register a allocated service (or handle its allocation failure)
+    void FinishService(const std::set<std::type_index>& multiProviderInterfaces, ServiceProvider& provider, TypeServiceMaps& rServiceProviderMaps,
+                       const RegisteredServiceRecord& record, const AllocatedService& allocated, ServiceLaunchStats& rStats)
+    {
+      const auto startTime = std::chrono::steady_clock::now();
+      bool started = false;
+      try
+      {
+        if (allocated.Error)
+        {
+          std::rethrow_exception(allocated.Error);
+        }
+        if (allocated.Service)
+        {
+          // Give the object a chance to do something after construction (useful for shared_from_this)
+          allocated.Service->Link(provider);
+
+          RegisterService(multiProviderInterfaces, rServiceProviderMaps, record, allocated.Service);
+          rServiceProviderMaps.OwnedUniqueServices.push_back(allocated.Service);
+          started = true;
+        }
+      }
+      catch (const std::exception& ex)
+      {
+        if ((record.Factory->GetFlags() & ServiceCaps::Optional) != 0)
+        {
+          FSLLOG3_WARNING("Service provided by '{}' failed to start: {}", SafeGetTypeName(record.Factory), ex.what());
+        }
+        else
+        {
+          throw;
+        }
+      }
+      const auto linkTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime);
+      rStats.Services.emplace_back(SafeGetTypeName(record.Factory), record.StartupPriority, allocated.AllocationTime + linkTime, started);
+    }
+
+
+    //! @brief Find the end of the group of services that share the priority of the service at 'begin'
+    std::size_t FindPriorityGroupEnd(const RegisteredServiceDeque& sortedServices, const std::size_t begin)
+    {
+      std::size_t end = begin + 1u;
+      while (end < sortedServices.size() && sortedServices[end].StartupPriority == sortedServices[begin].StartupPriority)
+      {
+        ++end;
+      }
+      return end;
+    }
+
+
+    std::unique_ptr<WorkerThreadPool> CreateWorkerPool(const RegisteredServiceDeque& sortedServices)
+    {
+      std::size_t maxGroupSize = 0;
+      for (std::size_t groupBegin = 0; groupBegin < sortedServices.size();)
+      {
+        const std::size_t groupEnd = FindPriorityGroupEnd(sortedServices, groupBegin);
+        maxGroupSize = std::max(maxGroupSize, groupEnd - groupBegin);
+        groupBegin = groupEnd;
+      }
+      // Service construction is often waiting on io, so we allow more threads than the hardware provides (the calling thread takes part in the work)
+      const std::size_t concurrency = std::max(std::size_t(std::thread::hardware_concurrency()), LocalConfig::MinConcurrency);
+      const auto workerThreadCount = static_cast<uint32_t>(std::min(maxGroupSize, concurrency) - 1u);
+      return workerThreadCount > 0u ? std::make_unique<WorkerThreadPool>(workerThreadCount) : std::unique_ptr<WorkerThreadPool>();
+    }
+
+
+    void LogStats(const ServiceLaunchStats& stats)
+    {
+      for (const ServiceLaunchRecordStats& entry : stats.Services)
+      {
+        FSLLOG3_VERBOSE3("Service '{}' priority {} constructed in {}us (started: {})", entry.FactoryName, entry.StartupPriority.GetValue(),
+                         entry.ConstructionTime.count(), entry.Started);
+      }
+      FSLLOG3_VERBOSE2("Launched {} services in {}us", stats.Services.size(), stats.TotalTime.count());
     }
 
 
     void StartService(const RegisteredServiceDeque& services, TypeServiceMaps& rServiceProviderMaps,
-                      std::set<std::type_index>& rMultiProviderInterfaces)
+                      const std::set<std::type_index>& multiProviderInterfaces, const ServiceLaunchMode launchMode, ServiceLaunchStats& rStats)
     {
+      const auto launchStartTime = std::chrono::steady_clock::now();
+      rStats.LaunchMode = launchMode;
+      rStats.Services.clear();
+      rStats.Services.reserve(services.size());
+
       // Sort the services according to priority
       RegisteredServiceDeque sortedServices(services);
       std::sort(sortedServices.begin(), sortedServices.end(), RecordComparator());
 
-      auto provider = std::make_shared<ServiceProviderImpl>(rServiceProviderMaps);
-      Priority currentPriority = sortedServices.front().StartupPriority;
-
-      auto itr = sortedServices.begin();
-      const auto itrEnd = sortedServices.end();
+      std::unique_ptr<WorkerThreadPool> workerPool;
+      if (launchMode == ServiceLaunchMode::Concurrent)
+      {
+        workerPool = CreateWorkerPool(sortedServices);
+      }
 
-      ServiceProvider theServiceProvider(provider);
-      while (itr != itrEnd)
+      std::vector<AllocatedService> allocatedServices;
+      std::size_t groupBegin = 0;
+      while (groupBegin < sortedServices.size())
       {
-        // Each time we change priority we recreate the service provider to enable access to all higher priority services
-        if (itr->StartupPriority != currentPriority)
-        {
-          currentPriority = itr->StartupPriority;
-          provider = std::make_shared<ServiceProviderImpl>(rServiceProviderMaps);
-          theServiceProvider = ServiceProvider(provider);
-        }
+        const std::size_t groupEnd = FindPriorityGroupEnd(sortedServices, groupBegin);
 
-        try
+        // Each time we change priority we recreate the service provider to enable access to all higher priority services
+        auto provider = std::make_shared<ServiceProviderImpl>(rServiceProviderMaps);
+        ServiceProvider theServiceProvider(provider);
+        if (!workerPool || (groupEnd - groupBegin) < 2u)
         {
-          const std::shared_ptr<IService> service = StartService(rMultiProviderInterfaces, theServiceProvider, rServiceProviderMaps, *itr);
-          if (service)
+          for (std::size_t i = groupBegin; i < groupEnd; ++i)
           {
-            rServiceProviderMaps.OwnedUniqueServices.push_back(service);
+            const AllocatedService allocated = TryAllocateService(theServiceProvider, sortedServices[i]);
+            FinishService(multiProviderInterfaces, theServiceProvider, rServiceProviderMaps, sortedServices[i], allocated, rStats);
           }
         }
-        catch (const std::exception& ex)
+        else
         {
-          if ((itr->Factory->GetFlags() & ServiceCaps::Optional) != 0)
-          {
-            FSLLOG3_WARNING("Service provided by '{}' failed to start: {}", SafeGetTypeName(itr->Factory), ex.what());
-          }
-          else
+          // The provider only exposes higher priority services so the services in the group are independent of each other
+          allocatedServices.clear();
+          allocatedServices.resize(groupEnd - groupBegin);
+          workerPool->ParallelFor(allocatedServices.size(), 1u,
+                                  [&sortedServices, &allocatedServices, &provider, groupBegin](const std::size_t begin, const std::size_t end)
+                                  {
+                                    ServiceProvider localServiceProvider(provider);
+                                    for (std::size_t i = begin; i < end; ++i)
+                                    {
+                                      allocatedServices[i] = TryAllocateService(localServiceProvider, sortedServices[groupBegin + i]);
+                                    }
+                                  });
+          // Link and register the services in the same order as the serial launch
+          for (std::size_t i = groupBegin; i < groupEnd; ++i)
           {
-            throw;
+            FinishService(multiProviderInterfaces, theServiceProvider, rServiceProviderMaps, sortedServices[i],
+                          allocatedServices[i - groupBegin], rStats);
           }
         }
-        ++itr;
+        groupBegin = groupEnd;
       }
-      provider.reset();
+      rStats.TotalTime = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - launchStartTime);
+      LogStats(rStats);
     }
   }
 
 
   std::shared_ptr<RegisteredGlobalServiceInfo> ServiceLauncher::Launch(const RegisteredServiceDeque& services)
+  {
+    ServiceLaunchStats stats;
+    return Launch(services, ServiceLaunchMode::Serial, stats);
+  }
+
+
+  std::shared_ptr<RegisteredGlobalServiceInfo> ServiceLauncher::Launch(const RegisteredServiceDeque& services, const ServiceLaunchMode launchMode,
+                                                                       ServiceLaunchStats& rStats)
   {
     TypeServiceMaps serviceProviderMaps;
+    rStats = ServiceLaunchStats();
+    rStats.LaunchMode = launchMode;
     if (!services.empty())
     {
       // Find all interfaces that have multiple providers
       std::set<std::type_index> multiProviderInterfaces;
       FindMultiProviderInterfaces(multiProviderInterfaces, services);
 
-      StartService(services, serviceProviderMaps, multiProviderInterfaces);
+      StartService(services, serviceProviderMaps, multiProviderInterfaces, launchMode, rStats);
     }
     return std::make_shared<RegisteredGlobalServiceInfo>(serviceProviderMaps);
   }
@@ -243,6 +383,15 @@ namespace Fsl
 
   std::shared_ptr<ServiceProviderImpl> ServiceLauncher::Launch(const TypeServiceMaps& globalServiceTypeMaps, const RegisteredServiceDeque& services,
                                                                const bool clearOwnedUniqueServices)
+  {
+    ServiceLaunchStats stats;
+    return Launch(globalServiceTypeMaps, services, clearOwnedUniqueServices, ServiceLaunchMode::Serial, stats);
+  }
+
+
+  std::shared_ptr<ServiceProviderImpl> ServiceLauncher::Launch(const TypeServiceMaps& globalServiceTypeMaps, const RegisteredServiceDeque& services,
+                                                               const bool clearOwnedUniqueServices, const ServiceLaunchMode launchMode,
+                                                               ServiceLaunchStats& rStats)
   {
     TypeServiceMaps serviceProviderMaps(globalServiceTypeMaps);
     if (clearOwnedUniqueServices)
@@ -250,13 +399,15 @@ namespace Fsl
       serviceProviderMaps.OwnedUniqueServices.clear();
     }
 
+    rStats = ServiceLaunchStats();
+    rStats.LaunchMode = launchMode;
     if (!services.empty())
     {
       // Find all interfaces that have multiple providers
       std::set<std::type_index> multiProviderInterfaces;
       FindMultiProviderInterfaces(multiProviderInterfaces, services);
 
-      StartService(services, serviceProviderMaps, multiProviderInterfaces);
+      StartService(services, serviceProviderMaps, multiProviderInterfaces, launchMode, rStats);
     }
     return std::make_shared<ServiceProviderImpl>(serviceProviderMaps);
   }
@@ -33,6 +33,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Log/Log3Core.hpp>
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Trace/Trace.hpp>
 #include <FslService/Impl/Foundation/Message/FireAndForgetBasicMessage.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadShutdownBasicMessage.hpp>
 #include <FslService/Impl/Threading/Launcher/ServiceLauncher.hpp>
@@ -83,6 +84,7 @@ namespace Fsl
       auto message = m_messageScratchpad.front();
       m_messageScratchpad.pop();
 
+      FSL_TRACE_ZONE("Service", "ProcessMessage");
       ProcessMessage(message);
 
       // FIX: support message pooling
@@ -90,8 +92,10 @@ namespace Fsl
       //  message.MessagePool->Release(message.Content);
     }
 
-    // Give the various services types a chance to update
-    m_serviceProvider->Update();
+    {    // Give the various services types a chance to update
+      FSL_TRACE_ZONE("Service", "Update");
+      m_serviceProvider->Update();
+    }
   }
 
 
@@ -133,7 +137,12 @@ namespace Fsl
     case BasicMessageType::FireAndForgetMessage:
       if (m_asyncServiceImplHost)
       {
-        m_asyncServiceImplHost->ProcessMessage(FireAndForgetBasicMessage::Decode(message));
+        const FireAndForgetBasicMessage fireAndForgetMessage = FireAndForgetBasicMessage::Decode(message);
+        m_asyncServiceImplHost->ProcessMessage(fireAndForgetMessage);
+        if (fireAndForgetMessage.TraceId != 0u)
+        {
+          TraceRecorder::RecordAsyncEnd("Service", "AsyncServiceMessage", fireAndForgetMessage.TraceId);
+        }
       }
       FSLLOG3_WARNING_IF(!m_asyncServiceImplHost, "the expected handler has been destroyed");
       break;
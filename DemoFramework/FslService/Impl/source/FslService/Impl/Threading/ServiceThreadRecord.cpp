@@ -31,6 +31,7 @@
 
 #include "ServiceThreadRecord.hpp"
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Trace/TraceRecorder.hpp>
 #include <FslService/Impl/Foundation/Message/BasicMessageQueue.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadInitBasicMessage.hpp>
 #include <FslService/Impl/Foundation/Message/ThreadShutdownBasicMessage.hpp>
@@ -56,6 +57,7 @@ namespace Fsl
       FSLLOG3_VERBOSE("Thread started for serviceGroupId {} on {}", serviceConfig.Id.GetValue(), fmt::streamed(currentThreadId));
       try
       {
+        TraceRecorder::SetCurrentThreadName(fmt::format("ServiceThread {}", serviceConfig.Id.GetValue()));
         ServiceHostContext hostContext(incomingProvider);
         ServiceHostCreateInfo createInfo(hostContext, serviceConfig);
         // Allocate the host 'inside' the right thread so it lives it life fully in this thread
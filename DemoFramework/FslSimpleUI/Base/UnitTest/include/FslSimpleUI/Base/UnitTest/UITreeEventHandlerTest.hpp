@@ -50,18 +50,25 @@ namespace Fsl::UI
       uint32_t HandleEventBubble;
     };
 
+    //! A copy of the routed event content (the RoutedEvent itself only references the content so it can't be stored)
+    struct TestRoutedEvent
+    {
+      std::shared_ptr<WindowEvent> Content;
+      bool IsTunneling{};
+    };
+
     struct TestHandleInfo
     {
-      std::shared_ptr<TreeNode> Window;
-      RoutedEvent TheEvent;
+      const TreeNode* Window;
+      TestRoutedEvent TheEvent;
       std::shared_ptr<WindowTransactionEvent> TransactionEvent;
       EventTransactionState TransactionState{};
       bool TransactionIsRepeat{};
       bool TransactionIsHandled{};
 
-      TestHandleInfo(std::shared_ptr<TreeNode> window, const RoutedEvent& theEvent)
-        : Window(std::move(window))
-        , TheEvent(theEvent)
+      TestHandleInfo(const TreeNode* pWindow, const RoutedEvent& theEvent)
+        : Window(pWindow)
+        , TheEvent{theEvent.Content, theEvent.IsTunneling}
         , TransactionEvent(std::dynamic_pointer_cast<WindowTransactionEvent>(theEvent.Content))
         , TransactionState(TransactionEvent ? TransactionEvent->GetState() : EventTransactionState::Begin)
         , TransactionIsRepeat(TransactionEvent ? TransactionEvent->IsRepeat() : false)
@@ -77,12 +84,12 @@ namespace Fsl::UI
     bool TestMarkEventsAsHandled;
 
   private:
-    std::map<std::shared_ptr<TreeNode>, bool> m_clickEventIntercept;
-    std::map<std::shared_ptr<TreeNode>, bool> m_clickEventHandleBegin;
+    std::map<const TreeNode*, bool> m_clickEventIntercept;
+    std::map<const TreeNode*, bool> m_clickEventHandleBegin;
 
 
   public:
-    void HandleEvent(const std::shared_ptr<TreeNode>& target, const RoutedEvent& routedEvent) final;
+    void HandleEvent(TreeNode& rTarget, const RoutedEvent& routedEvent) final;
 
     void TestAddClickEventIntercept(const std::shared_ptr<TreeNode>& window, const bool tunnel);
     bool TestRemoveClickEventIntercept(const std::shared_ptr<TreeNode>& window);
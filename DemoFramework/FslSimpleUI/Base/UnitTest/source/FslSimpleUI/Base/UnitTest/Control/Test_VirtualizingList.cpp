@@ -0,0 +1,261 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Time/TimeSpan.hpp>
+#include <FslSimpleUI/Base/Control/IVirtualizingItemSource.hpp>
+#include <FslSimpleUI/Base/Control/VirtualizingList.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/System/UITree.hpp>
+#include <FslSimpleUI/Base/UnitTest/Control/UTControl.hpp>
+#include <FslSimpleUI/Base/UnitTest/TestUITree_ActiveLayout.hpp>
+#include <functional>
+#include <memory>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestItemSource final : public UI::IVirtualizingItemSource
+  {
+    std::shared_ptr<UI::BaseWindowContext> m_context;
+
+  public:
+    std::vector<std::shared_ptr<UI::UTControl>> Containers;
+    std::vector<uint32_t> ContainerItem;
+    uint32_t PrepareCount{0};
+    //! If set the container height is set to the returned value
+    std::function<float(uint32_t)> FnItemHeight;
+
+    explicit TestItemSource(std::shared_ptr<UI::BaseWindowContext> context)
+      : m_context(std::move(context))
+    {
+    }
+
+    std::shared_ptr<UI::BaseWindow> CreateItemContainer(const uint32_t containerIndex) final
+    {
+      EXPECT_EQ(containerIndex, Containers.size());
+      Containers.push_back(std::make_shared<UI::UTControl>(m_context));
+      ContainerItem.push_back(0);
+      return Containers.back();
+    }
+
+    void PrepareItemContainer(const uint32_t containerIndex, const uint32_t itemIndex) final
+    {
+      ++PrepareCount;
+      ContainerItem[containerIndex] = itemIndex;
+      if (FnItemHeight)
+      {
+        Containers[containerIndex]->SetHeight(UI::DpLayoutSize1D(FnItemHeight(itemIndex)));
+      }
+    }
+  };
+
+
+  // NOLINTNEXTLINE(readability-identifier-naming)
+  class TestControl_VirtualizingList : public TestUITree_ActiveLayout
+  {
+  protected:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    std::shared_ptr<UI::VirtualizingList> m_list;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    std::shared_ptr<TestItemSource> m_source;
+
+  public:
+    TestControl_VirtualizingList()
+      : m_list(std::make_shared<UI::VirtualizingList>(m_windowContext))
+      , m_source(std::make_shared<TestItemSource>(m_windowContext))
+    {
+      m_list->SetItemSource(m_source);
+      m_mainWindow->AddChild(m_list);
+    }
+
+    //! The containers are realized during resolve using the size of the last layout, so the first frame only sizes the list
+    void UpdateFrames(const uint32_t count = 2)
+    {
+      for (uint32_t i = 0; i < count; ++i)
+      {
+        m_tree->Update(TimeSpan(0));
+      }
+    }
+  };
+}
+
+
+TEST_F(TestControl_VirtualizingList, Empty)
+{
+  UpdateFrames();
+
+  EXPECT_EQ(0u, m_list->GetContainerCount());
+  EXPECT_EQ(0u, m_list->GetRealizedBegin());
+  EXPECT_EQ(0u, m_list->GetRealizedEnd());
+}
+
+
+TEST_F(TestControl_VirtualizingList, FixedHeight_RealizesVisibleRowsOnly)
+{
+  // The test root is 800x600 at the base dpi, so 10dp rows gives 60 visible rows
+  m_list->SetItemHeight(DpSize1DF::Create(10.0f));
+  m_list->SetOverscanCount(2);
+  m_list->SetItemCount(50000);
+  UpdateFrames();
+
+  EXPECT_EQ(0u, m_list->GetRealizedBegin());
+  EXPECT_EQ(62u, m_list->GetRealizedEnd());
+  EXPECT_EQ(62u, m_list->GetContainerCount());
+  EXPECT_EQ(62u, m_source->PrepareCount);
+  EXPECT_EQ(PxSize2D::Create(800, 600), m_list->RenderSizePx());
+}
+
+
+TEST_F(TestControl_VirtualizingList, FixedHeight_ScrollToItem_RecyclesContainers)
+{
+  m_list->SetItemHeight(DpSize1DF::Create(10.0f));
+  m_list->SetOverscanCount(2);
+  m_list->SetItemCount(50000);
+  UpdateFrames();
+  const uint32_t containerCount = m_list->GetContainerCount();
+
+  // Move a few rows, only the rows that scrolled into view are prepared
+  m_source->PrepareCount = 0;
+  m_list->ScrollToItem(5);
+  UpdateFrames(1);
+  EXPECT_EQ(3u, m_list->GetRealizedBegin());
+  EXPECT_EQ(67u, m_list->GetRealizedEnd());
+  EXPECT_EQ(containerCount + 2u, m_list->GetContainerCount());
+  EXPECT_EQ(5u, m_source->PrepareCount);
+
+  // Jump far away, all containers are reused
+  m_source->PrepareCount = 0;
+  m_list->ScrollToItem(40000);
+  UpdateFrames(1);
+  EXPECT_EQ(39998u, m_list->GetRealizedBegin());
+  EXPECT_EQ(40062u, m_list->GetRealizedEnd());
+  EXPECT_EQ(containerCount + 2u, m_list->GetContainerCount());
+  EXPECT_EQ(64u, m_source->PrepareCount);
+
+  // The end of the list is clamped to the content
+  m_list->ScrollToItem(50000);
+  UpdateFrames(1);
+  EXPECT_EQ(49938u, m_list->GetRealizedBegin());
+  EXPECT_EQ(50000u, m_list->GetRealizedEnd());
+
+  // Every realized item is bound to exactly one container
+  std::vector<uint32_t> itemUseCount(m_list->GetRealizedEnd() - m_list->GetRealizedBegin());
+  for (std::size_t i = 0; i < m_source->Containers.size(); ++i)
+  {
+    if (m_source->Containers[i]->GetVisibility() == UI::ItemVisibility::Visible)
+    {
+      ASSERT_GE(m_source->ContainerItem[i], m_list->GetRealizedBegin());
+      ASSERT_LT(m_source->ContainerItem[i], m_list->GetRealizedEnd());
+      ++itemUseCount[m_source->ContainerItem[i] - m_list->GetRealizedBegin()];
+    }
+  }
+  for (const uint32_t useCount : itemUseCount)
+  {
+    EXPECT_EQ(1u, useCount);
+  }
+}
+
+
+TEST_F(TestControl_VirtualizingList, FixedHeight_ItemCountReduced)
+{
+  m_list->SetItemHeight(DpSize1DF::Create(10.0f));
+  m_list->SetOverscanCount(0);
+  m_list->SetItemCount(1000);
+  UpdateFrames();
+  EXPECT_EQ(60u, m_list->GetRealizedEnd());
+
+  m_list->SetItemCount(10);
+  UpdateFrames(1);
+  EXPECT_EQ(0u, m_list->GetRealizedBegin());
+  EXPECT_EQ(10u, m_list->GetRealizedEnd());
+  EXPECT_EQ(60u, m_list->GetContainerCount());
+}
+
+
+TEST_F(TestControl_VirtualizingList, VariableHeight_UsesMeasuredHeights)
+{
+  // Every row is 20dp while the estimate is 10dp
+  m_source->FnItemHeight = [](const uint32_t /*itemIndex*/) { return 20.0f; };
+  m_list->SetEstimatedItemHeight(DpSize1DF::Create(10.0f));
+  m_list->SetOverscanCount(0);
+  m_list->SetItemCount(1000);
+  UpdateFrames();
+
+  // The first frame uses the estimate which realizes too many rows, once measured only the 30 visible rows are needed
+  UpdateFrames(1);
+  EXPECT_EQ(0u, m_list->GetRealizedBegin());
+  EXPECT_EQ(30u, m_list->GetRealizedEnd());
+
+  // Measured rows are arranged using their real height
+  for (std::size_t i = 0; i < m_source->Containers.size(); ++i)
+  {
+    if (m_source->Containers[i]->GetVisibility() == UI::ItemVisibility::Visible)
+    {
+      EXPECT_EQ(PxSize1D::Create(20), m_source->Containers[i]->RenderSizePx().Height());
+    }
+  }
+}
+
+
+TEST_F(TestControl_VirtualizingList, VariableHeight_ScrollToItem_UsesEstimateForUnmeasuredRows)
+{
+  m_source->FnItemHeight = [](const uint32_t itemIndex) { return (itemIndex % 2) == 0 ? 10.0f : 30.0f; };
+  m_list->SetEstimatedItemHeight(DpSize1DF::Create(20.0f));
+  m_list->SetOverscanCount(0);
+  m_list->SetItemCount(1000);
+  UpdateFrames(3);
+
+  // All unmeasured rows are estimated at 20dp so item 500 starts at 10000dp
+  m_list->ScrollToItem(500);
+  UpdateFrames(1);
+  EXPECT_EQ(500u, m_list->GetRealizedBegin());
+
+  // The realized rows keep their position even after being measured since the rows above them are unchanged
+  UpdateFrames(1);
+  EXPECT_EQ(500u, m_list->GetRealizedBegin());
+  EXPECT_EQ(530u, m_list->GetRealizedEnd());
+}
+
+
+TEST_F(TestControl_VirtualizingList, InvalidateItems_PreparesAllContainers)
+{
+  m_list->SetItemHeight(DpSize1DF::Create(10.0f));
+  m_list->SetOverscanCount(0);
+  m_list->SetItemCount(100);
+  UpdateFrames();
+
+  m_source->PrepareCount = 0;
+  m_list->InvalidateItems();
+  UpdateFrames(1);
+  EXPECT_EQ(60u, m_source->PrepareCount);
+}
@@ -0,0 +1,107 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/UnitTest/Helper/Common.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Base/Event/RoutedEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowContentChangedEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
+#include <FslSimpleUI/Base/Event/WindowSelectEvent.hpp>
+#include <memory>
+
+using namespace Fsl;
+
+namespace
+{
+  class TestRoutedEvent : public TestFixtureFslBase
+  {
+  protected:
+    UI::WindowEventPool m_eventPool;
+  };
+}
+
+
+TEST_F(TestRoutedEvent, Construct)
+{
+  const std::shared_ptr<UI::WindowEvent> theEvent = m_eventPool.AcquireWindowContentChangedEvent(1);
+  const UI::RoutedEvent routedEvent(theEvent, true);
+
+  EXPECT_EQ(&routedEvent.Content, &theEvent);
+  EXPECT_TRUE(routedEvent.IsTunneling);
+  EXPECT_THROW(routedEvent.GetContentAs<UI::WindowContentChangedEvent>(), UsageErrorException);
+}
+
+
+TEST_F(TestRoutedEvent, Construct_Null)
+{
+  const std::shared_ptr<UI::WindowEvent> theEvent;
+  EXPECT_THROW(UI::RoutedEvent(theEvent, true), std::invalid_argument);
+}
+
+
+TEST_F(TestRoutedEvent, Construct_Typed)
+{
+  const auto typedEvent = m_eventPool.AcquireWindowContentChangedEvent(1);
+  const std::shared_ptr<UI::WindowEvent> theEvent = typedEvent;
+  const auto useCount = theEvent.use_count();
+
+  const UI::RoutedEvent routedEvent(theEvent, typedEvent, false);
+
+  EXPECT_FALSE(routedEvent.IsTunneling);
+  EXPECT_EQ(&routedEvent.GetContentAs<UI::WindowContentChangedEvent>(), &typedEvent);
+  // Routing the event is not allowed to touch the reference count
+  EXPECT_EQ(theEvent.use_count(), useCount);
+  EXPECT_THROW(routedEvent.GetContentAs<UI::WindowSelectEvent>(), UsageErrorException);
+}
+
+
+TEST_F(TestRoutedEvent, Construct_Typed_Mismatch)
+{
+  const std::shared_ptr<UI::WindowEvent> theEvent = m_eventPool.AcquireWindowContentChangedEvent(1);
+  const auto otherEvent = m_eventPool.AcquireWindowContentChangedEvent(2);
+
+  EXPECT_THROW(UI::RoutedEvent(theEvent, otherEvent, true), std::invalid_argument);
+}
+
+
+TEST_F(TestRoutedEvent, Construct_ChangeDirection)
+{
+  const auto typedEvent = m_eventPool.AcquireWindowContentChangedEvent(1);
+  const std::shared_ptr<UI::WindowEvent> theEvent = typedEvent;
+  const UI::RoutedEvent tunnelEvent(theEvent, typedEvent, true);
+
+  const UI::RoutedEvent bubbleEvent(tunnelEvent, false);
+
+  EXPECT_FALSE(bubbleEvent.IsTunneling);
+  EXPECT_EQ(&bubbleEvent.Content, &theEvent);
+  EXPECT_EQ(&bubbleEvent.GetContentAs<UI::WindowContentChangedEvent>(), &typedEvent);
+}
@@ -236,7 +236,7 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_OneWindow_Direct)
 
   // Its a direct event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 }
@@ -256,7 +256,7 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_OneWindow_Tunnel)
 
   // Its a tunnel event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 }
@@ -276,7 +276,7 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_OneWindow_Bubble)
 
   // Its a bubble event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 }
@@ -298,12 +298,12 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_OneWindow_Pair)
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
 
   // The tunnel part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
   // The bubble part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 }
@@ -326,7 +326,7 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_TwoWindows_Direct)
 
   // Its a direct event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 }
@@ -346,11 +346,11 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_TwoWindows_Tunnel)
 
   // Its a tunneled event so we only expect one call to the parent window then the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 }
@@ -370,11 +370,11 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_TwoWindows_Bubble)
 
   // Its a bubble event so we expect one call to the target window with the event we send and one to the parent
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 }
@@ -396,20 +396,20 @@ TEST_F(TestEventRouteClickInput, SendTo_Begin_TwoWindows_Pair)
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 4u);
 
   // The tunnel part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 
   // The bubble part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TheEvent.IsTunneling);
 }
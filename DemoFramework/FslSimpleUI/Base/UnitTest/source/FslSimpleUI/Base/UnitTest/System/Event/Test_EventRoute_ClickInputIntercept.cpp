@@ -96,7 +96,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_OneWindow_Direct)
 
   // Its a direct event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
@@ -123,7 +123,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_OneWindow_Tunnel)
 
   // Its a tunnel event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
@@ -150,7 +150,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_OneWindow_Bubble)
 
   // Its a bubble event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
@@ -179,12 +179,12 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_OneWindow_Pair_InterceptT
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
 
   // The tunnel part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
   // The bubble part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 
@@ -214,12 +214,12 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_OneWindow_Pair_InterceptB
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
 
   // The tunnel part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
   // The bubble part
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 
@@ -250,7 +250,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Direct)
 
   // Its a direct event so we only expect one call to the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
@@ -280,11 +280,11 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Tunnel_TargetI
 
   // Its a tunneled event so we only expect one call to the parent window then the target window with the event we send
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 
@@ -313,7 +313,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Tunnel_ParentI
 
   // Its a tunneled event so we only expect one call to the parent window and since its intercepts the event, it stops there
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 1u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
@@ -343,11 +343,11 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Bubble_TargetI
 
   // Its a bubble event so we expect one call to the target window with the event we send and one to the parent
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 2u);
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
 
@@ -383,20 +383,20 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Bubble_ParentI
   // Its a bubble event so we expect one call to the target window with the event we send and one to the parent
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 3u);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsRepeat);
 
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TransactionIsRepeat);
 
   // We expect a 'cancel' event to get generated
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TransactionState, UI::EventTransactionState::Canceled);
@@ -430,28 +430,28 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_TunnelTar
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 4u);
 
   // The tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsRepeat);
 
   // The tunnel part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TransactionIsRepeat);
 
   // The bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TransactionIsRepeat);
 
   // The bubble part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TransactionState, UI::EventTransactionState::Begin);
@@ -484,28 +484,28 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubbleTar
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 4u);
 
   // The tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsRepeat);
 
   // The tunnel part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TransactionIsRepeat);
 
   // The bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TransactionIsRepeat);
 
   // The bubble part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TransactionState, UI::EventTransactionState::Begin);
@@ -540,14 +540,14 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_TunnelPar
   // Since the parent intercepts a begin via tunneling the original target is just cut out
 
   // The tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsRepeat);
 
   // The bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
@@ -581,7 +581,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 6u);
 
   // The tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
@@ -589,7 +589,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsHandled);
 
   // The tunnel part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
@@ -597,7 +597,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TransactionIsHandled);
 
   // The bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TransactionState, UI::EventTransactionState::Begin);
@@ -606,7 +606,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
 
   // The bubble part 2
   // This is where the intercept occurs, so this will be followed by a 'tunnel cancel' + 'tunnel bubble' to m_inputWindow2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TheEvent.IsTunneling);
   // Since this window intercepts the event, that also clears the handled state set by children
@@ -616,7 +616,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TransactionIsHandled);
 
   // Cancel tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[4].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[4].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[4].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[4].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[4].TransactionState, UI::EventTransactionState::Canceled);
@@ -624,7 +624,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[4].TransactionIsHandled);
 
   // Cancel bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[5].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[5].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[5].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[5].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[5].TransactionState, UI::EventTransactionState::Canceled);
@@ -660,7 +660,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   ASSERT_EQ(m_eventHandler.CallCount.HandleEvent, 6u);
 
   // The tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[0].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[0].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[0].TransactionState, UI::EventTransactionState::Begin);
@@ -668,7 +668,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[0].TransactionIsHandled);
 
   // The tunnel part 2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[1].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[1].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[1].TransactionState, UI::EventTransactionState::Begin);
@@ -676,7 +676,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[1].TransactionIsHandled);
 
   // The bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[2].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[2].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[2].TransactionState, UI::EventTransactionState::Begin);
@@ -685,7 +685,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
 
   // The bubble part 2
   // This is where the intercept occurs, so this will be followed by a 'tunnel cancel' + 'tunnel bubble' to m_inputWindow2
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[3].Window, m_nodeWindow1.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[3].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[3].TheEvent.IsTunneling);
   // Since this window intercepts the event, that also clears the handled state set by children
@@ -696,7 +696,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[3].TransactionIsHandled);
 
   // Cancel tunnel part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[4].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[4].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[4].TheEvent.Content, theEvent);
   EXPECT_TRUE(m_eventHandler.HandleEventCalls[4].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[4].TransactionState, UI::EventTransactionState::Canceled);
@@ -704,7 +704,7 @@ TEST_F(TestEventRouteClickInputIntercept, SendTo_Begin_TwoWindows_Pair_BubblePar
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[4].TransactionIsHandled);
 
   // Cancel bubble part 1
-  EXPECT_EQ(m_eventHandler.HandleEventCalls[5].Window, m_nodeWindow2);
+  EXPECT_EQ(m_eventHandler.HandleEventCalls[5].Window, m_nodeWindow2.get());
   EXPECT_EQ(m_eventHandler.HandleEventCalls[5].TheEvent.Content, theEvent);
   EXPECT_FALSE(m_eventHandler.HandleEventCalls[5].TheEvent.IsTunneling);
   EXPECT_EQ(m_eventHandler.HandleEventCalls[5].TransactionState, UI::EventTransactionState::Canceled);
@@ -34,7 +34,7 @@
 
 namespace Fsl::UI
 {
-  void UITreeEventHandlerTest::HandleEvent(const std::shared_ptr<TreeNode>& target, const RoutedEvent& routedEvent)
+  void UITreeEventHandlerTest::HandleEvent(TreeNode& rTarget, const RoutedEvent& routedEvent)
   {
     ++CallCount.HandleEvent;
     if (routedEvent.IsTunneling)
@@ -49,7 +49,7 @@ namespace Fsl::UI
     auto clickEvent = std::dynamic_pointer_cast<WindowInputClickEvent>(routedEvent.Content);
     if (clickEvent)
     {
-      auto itrFindIntercept = m_clickEventIntercept.find(target);
+      auto itrFindIntercept = m_clickEventIntercept.find(&rTarget);
       if (itrFindIntercept != m_clickEventIntercept.end())
       {
         if (routedEvent.IsTunneling == itrFindIntercept->second)
@@ -59,7 +59,7 @@ namespace Fsl::UI
       }
       if (clickEvent->GetState() == EventTransactionState::Begin && !clickEvent->IsRepeat())
       {
-        auto itrFindHandle = m_clickEventHandleBegin.find(target);
+        auto itrFindHandle = m_clickEventHandleBegin.find(&rTarget);
         if (itrFindHandle != m_clickEventHandleBegin.end())
         {
           if (routedEvent.IsTunneling == itrFindHandle->second)
@@ -75,17 +75,17 @@ namespace Fsl::UI
       routedEvent.Content->Handled();
     }
 
-    HandleEventCalls.emplace_back(target, routedEvent);
+    HandleEventCalls.emplace_back(&rTarget, routedEvent);
   }
 
   void UITreeEventHandlerTest::TestAddClickEventIntercept(const std::shared_ptr<TreeNode>& window, const bool tunnel)
   {
-    m_clickEventIntercept.emplace(window, tunnel);
+    m_clickEventIntercept.emplace(window.get(), tunnel);
   }
 
   bool UITreeEventHandlerTest::TestRemoveClickEventIntercept(const std::shared_ptr<TreeNode>& window)
   {
-    auto itrFind = m_clickEventIntercept.find(window);
+    auto itrFind = m_clickEventIntercept.find(window.get());
     if (itrFind == m_clickEventIntercept.end())
     {
       return false;
@@ -96,12 +96,12 @@ namespace Fsl::UI
 
   void UITreeEventHandlerTest::TestAddClickEventHandleBegin(const std::shared_ptr<TreeNode>& window, const bool tunnel)
   {
-    m_clickEventHandleBegin.emplace(window, tunnel);
+    m_clickEventHandleBegin.emplace(window.get(), tunnel);
   }
 
   bool UITreeEventHandlerTest::TestRemoveClickEventHandleBegin(const std::shared_ptr<TreeNode>& window)
   {
-    auto itrFind = m_clickEventHandleBegin.find(window);
+    auto itrFind = m_clickEventHandleBegin.find(window.get());
     if (itrFind == m_clickEventHandleBegin.end())
     {
       return false;
@@ -0,0 +1,58 @@
+#ifndef FSLSIMPLEUI_BASE_CONTROL_IVIRTUALIZINGITEMSOURCE_HPP
+#define FSLSIMPLEUI_BASE_CONTROL_IVIRTUALIZINGITEMSOURCE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <cstdint>
+#include <memory>
+
+namespace Fsl::UI
+{
+  class BaseWindow;
+
+  //! @brief Supplies the row windows of a VirtualizingList.
+  //!        The list only asks for as many containers as it needs to cover the visible rows (plus overscan) and then keeps reusing them,
+  //!        so a source normally keeps a typed vector of the containers it created indexed by containerIndex.
+  class IVirtualizingItemSource
+  {
+  public:
+    virtual ~IVirtualizingItemSource() = default;
+
+    //! @brief Create a new row container
+    //! @param containerIndex the index of the new container, containers are created in order (0, 1, 2, ...)
+    virtual std::shared_ptr<BaseWindow> CreateItemContainer(const uint32_t containerIndex) = 0;
+
+    //! @brief Bind the container to a item, this is called when a container is (re)used for a different item.
+    virtual void PrepareItemContainer(const uint32_t containerIndex, const uint32_t itemIndex) = 0;
+  };
+}
+
+#endif
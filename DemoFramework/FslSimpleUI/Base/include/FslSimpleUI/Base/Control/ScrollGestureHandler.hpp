@@ -105,6 +105,9 @@ namespace Fsl::UI
 
     void SetScrollMode(const ScrollModeFlags value) noexcept;
 
+    //! @brief Jump directly to the given scroll offset, this cancels any active drag or animation.
+    void SetScrollOffset(const PxPoint2 offsetPx);
+
     //! @brief update the animation
     //! @return true if the layout has been modified, false otherwise
     bool UpdateAnimation(const TimeSpan timeSpan, const ScrollGestureAnimationConfig& config);
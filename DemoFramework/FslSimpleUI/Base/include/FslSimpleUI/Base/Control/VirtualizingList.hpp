@@ -0,0 +1,209 @@
+#ifndef FSLSIMPLEUI_BASE_CONTROL_VIRTUALIZINGLIST_HPP
+#define FSLSIMPLEUI_BASE_CONTROL_VIRTUALIZINGLIST_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/Dp/DpSize1DF.hpp>
+#include <FslDataBinding/Base/Property/TypedDependencyProperty.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Base/Control/IVirtualizingItemSource.hpp>
+#include <FslSimpleUI/Base/Control/ScrollGestureHandler.hpp>
+#include <FslSimpleUI/Base/WindowCollection/GenericWindowCollection.hpp>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace Fsl::UI
+{
+  //! @brief A vertical scrolling list that only realizes the rows that are visible (plus a few overscan rows).
+  //!        The row windows are supplied by a IVirtualizingItemSource and are recycled as the list scrolls, so the number of windows in the
+  //!        tree is bounded by the view height and not the item count.
+  //!        If ItemHeight > 0 all rows use that height, otherwise the rows are measured once realized and EstimatedItemHeight is used for the
+  //!        rows that have not been measured yet.
+  //! @note  The containers are realized during the resolve phase, so a viewport resize is reflected in the realized rows on the next frame.
+  class VirtualizingList final : public BaseWindow
+  {
+    using base_type = BaseWindow;
+
+    static constexpr uint32_t InvalidIndex = std::numeric_limits<uint32_t>::max();
+
+    struct ContainerRecord : GenericWindowCollectionRecordBase
+    {
+      uint32_t ItemIndex{InvalidIndex};
+
+      explicit ContainerRecord(std::shared_ptr<BaseWindow> window)
+        : GenericWindowCollectionRecordBase(std::move(window))
+      {
+      }
+    };
+
+    struct ItemRange
+    {
+      uint32_t Begin{0};
+      uint32_t End{0};
+
+      constexpr bool operator==(const ItemRange& rhs) const noexcept = default;
+    };
+
+    ScrollGestureHandler m_gestureHandler;
+    GenericWindowCollection<ContainerRecord> m_containers;
+    std::shared_ptr<IVirtualizingItemSource> m_itemSource;
+
+    DataBinding::TypedDependencyProperty<uint32_t> m_propertyItemCount;
+    DataBinding::TypedDependencyProperty<DpSize1DF> m_propertyItemHeightDp;
+    DataBinding::TypedDependencyProperty<DpSize1DF> m_propertyEstimatedItemHeightDp;
+    DataBinding::TypedDependencyProperty<uint32_t> m_propertyOverscanCount;
+
+    //! The items that currently have a container
+    ItemRange m_realized;
+    //! Force all containers to be prepared again on the next resolve
+    bool m_realizeDirty{true};
+    //! m_realizedContainers[itemIndex - m_realized.Begin] == container index (or InvalidIndex)
+    std::vector<uint32_t> m_realizedContainers;
+    std::vector<uint32_t> m_scratchFreeContainers;
+
+    //! Measured height per item, zero means not measured (only used for variable height rows)
+    std::vector<int32_t> m_measuredHeightsPx;
+    //! The top offset per item (and the total height as the last entry), only valid up to m_offsetsDirtyFrom
+    std::vector<int32_t> m_itemOffsetsPx;
+    uint32_t m_offsetsDirtyFrom{0};
+
+    PxPoint2 m_scrollOffsetPx;
+
+  public:
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyItemCount;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyItemHeight;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyEstimatedItemHeight;
+    // NOLINTNEXTLINE(readability-identifier-naming)
+    static DataBinding::DependencyPropertyDefinition PropertyOverscanCount;
+
+    explicit VirtualizingList(const std::shared_ptr<BaseWindowContext>& context);
+
+    void WinInit() final;
+    void WinResolutionChanged(const ResolutionChangedInfo& info) final;
+    void WinResolve(const TimeSpan& timespan) final;
+
+    const std::shared_ptr<IVirtualizingItemSource>& GetItemSource() const noexcept
+    {
+      return m_itemSource;
+    }
+
+    //! @brief Change the item source, this closes all existing containers.
+    void SetItemSource(const std::shared_ptr<IVirtualizingItemSource>& value);
+
+    uint32_t GetItemCount() const noexcept
+    {
+      return m_propertyItemCount.Get();
+    }
+
+    bool SetItemCount(const uint32_t value);
+
+    DpSize1DF GetItemHeight() const noexcept
+    {
+      return m_propertyItemHeightDp.Get();
+    }
+
+    //! @brief Set a fixed row height, zero enables variable height rows.
+    bool SetItemHeight(const DpSize1DF value);
+
+    DpSize1DF GetEstimatedItemHeight() const noexcept
+    {
+      return m_propertyEstimatedItemHeightDp.Get();
+    }
+
+    bool SetEstimatedItemHeight(const DpSize1DF value);
+
+    uint32_t GetOverscanCount() const noexcept
+    {
+      return m_propertyOverscanCount.Get();
+    }
+
+    bool SetOverscanCount(const uint32_t value);
+
+    //! @brief Prepare all realized containers again and forget all measured row heights (call this when the item data changed).
+    void InvalidateItems();
+
+    //! @brief Scroll so the given item is at the top of the view (or as close as the content allows)
+    void ScrollToItem(const uint32_t itemIndex);
+
+    //! @brief The number of containers that was created by the item source
+    uint32_t GetContainerCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_containers.size());
+    }
+
+    //! @brief The first item that has a container
+    uint32_t GetRealizedBegin() const noexcept
+    {
+      return m_realized.Begin;
+    }
+
+    //! @brief One past the last item that has a container
+    uint32_t GetRealizedEnd() const noexcept
+    {
+      return m_realized.End;
+    }
+
+  protected:
+    void OnClickInput(const std::shared_ptr<WindowInputClickEvent>& theEvent) final;
+    void OnPropertiesUpdated(const PropertyTypeFlags& flags) final;
+
+    void UpdateAnimation(const TimeSpan& timeSpan) final;
+    bool UpdateAnimationState(const bool forceCompleteAnimation) final;
+    PxSize2D MeasureOverride(const PxAvailableSize& availableSizePx) final;
+    PxSize2D ArrangeOverride(const PxSize2D& finalSizePx) final;
+
+    DataBinding::DataBindingInstanceHandle TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef) final;
+    DataBinding::PropertySetBindingResult TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                           const DataBinding::Binding& binding) final;
+    void ExtractAllProperties(DataBinding::DependencyPropertyDefinitionVector& rProperties) final;
+
+  private:
+    bool IsFixedItemHeight() const noexcept
+    {
+      return m_propertyItemHeightDp.Get().RawValue() > 0.0f;
+    }
+
+    void ResetItemHeights();
+    void RebuildItemOffsets();
+    PxValue GetItemTopPx(const uint32_t itemIndex);
+    PxSize1D GetItemHeightPx(const uint32_t itemIndex) const;
+    PxSize1D GetContentHeightPx();
+    uint32_t FindItemAt(const PxValue positionPx);
+    ItemRange CalcRealizeRange(const PxValue scrollPositionPx, const PxSize1D viewHeightPx);
+    void Realize(const ItemRange range);
+  };
+}
+
+#endif
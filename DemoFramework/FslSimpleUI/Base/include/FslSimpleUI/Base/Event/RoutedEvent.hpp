@@ -37,11 +37,19 @@
 
 namespace Fsl::UI
 {
+  //! @brief A event that is being routed through the tree.
+  //! @note  The routed event only references the senders shared_ptr's so passing it from hop to hop never touches the reference counts,
+  //!        this also means that it must not outlive the send call that created it.
   struct RoutedEvent
   {
-    const std::shared_ptr<WindowEvent> Content;
+    const std::shared_ptr<WindowEvent>& Content;
     const bool IsTunneling;
 
+  private:
+    //! Points to a std::shared_ptr<TEvent> where TEvent::TypeId == Content->GetEventTypeId() (or nullptr if no typed content was supplied)
+    const void* m_pTypedContent{nullptr};
+
+  public:
     RoutedEvent(const std::shared_ptr<WindowEvent>& theEvent, const bool isTunneling)
       : Content(theEvent)
       , IsTunneling(isTunneling)
@@ -51,6 +59,49 @@ namespace Fsl::UI
         throw std::invalid_argument("event cant be null");
       }
     }
+
+    //! @brief Create a routed event that also provides direct access to the concrete event type
+    //! @param typedContent a shared_ptr to the concrete event type that points to the same event as theEvent
+    template <typename TEvent>
+    RoutedEvent(const std::shared_ptr<WindowEvent>& theEvent, const std::shared_ptr<TEvent>& typedContent, const bool isTunneling)
+      : RoutedEvent(theEvent, isTunneling)
+    {
+      if (theEvent->GetEventTypeId() != TEvent::TypeId || theEvent.get() != typedContent.get())
+      {
+        throw std::invalid_argument("typedContent does not match the event");
+      }
+      m_pTypedContent = &typedContent;
+    }
+
+    //! @brief Create a routed event for the same content but with a different routing direction
+    RoutedEvent(const RoutedEvent& other, const bool isTunneling) noexcept
+      : Content(other.Content)
+      , IsTunneling(isTunneling)
+      , m_pTypedContent(other.m_pTypedContent)
+    {
+    }
+
+    // The routed event only references the event so binding it to a temporary would leave it dangling
+    RoutedEvent(std::shared_ptr<WindowEvent>&& theEvent, const bool isTunneling) = delete;
+    template <typename TEvent>
+    RoutedEvent(const std::shared_ptr<WindowEvent>& theEvent, std::shared_ptr<TEvent>&& typedContent, const bool isTunneling) = delete;
+    template <typename TEvent>
+    RoutedEvent(std::shared_ptr<WindowEvent>&& theEvent, const std::shared_ptr<TEvent>& typedContent, const bool isTunneling) = delete;
+
+    RoutedEvent(const RoutedEvent&) noexcept = default;
+    RoutedEvent& operator=(const RoutedEvent&) = delete;
+
+    //! @brief Get the content as its concrete event type without touching the reference count
+    //! @throws UsageErrorException if the content is not of the requested type or if the typed content was not supplied.
+    template <typename TEvent>
+    const std::shared_ptr<TEvent>& GetContentAs() const
+    {
+      if (Content->GetEventTypeId() != TEvent::TypeId || m_pTypedContent == nullptr)
+      {
+        throw UsageErrorException("The event content is not of the requested type");
+      }
+      return *static_cast<const std::shared_ptr<TEvent>*>(m_pTypedContent);
+    }
   };
 }
 
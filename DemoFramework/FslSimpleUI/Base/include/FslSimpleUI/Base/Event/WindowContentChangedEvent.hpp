@@ -44,6 +44,9 @@ namespace Fsl::UI
     int32_t m_param2;
 
   public:
+    //! The event type id of this event class
+    static constexpr EventTypeId TypeId = EventTypeId::ContentChanged;
+
     WindowContentChangedEvent() noexcept;
 
     uint32_t GetContentId() const noexcept;
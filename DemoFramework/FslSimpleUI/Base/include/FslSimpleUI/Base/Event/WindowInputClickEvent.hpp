@@ -41,6 +41,9 @@ namespace Fsl::UI
     PxPoint2 m_screenPositionPx;
 
   public:
+    //! The event type id of this event class
+    static constexpr EventTypeId TypeId = EventTypeId::InputClick;
+
     WindowInputClickEvent();
 
     //! @brief Return the screen position in pixels.
@@ -41,8 +41,11 @@ namespace Fsl::UI
     PxPoint2 m_screenPositionPx;
 
   public:
+    //! The event type id of this event class
+    static constexpr EventTypeId TypeId = EventTypeId::MouseOver;
+
     WindowMouseOverEvent() noexcept
-      : WindowTransactionEvent(EventTypeId::MouseOver, EventDescription(EventRoutingStrategy::Bubble, WindowFlags::MouseOver))
+      : WindowTransactionEvent(TypeId, EventDescription(EventRoutingStrategy::Bubble, WindowFlags::MouseOver))
     {
     }
 
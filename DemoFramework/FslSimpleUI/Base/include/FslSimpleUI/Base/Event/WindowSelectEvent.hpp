@@ -43,6 +43,9 @@ namespace Fsl::UI
     std::shared_ptr<ITag> m_payload;
 
   public:
+    //! The event type id of this event class
+    static constexpr EventTypeId TypeId = EventTypeId::Select;
+
     WindowSelectEvent() noexcept;
 
     uint32_t GetContentId() const noexcept
@@ -44,13 +44,12 @@ namespace Fsl::UI
     virtual ~IEventHandler() = default;
 
     //! @brief Called to ask the window to handle the event
-    //! @param target the target node
+    //! @param rTarget the target node
     //! @param routedEvent the event to send
-    //! @throws UsageErrorException if target is null.
     //! @throws UsageErrorException if the target isn't part of the tree.
     //! @throws UsageErrorException if the target isn't in the running state.
     //! @throws UsageErrorException if this method is called from a unexpected context.
-    virtual void HandleEvent(const std::shared_ptr<TreeNode>& target, const RoutedEvent& routedEvent) = 0;
+    virtual void HandleEvent(TreeNode& rTarget, const RoutedEvent& routedEvent) = 0;
   };
 }
 
@@ -75,17 +75,6 @@ namespace Fsl::UI
 {
   namespace
   {
-    template <typename T, typename Y>
-    inline std::shared_ptr<T> SafeDynamicPointerCast(const std::shared_ptr<Y>& ptr)
-    {
-      auto converted = std::dynamic_pointer_cast<T>(ptr);
-      if (!converted)
-      {
-        throw UsageErrorException("Internal error the object is not of the expected type");
-      }
-      return converted;
-    }
-
     inline constexpr PxAvailableSize1D ToPxAvailableSize1D(const SpriteUnitConverter& unitConverter, const DpLayoutSize1D valueDp) noexcept
     {
       return valueDp.HasValue() ? PxAvailableSize1D::UncheckedCreate(static_cast<int32_t>(std::round(unitConverter.ToPxRawFloat(valueDp.Value()))))
@@ -133,7 +122,7 @@ namespace Fsl::UI
     {
     case EventTypeId::InputClick:
       {
-        auto event = SafeDynamicPointerCast<WindowInputClickEvent>(routedEvent.Content);
+        const auto& event = routedEvent.GetContentAs<WindowInputClickEvent>();
         if (routedEvent.IsTunneling)
         {
           OnClickInputPreview(event);
@@ -146,7 +135,7 @@ namespace Fsl::UI
       }
     case EventTypeId::MouseOver:
       {
-        auto event = SafeDynamicPointerCast<WindowMouseOverEvent>(routedEvent.Content);
+        const auto& event = routedEvent.GetContentAs<WindowMouseOverEvent>();
         if (routedEvent.IsTunneling)
         {
           OnMouseOverPreview(event);
@@ -159,14 +148,14 @@ namespace Fsl::UI
       }
     case EventTypeId::Select:
       {
-        auto event = SafeDynamicPointerCast<WindowSelectEvent>(routedEvent.Content);
+        const auto& event = routedEvent.GetContentAs<WindowSelectEvent>();
         assert(!routedEvent.IsTunneling);
         OnSelect(event);
         break;
       }
     case EventTypeId::ContentChanged:
       {
-        auto event = SafeDynamicPointerCast<WindowContentChangedEvent>(routedEvent.Content);
+        const auto& event = routedEvent.GetContentAs<WindowContentChangedEvent>();
         assert(!routedEvent.IsTunneling);
         OnContentChanged(event);
         break;
@@ -228,6 +228,16 @@ namespace Fsl::UI
   }
 
 
+  void ScrollGestureHandler::SetScrollOffset(const PxPoint2 offsetPx)
+  {
+    TryCancelDrag();
+    m_animRecord.Status = AnimStatus::Idle;
+    m_animRecord.Anim.SetActualValue({});
+    // The next arrange will start a bounce animation if the offset is outside the scrollable area
+    m_scrollOffsetPx = ApplyScrollMode(m_scrollMode, offsetPx);
+  }
+
+
   bool ScrollGestureHandler::UpdateAnimation(const TimeSpan timeSpan, const ScrollGestureAnimationConfig& config)
   {
     m_config = config;
@@ -0,0 +1,577 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
+#include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include <FslSimpleUI/Base/BaseWindowContext.hpp>
+#include <FslSimpleUI/Base/Control/ScrollGestureAnimationConfig.hpp>
+#include <FslSimpleUI/Base/Control/VirtualizingList.hpp>
+#include <FslSimpleUI/Base/Event/WindowInputClickEvent.hpp>
+#include <FslSimpleUI/Base/MovementOwnership.hpp>
+#include <FslSimpleUI/Base/MovementTransactionAction.hpp>
+#include <FslSimpleUI/Base/PropertyTypeFlags.hpp>
+#include <FslSimpleUI/Base/ResolutionChangedInfo.hpp>
+#include <FslSimpleUI/Base/WindowContext.hpp>
+#include <algorithm>
+#include <cassert>
+
+namespace Fsl::UI
+{
+  using TClass = VirtualizingList;
+  using TDef = DataBinding::DependencyPropertyDefinition;
+  using TFactory = DataBinding::DependencyPropertyDefinitionFactory;
+
+  TDef TClass::PropertyItemCount = TFactory::Create<uint32_t, TClass, &TClass::GetItemCount, &TClass::SetItemCount>("ItemCount");
+  TDef TClass::PropertyItemHeight = TFactory::Create<DpSize1DF, TClass, &TClass::GetItemHeight, &TClass::SetItemHeight>("ItemHeight");
+  TDef TClass::PropertyEstimatedItemHeight =
+    TFactory::Create<DpSize1DF, TClass, &TClass::GetEstimatedItemHeight, &TClass::SetEstimatedItemHeight>("EstimatedItemHeight");
+  TDef TClass::PropertyOverscanCount = TFactory::Create<uint32_t, TClass, &TClass::GetOverscanCount, &TClass::SetOverscanCount>("OverscanCount");
+}
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      // The scroll animation uses the ScrollViewer defaults
+      constexpr float DragFlickDeceleration = 200.0f;    //  x*100 dp per second
+      constexpr float DragEndAnimTimeMultiplier = 4;
+      constexpr float SpringStiffness = 5.0f;
+      constexpr TimeSpan BounceTime(TimeSpan::FromMilliseconds(1000));
+      constexpr TransitionType DragFlickTransitionType = TransitionType::EaseOutSine;
+      constexpr TransitionType BounceTransitionType = TransitionType::EaseInOutQuad;
+
+      constexpr DpSize1DF DefaultEstimatedItemHeight = DpSize1DF::Create(32.0f);
+      constexpr uint32_t DefaultOverscanCount = 2;
+    }
+
+    constexpr MovementOwnership ToMovementOwnership(EventHandlingStatus handlingStatus) noexcept
+    {
+      switch (handlingStatus)
+      {
+      case EventHandlingStatus::Unhandled:
+        return MovementOwnership::Unhandled;
+      case EventHandlingStatus::Handled:
+        return MovementOwnership::Handled;
+      case EventHandlingStatus::Claimed:
+        return MovementOwnership::HandledAndControlled;
+      }
+      FSLLOG3_WARNING("unknown handling status");
+      return MovementOwnership::HandledAndControlled;
+    }
+
+    constexpr int32_t ClampToInt32(const int64_t value) noexcept
+    {
+      return static_cast<int32_t>(std::min(value, static_cast<int64_t>(std::numeric_limits<int32_t>::max())));
+    }
+  }
+
+
+  VirtualizingList::VirtualizingList(const std::shared_ptr<BaseWindowContext>& context)
+    : BaseWindow(context)
+    , m_gestureHandler(context->UnitConverter.GetDensityDpi())
+    , m_propertyEstimatedItemHeightDp(LocalConfig::DefaultEstimatedItemHeight)
+    , m_propertyOverscanCount(LocalConfig::DefaultOverscanCount)
+  {
+    SetAlignmentX(ItemAlignment::Stretch);
+    SetAlignmentY(ItemAlignment::Stretch);
+    m_gestureHandler.SetScrollMode(ScrollModeFlags::TranslateY);
+    ResetItemHeights();
+
+    Enable(WindowFlags(WindowFlags::ClickInput | WindowFlags::ResolveEnabled | WindowFlags::ClipEnabled));
+  }
+
+
+  void VirtualizingList::WinInit()
+  {
+    base_type::WinInit();
+
+    auto uiContext = GetContext()->TheUIContext.Get();
+    m_containers.SYS_WinInit(this, uiContext->WindowManager);
+  }
+
+
+  void VirtualizingList::WinResolutionChanged(const ResolutionChangedInfo& info)
+  {
+    base_type::WinResolutionChanged(info);
+
+    m_gestureHandler.ConfigurationChanged(info.DensityDpi);
+    // The cached heights are in pixels
+    ResetItemHeights();
+  }
+
+
+  void VirtualizingList::WinResolve(const TimeSpan& timespan)
+  {
+    base_type::WinResolve(timespan);
+
+    // Containers can not be added or modified during the layout, so we realize the rows for this frame now based on the last known view size.
+    // The gesture handler has already received all input for this frame so the scroll position calculated here matches the one used by the
+    // layout.
+    const PxSize2D viewSizePx = RenderSizePx();
+    ItemRange range;
+    if (m_itemSource && viewSizePx.Height() > PxSize1D())
+    {
+      const PxPoint2 offsetPx = m_gestureHandler.Arrange(viewSizePx, PxSize2D(viewSizePx.Width(), GetContentHeightPx()));
+      range = CalcRealizeRange(-offsetPx.Y, viewSizePx.Height());
+    }
+    if (range != m_realized || m_realizeDirty)
+    {
+      Realize(range);
+      PropertyUpdated(PropertyType::Layout);
+    }
+  }
+
+
+  void VirtualizingList::SetItemSource(const std::shared_ptr<IVirtualizingItemSource>& value)
+  {
+    if (value != m_itemSource)
+    {
+      m_containers.Clear();
+      m_itemSource = value;
+      m_realized = {};
+      m_realizeDirty = true;
+      ResetItemHeights();
+      PropertyUpdated(PropertyType::Layout);
+    }
+  }
+
+
+  bool VirtualizingList::SetItemCount(const uint32_t value)
+  {
+    const uint32_t oldCount = m_propertyItemCount.Get();
+    const bool changed = m_propertyItemCount.Set(ThisDependencyObject(), value);
+    if (changed)
+    {
+      if (!IsFixedItemHeight())
+      {
+        // Keep the measurements of the items that still exist
+        m_measuredHeightsPx.resize(value, 0);
+        m_itemOffsetsPx.resize(value + 1u, 0);
+        m_offsetsDirtyFrom = std::min(m_offsetsDirtyFrom, std::min(oldCount, value));
+      }
+      PropertyUpdated(PropertyType::Layout);
+    }
+    return changed;
+  }
+
+
+  bool VirtualizingList::SetItemHeight(const DpSize1DF value)
+  {
+    const bool changed = m_propertyItemHeightDp.Set(ThisDependencyObject(), value);
+    if (changed)
+    {
+      ResetItemHeights();
+      PropertyUpdated(PropertyType::Layout);
+    }
+    return changed;
+  }
+
+
+  bool VirtualizingList::SetEstimatedItemHeight(const DpSize1DF value)
+  {
+    const bool changed = m_propertyEstimatedItemHeightDp.Set(ThisDependencyObject(), value);
+    if (changed)
+    {
+      m_offsetsDirtyFrom = 0;
+      PropertyUpdated(PropertyType::Layout);
+    }
+    return changed;
+  }
+
+
+  bool VirtualizingList::SetOverscanCount(const uint32_t value)
+  {
+    const bool changed = m_propertyOverscanCount.Set(ThisDependencyObject(), value);
+    if (changed)
+    {
+      PropertyUpdated(PropertyType::Layout);
+    }
+    return changed;
+  }
+
+
+  void VirtualizingList::InvalidateItems()
+  {
+    m_realizeDirty = true;
+    ResetItemHeights();
+    PropertyUpdated(PropertyType::Layout);
+  }
+
+
+  void VirtualizingList::ScrollToItem(const uint32_t itemIndex)
+  {
+    const uint32_t itemCount = m_propertyItemCount.Get();
+    if (itemCount == 0)
+    {
+      return;
+    }
+    const PxValue itemTopPx = GetItemTopPx(std::min(itemIndex, itemCount - 1u));
+    const PxValue maxScrollPx = GetContentHeightPx() - RenderSizePx().Height();
+    const PxValue scrollPx = std::max(std::min(itemTopPx, maxScrollPx), PxValue(0));
+    m_gestureHandler.SetScrollOffset(PxPoint2(PxValue(0), -scrollPx));
+    PropertyUpdated(PropertyType::Layout);
+  }
+
+
+  void VirtualizingList::OnClickInput(const std::shared_ptr<WindowInputClickEvent>& theEvent)
+  {
+    base_type::OnClickInput(theEvent);
+
+    const auto localPositionPx = PointFromScreen(theEvent->GetScreenPosition());
+
+    const MovementOwnership movementOwnerShip = ToMovementOwnership(theEvent->GetHandlingStatus());
+    const MovementTransactionAction result =
+      m_gestureHandler.AddMovement(theEvent->GetTimestamp(), localPositionPx, theEvent->GetState(), theEvent->IsRepeat(), movementOwnerShip);
+
+    switch (result)
+    {
+    case MovementTransactionAction::NotInterested:
+    case MovementTransactionAction::Evaluate:
+      break;
+    case MovementTransactionAction::Handle:
+      // Flagging a already handled event as handled is fine
+      theEvent->Handled();
+      break;
+    case MovementTransactionAction::Control:
+      // Flagging a already handled event as handled is fine
+      theEvent->Claimed();
+      break;
+    case MovementTransactionAction::InterceptAndControl:
+      // The intercept clears the handled state, so claim it right away
+      theEvent->Intercept();
+      theEvent->Claimed();
+      break;
+    }
+  }
+
+
+  void VirtualizingList::OnPropertiesUpdated(const PropertyTypeFlags& flags)
+  {
+    base_type::OnPropertiesUpdated(flags);
+    if (flags.IsFlagged(PropertyType::BaseColor))
+    {
+      for (auto itr = m_containers.begin(); itr != m_containers.end(); ++itr)
+      {
+        itr->Window->SYS_SetParentBaseColor(GetFinalBaseColor());
+      }
+    }
+  }
+
+
+  void VirtualizingList::UpdateAnimation(const TimeSpan& timeSpan)
+  {
+    base_type::UpdateAnimation(timeSpan);
+
+    const ScrollGestureAnimationConfig animConfig(DpValueF(LocalConfig::DragFlickDeceleration * 100), LocalConfig::DragFlickTransitionType,
+                                                  LocalConfig::DragEndAnimTimeMultiplier,
+                                                  Vector2(LocalConfig::SpringStiffness, LocalConfig::SpringStiffness), LocalConfig::BounceTime,
+                                                  LocalConfig::BounceTransitionType);
+    if (m_gestureHandler.UpdateAnimation(timeSpan, animConfig))
+    {
+      PropertyUpdated(PropertyType::Layout);
+    }
+  }
+
+
+  bool VirtualizingList::UpdateAnimationState(const bool forceCompleteAnimation)
+  {
+    return m_gestureHandler.UpdateAnimationState(forceCompleteAnimation);
+  }
+
+
+  PxSize2D VirtualizingList::MeasureOverride(const PxAvailableSize& availableSizePx)
+  {
+    const bool isFixedHeight = IsFixedItemHeight();
+    const PxAvailableSize1D itemAvailableHeightPx =
+      isFixedHeight ? PxAvailableSize1D(GetItemHeightPx(0)) : PxAvailableSize1D(PxAvailableSize1D::InfiniteSpacePx());
+    const PxAvailableSize itemAvailableSizePx(availableSizePx.Width(), itemAvailableHeightPx);
+
+    PxSize1D maxWidthPx;
+    // The item count might have been reduced since the rows were realized
+    const uint32_t realizedEnd = std::min(m_realized.End, m_propertyItemCount.Get());
+    for (uint32_t itemIndex = m_realized.Begin; itemIndex < realizedEnd; ++itemIndex)
+    {
+      const uint32_t containerIndex = m_realizedContainers[itemIndex - m_realized.Begin];
+      if (containerIndex != InvalidIndex)
+      {
+        BaseWindow& rWindow = *m_containers.ChildAt(containerIndex);
+        rWindow.Measure(itemAvailableSizePx);
+        const PxSize2D desiredSizePx = rWindow.DesiredSizePx();
+        maxWidthPx = PxSize1D::Max(maxWidthPx, desiredSizePx.Width());
+        if (!isFixedHeight)
+        {
+          // A zero height would be treated as 'unknown' so a empty row is stored as one pixel
+          const int32_t heightPx = std::max(desiredSizePx.RawHeight(), 1);
+          if (m_measuredHeightsPx[itemIndex] != heightPx)
+          {
+            m_measuredHeightsPx[itemIndex] = heightPx;
+            m_offsetsDirtyFrom = std::min(m_offsetsDirtyFrom, itemIndex + 1u);
+          }
+        }
+      }
+    }
+    return PxAvailableSize::MinPxSize2D(PxSize2D(maxWidthPx, GetContentHeightPx()), availableSizePx);
+  }
+
+
+  PxSize2D VirtualizingList::ArrangeOverride(const PxSize2D& finalSizePx)
+  {
+    const PxPoint2 offsetPx = m_gestureHandler.Arrange(finalSizePx, PxSize2D(finalSizePx.Width(), GetContentHeightPx()));
+    m_scrollOffsetPx = offsetPx;
+
+    const uint32_t realizedEnd = std::min(m_realized.End, m_propertyItemCount.Get());
+    for (uint32_t itemIndex = m_realized.Begin; itemIndex < realizedEnd; ++itemIndex)
+    {
+      const uint32_t containerIndex = m_realizedContainers[itemIndex - m_realized.Begin];
+      if (containerIndex != InvalidIndex)
+      {
+        const PxValue itemTopPx = GetItemTopPx(itemIndex) + offsetPx.Y;
+        m_containers.ChildAt(containerIndex)->Arrange(PxRectangle(PxValue(0), itemTopPx, finalSizePx.Width(), GetItemHeightPx(itemIndex)));
+      }
+    }
+    return finalSizePx;
+  }
+
+
+  void VirtualizingList::ResetItemHeights()
+  {
+    m_measuredHeightsPx.clear();
+    m_itemOffsetsPx.clear();
+    if (!IsFixedItemHeight())
+    {
+      const uint32_t itemCount = m_propertyItemCount.Get();
+      m_measuredHeightsPx.resize(itemCount, 0);
+      m_itemOffsetsPx.resize(itemCount + 1u, 0);
+    }
+    m_offsetsDirtyFrom = 0;
+  }
+
+
+  void VirtualizingList::RebuildItemOffsets()
+  {
+    assert(!IsFixedItemHeight());
+    const uint32_t itemCount = m_propertyItemCount.Get();
+    if (m_offsetsDirtyFrom > itemCount)
+    {
+      return;
+    }
+    assert(m_measuredHeightsPx.size() == itemCount);
+    assert(m_itemOffsetsPx.size() == (itemCount + 1u));
+
+    const int32_t estimatedHeightPx = std::max(GetContext()->UnitConverter.ToPxSize1D(m_propertyEstimatedItemHeightDp.Get()).RawValue(), 1);
+    const int32_t* const pHeights = m_measuredHeightsPx.data();
+    int32_t* const pOffsets = m_itemOffsetsPx.data();
+
+    // Only the offsets after the first modified item needs to be recalculated
+    const uint32_t startIndex = std::max(m_offsetsDirtyFrom, 1u);
+    if (m_offsetsDirtyFrom == 0)
+    {
+      pOffsets[0] = 0;
+    }
+    int64_t offsetPx = pOffsets[startIndex - 1];
+    for (uint32_t i = startIndex; i <= itemCount; ++i)
+    {
+      const int32_t heightPx = pHeights[i - 1];
+      offsetPx += heightPx > 0 ? heightPx : estimatedHeightPx;
+      pOffsets[i] = ClampToInt32(offsetPx);
+    }
+    m_offsetsDirtyFrom = itemCount + 1u;
+  }
+
+
+  PxValue VirtualizingList::GetItemTopPx(const uint32_t itemIndex)
+  {
+    assert(itemIndex <= m_propertyItemCount.Get());
+    if (IsFixedItemHeight())
+    {
+      return PxValue(ClampToInt32(static_cast<int64_t>(itemIndex) * GetItemHeightPx(0).RawValue()));
+    }
+    RebuildItemOffsets();
+    return PxValue(m_itemOffsetsPx[itemIndex]);
+  }
+
+
+  PxSize1D VirtualizingList::GetItemHeightPx(const uint32_t itemIndex) const
+  {
+    const SpriteUnitConverter& unitConverter = GetContext()->UnitConverter;
+    if (IsFixedItemHeight())
+    {
+      return unitConverter.ToPxSize1D(m_propertyItemHeightDp.Get());
+    }
+    const int32_t heightPx = m_measuredHeightsPx[itemIndex];
+    return heightPx > 0 ? PxSize1D::UncheckedCreate(heightPx) : unitConverter.ToPxSize1D(m_propertyEstimatedItemHeightDp.Get());
+  }
+
+
+  PxSize1D VirtualizingList::GetContentHeightPx()
+  {
+    return PxSize1D(GetItemTopPx(m_propertyItemCount.Get()));
+  }
+
+
+  uint32_t VirtualizingList::FindItemAt(const PxValue positionPx)
+  {
+    const uint32_t itemCount = m_propertyItemCount.Get();
+    assert(itemCount > 0);
+    if (positionPx <= PxValue(0))
+    {
+      return 0;
+    }
+    if (IsFixedItemHeight())
+    {
+      const int32_t itemHeightPx = std::max(GetItemHeightPx(0).RawValue(), 1);
+      return std::min(static_cast<uint32_t>(positionPx.Value / itemHeightPx), itemCount - 1u);
+    }
+    RebuildItemOffsets();
+    // Find the first item that starts after the position, the item before it contains the position
+    const auto itrEnd = m_itemOffsetsPx.begin() + itemCount;
+    const auto itr = std::upper_bound(m_itemOffsetsPx.begin(), itrEnd, positionPx.Value);
+    return static_cast<uint32_t>(std::distance(m_itemOffsetsPx.begin(), itr)) - 1u;
+  }
+
+
+  VirtualizingList::ItemRange VirtualizingList::CalcRealizeRange(const PxValue scrollPositionPx, const PxSize1D viewHeightPx)
+  {
+    const uint32_t itemCount = m_propertyItemCount.Get();
+    if (itemCount == 0)
+    {
+      return {};
+    }
+    const uint32_t overscanCount = m_propertyOverscanCount.Get();
+    const uint32_t firstVisible = FindItemAt(scrollPositionPx);
+    const uint32_t lastVisible = FindItemAt(scrollPositionPx + viewHeightPx - PxValue(1));
+    const uint32_t begin = firstVisible - std::min(firstVisible, overscanCount);
+    const uint32_t end = lastVisible + 1u + std::min(itemCount - 1u - lastVisible, overscanCount);
+    return {begin, end};
+  }
+
+
+  void VirtualizingList::Realize(const ItemRange range)
+  {
+    assert(range.Begin <= range.End);
+    const uint32_t requiredCount = range.End - range.Begin;
+
+    // Grow the container pool (it never shrinks)
+    if (m_itemSource)
+    {
+      while (m_containers.size() < requiredCount)
+      {
+        auto window = m_itemSource->CreateItemContainer(static_cast<uint32_t>(m_containers.size()));
+        if (!window)
+        {
+          throw std::invalid_argument("CreateItemContainer can not return null");
+        }
+        m_containers.Add(window);
+        window->SYS_SetParentBaseColor(GetFinalBaseColor());
+      }
+    }
+
+    // Keep the containers that still show a item inside the range and release the rest
+    m_realizedContainers.assign(requiredCount, InvalidIndex);
+    m_scratchFreeContainers.clear();
+    uint32_t containerIndex = 0;
+    for (auto itr = m_containers.begin(); itr != m_containers.end(); ++itr, ++containerIndex)
+    {
+      if (!m_realizeDirty && itr->ItemIndex >= range.Begin && itr->ItemIndex < range.End)
+      {
+        m_realizedContainers[itr->ItemIndex - range.Begin] = containerIndex;
+      }
+      else
+      {
+        itr->ItemIndex = InvalidIndex;
+        m_scratchFreeContainers.push_back(containerIndex);
+      }
+    }
+
+    // Bind the free containers to the newly visible items
+    for (uint32_t itemIndex = range.Begin; itemIndex < range.End; ++itemIndex)
+    {
+      uint32_t& rContainerIndex = m_realizedContainers[itemIndex - range.Begin];
+      if (rContainerIndex == InvalidIndex)
+      {
+        assert(!m_scratchFreeContainers.empty());
+        rContainerIndex = m_scratchFreeContainers.back();
+        m_scratchFreeContainers.pop_back();
+
+        auto itrRecord = m_containers.begin() + rContainerIndex;
+        itrRecord->ItemIndex = itemIndex;
+        m_itemSource->PrepareItemContainer(rContainerIndex, itemIndex);
+        itrRecord->Window->SetVisibility(ItemVisibility::Visible);
+      }
+    }
+
+    // Hide the unused containers
+    for (const uint32_t index : m_scratchFreeContainers)
+    {
+      m_containers.ChildAt(index)->SetVisibility(ItemVisibility::Collapsed);
+    }
+    m_realized = range;
+    m_realizeDirty = false;
+  }
+
+
+  DataBinding::DataBindingInstanceHandle VirtualizingList::TryGetPropertyHandleNow(const DataBinding::DependencyPropertyDefinition& sourceDef)
+  {
+    auto res = DataBinding::DependencyObjectHelper::TryGetPropertyHandle(
+      this, ThisDependencyObject(), sourceDef, DataBinding::PropLinkRefs(PropertyItemCount, m_propertyItemCount),
+      DataBinding::PropLinkRefs(PropertyItemHeight, m_propertyItemHeightDp),
+      DataBinding::PropLinkRefs(PropertyEstimatedItemHeight, m_propertyEstimatedItemHeightDp),
+      DataBinding::PropLinkRefs(PropertyOverscanCount, m_propertyOverscanCount));
+    return res.IsValid() ? res : base_type::TryGetPropertyHandleNow(sourceDef);
+  }
+
+
+  DataBinding::PropertySetBindingResult VirtualizingList::TrySetBindingNow(const DataBinding::DependencyPropertyDefinition& targetDef,
+                                                                           const DataBinding::Binding& binding)
+  {
+    auto res = DataBinding::DependencyObjectHelper::TrySetBinding(
+      this, ThisDependencyObject(), targetDef, binding, DataBinding::PropLinkRefs(PropertyItemCount, m_propertyItemCount),
+      DataBinding::PropLinkRefs(PropertyItemHeight, m_propertyItemHeightDp),
+      DataBinding::PropLinkRefs(PropertyEstimatedItemHeight, m_propertyEstimatedItemHeightDp),
+      DataBinding::PropLinkRefs(PropertyOverscanCount, m_propertyOverscanCount));
+    return res != DataBinding::PropertySetBindingResult::NotFound ? res : base_type::TrySetBindingNow(targetDef, binding);
+  }
+
+
+  void VirtualizingList::ExtractAllProperties(DataBinding::DependencyPropertyDefinitionVector& rProperties)
+  {
+    base_type::ExtractAllProperties(rProperties);
+    rProperties.push_back(PropertyItemCount);
+    rProperties.push_back(PropertyItemHeight);
+    rProperties.push_back(PropertyEstimatedItemHeight);
+    rProperties.push_back(PropertyOverscanCount);
+  }
+}
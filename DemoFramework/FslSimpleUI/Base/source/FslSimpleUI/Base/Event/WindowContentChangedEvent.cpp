@@ -34,7 +34,7 @@
 namespace Fsl::UI
 {
   WindowContentChangedEvent::WindowContentChangedEvent() noexcept
-    : WindowEvent(EventTypeId::ContentChanged, EventDescription(EventRoutingStrategy::Bubble, WindowFlags()))
+    : WindowEvent(TypeId, EventDescription(EventRoutingStrategy::Bubble, WindowFlags()))
     , m_contentId(0)
     , m_param1(0)
     , m_param2(0)
@@ -34,7 +34,7 @@
 namespace Fsl::UI
 {
   WindowInputClickEvent::WindowInputClickEvent()
-    : WindowInputEvent(EventTypeId::InputClick, EventDescription(EventRoutingStrategy::Paired, WindowFlags(WindowFlags::ClickInput)))
+    : WindowInputEvent(TypeId, EventDescription(EventRoutingStrategy::Paired, WindowFlags(WindowFlags::ClickInput)))
 
   {
   }
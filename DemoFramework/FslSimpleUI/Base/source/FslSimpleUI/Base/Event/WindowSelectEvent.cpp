@@ -34,7 +34,7 @@
 namespace Fsl::UI
 {
   WindowSelectEvent::WindowSelectEvent() noexcept
-    : WindowEvent(EventTypeId::Select, EventDescription(EventRoutingStrategy::Bubble, WindowFlags()))
+    : WindowEvent(TypeId, EventDescription(EventRoutingStrategy::Bubble, WindowFlags()))
     , m_contentId(0)
 
   {
@@ -34,7 +34,11 @@
 #include <FslBase/Log/Log3Fmt.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslSimpleUI/Base/Event/RoutedEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowContentChangedEvent.hpp>
 #include <FslSimpleUI/Base/Event/WindowEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowInputClickEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowMouseOverEvent.hpp>
+#include <FslSimpleUI/Base/Event/WindowSelectEvent.hpp>
 #include <FslSimpleUI/Base/Event/WindowTransactionEvent.hpp>
 #include <FslSimpleUI/Base/System/Event/IEventHandler.hpp>
 #include <algorithm>
@@ -48,15 +52,15 @@ namespace Fsl::UI
   {
     constexpr std::size_t InitialNodeCapacity = 32u;
 
-    inline bool Exists(const std::vector<std::shared_ptr<TreeNode>>& nodes, const std::shared_ptr<TreeNode>& node)
+    inline bool Exists(const std::vector<TreeNode*>& nodes, const TreeNode* const pNode)
     {
-      return std::find(nodes.begin(), nodes.end(), node) != nodes.end();
+      return std::find(nodes.begin(), nodes.end(), pNode) != nodes.end();
     }
 
 
-    inline bool Remove(std::vector<std::shared_ptr<TreeNode>>& rNodes, const std::shared_ptr<TreeNode>& node)
+    inline bool Remove(std::vector<TreeNode*>& rNodes, const TreeNode* const pNode)
     {
-      auto itr = std::find(rNodes.begin(), rNodes.end(), node);
+      auto itr = std::find(rNodes.begin(), rNodes.end(), pNode);
       const bool found = itr != rNodes.end();
       if (found)
       {
@@ -67,52 +71,51 @@ namespace Fsl::UI
 
     //------------------------------------------------------------------------------------------------------------------------------------------------
 
-    void SendCancelEventsViaTunnel(IEventHandler& eventHandler, ReadOnlySpan<std::shared_ptr<TreeNode>> nodeSpan,
-                                   const std::shared_ptr<WindowTransactionEvent>& theEvent)
+    void SendCancelEventsViaTunnel(IEventHandler& eventHandler, ReadOnlySpan<TreeNode*> nodeSpan, const RoutedEvent& sourceEvent,
+                                   WindowTransactionEvent& rTransactionEvent)
     {
-      RoutedEvent routedEvent(theEvent, true);
-      Internal::ScopedWindowTransactionEventPatch scopedStateChange(*theEvent, EventTransactionState::Canceled, false, false);
-      for (const auto& entry : nodeSpan)
+      const RoutedEvent routedEvent(sourceEvent, true);
+      Internal::ScopedWindowTransactionEventPatch scopedStateChange(rTransactionEvent, EventTransactionState::Canceled, false, false);
+      for (TreeNode* const pEntry : nodeSpan)
       {
-        if (entry->IsConsideredRunning())
+        if (pEntry->IsConsideredRunning())
         {
-          eventHandler.HandleEvent(entry, routedEvent);
+          eventHandler.HandleEvent(*pEntry, routedEvent);
         }
       }
     }
 
     //------------------------------------------------------------------------------------------------------------------------------------------------
 
-    void SendCancelEventsViaBubble(IEventHandler& eventHandler, ReadOnlySpan<std::shared_ptr<TreeNode>> nodeSpan,
-                                   const std::shared_ptr<WindowTransactionEvent>& theEvent)
+    void SendCancelEventsViaBubble(IEventHandler& eventHandler, ReadOnlySpan<TreeNode*> nodeSpan, const RoutedEvent& sourceEvent,
+                                   WindowTransactionEvent& rTransactionEvent)
     {
-      RoutedEvent routedEvent(theEvent, false);
-      Internal::ScopedWindowTransactionEventPatch scopedStateChange(*theEvent, EventTransactionState::Canceled, false, false);
+      const RoutedEvent routedEvent(sourceEvent, false);
+      Internal::ScopedWindowTransactionEventPatch scopedStateChange(rTransactionEvent, EventTransactionState::Canceled, false, false);
       // Temporarily patch the event so it becomes a cancel event
       for (std::size_t i = nodeSpan.size(); i > 0; --i)
       {
-        const auto& entry = nodeSpan[i - 1u];
-        if (entry->IsConsideredRunning())
+        TreeNode* const pEntry = nodeSpan[i - 1u];
+        if (pEntry->IsConsideredRunning())
         {
-          eventHandler.HandleEvent(entry, routedEvent);
+          eventHandler.HandleEvent(*pEntry, routedEvent);
         }
       }
     }
 
-    void SendToViaTunnel(IEventHandler& eventHandler, std::vector<std::shared_ptr<TreeNode>>& rNodes, const RoutedEvent& routedEvent,
-                         const bool paired)
+    void SendToViaTunnel(IEventHandler& eventHandler, std::vector<TreeNode*>& rNodes, const RoutedEvent& routedEvent, const bool paired)
     {
-      std::shared_ptr<WindowTransactionEvent> windowTransactionEvent = std::dynamic_pointer_cast<UI::WindowTransactionEvent>(routedEvent.Content);
+      auto* const pTransactionEvent = dynamic_cast<WindowTransactionEvent*>(routedEvent.Content.get());
 
       uint32_t interceptionCount = 0;
       bool allowIntercept = false;
-      if (windowTransactionEvent)
+      if (pTransactionEvent != nullptr)
       {
-        interceptionCount = windowTransactionEvent->GetInterceptionCount();
+        interceptionCount = pTransactionEvent->GetInterceptionCount();
         // Intercept is only valid for begin and end events during tunnel
         allowIntercept =
-          windowTransactionEvent->GetState() == EventTransactionState::Begin || windowTransactionEvent->GetState() == EventTransactionState::End;
-        windowTransactionEvent->SYS_SetAllowIntercept(allowIntercept);
+          pTransactionEvent->GetState() == EventTransactionState::Begin || pTransactionEvent->GetState() == EventTransactionState::End;
+        pTransactionEvent->SYS_SetAllowIntercept(allowIntercept);
       }
       for (std::size_t i = 0; i < rNodes.size(); ++i)
       {
@@ -120,10 +123,10 @@ namespace Fsl::UI
         // Doing the check causes problems with FocusLoss events during 'hiding' of windows where certain flags are disabled.
         if (rNodes[i]->IsConsideredRunning())
         {
-          eventHandler.HandleEvent(rNodes[i], routedEvent);
-          if (windowTransactionEvent && windowTransactionEvent->GetInterceptionCount() != interceptionCount)
+          eventHandler.HandleEvent(*rNodes[i], routedEvent);
+          if (pTransactionEvent != nullptr && pTransactionEvent->GetInterceptionCount() != interceptionCount)
           {
-            interceptionCount = windowTransactionEvent->GetInterceptionCount();
+            interceptionCount = pTransactionEvent->GetInterceptionCount();
 
             if (allowIntercept)
             {
@@ -132,14 +135,16 @@ namespace Fsl::UI
               {
                 FSLLOG3_VERBOSE3("Intercepting transaction event");
                 const std::size_t removeCount = rNodes.size() - removeIndex;
-                if (windowTransactionEvent->IsRepeat() || windowTransactionEvent->GetState() == EventTransactionState::End)
+                if (pTransactionEvent->IsRepeat() || pTransactionEvent->GetState() == EventTransactionState::End)
                 {
                   // Since this is either a 'begin + repeat' or a end event we need to send a cancel event to the windows we are about to remove from
                   // the transaction
-                  SendCancelEventsViaTunnel(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), windowTransactionEvent);
+                  SendCancelEventsViaTunnel(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), routedEvent,
+                                            *pTransactionEvent);
                   if (paired)
                   {
-                    SendCancelEventsViaBubble(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), windowTransactionEvent);
+                    SendCancelEventsViaBubble(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), routedEvent,
+                                              *pTransactionEvent);
                   }
                 }
 
@@ -165,32 +170,32 @@ namespace Fsl::UI
 
     //------------------------------------------------------------------------------------------------------------------------------------------------
 
-    void SendViaBubble(IEventHandler& eventHandler, std::vector<std::shared_ptr<TreeNode>>& rNodes, const RoutedEvent& routedEvent, const bool paired)
+    void SendViaBubble(IEventHandler& eventHandler, std::vector<TreeNode*>& rNodes, const RoutedEvent& routedEvent, const bool paired)
     {
-      std::shared_ptr<WindowTransactionEvent> windowTransactionEvent = std::dynamic_pointer_cast<UI::WindowTransactionEvent>(routedEvent.Content);
+      auto* const pTransactionEvent = dynamic_cast<WindowTransactionEvent*>(routedEvent.Content.get());
 
       uint32_t interceptionCount = 0;
       bool allowIntercept = false;
-      if (windowTransactionEvent)
+      if (pTransactionEvent != nullptr)
       {
-        interceptionCount = windowTransactionEvent->GetInterceptionCount();
+        interceptionCount = pTransactionEvent->GetInterceptionCount();
         // Intercept is only valid for begin events during bubble
-        allowIntercept = windowTransactionEvent->GetState() == EventTransactionState::Begin;
-        windowTransactionEvent->SYS_SetAllowIntercept(allowIntercept);
+        allowIntercept = pTransactionEvent->GetState() == EventTransactionState::Begin;
+        pTransactionEvent->SYS_SetAllowIntercept(allowIntercept);
       }
       for (std::size_t i = rNodes.size(); i > 0; --i)
       {
-        const auto& node = rNodes[i - 1];
+        TreeNode* const pNode = rNodes[i - 1];
 
         // The check is not needed as it would not get on the list if it was not interested at the time the list was build
         // Doing the check causes problems with FocusLoss events during 'hiding' of windows where certain flags are disabled.
-        if (node->IsConsideredRunning())
+        if (pNode->IsConsideredRunning())
         {
-          eventHandler.HandleEvent(node, routedEvent);
+          eventHandler.HandleEvent(*pNode, routedEvent);
 
-          if (windowTransactionEvent && windowTransactionEvent->GetInterceptionCount() != interceptionCount)
+          if (pTransactionEvent != nullptr && pTransactionEvent->GetInterceptionCount() != interceptionCount)
           {
-            interceptionCount = windowTransactionEvent->GetInterceptionCount();
+            interceptionCount = pTransactionEvent->GetInterceptionCount();
 
             if (allowIntercept)
             {
@@ -204,9 +209,10 @@ namespace Fsl::UI
                 // For bubble events that are intercepted at a parent we always need to send a cancel to the children
                 if (paired)
                 {
-                  SendCancelEventsViaTunnel(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), windowTransactionEvent);
+                  SendCancelEventsViaTunnel(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), routedEvent,
+                                            *pTransactionEvent);
                 }
-                SendCancelEventsViaBubble(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), windowTransactionEvent);
+                SendCancelEventsViaBubble(eventHandler, SpanUtil::AsReadOnlySpan(rNodes, removeIndex, removeCount), routedEvent, *pTransactionEvent);
 
                 {    // Remove all following windows from the route
                   auto itrRemoveBegin = std::next(rNodes.begin(), UncheckedNumericCast<std::ptrdiff_t>(removeIndex));
@@ -285,32 +291,42 @@ namespace Fsl::UI
       FSLLOG3_ERROR("pEventHandler can not be null, send ignored!");
       return false;
     }
+    if (!m_target)
+    {
+      return false;
+    }
+    if (!theEvent)
+    {
+      throw std::invalid_argument("theEvent can not be null");
+    }
 
-    bool send = false;
-    if (m_target)
+    // Resolve the concrete event type once per send, so the windows along the route can access it without casting or touching the reference count
+    switch (theEvent->GetEventTypeId())
     {
-      switch (m_strategy)
+    case EventTypeId::InputClick:
       {
-      case EventRoutingStrategy::Direct:
-        SendTo(*pEventHandler, m_windowList, theEvent, true);
-        break;
-      case EventRoutingStrategy::Tunnel:
-        SendTo(*pEventHandler, m_windowList, theEvent, true);
-        break;
-      case EventRoutingStrategy::Bubble:
-        SendTo(*pEventHandler, m_windowList, theEvent, false);
-        break;
-      case EventRoutingStrategy::Paired:
-        SendTo(*pEventHandler, m_windowList, theEvent, true, true);
-        SendTo(*pEventHandler, m_windowList, theEvent, false, true);
-        break;
-      default:
-        return false;
+        const auto typedEvent = std::static_pointer_cast<WindowInputClickEvent>(theEvent);
+        return SendRouted(*pEventHandler, RoutedEvent(theEvent, typedEvent, true));
       }
-
-      send = GetWindowCount() > 0u;
+    case EventTypeId::Select:
+      {
+        const auto typedEvent = std::static_pointer_cast<WindowSelectEvent>(theEvent);
+        return SendRouted(*pEventHandler, RoutedEvent(theEvent, typedEvent, true));
+      }
+    case EventTypeId::ContentChanged:
+      {
+        const auto typedEvent = std::static_pointer_cast<WindowContentChangedEvent>(theEvent);
+        return SendRouted(*pEventHandler, RoutedEvent(theEvent, typedEvent, true));
+      }
+    case EventTypeId::MouseOver:
+      {
+        const auto typedEvent = std::static_pointer_cast<WindowMouseOverEvent>(theEvent);
+        return SendRouted(*pEventHandler, RoutedEvent(theEvent, typedEvent, true));
+      }
+    default:
+      FSLLOG3_WARNING("Unknown eventTypeId: {}", fmt::underlying(theEvent->GetEventTypeId()));
+      return SendRouted(*pEventHandler, RoutedEvent(theEvent, true));
     }
-    return send;
   }
 
 
@@ -339,10 +355,10 @@ namespace Fsl::UI
       case EventRoutingStrategy::Bubble:
       case EventRoutingStrategy::Tunnel:
       case EventRoutingStrategy::Paired:
-        BuildParent(m_target);
+        BuildParent(m_target.get());
         break;
       case EventRoutingStrategy::Direct:
-        BuildDirect(m_target);
+        BuildDirect(m_target.get());
         break;
       default:
         throw NotSupportedException(fmt::format("Unsupported routing strategy: {}", fmt::underlying(routingStrategy)));
@@ -355,7 +371,7 @@ namespace Fsl::UI
   {
     assert(m_isInitialized);
     bool removed = false;
-    removed |= Remove(m_windowList, node);
+    removed |= Remove(m_windowList, node.get());
 
     if (m_target == node)
     {
@@ -365,8 +381,30 @@ namespace Fsl::UI
   }
 
 
-  void EventRoute::SendTo(IEventHandler& eventHandler, std::vector<std::shared_ptr<TreeNode>>& rNodes, const std::shared_ptr<WindowEvent>& theEvent,
-                          const bool isTunneling, const bool paired)
+  bool EventRoute::SendRouted(IEventHandler& eventHandler, const RoutedEvent& routedEvent)
+  {
+    assert(routedEvent.IsTunneling);
+    switch (m_strategy)
+    {
+    case EventRoutingStrategy::Direct:
+    case EventRoutingStrategy::Tunnel:
+      SendTo(eventHandler, m_windowList, routedEvent);
+      break;
+    case EventRoutingStrategy::Bubble:
+      SendTo(eventHandler, m_windowList, RoutedEvent(routedEvent, false));
+      break;
+    case EventRoutingStrategy::Paired:
+      SendTo(eventHandler, m_windowList, routedEvent, true);
+      SendTo(eventHandler, m_windowList, RoutedEvent(routedEvent, false), true);
+      break;
+    default:
+      return false;
+    }
+    return GetWindowCount() > 0u;
+  }
+
+
+  void EventRoute::SendTo(IEventHandler& eventHandler, std::vector<TreeNode*>& rNodes, const RoutedEvent& routedEvent, const bool paired)
   {
     assert(m_isInitialized);
     assert(m_target);
@@ -376,64 +414,75 @@ namespace Fsl::UI
       return;
     }
 
-    if (!theEvent->GetOriginalSource())
+    if (!routedEvent.Content->GetOriginalSource())
     {
       // Setup the various things in the event here.
-      theEvent->SYS_SetOriginalSource(m_target->GetWindow());
+      routedEvent.Content->SYS_SetOriginalSource(m_target->GetWindow());
     }
 
     // Continue to send the event while the event isn't marked as handled.
-    RoutedEvent routedEvent(theEvent, isTunneling);
-    if (isTunneling)
+    if (routedEvent.IsTunneling)
     {
       SendToViaTunnel(eventHandler, rNodes, routedEvent, paired);
-      UpdateTargetIfNecessary(SpanUtil::AsReadOnlySpan(rNodes));
     }
     else
     {
       SendViaBubble(eventHandler, rNodes, routedEvent, paired);
-      UpdateTargetIfNecessary(SpanUtil::AsReadOnlySpan(rNodes));
     }
+    UpdateTargetIfNecessary(SpanUtil::AsReadOnlySpan(rNodes));
   }
 
-  void EventRoute::UpdateTargetIfNecessary(ReadOnlySpan<std::shared_ptr<TreeNode>> nodeSpan)
+  void EventRoute::UpdateTargetIfNecessary(ReadOnlySpan<TreeNode*> nodeSpan)
   {
-    if (m_target && !nodeSpan.empty() && nodeSpan.back() != m_target)
+    if (m_target && !nodeSpan.empty() && nodeSpan.back() != m_target.get())
     {
       FSLLOG3_VERBOSE3("Updating EventRoute target as list target was changed");
-      m_target = nodeSpan.back();
+      // The route only contains the target and its ancestors, so locate the owning pointer of the new target by walking up the tree
+      std::shared_ptr<TreeNode> newTarget = m_target->GetParent();
+      while (newTarget && newTarget.get() != nodeSpan.back())
+      {
+        newTarget = newTarget->GetParent();
+      }
+      if (newTarget)
+      {
+        m_target = std::move(newTarget);
+      }
+      else
+      {
+        FSLLOG3_WARNING("The route target is not a ancestor of the original target, target not updated");
+      }
     }
   }
 
-  void EventRoute::BuildParent(const std::shared_ptr<TreeNode>& target)
+  void EventRoute::BuildParent(TreeNode* const pTarget)
   {
     assert(m_isInitialized);
-    if (!target || !target->IsConsideredRunning())
+    if (pTarget == nullptr || !pTarget->IsConsideredRunning())
     {
       return;
     }
 
     // ask the parents first
-    BuildParent(target->GetParent());
+    BuildParent(pTarget->GetParentPointer());
 
     // If the record is enabled, append it to the tunnel route
-    if (target->GetFlags().IsFlagged(m_flags))
+    if (pTarget->GetFlags().IsFlagged(m_flags))
     {
       // The window should not be present in the list
-      assert(!Exists(m_windowList, target));
-      m_windowList.push_back(target);
+      assert(!Exists(m_windowList, pTarget));
+      m_windowList.push_back(pTarget);
     }
   }
 
 
-  void EventRoute::BuildDirect(const std::shared_ptr<TreeNode>& target)
+  void EventRoute::BuildDirect(TreeNode* const pTarget)
   {
     assert(m_isInitialized);
-    if (target && target->IsConsideredRunning() && target->GetFlags().IsFlagged(m_flags))
+    if (pTarget != nullptr && pTarget->IsConsideredRunning() && pTarget->GetFlags().IsFlagged(m_flags))
     {
       // The window should not be present in the list
-      assert(!Exists(m_windowList, target));
-      m_windowList.push_back(target);
+      assert(!Exists(m_windowList, pTarget));
+      m_windowList.push_back(pTarget);
     }
   }
 }
@@ -45,10 +45,12 @@ namespace Fsl::UI
   class WindowEvent;
 
   //! @brief  A event route contains the complete route that the event will traverse for a target and routing strategy.
+  //! @note   The route stores raw node pointers so building and traversing it never touches the node reference counts.
+  //!         This is safe as nodes are only disposed via the command queue and disposed nodes are removed with RemoveNode.
   class EventRoute
   {
     WindowFlags m_flags;
-    std::vector<std::shared_ptr<TreeNode>> m_windowList;
+    std::vector<TreeNode*> m_windowList;
     EventRoutingStrategy m_strategy{EventRoutingStrategy::Direct};
     std::shared_ptr<TreeNode> m_target;
     bool m_isInitialized;
@@ -113,12 +115,12 @@ namespace Fsl::UI
     }
 
   private:
-    void SendTo(IEventHandler& eventHandler, std::vector<std::shared_ptr<TreeNode>>& rNodes, const std::shared_ptr<WindowEvent>& theEvent,
-                const bool isTunneling, const bool paired = false);
-    void UpdateTargetIfNecessary(ReadOnlySpan<std::shared_ptr<TreeNode>> nodeSpan);
+    bool SendRouted(IEventHandler& eventHandler, const RoutedEvent& routedEvent);
+    void SendTo(IEventHandler& eventHandler, std::vector<TreeNode*>& rNodes, const RoutedEvent& routedEvent, const bool paired = false);
+    void UpdateTargetIfNecessary(ReadOnlySpan<TreeNode*> nodeSpan);
 
-    void BuildParent(const std::shared_ptr<TreeNode>& target);
-    void BuildDirect(const std::shared_ptr<TreeNode>& target);
+    void BuildParent(TreeNode* const pTarget);
+    void BuildDirect(TreeNode* const pTarget);
   };
 }
 
@@ -53,7 +53,7 @@ namespace Fsl::UI
     {
     }
 
-    std::shared_ptr<WindowEvent> Content() const
+    const std::shared_ptr<WindowEvent>& Content() const noexcept
     {
       return m_content;
     }
@@ -41,6 +41,7 @@ namespace Fsl::UI
     assert(childNode);
 
     childNode->m_parent = parentNode;
+    childNode->m_pParent = parentNode.get();
     parentNode->m_children.push_back(childNode);
   }
 
@@ -57,6 +58,7 @@ namespace Fsl::UI
 #endif
 
     m_flags.EnableFlag(TreeNodeFlags::Disposed);
+    m_pParent = nullptr;
     m_window->WinShutdown();
   }
 
@@ -67,6 +69,7 @@ namespace Fsl::UI
     if (itr != m_children.end())
     {
       childNode->m_parent.reset();
+      childNode->m_pParent = nullptr;
       m_children.erase(itr);
     }
   }
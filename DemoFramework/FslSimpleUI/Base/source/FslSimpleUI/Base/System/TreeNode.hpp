@@ -47,6 +47,8 @@ namespace Fsl::UI
   class TreeNode
   {
     std::weak_ptr<TreeNode> m_parent;
+    //! Raw access to the parent, only valid while this node is running (cleared when the node is disposed or removed)
+    TreeNode* m_pParent{nullptr};
     std::shared_ptr<BaseWindow> m_window;
     TreeNodeFlags m_flags;
 
@@ -63,6 +65,7 @@ namespace Fsl::UI
 
     TreeNode(std::weak_ptr<TreeNode> parent, const std::shared_ptr<BaseWindow>& window)
       : m_parent(std::move(parent))
+      , m_pParent(m_parent.lock().get())
       , m_window(window)
       , m_flags(ExtractWindowFlags(window))
     {
@@ -77,6 +80,13 @@ namespace Fsl::UI
       return m_parent.lock();
     }
 
+    //! @brief Get the parent without touching its reference count.
+    //! @note  Only valid while this node is considered running.
+    inline TreeNode* GetParentPointer() const noexcept
+    {
+      return m_pParent;
+    }
+
     //! @brief Get the associated window
     inline const std::shared_ptr<BaseWindow>& GetWindow() const noexcept
     {
@@ -35,6 +35,7 @@
 #include <FslBase/Math/Pixel/PxAreaRectangleF.hpp>
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/Math/Point2.hpp>
+#include <FslBase/Trace/Trace.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslSimpleUI/Base/Event/WindowEvent.hpp>
 #include <FslSimpleUI/Base/Event/WindowEventPool.hpp>
@@ -406,6 +407,7 @@ namespace Fsl::UI
     {
       throw UsageErrorException("Internal state must be ready");
     }
+    FSL_TRACE_ZONE("UI", "UITree.Update");
     ScopedContextChange scopedContextChange(this, Context::Internal);
 
     m_stats = {};
@@ -413,6 +415,7 @@ namespace Fsl::UI
     ProcessEventsPreUpdate();
 
     {    // Update all the existing windows
+      FSL_TRACE_ZONE("UI", "Update");
       for (TreeNode* pNode : m_vectorUpdate)
       {
         pNode->Update(timespan);
@@ -424,6 +427,7 @@ namespace Fsl::UI
 
 
     {    // Resolve all the existing windows
+      FSL_TRACE_ZONE("UI", "Resolve");
       for (TreeNode* pNode : m_vectorResolve)
       {
         pNode->Resolve(timespan);
@@ -455,6 +459,7 @@ namespace Fsl::UI
       throw UsageErrorException("Internal state must be ready");
     }
 
+    FSL_TRACE_ZONE("UI", "UITree.Draw");
     ScopedContextChange scopedContextChange(this, Context::Internal);
 
     for (const auto& record : m_vectorDraw)
@@ -1010,7 +1015,7 @@ namespace Fsl::UI
   }
 
 
-  void UITree::HandleEvent(const std::shared_ptr<TreeNode>& target, const RoutedEvent& routedEvent)
+  void UITree::HandleEvent(TreeNode& rTarget, const RoutedEvent& routedEvent)
   {
     if (m_state != State::Ready)
     {
@@ -1024,18 +1029,13 @@ namespace Fsl::UI
     // Move to the system level context
     ScopedContextChange scopedContextChange(this, Context::Internal);
 
-    if (!target)
-    {
-      throw std::invalid_argument("target can not be null");
-    }
-
-    const auto itrNode = m_dict.find(target->GetWindow().get());
+    const auto itrNode = m_dict.find(rTarget.GetWindowPointer());
     if (itrNode == m_dict.end())
     {
       throw UsageErrorException("target is not a member of the tree");
     }
 
-    target->WinHandleEvent(routedEvent);
+    rTarget.WinHandleEvent(routedEvent);
   }
 
 
@@ -1062,6 +1062,7 @@ namespace Fsl::UI
   bool UITree::PerformLayout()
   {
     assert(m_state == State::Ready);
+    FSL_TRACE_ZONE("UI", "Layout");
     ScopedContextChange scopedContextChange(this, Context::InternalLayout);
 
     bool layoutPerformed = false;
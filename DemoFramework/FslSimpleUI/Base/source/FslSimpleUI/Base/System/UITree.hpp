@@ -248,7 +248,7 @@ namespace Fsl
       std::optional<PxRectangle> TryGetWindowRectanglePx(const IWindowId* const pWindowId) const final;
 
       // From IEventHandler
-      void HandleEvent(const std::shared_ptr<TreeNode>& target, const RoutedEvent& routedEvent) final;
+      void HandleEvent(TreeNode& rTarget, const RoutedEvent& routedEvent) final;
 
       //! @brief Register a event listener
       void RegisterEventListener(const std::weak_ptr<IEventListener>& eventListener);
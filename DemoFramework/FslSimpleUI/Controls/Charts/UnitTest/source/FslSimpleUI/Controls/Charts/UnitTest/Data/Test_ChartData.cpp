@@ -893,3 +893,55 @@ TEST(Test_Data_ChartData, Append3_Capacity2_ViewEntries2)
     EXPECT_EQ(value2, segmentData[0].Values[0]);
   }
 }
+
+
+TEST(Test_Data_ChartData, GetWindowInfo)
+{
+  const uint32_t channelCount = 1;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  UI::ChartData chartData(dataBinding, 3, channelCount, {});
+  const auto viewConfig = chartData.CreateViewConfig();
+  const auto smallViewConfig = chartData.CreateViewConfig(2, false);
+
+  EXPECT_EQ(UI::ChartDataWindowInfo(0, 0, 0), chartData.GetWindowInfo(viewConfig));
+
+  for (uint32_t i = 0; i < 5; ++i)
+  {
+    chartData.Append(UI::ChartDataEntry(i));
+  }
+  // The buffer holds three entries, so the window covers the sequence [2, 5)
+  const auto windowInfo = chartData.GetWindowInfo(viewConfig);
+  EXPECT_TRUE(windowInfo.IsValid);
+  EXPECT_EQ(0u, windowInfo.Generation);
+  EXPECT_EQ(3u, windowInfo.Count);
+  EXPECT_EQ(5u, windowInfo.EndSequence);
+  EXPECT_EQ(2u, windowInfo.BeginSequence());
+
+  // Views are always at the end of the sequence
+  EXPECT_EQ(UI::ChartDataWindowInfo(0, 2, 5), chartData.GetWindowInfo(smallViewConfig));
+
+  chartData.Clear();
+  EXPECT_EQ(UI::ChartDataWindowInfo(1, 0, 0), chartData.GetWindowInfo(viewConfig));
+}
+
+
+TEST(Test_Data_ChartData, CalculateDataStats_SmallView)
+{
+  const uint32_t channelCount = 1;
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  UI::ChartData chartData(dataBinding, 6, channelCount, {});
+  const auto viewConfig = chartData.CreateViewConfig();
+  const auto smallViewConfig = chartData.CreateViewConfig(3, false);
+
+  for (const uint32_t value : {9u, 1u, 4u, 6u, 5u, 7u, 3u})
+  {
+    chartData.Append(UI::ChartDataEntry(value));
+  }
+  // The buffer contains {1, 4, 6, 5, 7, 3}
+  EXPECT_EQ(MinMax<uint32_t>(1, 7), chartData.CalculateDataStats(viewConfig).ValueMinMax);
+  // The small view contains {5, 7, 3}
+  EXPECT_EQ(MinMax<uint32_t>(3, 7), chartData.CalculateDataStats(smallViewConfig).ValueMinMax);
+
+  chartData.SetCapacity(2);
+  EXPECT_EQ(MinMax<uint32_t>(3, 7), chartData.CalculateDataStats(viewConfig).ValueMinMax);
+}
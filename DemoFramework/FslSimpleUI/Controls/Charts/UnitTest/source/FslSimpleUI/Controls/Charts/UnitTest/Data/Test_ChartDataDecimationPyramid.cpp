@@ -0,0 +1,213 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartData.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataDecimationPyramid.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
+#include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_Data_ChartDataDecimationPyramid = TestFixture;
+
+  std::vector<UI::ChartDataEntry> GetViewEntries(const UI::ChartDataView& dataView)
+  {
+    std::vector<UI::ChartDataEntry> result;
+    const auto dataInfo = dataView.DataInfo();
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        result.push_back(entry);
+      }
+    }
+    return result;
+  }
+
+  uint32_t CalcStackedValue(const UI::ChartDataEntry& entry, const uint32_t channelCount)
+  {
+    uint32_t sum = 0;
+    for (uint32_t i = 0; i < channelCount; ++i)
+    {
+      sum += entry.Values[i];
+    }
+    return sum;
+  }
+
+  //! Decimate the view the slow way
+  std::vector<uint32_t> DecimateStackedValues(const UI::ChartDataView& dataView, const uint32_t columnCount)
+  {
+    const auto entries = GetViewEntries(dataView);
+    const auto count = static_cast<uint64_t>(entries.size());
+    std::vector<uint32_t> result;
+    for (uint32_t columnIndex = 0; columnIndex < columnCount; ++columnIndex)
+    {
+      const uint64_t begin = (static_cast<uint64_t>(columnIndex) * count) / columnCount;
+      const uint64_t end = (static_cast<uint64_t>(columnIndex + 1u) * count) / columnCount;
+      uint32_t peak = 0;
+      for (uint64_t i = begin; i < end; ++i)
+      {
+        peak = std::max(peak, CalcStackedValue(entries[i], dataView.ChannelCount()));
+      }
+      result.push_back(peak);
+    }
+    return result;
+  }
+
+  std::vector<uint32_t> ToStackedValues(const std::vector<UI::ChartDataEntry>& entries, const uint32_t channelCount)
+  {
+    std::vector<uint32_t> result;
+    for (const auto& entry : entries)
+    {
+      result.push_back(CalcStackedValue(entry, channelCount));
+    }
+    return result;
+  }
+
+  UI::ChartDataEntry CreateEntry(const uint32_t value0, const uint32_t value1)
+  {
+    UI::ChartDataEntry entry(value0);
+    entry.Values[1] = value1;
+    return entry;
+  }
+}
+
+
+TEST(Test_Data_ChartDataDecimationPyramid, TryDecimate_Fits)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 16, 1, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  for (uint32_t i = 0; i < 8; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry(i));
+  }
+
+  UI::ChartDataDecimationPyramid pyramid;
+  std::vector<UI::ChartDataEntry> columns;
+  EXPECT_FALSE(pyramid.TryDecimate(*dataView, 8, columns));
+  EXPECT_TRUE(columns.empty());
+  EXPECT_FALSE(pyramid.TryDecimate(*dataView, 0, columns));
+  EXPECT_TRUE(columns.empty());
+}
+
+
+TEST(Test_Data_ChartDataDecimationPyramid, TryDecimate_Peaks)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 16, 2, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  //                            0       1       2       3       4       5       6       7
+  const uint32_t values0[] = {1, 1, 9, 1, 1, 1, 1, 2};
+  const uint32_t values1[] = {0, 5, 0, 0, 3, 0, 0, 0};
+  for (uint32_t i = 0; i < 8; ++i)
+  {
+    chartData->Append(CreateEntry(values0[i], values1[i]));
+  }
+
+  UI::ChartDataDecimationPyramid pyramid;
+  std::vector<UI::ChartDataEntry> columns;
+  ASSERT_TRUE(pyramid.TryDecimate(*dataView, 4, columns));
+  ASSERT_EQ(4u, columns.size());
+  // The entry with the largest stacked value is selected for each column
+  EXPECT_EQ(CreateEntry(1, 5), columns[0]);
+  EXPECT_EQ(CreateEntry(9, 0), columns[1]);
+  EXPECT_EQ(CreateEntry(1, 3), columns[2]);
+  EXPECT_EQ(CreateEntry(2, 0), columns[3]);
+}
+
+
+TEST(Test_Data_ChartDataDecimationPyramid, TryDecimate_Incremental)
+{
+  std::mt19937 random(99);
+  std::uniform_int_distribution<uint32_t> valueDistribution(0, 5000);
+  std::uniform_int_distribution<uint32_t> appendDistribution(0, 300);
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 3000, 2, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+
+  UI::ChartDataDecimationPyramid pyramid;
+  std::vector<UI::ChartDataEntry> columns;
+  for (uint32_t i = 0; i < 60; ++i)
+  {
+    const uint32_t appendCount = appendDistribution(random);
+    for (uint32_t appendIndex = 0; appendIndex < appendCount; ++appendIndex)
+    {
+      chartData->Append(CreateEntry(valueDistribution(random), valueDistribution(random)));
+    }
+    if (i == 40)
+    {
+      // Shrink the view to ensure that a view change is handled too
+      dataView->SetMaxViewEntries(1000);
+    }
+    const uint32_t columnCount = 97 + (i % 3);
+    if (pyramid.TryDecimate(*dataView, columnCount, columns))
+    {
+      ASSERT_EQ(DecimateStackedValues(*dataView, columnCount), ToStackedValues(columns, 2));
+    }
+    else
+    {
+      ASSERT_LE(dataView->Count(), columnCount);
+    }
+  }
+}
+
+
+TEST(Test_Data_ChartDataDecimationPyramid, TryDecimate_Clear)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 64, 1, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  for (uint32_t i = 0; i < 64; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry(1000 + i));
+  }
+
+  UI::ChartDataDecimationPyramid pyramid;
+  std::vector<UI::ChartDataEntry> columns;
+  ASSERT_TRUE(pyramid.TryDecimate(*dataView, 8, columns));
+
+  chartData->Clear();
+  for (uint32_t i = 0; i < 32; ++i)
+  {
+    chartData->Append(UI::ChartDataEntry(i));
+  }
+  ASSERT_TRUE(pyramid.TryDecimate(*dataView, 8, columns));
+  EXPECT_EQ(DecimateStackedValues(*dataView, 8), ToStackedValues(columns, 1));
+}
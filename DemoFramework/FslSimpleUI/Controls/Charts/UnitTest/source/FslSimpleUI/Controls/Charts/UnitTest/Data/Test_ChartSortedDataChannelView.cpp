@@ -38,8 +38,11 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
 #include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
 #include <array>
 #include <memory>
+#include <random>
+#include <vector>
 
 using namespace Fsl;
 
@@ -88,6 +91,27 @@ namespace
     return CreateDataViewFromSpan(dataBinding, SpanUtil::AsReadOnlySpan(source));
   }
 
+  std::vector<uint32_t> ToVector(const ReadOnlySpan<uint32_t> span)
+  {
+    return {span.begin(), span.end()};
+  }
+
+  //! Get the sorted content of the view the slow way
+  std::vector<uint32_t> GetSortedViewContent(const UI::ChartDataView& dataView)
+  {
+    std::vector<uint32_t> result;
+    const auto dataInfo = dataView.DataInfo();
+    for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+    {
+      for (const auto& entry : dataView.SegmentDataAsReadOnlySpan(segmentIndex))
+      {
+        result.push_back(entry.Values[0]);
+      }
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+
 }
 
 
@@ -152,3 +176,115 @@ TEST(Test_Data_ChartSortedDataChannelView, ConstructFromUnsorted)
   EXPECT_EQ(4u, sortedSpan[3]);
   EXPECT_EQ(5u, sortedSpan[4]);
 }
+
+
+TEST(Test_Data_ChartSortedDataChannelView, Append_Slide)
+{
+  std::array<uint32_t, 5> source = {1, 5, 2, 4, 3};
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, NumericCast<uint32_t>(source.size()), 1, UI::ChartData::Constraints());
+  for (const auto value : source)
+  {
+    chartData->Append(UI::ChartDataEntry(value));
+  }
+  UI::ChartSortedDataChannelView testSortedDataView(std::make_shared<UI::ChartDataView>(chartData), 0);
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5}), ToVector(testSortedDataView.GetChannelViewSpan()));
+
+  // The buffer is full, so this evicts the '1'
+  chartData->Append(UI::ChartDataEntry(10));
+  EXPECT_EQ((std::vector<uint32_t>{2, 3, 4, 5, 10}), ToVector(testSortedDataView.GetChannelViewSpan()));
+  EXPECT_EQ(MinMax<uint32_t>(2, 10), testSortedDataView.GetAxisRange());
+
+  // Evicts the '5' and '2'
+  chartData->Append(UI::ChartDataEntry(0));
+  chartData->Append(UI::ChartDataEntry(4));
+  EXPECT_EQ((std::vector<uint32_t>{0, 3, 4, 4, 10}), ToVector(testSortedDataView.GetChannelViewSpan()));
+  EXPECT_EQ(MinMax<uint32_t>(0, 10), testSortedDataView.GetAxisRange());
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, Append_Grow)
+{
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 10, 1, UI::ChartData::Constraints());
+  UI::ChartSortedDataChannelView testSortedDataView(std::make_shared<UI::ChartDataView>(chartData), 0);
+  EXPECT_TRUE(testSortedDataView.GetChannelViewSpan().empty());
+
+  chartData->Append(UI::ChartDataEntry(3));
+  EXPECT_EQ((std::vector<uint32_t>{3}), ToVector(testSortedDataView.GetChannelViewSpan()));
+  chartData->Append(UI::ChartDataEntry(1));
+  EXPECT_EQ((std::vector<uint32_t>{1, 3}), ToVector(testSortedDataView.GetChannelViewSpan()));
+  chartData->Append(UI::ChartDataEntry(2));
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3}), ToVector(testSortedDataView.GetChannelViewSpan()));
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, Clear)
+{
+  std::array<uint32_t, 5> source = {1, 5, 2, 4, 3};
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, NumericCast<uint32_t>(source.size()), 1, UI::ChartData::Constraints());
+  for (const auto value : source)
+  {
+    chartData->Append(UI::ChartDataEntry(value));
+  }
+  UI::ChartSortedDataChannelView testSortedDataView(std::make_shared<UI::ChartDataView>(chartData), 0);
+  EXPECT_EQ(5u, testSortedDataView.GetChannelViewSpan().size());
+
+  chartData->Clear();
+  EXPECT_TRUE(testSortedDataView.GetChannelViewSpan().empty());
+  EXPECT_EQ(MinMax<uint32_t>(), testSortedDataView.GetAxisRange());
+
+  chartData->Append(UI::ChartDataEntry(7));
+  EXPECT_EQ((std::vector<uint32_t>{7}), ToVector(testSortedDataView.GetChannelViewSpan()));
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, SetMaxViewEntries)
+{
+  std::array<uint32_t, 6> source = {6, 1, 5, 2, 4, 3};
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, NumericCast<uint32_t>(source.size()), 1, UI::ChartData::Constraints());
+  for (const auto value : source)
+  {
+    chartData->Append(UI::ChartDataEntry(value));
+  }
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  UI::ChartSortedDataChannelView testSortedDataView(dataView, 0);
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5, 6}), ToVector(testSortedDataView.GetChannelViewSpan()));
+
+  // Shrinking the view evicts the oldest entries
+  dataView->SetMaxViewEntries(3);
+  EXPECT_EQ((std::vector<uint32_t>{2, 3, 4}), ToVector(testSortedDataView.GetChannelViewSpan()));
+
+  // Growing the view brings back entries that were not part of the cached view
+  dataView->SetMaxViewEntries(5);
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5}), ToVector(testSortedDataView.GetChannelViewSpan()));
+}
+
+
+TEST(Test_Data_ChartSortedDataChannelView, RandomAppend)
+{
+  std::mt19937 random(42);
+  std::uniform_int_distribution<uint32_t> valueDistribution(0, 100);
+  std::uniform_int_distribution<uint32_t> appendDistribution(0, 12);
+
+  auto dataBinding = std::make_shared<DataBinding::DataBindingService>();
+  auto chartData = std::make_shared<UI::ChartData>(dataBinding, 32, 1, UI::ChartData::Constraints());
+  auto dataView = std::make_shared<UI::ChartDataView>(chartData);
+  dataView->SetMaxViewEntries(24);
+  UI::ChartSortedDataChannelView testSortedDataView(dataView, 0);
+
+  for (uint32_t i = 0; i < 500; ++i)
+  {
+    const auto appendCount = appendDistribution(random);
+    for (uint32_t appendIndex = 0; appendIndex < appendCount; ++appendIndex)
+    {
+      chartData->Append(UI::ChartDataEntry(valueDistribution(random)));
+    }
+    ASSERT_EQ(GetSortedViewContent(*dataView), ToVector(testSortedDataView.GetChannelViewSpan()));
+  }
+}
@@ -77,3 +77,20 @@ TEST(Test_Util_BoxPlotHelper, Calculate_Odd)
   EXPECT_EQ(140.0, result.Q3);
   EXPECT_EQ(150.0, result.Max);
 }
+
+
+TEST(Test_Util_BoxPlotHelper, Calculate_Outliers)
+{
+  //                                     0   1    2    3    4    5    6    7    8     9
+  std::array<uint32_t, 10> sortedData = {1, 98, 100, 100, 101, 102, 103, 104, 106, 1000};
+
+  auto result = UI::BoxPlotHelper::Calculate(SpanUtil::AsReadOnlySpan(sortedData));
+
+  EXPECT_EQ(1.0, result.OutlierMin);
+  EXPECT_EQ(98.0, result.Min);
+  EXPECT_EQ(100.0, result.Q1);
+  EXPECT_EQ(101.5, result.Q2);
+  EXPECT_EQ(104.0, result.Q3);
+  EXPECT_EQ(106.0, result.Max);
+  EXPECT_EQ(1000.0, result.OutlierMax);
+}
@@ -0,0 +1,172 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Math/LogMinMax.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/SlidingWindowMinMax.hpp>
+#include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
+#include <deque>
+#include <random>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_Util_SlidingWindowMinMax = TestFixture;
+
+  MinMax<uint32_t> CalcMinMax(const std::deque<uint32_t>& values, const uint32_t count)
+  {
+    if (values.empty() || count == 0u)
+    {
+      return {};
+    }
+    const auto itrBegin = values.end() - std::min(static_cast<std::ptrdiff_t>(count), static_cast<std::ptrdiff_t>(values.size()));
+    const auto [itrMin, itrMax] = std::minmax_element(itrBegin, values.end());
+    return MinMax<uint32_t>(*itrMin, *itrMax);
+  }
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, Construct)
+{
+  UI::SlidingWindowMinMax tracker(4);
+  EXPECT_EQ(4u, tracker.Capacity());
+  EXPECT_EQ(0u, tracker.Count());
+  EXPECT_EQ(MinMax<uint32_t>(), tracker.GetMinMax());
+  EXPECT_EQ(MinMax<uint32_t>(), tracker.GetMinMax(2));
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, Construct_ZeroCapacity)
+{
+  UI::SlidingWindowMinMax tracker(0);
+  EXPECT_EQ(1u, tracker.Capacity());
+  tracker.Push(5);
+  tracker.Push(3);
+  EXPECT_EQ(MinMax<uint32_t>(3, 3), tracker.GetMinMax());
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, Push_Evict)
+{
+  UI::SlidingWindowMinMax tracker(3);
+  tracker.Push(5);
+  tracker.Push(1);
+  tracker.Push(9);
+  EXPECT_EQ(3u, tracker.Count());
+  EXPECT_EQ(MinMax<uint32_t>(1, 9), tracker.GetMinMax());
+
+  // Evicts the 5
+  tracker.Push(4);
+  EXPECT_EQ(MinMax<uint32_t>(1, 9), tracker.GetMinMax());
+  // Evicts the 1
+  tracker.Push(6);
+  EXPECT_EQ(MinMax<uint32_t>(4, 9), tracker.GetMinMax());
+  // Evicts the 9
+  tracker.Push(5);
+  EXPECT_EQ(MinMax<uint32_t>(4, 6), tracker.GetMinMax());
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, GetMinMax_Suffix)
+{
+  UI::SlidingWindowMinMax tracker(6);
+  for (const uint32_t value : {7u, 2u, 8u, 3u, 5u, 4u})
+  {
+    tracker.Push(value);
+  }
+  EXPECT_EQ(MinMax<uint32_t>(), tracker.GetMinMax(0));
+  EXPECT_EQ(MinMax<uint32_t>(4, 4), tracker.GetMinMax(1));
+  EXPECT_EQ(MinMax<uint32_t>(4, 5), tracker.GetMinMax(2));
+  EXPECT_EQ(MinMax<uint32_t>(3, 5), tracker.GetMinMax(3));
+  EXPECT_EQ(MinMax<uint32_t>(3, 8), tracker.GetMinMax(4));
+  EXPECT_EQ(MinMax<uint32_t>(2, 8), tracker.GetMinMax(5));
+  EXPECT_EQ(MinMax<uint32_t>(2, 8), tracker.GetMinMax(6));
+  EXPECT_EQ(MinMax<uint32_t>(2, 8), tracker.GetMinMax(100));
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, SetCapacity)
+{
+  UI::SlidingWindowMinMax tracker(4);
+  for (const uint32_t value : {1u, 9u, 4u, 5u})
+  {
+    tracker.Push(value);
+  }
+  tracker.SetCapacity(2);
+  EXPECT_EQ(2u, tracker.Count());
+  EXPECT_EQ(MinMax<uint32_t>(4, 5), tracker.GetMinMax());
+
+  tracker.SetCapacity(5);
+  EXPECT_EQ(5u, tracker.Capacity());
+  tracker.Push(2);
+  tracker.Push(3);
+  tracker.Push(8);
+  EXPECT_EQ(5u, tracker.Count());
+  EXPECT_EQ(MinMax<uint32_t>(2, 8), tracker.GetMinMax());
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, Clear)
+{
+  UI::SlidingWindowMinMax tracker(4);
+  tracker.Push(3);
+  tracker.Clear();
+  EXPECT_EQ(0u, tracker.Count());
+  EXPECT_EQ(MinMax<uint32_t>(), tracker.GetMinMax());
+  tracker.Push(7);
+  EXPECT_EQ(MinMax<uint32_t>(7, 7), tracker.GetMinMax());
+}
+
+
+TEST(Test_Util_SlidingWindowMinMax, RandomSequence)
+{
+  constexpr uint32_t Capacity = 37;
+  std::mt19937 random(4321);
+  std::uniform_int_distribution<uint32_t> valueDistribution(0, 1000);
+  std::uniform_int_distribution<uint32_t> countDistribution(0, Capacity + 2);
+
+  std::deque<uint32_t> reference;
+  UI::SlidingWindowMinMax tracker(Capacity);
+  for (uint32_t i = 0; i < 2000; ++i)
+  {
+    const uint32_t value = valueDistribution(random);
+    tracker.Push(value);
+    reference.push_back(value);
+    if (reference.size() > Capacity)
+    {
+      reference.pop_front();
+    }
+    ASSERT_EQ(CalcMinMax(reference, Capacity), tracker.GetMinMax());
+    const uint32_t count = countDistribution(random);
+    ASSERT_EQ(CalcMinMax(reference, count), tracker.GetMinMax(count));
+  }
+}
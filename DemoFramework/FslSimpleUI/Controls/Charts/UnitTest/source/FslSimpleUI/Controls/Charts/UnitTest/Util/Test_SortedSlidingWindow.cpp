@@ -0,0 +1,203 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/SortedSlidingWindow.hpp>
+#include <FslUnitTest/TestFixture.hpp>
+#include <algorithm>
+#include <array>
+#include <deque>
+#include <random>
+#include <vector>
+
+using namespace Fsl;
+
+namespace
+{
+  using Test_Util_SortedSlidingWindow = TestFixture;
+
+  std::vector<uint32_t> ToVector(const ReadOnlySpan<uint32_t> span)
+  {
+    return {span.begin(), span.end()};
+  }
+
+  std::vector<uint32_t> Sorted(const std::deque<uint32_t>& values)
+  {
+    std::vector<uint32_t> result(values.begin(), values.end());
+    std::sort(result.begin(), result.end());
+    return result;
+  }
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Construct)
+{
+  UI::SortedSlidingWindow window;
+  EXPECT_TRUE(window.Empty());
+  EXPECT_EQ(0u, window.Count());
+  EXPECT_TRUE(window.AsSortedSpan().empty());
+  EXPECT_THROW(window.Pop(), std::invalid_argument);
+  EXPECT_THROW(window.Oldest(), std::invalid_argument);
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Assign)
+{
+  std::array<uint32_t, 5> source = {3, 1, 5, 2, 4};
+  UI::SortedSlidingWindow window;
+  window.Assign(SpanUtil::AsReadOnlySpan(source));
+
+  EXPECT_EQ(5u, window.Count());
+  EXPECT_EQ(3u, window.Oldest());
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 3, 4, 5}), ToVector(window.AsSortedSpan()));
+  EXPECT_EQ(1u, window.At(0));
+  EXPECT_EQ(5u, window.At(4));
+  EXPECT_THROW(window.At(5), std::out_of_range);
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, PushPop)
+{
+  UI::SortedSlidingWindow window;
+  window.Push(5);
+  window.Push(1);
+  window.Push(3);
+  window.Push(3);
+
+  EXPECT_EQ((std::vector<uint32_t>{1, 3, 3, 5}), ToVector(window.AsSortedSpan()));
+
+  window.Pop();
+  EXPECT_EQ(1u, window.Oldest());
+  EXPECT_EQ((std::vector<uint32_t>{1, 3, 3}), ToVector(window.AsSortedSpan()));
+  window.Pop();
+  window.Pop();
+  EXPECT_EQ((std::vector<uint32_t>{3}), ToVector(window.AsSortedSpan()));
+  window.Pop();
+  EXPECT_TRUE(window.Empty());
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Slide_Larger)
+{
+  std::array<uint32_t, 4> source = {2, 1, 3, 4};
+  UI::SortedSlidingWindow window;
+  window.Assign(SpanUtil::AsReadOnlySpan(source));
+
+  window.Slide(10);
+  EXPECT_EQ(1u, window.Oldest());
+  EXPECT_EQ((std::vector<uint32_t>{1, 3, 4, 10}), ToVector(window.AsSortedSpan()));
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Slide_Smaller)
+{
+  std::array<uint32_t, 4> source = {3, 1, 2, 4};
+  UI::SortedSlidingWindow window;
+  window.Assign(SpanUtil::AsReadOnlySpan(source));
+
+  window.Slide(0);
+  EXPECT_EQ(1u, window.Oldest());
+  EXPECT_EQ((std::vector<uint32_t>{0, 1, 2, 4}), ToVector(window.AsSortedSpan()));
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Slide_Equal)
+{
+  std::array<uint32_t, 3> source = {2, 2, 1};
+  UI::SortedSlidingWindow window;
+  window.Assign(SpanUtil::AsReadOnlySpan(source));
+
+  window.Slide(2);
+  EXPECT_EQ((std::vector<uint32_t>{1, 2, 2}), ToVector(window.AsSortedSpan()));
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Slide_Empty)
+{
+  UI::SortedSlidingWindow window;
+  window.Slide(7);
+  EXPECT_EQ(1u, window.Count());
+  EXPECT_EQ(7u, window.Oldest());
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, Clear)
+{
+  std::array<uint32_t, 3> source = {2, 2, 1};
+  UI::SortedSlidingWindow window;
+  window.Assign(SpanUtil::AsReadOnlySpan(source));
+  window.Clear();
+  EXPECT_TRUE(window.Empty());
+  window.Push(4);
+  EXPECT_EQ(4u, window.Oldest());
+}
+
+
+TEST(Test_Util_SortedSlidingWindow, RandomSequence)
+{
+  std::mt19937 random(1234);
+  std::uniform_int_distribution<uint32_t> valueDistribution(0, 64);
+  std::uniform_int_distribution<uint32_t> opDistribution(0, 3);
+
+  std::deque<uint32_t> reference;
+  UI::SortedSlidingWindow window;
+  for (uint32_t i = 0; i < 2000; ++i)
+  {
+    const uint32_t value = valueDistribution(random);
+    switch (opDistribution(random))
+    {
+    case 0:
+      window.Push(value);
+      reference.push_back(value);
+      break;
+    case 1:
+      if (!reference.empty())
+      {
+        window.Pop();
+        reference.pop_front();
+      }
+      break;
+    default:
+      window.Slide(value);
+      if (!reference.empty())
+      {
+        reference.pop_front();
+      }
+      reference.push_back(value);
+      break;
+    }
+    ASSERT_EQ(Sorted(reference), ToVector(window.AsSortedSpan()));
+    if (!reference.empty())
+    {
+      ASSERT_EQ(reference.front(), window.Oldest());
+    }
+  }
+}
@@ -167,6 +167,7 @@ namespace Fsl
       PxSize2D MeasureOverride(const PxAvailableSize& availableSizePx) final;
 
       bool ProcessDataViewChange();
+      void UpdateDecimation();
       void UpdateAnimation(const TimeSpan& timeSpan) final;
       bool UpdateAnimationState(const bool forceCompleteAnimation) final;
     };
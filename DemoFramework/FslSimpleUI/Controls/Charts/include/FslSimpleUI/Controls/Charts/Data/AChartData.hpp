@@ -39,6 +39,7 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataInfo.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataStats.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataViewConfig.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowInfo.hpp>
 
 namespace Fsl::UI
 {
@@ -63,6 +64,13 @@ namespace Fsl::UI
     virtual ChartDataInfo DataInfo(const ChartDataViewConfig viewConfig) const = 0;
     virtual ReadOnlySpan<ChartDataEntry> SegmentDataAsReadOnlySpan(const ChartDataViewConfig viewConfig, const uint32_t segmentIndex) const = 0;
     virtual ChartChannelMetaDataInfo GetChannelMetaDataInfo(const uint32_t channelIndex) const = 0;
+
+    //! Describe the position of the view in the sequence of appended entries.
+    //! The default implementation reports that tracking is unsupported which forces consumers to rebuild their caches on every change.
+    virtual ChartDataWindowInfo GetWindowInfo(const ChartDataViewConfig /*viewConfig*/) const noexcept
+    {
+      return {};
+    }
   };
 }
 
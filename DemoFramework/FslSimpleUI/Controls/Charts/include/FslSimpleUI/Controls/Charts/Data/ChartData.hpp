@@ -40,6 +40,7 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartChannelMetaData.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataStats.hpp>
 #include <FslSimpleUI/Controls/Charts/Grid/ChartGridLineInfo.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/SlidingWindowMinMax.hpp>
 #include <fmt/format.h>
 #include <array>
 #include <optional>
@@ -70,31 +71,16 @@ namespace Fsl::UI
     };
 
   private:
-    struct Record
-    {
-      value_type CurrentMin{0};
-      value_type CurrentMax{0};
-
-      void Clear()
-      {
-        CurrentMin = 0;
-        CurrentMax = 0;
-      }
-
-      void SetMinMax(const MinMax<value_type> minMax)
-      {
-        CurrentMin = minMax.Min();
-        CurrentMax = minMax.Max();
-      }
-    };
-
     CircularFixedSizeBuffer<ChartDataEntry> m_buffer;
     uint32_t m_dataChannelCount;
     uint32_t m_changeId{0};
+    uint32_t m_generation{0};
+    uint64_t m_appendCount{0};
 
     Constraints m_constraints;
 
-    Record m_viewInfo;
+    //! Tracks the min/max of the summed channel values for every suffix of the buffer (all views are suffixes of the buffer)
+    SlidingWindowMinMax m_minMaxTracker;
     ChartDataStats m_cachedDataStats;
     std::optional<MinMax<value_type>> m_customViewMinMax;
     std::array<ChartChannelMetaData, ChartDataLimits::MaxChannels> m_channelMetaData;
@@ -150,6 +136,7 @@ namespace Fsl::UI
     ChartDataInfo DataInfo(const ChartDataViewConfig viewConfig) const final;
     ReadOnlySpan<ChartDataEntry> SegmentDataAsReadOnlySpan(const ChartDataViewConfig viewConfig, const uint32_t segmentIndex) const final;
     ChartChannelMetaDataInfo GetChannelMetaDataInfo(const uint32_t channelIndex) const final;
+    ChartDataWindowInfo GetWindowInfo(const ChartDataViewConfig viewConfig) const noexcept final;
 
     ChartDataEntry GetLatestEntry() const noexcept;
 
@@ -162,7 +149,6 @@ namespace Fsl::UI
     MinMax<value_type> CalculateMinMax() const noexcept;
     MinMax<value_type> CalculateMinMax(const uint32_t maxEntries) const noexcept;
     MinMax<value_type> ApplyConstraints(const MinMax<value_type> minMax) const;
-    static MinMax<uint32_t> CalcSpanMinMax(ReadOnlySpan<ChartDataEntry> span, const uint32_t dataEntries, value_type min, value_type max) noexcept;
     static value_type CalcSum(const ChartDataEntry& entry, const uint32_t dataEntries) noexcept;
     void MarkAsChanged();
   };
@@ -0,0 +1,90 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATADECIMATIONPYRAMID_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATADECIMATIONPYRAMID_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataEntry.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowInfo.hpp>
+#include <limits>
+#include <vector>
+
+namespace Fsl::UI
+{
+  class ChartDataView;
+
+  /// <summary>
+  /// Reduces a chart data view to a fixed number of columns where each column contains the entry with the largest stacked value (sum of all
+  /// channels) of the samples that map to it. This preserves the spikes a stacked area chart would show if every sample was drawn.
+  ///
+  /// The peaks are cached in a pyramid of power of two sized blocks that is keyed on the append sequence of the chart data, so appending samples
+  /// only updates the blocks they belong to. Finding the peak of a column is O(log n), which makes decimation O(columns * log n).
+  /// If the chart data does not support window tracking the pyramid is rebuilt every time the view's change id is modified.
+  /// </summary>
+  class ChartDataDecimationPyramid final
+  {
+    struct Block
+    {
+      uint64_t PeakSequence{0};
+      uint32_t PeakValue{0};
+    };
+
+    struct Level
+    {
+      std::vector<Block> Blocks;
+      uint64_t LastBlockIndex{std::numeric_limits<uint64_t>::max()};
+    };
+
+    //! Level 0 contains blocks of two samples, level 1 blocks of four samples and so on.
+    std::vector<Level> m_levels;
+    //! The maximum number of samples the pyramid can track before it needs to be rebuilt.
+    uint32_t m_capacity{0};
+    uint32_t m_channelCount{0};
+    uint64_t m_cachedChangeId{0};
+    ChartDataWindowInfo m_windowInfo;
+    bool m_isValid{false};
+
+  public:
+    //! Bring the pyramid up to date with the view (does nothing if the view's change id is unchanged).
+    void Update(const ChartDataView& dataView);
+
+    //! Decimate the view to the given number of columns.
+    //! @param rColumns will be filled with one entry per column (oldest first).
+    //! @return true if the view was decimated, false if the view fits inside the columns so it can be drawn directly (rColumns will be empty).
+    bool TryDecimate(const ChartDataView& dataView, const uint32_t columnCount, std::vector<ChartDataEntry>& rColumns);
+
+  private:
+    void Reset(const uint32_t capacity, const uint32_t channelCount);
+    void Push(const uint64_t sequence, const uint32_t value) noexcept;
+  };
+}
+
+#endif
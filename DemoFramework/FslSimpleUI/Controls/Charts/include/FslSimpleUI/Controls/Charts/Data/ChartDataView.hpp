@@ -42,6 +42,7 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataInfo.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataStats.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataViewConfig.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowInfo.hpp>
 #include <memory>
 #include <optional>
 
@@ -109,6 +110,7 @@ namespace Fsl::UI
 
     ChartDataInfo DataInfo() const;
     ReadOnlySpan<ChartDataEntry> SegmentDataAsReadOnlySpan(const uint32_t segmentIndex) const;
+    ChartDataWindowInfo WindowInfo() const noexcept;
 
     DataBinding::DataBindingInstanceHandle GetSourceInstanceHandle() const final;
 
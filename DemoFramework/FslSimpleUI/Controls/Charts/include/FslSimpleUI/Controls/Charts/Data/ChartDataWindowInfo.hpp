@@ -0,0 +1,78 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATAWINDOWINFO_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_DATA_CHARTDATAWINDOWINFO_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+
+namespace Fsl::UI
+{
+  //! Describes where the entries of a view are located in the sequence of all entries that have been appended to the chart data.
+  //! This allows consumers to update cached data incrementally as entries are appended and evicted.
+  struct ChartDataWindowInfo
+  {
+    //! Changes every time the data is modified in a way that can not be described as appends and evictions (like a clear).
+    uint32_t Generation{0};
+    //! The number of entries in the window
+    uint32_t Count{0};
+    //! The sequence number of the entry after the last entry in the window (the number of entries appended in this generation)
+    uint64_t EndSequence{0};
+    //! If false the chart data does not support window tracking and the other members should be ignored.
+    bool IsValid{false};
+
+    constexpr ChartDataWindowInfo() noexcept = default;
+    constexpr ChartDataWindowInfo(const uint32_t generation, const uint32_t count, const uint64_t endSequence) noexcept
+      : Generation(generation)
+      , Count(count <= endSequence ? count : static_cast<uint32_t>(endSequence))
+      , EndSequence(endSequence)
+      , IsValid(true)
+    {
+    }
+
+    //! The sequence number of the first entry in the window
+    constexpr uint64_t BeginSequence() const noexcept
+    {
+      return EndSequence - Count;
+    }
+
+    constexpr bool operator==(const ChartDataWindowInfo& rhs) const noexcept
+    {
+      return Generation == rhs.Generation && Count == rhs.Count && EndSequence == rhs.EndSequence && IsValid == rhs.IsValid;
+    }
+
+    constexpr bool operator!=(const ChartDataWindowInfo& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
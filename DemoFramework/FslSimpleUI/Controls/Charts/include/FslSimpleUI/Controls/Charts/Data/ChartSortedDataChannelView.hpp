@@ -34,6 +34,8 @@
 #include <FslBase/BasicTypes.hpp>
 #include <FslBase/Math/MinMax.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataWindowInfo.hpp>
+#include <FslSimpleUI/Controls/Charts/Util/SortedSlidingWindow.hpp>
 #include <memory>
 #include <vector>
 
@@ -42,6 +44,8 @@ namespace Fsl::UI
   class ChartDataView;
 
   /// <summary>
+  /// A sorted (low to high) view of one data channel.
+  /// When the chart data supports window tracking the sorted data is updated incrementally as entries are appended and evicted.
   /// </summary>
   class ChartSortedDataChannelView final
   {
@@ -49,8 +53,10 @@ namespace Fsl::UI
     uint32_t m_dataChannelIndex;
 
     mutable uint64_t m_cachedViewChangeId{0};
+    mutable ChartDataWindowInfo m_cachedWindowInfo;
     mutable MinMax<uint32_t> m_cachedAxisRange;
-    mutable std::vector<uint32_t> m_cachedSortedData;
+    mutable SortedSlidingWindow m_cachedSortedData;
+    mutable std::vector<uint32_t> m_scratchpad;
 
   public:
     // Request that the compiler deletes the copy constructor and assignment operator
@@ -76,6 +82,8 @@ namespace Fsl::UI
 
   private:
     void RefreshCacheIfNecessary() const;
+    bool TryUpdateIncrementally(const ChartDataView& dataView, const ChartDataWindowInfo& windowInfo) const;
+    void Rebuild(const ChartDataView& dataView) const;
   };
 }
 
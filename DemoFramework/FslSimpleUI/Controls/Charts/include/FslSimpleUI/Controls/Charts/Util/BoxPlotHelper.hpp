@@ -35,6 +35,7 @@
 #include <FslBase/Exceptions.hpp>
 #include <FslBase/Span/ReadOnlySpan.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/BoxPlotData.hpp>
+#include <algorithm>
 #include <cassert>
 #include <cmath>
 
@@ -69,6 +70,7 @@ namespace Fsl::UI::BoxPlotHelper
   }
 
   //! @brief Calculate the box plot data from a sorted span. (low to high)
+  //!        The quartiles are direct lookups and the whiskers are found using a binary search so this is O(log n).
   //! @param span a span of sorted values (sorting is expected to be low to high).
   template <typename T>
   inline BoxPlotData Calculate(const ReadOnlySpan<T> span)
@@ -96,31 +98,19 @@ namespace Fsl::UI::BoxPlotHelper
     const double lowerLimit = q1 - (1.5 * iqr);
     const double upperLimit = q3 + (1.5 * iqr);
 
-    // find the first element that is greater or equal from the beginning of the span
+    // find the first element that is greater or equal to the lower limit (binary search as the span is sorted)
     // We expect the search to always find a element in the list (due to the way the value we search for is calculated).
     assert(span.back() >= lowerLimit);
-    auto min = lowerLimit;    // just to have a default value
-    for (std::size_t i = 0; i < span.size(); ++i)
-    {
-      min = span[i];
-      if (min >= lowerLimit)
-      {
-        break;
-      }
-    }
+    const auto itrMin = std::lower_bound(span.begin(), span.end(), lowerLimit,
+                                         [](const T lhs, const double rhs) { return static_cast<double>(lhs) < rhs; });
+    const auto min = itrMin != span.end() ? *itrMin : span.back();
 
-    // find the last element that is less or equal from the end of the span
+    // find the last element that is less or equal to the upper limit (binary search as the span is sorted)
     // We expect the search to always find a element in the list (due to the way the value we search for is calculated).
     assert(span.front() <= upperLimit);
-    auto max = upperLimit;    // just to have a default value
-    for (std::size_t i = span.size(); i > 0; --i)
-    {
-      max = span[i - 1];
-      if (max <= upperLimit)
-      {
-        break;
-      }
-    }
+    const auto itrMax = std::upper_bound(span.begin(), span.end(), upperLimit,
+                                         [](const double lhs, const T rhs) { return lhs < static_cast<double>(rhs); });
+    const auto max = itrMax != span.begin() ? *(itrMax - 1) : span.front();
     return {static_cast<float>(span.front()), static_cast<float>(min), static_cast<float>(q1),         static_cast<float>(q2),
             static_cast<float>(q3),           static_cast<float>(max), static_cast<float>(span.back())};
   }
@@ -0,0 +1,101 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_UTIL_SLIDINGWINDOWMINMAX_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_UTIL_SLIDINGWINDOWMINMAX_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Collections/CircularFixedSizeBuffer.hpp>
+#include <FslBase/Math/MinMax.hpp>
+
+namespace Fsl::UI
+{
+  /// <summary>
+  /// Tracks the min and max of the last 'capacity' values that were pushed using two monotonic queues.
+  /// Pushing a value is amortized O(1) and the min/max of the entire window is a O(1) lookup.
+  /// Since the queues contain exactly the candidates for every suffix of the window, the min/max of the last N values is a O(log n) lookup.
+  /// </summary>
+  class SlidingWindowMinMax final
+  {
+    struct Record
+    {
+      uint64_t Sequence{0};
+      uint32_t Value{0};
+
+      constexpr Record() noexcept = default;
+      constexpr Record(const uint64_t sequence, const uint32_t value) noexcept
+        : Sequence(sequence)
+        , Value(value)
+      {
+      }
+    };
+
+    //! Values are increasing from front to back
+    CircularFixedSizeBuffer<Record> m_minQueue;
+    //! Values are decreasing from front to back
+    CircularFixedSizeBuffer<Record> m_maxQueue;
+    uint32_t m_capacity;
+    //! The sequence number that will be assigned to the next value
+    uint64_t m_endSequence{0};
+
+  public:
+    explicit SlidingWindowMinMax(const uint32_t capacity);
+
+    uint32_t Capacity() const noexcept
+    {
+      return m_capacity;
+    }
+
+    //! The number of values in the window
+    uint32_t Count() const noexcept
+    {
+      return m_endSequence < m_capacity ? static_cast<uint32_t>(m_endSequence) : m_capacity;
+    }
+
+    void Clear() noexcept;
+
+    //! Change the window size, when shrinking the oldest values are evicted.
+    void SetCapacity(const uint32_t capacity);
+
+    void Push(const uint32_t value);
+
+    //! Get the min and max of all values in the window (returns 0,0 if the window is empty)
+    MinMax<uint32_t> GetMinMax() const noexcept;
+
+    //! Get the min and max of the last 'count' values in the window (returns 0,0 if count is zero or the window is empty)
+    MinMax<uint32_t> GetMinMax(const uint32_t count) const noexcept;
+
+  private:
+    void EvictBefore(const uint64_t beginSequence) noexcept;
+    static std::size_t FindFirst(const CircularFixedSizeBuffer<Record>& queue, const uint64_t beginSequence) noexcept;
+  };
+}
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef FSLSIMPLEUI_CONTROLS_CHARTS_UTIL_SORTEDSLIDINGWINDOW_HPP
+#define FSLSIMPLEUI_CONTROLS_CHARTS_UTIL_SORTEDSLIDINGWINDOW_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Collections/CircularFixedSizeBuffer.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <vector>
+
+namespace Fsl::UI
+{
+  /// <summary>
+  /// A sliding window of values that keeps both the arrival order and a sorted (low to high) copy of the values.
+  /// This makes it possible to evict the oldest value and insert a new one without resorting the entire window.
+  /// All order statistics (min, max, median, quartiles) are simple index lookups into the sorted span.
+  /// </summary>
+  class SortedSlidingWindow final
+  {
+    //! The values in arrival order (front is the oldest)
+    CircularFixedSizeBuffer<uint32_t> m_arrivalOrder;
+    //! The values sorted low to high
+    std::vector<uint32_t> m_sorted;
+
+  public:
+    SortedSlidingWindow();
+
+    bool Empty() const noexcept
+    {
+      return m_sorted.empty();
+    }
+
+    uint32_t Count() const noexcept
+    {
+      return static_cast<uint32_t>(m_sorted.size());
+    }
+
+    //! Get the values sorted low to high.
+    ReadOnlySpan<uint32_t> AsSortedSpan() const noexcept
+    {
+      return ReadOnlySpan<uint32_t>(m_sorted.data(), m_sorted.size());
+    }
+
+    //! The value with the given rank (0 is the smallest value)
+    uint32_t At(const uint32_t rank) const
+    {
+      return m_sorted.at(rank);
+    }
+
+    //! The oldest value in the window
+    uint32_t Oldest() const;
+
+    void Clear() noexcept;
+
+    //! Replace the content of the window
+    //! @param valuesInArrivalOrder the values (front is the oldest).
+    void Assign(const ReadOnlySpan<uint32_t> valuesInArrivalOrder);
+
+    //! Add a value to the window (O(log n) search + a move of the larger values)
+    void Push(const uint32_t value);
+
+    //! Evict the oldest value (O(log n) search + a move of the larger values)
+    void Pop();
+
+    //! Evict the oldest value and add a new one.
+    //! Only the values between the rank of the evicted value and the new value are moved, so for slowly changing data this is close to O(log n).
+    void Slide(const uint32_t value);
+
+  private:
+    void EnsureArrivalCapacity();
+  };
+}
+
+#endif
@@ -34,6 +34,7 @@
 #include <FslBase/Math/Pixel/TypeConverter.hpp>
 #include <FslBase/NumericCast.hpp>
 #include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
 #include <FslBase/Time/TimeSpan.hpp>
 #include <FslBase/UncheckedNumericCast.hpp>
 #include <FslDataBinding/Base/Object/DependencyObjectHelper.hpp>
@@ -52,6 +53,7 @@
 #include <FslSimpleUI/Render/Builder/ScopedCustomUITextMeshBuilder2D.hpp>
 #include <FslSimpleUI/Render/Builder/UIRawBasicMeshBuilder2D.hpp>
 #include <FslSimpleUI/Render/Builder/UIRawMeshBuilder2D.hpp>
+#include <array>
 #include <cmath>
 #include "Render/ChartDataWindowDrawData.hpp"
 
@@ -231,7 +233,23 @@ namespace Fsl::UI
       if (pChartWindow != nullptr && pChartWindow->DataView)
       {
         const ChartDataView* const pData = pChartWindow->DataView.get();
-        const ChartDataInfo dataInfo = pData->DataInfo();
+        ChartDataInfo dataInfo = pData->DataInfo();
+
+        // Draw the decimated entries if the view contains more entries than can be displayed
+        std::array<ReadOnlySpan<ChartDataEntry>, 2> segments;
+        if (pChartWindow->IsDecimated)
+        {
+          segments[0] = SpanUtil::AsReadOnlySpan(pChartWindow->DecimatedEntries);
+          dataInfo = ChartDataInfo(UncheckedNumericCast<uint32_t>(segments[0].size()), 1u, dataInfo.ChannelCount);
+        }
+        else
+        {
+          assert(dataInfo.SegmentCount <= segments.size());
+          for (uint32_t i = 0; i < dataInfo.SegmentCount; ++i)
+          {
+            segments[i] = pData->SegmentDataAsReadOnlySpan(i);
+          }
+        }
 
         // const float dstY1Pxf = dstPositionPxf.Y + float(dstSizePx.Height());
 
@@ -252,7 +270,7 @@ namespace Fsl::UI
         uint32_t segmentIndex = dataInfo.SegmentCount;
         for (; segmentIndex > 0 && entriesLeft > 0; --segmentIndex)
         {
-          ReadOnlySpan<ChartDataEntry> dataSpan = pData->SegmentDataAsReadOnlySpan(segmentIndex - 1);
+          ReadOnlySpan<ChartDataEntry> dataSpan = segments[segmentIndex - 1];
           {
             auto spanAreaToDrawEntries = std::min(UncheckedNumericCast<std::size_t>(entriesLeft), dataSpan.size());
             lastSegmentOffset = dataSpan.size() - spanAreaToDrawEntries;
@@ -284,7 +302,7 @@ namespace Fsl::UI
           {
             --lastSegmentOffset;
           }
-          ReadOnlySpan<ChartDataEntry> dataSpan = pData->SegmentDataAsReadOnlySpan(segmentIndex).subspan(lastSegmentOffset, 1);
+          ReadOnlySpan<ChartDataEntry> dataSpan = segments[segmentIndex].subspan(lastSegmentOffset, 1);
           if (!dataSpan.empty())
           {
             DrawGraphSegmentNow(rBuilder, dstPositionPxf, PxValue(0), maxYPx, dataInfo.ChannelCount, dataSpan[0], chart.DataRenderScale,
@@ -560,6 +578,7 @@ namespace Fsl::UI
 
     m_gridLineManager.ExtractDrawData(*m_chartWindowDrawData, RenderSizePx(), GetLabelBackground().get(), GetFont().get(),
                                       m_propertyMatchDataViewEntries.Get());
+    UpdateDecimation();
 
     const UIRenderColor finalBaseColor(GetFinalBaseColor());
 
@@ -702,6 +721,19 @@ namespace Fsl::UI
     return requireRelayout;
   }
 
+  void AreaChart::UpdateDecimation()
+  {
+    Render::ChartDataWindowDrawData& rDrawData = *m_chartWindowDrawData;
+    rDrawData.IsDecimated = false;
+    if (rDrawData.DataView)
+    {
+      // Only full columns are decimated, so the vertex count is bounded by the chart width
+      const auto columnCount = UncheckedNumericCast<uint32_t>(RenderSizePx().RawWidth() / m_gridLineManager.GetChartEntryWidth().RawValue());
+      rDrawData.IsDecimated = rDrawData.Decimation.TryDecimate(*rDrawData.DataView, columnCount, rDrawData.DecimatedEntries);
+    }
+  }
+
+
   void AreaChart::UpdateAnimation(const TimeSpan& timeSpan)
   {
     BaseWindow::UpdateAnimation(timeSpan);
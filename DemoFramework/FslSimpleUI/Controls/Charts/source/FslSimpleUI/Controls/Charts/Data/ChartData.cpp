@@ -59,6 +59,7 @@ namespace Fsl::UI
     , m_buffer(entries > 0 ? entries : 1u)
     , m_dataChannelCount(dataChannelCount)
     , m_constraints(constraints)
+    , m_minMaxTracker(UncheckedNumericCast<uint32_t>(m_buffer.capacity()))
   {
     if (dataChannelCount > std::tuple_size<ChartDataEntry::array_type>())
     {
@@ -75,41 +76,24 @@ namespace Fsl::UI
   void ChartData::Clear()
   {
     m_buffer.clear();
+    m_minMaxTracker.Clear();
+    ++m_generation;
+    m_appendCount = 0;
     MarkAsChanged();
     m_cachedDataStats = {};
-    m_viewInfo.Clear();
     UpdateCachedValues({});
   }
 
 
   void ChartData::Append(const ChartDataEntry& value)
   {
-    const auto currentValue = CalcSum(value, m_dataChannelCount);
-    if (!m_buffer.empty() && m_buffer.size() == m_buffer.capacity())
-    {
-      const bool canAffectMinCache = currentValue > m_viewInfo.CurrentMin;
-      const bool canAffectMaxCache = currentValue < m_viewInfo.CurrentMax;
-      if (canAffectMinCache || canAffectMaxCache)
-      {
-        const auto frontValue = CalcSum(m_buffer.front(), m_dataChannelCount);
-        if (frontValue <= m_viewInfo.CurrentMin || frontValue >= m_viewInfo.CurrentMax)
-        {
-          m_buffer.pop_front();
-          m_viewInfo.SetMinMax(CalculateMinMax());
-        }
-      }
-    }
-
-    if (m_buffer.empty())
-    {
-      // As the buffer was empty, the current value becomes the min max
-      m_viewInfo.SetMinMax(MinMax<value_type>(currentValue, currentValue));
-    }
-
+    // When the buffer is full the front entry is evicted, the tracker mirrors this as it has the same capacity
     m_buffer.push_back(value);
+    m_minMaxTracker.Push(CalcSum(value, m_dataChannelCount));
+    ++m_appendCount;
     MarkAsChanged();
 
-    UpdateCachedValues(MinMax<value_type>(std::min(m_viewInfo.CurrentMin, currentValue), std::max(m_viewInfo.CurrentMax, currentValue)));
+    UpdateCachedValues(m_minMaxTracker.GetMinMax());
   }
 
 
@@ -150,6 +134,7 @@ namespace Fsl::UI
     if (newCapacity < m_buffer.capacity())
     {
       m_buffer.resize_pop_front(newCapacity);
+      m_minMaxTracker.SetCapacity(newCapacity);
       auto newMinMax = CalculateMinMax();
       UpdateCachedValues(newMinMax);
       MarkAsChanged();
@@ -157,6 +142,7 @@ namespace Fsl::UI
     else if (newCapacity > m_buffer.capacity())
     {
       m_buffer.grow(newCapacity);
+      m_minMaxTracker.SetCapacity(UncheckedNumericCast<uint32_t>(m_buffer.capacity()));
     }
   }
 
@@ -319,6 +305,13 @@ namespace Fsl::UI
   }
 
 
+  ChartDataWindowInfo ChartData::GetWindowInfo(const ChartDataViewConfig viewConfig) const noexcept
+  {
+    // The buffer always contains the latest entries, so every view ends at the last appended entry
+    return {m_generation, Count(viewConfig), m_appendCount};
+  }
+
+
   ChartDataEntry ChartData::GetLatestEntry() const noexcept
   {
     return m_propertyLatestEntry.Get();
@@ -341,68 +334,19 @@ namespace Fsl::UI
 
   void ChartData::UpdateCachedValues(const MinMax<value_type> minMax)
   {
-    auto constrainedMinMax = ApplyConstraints(minMax);
-    m_viewInfo.SetMinMax(constrainedMinMax);
-    m_cachedDataStats.ValueMinMax = constrainedMinMax;
+    m_cachedDataStats.ValueMinMax = ApplyConstraints(minMax);
   }
 
 
   MinMax<ChartData::value_type> ChartData::CalculateMinMax() const noexcept
   {
-    if (m_buffer.empty())
-    {
-      return MinMax<value_type>(0, 0);
-    }
-
-    value_type min = std::numeric_limits<value_type>::max();
-    value_type max = std::numeric_limits<value_type>::min();
-    for (uint32_t segmentIndex = 0; segmentIndex < m_buffer.segment_count(); ++segmentIndex)
-    {
-      auto span = m_buffer.AsReadOnlySpan(segmentIndex);
-      assert(span.size() > 0);
-      auto minMax = CalcSpanMinMax(span, m_dataChannelCount, min, max);
-      min = minMax.Min();
-      max = minMax.Max();
-    }
-    return MinMax<value_type>(min, max);
+    return m_minMaxTracker.GetMinMax();
   }
 
 
   MinMax<ChartData::value_type> ChartData::CalculateMinMax(const uint32_t maxEntries) const noexcept
   {
-    if (m_buffer.empty() || maxEntries <= 0)
-    {
-      return MinMax<value_type>(0, 0);
-    }
-    if (maxEntries >= m_buffer.size())
-    {
-      return CalculateMinMax();
-    }
-
-    // We only expect there to ever be 0,1 or two segments, and we already check for zero.
-    assert(m_buffer.segment_count() == 1u || m_buffer.segment_count() == 2u);
-
-    value_type min = std::numeric_limits<value_type>::max();
-    value_type max = std::numeric_limits<value_type>::min();
-
-    uint32_t entriesLeft = maxEntries;
-    uint32_t segmentIndex = m_buffer.segment_count();
-    while (segmentIndex > 0 && entriesLeft > 0)
-    {
-      --segmentIndex;
-      auto span = m_buffer.AsReadOnlySpan(segmentIndex);
-      if (entriesLeft < span.size())
-      {
-        span = span.unchecked_subspan(span.size() - entriesLeft, entriesLeft);
-      }
-      assert(span.size() > 0);
-      auto minMax = CalcSpanMinMax(span, m_dataChannelCount, min, max);
-      assert(entriesLeft >= span.size());
-      entriesLeft -= UncheckedNumericCast<uint32_t>(span.size());
-      min = minMax.Min();
-      max = minMax.Max();
-    }
-    return MinMax<value_type>(min, max);
+    return m_minMaxTracker.GetMinMax(maxEntries);
   }
 
 
@@ -423,25 +367,6 @@ namespace Fsl::UI
   }
 
 
-  MinMax<ChartData::value_type> ChartData::CalcSpanMinMax(ReadOnlySpan<ChartDataEntry> span, const uint32_t dataEntries, value_type min,
-                                                          value_type max) noexcept
-  {
-    for (std::size_t i = 0; i < span.size(); ++i)
-    {
-      const value_type val = CalcSum(span[i], dataEntries);
-      if (val < min)
-      {
-        min = val;
-      }
-      if (val > max)
-      {
-        max = val;
-      }
-    }
-    return MinMax<value_type>(min, max);
-  }
-
-
   ChartData::value_type ChartData::CalcSum(const ChartDataEntry& entry, const uint32_t dataEntries) noexcept
   {
     static_assert(std::tuple_size<ChartDataEntry::array_type>() <= 0xFFFFFFFF, "array size assumption failed");
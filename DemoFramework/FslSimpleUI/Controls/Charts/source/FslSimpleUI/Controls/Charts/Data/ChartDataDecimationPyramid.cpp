@@ -0,0 +1,260 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UncheckedNumericCast.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataDecimationPyramid.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
+#include <algorithm>
+#include <array>
+#include <cassert>
+
+namespace Fsl::UI
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      //! The pyramid capacity is rounded up to a power of two of at least this size so a growing view does not cause constant rebuilds.
+      constexpr uint32_t MinCapacity = 1024;
+    }
+
+    uint32_t CalcStackedValue(const ChartDataEntry& entry, const uint32_t channelCount) noexcept
+    {
+      uint32_t sum = 0;
+      for (uint32_t i = 0; i < channelCount; ++i)
+      {
+        sum += entry.Values[i];
+      }
+      return sum;
+    }
+
+    uint32_t CalcCapacity(const uint32_t count) noexcept
+    {
+      uint64_t capacity = LocalConfig::MinCapacity;
+      while (capacity < count)
+      {
+        capacity *= 2u;
+      }
+      return static_cast<uint32_t>(std::min(capacity, static_cast<uint64_t>(0x80000000u)));
+    }
+
+    //! Provides access to the entries of a view using their index in the view
+    class ViewEntryLookup
+    {
+      std::array<ReadOnlySpan<ChartDataEntry>, 2> m_segments;
+
+    public:
+      explicit ViewEntryLookup(const ChartDataView& dataView)
+      {
+        const auto dataInfo = dataView.DataInfo();
+        assert(dataInfo.SegmentCount <= m_segments.size());
+        for (uint32_t i = 0; i < dataInfo.SegmentCount; ++i)
+        {
+          m_segments[i] = dataView.SegmentDataAsReadOnlySpan(i);
+        }
+      }
+
+      const ChartDataEntry& operator[](const std::size_t index) const noexcept
+      {
+        const std::size_t segment0Size = m_segments[0].size();
+        return index < segment0Size ? m_segments[0][index] : m_segments[1][index - segment0Size];
+      }
+    };
+  }
+
+
+  void ChartDataDecimationPyramid::Update(const ChartDataView& dataView)
+  {
+    const uint64_t changeId = dataView.ChangeId();
+    if (m_isValid && changeId == m_cachedChangeId)
+    {
+      return;
+    }
+
+    const uint32_t count = dataView.Count();
+    ChartDataWindowInfo windowInfo = dataView.WindowInfo();
+    const bool isTrackable = windowInfo.IsValid;
+    if (!isTrackable)
+    {
+      // Treat the view as a new generation, this forces a rebuild below
+      windowInfo = ChartDataWindowInfo(m_windowInfo.Generation + 1u, count, count);
+    }
+    const uint32_t channelCount = dataView.ChannelCount();
+    const ViewEntryLookup entries(dataView);
+
+    // The pyramid can only be updated incrementally if the window only moved forward in the same generation
+    const bool canAppend = m_isValid && isTrackable && windowInfo.Generation == m_windowInfo.Generation && channelCount == m_channelCount &&
+                           windowInfo.Count <= m_capacity && windowInfo.BeginSequence() >= m_windowInfo.BeginSequence() &&
+                           windowInfo.EndSequence >= m_windowInfo.EndSequence &&
+                           (windowInfo.EndSequence - m_windowInfo.EndSequence) <= windowInfo.Count;
+    if (canAppend)
+    {
+      // The appended entries are always the last entries of the view
+      const auto appendCount = static_cast<uint32_t>(windowInfo.EndSequence - m_windowInfo.EndSequence);
+      const uint32_t firstIndex = windowInfo.Count - appendCount;
+      for (uint32_t i = 0; i < appendCount; ++i)
+      {
+        Push(m_windowInfo.EndSequence + i, CalcStackedValue(entries[firstIndex + i], channelCount));
+      }
+    }
+    else
+    {
+      Reset(CalcCapacity(windowInfo.Count), channelCount);
+      const uint64_t beginSequence = windowInfo.BeginSequence();
+      for (uint32_t i = 0; i < windowInfo.Count; ++i)
+      {
+        Push(beginSequence + i, CalcStackedValue(entries[i], channelCount));
+      }
+    }
+    m_windowInfo = windowInfo;
+    m_cachedChangeId = changeId;
+    m_isValid = true;
+  }
+
+
+  bool ChartDataDecimationPyramid::TryDecimate(const ChartDataView& dataView, const uint32_t columnCount, std::vector<ChartDataEntry>& rColumns)
+  {
+    rColumns.clear();
+    const uint32_t count = dataView.Count();
+    if (count <= columnCount || columnCount == 0u)
+    {
+      return false;
+    }
+    Update(dataView);
+    assert(m_windowInfo.Count == count);
+
+    const ViewEntryLookup entries(dataView);
+    const uint64_t viewBeginSequence = m_windowInfo.BeginSequence();
+    const auto levelCount = UncheckedNumericCast<uint32_t>(m_levels.size());
+
+    rColumns.reserve(columnCount);
+    for (uint32_t columnIndex = 0; columnIndex < columnCount; ++columnIndex)
+    {
+      // Since count > columnCount every column contains at least one sample
+      uint64_t position = viewBeginSequence + ((static_cast<uint64_t>(columnIndex) * count) / columnCount);
+      const uint64_t endPosition = viewBeginSequence + ((static_cast<uint64_t>(columnIndex + 1u) * count) / columnCount);
+      assert(position < endPosition);
+
+      // Cover the column with the largest aligned blocks that fit inside it
+      uint64_t peakSequence = position;
+      uint32_t peakValue = 0;
+      bool hasPeak = false;
+      while (position < endPosition)
+      {
+        uint32_t levelIndex = levelCount;
+        while (levelIndex > 0u)
+        {
+          const uint64_t blockSize = uint64_t(2u) << (levelIndex - 1u);
+          if ((position & (blockSize - 1u)) == 0u && (position + blockSize) <= endPosition)
+          {
+            break;
+          }
+          --levelIndex;
+        }
+
+        uint64_t candidateSequence = position;
+        uint32_t candidateValue = 0;
+        if (levelIndex > 0u)
+        {
+          const Level& level = m_levels[levelIndex - 1u];
+          const uint64_t blockIndex = position >> levelIndex;
+          const Block& block = level.Blocks[blockIndex % level.Blocks.size()];
+          candidateSequence = block.PeakSequence;
+          candidateValue = block.PeakValue;
+          position += uint64_t(1u) << levelIndex;
+        }
+        else
+        {
+          candidateValue = CalcStackedValue(entries[position - viewBeginSequence], m_channelCount);
+          ++position;
+        }
+        if (!hasPeak || candidateValue > peakValue)
+        {
+          peakSequence = candidateSequence;
+          peakValue = candidateValue;
+          hasPeak = true;
+        }
+      }
+      rColumns.push_back(entries[peakSequence - viewBeginSequence]);
+    }
+    return true;
+  }
+
+
+  void ChartDataDecimationPyramid::Reset(const uint32_t capacity, const uint32_t channelCount)
+  {
+    m_capacity = capacity;
+    m_channelCount = channelCount;
+
+    // Create levels until a single block covers the entire capacity
+    uint32_t levelCount = 0;
+    while ((uint64_t(2u) << levelCount) <= capacity)
+    {
+      ++levelCount;
+    }
+    m_levels.resize(levelCount);
+    for (uint32_t i = 0; i < levelCount; ++i)
+    {
+      // A window of 'capacity' entries can overlap at most (capacity / blockSize) + 1 blocks, we add one extra to be safe
+      const uint32_t blockSize = 2u << i;
+      Level& rLevel = m_levels[i];
+      rLevel.Blocks.resize((capacity / blockSize) + 2u);
+      rLevel.LastBlockIndex = std::numeric_limits<uint64_t>::max();
+    }
+  }
+
+
+  void ChartDataDecimationPyramid::Push(const uint64_t sequence, const uint32_t value) noexcept
+  {
+    for (uint32_t i = 0; i < m_levels.size(); ++i)
+    {
+      Level& rLevel = m_levels[i];
+      const uint64_t blockIndex = sequence >> (i + 1u);
+      Block& rBlock = rLevel.Blocks[blockIndex % rLevel.Blocks.size()];
+      if (blockIndex != rLevel.LastBlockIndex)
+      {
+        rLevel.LastBlockIndex = blockIndex;
+        rBlock.PeakSequence = sequence;
+        rBlock.PeakValue = value;
+      }
+      else if (value > rBlock.PeakValue)
+      {
+        rBlock.PeakSequence = sequence;
+        rBlock.PeakValue = value;
+      }
+      else
+      {
+        // The parent block contains this block, so if the value was not a new peak here it can't be a new peak in any of the parents
+        break;
+      }
+    }
+  }
+}
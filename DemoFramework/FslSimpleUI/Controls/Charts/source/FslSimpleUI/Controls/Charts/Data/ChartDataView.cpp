@@ -152,6 +152,12 @@ namespace Fsl::UI
   }
 
 
+  ChartDataWindowInfo ChartDataView::WindowInfo() const noexcept
+  {
+    return m_chartData->GetWindowInfo(m_viewConfig);
+  }
+
+
   DataBinding::DataBindingInstanceHandle ChartDataView::GetSourceInstanceHandle() const
   {
     return m_chartData->GetSourceInstanceHandle();
@@ -34,11 +34,38 @@
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartSortedDataChannelView.hpp>
 #include <algorithm>
-#include <limits>
+#include <cassert>
 #include <utility>
 
 namespace Fsl::UI
 {
+  namespace
+  {
+    //! Call the function for each channel value in the view, starting at the given entry index
+    template <typename TFunc>
+    void ForEachChannelValue(const ChartDataView& dataView, const uint32_t dataChannelIndex, uint32_t skipCount, TFunc func)
+    {
+      const auto dataInfo = dataView.DataInfo();
+      for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
+      {
+        const auto span = dataView.SegmentDataAsReadOnlySpan(segmentIndex);
+        if (skipCount >= span.size())
+        {
+          skipCount -= static_cast<uint32_t>(span.size());
+        }
+        else
+        {
+          for (std::size_t spanIndex = skipCount; spanIndex < span.size(); ++spanIndex)
+          {
+            func(span[spanIndex].Values[dataChannelIndex]);
+          }
+          skipCount = 0;
+        }
+      }
+    }
+  }
+
+
   // move assignment operator
   ChartSortedDataChannelView& ChartSortedDataChannelView::operator=(ChartSortedDataChannelView&& other) noexcept
   {
@@ -48,12 +75,15 @@ namespace Fsl::UI
       m_dataView = std::move(other.m_dataView);
       m_dataChannelIndex = other.m_dataChannelIndex;
       m_cachedViewChangeId = other.m_cachedViewChangeId;
+      m_cachedWindowInfo = other.m_cachedWindowInfo;
       m_cachedAxisRange = other.m_cachedAxisRange;
       m_cachedSortedData = std::move(other.m_cachedSortedData);
+      m_scratchpad = std::move(other.m_scratchpad);
 
       // Remove the data from other
       other.m_dataChannelIndex = 0;
       other.m_cachedViewChangeId = 0;
+      other.m_cachedWindowInfo = {};
       other.m_cachedAxisRange = {};
     }
     return *this;
@@ -64,12 +94,15 @@ namespace Fsl::UI
     : m_dataView(std::move(other.m_dataView))
     , m_dataChannelIndex(other.m_dataChannelIndex)
     , m_cachedViewChangeId(other.m_cachedViewChangeId)
+    , m_cachedWindowInfo(other.m_cachedWindowInfo)
     , m_cachedAxisRange(other.m_cachedAxisRange)
     , m_cachedSortedData(std::move(other.m_cachedSortedData))
+    , m_scratchpad(std::move(other.m_scratchpad))
   {
     // Remove the data from other
     other.m_dataChannelIndex = 0;
     other.m_cachedViewChangeId = 0;
+    other.m_cachedWindowInfo = {};
     other.m_cachedAxisRange = {};
   }
 
@@ -97,7 +130,7 @@ namespace Fsl::UI
   ReadOnlySpan<uint32_t> ChartSortedDataChannelView::GetChannelViewSpan() const
   {
     RefreshCacheIfNecessary();
-    return SpanUtil::AsReadOnlySpan(m_cachedSortedData);
+    return m_cachedSortedData.AsSortedSpan();
   }
 
 
@@ -115,37 +148,72 @@ namespace Fsl::UI
     auto currentViewChangeId = m_dataView->ChangeId();
     if (currentViewChangeId != m_cachedViewChangeId)
     {
-      // Resort the view data
       m_cachedViewChangeId = currentViewChangeId;
 
-      const auto dataInfo = pDataView->DataInfo();
-
-      m_cachedSortedData.clear();
-      m_cachedSortedData.reserve(dataInfo.TotalElementCount);
-      if (dataInfo.SegmentCount > 0)
+      const auto windowInfo = pDataView->WindowInfo();
+      if (!TryUpdateIncrementally(*pDataView, windowInfo))
       {
-        auto min = std::numeric_limits<uint32_t>::max();
-        auto max = std::numeric_limits<uint32_t>::min();
-        // Insert all the elements from the view into our cached sorted list (low to high)
-        for (uint32_t segmentIndex = 0; segmentIndex < dataInfo.SegmentCount; ++segmentIndex)
-        {
-          const auto span = pDataView->SegmentDataAsReadOnlySpan(segmentIndex);
-          for (uint32_t spanIndex = 0; spanIndex < span.size(); ++spanIndex)
-          {
-            const auto newValue = span[spanIndex].Values[m_dataChannelIndex];
-            m_cachedSortedData.insert(std::lower_bound(m_cachedSortedData.begin(), m_cachedSortedData.end(), newValue), newValue);
-            min = min <= newValue ? min : newValue;
-            max = max >= newValue ? max : newValue;
-          }
-        }
-        assert(min <= max);
-        m_cachedAxisRange = MinMax<uint32_t>(min, max);
-      }
-      else
-      {
-        m_cachedAxisRange = {};
+        Rebuild(*pDataView);
       }
+      m_cachedWindowInfo = windowInfo;
+
+      // The sorted data is low to high so the range is given by the first and last entry
+      const auto sortedSpan = m_cachedSortedData.AsSortedSpan();
+      m_cachedAxisRange = !sortedSpan.empty() ? MinMax<uint32_t>(sortedSpan.front(), sortedSpan.back()) : MinMax<uint32_t>();
+    }
+  }
+
+
+  bool ChartSortedDataChannelView::TryUpdateIncrementally(const ChartDataView& dataView, const ChartDataWindowInfo& windowInfo) const
+  {
+    const ChartDataWindowInfo oldWindowInfo = m_cachedWindowInfo;
+    // The window can only be updated incrementally if it only moved forward in the same generation and still overlaps the old window
+    if (!windowInfo.IsValid || !oldWindowInfo.IsValid || windowInfo.Generation != oldWindowInfo.Generation ||
+        windowInfo.BeginSequence() < oldWindowInfo.BeginSequence() || windowInfo.EndSequence < oldWindowInfo.EndSequence ||
+        windowInfo.BeginSequence() >= oldWindowInfo.EndSequence || m_cachedSortedData.Count() != oldWindowInfo.Count)
+    {
+      return false;
     }
+
+    const auto evictCount = static_cast<uint32_t>(windowInfo.BeginSequence() - oldWindowInfo.BeginSequence());
+    const auto appendCount = static_cast<uint32_t>(windowInfo.EndSequence - oldWindowInfo.EndSequence);
+    if ((evictCount + appendCount) > windowInfo.Count)
+    {
+      // Most of the window changed, so a full sort is cheaper
+      return false;
+    }
+
+    // The appended entries are always the last entries of the view
+    uint32_t slidesLeft = evictCount;
+    ForEachChannelValue(dataView, m_dataChannelIndex, windowInfo.Count - appendCount,
+                        [this, &slidesLeft](const uint32_t value)
+                        {
+                          if (slidesLeft > 0u)
+                          {
+                            m_cachedSortedData.Slide(value);
+                            --slidesLeft;
+                          }
+                          else
+                          {
+                            m_cachedSortedData.Push(value);
+                          }
+                        });
+    // Evict the remaining entries that were not replaced by a new entry
+    while (slidesLeft > 0u)
+    {
+      m_cachedSortedData.Pop();
+      --slidesLeft;
+    }
+    assert(m_cachedSortedData.Count() == windowInfo.Count);
+    return true;
   }
 
+
+  void ChartSortedDataChannelView::Rebuild(const ChartDataView& dataView) const
+  {
+    m_scratchpad.clear();
+    m_scratchpad.reserve(dataView.Count());
+    ForEachChannelValue(dataView, m_dataChannelIndex, 0u, [this](const uint32_t value) { m_scratchpad.push_back(value); });
+    m_cachedSortedData.Assign(SpanUtil::AsReadOnlySpan(m_scratchpad));
+  }
 }
@@ -36,6 +36,7 @@
 #include <FslBase/Math/Pixel/PxRectangle.hpp>
 #include <FslSimpleUI/Controls/Charts/AreaChartConfig.hpp>
 #include <FslSimpleUI/Controls/Charts/Canvas/ChartCanvas1D.hpp>
+#include <FslSimpleUI/Controls/Charts/Data/ChartDataDecimationPyramid.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataEntry.hpp>
 #include <FslSimpleUI/Controls/Charts/Data/ChartDataView.hpp>
 #include <FslSimpleUI/Render/Base/ICustomDrawData.hpp>
@@ -43,6 +44,7 @@
 #include <array>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace Fsl::UI::Render
 {
@@ -78,6 +80,12 @@ namespace Fsl::UI::Render
     // The chart data
     ChartRecord Chart;
 
+    //! Used to reduce the data view to one entry per chart column when the view contains more entries than can be displayed
+    ChartDataDecimationPyramid Decimation;
+    //! The decimated entries (only valid if IsDecimated is true)
+    std::vector<ChartDataEntry> DecimatedEntries;
+    bool IsDecimated{false};
+
     std::array<UIRenderColor, ChartDataWindowDrawDataConfig::MaxStackedEntries> ChartColors;
     struct ChartColorCache
     {
@@ -0,0 +1,156 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Controls/Charts/Util/SlidingWindowMinMax.hpp>
+#include <cassert>
+#include <stdexcept>
+
+namespace Fsl::UI
+{
+  SlidingWindowMinMax::SlidingWindowMinMax(const uint32_t capacity)
+    : m_minQueue(capacity > 0 ? capacity : 1u)
+    , m_maxQueue(capacity > 0 ? capacity : 1u)
+    , m_capacity(capacity > 0 ? capacity : 1u)
+  {
+  }
+
+
+  void SlidingWindowMinMax::Clear() noexcept
+  {
+    m_minQueue.clear();
+    m_maxQueue.clear();
+    m_endSequence = 0;
+  }
+
+
+  void SlidingWindowMinMax::SetCapacity(const uint32_t capacity)
+  {
+    const uint32_t newCapacity = capacity > 0 ? capacity : 1u;
+    if (newCapacity < m_capacity)
+    {
+      m_capacity = newCapacity;
+      EvictBefore(m_endSequence - Count());
+    }
+    else if (newCapacity > m_capacity)
+    {
+      m_minQueue.grow(newCapacity - m_capacity);
+      m_maxQueue.grow(newCapacity - m_capacity);
+      m_capacity = newCapacity;
+    }
+  }
+
+
+  void SlidingWindowMinMax::Push(const uint32_t value)
+  {
+    const uint64_t sequence = m_endSequence;
+    ++m_endSequence;
+    // Evict the values that left the window, this ensures that there is room for the new value in the queues
+    EvictBefore(m_endSequence - Count());
+
+    // The new value will outlive all older values, so any older value that is not better than it can never be the min/max again
+    while (!m_minQueue.empty() && m_minQueue.back().Value >= value)
+    {
+      m_minQueue.pop_back();
+    }
+    while (!m_maxQueue.empty() && m_maxQueue.back().Value <= value)
+    {
+      m_maxQueue.pop_back();
+    }
+    assert(m_minQueue.size() < m_minQueue.capacity());
+    assert(m_maxQueue.size() < m_maxQueue.capacity());
+    m_minQueue.push_back(Record(sequence, value));
+    m_maxQueue.push_back(Record(sequence, value));
+  }
+
+
+  MinMax<uint32_t> SlidingWindowMinMax::GetMinMax() const noexcept
+  {
+    if (m_minQueue.empty())
+    {
+      return {};
+    }
+    return MinMax<uint32_t>(m_minQueue.front().Value, m_maxQueue.front().Value);
+  }
+
+
+  MinMax<uint32_t> SlidingWindowMinMax::GetMinMax(const uint32_t count) const noexcept
+  {
+    if (count >= Count())
+    {
+      return GetMinMax();
+    }
+    if (count == 0u)
+    {
+      return {};
+    }
+    // The newest value is always the last entry of both queues, so the searches will always find a record
+    const uint64_t beginSequence = m_endSequence - count;
+    const std::size_t minIndex = FindFirst(m_minQueue, beginSequence);
+    const std::size_t maxIndex = FindFirst(m_maxQueue, beginSequence);
+    assert(minIndex < m_minQueue.size());
+    assert(maxIndex < m_maxQueue.size());
+    return MinMax<uint32_t>(m_minQueue[minIndex].Value, m_maxQueue[maxIndex].Value);
+  }
+
+
+  void SlidingWindowMinMax::EvictBefore(const uint64_t beginSequence) noexcept
+  {
+    while (!m_minQueue.empty() && m_minQueue.front().Sequence < beginSequence)
+    {
+      m_minQueue.pop_front();
+    }
+    while (!m_maxQueue.empty() && m_maxQueue.front().Sequence < beginSequence)
+    {
+      m_maxQueue.pop_front();
+    }
+  }
+
+
+  std::size_t SlidingWindowMinMax::FindFirst(const CircularFixedSizeBuffer<Record>& queue, const uint64_t beginSequence) noexcept
+  {
+    // Binary search for the first record with a sequence number >= beginSequence (the sequence numbers are increasing)
+    std::size_t low = 0;
+    std::size_t high = queue.size();
+    while (low < high)
+    {
+      const std::size_t mid = low + ((high - low) / 2);
+      if (queue[mid].Sequence < beginSequence)
+      {
+        low = mid + 1;
+      }
+      else
+      {
+        high = mid;
+      }
+    }
+    return low;
+  }
+}
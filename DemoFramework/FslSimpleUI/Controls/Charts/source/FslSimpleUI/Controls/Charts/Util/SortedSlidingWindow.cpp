@@ -0,0 +1,138 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Controls/Charts/Util/SortedSlidingWindow.hpp>
+#include <algorithm>
+#include <cassert>
+#include <stdexcept>
+
+namespace Fsl::UI
+{
+  SortedSlidingWindow::SortedSlidingWindow()
+    : m_arrivalOrder(1u)
+  {
+  }
+
+
+  uint32_t SortedSlidingWindow::Oldest() const
+  {
+    if (m_arrivalOrder.empty())
+    {
+      throw std::invalid_argument("window is empty");
+    }
+    return m_arrivalOrder.front();
+  }
+
+
+  void SortedSlidingWindow::Clear() noexcept
+  {
+    m_arrivalOrder.clear();
+    m_sorted.clear();
+  }
+
+
+  void SortedSlidingWindow::Assign(const ReadOnlySpan<uint32_t> valuesInArrivalOrder)
+  {
+    Clear();
+    if (valuesInArrivalOrder.size() > m_arrivalOrder.capacity())
+    {
+      m_arrivalOrder.grow(valuesInArrivalOrder.size() - m_arrivalOrder.capacity());
+    }
+    for (const uint32_t value : valuesInArrivalOrder)
+    {
+      m_arrivalOrder.push_back(value);
+    }
+    m_sorted.assign(valuesInArrivalOrder.begin(), valuesInArrivalOrder.end());
+    std::sort(m_sorted.begin(), m_sorted.end());
+  }
+
+
+  void SortedSlidingWindow::Push(const uint32_t value)
+  {
+    EnsureArrivalCapacity();
+    m_arrivalOrder.push_back(value);
+    // Inserting after all equal values keeps the move as small as possible
+    m_sorted.insert(std::upper_bound(m_sorted.begin(), m_sorted.end(), value), value);
+  }
+
+
+  void SortedSlidingWindow::Pop()
+  {
+    if (m_arrivalOrder.empty())
+    {
+      throw std::invalid_argument("window is empty");
+    }
+    const uint32_t oldValue = m_arrivalOrder.front();
+    m_arrivalOrder.pop_front();
+    auto itrFind = std::lower_bound(m_sorted.begin(), m_sorted.end(), oldValue);
+    assert(itrFind != m_sorted.end() && *itrFind == oldValue);
+    m_sorted.erase(itrFind);
+  }
+
+
+  void SortedSlidingWindow::Slide(const uint32_t value)
+  {
+    if (m_arrivalOrder.empty())
+    {
+      Push(value);
+      return;
+    }
+    const uint32_t oldValue = m_arrivalOrder.front();
+    m_arrivalOrder.pop_front();
+    m_arrivalOrder.push_back(value);
+
+    const auto itrOld = std::lower_bound(m_sorted.begin(), m_sorted.end(), oldValue);
+    assert(itrOld != m_sorted.end() && *itrOld == oldValue);
+    if (oldValue <= value)
+    {
+      // Shift the values in the range (oldValue, value] one step towards the front and store the new value after them
+      const auto itrNew = std::upper_bound(itrOld + 1, m_sorted.end(), value);
+      std::move(itrOld + 1, itrNew, itrOld);
+      *(itrNew - 1) = value;
+    }
+    else
+    {
+      // Shift the values in the range (value, oldValue) one step towards the back and store the new value in front of them
+      const auto itrNew = std::upper_bound(m_sorted.begin(), itrOld, value);
+      std::move_backward(itrNew, itrOld, itrOld + 1);
+      *itrNew = value;
+    }
+  }
+
+
+  void SortedSlidingWindow::EnsureArrivalCapacity()
+  {
+    if (m_arrivalOrder.size() >= m_arrivalOrder.capacity())
+    {
+      m_arrivalOrder.grow(m_arrivalOrder.capacity());
+    }
+  }
+}
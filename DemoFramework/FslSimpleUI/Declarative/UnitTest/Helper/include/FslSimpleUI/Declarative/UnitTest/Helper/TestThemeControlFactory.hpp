@@ -0,0 +1,280 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UNITTEST_HELPER_TESTTHEMECONTROLFACTORY_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UNITTEST_HELPER_TESTTHEMECONTROLFACTORY_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Theme/Base/IThemeControlFactory.hpp>
+#include <memory>
+#include <string>
+
+namespace Fsl::UI
+{
+  //! @brief A theme control factory for unit tests and benchmarks that does not need any theme resources.
+  //!        It creates unstyled labels, text buttons, bars and background windows and records the theme values it was asked for
+  //!        and the last label and text button it created.
+  //!        All the other themed control creation methods throw a NotSupportedException.
+  class TestThemeControlFactory final : public Theme::IThemeControlFactory
+  {
+    std::shared_ptr<WindowContext> m_context;
+    Theme::ButtonType m_lastButtonType{Theme::ButtonType::Text};
+    Theme::BarType m_lastBarType{Theme::BarType::Normal};
+    Theme::WindowType m_lastWindowType{Theme::WindowType::Normal};
+    std::weak_ptr<Label> m_lastLabel;
+    std::weak_ptr<BackgroundLabelButton> m_lastTextButton;
+
+  public:
+    explicit TestThemeControlFactory(std::shared_ptr<WindowContext> context);
+    ~TestThemeControlFactory() override;
+
+    Theme::ButtonType GetLastButtonType() const noexcept
+    {
+      return m_lastButtonType;
+    }
+
+    Theme::BarType GetLastBarType() const noexcept
+    {
+      return m_lastBarType;
+    }
+
+    Theme::WindowType GetLastWindowType() const noexcept
+    {
+      return m_lastWindowType;
+    }
+
+    //! @brief Get the last label created, or null if it has been destroyed
+    std::shared_ptr<Label> GetLastLabel() const noexcept
+    {
+      return m_lastLabel.lock();
+    }
+
+    //! @brief Get the last text button created, or null if it has been destroyed
+    std::shared_ptr<BackgroundLabelButton> GetLastTextButton() const noexcept
+    {
+      return m_lastTextButton.lock();
+    }
+
+    const std::shared_ptr<WindowContext>& GetContext() const final
+    {
+      return m_context;
+    }
+
+    const Theme::IThemeResources& GetResources() const final;
+    UIColor GetThemePrimaryDarkColor() const final;
+    DpThicknessF GetDefaultMarginDp(const Theme::ElementType elementType) const final;
+
+    // ----- CreateScrollViewer
+
+    std::shared_ptr<ScrollViewer> CreateScrollViewer(const std::shared_ptr<BaseWindow>& content, const ScrollModeFlags scrollMode,
+                                                     const bool clipContent) final;
+
+    // ----- CreateDivider
+
+    std::shared_ptr<Image> CreateDivider(const LayoutOrientation orientation) final;
+
+    // ----- CreateLabel
+
+    std::shared_ptr<Label> CreateLabel(const StringViewLite& strView, const Theme::FontType fontType) final;
+    std::shared_ptr<Label> CreateLabel(std::string&& str, const Theme::FontType fontType) final;
+    std::shared_ptr<Label> CreateLabel(const char* const psz, const Theme::FontType fontType) final;
+    std::shared_ptr<Label> CreateLabel(const std::string& str, const Theme::FontType fontType) final;
+
+    // ----- CreateImageButton
+
+    std::shared_ptr<ImageButton> CreateImageButton(const Theme::ImageButtonType buttonType, std::shared_ptr<ImageSprite> sprite) final;
+    std::shared_ptr<SimpleImageButton> CreateImageButton(std::shared_ptr<ImageSprite> sprite) final;
+
+    // ----- CreateTextButton
+
+    std::shared_ptr<BackgroundLabelButton> CreateTextButton(const Theme::ButtonType buttonType) final;
+    std::shared_ptr<BackgroundLabelButton> CreateTextButton(const Theme::ButtonType buttonType, const StringViewLite& strView) final;
+    std::shared_ptr<BackgroundLabelButton> CreateTextButton(const Theme::ButtonType buttonType, std::string&& str) final;
+    std::shared_ptr<BackgroundLabelButton> CreateTextButton(const Theme::ButtonType buttonType, const char* const psz) final;
+    std::shared_ptr<BackgroundLabelButton> CreateTextButton(const Theme::ButtonType buttonType, const std::string& str) final;
+
+    // ----- CreateCheckBox
+
+    std::shared_ptr<CheckBox> CreateCheckBox(const bool checked) final;
+    std::shared_ptr<CheckBox> CreateCheckBox(const StringViewLite& strView, const bool checked) final;
+    std::shared_ptr<CheckBox> CreateCheckBox(std::string&& str, const bool checked) final;
+    std::shared_ptr<CheckBox> CreateCheckBox(const char* const psz, const bool checked) final;
+    std::shared_ptr<CheckBox> CreateCheckBox(const std::string& str, const bool checked) final;
+
+    // ----- CreateRadioGroup
+
+    std::shared_ptr<RadioGroup> CreateRadioGroup(const StringViewLite& name) final;
+
+    // ----- CreateRadioButton
+
+    std::shared_ptr<RadioButton> CreateRadioButton(const std::shared_ptr<RadioGroup>& radioGroup, const bool checked) final;
+    std::shared_ptr<RadioButton> CreateRadioButton(const std::shared_ptr<RadioGroup>& radioGroup, const StringViewLite& strView,
+                                                   const bool checked) final;
+    std::shared_ptr<RadioButton> CreateRadioButton(const std::shared_ptr<RadioGroup>& radioGroup, std::string&& str, const bool checked) final;
+    std::shared_ptr<RadioButton> CreateRadioButton(const std::shared_ptr<RadioGroup>& radioGroup, const char* const psz, const bool checked) final;
+    std::shared_ptr<RadioButton> CreateRadioButton(const std::shared_ptr<RadioGroup>& radioGroup, const std::string& str, const bool checked) final;
+
+    // ----- CreateSwitch
+
+    std::shared_ptr<Switch> CreateSwitch(const bool checked) final;
+    std::shared_ptr<Switch> CreateSwitch(const StringViewLite& strView, const bool checked) final;
+    std::shared_ptr<Switch> CreateSwitch(std::string&& str, const bool checked) final;
+    std::shared_ptr<Switch> CreateSwitch(const char* const psz, const bool checked) final;
+    std::shared_ptr<Switch> CreateSwitch(const std::string& str, const bool checked) final;
+
+    // ----- CreateImage
+
+    std::shared_ptr<Image> CreateImage(const std::shared_ptr<BasicImageSprite>& spriteImage) final;
+    std::shared_ptr<Image> CreateImage(const std::shared_ptr<BasicNineSliceSprite>& spriteImage) final;
+    std::shared_ptr<Image> CreateImage(const std::shared_ptr<ImageSprite>& spriteImage) final;
+    std::shared_ptr<Image> CreateImage(const std::shared_ptr<INineSliceSprite>& spriteImage) final;
+
+    // ----- CreateLeftBar
+
+    std::shared_ptr<Background> CreateLeftBar(const Theme::BarType barType) final;
+    std::shared_ptr<Background> CreateLeftBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType) final;
+
+    // ----- CreateTopBar
+
+    std::shared_ptr<Background> CreateTopBar(const Theme::BarType barType) final;
+    std::shared_ptr<Background> CreateTopBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType) final;
+
+    // ----- CreateRightBar
+
+    std::shared_ptr<Background> CreateRightBar(const Theme::BarType barType) final;
+    std::shared_ptr<Background> CreateRightBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType) final;
+
+    // ----- CreateBottomBar
+
+    std::shared_ptr<Background> CreateBottomBar(const Theme::BarType barType) final;
+    std::shared_ptr<Background> CreateBottomBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType) final;
+
+    // ----- CreateBackgroundWindow
+
+    std::shared_ptr<Background> CreateBackgroundWindow(const Theme::WindowType windowType) final;
+    std::shared_ptr<Background> CreateBackgroundWindow(const Theme::WindowType windowType, const std::shared_ptr<BaseWindow>& content) final;
+    std::shared_ptr<Background> CreateBackgroundWindow(const Theme::WindowType windowType, const std::shared_ptr<BaseWindow>& content,
+                                                       const UI::ItemAlignment alignment) final;
+    std::shared_ptr<Background> CreateBackgroundWindow(const Theme::WindowType windowType, const std::shared_ptr<BaseWindow>& content,
+                                                       const UI::ItemAlignment alignmentX, const UI::ItemAlignment alignmentY) final;
+
+    // ----- CreateFmtValueLabel
+
+    std::shared_ptr<FmtValueLabel<uint8_t>> CreateFmtValueLabel(const uint8_t value) final;
+    std::shared_ptr<FmtValueLabel<uint8_t>> CreateFmtValueLabel(const uint8_t value, const StringViewLite& strViewFormat) final;
+    std::shared_ptr<FmtValueLabel<uint8_t>> CreateFmtValueLabel(const uint8_t value, std::string&& strFormat) final;
+    std::shared_ptr<FmtValueLabel<uint8_t>> CreateFmtValueLabel(const uint8_t value, const char* const pszFormat) final;
+    std::shared_ptr<FmtValueLabel<uint8_t>> CreateFmtValueLabel(const uint8_t value, const std::string& strFormat) final;
+    std::shared_ptr<FmtValueLabel<int32_t>> CreateFmtValueLabel(const int32_t value) final;
+    std::shared_ptr<FmtValueLabel<int32_t>> CreateFmtValueLabel(const int32_t value, const StringViewLite& strViewFormat) final;
+    std::shared_ptr<FmtValueLabel<int32_t>> CreateFmtValueLabel(const int32_t value, std::string&& strFormat) final;
+    std::shared_ptr<FmtValueLabel<int32_t>> CreateFmtValueLabel(const int32_t value, const char* const pszFormat) final;
+    std::shared_ptr<FmtValueLabel<int32_t>> CreateFmtValueLabel(const int32_t value, const std::string& strFormat) final;
+    std::shared_ptr<FmtValueLabel<uint32_t>> CreateFmtValueLabel(const uint32_t value) final;
+    std::shared_ptr<FmtValueLabel<uint32_t>> CreateFmtValueLabel(const uint32_t value, const StringViewLite& strViewFormat) final;
+    std::shared_ptr<FmtValueLabel<uint32_t>> CreateFmtValueLabel(const uint32_t value, std::string&& strFormat) final;
+    std::shared_ptr<FmtValueLabel<uint32_t>> CreateFmtValueLabel(const uint32_t value, const char* const pszFormat) final;
+    std::shared_ptr<FmtValueLabel<uint32_t>> CreateFmtValueLabel(const uint32_t value, const std::string& strFormat) final;
+    std::shared_ptr<FmtValueLabel<uint64_t>> CreateFmtValueLabel(const uint64_t value) final;
+    std::shared_ptr<FmtValueLabel<uint64_t>> CreateFmtValueLabel(const uint64_t value, const StringViewLite& strViewFormat) final;
+    std::shared_ptr<FmtValueLabel<uint64_t>> CreateFmtValueLabel(const uint64_t value, std::string&& strFormat) final;
+    std::shared_ptr<FmtValueLabel<uint64_t>> CreateFmtValueLabel(const uint64_t value, const char* const pszFormat) final;
+    std::shared_ptr<FmtValueLabel<uint64_t>> CreateFmtValueLabel(const uint64_t value, const std::string& strFormat) final;
+    std::shared_ptr<FmtValueLabel<float>> CreateFmtValueLabel(const float value) final;
+    std::shared_ptr<FmtValueLabel<float>> CreateFmtValueLabel(const float value, const StringViewLite& strViewFormat) final;
+    std::shared_ptr<FmtValueLabel<float>> CreateFmtValueLabel(const float value, std::string&& strFormat) final;
+    std::shared_ptr<FmtValueLabel<float>> CreateFmtValueLabel(const float value, const char* const pszFormat) final;
+    std::shared_ptr<FmtValueLabel<float>> CreateFmtValueLabel(const float value, const std::string& strFormat) final;
+
+    // ----- CreateFloatingButton
+
+    std::shared_ptr<ButtonBase> CreateFloatingButton(const Theme::FloatingButtonType type) final;
+
+    // ----- CreateSlider
+
+    std::shared_ptr<Slider<uint8_t>> CreateSlider(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                  const Theme::SliderConfig& config) final;
+    std::shared_ptr<Slider<int32_t>> CreateSlider(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                  const Theme::SliderConfig& config) final;
+    std::shared_ptr<Slider<uint32_t>> CreateSlider(const LayoutOrientation orientation, const ConstrainedValue<uint32_t>& value,
+                                                   const Theme::SliderConfig& config) final;
+    std::shared_ptr<Slider<float>> CreateSlider(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                const Theme::SliderConfig& config) final;
+
+    // ----- CreateSliderFmtValue
+
+    std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                                          const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                                          const StringViewLite& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                                          std::string&& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                                          const char* const pszFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<uint8_t>& value,
+                                                                          const std::string& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<int32_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                                          const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<int32_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                                          const StringViewLite& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<int32_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                                          std::string&& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<int32_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                                          const char* const pszFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<int32_t>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<int32_t>& value,
+                                                                          const std::string& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> CreateSliderFmtValue(const LayoutOrientation orientation,
+                                                                           const ConstrainedValue<uint32_t>& value,
+                                                                           const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> CreateSliderFmtValue(const LayoutOrientation orientation,
+                                                                           const ConstrainedValue<uint32_t>& value, const StringViewLite& strFormat,
+                                                                           const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> CreateSliderFmtValue(const LayoutOrientation orientation,
+                                                                           const ConstrainedValue<uint32_t>& value, std::string&& strFormat,
+                                                                           const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> CreateSliderFmtValue(const LayoutOrientation orientation,
+                                                                           const ConstrainedValue<uint32_t>& value, const char* const pszFormat,
+                                                                           const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> CreateSliderFmtValue(const LayoutOrientation orientation,
+                                                                           const ConstrainedValue<uint32_t>& value, const std::string& strFormat,
+                                                                           const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<float>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                                        const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<float>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                                        const StringViewLite& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<float>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                                        std::string&& strFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<float>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                                        const char* const pszFormat, const Theme::SliderConfig& config) final;
+    std::shared_ptr<SliderAndFmtValueLabel<float>> CreateSliderFmtValue(const LayoutOrientation orientation, const ConstrainedValue<float>& value,
+                                                                        const std::string& strFormat, const Theme::SliderConfig& config) final;
+  };
+}
+
+#endif
@@ -0,0 +1,777 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslSimpleUI/Base/Control/Background.hpp>
+#include <FslSimpleUI/Base/Control/BackgroundLabelButton.hpp>
+#include <FslSimpleUI/Base/Control/Label.hpp>
+#include <FslSimpleUI/Declarative/UnitTest/Helper/TestThemeControlFactory.hpp>
+#include <utility>
+
+namespace Fsl::UI
+{
+  TestThemeControlFactory::TestThemeControlFactory(std::shared_ptr<WindowContext> context)
+    : m_context(std::move(context))
+  {
+    if (!m_context)
+    {
+      throw std::invalid_argument("context can not be null");
+    }
+  }
+
+
+  TestThemeControlFactory::~TestThemeControlFactory() = default;
+
+
+  const Theme::IThemeResources& TestThemeControlFactory::GetResources() const
+  {
+    throw NotSupportedException("TestThemeControlFactory does not provide any theme resources");
+  }
+
+
+  UIColor TestThemeControlFactory::GetThemePrimaryDarkColor() const
+  {
+    return {};
+  }
+
+
+  DpThicknessF TestThemeControlFactory::GetDefaultMarginDp(const Theme::ElementType /*elementType*/) const
+  {
+    return {};
+  }
+
+
+  std::shared_ptr<ScrollViewer> TestThemeControlFactory::CreateScrollViewer(const std::shared_ptr<BaseWindow>& /*content*/,
+                                                                            const ScrollModeFlags /*scrollMode*/, const bool /*clipContent*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateScrollViewer");
+  }
+
+
+  std::shared_ptr<Image> TestThemeControlFactory::CreateDivider(const LayoutOrientation /*orientation*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateDivider");
+  }
+
+
+  std::shared_ptr<Label> TestThemeControlFactory::CreateLabel(const StringViewLite& strView, const Theme::FontType /*fontType*/)
+  {
+    auto label = std::make_shared<Label>(m_context);
+    m_lastLabel = label;
+    label->SetContent(strView);
+    label->FinishAnimation();
+    return label;
+  }
+
+
+  std::shared_ptr<Label> TestThemeControlFactory::CreateLabel(std::string&& str, const Theme::FontType /*fontType*/)
+  {
+    auto label = std::make_shared<Label>(m_context);
+    m_lastLabel = label;
+    label->SetContent(std::move(str));
+    label->FinishAnimation();
+    return label;
+  }
+
+
+  std::shared_ptr<Label> TestThemeControlFactory::CreateLabel(const char* const psz, const Theme::FontType /*fontType*/)
+  {
+    auto label = std::make_shared<Label>(m_context);
+    m_lastLabel = label;
+    label->SetContent(psz);
+    label->FinishAnimation();
+    return label;
+  }
+
+
+  std::shared_ptr<Label> TestThemeControlFactory::CreateLabel(const std::string& str, const Theme::FontType /*fontType*/)
+  {
+    auto label = std::make_shared<Label>(m_context);
+    m_lastLabel = label;
+    label->SetContent(str);
+    label->FinishAnimation();
+    return label;
+  }
+
+
+  std::shared_ptr<ImageButton> TestThemeControlFactory::CreateImageButton(const Theme::ImageButtonType /*buttonType*/,
+                                                                          std::shared_ptr<ImageSprite> /*sprite*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImageButton");
+  }
+
+
+  std::shared_ptr<SimpleImageButton> TestThemeControlFactory::CreateImageButton(std::shared_ptr<ImageSprite> /*sprite*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImageButton");
+  }
+
+
+  std::shared_ptr<BackgroundLabelButton> TestThemeControlFactory::CreateTextButton(const Theme::ButtonType buttonType)
+  {
+    m_lastButtonType = buttonType;
+    auto button = std::make_shared<BackgroundLabelButton>(m_context);
+    m_lastTextButton = button;
+    button->FinishAnimation();
+    return button;
+  }
+
+
+  std::shared_ptr<BackgroundLabelButton> TestThemeControlFactory::CreateTextButton(const Theme::ButtonType buttonType, const StringViewLite& strView)
+  {
+    auto button = CreateTextButton(buttonType);
+    button->SetContent(strView);
+    button->FinishAnimation();
+    return button;
+  }
+
+
+  std::shared_ptr<BackgroundLabelButton> TestThemeControlFactory::CreateTextButton(const Theme::ButtonType buttonType, std::string&& str)
+  {
+    auto button = CreateTextButton(buttonType);
+    button->SetContent(std::move(str));
+    button->FinishAnimation();
+    return button;
+  }
+
+
+  std::shared_ptr<BackgroundLabelButton> TestThemeControlFactory::CreateTextButton(const Theme::ButtonType buttonType, const char* const psz)
+  {
+    auto button = CreateTextButton(buttonType);
+    button->SetContent(psz);
+    button->FinishAnimation();
+    return button;
+  }
+
+
+  std::shared_ptr<BackgroundLabelButton> TestThemeControlFactory::CreateTextButton(const Theme::ButtonType buttonType, const std::string& str)
+  {
+    auto button = CreateTextButton(buttonType);
+    button->SetContent(str);
+    button->FinishAnimation();
+    return button;
+  }
+
+
+  std::shared_ptr<CheckBox> TestThemeControlFactory::CreateCheckBox(const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateCheckBox");
+  }
+
+
+  std::shared_ptr<CheckBox> TestThemeControlFactory::CreateCheckBox(const StringViewLite& /*strView*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateCheckBox");
+  }
+
+
+  std::shared_ptr<CheckBox> TestThemeControlFactory::CreateCheckBox(std::string&& /*str*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateCheckBox");
+  }
+
+
+  std::shared_ptr<CheckBox> TestThemeControlFactory::CreateCheckBox(const char* const /*psz*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateCheckBox");
+  }
+
+
+  std::shared_ptr<CheckBox> TestThemeControlFactory::CreateCheckBox(const std::string& /*str*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateCheckBox");
+  }
+
+
+  std::shared_ptr<RadioGroup> TestThemeControlFactory::CreateRadioGroup(const StringViewLite& /*name*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioGroup");
+  }
+
+
+  std::shared_ptr<RadioButton> TestThemeControlFactory::CreateRadioButton(const std::shared_ptr<RadioGroup>& /*radioGroup*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioButton");
+  }
+
+
+  std::shared_ptr<RadioButton> TestThemeControlFactory::CreateRadioButton(const std::shared_ptr<RadioGroup>& /*radioGroup*/,
+                                                                          const StringViewLite& /*strView*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioButton");
+  }
+
+
+  std::shared_ptr<RadioButton> TestThemeControlFactory::CreateRadioButton(const std::shared_ptr<RadioGroup>& /*radioGroup*/, std::string&& /*str*/,
+                                                                          const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioButton");
+  }
+
+
+  std::shared_ptr<RadioButton> TestThemeControlFactory::CreateRadioButton(const std::shared_ptr<RadioGroup>& /*radioGroup*/,
+                                                                          const char* const /*psz*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioButton");
+  }
+
+
+  std::shared_ptr<RadioButton> TestThemeControlFactory::CreateRadioButton(const std::shared_ptr<RadioGroup>& /*radioGroup*/,
+                                                                          const std::string& /*str*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateRadioButton");
+  }
+
+
+  std::shared_ptr<Switch> TestThemeControlFactory::CreateSwitch(const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSwitch");
+  }
+
+
+  std::shared_ptr<Switch> TestThemeControlFactory::CreateSwitch(const StringViewLite& /*strView*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSwitch");
+  }
+
+
+  std::shared_ptr<Switch> TestThemeControlFactory::CreateSwitch(std::string&& /*str*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSwitch");
+  }
+
+
+  std::shared_ptr<Switch> TestThemeControlFactory::CreateSwitch(const char* const /*psz*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSwitch");
+  }
+
+
+  std::shared_ptr<Switch> TestThemeControlFactory::CreateSwitch(const std::string& /*str*/, const bool /*checked*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSwitch");
+  }
+
+
+  std::shared_ptr<Image> TestThemeControlFactory::CreateImage(const std::shared_ptr<BasicImageSprite>& /*spriteImage*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImage");
+  }
+
+
+  std::shared_ptr<Image> TestThemeControlFactory::CreateImage(const std::shared_ptr<BasicNineSliceSprite>& /*spriteImage*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImage");
+  }
+
+
+  std::shared_ptr<Image> TestThemeControlFactory::CreateImage(const std::shared_ptr<ImageSprite>& /*spriteImage*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImage");
+  }
+
+
+  std::shared_ptr<Image> TestThemeControlFactory::CreateImage(const std::shared_ptr<INineSliceSprite>& /*spriteImage*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateImage");
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateLeftBar(const Theme::BarType barType)
+  {
+    m_lastBarType = barType;
+    auto bar = std::make_shared<Background>(m_context);
+    bar->FinishAnimation();
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateLeftBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType)
+  {
+    auto bar = CreateLeftBar(barType);
+    bar->SetContent(content);
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateTopBar(const Theme::BarType barType)
+  {
+    m_lastBarType = barType;
+    auto bar = std::make_shared<Background>(m_context);
+    bar->FinishAnimation();
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateTopBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType)
+  {
+    auto bar = CreateTopBar(barType);
+    bar->SetContent(content);
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateRightBar(const Theme::BarType barType)
+  {
+    m_lastBarType = barType;
+    auto bar = std::make_shared<Background>(m_context);
+    bar->FinishAnimation();
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateRightBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType)
+  {
+    auto bar = CreateRightBar(barType);
+    bar->SetContent(content);
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBottomBar(const Theme::BarType barType)
+  {
+    m_lastBarType = barType;
+    auto bar = std::make_shared<Background>(m_context);
+    bar->FinishAnimation();
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBottomBar(const std::shared_ptr<BaseWindow>& content, const Theme::BarType barType)
+  {
+    auto bar = CreateBottomBar(barType);
+    bar->SetContent(content);
+    return bar;
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBackgroundWindow(const Theme::WindowType windowType)
+  {
+    return CreateBackgroundWindow(windowType, {}, UI::ItemAlignment::Stretch, UI::ItemAlignment::Stretch);
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBackgroundWindow(const Theme::WindowType windowType,
+                                                                              const std::shared_ptr<BaseWindow>& content)
+  {
+    return CreateBackgroundWindow(windowType, content, UI::ItemAlignment::Stretch, UI::ItemAlignment::Stretch);
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBackgroundWindow(const Theme::WindowType windowType,
+                                                                              const std::shared_ptr<BaseWindow>& content,
+                                                                              const UI::ItemAlignment alignment)
+  {
+    return CreateBackgroundWindow(windowType, content, alignment, alignment);
+  }
+
+
+  std::shared_ptr<Background> TestThemeControlFactory::CreateBackgroundWindow(const Theme::WindowType windowType,
+                                                                              const std::shared_ptr<BaseWindow>& content,
+                                                                              const UI::ItemAlignment alignmentX, const UI::ItemAlignment alignmentY)
+  {
+    m_lastWindowType = windowType;
+    auto background = std::make_shared<Background>(m_context);
+    background->SetContent(content);
+    background->SetAlignmentX(alignmentX);
+    background->SetAlignmentY(alignmentY);
+    background->FinishAnimation();
+    return background;
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint8_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint8_t /*value*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint8_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint8_t /*value*/,
+                                                                                       const StringViewLite& /*strViewFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint8_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint8_t /*value*/, std::string&& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint8_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint8_t /*value*/, const char* const /*pszFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint8_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint8_t /*value*/, const std::string& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<int32_t>> TestThemeControlFactory::CreateFmtValueLabel(const int32_t /*value*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<int32_t>> TestThemeControlFactory::CreateFmtValueLabel(const int32_t /*value*/,
+                                                                                       const StringViewLite& /*strViewFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<int32_t>> TestThemeControlFactory::CreateFmtValueLabel(const int32_t /*value*/, std::string&& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<int32_t>> TestThemeControlFactory::CreateFmtValueLabel(const int32_t /*value*/, const char* const /*pszFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<int32_t>> TestThemeControlFactory::CreateFmtValueLabel(const int32_t /*value*/, const std::string& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint32_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint32_t /*value*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint32_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint32_t /*value*/,
+                                                                                        const StringViewLite& /*strViewFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint32_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint32_t /*value*/, std::string&& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint32_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint32_t /*value*/, const char* const /*pszFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint32_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint32_t /*value*/, const std::string& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint64_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint64_t /*value*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint64_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint64_t /*value*/,
+                                                                                        const StringViewLite& /*strViewFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint64_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint64_t /*value*/, std::string&& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint64_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint64_t /*value*/, const char* const /*pszFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<uint64_t>> TestThemeControlFactory::CreateFmtValueLabel(const uint64_t /*value*/, const std::string& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<float>> TestThemeControlFactory::CreateFmtValueLabel(const float /*value*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<float>> TestThemeControlFactory::CreateFmtValueLabel(const float /*value*/, const StringViewLite& /*strViewFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<float>> TestThemeControlFactory::CreateFmtValueLabel(const float /*value*/, std::string&& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<float>> TestThemeControlFactory::CreateFmtValueLabel(const float /*value*/, const char* const /*pszFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<FmtValueLabel<float>> TestThemeControlFactory::CreateFmtValueLabel(const float /*value*/, const std::string& /*strFormat*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFmtValueLabel");
+  }
+
+
+  std::shared_ptr<ButtonBase> TestThemeControlFactory::CreateFloatingButton(const Theme::FloatingButtonType /*type*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateFloatingButton");
+  }
+
+
+  std::shared_ptr<Slider<uint8_t>> TestThemeControlFactory::CreateSlider(const LayoutOrientation /*orientation*/,
+                                                                         const ConstrainedValue<uint8_t>& /*value*/,
+                                                                         const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSlider");
+  }
+
+
+  std::shared_ptr<Slider<int32_t>> TestThemeControlFactory::CreateSlider(const LayoutOrientation /*orientation*/,
+                                                                         const ConstrainedValue<int32_t>& /*value*/,
+                                                                         const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSlider");
+  }
+
+
+  std::shared_ptr<Slider<uint32_t>> TestThemeControlFactory::CreateSlider(const LayoutOrientation /*orientation*/,
+                                                                          const ConstrainedValue<uint32_t>& /*value*/,
+                                                                          const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSlider");
+  }
+
+
+  std::shared_ptr<Slider<float>> TestThemeControlFactory::CreateSlider(const LayoutOrientation /*orientation*/,
+                                                                       const ConstrainedValue<float>& /*value*/,
+                                                                       const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSlider");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<uint8_t>& /*value*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<uint8_t>& /*value*/,
+                                                                                                 const StringViewLite& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<uint8_t>& /*value*/,
+                                                                                                 std::string&& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<uint8_t>& /*value*/,
+                                                                                                 const char* const /*pszFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint8_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<uint8_t>& /*value*/,
+                                                                                                 const std::string& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<int32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<int32_t>& /*value*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<int32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<int32_t>& /*value*/,
+                                                                                                 const StringViewLite& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<int32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<int32_t>& /*value*/,
+                                                                                                 std::string&& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<int32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<int32_t>& /*value*/,
+                                                                                                 const char* const /*pszFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<int32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                 const ConstrainedValue<int32_t>& /*value*/,
+                                                                                                 const std::string& /*strFormat*/,
+                                                                                                 const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                  const ConstrainedValue<uint32_t>& /*value*/,
+                                                                                                  const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                  const ConstrainedValue<uint32_t>& /*value*/,
+                                                                                                  const StringViewLite& /*strFormat*/,
+                                                                                                  const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                  const ConstrainedValue<uint32_t>& /*value*/,
+                                                                                                  std::string&& /*strFormat*/,
+                                                                                                  const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                  const ConstrainedValue<uint32_t>& /*value*/,
+                                                                                                  const char* const /*pszFormat*/,
+                                                                                                  const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<uint32_t>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                                  const ConstrainedValue<uint32_t>& /*value*/,
+                                                                                                  const std::string& /*strFormat*/,
+                                                                                                  const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<float>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                               const ConstrainedValue<float>& /*value*/,
+                                                                                               const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<float>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                               const ConstrainedValue<float>& /*value*/,
+                                                                                               const StringViewLite& /*strFormat*/,
+                                                                                               const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<float>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                               const ConstrainedValue<float>& /*value*/,
+                                                                                               std::string&& /*strFormat*/,
+                                                                                               const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<float>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                               const ConstrainedValue<float>& /*value*/,
+                                                                                               const char* const /*pszFormat*/,
+                                                                                               const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+
+
+  std::shared_ptr<SliderAndFmtValueLabel<float>> TestThemeControlFactory::CreateSliderFmtValue(const LayoutOrientation /*orientation*/,
+                                                                                               const ConstrainedValue<float>& /*value*/,
+                                                                                               const std::string& /*strFormat*/,
+                                                                                               const Theme::SliderConfig& /*config*/)
+  {
+    throw NotSupportedException("TestThemeControlFactory does not support CreateSliderFmtValue");
+  }
+}
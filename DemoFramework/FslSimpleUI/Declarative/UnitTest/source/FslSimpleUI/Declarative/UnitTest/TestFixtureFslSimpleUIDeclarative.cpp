@@ -0,0 +1,71 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Math/BasicWindowMetrics.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslGraphics/Sprite/Font/SpriteFont.hpp>
+#include <FslSimpleUI/Base/WindowContext.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCompiler.hpp>
+#include <FslSimpleUI/Declarative/UnitTest/Helper/TestThemeControlFactory.hpp>
+#include <FslSimpleUI/Render/Stub/RenderSystem.hpp>
+#include "TestFixtureFslSimpleUIDeclarative.hpp"
+
+using namespace Fsl;
+
+namespace
+{
+  namespace LocalConfig
+  {
+    constexpr uint32_t DensityDpi = 160;
+  }
+}
+
+
+TestFixtureFslSimpleUIDeclarative::TestFixtureFslSimpleUIDeclarative()
+  : m_dataBindingService(std::make_shared<DataBinding::DataBindingService>())
+  , m_manager(m_dataBindingService, std::make_unique<UI::RenderStub::RenderSystem>(), UI::UIColorSpace::SRGBNonLinear, false,
+              BasicWindowMetrics(PxExtent2D::Create(800, 600), Vector2(LocalConfig::DensityDpi, LocalConfig::DensityDpi), LocalConfig::DensityDpi))
+  , m_windowContext(std::make_shared<UI::WindowContext>(m_manager.GetUIContext(), std::make_shared<SpriteFont>(), LocalConfig::DensityDpi,
+                                                        UI::UIColorSpace::SRGBNonLinear))
+  , m_themeControlFactory(std::make_shared<UI::TestThemeControlFactory>(m_windowContext))
+  , m_controlFactory(m_themeControlFactory)
+{
+}
+
+
+TestFixtureFslSimpleUIDeclarative::~TestFixtureFslSimpleUIDeclarative() = default;
+
+
+UI::Declarative::UITemplate TestFixtureFslSimpleUIDeclarative::Compile(const std::string_view xml)
+{
+  return UI::Declarative::UITemplateCompiler::CompileFromMemory(m_controlFactory,
+                                                                ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(xml.data()), xml.size()));
+}
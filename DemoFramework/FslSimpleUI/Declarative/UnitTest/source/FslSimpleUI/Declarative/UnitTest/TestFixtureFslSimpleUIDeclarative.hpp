@@ -0,0 +1,71 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_UNITTEST_TESTFIXTUREFSLSIMPLEUIDECLARATIVE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_UNITTEST_TESTFIXTUREFSLSIMPLEUIDECLARATIVE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Base/System/UIManager.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <memory>
+#include <string_view>
+
+namespace Fsl
+{
+  namespace DataBinding
+  {
+    class DataBindingService;
+  }
+  namespace UI
+  {
+    class TestThemeControlFactory;
+    class WindowContext;
+  }
+}
+
+//! A declarative control factory backed by the test theme, so the layouts, labels, text buttons, bars and background windows can be created
+class TestFixtureFslSimpleUIDeclarative : public TestFixtureFslBase
+{
+protected:
+  std::shared_ptr<Fsl::DataBinding::DataBindingService> m_dataBindingService;
+  Fsl::UI::UIManager m_manager;
+  std::shared_ptr<Fsl::UI::WindowContext> m_windowContext;
+  std::shared_ptr<Fsl::UI::TestThemeControlFactory> m_themeControlFactory;
+  Fsl::UI::Declarative::ControlFactory m_controlFactory;
+
+public:
+  TestFixtureFslSimpleUIDeclarative();
+  ~TestFixtureFslSimpleUIDeclarative() override;
+
+  Fsl::UI::Declarative::UITemplate Compile(const std::string_view xml);
+};
+
+#endif
@@ -0,0 +1,162 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  using Test_UITemplate = TestFixtureFslBase;
+
+  // "StackLayoutFillLayoutName"
+  std::string CreateStringData()
+  {
+    return "StackLayoutFillLayoutName";
+  }
+
+  std::vector<UITemplateRange> CreateStrings()
+  {
+    return {UITemplateRange(0, 11), UITemplateRange(11, 10), UITemplateRange(21, 4)};
+  }
+
+  std::vector<UITemplateNode> CreateNodes()
+  {
+    return {UITemplateNode(0, {}, UITemplateRange(0, 1), {}, {}, UITemplateRange(1, 2)), UITemplateNode(1, {}, {}, {}, {}, {}),
+            UITemplateNode(1, {}, {}, {}, {}, {})};
+  }
+
+  std::vector<UITemplateProperty> CreateProperties()
+  {
+    return {UITemplateProperty(2, 0, UITemplateValueType::Name, {1, 0, 0, 0})};
+  }
+
+  UITemplate CreateTemplate(std::vector<UITemplateNode> nodes, std::vector<UITemplateProperty> properties = CreateProperties())
+  {
+    return {CreateStringData(), CreateStrings(), std::move(nodes), {}, std::move(properties), {}};
+  }
+}
+
+
+TEST(Test_UITemplate, Construct_Default)
+{
+  UITemplate uiTemplate;
+
+  EXPECT_TRUE(uiTemplate.IsEmpty());
+  EXPECT_EQ(0u, uiTemplate.StringCount());
+  EXPECT_TRUE(uiTemplate.GetNodes().empty());
+}
+
+
+TEST(Test_UITemplate, Construct)
+{
+  UITemplate uiTemplate = CreateTemplate(CreateNodes());
+
+  EXPECT_FALSE(uiTemplate.IsEmpty());
+  ASSERT_EQ(3u, uiTemplate.StringCount());
+  EXPECT_EQ(StringViewLite("StackLayout"), uiTemplate.GetString(0));
+  EXPECT_EQ(StringViewLite("FillLayout"), uiTemplate.GetString(1));
+  EXPECT_EQ(StringViewLite("Name"), uiTemplate.GetString(2));
+  ASSERT_EQ(3u, uiTemplate.GetNodes().size());
+
+  const UITemplateNode& root = uiTemplate.GetNode(0);
+  EXPECT_EQ(UITemplateRange(1, 2), root.Children);
+  ASSERT_EQ(1u, uiTemplate.GetProperties(root).size());
+  EXPECT_EQ(UITemplateValueType::Name, uiTemplate.GetProperties(root)[0].Type);
+  EXPECT_TRUE(uiTemplate.GetProperties(uiTemplate.GetNode(1)).empty());
+}
+
+
+TEST(Test_UITemplate, Construct_InvalidStringRange)
+{
+  std::vector<UITemplateRange> strings = CreateStrings();
+  strings.back() = UITemplateRange(21, 5);
+  EXPECT_THROW(UITemplate(CreateStringData(), std::move(strings), CreateNodes(), {}, CreateProperties(), {}), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_InvalidClassNameId)
+{
+  std::vector<UITemplateNode> nodes = CreateNodes();
+  nodes[1].ClassNameId = 3;
+  EXPECT_THROW(CreateTemplate(std::move(nodes)), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_InvalidPropertyRange)
+{
+  std::vector<UITemplateNode> nodes = CreateNodes();
+  nodes[1].Properties = UITemplateRange(0, 2);
+  EXPECT_THROW(CreateTemplate(std::move(nodes)), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_InvalidPropertyPayloadStringId)
+{
+  EXPECT_THROW(CreateTemplate(CreateNodes(), {UITemplateProperty(2, 0, UITemplateValueType::Name, {3, 0, 0, 0})}), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_InvalidPropertyType)
+{
+  EXPECT_THROW(CreateTemplate(CreateNodes(), {UITemplateProperty(2, 0, UITemplateValueType::Count, {0, 0, 0, 0})}), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_ChildBeforeParent)
+{
+  std::vector<UITemplateNode> nodes = CreateNodes();
+  nodes[0].Children = UITemplateRange(1, 1);
+  nodes[2].Children = UITemplateRange(1, 1);
+  EXPECT_THROW(CreateTemplate(std::move(nodes)), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_ChildWithTwoParents)
+{
+  std::vector<UITemplateNode> nodes = CreateNodes();
+  nodes[1].Children = UITemplateRange(2, 1);
+  EXPECT_THROW(CreateTemplate(std::move(nodes)), std::invalid_argument);
+}
+
+
+TEST(Test_UITemplate, Construct_UnreachableNode)
+{
+  std::vector<UITemplateNode> nodes = CreateNodes();
+  nodes[0].Children = UITemplateRange(1, 1);
+  EXPECT_THROW(CreateTemplate(std::move(nodes)), std::invalid_argument);
+}
@@ -0,0 +1,142 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCache.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateSerializer.hpp>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <string_view>
+#include "TestFixtureFslSimpleUIDeclarative.hpp"
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  class Test_UITemplateCache : public TestFixtureFslSimpleUIDeclarative
+  {
+  protected:
+    IO::Path m_xmlPath;
+    IO::Path m_binaryPath;
+
+  public:
+    Test_UITemplateCache()
+      : m_xmlPath((std::filesystem::temp_directory_path() / "FslSimpleUI.Declarative.UnitTest.UITemplateCache.xml").string())
+      , m_binaryPath((std::filesystem::temp_directory_path() / "FslSimpleUI.Declarative.UnitTest.UITemplateCache.bin").string())
+    {
+      constexpr std::string_view Xml("<DeclarativeUITest><StackLayout Orientation=\"Horizontal\"><FillLayout/></StackLayout></DeclarativeUITest>");
+      IO::File::WriteAllText(m_xmlPath, std::string(Xml));
+    }
+
+    ~Test_UITemplateCache() override
+    {
+      std::error_code ec;
+      std::filesystem::remove(m_xmlPath.ToUTF8String(), ec);
+      std::filesystem::remove(m_binaryPath.ToUTF8String(), ec);
+    }
+  };
+}
+
+
+TEST_F(Test_UITemplateCache, Construct_Default)
+{
+  UITemplateCache cache;
+  EXPECT_EQ(0u, cache.Count());
+  EXPECT_FALSE(cache.Contains(m_xmlPath));
+}
+
+
+TEST_F(Test_UITemplateCache, GetOrLoad)
+{
+  UITemplateCache cache;
+  auto template0 = cache.GetOrLoad(m_controlFactory, m_xmlPath);
+  ASSERT_TRUE(template0);
+  EXPECT_EQ(2u, template0->GetNodes().size());
+  EXPECT_TRUE(cache.Contains(m_xmlPath));
+  EXPECT_EQ(1u, cache.Count());
+
+  // The second request is served from the cache
+  auto template1 = cache.GetOrLoad(m_controlFactory, m_xmlPath);
+  EXPECT_EQ(template0, template1);
+  EXPECT_EQ(1u, cache.Count());
+}
+
+
+TEST_F(Test_UITemplateCache, GetOrLoad_Binary)
+{
+  UITemplateCache cache;
+  auto xmlTemplate = cache.GetOrLoad(m_controlFactory, m_xmlPath);
+  ASSERT_TRUE(xmlTemplate);
+  UITemplateSerializer::Save(m_binaryPath, *xmlTemplate);
+
+  auto binaryTemplate = cache.GetOrLoad(m_controlFactory, m_binaryPath);
+  ASSERT_TRUE(binaryTemplate);
+  EXPECT_NE(xmlTemplate, binaryTemplate);
+  EXPECT_EQ(xmlTemplate->GetStringData(), binaryTemplate->GetStringData());
+  EXPECT_EQ(xmlTemplate->GetNodes().size(), binaryTemplate->GetNodes().size());
+  EXPECT_EQ(2u, cache.Count());
+}
+
+
+TEST_F(Test_UITemplateCache, Instantiate)
+{
+  UITemplateCache cache;
+  auto stack = std::dynamic_pointer_cast<UI::StackLayout>(cache.Instantiate(m_controlFactory, m_dataBindingService, m_xmlPath));
+  ASSERT_TRUE(stack);
+  EXPECT_EQ(UI::LayoutOrientation::Horizontal, stack->GetOrientation());
+  EXPECT_EQ(1u, stack->GetChildCount());
+}
+
+
+TEST_F(Test_UITemplateCache, Remove)
+{
+  UITemplateCache cache;
+  cache.GetOrLoad(m_controlFactory, m_xmlPath);
+
+  EXPECT_TRUE(cache.Remove(m_xmlPath));
+  EXPECT_FALSE(cache.Remove(m_xmlPath));
+  EXPECT_FALSE(cache.Contains(m_xmlPath));
+  EXPECT_EQ(0u, cache.Count());
+}
+
+
+TEST_F(Test_UITemplateCache, Clear)
+{
+  UITemplateCache cache;
+  cache.GetOrLoad(m_controlFactory, m_xmlPath);
+
+  cache.Clear();
+  EXPECT_EQ(0u, cache.Count());
+}
@@ -0,0 +1,222 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/Layout/FillLayout.hpp>
+#include <FslSimpleUI/Base/Layout/GridLayout.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateLoader.hpp>
+#include <memory>
+#include "TestFixtureFslSimpleUIDeclarative.hpp"
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  using Test_UITemplateCompiler = TestFixtureFslSimpleUIDeclarative;
+
+  constexpr const char* StackXml =
+    "<DeclarativeUITest>"
+    "  <StackLayout Name=\"root\" Orientation=\"Horizontal\" Spacing=\"4\" Margin=\"1,2,3,4\" AlignmentX=\"Center\" Width=\"50\""
+    "               Height=\"{Binding ElementName=root,Path=Width}\">"
+    "    <FillLayout/>"
+    "    <Unknown/>"
+    "    <FillLayout Custom=\"1\"/>"
+    "  </StackLayout>"
+    "</DeclarativeUITest>";
+
+  constexpr const char* GridXml =
+    "<DeclarativeUITest>"
+    "  <GridLayout>"
+    "    <GridLayout.ColumnDefinitions>"
+    "      <GridColumnDefinition Width=\"Auto\"/>"
+    "      <GridColumnDefinition Width=\"*\"/>"
+    "    </GridLayout.ColumnDefinitions>"
+    "    <GridLayout.RowDefinitions>"
+    "      <GridRowDefinition Height=\"32\"/>"
+    "    </GridLayout.RowDefinitions>"
+    "    <FillLayout GridLayout.Column=\"1\" GridLayout.Row=\"0\">"
+    "      <FillLayout/>"
+    "    </FillLayout>"
+    "    <FillLayout GridLayout.Column=\"0\"/>"
+    "  </GridLayout>"
+    "</DeclarativeUITest>";
+
+  const UITemplateProperty* TryFindProperty(const UITemplate& uiTemplate, const UITemplateNode& node, const StringViewLite name)
+  {
+    for (const UITemplateProperty& property : uiTemplate.GetProperties(node))
+    {
+      if (uiTemplate.GetString(property.NameId) == name)
+      {
+        return &property;
+      }
+    }
+    return nullptr;
+  }
+}
+
+
+TEST_F(Test_UITemplateCompiler, Compile_Stack)
+{
+  const UITemplate uiTemplate = Compile(StackXml);
+
+  // The unknown class is skipped
+  ASSERT_EQ(3u, uiTemplate.GetNodes().size());
+  const UITemplateNode& root = uiTemplate.GetNode(0);
+  EXPECT_EQ(StringViewLite("StackLayout"), uiTemplate.GetString(root.ClassNameId));
+  EXPECT_EQ(UITemplateRange(1, 2), root.Children);
+  EXPECT_EQ(7u, uiTemplate.GetProperties(root).size());
+
+  const UITemplateProperty* pName = TryFindProperty(uiTemplate, root, "Name");
+  ASSERT_NE(nullptr, pName);
+  EXPECT_EQ(UITemplateValueType::Name, pName->Type);
+  EXPECT_EQ(StringViewLite("root"), uiTemplate.GetString(pName->Payload[0]));
+
+  const UITemplateProperty* pOrientation = TryFindProperty(uiTemplate, root, "Orientation");
+  ASSERT_NE(nullptr, pOrientation);
+  EXPECT_EQ(UITemplateValueType::LayoutOrientation, pOrientation->Type);
+  EXPECT_EQ(static_cast<uint32_t>(UI::LayoutOrientation::Horizontal), pOrientation->Payload[0]);
+
+  const UITemplateProperty* pSpacing = TryFindProperty(uiTemplate, root, "Spacing");
+  ASSERT_NE(nullptr, pSpacing);
+  EXPECT_EQ(UITemplateValueType::DpSize1DF, pSpacing->Type);
+
+  const UITemplateProperty* pMargin = TryFindProperty(uiTemplate, root, "Margin");
+  ASSERT_NE(nullptr, pMargin);
+  EXPECT_EQ(UITemplateValueType::DpThicknessF, pMargin->Type);
+
+  const UITemplateProperty* pHeight = TryFindProperty(uiTemplate, root, "Height");
+  ASSERT_NE(nullptr, pHeight);
+  EXPECT_EQ(UITemplateValueType::Binding, pHeight->Type);
+  EXPECT_EQ(StringViewLite("root"), uiTemplate.GetString(pHeight->Payload[0]));
+  EXPECT_EQ(StringViewLite("Width"), uiTemplate.GetString(pHeight->Payload[1]));
+
+  // A attribute that is not known at compile time is deferred to the loader
+  const UITemplateProperty* pCustom = TryFindProperty(uiTemplate, uiTemplate.GetNode(2), "Custom");
+  ASSERT_NE(nullptr, pCustom);
+  EXPECT_EQ(UITemplateValueType::Deferred, pCustom->Type);
+  EXPECT_EQ(StringViewLite("1"), uiTemplate.GetString(pCustom->Payload[0]));
+}
+
+
+TEST_F(Test_UITemplateCompiler, Compile_Grid)
+{
+  const UITemplate uiTemplate = Compile(GridXml);
+
+  ASSERT_EQ(4u, uiTemplate.GetNodes().size());
+  const UITemplateNode& root = uiTemplate.GetNode(0);
+  EXPECT_EQ(UITemplateRange(1, 2), root.Children);
+  ASSERT_EQ(2u, uiTemplate.GetColumnDefinitions(root).size());
+  EXPECT_EQ(UI::GridRowColumnDefinitionBase(UI::GridUnitType::Auto), uiTemplate.GetColumnDefinitions(root)[0]);
+  EXPECT_EQ(UI::GridRowColumnDefinitionBase(UI::GridUnitType::Star, 1.0f), uiTemplate.GetColumnDefinitions(root)[1]);
+  ASSERT_EQ(1u, uiTemplate.GetRowDefinitions(root).size());
+  EXPECT_EQ(UI::GridRowColumnDefinitionBase(UI::GridUnitType::Fixed, 32.0f), uiTemplate.GetRowDefinitions(root)[0]);
+
+  // The children of a node are stored consecutively, so the grand child comes after both children
+  EXPECT_EQ(UITemplateRange(3, 1), uiTemplate.GetNode(1).Children);
+  EXPECT_EQ(0u, uiTemplate.GetNode(2).Children.Count);
+
+  const UITemplateProperty* pColumn = TryFindProperty(uiTemplate, uiTemplate.GetNode(1), "GridLayout.Column");
+  ASSERT_NE(nullptr, pColumn);
+  EXPECT_EQ(UITemplateValueType::GridColumn, pColumn->Type);
+  EXPECT_EQ(1u, pColumn->Payload[0]);
+}
+
+
+TEST_F(Test_UITemplateCompiler, Compile_UnknownRootClass)
+{
+  const UITemplate uiTemplate = Compile("<DeclarativeUITest><Unknown/></DeclarativeUITest>");
+  EXPECT_TRUE(uiTemplate.IsEmpty());
+  EXPECT_FALSE(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate));
+}
+
+
+TEST_F(Test_UITemplateCompiler, Compile_MissingRoot)
+{
+  EXPECT_THROW(Compile("<Other><StackLayout/></Other>"), UsageErrorException);
+}
+
+
+TEST_F(Test_UITemplateCompiler, Compile_RootWithTooManyChildren)
+{
+  EXPECT_THROW(Compile("<DeclarativeUITest><StackLayout/><StackLayout/></DeclarativeUITest>"), UsageErrorException);
+}
+
+
+TEST_F(Test_UITemplateCompiler, Instantiate_Stack)
+{
+  const UITemplate uiTemplate = Compile(StackXml);
+
+  auto window = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate);
+  auto stack = std::dynamic_pointer_cast<UI::StackLayout>(window);
+  ASSERT_TRUE(stack);
+  EXPECT_EQ(UI::LayoutOrientation::Horizontal, stack->GetOrientation());
+  EXPECT_EQ(DpSize1DF::Create(4), stack->GetSpacing());
+  EXPECT_EQ(DpThicknessF::Create(1, 2, 3, 4), stack->GetMargin());
+  EXPECT_EQ(UI::ItemAlignment::Center, stack->GetAlignmentX());
+  EXPECT_EQ(2u, stack->GetChildCount());
+
+  // Height is bound to width
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(UI::DpLayoutSize1D::Create(50), stack->GetHeight());
+  stack->SetWidth(UI::DpLayoutSize1D::Create(80));
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(UI::DpLayoutSize1D::Create(80), stack->GetHeight());
+}
+
+
+TEST_F(Test_UITemplateCompiler, Instantiate_Grid)
+{
+  const UITemplate uiTemplate = Compile(GridXml);
+
+  auto window = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate);
+  auto grid = std::dynamic_pointer_cast<UI::GridLayout>(window);
+  ASSERT_TRUE(grid);
+  EXPECT_EQ(2u, grid->GetColumnDefinitionCount());
+  EXPECT_EQ(1u, grid->GetRowDefinitionCount());
+  EXPECT_EQ(2u, grid->GetChildCount());
+}
+
+
+TEST_F(Test_UITemplateCompiler, Instantiate_MultipleTimes)
+{
+  const UITemplate uiTemplate = Compile(GridXml);
+
+  auto window0 = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate);
+  auto window1 = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate);
+  ASSERT_TRUE(window0);
+  ASSERT_TRUE(window1);
+  EXPECT_NE(window0, window1);
+}
@@ -0,0 +1,188 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslSimpleUI/Base/Control/Background.hpp>
+#include <FslSimpleUI/Base/Control/BackgroundLabelButton.hpp>
+#include <FslSimpleUI/Base/Control/Label.hpp>
+#include <FslSimpleUI/Base/Layout/StackLayout.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateLoader.hpp>
+#include <FslSimpleUI/Declarative/UnitTest/Helper/TestThemeControlFactory.hpp>
+#include <memory>
+#include <string>
+#include <vector>
+#include "TestFixtureFslSimpleUIDeclarative.hpp"
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  using Test_UITemplateLoader = TestFixtureFslSimpleUIDeclarative;
+
+  constexpr const char* LabelBindingXml =
+    "<DeclarativeUITest>"
+    "  <StackLayout>"
+    "    <TextButton Name=\"src\" Content=\"Hello\"/>"
+    "    <Label Content=\"{Binding ElementName=src,Path=Content}\"/>"
+    "  </StackLayout>"
+    "</DeclarativeUITest>";
+
+  constexpr const char* ButtonBindingXml =
+    "<DeclarativeUITest>"
+    "  <StackLayout>"
+    "    <Label Name=\"src\" Content=\"Hello\"/>"
+    "    <TextButton Content=\"{Binding ElementName=src,Path=Content}\"/>"
+    "  </StackLayout>"
+    "</DeclarativeUITest>";
+
+  constexpr const char* TopBarXml =
+    "<DeclarativeUITest>"
+    "  <TopBar theme_Type=\"Transparent\">"
+    "    <Label Content=\"Hello\"/>"
+    "  </TopBar>"
+    "</DeclarativeUITest>";
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_LabelElementNameBinding)
+{
+  const UITemplate uiTemplate = Compile(LabelBindingXml);
+
+  std::vector<std::string> errors;
+  auto window = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors);
+  ASSERT_TRUE(std::dynamic_pointer_cast<UI::StackLayout>(window));
+  EXPECT_TRUE(errors.empty());
+
+  auto src = m_themeControlFactory->GetLastTextButton();
+  auto dst = m_themeControlFactory->GetLastLabel();
+  ASSERT_TRUE(src);
+  ASSERT_TRUE(dst);
+
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(StringViewLite("Hello"), dst->GetContent());
+
+  src->SetContent("World");
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(StringViewLite("World"), dst->GetContent());
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_ButtonElementNameBinding)
+{
+  const UITemplate uiTemplate = Compile(ButtonBindingXml);
+
+  std::vector<std::string> errors;
+  auto window = UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors);
+  ASSERT_TRUE(std::dynamic_pointer_cast<UI::StackLayout>(window));
+  EXPECT_TRUE(errors.empty());
+
+  auto src = m_themeControlFactory->GetLastLabel();
+  auto dst = m_themeControlFactory->GetLastTextButton();
+  ASSERT_TRUE(src);
+  ASSERT_TRUE(dst);
+  EXPECT_EQ(UI::Theme::ButtonType::Text, m_themeControlFactory->GetLastButtonType());
+
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(StringViewLite("Hello"), dst->GetContent());
+
+  src->SetContent("World");
+  m_dataBindingService->ExecuteChanges();
+  EXPECT_EQ(StringViewLite("World"), dst->GetContent());
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_ThemeProperty)
+{
+  const UITemplate uiTemplate = Compile(TopBarXml);
+
+  std::vector<std::string> errors;
+  auto bar = std::dynamic_pointer_cast<UI::Background>(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors));
+  ASSERT_TRUE(bar);
+  EXPECT_TRUE(errors.empty());
+  // The theme property was claimed by the top bar factory and forwarded to the theme
+  EXPECT_EQ(UI::Theme::BarType::Transparent, m_themeControlFactory->GetLastBarType());
+  EXPECT_EQ(m_themeControlFactory->GetLastLabel(), bar->GetContent());
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_UnknownProperty)
+{
+  const UITemplate uiTemplate = Compile("<DeclarativeUITest><Label Content=\"Hello\" Custom=\"1\"/></DeclarativeUITest>");
+
+  std::vector<std::string> errors;
+  auto label = std::dynamic_pointer_cast<UI::Label>(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors));
+  ASSERT_TRUE(label);
+  EXPECT_EQ(StringViewLite("Hello"), label->GetContent());
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("Unknown property: 'Custom'='1'", errors[0]);
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_UnknownElementName)
+{
+  const UITemplate uiTemplate =
+    Compile("<DeclarativeUITest><Label Content=\"{Binding ElementName=missing,Path=Content}\"/></DeclarativeUITest>");
+
+  std::vector<std::string> errors;
+  EXPECT_TRUE(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors));
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("Could not find a named control called: 'missing'", errors[0]);
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_UnknownSourceProperty)
+{
+  const UITemplate uiTemplate = Compile(
+    "<DeclarativeUITest><StackLayout><Label Name=\"src\"/><Label Content=\"{Binding ElementName=src,Path=Missing}\"/></StackLayout>"
+    "</DeclarativeUITest>");
+
+  std::vector<std::string> errors;
+  EXPECT_TRUE(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors));
+  ASSERT_EQ(1u, errors.size());
+  EXPECT_EQ("Could not find a src property called: 'Missing'", errors[0]);
+}
+
+
+TEST_F(Test_UITemplateLoader, Instantiate_DeferredProperty)
+{
+  // A template compiled against a theme that did not know the property, so it is resolved against the control instance
+  const UITemplate uiTemplate("LabelContentHello", {UITemplateRange(0, 5), UITemplateRange(5, 7), UITemplateRange(12, 5)},
+                              {UITemplateNode(0, {}, UITemplateRange(0, 1), {}, {}, {})}, {},
+                              {UITemplateProperty(1, 0, UITemplateValueType::Deferred, {2, 0, 0, 0})}, {});
+
+  std::vector<std::string> errors;
+  auto label = std::dynamic_pointer_cast<UI::Label>(UITemplateLoader::Instantiate(m_controlFactory, m_dataBindingService, uiTemplate, errors));
+  ASSERT_TRUE(label);
+  EXPECT_TRUE(errors.empty());
+  EXPECT_EQ(StringViewLite("Hello"), label->GetContent());
+}
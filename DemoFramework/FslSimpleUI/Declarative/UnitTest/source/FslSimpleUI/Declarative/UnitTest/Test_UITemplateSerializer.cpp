@@ -0,0 +1,147 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/UnitTest/Helper/TestFixtureFslBase.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateSerializer.hpp>
+#include <algorithm>
+#include <bit>
+#include <vector>
+
+using namespace Fsl;
+using namespace Fsl::UI::Declarative;
+
+namespace
+{
+  using Test_UITemplateSerializer = TestFixtureFslBase;
+
+  UITemplate CreateTemplate()
+  {
+    // 0: GridLayout, 1: FillLayout, 2: Name, 3: root, 4: Width, 5: Style
+    std::vector<UITemplateRange> strings{UITemplateRange(0, 10), UITemplateRange(10, 10), UITemplateRange(20, 4), UITemplateRange(24, 4),
+                                         UITemplateRange(28, 5), UITemplateRange(33, 5)};
+    std::vector<UITemplateNode> nodes{
+      UITemplateNode(0, UITemplateRange(0, 1), UITemplateRange(0, 2), UITemplateRange(0, 2), UITemplateRange(2, 1), UITemplateRange(1, 1)),
+      UITemplateNode(1, {}, UITemplateRange(2, 1), {}, {}, {})};
+    std::vector<UITemplateThemeProperty> themeProperties{UITemplateThemeProperty(5, 3)};
+    std::vector<UITemplateProperty> properties{
+      UITemplateProperty(2, 0, UITemplateValueType::Name, {3, 0, 0, 0}),
+      UITemplateProperty(4, 7, UITemplateValueType::DpLayoutSize1D, {std::bit_cast<uint32_t>(42.5f), 0, 0, 0}),
+      UITemplateProperty(4, 2, UITemplateValueType::Binding, {3, 4, 0, 0})};
+    std::vector<UI::GridRowColumnDefinitionBase> gridDefinitions{UI::GridRowColumnDefinitionBase(UI::GridUnitType::Auto),
+                                                                 UI::GridRowColumnDefinitionBase(UI::GridUnitType::Star, 1.0f),
+                                                                 UI::GridRowColumnDefinitionBase(UI::GridUnitType::Fixed, 32.0f)};
+    return {"GridLayoutFillLayoutNamerootWidthStyle", std::move(strings), std::move(nodes), std::move(themeProperties), std::move(properties),
+            std::move(gridDefinitions)};
+  }
+
+  template <typename T>
+  bool IsEqual(const ReadOnlySpan<T> lhs, const ReadOnlySpan<T> rhs)
+  {
+    return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+  }
+}
+
+
+TEST(Test_UITemplateSerializer, Serialize_Deserialize)
+{
+  const UITemplate original = CreateTemplate();
+
+  const std::vector<uint8_t> content = UITemplateSerializer::Serialize(original);
+  EXPECT_TRUE(UITemplateSerializer::IsBinaryTemplate(SpanUtil::AsReadOnlySpan(content)));
+
+  const UITemplate result = UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content));
+
+  EXPECT_EQ(original.GetStringData(), result.GetStringData());
+  EXPECT_TRUE(IsEqual(original.GetStrings(), result.GetStrings()));
+  EXPECT_TRUE(IsEqual(original.GetNodes(), result.GetNodes()));
+  EXPECT_TRUE(IsEqual(original.GetAllThemeProperties(), result.GetAllThemeProperties()));
+  EXPECT_TRUE(IsEqual(original.GetAllProperties(), result.GetAllProperties()));
+  EXPECT_TRUE(IsEqual(original.GetAllGridDefinitions(), result.GetAllGridDefinitions()));
+}
+
+
+TEST(Test_UITemplateSerializer, Serialize_Deserialize_Empty)
+{
+  const std::vector<uint8_t> content = UITemplateSerializer::Serialize(UITemplate());
+
+  const UITemplate result = UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content));
+
+  EXPECT_TRUE(result.IsEmpty());
+  EXPECT_EQ(0u, result.StringCount());
+}
+
+
+TEST(Test_UITemplateSerializer, IsBinaryTemplate_Xml)
+{
+  const char xml[] = "<?xml version=\"1.0\" encoding=\"UTF-8\"?><DeclarativeUITest/>";
+  EXPECT_FALSE(UITemplateSerializer::IsBinaryTemplate(ReadOnlySpan<uint8_t>(reinterpret_cast<const uint8_t*>(xml), sizeof(xml) - 1)));
+  EXPECT_FALSE(UITemplateSerializer::IsBinaryTemplate({}));
+}
+
+
+TEST(Test_UITemplateSerializer, Deserialize_InvalidMagic)
+{
+  std::vector<uint8_t> content = UITemplateSerializer::Serialize(CreateTemplate());
+  content[0] ^= 0xFF;
+
+  EXPECT_THROW(UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UITemplateSerializer, Deserialize_InvalidVersion)
+{
+  std::vector<uint8_t> content = UITemplateSerializer::Serialize(CreateTemplate());
+  content[4] = 0xFF;
+
+  EXPECT_THROW(UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UITemplateSerializer, Deserialize_Truncated)
+{
+  std::vector<uint8_t> content = UITemplateSerializer::Serialize(CreateTemplate());
+  content.pop_back();
+
+  EXPECT_THROW(UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
+
+
+TEST(Test_UITemplateSerializer, Deserialize_InvalidContent)
+{
+  std::vector<uint8_t> content = UITemplateSerializer::Serialize(CreateTemplate());
+  // The first string range is stored right after the header, make it point outside the string data
+  content[32] = 0xFF;
+
+  EXPECT_THROW(UITemplateSerializer::Deserialize(SpanUtil::AsReadOnlySpan(content)), FormatException);
+}
@@ -31,6 +31,7 @@
  *
  ****************************************************************************************************************************************************/
 
+#include <FslBase/Span/Span.hpp>
 #include <FslSimpleUI/Declarative/ADeclarativeControlFactory.hpp>
 #include <FslSimpleUI/Declarative/ControlType.hpp>
 #include <FslSimpleUI/Declarative/PrimitiveTypeRegistry.hpp>
@@ -88,6 +89,10 @@ namespace Fsl::UI::Declarative
     std::shared_ptr<BaseWindow> TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
                                           std::vector<PropertyRecord>& rPropertyRecords);
 
+    //! @brief Create the control using the supplied theme property records, all the records that were used are marked as claimed.
+    std::shared_ptr<BaseWindow> TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
+                                          Span<PropertyParserRecord> themeProperties);
+
     std::vector<ControlName> GetControlNames() const;
     std::span<const ControlPropertyRecord> GetControlThemeProperties(const ControlName& name) const;
     DataBinding::DependencyPropertyDefinitionVector GetControlProperties(const ControlName& name);
@@ -0,0 +1,145 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslSimpleUI/Base/Layout/GridRowColumnDefinition.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateNode.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateProperty.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateRange.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateThemeProperty.hpp>
+#include <string>
+#include <vector>
+
+namespace Fsl::UI::Declarative
+{
+  //! @brief A compiled declarative UI.
+  //!        All names and string values are interned in a single string table, property values are pre-parsed into typed payloads and the
+  //!        tree is stored as a flat node array where node zero is the root and the children of a node occupy a consecutive range.
+  //!        The content is validated on construction so a template can be instantiated many times without any further checks.
+  class UITemplate final
+  {
+    std::string m_stringData;
+    std::vector<UITemplateRange> m_strings;
+    std::vector<UITemplateNode> m_nodes;
+    std::vector<UITemplateThemeProperty> m_themeProperties;
+    std::vector<UITemplateProperty> m_properties;
+    std::vector<GridRowColumnDefinitionBase> m_gridDefinitions;
+
+  public:
+    //! @brief Create a empty template
+    UITemplate() = default;
+
+    //! @brief Create a template from its flat arrays.
+    //! @throws std::invalid_argument if any index or range is out of bounds or if the nodes do not form a tree rooted at node zero.
+    UITemplate(std::string stringData, std::vector<UITemplateRange> strings, std::vector<UITemplateNode> nodes,
+               std::vector<UITemplateThemeProperty> themeProperties, std::vector<UITemplateProperty> properties,
+               std::vector<GridRowColumnDefinitionBase> gridDefinitions);
+
+    bool IsEmpty() const noexcept
+    {
+      return m_nodes.empty();
+    }
+
+    uint32_t StringCount() const noexcept
+    {
+      return static_cast<uint32_t>(m_strings.size());
+    }
+
+    StringViewLite GetString(const uint32_t stringId) const
+    {
+      const UITemplateRange range = m_strings.at(stringId);
+      return StringViewLite(m_stringData.data() + range.Begin, range.Count);
+    }
+
+    const UITemplateNode& GetNode(const uint32_t nodeIndex) const
+    {
+      return m_nodes.at(nodeIndex);
+    }
+
+    ReadOnlySpan<UITemplateThemeProperty> GetThemeProperties(const UITemplateNode& node) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_themeProperties, node.ThemeProperties.Begin, node.ThemeProperties.Count);
+    }
+
+    ReadOnlySpan<UITemplateProperty> GetProperties(const UITemplateNode& node) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_properties, node.Properties.Begin, node.Properties.Count);
+    }
+
+    ReadOnlySpan<GridRowColumnDefinitionBase> GetColumnDefinitions(const UITemplateNode& node) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_gridDefinitions, node.ColumnDefinitions.Begin, node.ColumnDefinitions.Count);
+    }
+
+    ReadOnlySpan<GridRowColumnDefinitionBase> GetRowDefinitions(const UITemplateNode& node) const noexcept
+    {
+      return SpanUtil::UncheckedAsReadOnlySpan(m_gridDefinitions, node.RowDefinitions.Begin, node.RowDefinitions.Count);
+    }
+
+    // Raw access to the flat arrays
+
+    const std::string& GetStringData() const noexcept
+    {
+      return m_stringData;
+    }
+
+    ReadOnlySpan<UITemplateRange> GetStrings() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_strings);
+    }
+
+    ReadOnlySpan<UITemplateNode> GetNodes() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_nodes);
+    }
+
+    ReadOnlySpan<UITemplateThemeProperty> GetAllThemeProperties() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_themeProperties);
+    }
+
+    ReadOnlySpan<UITemplateProperty> GetAllProperties() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_properties);
+    }
+
+    ReadOnlySpan<GridRowColumnDefinitionBase> GetAllGridDefinitions() const noexcept
+    {
+      return SpanUtil::AsReadOnlySpan(m_gridDefinitions);
+    }
+  };
+}
+
+#endif
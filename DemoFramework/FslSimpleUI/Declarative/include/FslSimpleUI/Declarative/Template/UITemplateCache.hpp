@@ -0,0 +1,84 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATECACHE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATECACHE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/Path.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <map>
+#include <memory>
+
+namespace Fsl
+{
+  namespace DataBinding
+  {
+    class DataBindingService;
+  }
+  namespace UI
+  {
+    class BaseWindow;
+  }
+}
+
+namespace Fsl::UI::Declarative
+{
+  class ControlFactory;
+
+  //! @brief Keeps the compiled templates around so each declarative UI file is only parsed once no matter how many times its instantiated.
+  class UITemplateCache final
+  {
+    std::map<IO::Path, std::shared_ptr<const UITemplate>> m_templates;
+
+  public:
+    //! @brief Get the template for the given file, loading it on first use.
+    //!        Binary templates (see UITemplateSerializer) are recognized by their header, everything else is compiled as xml.
+    std::shared_ptr<const UITemplate> GetOrLoad(ControlFactory& controlFactory, const IO::Path& filename);
+
+    //! @brief Instantiate the UI described by the given file (see UITemplateLoader::Instantiate)
+    std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                                const IO::Path& filename);
+
+    bool Contains(const IO::Path& filename) const;
+
+    std::size_t Count() const noexcept
+    {
+      return m_templates.size();
+    }
+
+    //! @brief Remove the template for the given file
+    //! @return true if it was removed, false if it was not cached
+    bool Remove(const IO::Path& filename);
+
+    void Clear() noexcept;
+  };
+}
+
+#endif
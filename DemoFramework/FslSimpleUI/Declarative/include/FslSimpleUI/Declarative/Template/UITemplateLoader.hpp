@@ -0,0 +1,76 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATELOADER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATELOADER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Fsl
+{
+  namespace DataBinding
+  {
+    class DataBindingService;
+  }
+  namespace UI
+  {
+    class BaseWindow;
+  }
+}
+
+namespace Fsl::UI::Declarative
+{
+  class ControlFactory;
+  class RadioGroupManager;
+  class UITemplate;
+}
+
+namespace Fsl::UI::Declarative::UITemplateLoader
+{
+  //! @brief Create the UI described by the template
+  //! @return the root control or null if the template is empty or the root control could not be created.
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, RadioGroupManager& rRadioGroupManager,
+                                              const std::shared_ptr<DataBinding::DataBindingService>& dataBinding, const UITemplate& uiTemplate);
+
+  //! @brief Create the UI described by the template using a radio group manager that is local to this instance
+  //! @return the root control or null if the template is empty or the root control could not be created.
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                              const UITemplate& uiTemplate);
+
+  //! @brief Create the UI described by the template and append every problem found while doing so to rErrors
+  //!        The problems are also logged as errors.
+  //! @return the root control or null if the template is empty or the root control could not be created.
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                              const UITemplate& uiTemplate, std::vector<std::string>& rErrors);
+}
+
+#endif
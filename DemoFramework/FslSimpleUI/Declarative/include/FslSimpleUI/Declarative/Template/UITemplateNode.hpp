@@ -0,0 +1,76 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATENODE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATENODE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Declarative/Template/UITemplateRange.hpp>
+#include <cstdint>
+
+namespace Fsl::UI::Declarative
+{
+  //! A control in the template.
+  //! All the ranges index into the flat arrays owned by the UITemplate, the children of a node are always stored in consecutive node slots.
+  struct UITemplateNode
+  {
+    uint32_t ClassNameId{0};
+    UITemplateRange ThemeProperties;
+    UITemplateRange Properties;
+    UITemplateRange ColumnDefinitions;
+    UITemplateRange RowDefinitions;
+    UITemplateRange Children;
+
+    constexpr UITemplateNode() noexcept = default;
+
+    constexpr UITemplateNode(const uint32_t classNameId, const UITemplateRange themeProperties, const UITemplateRange properties,
+                             const UITemplateRange columnDefinitions, const UITemplateRange rowDefinitions, const UITemplateRange children) noexcept
+      : ClassNameId(classNameId)
+      , ThemeProperties(themeProperties)
+      , Properties(properties)
+      , ColumnDefinitions(columnDefinitions)
+      , RowDefinitions(rowDefinitions)
+      , Children(children)
+    {
+    }
+
+    constexpr bool operator==(const UITemplateNode& rhs) const noexcept
+    {
+      return ClassNameId == rhs.ClassNameId && ThemeProperties == rhs.ThemeProperties && Properties == rhs.Properties &&
+             ColumnDefinitions == rhs.ColumnDefinitions && RowDefinitions == rhs.RowDefinitions && Children == rhs.Children;
+    }
+
+    constexpr bool operator!=(const UITemplateNode& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEPROPERTY_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEPROPERTY_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Declarative/Template/UITemplateValueType.hpp>
+#include <array>
+#include <cstdint>
+
+namespace Fsl::UI::Declarative
+{
+  //! A pre-parsed property assignment, the payload encoding is described by UITemplateValueType
+  struct UITemplateProperty
+  {
+    uint32_t NameId{0};
+    //! The index of the property in the property list of the control the template was compiled against.
+    //! Its only used as a lookup hint, so its verified against the name before its used.
+    uint32_t PropertyIndexHint{0};
+    UITemplateValueType Type{UITemplateValueType::Deferred};
+    std::array<uint32_t, 4> Payload{};
+
+    constexpr UITemplateProperty() noexcept = default;
+
+    constexpr UITemplateProperty(const uint32_t nameId, const uint32_t propertyIndexHint, const UITemplateValueType type,
+                                 const std::array<uint32_t, 4>& payload) noexcept
+      : NameId(nameId)
+      , PropertyIndexHint(propertyIndexHint)
+      , Type(type)
+      , Payload(payload)
+    {
+    }
+
+    constexpr bool operator==(const UITemplateProperty& rhs) const noexcept
+    {
+      return NameId == rhs.NameId && PropertyIndexHint == rhs.PropertyIndexHint && Type == rhs.Type && Payload == rhs.Payload;
+    }
+
+    constexpr bool operator!=(const UITemplateProperty& rhs) const noexcept
+    {
+      return !(*this == rhs);
+    }
+  };
+}
+
+#endif
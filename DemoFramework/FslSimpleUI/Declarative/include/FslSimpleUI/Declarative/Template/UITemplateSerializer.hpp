@@ -0,0 +1,61 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATESERIALIZER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATESERIALIZER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/BasicTypes.hpp>
+#include <FslBase/Span/ReadOnlySpan.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <vector>
+
+namespace Fsl::IO
+{
+  class Path;
+}
+
+namespace Fsl::UI::Declarative::UITemplateSerializer
+{
+  //! @brief Check if the content starts with the binary template header
+  bool IsBinaryTemplate(const ReadOnlySpan<uint8_t> content) noexcept;
+
+  //! @brief Encode the template in the compact little endian binary format
+  std::vector<uint8_t> Serialize(const UITemplate& uiTemplate);
+
+  //! @brief Decode a binary template
+  //! @throws FormatException if the content is not a valid binary template
+  UITemplate Deserialize(const ReadOnlySpan<uint8_t> content);
+
+  void Save(const IO::Path& filename, const UITemplate& uiTemplate);
+
+  UITemplate Load(const IO::Path& filename);
+}
+
+#endif
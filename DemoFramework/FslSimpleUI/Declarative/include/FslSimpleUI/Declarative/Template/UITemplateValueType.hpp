@@ -0,0 +1,84 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEVALUETYPE_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEVALUETYPE_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <cstdint>
+
+namespace Fsl::UI::Declarative
+{
+  //! The pre-parsed value stored in a UITemplateProperty payload
+  enum class UITemplateValueType : uint8_t
+  {
+    //! The property was not found on the control when the template was compiled, so the raw string (Payload[0]) is resolved against the
+    //! created control when the template is instantiated.
+    Deferred = 0,
+    //! Payload[0] = string id
+    String = 1,
+    //! Payload[0] = 0 or 1
+    Bool = 2,
+    //! Payload[0] = value
+    UInt8 = 3,
+    //! Payload[0] = value (two's complement)
+    Int32 = 4,
+    //! Payload[0] = value
+    UInt32 = 5,
+    //! Payload[0] = value (two's complement)
+    DpSize1D = 6,
+    //! Payload[0] = float bits
+    DpSize1DF = 7,
+    //! Payload[0..3] = left, top, right, bottom float bits
+    DpThicknessF = 8,
+    //! Payload[0] = float bits
+    DpLayoutSize1D = 9,
+    //! Payload[0] = ItemAlignment
+    ItemAlignment = 10,
+    //! Payload[0] = LayoutOrientation
+    LayoutOrientation = 11,
+    //! Payload[0] = ScrollModeFlags
+    ScrollModeFlags = 12,
+    //! Payload[0] = TransitionType
+    TransitionType = 13,
+    //! Payload[0] = element name string id, Payload[1] = path string id
+    Binding = 14,
+    //! Payload[0] = name string id
+    Name = 15,
+    //! The GridLayout.Column attached property. Payload[0] = column index
+    GridColumn = 16,
+    //! The GridLayout.Row attached property. Payload[0] = row index
+    GridRow = 17,
+
+    //! Not a value, just used to validate the type
+    Count = 18
+  };
+}
+
+#endif
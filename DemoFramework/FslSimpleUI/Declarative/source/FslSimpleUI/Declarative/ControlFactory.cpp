@@ -197,6 +197,16 @@ namespace Fsl::UI::Declarative
 
   std::shared_ptr<BaseWindow> ControlFactory::TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
                                                         std::vector<PropertyRecord>& rPropertyRecords)
+  {
+    Span<PropertyParserRecord> properties = FillScratchpad(m_createPropertiesScratchpad, SpanUtil::AsReadOnlySpan(rPropertyRecords));
+    auto res = TryCreate(rRadioGroupManager, name, properties);
+    EraseClaimed(rPropertyRecords, properties);
+    return res;
+  }
+
+
+  std::shared_ptr<BaseWindow> ControlFactory::TryCreate(RadioGroupManager& rRadioGroupManager, const std::string_view name,
+                                                        Span<PropertyParserRecord> themeProperties)
   {
     Theme::IThemeControlFactory& uiFactory = *m_controlFactory;
 
@@ -204,12 +214,9 @@ namespace Fsl::UI::Declarative
     if (itrFind != m_factories.end())
     {
       Span<RegisteredPropertyRecord> registeredProperties = FillScratchpad(m_registeredPropertyScratchpad, itrFind->second->Properties());
-      Span<PropertyParserRecord> properties = FillScratchpad(m_createPropertiesScratchpad, SpanUtil::AsReadOnlySpan(rPropertyRecords));
 
-      ScopedThemePropertyParser propertyParser(registeredProperties, properties);
-      auto res = itrFind->second->Create(DeclarativeControlFactoryCreateInfo(uiFactory, rRadioGroupManager, propertyParser));
-      EraseClaimed(rPropertyRecords, properties);
-      return res;
+      ScopedThemePropertyParser propertyParser(registeredProperties, themeProperties);
+      return itrFind->second->Create(DeclarativeControlFactoryCreateInfo(uiFactory, rRadioGroupManager, propertyParser));
     }
 
     // Missing: ImageButton
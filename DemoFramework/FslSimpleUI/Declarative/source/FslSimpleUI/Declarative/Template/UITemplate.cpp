@@ -0,0 +1,149 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <fmt/format.h>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+namespace Fsl::UI::Declarative
+{
+  namespace
+  {
+    void ValidateRange(const UITemplateRange range, const std::size_t size, const char* const pszName)
+    {
+      if (range.Begin > size || range.Count > (size - range.Begin))
+      {
+        throw std::invalid_argument(fmt::format("{} range out of bounds: begin={} count={} size={}", pszName, range.Begin, range.Count, size));
+      }
+    }
+
+    void ValidateStringId(const uint32_t stringId, const std::size_t stringCount)
+    {
+      if (stringId >= stringCount)
+      {
+        throw std::invalid_argument(fmt::format("string id out of bounds: {} >= {}", stringId, stringCount));
+      }
+    }
+
+    //! The number of string ids stored at the start of the payload
+    constexpr uint32_t GetPayloadStringCount(const UITemplateValueType type) noexcept
+    {
+      switch (type)
+      {
+      case UITemplateValueType::Deferred:
+      case UITemplateValueType::String:
+      case UITemplateValueType::Name:
+        return 1;
+      case UITemplateValueType::Binding:
+        return 2;
+      default:
+        return 0;
+      }
+    }
+  }
+
+
+  UITemplate::UITemplate(std::string stringData, std::vector<UITemplateRange> strings, std::vector<UITemplateNode> nodes,
+                         std::vector<UITemplateThemeProperty> themeProperties, std::vector<UITemplateProperty> properties,
+                         std::vector<GridRowColumnDefinitionBase> gridDefinitions)
+    : m_stringData(std::move(stringData))
+    , m_strings(std::move(strings))
+    , m_nodes(std::move(nodes))
+    , m_themeProperties(std::move(themeProperties))
+    , m_properties(std::move(properties))
+    , m_gridDefinitions(std::move(gridDefinitions))
+  {
+    if (m_nodes.size() > std::numeric_limits<uint32_t>::max())
+    {
+      throw std::invalid_argument("too many nodes");
+    }
+
+    for (const UITemplateRange& entry : m_strings)
+    {
+      ValidateRange(entry, m_stringData.size(), "string");
+    }
+
+    for (const UITemplateThemeProperty& entry : m_themeProperties)
+    {
+      ValidateStringId(entry.NameId, m_strings.size());
+      ValidateStringId(entry.ValueId, m_strings.size());
+    }
+
+    for (const UITemplateProperty& entry : m_properties)
+    {
+      if (static_cast<uint32_t>(entry.Type) >= static_cast<uint32_t>(UITemplateValueType::Count))
+      {
+        throw std::invalid_argument(fmt::format("unknown property value type: {}", static_cast<uint32_t>(entry.Type)));
+      }
+      ValidateStringId(entry.NameId, m_strings.size());
+      const uint32_t stringCount = GetPayloadStringCount(entry.Type);
+      for (uint32_t i = 0; i < stringCount; ++i)
+      {
+        ValidateStringId(entry.Payload[i], m_strings.size());
+      }
+    }
+
+    // Every node except the root must be the child of exactly one node that comes before it, which guarantees that its a tree
+    std::vector<bool> isReferenced(m_nodes.size(), false);
+    for (std::size_t nodeIndex = 0; nodeIndex < m_nodes.size(); ++nodeIndex)
+    {
+      const UITemplateNode& node = m_nodes[nodeIndex];
+      ValidateStringId(node.ClassNameId, m_strings.size());
+      ValidateRange(node.ThemeProperties, m_themeProperties.size(), "theme property");
+      ValidateRange(node.Properties, m_properties.size(), "property");
+      ValidateRange(node.ColumnDefinitions, m_gridDefinitions.size(), "column definition");
+      ValidateRange(node.RowDefinitions, m_gridDefinitions.size(), "row definition");
+      ValidateRange(node.Children, m_nodes.size(), "child");
+      if (node.Children.Count > 0u && node.Children.Begin <= nodeIndex)
+      {
+        throw std::invalid_argument(fmt::format("node {} has children stored before it", nodeIndex));
+      }
+      for (uint32_t i = 0; i < node.Children.Count; ++i)
+      {
+        const uint32_t childIndex = node.Children.Begin + i;
+        if (isReferenced[childIndex])
+        {
+          throw std::invalid_argument(fmt::format("node {} has more than one parent", childIndex));
+        }
+        isReferenced[childIndex] = true;
+      }
+    }
+    for (std::size_t nodeIndex = 1; nodeIndex < m_nodes.size(); ++nodeIndex)
+    {
+      if (!isReferenced[nodeIndex])
+      {
+        throw std::invalid_argument(fmt::format("node {} is not reachable from the root", nodeIndex));
+      }
+    }
+  }
+}
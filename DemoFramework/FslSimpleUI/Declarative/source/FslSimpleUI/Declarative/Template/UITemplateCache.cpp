@@ -0,0 +1,87 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/IO/File.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCache.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCompiler.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateLoader.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateSerializer.hpp>
+#include <utility>
+#include <vector>
+
+namespace Fsl::UI::Declarative
+{
+  std::shared_ptr<const UITemplate> UITemplateCache::GetOrLoad(ControlFactory& controlFactory, const IO::Path& filename)
+  {
+    auto itrFind = m_templates.find(filename);
+    if (itrFind != m_templates.end())
+    {
+      return itrFind->second;
+    }
+
+    const std::vector<uint8_t> content = IO::File::ReadAllBytes(filename);
+    const ReadOnlySpan<uint8_t> contentSpan = SpanUtil::AsReadOnlySpan(content);
+    auto uiTemplate = std::make_shared<const UITemplate>(UITemplateSerializer::IsBinaryTemplate(contentSpan)
+                                                           ? UITemplateSerializer::Deserialize(contentSpan)
+                                                           : UITemplateCompiler::CompileFromMemory(controlFactory, contentSpan));
+    m_templates.emplace(filename, uiTemplate);
+    return uiTemplate;
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> UITemplateCache::Instantiate(ControlFactory& controlFactory,
+                                                               const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                                               const IO::Path& filename)
+  {
+    const std::shared_ptr<const UITemplate> uiTemplate = GetOrLoad(controlFactory, filename);
+    return UITemplateLoader::Instantiate(controlFactory, dataBinding, *uiTemplate);
+  }
+
+
+  bool UITemplateCache::Contains(const IO::Path& filename) const
+  {
+    return m_templates.find(filename) != m_templates.end();
+  }
+
+
+  bool UITemplateCache::Remove(const IO::Path& filename)
+  {
+    return m_templates.erase(filename) > 0u;
+  }
+
+
+  void UITemplateCache::Clear() noexcept
+  {
+    m_templates.clear();
+  }
+}
@@ -0,0 +1,394 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/String/StringParseUtil.hpp>
+#include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/ControlName.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateCompiler.hpp>
+#include <pugixml.hpp>
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "UITemplateValueParser.hpp"
+
+namespace Fsl::UI::Declarative::UITemplateCompiler
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      constexpr std::string_view RootNodeName("DeclarativeUITest");
+      constexpr std::string_view ColumnDefinitionsName("GridLayout.ColumnDefinitions");
+      constexpr std::string_view RowDefinitionsName("GridLayout.RowDefinitions");
+    }
+
+    struct ClassInfo
+    {
+      bool IsValid{false};
+      ControlType Type{ControlType::Normal};
+      std::span<const ControlPropertyRecord> ThemeProperties;
+      DataBinding::DependencyPropertyDefinitionVector Properties;
+    };
+
+    struct PendingGridDefinitions
+    {
+      std::vector<GridRowColumnDefinitionBase> Columns;
+      std::vector<GridRowColumnDefinitionBase> Rows;
+    };
+
+    inline StringViewLite ToStringViewLite(const std::string_view value) noexcept
+    {
+      return StringViewLite(value.data(), value.size());
+    }
+
+
+    class Compiler
+    {
+      ControlFactory& m_controlFactory;
+      std::map<std::string, ClassInfo, std::less<>> m_classInfo;
+      std::map<std::string, uint32_t, std::less<>> m_stringLookup;
+
+      std::string m_stringData;
+      std::vector<UITemplateRange> m_strings;
+      std::vector<UITemplateNode> m_nodes;
+      std::vector<UITemplateThemeProperty> m_themeProperties;
+      std::vector<UITemplateProperty> m_properties;
+      std::vector<GridRowColumnDefinitionBase> m_gridDefinitions;
+
+    public:
+      explicit Compiler(ControlFactory& controlFactory)
+        : m_controlFactory(controlFactory)
+      {
+      }
+
+      UITemplate Compile(pugi::xml_node rootNode)
+      {
+        const ClassInfo& rootInfo = GetClassInfo(rootNode.name());
+        if (!rootInfo.IsValid)
+        {
+          FSLLOG3_ERROR("Could not create a control for class: '{}'", rootNode.name());
+          return {};
+        }
+        m_nodes.emplace_back();
+        ProcessNode(0u, rootNode, rootInfo);
+        return {std::move(m_stringData), std::move(m_strings),    std::move(m_nodes), std::move(m_themeProperties), std::move(m_properties),
+                std::move(m_gridDefinitions)};
+      }
+
+    private:
+      void ProcessNode(const uint32_t nodeIndex, pugi::xml_node node, const ClassInfo& classInfo)
+      {
+        const auto themePropertiesBegin = static_cast<uint32_t>(m_themeProperties.size());
+        const auto propertiesBegin = static_cast<uint32_t>(m_properties.size());
+        for (pugi::xml_attribute attr : node.attributes())
+        {
+          AddAttribute(classInfo, attr.name(), attr.value());
+        }
+
+        UITemplateNode result(Intern(std::string_view(node.name())),
+                              UITemplateRange(themePropertiesBegin, static_cast<uint32_t>(m_themeProperties.size()) - themePropertiesBegin),
+                              UITemplateRange(propertiesBegin, static_cast<uint32_t>(m_properties.size()) - propertiesBegin), {}, {}, {});
+
+        // Collect the children that will become controls so they can be stored in consecutive node slots
+        std::vector<std::pair<pugi::xml_node, const ClassInfo*>> children;
+        switch (classInfo.Type)
+        {
+        case ControlType::Layout:
+          {
+            PendingGridDefinitions gridDefinitions;
+            for (pugi::xml_node child : node.children())
+            {
+              if (!TryProcessGridChild(gridDefinitions, child))
+              {
+                TryAddChild(children, child);
+              }
+            }
+            result.ColumnDefinitions = AddGridDefinitions(gridDefinitions.Columns);
+            result.RowDefinitions = AddGridDefinitions(gridDefinitions.Rows);
+            break;
+          }
+        case ControlType::Content:
+          if (std::distance(node.children().begin(), node.children().end()) == 1u)
+          {
+            TryAddChild(children, *node.children().begin());
+          }
+          else
+          {
+            for (pugi::xml_node child : node.children())
+            {
+              FSLLOG3_ERROR("Ignoring children as node is not a container but a content control. Ignored child name: '{}'", child.name());
+            }
+          }
+          break;
+        case ControlType::Normal:
+        default:
+          for (pugi::xml_node child : node.children())
+          {
+            if (std::string_view(child.name()) == "Binding")
+            {
+              FSLLOG3_ERROR("Content binding not implemented");
+            }
+            else
+            {
+              FSLLOG3_ERROR("Ignoring child as node is not a container. Ignored child name: '{}'", child.name());
+            }
+          }
+          break;
+        }
+
+        const auto childrenBegin = static_cast<uint32_t>(m_nodes.size());
+        result.Children = UITemplateRange(childrenBegin, static_cast<uint32_t>(children.size()));
+        m_nodes.resize(m_nodes.size() + children.size());
+        m_nodes[nodeIndex] = result;
+
+        for (std::size_t i = 0; i < children.size(); ++i)
+        {
+          ProcessNode(childrenBegin + static_cast<uint32_t>(i), children[i].first, *children[i].second);
+        }
+      }
+
+      void TryAddChild(std::vector<std::pair<pugi::xml_node, const ClassInfo*>>& rChildren, pugi::xml_node child)
+      {
+        const ClassInfo& childInfo = GetClassInfo(child.name());
+        if (childInfo.IsValid)
+        {
+          rChildren.emplace_back(child, &childInfo);
+        }
+        else
+        {
+          FSLLOG3_ERROR("Could not create a control for class: '{}'", child.name());
+        }
+      }
+
+      void AddAttribute(const ClassInfo& classInfo, const std::string_view name, const std::string_view value)
+      {
+        // Theme properties are claimed by the control factory on creation
+        {
+          auto itrFind = std::find_if(classInfo.ThemeProperties.begin(), classInfo.ThemeProperties.end(),
+                                      [name](const ControlPropertyRecord& record) { return record.Property->GetName().AsString() == name; });
+          if (itrFind != classInfo.ThemeProperties.end())
+          {
+            m_themeProperties.emplace_back(Intern(name), Intern(value));
+            return;
+          }
+        }
+
+        const StringViewLite nameView = ToStringViewLite(name);
+        auto itrFind = std::find_if(classInfo.Properties.begin(), classInfo.Properties.end(),
+                                    [nameView](const DataBinding::DependencyPropertyDefinition& def) { return def.Name() == nameView; });
+        if (itrFind != classInfo.Properties.end())
+        {
+          const auto propertyIndex = static_cast<uint32_t>(std::distance(classInfo.Properties.begin(), itrFind));
+          const std::optional<UITemplateValue> parsedValue = UITemplateValueParser::TryParse(itrFind->Type(), ToStringViewLite(value));
+          if (parsedValue.has_value())
+          {
+            AddProperty(name, propertyIndex, parsedValue.value());
+          }
+          return;
+        }
+        if (name == "GridLayout.Column" || name == "GridLayout.Row")
+        {
+          uint32_t index{};
+          StringParseUtil::Parse(index, ToStringViewLite(value));
+          const auto type = name == "GridLayout.Column" ? UITemplateValueType::GridColumn : UITemplateValueType::GridRow;
+          m_properties.emplace_back(Intern(name), 0u, type, std::array<uint32_t, 4>{index, 0u, 0u, 0u});
+          return;
+        }
+        if (name == "Name")
+        {
+          m_properties.emplace_back(Intern(name), 0u, UITemplateValueType::Name, std::array<uint32_t, 4>{Intern(value), 0u, 0u, 0u});
+          return;
+        }
+        // Unknown to the control we compiled against, so let the loader resolve it against the actual control instance
+        m_properties.emplace_back(Intern(name), 0u, UITemplateValueType::Deferred, std::array<uint32_t, 4>{Intern(value), 0u, 0u, 0u});
+      }
+
+      void AddProperty(const std::string_view name, const uint32_t propertyIndex, const UITemplateValue& value)
+      {
+        std::array<uint32_t, 4> payload = value.Payload;
+        switch (value.Type)
+        {
+        case UITemplateValueType::String:
+          payload[0] = Intern(value.Text0);
+          break;
+        case UITemplateValueType::Binding:
+          payload[0] = Intern(value.Text0);
+          payload[1] = Intern(value.Text1);
+          break;
+        default:
+          break;
+        }
+        m_properties.emplace_back(Intern(name), propertyIndex, value.Type, payload);
+      }
+
+      bool TryProcessGridChild(PendingGridDefinitions& rGridDefinitions, pugi::xml_node node)
+      {
+        const std::string_view name(node.name());
+        if (name == LocalConfig::ColumnDefinitionsName)
+        {
+          ProcessGridDefinitions(rGridDefinitions.Columns, node, "GridColumnDefinition", "Width");
+          return true;
+        }
+        if (name == LocalConfig::RowDefinitionsName)
+        {
+          ProcessGridDefinitions(rGridDefinitions.Rows, node, "GridRowDefinition", "Height");
+          return true;
+        }
+        return false;
+      }
+
+      static void ProcessGridDefinitions(std::vector<GridRowColumnDefinitionBase>& rDst, pugi::xml_node node, const char* const pszDefinitionName,
+                                         const std::string_view attributeName)
+      {
+        for (pugi::xml_node child : node.children(pszDefinitionName))
+        {
+          for (pugi::xml_attribute attr : child.attributes())
+          {
+            if (attr.name() == attributeName)
+            {
+              auto result = UITemplateValueParser::TryParseGridDefinition(attr.value());
+              if (result.has_value())
+              {
+                rDst.push_back(result.value());
+              }
+              else
+              {
+                FSLLOG3_ERROR("Failed to parse {}", pszDefinitionName);
+              }
+            }
+            else
+            {
+              FSLLOG3_ERROR("Unknown attribute: '{}'", attr.name());
+            }
+          }
+        }
+      }
+
+      UITemplateRange AddGridDefinitions(const std::vector<GridRowColumnDefinitionBase>& definitions)
+      {
+        if (definitions.empty())
+        {
+          return {};
+        }
+        const auto begin = static_cast<uint32_t>(m_gridDefinitions.size());
+        m_gridDefinitions.insert(m_gridDefinitions.end(), definitions.begin(), definitions.end());
+        return {begin, static_cast<uint32_t>(definitions.size())};
+      }
+
+      const ClassInfo& GetClassInfo(const std::string_view className)
+      {
+        auto itrFind = m_classInfo.find(className);
+        if (itrFind != m_classInfo.end())
+        {
+          return itrFind->second;
+        }
+
+        ClassInfo info;
+        const ControlName controlName(className);
+        const std::vector<ControlName> controlNames = m_controlFactory.GetControlNames();
+        if (std::find(controlNames.begin(), controlNames.end(), controlName) != controlNames.end())
+        {
+          info.IsValid = true;
+          info.Type = m_controlFactory.GetControlType(controlName);
+          info.ThemeProperties = m_controlFactory.GetControlThemeProperties(controlName);
+          info.Properties = m_controlFactory.GetControlProperties(controlName);
+        }
+        return m_classInfo.emplace(std::string(className), std::move(info)).first->second;
+      }
+
+      uint32_t Intern(const StringViewLite value)
+      {
+        return Intern(std::string_view(value.data(), value.size()));
+      }
+
+      uint32_t Intern(const std::string_view value)
+      {
+        auto itrFind = m_stringLookup.find(value);
+        if (itrFind != m_stringLookup.end())
+        {
+          return itrFind->second;
+        }
+        const auto stringId = static_cast<uint32_t>(m_strings.size());
+        m_strings.emplace_back(NumericCast<uint32_t>(m_stringData.size()), NumericCast<uint32_t>(value.size()));
+        m_stringData.append(value);
+        m_stringLookup.emplace(std::string(value), stringId);
+        return stringId;
+      }
+    };
+
+
+    UITemplate CompileDocument(ControlFactory& controlFactory, const pugi::xml_document& doc)
+    {
+      pugi::xml_node root = doc.child(LocalConfig::RootNodeName.data());
+      if (!root)
+      {
+        throw UsageErrorException("RootNode not found");
+      }
+
+      if (std::distance(root.children().begin(), root.children().end()) != 1u)
+      {
+        throw UsageErrorException("Root node did not contain the expected amount of children");
+      }
+
+      Compiler compiler(controlFactory);
+      return compiler.Compile(*root.children().begin());
+    }
+  }
+
+
+  UITemplate Compile(ControlFactory& controlFactory, const IO::Path& filename)
+  {
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_file(filename.AsUTF8String().AsString().c_str());
+    FSLLOG3_INFO("Load result: {}", result.description());
+    return CompileDocument(controlFactory, doc);
+  }
+
+
+  UITemplate CompileFromMemory(ControlFactory& controlFactory, const ReadOnlySpan<uint8_t> content)
+  {
+    pugi::xml_document doc;
+    pugi::xml_parse_result result = doc.load_buffer(content.data(), content.size());
+    FSLLOG3_WARNING_IF(!result, "Load result: {}", result.description());
+    return CompileDocument(controlFactory, doc);
+  }
+}
@@ -0,0 +1,499 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Log/String/FmtStringViewLite.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslDataBinding/Base/DataBindingService.hpp>
+#include <FslDataBinding/Base/Object/DependencyPropertyDefinitionVector.hpp>
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinition.hpp>
+#include <FslSimpleUI/Base/BaseWindow.hpp>
+#include <FslSimpleUI/Base/Control/ContentControl.hpp>
+#include <FslSimpleUI/Base/Layout/GridLayout.hpp>
+#include <FslSimpleUI/Base/Layout/Layout.hpp>
+#include <FslSimpleUI/Declarative/ControlFactory.hpp>
+#include <FslSimpleUI/Declarative/RadioGroupManager.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplate.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateLoader.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <bit>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+#include "UITemplatePropertySetter.hpp"
+#include "UITemplateValueParser.hpp"
+
+namespace Fsl::UI::Declarative::UITemplateLoader
+{
+  namespace
+  {
+    bool IsCompatible(const std::type_index& type, const UITemplateValueType valueType)
+    {
+      switch (valueType)
+      {
+      case UITemplateValueType::String:
+        return type == typeid(StringViewLite);
+      case UITemplateValueType::Bool:
+        return type == typeid(bool);
+      case UITemplateValueType::UInt8:
+        return type == typeid(uint8_t);
+      case UITemplateValueType::Int32:
+        return type == typeid(int32_t);
+      case UITemplateValueType::UInt32:
+        return type == typeid(uint32_t);
+      case UITemplateValueType::DpSize1D:
+        return type == typeid(DpSize1D);
+      case UITemplateValueType::DpSize1DF:
+        return type == typeid(DpSize1DF);
+      case UITemplateValueType::DpThicknessF:
+        return type == typeid(DpThicknessF);
+      case UITemplateValueType::DpLayoutSize1D:
+        return type == typeid(UI::DpLayoutSize1D);
+      case UITemplateValueType::ItemAlignment:
+        return type == typeid(UI::ItemAlignment);
+      case UITemplateValueType::LayoutOrientation:
+        return type == typeid(UI::LayoutOrientation);
+      case UITemplateValueType::ScrollModeFlags:
+        return type == typeid(UI::ScrollModeFlags);
+      case UITemplateValueType::TransitionType:
+        return type == typeid(TransitionType);
+      case UITemplateValueType::Binding:
+        return true;
+      default:
+        return false;
+      }
+    }
+
+    inline float ToFloat(const uint32_t value) noexcept
+    {
+      return std::bit_cast<float>(value);
+    }
+
+
+    class Instantiator
+    {
+      ControlFactory& m_controlFactory;
+      RadioGroupManager& m_radioGroupManager;
+      const std::shared_ptr<DataBinding::DataBindingService>& m_dataBinding;
+      const UITemplate& m_template;
+      std::vector<std::string>* const m_pErrors;
+      UITemplatePropertySetter m_valueSource;
+      std::vector<std::pair<StringViewLite, std::shared_ptr<UI::BaseWindow>>> m_namedControls;
+
+      std::vector<PropertyParserRecord> m_themePropertyScratchpad;
+      DataBinding::DependencyPropertyDefinitionVector m_propertiesScratchpad;
+
+    public:
+      Instantiator(ControlFactory& controlFactory, RadioGroupManager& radioGroupManager,
+                   const std::shared_ptr<DataBinding::DataBindingService>& dataBinding, const UITemplate& uiTemplate,
+                   std::vector<std::string>* const pErrors)
+        : m_controlFactory(controlFactory)
+        , m_radioGroupManager(radioGroupManager)
+        , m_dataBinding(dataBinding)
+        , m_template(uiTemplate)
+        , m_pErrors(pErrors)
+        , m_valueSource(dataBinding)
+      {
+      }
+
+      std::shared_ptr<UI::BaseWindow> TryCreateNode(const uint32_t nodeIndex, UI::GridLayout* const pParentGrid)
+      {
+        const UITemplateNode& node = m_template.GetNode(nodeIndex);
+        const StringViewLite className = m_template.GetString(node.ClassNameId);
+
+        auto current = TryCreateControl(className, m_template.GetThemeProperties(node));
+        if (!current)
+        {
+          ReportError("Could not create a control for class: '{}'", className);
+          return {};
+        }
+        ApplyProperties(current, m_template.GetProperties(node), pParentGrid != nullptr);
+
+        current->FinishAnimation();
+
+        if (node.Children.Count <= 0u && node.ColumnDefinitions.Count <= 0u && node.RowDefinitions.Count <= 0u)
+        {
+          return current;
+        }
+
+        auto* const pLayout = dynamic_cast<UI::Layout*>(current.get());
+        if (pLayout != nullptr)
+        {
+          auto* const pGrid = dynamic_cast<UI::GridLayout*>(current.get());
+          ApplyGridDefinitions(pGrid, node);
+
+          for (uint32_t i = 0; i < node.Children.Count; ++i)
+          {
+            const uint32_t childIndex = node.Children.Begin + i;
+            auto childControl = TryCreateNode(childIndex, pGrid);
+            if (childControl)
+            {
+              pLayout->AddChild(childControl);
+              if (pGrid != nullptr)
+              {
+                // The grid attachment properties can only be applied once the child has been added
+                ApplyGridProperties(*pGrid, childControl, m_template.GetProperties(m_template.GetNode(childIndex)));
+                current->FinishAnimation();
+              }
+            }
+          }
+        }
+        else
+        {
+          auto* const pContentControl = dynamic_cast<UI::ContentControl*>(current.get());
+          if (pContentControl != nullptr && node.Children.Count == 1u)
+          {
+            auto childControl = TryCreateNode(node.Children.Begin, nullptr);
+            if (childControl)
+            {
+              pContentControl->SetContent(childControl);
+            }
+          }
+          else
+          {
+            ReportError("Failed to add children to control of class: '{}'", className);
+          }
+        }
+        return current;
+      }
+
+    private:
+      template <typename... TArgs>
+      void ReportError(fmt::format_string<TArgs...> format, TArgs&&... args)
+      {
+        std::string message = fmt::format(format, std::forward<TArgs>(args)...);
+        FSLLOG3_ERROR("{}", message);
+        if (m_pErrors != nullptr)
+        {
+          m_pErrors->push_back(std::move(message));
+        }
+      }
+
+      std::shared_ptr<UI::BaseWindow> TryCreateControl(const StringViewLite className, const ReadOnlySpan<UITemplateThemeProperty> themeProperties)
+      {
+        m_themePropertyScratchpad.clear();
+        for (const auto& entry : themeProperties)
+        {
+          m_themePropertyScratchpad.emplace_back(m_template.GetString(entry.NameId), m_template.GetString(entry.ValueId));
+        }
+
+        Span<PropertyParserRecord> records = SpanUtil::AsSpan(m_themePropertyScratchpad);
+        auto result = m_controlFactory.TryCreate(m_radioGroupManager, std::string_view(className.data(), className.size()), records);
+        if (result)
+        {
+          for (const auto& record : records)
+          {
+            if (!record.Claimed)
+            {
+              ReportError("Unknown property: '{}'='{}'", record.Name, record.Value);
+            }
+          }
+        }
+        return result;
+      }
+
+      void ApplyProperties(const std::shared_ptr<UI::BaseWindow>& window, const ReadOnlySpan<UITemplateProperty> properties, const bool hasParentGrid)
+      {
+        bool hasPropertyDefinitions = false;
+        for (const UITemplateProperty& property : properties)
+        {
+          switch (property.Type)
+          {
+          case UITemplateValueType::GridColumn:
+          case UITemplateValueType::GridRow:
+            if (!hasParentGrid)
+            {
+              ReportError("Unknown property: '{}'='{}'", m_template.GetString(property.NameId), property.Payload[0]);
+            }
+            break;
+          case UITemplateValueType::Name:
+            RegisterName(m_template.GetString(property.Payload[0]), window);
+            break;
+          default:
+            if (!hasPropertyDefinitions)
+            {
+              m_propertiesScratchpad.clear();
+              window->ExtractProperties(m_propertiesScratchpad);
+              hasPropertyDefinitions = true;
+            }
+            ApplyProperty(*window, property);
+            break;
+          }
+        }
+      }
+
+      void ApplyProperty(UI::BaseWindow& window, const UITemplateProperty& property)
+      {
+        const StringViewLite name = m_template.GetString(property.NameId);
+        const DataBinding::DependencyPropertyDefinition* const pDef = TryFindProperty(name, property.PropertyIndexHint);
+        if (property.Type == UITemplateValueType::Deferred)
+        {
+          const StringViewLite strValue = m_template.GetString(property.Payload[0]);
+          if (pDef == nullptr)
+          {
+            ReportError("Unknown property: '{}'='{}'", name, strValue);
+            return;
+          }
+          const std::optional<UITemplateValue> value = UITemplateValueParser::TryParse(pDef->Type(), strValue);
+          if (value.has_value())
+          {
+            SetProperty(window, *pDef, value.value());
+          }
+          return;
+        }
+
+        if (pDef == nullptr)
+        {
+          ReportError("Unknown property: '{}'", name);
+          return;
+        }
+        if (!IsCompatible(pDef->Type(), property.Type))
+        {
+          ReportError("Property '{}' is of type '{}' which does not match the template value", name, pDef->Type().name());
+          return;
+        }
+
+        UITemplateValue value;
+        value.Type = property.Type;
+        value.Payload = property.Payload;
+        if (property.Type == UITemplateValueType::String || property.Type == UITemplateValueType::Binding)
+        {
+          value.Text0 = m_template.GetString(property.Payload[0]);
+        }
+        if (property.Type == UITemplateValueType::Binding)
+        {
+          value.Text1 = m_template.GetString(property.Payload[1]);
+        }
+        SetProperty(window, *pDef, value);
+      }
+
+      const DataBinding::DependencyPropertyDefinition* TryFindProperty(const StringViewLite name, const uint32_t indexHint) const
+      {
+        if (indexHint < m_propertiesScratchpad.size() && m_propertiesScratchpad[indexHint].Name() == name)
+        {
+          return &m_propertiesScratchpad[indexHint];
+        }
+        auto itrFind = std::find_if(m_propertiesScratchpad.begin(), m_propertiesScratchpad.end(),
+                                    [name](const DataBinding::DependencyPropertyDefinition& def) { return def.Name() == name; });
+        return itrFind != m_propertiesScratchpad.end() ? &(*itrFind) : nullptr;
+      }
+
+      void SetProperty(UI::BaseWindow& window, const DataBinding::DependencyPropertyDefinition& propertyDef, const UITemplateValue& value)
+      {
+        const auto& payload = value.Payload;
+        switch (value.Type)
+        {
+        case UITemplateValueType::Binding:
+          ApplyBinding(window, propertyDef, value.Text0, value.Text1);
+          break;
+        case UITemplateValueType::String:
+          m_valueSource.SetStringView(value.Text0);
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyStringView);
+          break;
+        case UITemplateValueType::Bool:
+          m_valueSource.SetBool(payload[0] != 0u);
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyBool);
+          break;
+        case UITemplateValueType::UInt8:
+          m_valueSource.SetUInt8(static_cast<uint8_t>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyUInt8);
+          break;
+        case UITemplateValueType::Int32:
+          m_valueSource.SetInt32(std::bit_cast<int32_t>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyInt32);
+          break;
+        case UITemplateValueType::UInt32:
+          m_valueSource.SetUInt32(payload[0]);
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyUInt32);
+          break;
+        case UITemplateValueType::DpSize1D:
+          m_valueSource.SetDpSize1D(DpSize1D::Create(std::bit_cast<int32_t>(payload[0])));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyDpSize1D);
+          break;
+        case UITemplateValueType::DpSize1DF:
+          m_valueSource.SetDpSize1DF(DpSize1DF::Create(ToFloat(payload[0])));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyDpSize1DF);
+          break;
+        case UITemplateValueType::DpThicknessF:
+          m_valueSource.SetDpThicknessF(DpThicknessF::Create(ToFloat(payload[0]), ToFloat(payload[1]), ToFloat(payload[2]), ToFloat(payload[3])));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyDpThicknessF);
+          break;
+        case UITemplateValueType::DpLayoutSize1D:
+          m_valueSource.SetDpLayoutSize1D(UI::DpLayoutSize1D::Create(ToFloat(payload[0])));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyDpLayoutSize1D);
+          break;
+        case UITemplateValueType::ItemAlignment:
+          m_valueSource.SetItemAlignment(static_cast<UI::ItemAlignment>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyItemAlignment);
+          break;
+        case UITemplateValueType::LayoutOrientation:
+          m_valueSource.SetOrientation(static_cast<UI::LayoutOrientation>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyLayoutOrientation);
+          break;
+        case UITemplateValueType::ScrollModeFlags:
+          m_valueSource.SetScrollModeFlags(static_cast<UI::ScrollModeFlags>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyScrollModeFlags);
+          break;
+        case UITemplateValueType::TransitionType:
+          m_valueSource.SetTransitionType(static_cast<TransitionType>(payload[0]));
+          ExecuteChanges(window, propertyDef, UITemplatePropertySetter::PropertyTransitionType);
+          break;
+        default:
+          ReportError("Unknown property value type: '{}'", propertyDef.Type().name());
+          break;
+        }
+      }
+
+      void ExecuteChanges(UI::BaseWindow& window, const DataBinding::DependencyPropertyDefinition& targetDef,
+                          const DataBinding::DependencyPropertyDefinition& srcDef)
+      {
+        window.SetBinding(targetDef, m_valueSource.GetPropertyHandle(srcDef));
+        m_dataBinding->ExecuteChanges();
+        window.ClearBinding(targetDef);
+        m_dataBinding->ExecuteChanges();
+      }
+
+      void ApplyBinding(UI::BaseWindow& window, const DataBinding::DependencyPropertyDefinition& targetDef, const StringViewLite elementName,
+                        const StringViewLite path)
+      {
+        auto itrFind = std::find_if(m_namedControls.begin(), m_namedControls.end(),
+                                    [elementName](const std::pair<StringViewLite, std::shared_ptr<UI::BaseWindow>>& entry)
+                                    { return entry.first == elementName; });
+        if (itrFind == m_namedControls.end())
+        {
+          ReportError("Could not find a named control called: '{}'", elementName);
+          return;
+        }
+        auto srcControl = itrFind->second;
+
+        DataBinding::DependencyPropertyDefinitionVector srcProperties;
+        srcControl->ExtractProperties(srcProperties);
+        auto itrFindProp = std::find_if(srcProperties.begin(), srcProperties.end(),
+                                        [path](const DataBinding::DependencyPropertyDefinition& def) { return def.Name() == path; });
+        if (itrFindProp == srcProperties.end())
+        {
+          ReportError("Could not find a src property called: '{}'", path);
+          return;
+        }
+
+        auto hSrc = srcControl->GetPropertyHandle(*itrFindProp);
+        window.SetBinding(targetDef, hSrc);
+      }
+
+      void RegisterName(const StringViewLite name, const std::shared_ptr<UI::BaseWindow>& window)
+      {
+        auto itrFind = std::find_if(m_namedControls.begin(), m_namedControls.end(),
+                                    [name](const std::pair<StringViewLite, std::shared_ptr<UI::BaseWindow>>& entry) { return entry.first == name; });
+        if (itrFind == m_namedControls.end())
+        {
+          m_namedControls.emplace_back(name, window);
+        }
+        else
+        {
+          ReportError("A control with that value already exist '{}'", name);
+        }
+      }
+
+      void ApplyGridDefinitions(UI::GridLayout* const pGrid, const UITemplateNode& node)
+      {
+        const ReadOnlySpan<GridRowColumnDefinitionBase> columnDefinitions = m_template.GetColumnDefinitions(node);
+        const ReadOnlySpan<GridRowColumnDefinitionBase> rowDefinitions = m_template.GetRowDefinitions(node);
+        if (pGrid == nullptr)
+        {
+          if (!columnDefinitions.empty() || !rowDefinitions.empty())
+          {
+            ReportError("Ignoring grid definitions as the control of class '{}' is not a grid", m_template.GetString(node.ClassNameId));
+          }
+          return;
+        }
+        for (const auto& entry : columnDefinitions)
+        {
+          pGrid->AddColumnDefinition(GridColumnDefinition(entry));
+        }
+        for (const auto& entry : rowDefinitions)
+        {
+          pGrid->AddRowDefinition(GridRowDefinition(entry));
+        }
+      }
+
+      static void ApplyGridProperties(UI::GridLayout& rGrid, const std::shared_ptr<UI::BaseWindow>& window,
+                                      const ReadOnlySpan<UITemplateProperty> properties)
+      {
+        for (const UITemplateProperty& property : properties)
+        {
+          if (property.Type == UITemplateValueType::GridColumn)
+          {
+            rGrid.SetColumn(window, property.Payload[0]);
+          }
+          else if (property.Type == UITemplateValueType::GridRow)
+          {
+            rGrid.SetRow(window, property.Payload[0]);
+          }
+        }
+      }
+    };
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, RadioGroupManager& rRadioGroupManager,
+                                              const std::shared_ptr<DataBinding::DataBindingService>& dataBinding, const UITemplate& uiTemplate)
+  {
+    if (uiTemplate.IsEmpty())
+    {
+      return {};
+    }
+    Instantiator instantiator(controlFactory, rRadioGroupManager, dataBinding, uiTemplate, nullptr);
+    return instantiator.TryCreateNode(0u, nullptr);
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                              const UITemplate& uiTemplate)
+  {
+    RadioGroupManager radioGroupManager;
+    return Instantiate(controlFactory, radioGroupManager, dataBinding, uiTemplate);
+  }
+
+
+  std::shared_ptr<UI::BaseWindow> Instantiate(ControlFactory& controlFactory, const std::shared_ptr<DataBinding::DataBindingService>& dataBinding,
+                                              const UITemplate& uiTemplate, std::vector<std::string>& rErrors)
+  {
+    if (uiTemplate.IsEmpty())
+    {
+      return {};
+    }
+    RadioGroupManager radioGroupManager;
+    Instantiator instantiator(controlFactory, radioGroupManager, dataBinding, uiTemplate, &rErrors);
+    return instantiator.TryCreateNode(0u, nullptr);
+  }
+}
@@ -0,0 +1,90 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslDataBinding/Base/Property/DependencyPropertyDefinitionFactory.hpp>
+#include "UITemplatePropertySetter.hpp"
+
+namespace Fsl::UI::Declarative
+{
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyBool =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<bool, UITemplatePropertySetter, &UITemplatePropertySetter::GetBool,
+                                                             &UITemplatePropertySetter::SetBool>("bool");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyUInt8 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<uint8_t, UITemplatePropertySetter, &UITemplatePropertySetter::GetUInt8,
+                                                             &UITemplatePropertySetter::SetUInt8>("UInt8");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyInt32 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<int32_t, UITemplatePropertySetter, &UITemplatePropertySetter::GetInt32,
+                                                             &UITemplatePropertySetter::SetInt32>("Int32");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyUInt32 =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<uint32_t, UITemplatePropertySetter, &UITemplatePropertySetter::GetUInt32,
+                                                             &UITemplatePropertySetter::SetUInt32>("UInt32");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyDpSize1D =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1D, UITemplatePropertySetter, &UITemplatePropertySetter::GetDpSize1D,
+                                                             &UITemplatePropertySetter::SetDpSize1D>("DpSize1D");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyDpSize1DF =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpSize1DF, UITemplatePropertySetter, &UITemplatePropertySetter::GetDpSize1DF,
+                                                             &UITemplatePropertySetter::SetDpSize1DF>("DpSize1DF");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyDpThicknessF =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpThicknessF, UITemplatePropertySetter, &UITemplatePropertySetter::GetDpThicknessF,
+                                                             &UITemplatePropertySetter::SetDpThicknessF>("DpThicknessF");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyDpLayoutSize1D =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<DpLayoutSize1D, UITemplatePropertySetter, &UITemplatePropertySetter::GetDpLayoutSize1D,
+                                                             &UITemplatePropertySetter::SetDpLayoutSize1D>("DpLayoutSize1D");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyItemAlignment =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ItemAlignment, UITemplatePropertySetter, &UITemplatePropertySetter::GetItemAlignment,
+                                                             &UITemplatePropertySetter::SetItemAlignment>("ItemAlignment");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyLayoutOrientation =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::LayoutOrientation, UITemplatePropertySetter,
+                                                             &UITemplatePropertySetter::GetLayoutOrientation,
+                                                             &UITemplatePropertySetter::SetOrientation>("LayoutOrientation");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyScrollModeFlags =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<UI::ScrollModeFlags, UITemplatePropertySetter,
+                                                             &UITemplatePropertySetter::GetScrollModeFlags,
+                                                             &UITemplatePropertySetter::SetScrollModeFlags>("ScrollModeFlags");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyTransitionType =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<TransitionType, UITemplatePropertySetter, &UITemplatePropertySetter::GetTransitionType,
+                                                             &UITemplatePropertySetter::SetTransitionType>("TransitionType");
+
+  DataBinding::DependencyPropertyDefinition UITemplatePropertySetter::PropertyStringView =
+    DataBinding::DependencyPropertyDefinitionFactory::Create<StringViewLite, UITemplatePropertySetter, &UITemplatePropertySetter::GetStringView,
+                                                             &UITemplatePropertySetter::SetStringView>("StringView");
+}
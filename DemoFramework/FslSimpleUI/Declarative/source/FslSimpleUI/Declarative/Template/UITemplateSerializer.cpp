@@ -0,0 +1,350 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Bits/ByteSpanUtil_ReadLE.hpp>
+#include <FslBase/Bits/ByteSpanUtil_WriteLE.hpp>
+#include <FslBase/Exceptions.hpp>
+#include <FslBase/IO/File.hpp>
+#include <FslBase/IO/Path.hpp>
+#include <FslBase/NumericCast.hpp>
+#include <FslBase/Span/SpanUtil_Vector.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateSerializer.hpp>
+#include <fmt/format.h>
+#include <algorithm>
+#include <bit>
+#include <cassert>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+namespace Fsl::UI::Declarative::UITemplateSerializer
+{
+  namespace
+  {
+    namespace LocalConfig
+    {
+      // 'FUIT'
+      constexpr uint32_t Magic = 0x54495546;
+      constexpr uint32_t Version = 1;
+    }
+
+    // The file is a header followed by the flat arrays stored as little endian uint32 words and finally the raw string data.
+    namespace HeaderOffset
+    {
+      constexpr std::size_t Magic = 0;
+      constexpr std::size_t Version = Magic + sizeof(uint32_t);
+      constexpr std::size_t StringDataSize = Version + sizeof(uint32_t);
+      constexpr std::size_t StringCount = StringDataSize + sizeof(uint32_t);
+      constexpr std::size_t NodeCount = StringCount + sizeof(uint32_t);
+      constexpr std::size_t ThemePropertyCount = NodeCount + sizeof(uint32_t);
+      constexpr std::size_t PropertyCount = ThemePropertyCount + sizeof(uint32_t);
+      constexpr std::size_t GridDefinitionCount = PropertyCount + sizeof(uint32_t);
+      constexpr std::size_t SizeOfHeader = GridDefinitionCount + sizeof(uint32_t);
+    }
+
+    namespace RecordWords
+    {
+      constexpr std::size_t String = 2;
+      constexpr std::size_t Node = 11;
+      constexpr std::size_t ThemeProperty = 2;
+      constexpr std::size_t Property = 7;
+      constexpr std::size_t GridDefinition = 2;
+    }
+
+    struct Counts
+    {
+      uint32_t StringDataSize{0};
+      uint32_t Strings{0};
+      uint32_t Nodes{0};
+      uint32_t ThemeProperties{0};
+      uint32_t Properties{0};
+      uint32_t GridDefinitions{0};
+
+      uint64_t CalcSizeInBytes() const noexcept
+      {
+        const uint64_t words = (uint64_t(Strings) * RecordWords::String) + (uint64_t(Nodes) * RecordWords::Node) +
+                               (uint64_t(ThemeProperties) * RecordWords::ThemeProperty) + (uint64_t(Properties) * RecordWords::Property) +
+                               (uint64_t(GridDefinitions) * RecordWords::GridDefinition);
+        return HeaderOffset::SizeOfHeader + (words * sizeof(uint32_t)) + StringDataSize;
+      }
+    };
+
+
+    class Writer
+    {
+      Span<uint8_t> m_dst;
+      std::size_t m_offset{0};
+
+    public:
+      explicit Writer(Span<uint8_t> dst, const std::size_t offset)
+        : m_dst(dst)
+        , m_offset(offset)
+      {
+      }
+
+      void Write(const uint32_t value)
+      {
+        m_offset += ByteSpanUtil::WriteLE(m_dst, m_offset, value);
+      }
+
+      void Write(const UITemplateRange& value)
+      {
+        Write(value.Begin);
+        Write(value.Count);
+      }
+
+      std::size_t Offset() const noexcept
+      {
+        return m_offset;
+      }
+    };
+
+
+    class Reader
+    {
+      ReadOnlySpan<uint8_t> m_src;
+      std::size_t m_offset{0};
+
+    public:
+      explicit Reader(ReadOnlySpan<uint8_t> src, const std::size_t offset)
+        : m_src(src)
+        , m_offset(offset)
+      {
+      }
+
+      uint32_t ReadUInt32()
+      {
+        const uint32_t value = ByteSpanUtil::ReadUInt32LE(m_src, m_offset);
+        m_offset += sizeof(uint32_t);
+        return value;
+      }
+
+      UITemplateRange ReadRange()
+      {
+        const uint32_t begin = ReadUInt32();
+        const uint32_t count = ReadUInt32();
+        return {begin, count};
+      }
+
+      std::size_t Offset() const noexcept
+      {
+        return m_offset;
+      }
+    };
+  }
+
+
+  bool IsBinaryTemplate(const ReadOnlySpan<uint8_t> content) noexcept
+  {
+    return content.size() >= HeaderOffset::SizeOfHeader && ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::Magic) == LocalConfig::Magic;
+  }
+
+
+  std::vector<uint8_t> Serialize(const UITemplate& uiTemplate)
+  {
+    const auto strings = uiTemplate.GetStrings();
+    const auto nodes = uiTemplate.GetNodes();
+    const auto themeProperties = uiTemplate.GetAllThemeProperties();
+    const auto properties = uiTemplate.GetAllProperties();
+    const auto gridDefinitions = uiTemplate.GetAllGridDefinitions();
+    const std::string& stringData = uiTemplate.GetStringData();
+
+    Counts counts;
+    counts.StringDataSize = NumericCast<uint32_t>(stringData.size());
+    counts.Strings = NumericCast<uint32_t>(strings.size());
+    counts.Nodes = NumericCast<uint32_t>(nodes.size());
+    counts.ThemeProperties = NumericCast<uint32_t>(themeProperties.size());
+    counts.Properties = NumericCast<uint32_t>(properties.size());
+    counts.GridDefinitions = NumericCast<uint32_t>(gridDefinitions.size());
+
+    std::vector<uint8_t> result(NumericCast<std::size_t>(counts.CalcSizeInBytes()));
+    Span<uint8_t> dst = SpanUtil::AsSpan(result);
+
+    Writer writer(dst, 0);
+    writer.Write(LocalConfig::Magic);
+    writer.Write(LocalConfig::Version);
+    writer.Write(counts.StringDataSize);
+    writer.Write(counts.Strings);
+    writer.Write(counts.Nodes);
+    writer.Write(counts.ThemeProperties);
+    writer.Write(counts.Properties);
+    writer.Write(counts.GridDefinitions);
+
+    for (const auto& entry : strings)
+    {
+      writer.Write(entry);
+    }
+    for (const auto& entry : nodes)
+    {
+      writer.Write(entry.ClassNameId);
+      writer.Write(entry.ThemeProperties);
+      writer.Write(entry.Properties);
+      writer.Write(entry.ColumnDefinitions);
+      writer.Write(entry.RowDefinitions);
+      writer.Write(entry.Children);
+    }
+    for (const auto& entry : themeProperties)
+    {
+      writer.Write(entry.NameId);
+      writer.Write(entry.ValueId);
+    }
+    for (const auto& entry : properties)
+    {
+      writer.Write(entry.NameId);
+      writer.Write(entry.PropertyIndexHint);
+      writer.Write(static_cast<uint32_t>(entry.Type));
+      for (const uint32_t value : entry.Payload)
+      {
+        writer.Write(value);
+      }
+    }
+    for (const auto& entry : gridDefinitions)
+    {
+      writer.Write(static_cast<uint32_t>(entry.Unit));
+      writer.Write(std::bit_cast<uint32_t>(entry.Size));
+    }
+
+    std::copy(stringData.begin(), stringData.end(), result.begin() + static_cast<std::ptrdiff_t>(writer.Offset()));
+    assert(writer.Offset() + stringData.size() == result.size());
+    return result;
+  }
+
+
+  UITemplate Deserialize(const ReadOnlySpan<uint8_t> content)
+  {
+    if (content.size() < HeaderOffset::SizeOfHeader)
+    {
+      throw FormatException("Content is too small to be a binary UI template");
+    }
+    if (ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::Magic) != LocalConfig::Magic)
+    {
+      throw FormatException("Not a binary UI template");
+    }
+    const uint32_t version = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::Version);
+    if (version != LocalConfig::Version)
+    {
+      throw FormatException(fmt::format("Unsupported binary UI template version {}, expected {}", version, LocalConfig::Version));
+    }
+
+    Counts counts;
+    counts.StringDataSize = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::StringDataSize);
+    counts.Strings = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::StringCount);
+    counts.Nodes = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::NodeCount);
+    counts.ThemeProperties = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::ThemePropertyCount);
+    counts.Properties = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::PropertyCount);
+    counts.GridDefinitions = ByteSpanUtil::ReadUInt32LE(content, HeaderOffset::GridDefinitionCount);
+    if (counts.CalcSizeInBytes() != content.size())
+    {
+      throw FormatException(fmt::format("Binary UI template size mismatch, expected {} bytes but got {}", counts.CalcSizeInBytes(), content.size()));
+    }
+
+    Reader reader(content, HeaderOffset::SizeOfHeader);
+
+    std::vector<UITemplateRange> strings(counts.Strings);
+    for (auto& rEntry : strings)
+    {
+      rEntry = reader.ReadRange();
+    }
+
+    std::vector<UITemplateNode> nodes(counts.Nodes);
+    for (auto& rEntry : nodes)
+    {
+      rEntry.ClassNameId = reader.ReadUInt32();
+      rEntry.ThemeProperties = reader.ReadRange();
+      rEntry.Properties = reader.ReadRange();
+      rEntry.ColumnDefinitions = reader.ReadRange();
+      rEntry.RowDefinitions = reader.ReadRange();
+      rEntry.Children = reader.ReadRange();
+    }
+
+    std::vector<UITemplateThemeProperty> themeProperties(counts.ThemeProperties);
+    for (auto& rEntry : themeProperties)
+    {
+      rEntry.NameId = reader.ReadUInt32();
+      rEntry.ValueId = reader.ReadUInt32();
+    }
+
+    std::vector<UITemplateProperty> properties(counts.Properties);
+    for (auto& rEntry : properties)
+    {
+      rEntry.NameId = reader.ReadUInt32();
+      rEntry.PropertyIndexHint = reader.ReadUInt32();
+      const uint32_t type = reader.ReadUInt32();
+      if (type >= static_cast<uint32_t>(UITemplateValueType::Count))
+      {
+        throw FormatException(fmt::format("Unknown UI template property value type: {}", type));
+      }
+      rEntry.Type = static_cast<UITemplateValueType>(type);
+      for (uint32_t& rValue : rEntry.Payload)
+      {
+        rValue = reader.ReadUInt32();
+      }
+    }
+
+    std::vector<GridRowColumnDefinitionBase> gridDefinitions(counts.GridDefinitions);
+    for (auto& rEntry : gridDefinitions)
+    {
+      const uint32_t unit = reader.ReadUInt32();
+      if (unit > static_cast<uint32_t>(GridUnitType::Star))
+      {
+        throw FormatException(fmt::format("Unknown UI template grid unit type: {}", unit));
+      }
+      rEntry.Unit = static_cast<GridUnitType>(unit);
+      rEntry.Size = std::bit_cast<float>(reader.ReadUInt32());
+    }
+
+    const auto* const pStringData = reinterpret_cast<const char*>(content.data() + reader.Offset());
+    std::string stringData(pStringData, counts.StringDataSize);
+
+    try
+    {
+      return {std::move(stringData),  std::move(strings),    std::move(nodes), std::move(themeProperties),
+              std::move(properties), std::move(gridDefinitions)};
+    }
+    catch (const std::invalid_argument& ex)
+    {
+      throw FormatException(fmt::format("Invalid binary UI template: {}", ex.what()));
+    }
+  }
+
+
+  void Save(const IO::Path& filename, const UITemplate& uiTemplate)
+  {
+    IO::File::WriteAllBytes(filename, Serialize(uiTemplate));
+  }
+
+
+  UITemplate Load(const IO::Path& filename)
+  {
+    const std::vector<uint8_t> content = IO::File::ReadAllBytes(filename);
+    return Deserialize(SpanUtil::AsReadOnlySpan(content));
+  }
+}
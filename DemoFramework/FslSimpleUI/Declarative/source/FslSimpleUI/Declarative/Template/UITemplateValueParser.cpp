@@ -0,0 +1,414 @@
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Log/String/FmtStringViewLite.hpp>
+#include <FslBase/Math/Dp/DpSize1D.hpp>
+#include <FslBase/Math/Dp/DpSize1DF.hpp>
+#include <FslBase/Math/Dp/DpThicknessF.hpp>
+#include <FslBase/Span/SpanUtil_Array.hpp>
+#include <FslBase/String/StringParseUtil.hpp>
+#include <FslBase/Transition/TransitionType.hpp>
+#include <FslSimpleUI/Base/Control/ScrollModeFlags.hpp>
+#include <FslSimpleUI/Base/DpLayoutSize1D.hpp>
+#include <FslSimpleUI/Base/ItemAlignment.hpp>
+#include <FslSimpleUI/Base/Layout/LayoutOrientation.hpp>
+#include <FslSimpleUI/Declarative/ThemeProperties/ParseHelper.hpp>
+#include <bit>
+#include <exception>
+#include "UITemplateValueParser.hpp"
+
+namespace Fsl::UI::Declarative::UITemplateValueParser
+{
+  namespace
+  {
+    UITemplateValue ToValue(const UITemplateValueType type, const uint32_t value0)
+    {
+      UITemplateValue result;
+      result.Type = type;
+      result.Payload[0] = value0;
+      return result;
+    }
+
+    std::optional<UITemplateValue> TryParseBinding(const StringViewLite strValue)
+    {
+      // Expected string format {Binding ElementName=,Path=}
+      auto res = strValue.substr(9);
+      res = res.substr(0, res.size() - 1);
+
+      auto splitIndex = res.find(',');
+      if (splitIndex >= res.size())
+      {
+        return {};
+      }
+
+      auto elementName = res.substr(0, splitIndex);
+      auto path = res.substr(splitIndex + 1);
+
+      //                            123456789012
+      if (!elementName.starts_with("ElementName="))
+      {
+        return {};
+      }
+      if (!path.starts_with("Path="))
+      {
+        return {};
+      }
+
+      UITemplateValue result;
+      result.Type = UITemplateValueType::Binding;
+      result.Text0 = elementName.substr(12);
+      result.Text1 = path.substr(5);
+      return result;
+    }
+
+    std::optional<UI::ItemAlignment> TryToItemAlignment(const StringViewLite value)
+    {
+      if (value == "Near")
+      {
+        return UI::ItemAlignment::Near;
+      }
+      if (value == "Center")
+      {
+        return UI::ItemAlignment::Center;
+      }
+      if (value == "Far")
+      {
+        return UI::ItemAlignment::Far;
+      }
+      if (value == "Stretch")
+      {
+        return UI::ItemAlignment::Stretch;
+      }
+      return {};
+    }
+
+    std::optional<UI::LayoutOrientation> TryToLayoutOrientation(const StringViewLite value)
+    {
+      if (value == "Vertical")
+      {
+        return UI::LayoutOrientation::Vertical;
+      }
+      if (value == "Horizontal")
+      {
+        return UI::LayoutOrientation::Horizontal;
+      }
+      return {};
+    }
+
+    std::optional<UI::ScrollModeFlags> TryToScrollModeFlags(const StringViewLite value)
+    {
+      if (value == "TranslateX")
+      {
+        return UI::ScrollModeFlags::TranslateX;
+      }
+      if (value == "TranslateY")
+      {
+        return UI::ScrollModeFlags::TranslateY;
+      }
+      if (value == "Translate")
+      {
+        return UI::ScrollModeFlags::Translate;
+      }
+      return {};
+    }
+
+    std::optional<TransitionType> TryToTransitionType(const StringViewLite value)
+    {
+      if (value == "Linear")
+      {
+        return TransitionType::Linear;
+      }
+      if (value == "EaseInSine")
+      {
+        return TransitionType::EaseInSine;
+      }
+      if (value == "EaseOutSine")
+      {
+        return TransitionType::EaseOutSine;
+      }
+      if (value == "EaseInOutSine")
+      {
+        return TransitionType::EaseInOutSine;
+      }
+      if (value == "EaseInQuad")
+      {
+        return TransitionType::EaseInQuad;
+      }
+      if (value == "EaseOutQuad")
+      {
+        return TransitionType::EaseOutQuad;
+      }
+      if (value == "EaseInOutQuad")
+      {
+        return TransitionType::EaseInOutQuad;
+      }
+      if (value == "EaseInCubic")
+      {
+        return TransitionType::EaseInCubic;
+      }
+      if (value == "EaseOutCubic")
+      {
+        return TransitionType::EaseOutCubic;
+      }
+      if (value == "EaseInOutCubic")
+      {
+        return TransitionType::EaseInOutCubic;
+      }
+      if (value == "EaseInQuart")
+      {
+        return TransitionType::EaseInQuart;
+      }
+      if (value == "EaseOutQuart")
+      {
+        return TransitionType::EaseOutQuart;
+      }
+      if (value == "EaseInOutQuart")
+      {
+        return TransitionType::EaseInOutQuart;
+      }
+      if (value == "EaseInQuint")
+      {
+        return TransitionType::EaseInQuint;
+      }
+      if (value == "EaseOutQuint")
+      {
+        return TransitionType::EaseOutQuint;
+      }
+      if (value == "EaseInOutQuint")
+      {
+        return TransitionType::EaseInOutQuint;
+      }
+      if (value == "EaseInExpo")
+      {
+        return TransitionType::EaseInExpo;
+      }
+      if (value == "EaseOutExpo")
+      {
+        return TransitionType::EaseOutExpo;
+      }
+      if (value == "EaseInOutExpo")
+      {
+        return TransitionType::EaseInOutExpo;
+      }
+      if (value == "EaseInCirc")
+      {
+        return TransitionType::EaseInCirc;
+      }
+      if (value == "EaseOutCirc")
+      {
+        return TransitionType::EaseOutCirc;
+      }
+      if (value == "EaseInOutCirc")
+      {
+        return TransitionType::EaseInOutCirc;
+      }
+      if (value == "EaseInBack")
+      {
+        return TransitionType::EaseInBack;
+      }
+      if (value == "EaseOutBack")
+      {
+        return TransitionType::EaseOutBack;
+      }
+      if (value == "EaseInOutBack")
+      {
+        return TransitionType::EaseInOutBack;
+      }
+      if (value == "EaseInElastic")
+      {
+        return TransitionType::EaseInElastic;
+      }
+      if (value == "EaseOutElastic")
+      {
+        return TransitionType::EaseOutElastic;
+      }
+      if (value == "EaseInOutElastic")
+      {
+        return TransitionType::EaseInOutElastic;
+      }
+      if (value == "EaseInBounce")
+      {
+        return TransitionType::EaseInBounce;
+      }
+      if (value == "EaseOutBounce")
+      {
+        return TransitionType::EaseOutBounce;
+      }
+      if (value == "EaseInOutBounce")
+      {
+        return TransitionType::EaseInOutBounce;
+      }
+      return {};
+    }
+  }
+
+
+  std::optional<UITemplateValue> TryParse(const std::type_index& type, const StringViewLite value)
+  {
+    if (value.starts_with("{Binding") && value.ends_with("}"))
+    {
+      return TryParseBinding(value);
+    }
+
+    if (type == typeid(StringViewLite))
+    {
+      UITemplateValue result;
+      result.Type = UITemplateValueType::String;
+      result.Text0 = value;
+      return result;
+    }
+    if (type == typeid(bool))
+    {
+      bool parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::Bool, parsedValue ? 1u : 0u);
+    }
+    if (type == typeid(uint8_t))
+    {
+      uint8_t parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::UInt8, parsedValue);
+    }
+    if (type == typeid(int32_t))
+    {
+      int32_t parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::Int32, std::bit_cast<uint32_t>(parsedValue));
+    }
+    if (type == typeid(uint32_t))
+    {
+      uint32_t parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::UInt32, parsedValue);
+    }
+    if (type == typeid(DpSize1D))
+    {
+      int32_t parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::DpSize1D, std::bit_cast<uint32_t>(parsedValue));
+    }
+    if (type == typeid(DpSize1DF))
+    {
+      float parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::DpSize1DF, std::bit_cast<uint32_t>(parsedValue));
+    }
+    if (type == typeid(DpThicknessF))
+    {
+      std::array<char, 256> scratchpad{};
+      std::array<float, 4> parsedValue{};
+      StringParseUtil::ParseArray(SpanUtil::AsSpan(parsedValue), ParseHelper::WrapAsArray(scratchpad, value));
+
+      UITemplateValue result;
+      result.Type = UITemplateValueType::DpThicknessF;
+      for (std::size_t i = 0; i < parsedValue.size(); ++i)
+      {
+        result.Payload[i] = std::bit_cast<uint32_t>(parsedValue[i]);
+      }
+      return result;
+    }
+    if (type == typeid(DpLayoutSize1D))
+    {
+      float parsedValue{};
+      StringParseUtil::Parse(parsedValue, value);
+      return ToValue(UITemplateValueType::DpLayoutSize1D, std::bit_cast<uint32_t>(parsedValue));
+    }
+    if (type == typeid(UI::ItemAlignment))
+    {
+      auto result = TryToItemAlignment(value);
+      if (result.has_value())
+      {
+        return ToValue(UITemplateValueType::ItemAlignment, static_cast<uint32_t>(result.value()));
+      }
+      FSLLOG3_ERROR("Unsupported ItemAlignment value: {}", value);
+      return {};
+    }
+    if (type == typeid(UI::LayoutOrientation))
+    {
+      auto result = TryToLayoutOrientation(value);
+      if (result.has_value())
+      {
+        return ToValue(UITemplateValueType::LayoutOrientation, static_cast<uint32_t>(result.value()));
+      }
+      FSLLOG3_ERROR("Unsupported LayoutOrientation value: {}", value);
+      return {};
+    }
+    if (type == typeid(UI::ScrollModeFlags))
+    {
+      auto result = TryToScrollModeFlags(value);
+      if (result.has_value())
+      {
+        return ToValue(UITemplateValueType::ScrollModeFlags, static_cast<uint32_t>(result.value()));
+      }
+      FSLLOG3_ERROR("Unsupported ScrollModeFlags value: {}", value);
+      return {};
+    }
+    if (type == typeid(TransitionType))
+    {
+      auto result = TryToTransitionType(value);
+      if (result.has_value())
+      {
+        return ToValue(UITemplateValueType::TransitionType, static_cast<uint32_t>(result.value()));
+      }
+      FSLLOG3_ERROR("Unsupported TransitionType value: {}", value);
+      return {};
+    }
+
+    FSLLOG3_ERROR("Unknown property value type: '{}'", type.name());
+    return {};
+  }
+
+
+  std::optional<GridRowColumnDefinitionBase> TryParseGridDefinition(const StringViewLite value)
+  {
+    if (value == "Auto")
+    {
+      return GridRowColumnDefinitionBase(GridUnitType::Auto);
+    }
+    if (value == "*")
+    {
+      return GridRowColumnDefinitionBase(GridUnitType::Star, 1.0f);
+    }
+
+    // Need a try parse for floats
+    try
+    {
+      float parsedValue = 0.0f;
+      StringParseUtil::Parse(parsedValue, value);
+      return GridRowColumnDefinitionBase(GridUnitType::Fixed, parsedValue);
+    }
+    catch (const std::exception&)
+    {
+    }
+    return {};
+  }
+}
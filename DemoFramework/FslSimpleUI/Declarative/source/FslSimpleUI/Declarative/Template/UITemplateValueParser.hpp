@@ -0,0 +1,67 @@
+#ifndef FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEVALUEPARSER_HPP
+#define FSLSIMPLEUI_DECLARATIVE_TEMPLATE_UITEMPLATEVALUEPARSER_HPP
+/****************************************************************************************************************************************************
+ * Copyright 2026 NXP
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ *    * Redistributions of source code must retain the above copyright notice,
+ *      this list of conditions and the following disclaimer.
+ *
+ *    * Redistributions in binary form must reproduce the above copyright notice,
+ *      this list of conditions and the following disclaimer in the documentation
+ *      and/or other materials provided with the distribution.
+ *
+ *    * Neither the name of the NXP. nor the names of
+ *      its contributors may be used to endorse or promote products derived from
+ *      this software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE DISCLAIMED.
+ * IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT,
+ * INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING,
+ * BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF
+ * LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE
+ * OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF
+ * ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ ****************************************************************************************************************************************************/
+
+#include <FslBase/String/StringViewLite.hpp>
+#include <FslSimpleUI/Base/Layout/GridRowColumnDefinition.hpp>
+#include <FslSimpleUI/Declarative/Template/UITemplateValueType.hpp>
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <typeindex>
+
+namespace Fsl::UI::Declarative
+{
+  //! A parsed value where the strings have not been interned (yet)
+  struct UITemplateValue
+  {
+    UITemplateValueType Type{UITemplateValueType::Deferred};
+    std::array<uint32_t, 4> Payload{};
+    //! The string value or the binding element name
+    StringViewLite Text0;
+    //! The binding path
+    StringViewLite Text1;
+  };
+
+  namespace UITemplateValueParser
+  {
+    //! @brief Parse the value string of a dependency property of the given type, this also recognizes the "{Binding ElementName=,Path=}" syntax
+    //! @return the value or std::nullopt if the type is unsupported or the value was not recognized (unsupported values are logged).
+    //! @throws FormatException if a numeric value could not be parsed
+    std::optional<UITemplateValue> TryParse(const std::type_index& type, const StringViewLite value);
+
+    //! @brief Parse a grid column width or row height ("Auto", "*" or a fixed dp size)
+    std::optional<GridRowColumnDefinitionBase> TryParseGridDefinition(const StringViewLite value);
+  }
+}
+
+#endif
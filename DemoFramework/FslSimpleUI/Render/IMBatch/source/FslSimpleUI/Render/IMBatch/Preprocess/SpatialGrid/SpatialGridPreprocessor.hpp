@@ -49,14 +49,14 @@
 #include "../Linear/PreprocessUtil2_TwoQueues.hpp"
 #include "../PreprocessResult.hpp"
 #include "../ProcessedCommandRecord.hpp"
-#include "SpatialHashGrid2D.hpp"
+#include "ZOrderSpatialHashGrid2D.hpp"
 
 namespace Fsl::UI::RenderIMBatch
 {
 
   class SpatialGridPreprocessor
   {
-    SpatialHashGrid2D m_grid;
+    ZOrderSpatialHashGrid2D m_grid;
     MaterialCache m_cache;
     PxSize2D m_windowSizePx;
     std::vector<ProcessedCommandRecord> m_finalEntries;
@@ -65,7 +65,7 @@ namespace Fsl::UI::RenderIMBatch
     bool m_allowDepthBuffer{false};
 
 
-    // static SpatialHashGrid2D CreateGrid(const PxSize2D windowSizePx, const int32_t cellsWidthPx, const int32_t cellsHeightPx)
+    // static ZOrderSpatialHashGrid2D CreateGrid(const PxSize2D windowSizePx, const int32_t cellsWidthPx, const int32_t cellsHeightPx)
     //{
     //   const uint32_t desiredStepSizeX = BitsUtil::NextPowerOfTwo(cellsWidthPx);
     //   const uint32_t desiredStepSizeY = BitsUtil::NextPowerOfTwo(cellsHeightPx);
@@ -73,9 +73,9 @@ namespace Fsl::UI::RenderIMBatch
     //   const uint32_t shiftY = BitsUtil::IndexOf(desiredStepSizeY);
     //   const uint32_t stepsX = (windowSizePx.Width() / desiredStepSizeX) + ((windowSizePx.Width() % desiredStepSizeX) > 0 ? 1 : 0);
     //   const uint32_t stepsY = (windowSizePx.Height() / desiredStepSizeY) + ((windowSizePx.Height() % desiredStepSizeY) > 0 ? 1 : 0);
-    //   return SpatialHashGrid2D(UncheckedNumericCast<uint16_t>(stepsX), UncheckedNumericCast<uint16_t>(stepsY), shiftX, shiftY);
+    //   return ZOrderSpatialHashGrid2D(UncheckedNumericCast<uint16_t>(stepsX), UncheckedNumericCast<uint16_t>(stepsY), shiftX, shiftY);
     // }
-    SpatialHashGrid2D CreateGrid(const PxSize2D windowSizePx, const int32_t cellsX, const int32_t cellsY)
+    ZOrderSpatialHashGrid2D CreateGrid(const PxSize2D windowSizePx, const int32_t cellsX, const int32_t cellsY)
     {
       FSLLOG3_VERBOSE5("Width:{} Height:{} cellsX:{} cellsY:{}", windowSizePx.RawWidth(), windowSizePx.RawHeight(), cellsX, cellsY);
       const uint32_t desiredStepSizeX = BitsUtil::NextPowerOfTwo(windowSizePx.RawWidth() / cellsX);
@@ -169,8 +169,8 @@ namespace Fsl::UI::RenderIMBatch
     }
 
   private:
-    // static void SanityCheck(const SpatialHashGrid2D& grid, Span<ProcessedCommandRecord> dstSpan, ReadOnlySpan<ProcessedCommandRecord> srcSpan,
-    //                         const uint32_t count)
+    // static void SanityCheck(const ZOrderSpatialHashGrid2D& grid, Span<ProcessedCommandRecord> dstSpan,
+    //                         ReadOnlySpan<ProcessedCommandRecord> srcSpan, const uint32_t count)
     //{
     //   for (uint32_t i = 0; i < count; ++i)
     //   {
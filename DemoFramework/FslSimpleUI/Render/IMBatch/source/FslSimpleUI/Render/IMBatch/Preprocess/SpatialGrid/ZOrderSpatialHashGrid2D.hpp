@@ -1,5 +1,5 @@
-#ifndef FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_SPATIALHASHGRID2D_HPP
-#define FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_SPATIALHASHGRID2D_HPP
+#ifndef FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_ZORDERSPATIALHASHGRID2D_HPP
+#define FSLSIMPLEUI_RENDER_IMBATCH_PREPROCESS_SPATIALGRID_ZORDERSPATIALHASHGRID2D_HPP
 /****************************************************************************************************************************************************
  * Copyright 2022-2023 NXP
  * All rights reserved.
@@ -42,7 +42,7 @@
 
 namespace Fsl
 {
-  class SpatialHashGrid2D
+  class ZOrderSpatialHashGrid2D
   {
     struct Record
     {
@@ -57,7 +57,7 @@ namespace Fsl
     uint8_t m_shiftY{};
 
   public:
-    SpatialHashGrid2D(const uint16_t gridCellCountX, const uint16_t gridCellCountY, const uint8_t shiftX, const uint8_t shiftY)
+    ZOrderSpatialHashGrid2D(const uint16_t gridCellCountX, const uint16_t gridCellCountY, const uint8_t shiftX, const uint8_t shiftY)
       : m_entries(gridCellCountX * gridCellCountY)
       , m_gridCellCountX(gridCellCountX)
       , m_gridCellCountY(gridCellCountY)
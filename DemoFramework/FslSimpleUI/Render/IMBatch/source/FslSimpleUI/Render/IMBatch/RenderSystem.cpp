@@ -31,6 +31,7 @@
 
 #include "RenderSystem.hpp"
 #include <FslBase/Log/Log3Fmt.hpp>
+#include <FslBase/Trace/Trace.hpp>
 #include <FslGraphics/Render/Basic/BasicCameraInfo.hpp>
 #include <FslGraphics/Render/Basic/IBasicRenderSystem.hpp>
 #include <FslGraphics/Sprite/BasicImageSprite.hpp>
@@ -915,7 +916,10 @@ namespace Fsl::UI::RenderIMBatch
           pPerformanceCapture->Begin(RenderPerformanceCaptureId::UpdateBuffers);
         }
 
-        uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher);
+        {
+          FSL_TRACE_ZONE("UI.Render", "UpdateBuffers");
+          uploadStats = UploadMeshChanges(rBuffers, renderSystem, batcher);
+        }
 
         if (pPerformanceCapture != nullptr)
         {
@@ -934,8 +938,11 @@ namespace Fsl::UI::RenderIMBatch
       }
 
       DrawStats drawStats;
-      DrawMeshes(renderSystem, drawStats, batcher, meshManager, SpanUtil::UncheckedAsReadOnlySpan(rBuffers, 0, batcher.GetSegmentCount()), cameraInfo,
-                 maxDrawCalls);
+      {
+        FSL_TRACE_ZONE("UI.Render", "ScheduleDraw");
+        DrawMeshes(renderSystem, drawStats, batcher, meshManager, SpanUtil::UncheckedAsReadOnlySpan(rBuffers, 0, batcher.GetSegmentCount()),
+                   cameraInfo, maxDrawCalls);
+      }
 
 
       if (pPerformanceCapture != nullptr)
@@ -953,6 +960,7 @@ namespace Fsl::UI::RenderIMBatch
                 DrawCommandBufferEx& rCommandBuffer, const BasicCameraInfo& cameraInfo, TPreprocessor& rPreprocessor,
                 RenderPerformanceCapture* const pPerformanceCapture, const uint32_t maxDrawCalls, const bool isNewCommandBuffer)
     {
+      FSL_TRACE_ZONE("UI.Render", "Draw");
       if (isNewCommandBuffer)
       {
         auto capacity = rMeshManager.GetCapacity();
@@ -976,17 +984,23 @@ namespace Fsl::UI::RenderIMBatch
                 pPerformanceCapture->Begin(RenderPerformanceCaptureId::PreprocessDrawCommands);
               }
 
-              rPreprocessor.Process(rProcessedCommandRecords, commandSpan, rMeshManager);
+              {
+                FSL_TRACE_ZONE("UI.Render", "PreprocessDrawCommands");
+                rPreprocessor.Process(rProcessedCommandRecords, commandSpan, rMeshManager);
+              }
 
               if (pPerformanceCapture != nullptr)
               {
                 pPerformanceCapture->EndThenBegin(RenderPerformanceCaptureId::PreprocessDrawCommands, RenderPerformanceCaptureId::GenerateMeshes);
               }
 
-              ReadOnlySpan<ProcessedCommandRecord> opaqueSpan = rPreprocessor.GetOpaqueSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer);
-              ReadOnlySpan<ProcessedCommandRecord> transparentSpan = rPreprocessor.GetTransparentSpan(rProcessedCommandRecords);
-              ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan, rCommandBuffer);
+              {
+                FSL_TRACE_ZONE("UI.Render", "GenerateMeshes");
+                ReadOnlySpan<ProcessedCommandRecord> opaqueSpan = rPreprocessor.GetOpaqueSpan(rProcessedCommandRecords);
+                ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, opaqueSpan, commandSpan, rCommandBuffer);
+                ReadOnlySpan<ProcessedCommandRecord> transparentSpan = rPreprocessor.GetTransparentSpan(rProcessedCommandRecords);
+                ProcessDrawCommands(rBatcher, rMeshManager, rTextMeshBuilder, transparentSpan, commandSpan, rCommandBuffer);
+              }
 
               // FSLLOG3_INFO("commandSpan:{} Opaque:{} Transparent:{}", commandSpan.size(), opaqueSpan.size(), transparentSpan.size());
 
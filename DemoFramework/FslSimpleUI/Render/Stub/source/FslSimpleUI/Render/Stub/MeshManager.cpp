@@ -146,7 +146,6 @@ namespace Fsl::UI::RenderStub
 
   bool MeshManager::DestroyMesh(const MeshHandle hMesh) noexcept
   {
-    assert(m_isDisposed);
     return !m_isDisposed ? m_meshes.Remove(hMesh.Value) : false;
   }
 